@@ -48,6 +48,51 @@
      -> Updated the "ID enums" (please search: [DNA_ID_enums 1/2] and [DNA_ID_enums 2/2]).
 
      -> Added some mods to change Chunk struct size fields if BLENDER_VERSION>=500 is defined
+
+     -> Added fbtFile::PM_MMAP: parse(path, fbtFile::PM_MMAP) maps an uncompressed .blend file in memory and
+        uses the chunk payloads in place (instead of copying each of them into the heap before link()).
+     -> fbtFile::parse(const void* memory, ...) borrows uncompressed memory instead of copying it (see its declaration).
+     -> fbtFile::parse(const char* path, ...) opens the file only once: its magic bytes (BLENDER, gzip or zstd) select the decoder.
+     -> Added #define FBT_USE_THREADS 1 (needs -pthread on POSIX): the frames of multi-frame zstd files are decompressed in parallel
+        (FBT_MAX_THREADS workers, one per core by default).
+     -> Added fbtZstdSeekableStream: random access to zstd files in the seekable format (only the frames covering
+        the bytes read are decompressed). parse(path) uses it when the file has a seek table.
+     -> With FBT_USE_THREADS, parse(path) reads (and inflates) uncompressed and gzip files on a worker thread,
+        FBT_READ_AHEAD_SIZE bytes ahead of the parser (fbtReadAheadStream).
+     -> Added fbtFile::scanChunks(...): lists the chunk headers (and their file offsets) without loading anything.
+     -> Added fbtFile::setLoadFilter(...): only the listed ID types (and the blocks they reach) are read and linked.
+     -> Chunk payloads, MemoryChunk records and linked blocks are bump allocated (fbtMemoryArena, FBT_ARENA_BLOCK_SIZE):
+        the payloads are released all together after linking, the rest with the fbtFile.
+     -> Old pointers are resolved through a sorted index of the chunk address ranges and are read whole: the file pointer
+        size and endianness are honored. With #define FBT_RESOLVE_INNER_POINTERS 1 the pointers into the middle of a block
+        resolve too (by default they become 0, as before: a stale pointer can land inside an unrelated block).
+     -> Added fbtFile::readThumbnail(...): reads the preview image (TEST chunk) only, stopping right after it.
+     -> With FBT_USE_THREADS, link() converts the blocks on the worker pool (pointer arrays first, notifyData() last,
+        both in file order).
+     -> link() compiles the conversion of each struct once (fbtFile::LinkOp plans: adjacent members merged into
+        single copy/swap/pointer runs) and runs it for every element.
+     -> Structs with a byte-identical layout in the file (fbtStruct::SAME_LAYOUT) are copied a block at a time:
+        only their pointers are patched.
+     -> Raw data and the blocks of identical layout are linked in place, in their payload (when the file was read
+        into the heap and the payload has an arena block of its own, which is kept); the other big payloads are
+        released as soon as they are converted, the small ones all together after linking.
+     -> fbtSwap16/32/64(pointer, len) swap whole arrays with AVX2/SSSE3/SSE2/NEON when the compiler targets them
+        (#define FBT_USE_SIMD 0: scalar only). link() swaps runs of members, and blocks of one type, in one call.
+     -> The old pointers of the chunk headers of files of the other endianness are swapped too (they did not match any block).
+     -> Number type changes between the file and the memory DNA (integer ones included, e.g. int -> short) go through
+        whole-array cast kernels (fbtGetCastKernel()), which replace castValue(): it zeroed the values it could not read
+        before writing them. copyValues() copies the right way.
+     -> Added fbtFile::setLazyLink(...): parse() converts the ID blocks only, the others are converted the first time
+        fbtFile::resolve(...)/get<T>(...) reach them (which pass the ID blocks the ID lists link through).
+     -> The file DNA tables are cached (fbtDNACache, FBT_DNA_CACHE_SIZE) by their DNA1 block (hashed, then compared), already
+        linked: the next files of the same Blender build skip reading, compiling and linking them. Linking only writes the
+        file tables (fbtFile::getFileTable() returns them const). The cache is freed at exit, once the last fbtFile is gone.
+     -> The memory DNA tables are built once per process and shared, read only, by every fbtFile (fbtFile::getMemoryTable()
+        returns them const).
+     -> fbtBlendUpdater saves the compiled memory tables next to bfBlenderFBT (bfBlenderTables): fbtBlend loads them
+        instead of running fbtBinTables::compile() (which still runs when they do not match the DNA).
+     -> fbtLinkCompiler matches the members of a struct through a hash index of the file members (base name, array index,
+        depth and key chain) instead of scanning all of them for each memory member.
 */
 #ifndef _fbtBlend_h_
 #define _fbtBlend_h_
@@ -64,6 +109,7 @@
 // global config settings
 //#define FBT_USE_GZ_FILE 1           // Adds support to PM_COMPRESSED .blend < 3.00 files (needs linking to zlib: -lz)
 //#define FBT_USE_ZSTD_FILE 1         // Adds support to PM_COMPRESSED .blend 3.00 files (needs linking to zlib: -lzstd)
+//#define FBT_USE_THREADS 1           // Decompresses multi-frame zstd files and links the blocks on a worker pool (needs -pthread on POSIX)
 #define fbtDEBUG        1           // Traceback detail
 //#define FBT_TYPE_LEN_VALIDATE   1   // Write a validation file (use MakeFBT.cmake->ADD_FBT_VALIDATOR to add a self validating build)
 // global config settings end
@@ -81,6 +127,11 @@
 #   undef FBT_USE_ZSTD_FILE
 #   define FBT_USE_ZSTD_FILE 1
 #endif
+// Workaround for people just defining FBT_USE_THREADS, without setting it to 1
+#ifdef FBT_USE_THREADS
+#   undef FBT_USE_THREADS
+#   define FBT_USE_THREADS 1
+#endif
 
 #include <string.h> //memcmp
 
@@ -116,8 +167,48 @@
 #       define FBT_ARRAY_SLOTS         2   // Maximum dimensional array, eg: (int m_member[..][..] -> [FBT_ARRAY_SLOTS])
 #   endif
 #endif
+#ifndef FBT_USE_MMAP_FILE
+#   define FBT_USE_MMAP_FILE       1   // PM_MMAP maps uncompressed files in memory (when 0, PM_MMAP falls back to PM_UNCOMPRESSED)
+#endif
+#ifndef FBT_IN_PLACE_ALIGNMENT
+#   define FBT_IN_PLACE_ALIGNMENT  4   // Memory backed chunk payloads are used in place only if aligned to this (otherwise they're copied)
+#endif
+#ifndef FBT_MAX_THREADS
+#   define FBT_MAX_THREADS         0   // Worker threads used when FBT_USE_THREADS is 1 (0: one per core)
+#endif
+#ifndef FBT_READ_AHEAD_SIZE
+#   define FBT_READ_AHEAD_SIZE     (4 << 20)   // Bytes a worker thread reads (and decompresses) ahead of the parser when FBT_USE_THREADS is 1 (0: none)
+#endif
+#ifndef FBT_ARENA_BLOCK_SIZE
+#   define FBT_ARENA_BLOCK_SIZE    (1 << 20)   // Chunk payloads and linked blocks are carved out of blocks this big (0: one malloc each)
+#endif
+#ifndef FBT_RESOLVE_INNER_POINTERS
+#   define FBT_RESOLVE_INNER_POINTERS 0   // Old pointers into the middle of a block resolve into its converted copy (0: they become 0)
+#endif
+#ifndef FBT_DNA_CACHE_SIZE
+#   define FBT_DNA_CACHE_SIZE      4   // File DNA tables (compiled and linked) kept for the next files of the same Blender build (0: none)
+#endif
+#ifndef FBT_USE_SIMD
+#   define FBT_USE_SIMD            1   // Bulk byte swapping uses the AVX2/SSSE3/SSE2/NEON instructions the compiler targets (0: scalar only)
+#endif
 // global config settings end
 
+#if FBT_USE_SIMD == 1
+#   if defined(__AVX2__)
+#       define FBT_SIMD_AVX2   1
+#       include <immintrin.h>
+#   elif defined(__SSSE3__)
+#       define FBT_SIMD_SSSE3  1
+#       include <tmmintrin.h>
+#   elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#       define FBT_SIMD_SSE2   1
+#       include <emmintrin.h>
+#   elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#       define FBT_SIMD_NEON   1
+#       include <arm_neon.h>
+#   endif
+#endif
+
 
 /** \addtogroup FBT
 *  @{
@@ -364,35 +455,90 @@ FBT_INLINE FBTuint64 fbtSwap64(const FBTuint64& in)
 }
 
 
-FBT_INLINE void fbtSwap16(FBTuint16* sp, FBTsize len)
+// Swaps the bytes of the first values of the len N-byte values at p, 16 or 32 bytes at a time:
+// returns how many it did (the caller swaps the rest). p needs no alignment.
+template <int N>
+FBT_INLINE FBTsize fbtSwapVector(FBTubyte* p, FBTsize len)
 {
-	FBTsizeType i;
-	for (i = 0; i < len; ++i)
+	const FBTsize bytes = len * N;
+	FBTsize i = 0;
+
+#if defined(FBT_SIMD_AVX2) || defined(FBT_SIMD_SSSE3)
+	// (shuffles pick bytes within 16 byte lanes)
+	static const FBTubyte order2[32] = {1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14,
+	                                    1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14};
+	static const FBTubyte order4[32] = {3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+	                                    3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12};
+	static const FBTubyte order8[32] = {7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8,
+	                                    7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8};
+	const FBTubyte* order = N == 2 ? order2 : (N == 4 ? order4 : order8);
+
+#   if defined(FBT_SIMD_AVX2)
+	const __m256i order32 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(order));
+	for (; i + 32 <= bytes; i += 32)
+	{
+		__m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i));
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(p + i), _mm256_shuffle_epi8(v, order32));
+	}
+#   endif
+	const __m128i order16 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(order));
+	for (; i + 16 <= bytes; i += 16)
+	{
+		__m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(p + i), _mm_shuffle_epi8(v, order16));
+	}
+#elif defined(FBT_SIMD_SSE2)
+	for (; i + 16 <= bytes; i += 16)
+	{
+		__m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+		v = _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+		if (N == 4)
+		{
+			v = _mm_shufflelo_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+			v = _mm_shufflehi_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+		}
+		else if (N == 8)
+		{
+			v = _mm_shufflelo_epi16(v, _MM_SHUFFLE(0, 1, 2, 3));
+			v = _mm_shufflehi_epi16(v, _MM_SHUFFLE(0, 1, 2, 3));
+		}
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(p + i), v);
+	}
+#elif defined(FBT_SIMD_NEON)
+	for (; i + 16 <= bytes; i += 16)
 	{
-		*sp = fbtSwap16(*sp);
-		++sp;	
-	}	
+		uint8x16_t v = vld1q_u8(p + i);
+		v = N == 2 ? vrev16q_u8(v) : (N == 4 ? vrev32q_u8(v) : vrev64q_u8(v));
+		vst1q_u8(p + i, v);
+	}
+#else
+	(void)p;
+	(void)bytes;
+#endif
+	return i / N;
+}
+
+
+FBT_INLINE void fbtSwap16(FBTuint16* sp, FBTsize len)
+{
+	FBTsize i = fbtSwapVector<2>(reinterpret_cast<FBTubyte*>(sp), len);
+	for (; i < len; ++i)
+		sp[i] = fbtSwap16(sp[i]);
 }
 
 FBT_INLINE void fbtSwap32(FBTuint32* ip, FBTsize len)
-{	 
-	FBTsizeType i;
-	for (i = 0; i < len; ++i)
-	{
-		*ip = fbtSwap32(*ip);
-		++ip;
-	}
+{
+	FBTsize i = fbtSwapVector<4>(reinterpret_cast<FBTubyte*>(ip), len);
+	for (; i < len; ++i)
+		ip[i] = fbtSwap32(ip[i]);
 }
 
 
 FBT_INLINE void fbtSwap64(FBTuint64* dp, FBTsize len)
-{	 
-	FBTsizeType i;
-	for (i = 0; i < len; ++i)
-	{
-		*dp = fbtSwap64(*dp);
-		++dp;
-	}
+{
+	FBTsize i = fbtSwapVector<8>(reinterpret_cast<FBTubyte*>(dp), len);
+	for (; i < len; ++i)
+		dp[i] = fbtSwap64(dp[i]);
 }
 
 
@@ -462,6 +608,40 @@ public:
 
 
 
+// Bump allocator: its memory is only released all together (clear() or destruction)
+class fbtMemoryArena
+{
+public:
+	enum {ALIGNMENT = 16};
+
+	fbtMemoryArena(FBTsize blockSize = FBT_ARENA_BLOCK_SIZE) : m_blocks(0), m_blockSize(blockSize) {}
+	~fbtMemoryArena() { clear(); }
+
+	void*   alloc(FBTsize size);    // ALIGNMENT aligned (if malloc() is), not zeroed: 0 on failure
+	void    clear(void);
+
+	// Big requests get a block of their own, that can be released before the others
+	bool    isOwnBlock(FBTsize size) const {return size > m_blockSize / 4;}
+	void    release(void* p);               // p: alloc(size) with isOwnBlock(size)
+	void    adopt(fbtMemoryArena& other, void* p);  // takes the block of p from other (p: other.alloc(size) with isOwnBlock(size))
+
+private:
+	struct Block
+	{
+		Block*  m_next, *m_prev;
+		FBTsize m_size, m_used;
+	};
+	enum {HEADER_SIZE = (sizeof(Block) + ALIGNMENT - 1) & ~(ALIGNMENT - 1)};
+
+	Block*  m_blocks;   // the first one is the one being filled
+	FBTsize m_blockSize;
+
+	fbtMemoryArena(const fbtMemoryArena&);
+	fbtMemoryArena& operator=(const fbtMemoryArena&);
+};
+
+
+
 template <typename T>
 class fbtArrayIterator
 {
@@ -1155,6 +1335,22 @@ public:
 		if (m_lastPos != FBT_NPOS && m_lastKey == hk)
 			return m_lastPos;
 
+		FBTsizeType fh = lookup(key);
+		if (fh != FBT_NPOS)
+		{
+			m_lastKey = hk;
+			m_lastPos = fh;
+		}
+		return fh;
+	}
+
+	// find() without the last hit memo: for tables read by several threads
+	FBTsizeType lookup(const Key& key) const
+	{
+		if (m_capacity == 0 || m_capacity == FBT_NPOS || m_size == 0)
+			return FBT_NPOS;
+
+		FBTsizeType hk = key.hash();
 		FBThash hr = _FBT_UTHASHTABLE_HKHASH(hk);
 
 		FBT_ASSERT(m_bptr && m_iptr && m_nptr);
@@ -1163,14 +1359,7 @@ public:
 		while (fh != FBT_NPOS && (key != m_bptr[fh].first))
 			fh = m_nptr[fh];
 
-
-		if (fh != FBT_NPOS)
-		{
-			m_lastKey = hk;
-			m_lastPos = fh;
-
-			FBT_ASSERT(fh >= 0  && fh < m_size);
-		}
+		FBT_ASSERT(fh == FBT_NPOS || (fh >= 0  && fh < m_size));
 		return fh;
 	}
 
@@ -1855,6 +2044,10 @@ FBT_INLINE bool fbtIsNumberType(FBTuint32 typeKey)
 	return tp != FBT_PRIM_VOID && tp != FBT_PRIM_UNKNOWN;
 }
 
+// Converts len values of a number type into another one (src needs no alignment)
+typedef void (*fbtCastKernel)(const void* src, void* dst, FBTsize len);
+fbtCastKernel fbtGetCastKernel(FBT_PRIM_TYPE src, FBT_PRIM_TYPE dst);  // 0 if either is not a number type
+
 
 
 /** @}*/
@@ -1904,9 +2097,18 @@ public:
 		PM_UNCOMPRESSED,
 		PM_COMPRESSED,
 		PM_READTOMEMORY,
+		PM_MMAP,            // uncompressed only: chunk payloads are used in place from the mapped file
 
 	};
 
+	enum FileCompression
+	{
+		FC_UNKNOWN,
+		FC_NONE,            // starts with the uncompressed file detector prefix ("BLENDER")
+		FC_GZIP,
+		FC_ZSTD,
+	};
+
 	enum FileHeader
 	{
 		FH_ENDIAN_SWAP  = (1 << 0),
@@ -1960,6 +2162,9 @@ public:
 		enum Flag
 		{
 			BLK_MODIFIED = (1 << 0),
+			BLK_EXTERNAL = (1 << 1),    // m_block points into the stream memory: it must not be freed
+			BLK_OWN_PAYLOAD = (1 << 2), // m_block has an m_payloads block of its own: released once converted
+			BLK_LINKED   = (1 << 3),    // lazy link: already converted (or found unconvertible)
 		};
 
 		MemoryChunk* m_next, *m_prev;
@@ -1972,6 +2177,18 @@ public:
 		FBTtype      m_newTypeId;
 	};
 
+	// A chunk header, as listed by scanChunks()
+	struct ChunkInfo
+	{
+		FBTuint64    m_offset;      // of the payload, in the (uncompressed) file
+		FBTuint64    m_len;
+		FBTuint64    m_old;
+		FBTuint64    m_nr;
+		FBTuint32    m_code;
+		FBTuint32    m_typeid;
+	};
+	typedef fbtArray<ChunkInfo> ChunkDirectory;
+
 public:
 
 
@@ -1980,8 +2197,40 @@ public:
 
     int parse(const char* path,const char* uncompressedFileDetectorPrefix="BLENDER");
     int parse(const char* path, int mode/* = PM_UNCOMPRESSED*/);
+    // Uncompressed memory is borrowed, not copied: the chunk table references it directly, so it must stay valid
+    // (and unmodified) until parse() returns. Nothing references it afterwards: the caller can free it right away.
     int parse(const void* memory, FBTsize sizeInBytes, int mode = PM_UNCOMPRESSED, bool suppressHeaderWarning=false);
 
+    // Lists the chunk headers in file order (ENDB excluded) without reading their payloads: they're seeked over
+    // (skipped on streams that can't seek, e.g. gzip). 'dnaIndex' (optional) gets the position of DNA1 in 'dir'
+    // (FBT_NPOS if missing). Nothing is loaded or linked: only getHeader() and getVersion() change.
+    int scanChunks(const char* path, ChunkDirectory& dir, FBTsizeType* dnaIndex = 0, const char* uncompressedFileDetectorPrefix="BLENDER");
+    int scanChunks(const void* memory, FBTsize sizeInBytes, ChunkDirectory& dir, FBTsizeType* dnaIndex = 0);
+
+    // Reads the preview image Blender stores (TEST chunk) near the start of the file: only the header and the leading
+    // REND/TEST chunks are read (compressed files are decompressed only that far), nothing is loaded or linked.
+    // 'pixels' gets width*height RGBA texels (bottom row first), that the caller must free using: delete[] pixels;
+    // Returns FS_FAILED (quietly) if the file has no preview.
+    int readThumbnail(const char* path, unsigned char*& pixels, int& width, int& height, const char* uncompressedFileDetectorPrefix="BLENDER");
+    int readThumbnail(const void* memory, FBTsize sizeInBytes, unsigned char*& pixels, int& width, int& height);
+
+    // Load filter: parse() loads only the chunks whose code is in 'idCodes' (0-terminated, e.g. FBT_ID2('O','B'))
+    // and the blocks their pointers reach. ID lists (id.next/prev) are not followed, and neither are the pointers of
+    // listed non ID chunks (e.g. GLOB). The list must stay valid while parsing: 0 (the default) loads everything.
+    // Streams that can seek (plain files, memory, mmap, seekable zstd) read only the payloads that are needed.
+    void setLoadFilter(const FBTuint32* idCodes) {m_loadFilter = idCodes;}
+
+    // Lazy link: parse() converts only the ID blocks (the ones notifyData() gets, e.g. the fbtBlend lists), the others
+    // are converted the first time they are resolved. Pointers inside the blocks keep their file value: resolve() returns
+    // what they point to (converting it if needed), get<T>() does the same with a cast. Without lazy link they just
+    // return the pointer (already resolved), so the same code works both ways. Resolving is not thread safe.
+    // The ID lists notifyData() links (id.next/prev, e.g. the fbtBlend lists) hold the converted ID blocks: resolve()
+    // returns them as they are, so they are walked the same way (e.g. ob = fp.get<Blender::Object>(ob->id.next)).
+    void setLazyLink(bool lazy) {m_lazyLink = lazy;}
+    void* resolve(const void* ptr);
+    void* resolve(const void* ptrArray, FBTsizeType index);    // element of a pointer array (e.g. Mesh::mat)
+    template <typename T> T* get(const void* ptr) {return static_cast<T*>(resolve(ptr));}
+
 	/// Saving in non native endianness is not implemented yet.
 	int reflect(const char* path, const int mode = PM_UNCOMPRESSED, const fbtEndian& endian = FBT_ENDIAN_NATIVE);
 
@@ -1991,8 +2240,8 @@ public:
 	const char*                 getPath(void)       const {return m_curFile; }
 
 
-	fbtBinTables* getMemoryTable(void)  {return m_memory;}
-	fbtBinTables* getFileTable(void)    {return m_file;}
+	const fbtBinTables* getMemoryTable(void)  const {return m_memory;}
+	const fbtBinTables* getFileTable(void)  const {return m_file;}   // shared with the files of the same DNA (fbtDNACache)
 
 
 	fbtList& getChunks(void) {return m_chunks;}
@@ -2004,6 +2253,8 @@ public:
     // General Programming Staic Helper Methods:
     static FILE* UTF8_fopen(const char* filename, const char* mode);    // Used to allow UTF8 chars on Windows
     static unsigned char* FBT_GetFileContent(const char *filePath,unsigned long* pSizeOut=NULL,const char modes[] = "rb");  // Returns a memory buffer (that user must free using: delete[] mybuffname;) with the content of 'filePath'.
+    static unsigned char* FBT_GetFileContent(FILE* f,unsigned long* pSizeOut=NULL);   // Same as above, for an already opened file (read from its start, 'f' is not closed).
+    static int GetFileCompression(const void* magic,FBTsize len,const char* uncompressedFileDetectorPrefix="BLENDER");  // Returns a FileCompression, from the first bytes of a file
 
 
 protected:
@@ -2030,13 +2281,57 @@ protected:
 	int m_version, m_fileVersion, m_fileHeader;
 	char* m_curFile;
 
-	typedef fbtHashTable<fbtSizeHashKey, MemoryChunk*> ChunkMap;
+	// The old address range of a chunk: [m_begin, m_end) in the file (an empty chunk still owns m_begin)
+	struct PtrRange
+	{
+		FBTsize      m_begin, m_end;
+		FBTsizeType  m_index;       // file order: the first chunk of an old pointer wins
+		MemoryChunk* m_chunk;
+	};
+	typedef fbtArray<PtrRange> PtrIndex;
+
+	// What converting one element of a file struct does: compiled once per struct by compilePlan(),
+	// with the adjacent members merged into single runs.
+	struct LinkOp
+	{
+		enum Code
+		{
+			OP_END,
+			OP_BLOCK,       // first op of fbtStruct::SAME_LAYOUT plans: every element at once (m_len: element size),
+			                // then swapped as m_swap byte values if a struct of one type only needs that
+			OP_COPY,        // m_len bytes
+			OP_SWAP,        // m_len values of m_srcSize bytes, swapped
+			OP_VALUES,      // m_len values, swapped (m_swap: byte count, or SWAP_ZERO) and/or cast
+			OP_PTR,         // m_len old pointers
+			OP_PTR_ARRAY,   // an old pointer to a pointer array (converted by linkPointerArrays())
+		};
+		enum {SWAP_ZERO = 0xFF};    // unknown type: the value is zeroed
+
+		FBTuint8 m_code;
+		FBTuint8 m_swap;
+		FBTint32 m_dst, m_src;          // member offsets
+		FBTint32 m_len;
+		FBTint32 m_srcSize, m_dstSize;  // per value (OP_SWAP, OP_VALUES)
+		fbtCastKernel m_cast;           // OP_VALUES: 0 copies the values
+	};
+
 	fbtList     m_chunks;
-	ChunkMap    m_map;
-	fbtBinTables* m_memory, *m_file;
+	PtrIndex    m_ptrIndex;         // of m_chunks, sorted by m_begin (built by link())
+	PtrIndex    m_idBlocks;         // lazy link: the converted ID blocks (m_begin: m_newBlock), that resolve() passes through
+	FBTsizeType m_lastRange;        // last m_ptrIndex hit
+	fbtArray<LinkOp>      m_linkOps;    // the plans, each one ended by OP_END (built by link())
+	fbtArray<FBTsizeType> m_linkPlans;  // per file struct: the m_linkOps index of its plan (FBT_NPOS: none)
+	const fbtBinTables* m_memory;   // shared by every fbtFile of the same memory DNA (fbtDNACache)
+	fbtBinTables* m_file;
+	const FBTuint32* m_loadFilter;
+	bool m_lazyLink;
+
+	fbtMemoryArena m_arena;         // MemoryChunk records and linked blocks (m_newBlock): released with the file
+	fbtMemoryArena m_payloads;      // chunk payloads (m_block): released when link() is done (the ones used in place go to m_arena)
 
 
     virtual bool skip(const FBTuint32& /*id*/) {return false;}
+	// Pointers into the middle of a block resolve too
 	void* findPtr(const FBTsize& iptr);
 	MemoryChunk* findBlock(const FBTsize& iptr);
 
@@ -2045,11 +2340,59 @@ protected:
 private:
 
 
+	// The decoder is selected by the magic bytes. 'scan' prefers streams that can seek to the ones reading
+	// everything faster (in parallel, or ahead of the parser). They return 0 (after reporting it) on failure.
+	fbtStream* openStream(const char* path, const char* uncompressedFileDetectorPrefix, bool scan);
+	fbtStream* openStream(FILE* fp, const char* path, int compression, bool scan);  // takes ownership of fp
+	static unsigned char* readFileContent(FILE* f, FBTsize& size);  // FBT_GetFileContent() with a pointer sized size
+	int parseStream(fbtStream* stream, const char* path);           // takes ownership of stream
+	int scanChunks(fbtStream* stream, ChunkDirectory& dir, FBTsizeType* dnaIndex);
+	int readChunkDirectory(fbtStream* stream, ChunkDirectory& dir, FBTsizeType* dnaIndex);
+	int readThumbnail(fbtStream* stream, unsigned char*& pixels, int& width, int& height);
 	int parseHeader(fbtStream* stream, bool suppressHeaderWarning=false);
 	int parseStreamImpl(fbtStream* stream, bool suppressHeaderWarning=false);
+	int insertChunk(const Chunk& chunk, void* block, bool inPlace);     // block: in place or from m_payloads
+	int buildPtrIndex(void);
+	void* findPtr(const FBTsize& iptr, FBTsizeType& lastRange);     // lastRange: the m_lastRange of a worker
+	MemoryChunk* findBlock(const FBTsize& iptr, FBTsizeType& lastRange) const;
+	void* findInnerPtr(MemoryChunk* bin, FBTsize offset);          // FBT_RESOLVE_INNER_POINTERS
+
+	static bool ptrRangeLess(const PtrRange& a, const PtrRange& b);
+	static void sortPtrIndex(PtrIndex& index);      // drops the later chunks of an old pointer
+	static FBTsizeType findPtrRange(const PtrIndex& index, FBTsize ptr);
+	int readFileTables(void* dna, FBTsize len);                         // takes ownership of dna
+	void releaseExternalBlocks(void);
+
+	enum ChunkState
+	{
+		CS_REACHED  = (1 << 0),
+		CS_IN_PLACE = (1 << 1),    // the payload points into the stream memory
+	};
+
+	// Load filter (m_loadFilter): parseFiltered() reads the payloads of seekable streams on demand,
+	// pruneChunks() drops what the others have already read.
+	int parseFiltered(fbtStream* stream);
+	int pruneChunks(void);
+	int markReachable(fbtStream* stream, const ChunkDirectory& dir, fbtArray<void*>& blocks, fbtArray<FBTuint8>& state);
 
-	int compileOffsets(void);
+	int compileOffsets(const fbtBinTables* memory, fbtBinTables* file);
 	int link(void);
+
+	// link() converts the pointer arrays (the only blocks other blocks change) first, then
+	// the blocks on their own: in parallel with FBT_USE_THREADS.
+	int newBlock(MemoryChunk* node);        // m_newBlock (in place, zeroed or raw copied), 0 if the chunk is not linked
+	int linkLazily(void);
+	void* linkBlock(MemoryChunk* node);     // lazy link: converted on first use
+	int compilePlan(FBTsizeType structId);  // structId: of m_file
+	void pushLinkOp(const LinkOp& op, FBTsizeType first);   // merges op into the last one of the plan when adjacent
+	int linkPointerArrays(MemoryChunk* node);
+	void convertBlock(MemoryChunk* node, FBTsizeType& lastRange);
+	void releasePayload(MemoryChunk* node);     // of BLK_OWN_PAYLOAD blocks no more in use
+	void keepPayload(MemoryChunk* node);        // moves the BLK_OWN_PAYLOAD block used in place to m_arena
+#if FBT_USE_THREADS == 1
+	struct LinkJob;
+	static void linkBatch(void* userData, FBTsize index, int worker);
+#endif
 };
 
 /** @}*/
@@ -2183,7 +2526,12 @@ public:
 	virtual FBTsize  position(void) const = 0;
 	virtual FBTsize  size(void) const = 0;
 
-    virtual FBTsize seek(FBTint32 /*off*/, FBTint32 /*way*/) {return 0;}
+    // returns the new position (fseek() semantics for 'way', offsets are 64 bit)
+    virtual FBTsize seek(FBTint64 /*off*/, FBTint32 /*way*/) {return 0;}
+
+	// Memory backed streams return the address of the next 'nr' bytes (and skip them),
+	// so that the caller can use them without copying. Returns 0 when 'nr' bytes must be read().
+    virtual void*   readInPlace(FBTsize /*nr*/) const {return 0;}
 
 protected:
     virtual void reserve(FBTsize /*nr*/) {}
@@ -2202,6 +2550,7 @@ public:
 	~fbtFileStream();
 
 	void open(const char* path, fbtStream::StreamMode mode);
+	void open(FILE* fp, fbtStream::StreamMode mode);    // takes ownership of an already opened file (rewound)
 	void close(void);
 
 	bool isOpen(void)   const {return m_handle != 0;}
@@ -2214,7 +2563,7 @@ public:
 
 	FBTsize  position(void) const;
 	FBTsize  size(void)     const;
-	FBTsize seek(FBTint32 off, FBTint32 way);
+	FBTsize seek(FBTint64 off, FBTint32 way);
 
 	void write(fbtMemoryStream &ms) const;
 
@@ -2224,12 +2573,44 @@ protected:
 	fbtFixedString<272> m_file;
 	fbtFileHandle       m_handle;
 	int                 m_mode;
-	int					m_size;
+	FBTsize             m_size;
 };
 
 
 
 
+#if FBT_USE_MMAP_FILE == 1
+// Read-only stream over a private (copy on write) memory mapping of a file
+class fbtMappedFileStream : public fbtStream
+{
+public:
+	fbtMappedFileStream();
+	~fbtMappedFileStream();
+
+	void open(const char* path, fbtStream::StreamMode mode);
+	void close(void);
+
+	bool     isOpen(void)    const   {return m_buffer != 0;}
+	bool     eof(void)       const   {return !m_buffer || m_pos >= m_size;}
+	FBTsize  position(void)  const   {return m_pos;}
+	FBTsize  size(void)      const   {return m_size;}
+
+	FBTsize  read(void* dest, FBTsize nr) const;
+	FBTsize  write(const void* /*src*/, FBTsize /*nr*/) {return -1;}
+
+	FBTsize  seek(FBTint64 off, FBTint32 way);
+
+	void*    readInPlace(FBTsize nr) const;
+
+protected:
+
+	char*            m_buffer;
+	mutable FBTsize  m_pos;
+	FBTsize          m_size;
+};
+#endif
+
+
 #if FBT_USE_GZ_FILE == 1
 class fbtGzStream : public fbtStream
 {
@@ -2238,6 +2619,7 @@ public:
 	~fbtGzStream();
 
 	void open(const char* path, fbtStream::StreamMode mode);
+	void open(FILE* fp, fbtStream::StreamMode mode);    // reads an already opened file from its start (fp is closed)
 	void close(void);
 
 	bool isOpen(void)   const {return m_handle != 0;}
@@ -2259,6 +2641,123 @@ protected:
 	fbtFixedString<272> m_file;
 	fbtFileHandle       m_handle;
 	int                 m_mode;
+	mutable FBTsize     m_pos;      // gztell() is only 32 bit on some platforms
+};
+#endif
+
+
+#if FBT_USE_ZSTD_FILE == 1
+// Read-only stream that decompresses a zstd file incrementally, as it's read
+// (memory usage: the decompression window plus a small input buffer)
+class fbtZstdStream : public fbtStream
+{
+public:
+	fbtZstdStream();
+	~fbtZstdStream();
+
+	void open(const char* path, fbtStream::StreamMode mode);
+	void open(FILE* fp, fbtStream::StreamMode mode);    // takes ownership of an already opened file (rewound)
+	void close(void);
+
+	bool isOpen(void)   const {return m_handle != 0;}
+	bool eof(void)      const {return !m_handle || m_eof;}
+
+	FBTsize  read(void* dest, FBTsize nr) const;
+	FBTsize  write(const void* /*src*/, FBTsize /*nr*/) {return -1;}
+
+	FBTsize  position(void) const {return m_pos;}
+	FBTsize  size(void) const {return 0;}
+
+	// watch it no size / seek
+
+protected:
+
+	fbtFileHandle       m_handle;
+	void*               m_dctx;
+	char*               m_inBuf;
+	FBTsize             m_inCapacity;
+	mutable FBTsize     m_inSize, m_inPos;
+	mutable FBTsize     m_pos;
+	mutable FBTsize     m_lastRet;
+	mutable bool        m_inEof, m_eof;
+};
+
+
+// Read-only stream over a zstd file in the seekable format (independent frames plus a seek table at its end, as
+// Blender writes them): any byte range can be read (and seek() works) decompressing only the frames covering it.
+// open() fails (isOpen() is false) if the file has no valid seek table.
+class fbtZstdSeekableStream : public fbtStream
+{
+public:
+	fbtZstdSeekableStream();
+	~fbtZstdSeekableStream();
+
+	void open(const char* path, fbtStream::StreamMode mode);
+	void open(FILE* fp, fbtStream::StreamMode mode);    // takes ownership of an already opened file (closed on failure)
+	void close(void);
+
+	bool isOpen(void)   const {return m_handle != 0;}
+	bool eof(void)      const {return !m_handle || m_pos >= m_size;}
+
+	FBTsize  read(void* dest, FBTsize nr) const;
+	FBTsize  write(const void* /*src*/, FBTsize /*nr*/) {return -1;}
+
+	FBTsize  position(void) const {return m_pos;}
+	FBTsize  size(void) const {return m_size;}
+	FBTsize  seek(FBTint64 off, FBTint32 way);
+
+	FBTsizeType getNumFrames(void) const {return m_dstOffsets.empty() ? 0 : m_dstOffsets.size() - 1;}
+
+protected:
+
+	bool readSeekTable(void);
+	bool loadFrame(FBTsizeType frame) const;
+
+	fbtFileHandle        m_handle;
+	void*                m_dctx;
+	fbtArray<FBTsize>    m_srcOffsets, m_dstOffsets;   // frame start offsets (plus the end ones), compressed and not
+	FBTsize              m_size;
+	mutable FBTsize      m_pos;
+	mutable char*        m_inBuf;
+	mutable char*        m_frameBuf;
+	mutable FBTsize      m_inCapacity, m_frameCapacity;
+	mutable FBTsizeType  m_frame;                       // the frame in m_frameBuf (FBT_NPOS if none)
+};
+#endif
+
+
+#if FBT_USE_THREADS == 1
+struct fbtReadAheadState;
+
+// Read-only stream reading another one on a worker thread, into a ring of buffers ahead of the consumer:
+// disk (and decompression) latency is hidden behind the parsing of what has been read already.
+class fbtReadAheadStream : public fbtStream
+{
+public:
+	fbtReadAheadStream();
+	~fbtReadAheadStream();
+
+	// takes ownership of 'source' (open for reading): 'readAheadSize' bytes are split into 'numBuffers' buffers
+	void open(fbtStream* source, FBTsize readAheadSize = FBT_READ_AHEAD_SIZE, int numBuffers = 4);
+	void close(void);
+
+	bool isOpen(void)   const {return m_state != 0;}
+	bool eof(void)      const;
+
+	FBTsize  read(void* dest, FBTsize nr) const;
+	FBTsize  write(const void* /*src*/, FBTsize /*nr*/) {return -1;}
+
+	FBTsize  position(void) const {return m_pos;}
+	FBTsize  size(void) const {return m_size;}
+
+	// only backwards, within the last buffer read
+	FBTsize  seek(FBTint64 off, FBTint32 way);
+
+protected:
+
+	fbtReadAheadState*  m_state;
+	FBTsize             m_size;
+	mutable FBTsize     m_pos;
 };
 #endif
 
@@ -2274,7 +2773,9 @@ public:
 	void open(fbtStream::StreamMode mode);
 	void open(const char* path, fbtStream::StreamMode mode);
 	void open(const fbtFileStream& fs, fbtStream::StreamMode mode);
-	void open(const void* buffer, FBTsize size, fbtStream::StreamMode mode,bool compressed=false);
+	// borrow: reference 'buffer' (uncompressed only) instead of copying it. It must outlive the stream (or the
+	// next open()/clear()) and it's never written: write() and reserve() detach the stream into a private copy first.
+	void open(const void* buffer, FBTsize size, fbtStream::StreamMode mode,bool compressed=false,bool borrow=false);
 
 
 	bool     isOpen(void)    const   {return m_buffer != 0;}
@@ -2286,15 +2787,17 @@ public:
 	FBTsize  write(const void* src, FBTsize nr);
 	FBTsize  writef(const char* buf, ...);
 #if FBT_USE_GZ_FILE == 1
-	bool gzipInflate( char* inBuf, int inSize);
+	bool gzipInflate( char* inBuf, FBTsize inSize);
 #endif
 #if FBT_USE_ZSTD_FILE == 1
-	bool zstdInflate( char* inBuf, int inSize);
+	bool zstdInflate( char* inBuf, FBTsize inSize);
 #endif
 	void*            ptr(void)          {return m_buffer;}
 	const void*      ptr(void) const    {return m_buffer;}
 
-	FBTsize seek(FBTint32 off, FBTint32 way);
+	FBTsize seek(FBTint64 off, FBTint32 way);
+
+	void*   readInPlace(FBTsize nr) const;
 
 
 	void reserve(FBTsize nr);
@@ -2306,6 +2809,7 @@ protected:
 	mutable FBTsize  m_pos;
 	FBTsize          m_size, m_capacity;
 	int              m_mode;
+	bool             m_borrowed;
 };
 
 /** @}*/
@@ -2396,7 +2900,8 @@ public:
 		MISSING     = (1 << 0),
 		MISALIGNED  = (1 << 1),
 		SKIP        = (1 << 2),
-		NEED_CAST	= (1 << 3)
+		NEED_CAST	= (1 << 3),
+		SAME_LAYOUT = (1 << 4)     // byte-identical to its m_link (set on the file side by fbtLinkCompiler)
 	};
 
 
@@ -2424,7 +2929,7 @@ public:
 	FBTint32        m_strcId;
 	FBTint32        m_flag;
 	Members         m_members;
-	fbtStruct*      m_link;		//file/memory table struct link
+	fbtStruct*      m_link;		//file table: the memory table struct it converts to (0 in the memory table)
 	Keys            m_keyChain; //parent key hash chain(0: type hash, 1: name hash), size() == m_dp
 
 	FBTsizeType     getUnlinkedMemberCount();
@@ -2459,9 +2964,12 @@ public:
 	~fbtBinTables();
 
 	bool read(bool swap);
-	bool read(const void* ptr, const FBTsize& len, bool swap);
 
-	FBTtype findTypeId(const fbtCharHashKey &cp);
+	// compiled: the output of compile() saved by fbtBlendUpdater next to the DNA (bfBlenderTables),
+	// loaded instead of compiling the tables again (compile() runs when it does not match the DNA)
+	bool read(const void* ptr, const FBTsize& len, bool swap, const FBTuint32* compiled = 0, FBTsize compiledLen = 0);
+
+	FBTtype findTypeId(const fbtCharHashKey &cp) const;
 
 	const char* getStructType(const fbtStruct* strc);
 	const char* getStructName(const fbtStruct* strc);
@@ -2490,9 +2998,11 @@ private:
 
 	TypeFinder m_typeFinder;
 
+	fbtStruct* putStruct(FBTuint32 i);
 	void putMember(FBTtype* cp, fbtStruct* off, FBTtype nr, FBTuint32& cof, FBTuint32 depth, fbtStruct::Keys& keys);
 	void compile(FBTtype i, FBTtype nr, fbtStruct* off, FBTuint32& cof, FBTuint32 depth, fbtStruct::Keys& keys);
 	void compile(void);
+	bool load(const FBTuint32* compiled, FBTsize compiledLen, FBTsize len);
 	bool sikp(const FBTuint32& type);
 
 };
@@ -2519,6 +3029,15 @@ private:
 # include <windows.h>
 # include <io.h>
 #else
+# include <unistd.h>
+# if FBT_USE_MMAP_FILE == 1
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <fcntl.h>
+# endif
+# if FBT_USE_THREADS == 1
+#  include <pthread.h>
+# endif
 #endif
 
 #include <stdio.h>
@@ -2541,8 +3060,124 @@ private:
 # define fbtp_printf vsnprintf
 #endif
 
+// 64 bit file offsets (32 bit POSIX builds also need _FILE_OFFSET_BITS=64 defined before any include)
+#if FBT_COMPILER == FBT_COMPILER_MSVC
+#   define fbtFseek(fp, off, way)   _fseeki64(fp, (__int64)(off), way)
+#   define fbtFtell(fp)             ((FBTint64)_ftelli64(fp))
+#elif FBT_PLATFORM == FBT_PLATFORM_WIN32
+#   define fbtFseek(fp, off, way)   fseeko64(fp, (off64_t)(off), way)
+#   define fbtFtell(fp)             ((FBTint64)ftello64(fp))
+#else
+#   define fbtFseek(fp, off, way)   fseeko(fp, (off_t)(off), way)
+#   define fbtFtell(fp)             ((FBTint64)ftello(fp))
+#endif
+
 #endif//_fbtPlatformHeaders_h_
 
+//#include "fbtThreads.h"
+#ifndef _fbtThreads_h_
+#define _fbtThreads_h_
+
+// Guards the few process-wide tables (it needs no thread library). A zeroed one is unlocked,
+// so a static one needs no constructor.
+class fbtSpinLock
+{
+public:
+	void lock(void);
+	void unlock(void);
+
+	volatile long m_locked;
+};
+
+#if FBT_USE_THREADS == 1
+
+class fbtMutex
+{
+public:
+	fbtMutex();
+	~fbtMutex();
+
+	void lock(void);
+	void unlock(void);
+
+private:
+	fbtMutex(const fbtMutex&);
+	fbtMutex& operator=(const fbtMutex&);
+
+#if FBT_PLATFORM == FBT_PLATFORM_WIN32
+	CRITICAL_SECTION m_cs;
+#else
+	pthread_mutex_t  m_mutex;
+#endif
+};
+
+
+class fbtSemaphore
+{
+public:
+	fbtSemaphore(int count = 0);
+	~fbtSemaphore();
+
+	void wait(void);    // blocks until the count is positive, then decrements it
+	void post(void);
+
+private:
+	fbtSemaphore(const fbtSemaphore&);
+	fbtSemaphore& operator=(const fbtSemaphore&);
+
+#if FBT_PLATFORM == FBT_PLATFORM_WIN32
+	HANDLE           m_handle;
+#else
+	pthread_mutex_t  m_mutex;
+	pthread_cond_t   m_cond;
+	int              m_count;
+#endif
+};
+
+
+class fbtThread
+{
+public:
+	typedef void (*Func)(void* arg);
+
+	fbtThread();
+	~fbtThread();   // joins
+
+	bool start(Func func, void* arg);
+	void join(void);
+
+	bool isRunning(void) const {return m_running;}
+
+private:
+	fbtThread(const fbtThread&);
+	fbtThread& operator=(const fbtThread&);
+
+	Func            m_func;
+	void*           m_arg;
+	bool            m_running;
+#if FBT_PLATFORM == FBT_PLATFORM_WIN32
+	HANDLE          m_handle;
+	static DWORD WINAPI entry(LPVOID self);
+#else
+	pthread_t       m_handle;
+	static void*    entry(void* self);
+#endif
+};
+
+
+// Calls func(userData, index, worker) for every index in [0, count), handing indices out one at a time
+// to 'numThreads' workers (the calling thread is worker 0). 'worker' is in [0, numThreads): use it to
+// index per-thread state. Returns when all the calls have returned.
+typedef void (*fbtParallelForFunc)(void* userData, FBTsize index, int worker);
+void fbtParallelFor(FBTsize count, int numThreads, fbtParallelForFunc func, void* userData);
+
+// FBT_MAX_THREADS, or the number of cores if it's 0
+int  fbtGetNumThreads(void);
+
+#endif
+
+#endif//_fbtThreads_h_
+
 // Common Identifiers
 const FBTuint32 ENDB = FBT_ID('E', 'N', 'D', 'B');
 const FBTuint32 DNA1 = FBT_ID('D', 'N', 'A', '1');
@@ -2585,43 +3220,101 @@ struct fbtChunk
 };
 
 
+// Process-wide, read only once built:
+// - the memory tables, one per memory DNA (getFBT()): built by the first fbtFile that needs them, kept for good.
+// - the file tables (compiled, then linked to memory tables) of the DNA1 blocks parsed, shared by the fbtFiles
+//   reading the same block (Blender writes the same one for the same build). FBT_DNA_CACHE_SIZE unused ones
+//   are kept, the least recently used go first.
+class fbtDNACache
+{
+public:
+	struct Key
+	{
+		const fbtBinTables* m_memory;
+		const void*         m_dna;      // the DNA1 block (as in the file): compared on a hash hit
+		FBTuint64           m_hash;     // of m_dna
+		FBTsize             m_len;
+		FBTuint8            m_ptr;
+		bool                m_swap;
+	};
 
+	static FBTuint64 hash(const void* dna, FBTsize len);
 
-fbtFile::fbtFile(const char* uid)
-    :   m_uhid(uid), m_aluhid(0), m_version(-1), m_fileVersion(0), m_fileHeader(0),
-        m_curFile(0), m_memory(0), m_file(0)
-{
-}
+	// the memory tables of 'fbt' (0 if not built yet)
+	static const fbtBinTables* findMemory(const void* fbt, FBTsize len);
 
+	// shares 'memory' (or the tables an other fbtFile built first: 'memory' is then deleted)
+	static const fbtBinTables* insertMemory(const void* fbt, FBTsize len, fbtBinTables* memory);
 
-fbtFile::~fbtFile()
-{
-	if (m_curFile)
-		fbtFree(m_curFile);
-	m_curFile = 0;
+	// the file tables of 'key' (0 if not cached): release() them when done
+	static fbtBinTables* find(const Key& key);
 
-	MemoryChunk* node = (MemoryChunk*)m_chunks.first, *tnd;
-	while (node)
-	{
-		if (node->m_block)
-		{
-			//printf("free  m_block: 0x%x\n", node->m_block);fflush(stdout);
-			fbtFree(node->m_block);
-		}
-		if (node->m_newBlock)
-		{
-			//printf("free m_newBlock: 0x%x\n", node->m_newBlock);fflush(stdout);
-			fbtFree(node->m_newBlock);
-		}
+	// shares 'file' (or the tables of an other fbtFile that got there first: 'file' is then deleted).
+	// Takes ownership of key.m_dna (fbtMalloc()ed: the tables swap theirs).
+	static fbtBinTables* insert(const Key& key, fbtBinTables* file);
 
-		tnd  = node;
-		node = node->m_next;
+	static void release(fbtBinTables* file);
 
-		fbtFree(tnd);
-	}
+	// Every fbtFile is counted: the cache (memory tables included) is freed at exit, once the last one is gone
+	static void addFile(void);
+	static void removeFile(void);
 
-	delete m_file;
-	delete m_memory;
+private:
+	struct Memory
+	{
+		Memory*             m_next;
+		const void*         m_fbt;
+		FBTsize             m_len;
+		const fbtBinTables* m_tables;
+	};
+
+	struct Entry
+	{
+		Entry*        m_next;
+		Key           m_key;
+		fbtBinTables* m_file;
+		int           m_users;
+	};
+
+	struct Teardown
+	{
+		~Teardown();
+	};
+
+	static Entry* trim(void);
+	static void   destroy(Entry* list);
+	static void   clear(void);      // (under s_lock, no fbtFile left)
+
+	static Memory*     s_memory;
+	static Entry*      s_first;     // most recently used first
+	static fbtSpinLock s_lock;
+	static int         s_files;
+	static bool        s_exiting;
+	static Teardown    s_teardown;
+};
+
+
+
+
+fbtFile::fbtFile(const char* uid)
+    :   m_uhid(uid), m_aluhid(0), m_version(-1), m_fileVersion(0), m_fileHeader(0),
+        m_curFile(0), m_lastRange(FBT_NPOS), m_memory(0), m_file(0), m_loadFilter(0), m_lazyLink(false)
+{
+	fbtDNACache::addFile();
+}
+
+
+fbtFile::~fbtFile()
+{
+	if (m_curFile)
+		fbtFree(m_curFile);
+	m_curFile = 0;
+
+	// the chunk records, their payloads and linked blocks go away with the arenas
+	m_chunks.clear();
+
+	fbtDNACache::release(m_file);
+	fbtDNACache::removeFile();
 }
 
 bool fbtFile::FileStartsWith(const char* path,const char* cmp) {
@@ -2631,10 +3324,10 @@ bool fbtFile::FileStartsWith(const char* path,const char* cmp) {
     bool match = false;
     FILE* f = UTF8_fopen(path,"rb");
     if (f) {
-        if (fseek(f, 0, SEEK_END))  {fclose(f);return match;}
-        const long f_size = ftell(f);
-        if (f_size<=0 || (size_t)f_size < numCharsToMatch)    {fclose(f);return match;}
-        if (fseek(f, 0, SEEK_SET))  {fclose(f);return match;}
+        if (fbtFseek(f, 0, SEEK_END))  {fclose(f);return match;}
+        const FBTint64 f_size = fbtFtell(f);
+        if (f_size<=0 || (FBTuint64)f_size < numCharsToMatch)    {fclose(f);return match;}
+        if (fbtFseek(f, 0, SEEK_SET))  {fclose(f);return match;}
         char buff[256]="";
         if (fread(buff,numCharsToMatch,1,f) && strncmp(buff,cmp,numCharsToMatch)==0) match = true;
         fclose(f);
@@ -2673,69 +3366,206 @@ unsigned char* fbtFile::FBT_GetFileContent(const char *filePath,unsigned long* p
     if (!filePath) return ptr;
     FILE* f;
     if ((f = fbtFile::UTF8_fopen(filePath, modes)) == NULL) return ptr;
-    if (fseek(f, 0, SEEK_END))  {fclose(f);return ptr;}
-    const long f_size_signed = ftell(f);
-    if (f_size_signed == -1)    {fclose(f);return ptr;}
-    size_t f_size = (size_t)f_size_signed;
-    if (fseek(f, 0, SEEK_SET))  {fclose(f);return ptr;}
+    ptr = FBT_GetFileContent(f,pSizeOut);
+    fclose(f);
+    return ptr;
+}
+
+unsigned char* fbtFile::FBT_GetFileContent(FILE* f,unsigned long* pSizeOut)   {
+    if (pSizeOut) *pSizeOut=0;
+    FBTsize f_size = 0;
+    unsigned char* ptr = readFileContent(f,f_size);
+    if (ptr && (FBTsize)(unsigned long)f_size != f_size)  {delete[] (ptr);ptr=NULL;}  // too big for unsigned long (Win64)
+    else if (ptr && pSizeOut) *pSizeOut=(unsigned long)f_size;
+    return ptr;
+}
+
+unsigned char* fbtFile::readFileContent(FILE* f,FBTsize& size)   {
+    unsigned char* ptr = NULL;
+    size = 0;
+    if (!f) return ptr;
+    if (fbtFseek(f, 0, SEEK_END))  return ptr;
+    const FBTint64 f_size_signed = fbtFtell(f);
+    if (f_size_signed == -1)    return ptr;
+    FBTsize f_size = (FBTsize)f_size_signed;
+    if ((FBTint64)f_size != f_size_signed) return ptr;  // too big for this platform
+    if (fbtFseek(f, 0, SEEK_SET))  return ptr;
     ptr = new unsigned char[f_size];
     if (!ptr) return ptr;
     const size_t f_size_read = f_size>0 ? fread((unsigned char*)ptr, 1, f_size, f) : 0;
-    fclose(f);
     if (f_size_read == 0 || f_size_read!=f_size)    {delete[] (ptr);ptr=NULL;}
-    else if (pSizeOut) *pSizeOut=f_size;
+    else size=f_size;
     return ptr;
 }
 
+int fbtFile::GetFileCompression(const void* magic, FBTsize len, const char* uncompressedFileDetectorPrefix)    {
+    const unsigned char* cp = (const unsigned char*) magic;
+    if (!cp) return FC_UNKNOWN;
+    if (uncompressedFileDetectorPrefix) {
+        const size_t numCharsToMatch = strlen(uncompressedFileDetectorPrefix);
+        if (numCharsToMatch>0 && len>=numCharsToMatch && strncmp((const char*)cp,uncompressedFileDetectorPrefix,numCharsToMatch)==0) return FC_NONE;
+    }
+    if (len>=2 && cp[0]==0x1F && cp[1]==0x8B) return FC_GZIP;
+    if (len>=4 && cp[0]==0x28 && cp[1]==0xB5 && cp[2]==0x2F && cp[3]==0xFD) return FC_ZSTD;
+    if (len>=4 && (cp[0]&0xF0)==0x50 && cp[1]==0x2A && cp[2]==0x4D && cp[3]==0x18) return FC_ZSTD;    // skippable frame
+    return FC_UNKNOWN;
+}
+
 int fbtFile::parse(const char* path,const char* uncompressedFileDetectorPrefix)    {
-    return parse(path,FileStartsWith(path,uncompressedFileDetectorPrefix) ? PM_UNCOMPRESSED : PM_COMPRESSED);
+    // the load filter reads only the payloads it needs: it prefers streams that can seek
+    fbtStream* stream = openStream(path,uncompressedFileDetectorPrefix,m_loadFilter!=0);
+    if (!stream) return FS_FAILED;
+    return parseStream(stream,path);
 }
 
 int fbtFile::parse(const char* path, int mode)
 {
-	fbtStream* stream = 0;
+	// the magic bytes are more reliable than the caller
+	if (mode == PM_UNCOMPRESSED || mode == PM_COMPRESSED)
+		return parse(path, m_uhid);
 
-#   if ((FBT_USE_ZSTD_FILE==1) && (BLENDER_VERSION>=300))
-    if (mode==PM_COMPRESSED)    {
-        unsigned long memorySize = 0;
-        unsigned char* memory = fbtFile::FBT_GetFileContent(path,&memorySize,"rb");
-        int rv = FS_FAILED;
-        if (memory) {
-            rv = parse((const void*) memory, memorySize, mode, /*bool suppressHeaderWarning*/false); // rv == -4 is FS_INV_READ
-            delete[] (memory);memory=NULL;memorySize=0;
-        }
-        if (rv==FS_OK) return rv;
-        else {
-            fbtPrintf("Warning: fbtFile::parse(\"%s\" has failed with error code %d, when using the zstd decoder.",path,rv);
-#           if FBT_USE_GZ_FILE == 1
-            fbtPrintf("Trying with the gzip decoder now.");
-#           endif
-        }
-    }
-#   endif //((FBT_USE_ZSTD_FILE==1) && (BLENDER_VERSION>=300))
+#   if FBT_USE_MMAP_FILE != 1
+	if (mode == PM_MMAP)
+		return parse(path, m_uhid);
+#   endif
 
-	if (mode == PM_UNCOMPRESSED || mode == PM_COMPRESSED)
+	fbtStream* stream = 0;
+
+#   if FBT_USE_MMAP_FILE == 1
+	if (mode == PM_MMAP)
 	{
-#   if FBT_USE_GZ_FILE == 1
-		if (mode == PM_COMPRESSED)  {
-            stream = new fbtGzStream();
-	    }
-		else
-#   endif  // FBT_USE_GZ_FILE == 1
+		stream = new fbtMappedFileStream();
+		stream->open(path, fbtStream::SM_READ);
+
+		if (!stream->isOpen())
 		{
+			// (e.g. empty files): let the plain file stream report it
+			delete stream;
 			stream = new fbtFileStream();
+			stream->open(path, fbtStream::SM_READ);
 		}
-		stream->open(path, fbtStream::SM_READ);
 	}
 	else
+#   endif
 	{
 		stream = new fbtMemoryStream();
 		stream->open(path, fbtStream::SM_READ);
 	}
 
+	return parseStream(stream, path);
+}
+
+
+fbtStream* fbtFile::openStream(const char* path, const char* uncompressedFileDetectorPrefix, bool scan)
+{
+	// The file is opened only once: its magic bytes select the decoder, that gets the same file handle
+	FILE* fp = UTF8_fopen(path,"rb");
+	if (!fp)
+	{
+		fbtPrintf("File '%s' loading failed\n", path);
+		return 0;
+	}
+	unsigned char magic[256];
+	size_t magicLen = uncompressedFileDetectorPrefix ? strlen(uncompressedFileDetectorPrefix) : 0;
+	magicLen = fread(magic,1,fbtClamp<size_t>(magicLen,4,sizeof(magic)),fp);
+	int compression = GetFileCompression(magic,magicLen,uncompressedFileDetectorPrefix);
+	if (compression==FC_UNKNOWN) compression = FC_NONE;    // e.g. stripped files: parseHeader() will tell
+	return openStream(fp,path,compression,scan);
+}
+
+
+fbtStream* fbtFile::openStream(FILE* fp, const char* path, int compression, bool scan)
+{
+	fbtStream* stream = 0;
+	(void)scan;
+	(void)path;     // (reported when a decoder is missing)
+
+	switch (compression)
+	{
+	case FC_GZIP:
+		{
+#   if FBT_USE_GZ_FILE == 1
+			fbtGzStream* gs = new fbtGzStream();
+			gs->open(fp, fbtStream::SM_READ);
+			stream = gs;
+#   else
+			fbtPrintf("File '%s' is gzip compressed (FBT_USE_GZ_FILE is needed)\n", path);
+			fclose(fp);
+			return 0;
+#   endif
+		}
+		break;
+	case FC_ZSTD:
+		{
+#   if FBT_USE_ZSTD_FILE == 1
+#       if FBT_USE_THREADS == 1
+			if (!scan)
+			{
+				// the whole file is needed to decompress its frames in parallel
+				FBTsize size = 0;
+				unsigned char* buffer = readFileContent(fp, size);
+				fclose(fp);
+				fbtMemoryStream* ms = new fbtMemoryStream();
+				if (buffer)
+				{
+					ms->open(buffer, size, fbtStream::SM_READ, true);
+					delete [] buffer;
+				}
+				stream = ms;
+				break;
+			}
+#       endif
+			// files with a seek table (Blender writes it) can also seek(), the others are decompressed as a stream
+			fbtZstdSeekableStream* ss = new fbtZstdSeekableStream();
+			ss->open(fp, fbtStream::SM_READ);
+			if (ss->isOpen())
+				stream = ss;
+			else
+			{
+				delete ss;
+				fbtZstdStream* zs = new fbtZstdStream();
+				zs->open(fp, fbtStream::SM_READ);
+				stream = zs;
+			}
+#   else
+			fbtPrintf("File '%s' is zstd compressed (FBT_USE_ZSTD_FILE is needed)\n", path);
+			fclose(fp);
+			return 0;
+#   endif
+		}
+		break;
+	default:
+		{
+			fbtFileStream* fs = new fbtFileStream();
+			fs->open(fp, fbtStream::SM_READ);
+			stream = fs;
+		}
+		break;
+	}
+
+#   if FBT_USE_THREADS == 1 && FBT_READ_AHEAD_SIZE > 0
+	// zstd files are already in memory at this point
+	if (!scan && compression != FC_ZSTD && stream->isOpen())
+	{
+		fbtReadAheadStream* ras = new fbtReadAheadStream();
+		ras->open(stream);
+		if (ras->isOpen())
+			stream = ras;
+		else
+			delete ras;
+	}
+#   endif
+
+	return stream;
+}
+
+
+int fbtFile::parseStream(fbtStream* stream, const char* path)
+{
 	if (!stream->isOpen())
 	{
 		fbtPrintf("File '%s' loading failed\n", path);
+		delete stream;
 		return FS_FAILED;
 	}
 
@@ -2753,6 +3583,7 @@ int fbtFile::parse(const char* path, int mode)
 	}
 
     int result = parseStreamImpl(stream);
+	releaseExternalBlocks();
 	delete stream;
 	return result;
 }
@@ -2762,144 +3593,102 @@ int fbtFile::parse(const char* path, int mode)
 int fbtFile::parse(const void* memory, FBTsize sizeInBytes, int mode, bool suppressHeaderWarning)
 {
 	fbtMemoryStream ms;
-	ms.open( memory, sizeInBytes, fbtStream::SM_READ, mode==PM_COMPRESSED );
+	ms.open( memory, sizeInBytes, fbtStream::SM_READ, mode==PM_COMPRESSED, mode!=PM_COMPRESSED );
 
 	if (!ms.isOpen())
 	{
-		fbtPrintf("Memory %p(%i) loading failed\n", memory, sizeInBytes);
+		fbtPrintf("Memory %p(%llu) loading failed\n", memory, (unsigned long long)sizeInBytes);
 		return FS_FAILED;
 	}
 
-	return parseStreamImpl(&ms,suppressHeaderWarning);
+	int result = parseStreamImpl(&ms,suppressHeaderWarning);
+	releaseExternalBlocks();
+	return result;
 }
 
 
 
-int fbtFile::parseHeader(fbtStream* stream, bool suppressHeaderWarning)
+int fbtFile::scanChunks(const char* path, ChunkDirectory& dir, FBTsizeType* dnaIndex, const char* uncompressedFileDetectorPrefix)
 {
-    m_header.resize(FBT_BLEND_HEADER_SIZE);
-    stream->read(m_header.ptr(), FBT_BLEND_HEADER_SIZE);
-
-#   if BLENDER_VERSION<500
-    /**
-     * Low level version 0: the m_header is 12 bytes long.
-     * 0-6:  'BLENDER'
-     * 7:    '-' for 8-byte pointers (#SmallBHead8) or '_' for 4-byte pointers (#BHead4)
-     * 8:    'v' for little endian or 'V' for big endian
-     * 9-11: 3 ASCII digits encoding #BLENDER_FILE_VERSION (e.g. '305' for Blender 3.5)
-     */
+	dir.clear();
+	if (dnaIndex)
+		*dnaIndex = FBT_NPOS;
 
-    if (!fbtCharNEq(m_header.c_str(), m_uhid, 6) && !fbtCharNEq(m_header.c_str(), m_aluhid, 7))
+	fbtStream* stream = openStream(path, uncompressedFileDetectorPrefix, true);
+	if (!stream)
+		return FS_FAILED;
+	if (!stream->isOpen())
 	{
-		if (!suppressHeaderWarning)
-			fbtPrintf("Unknown header ID '%s'\n", m_header.c_str());
-		return FS_INV_HEADER_STR;
+		fbtPrintf("File '%s' loading failed\n", path);
+		delete stream;
+		return FS_FAILED;
 	}
 
-	char* headerMagic = (m_header.ptr() + 7);
+	int result = scanChunks(stream, dir, dnaIndex);
+	delete stream;
+	return result;
+}
 
-	m_fileHeader = 0;
-	m_fileVersion = 0;
 
-	if (*(headerMagic++) == FM_64_BIT)
-	{
-		m_fileHeader |= FH_CHUNK_64;
-		if (FBT_VOID4)
-			m_fileHeader |= FH_VAR_BITS;
-	}
-	else if (FBT_VOID8)
-		m_fileHeader |= FH_VAR_BITS;
+int fbtFile::scanChunks(const void* memory, FBTsize sizeInBytes, ChunkDirectory& dir, FBTsizeType* dnaIndex)
+{
+	dir.clear();
+	if (dnaIndex)
+		*dnaIndex = FBT_NPOS;
 
+	const int compression = GetFileCompression(memory, sizeInBytes, m_uhid);
+	const bool compressed = compression == FC_GZIP || compression == FC_ZSTD;
 
-	if (*(headerMagic++) == FM_BIG_ENDIAN)
+	fbtMemoryStream ms;
+	ms.open(memory, sizeInBytes, fbtStream::SM_READ, compressed, !compressed);
+
+	if (!ms.isOpen())
 	{
-		if (FBT_ENDIAN_IS_LITTLE)
-			m_fileHeader |= FH_ENDIAN_SWAP;
+		fbtPrintf("Memory %p(%llu) loading failed\n", memory, (unsigned long long)sizeInBytes);
+		return FS_FAILED;
 	}
-	else if (FBT_ENDIAN_IS_BIG)
-		m_fileHeader |= FH_ENDIAN_SWAP;
-
-
-	m_fileVersion = atoi(headerMagic);
-#else
-    /**
-     * Lower level version 1: the m_header is 17 bytes long.
-     * 0-6:   'BLENDER'
-     * 7-8:   size of the header in bytes encoded as ASCII digits (always '17' currently)
-     * 9:     always '-'
-     * 10-11: File version format as ASCII digits (always '01' currently)
-     * 12:    always 'v'
-     * 13-16: 4 ASCII digits encoding #BLENDER_FILE_VERSION (e.g. '0405' for Blender 4.5)
-     *
-     * With this header, #LargeBHead8 is always used.
-     */
-
-    if (!fbtCharNEq(m_header.c_str(), m_uhid, 6) && !fbtCharNEq(m_header.c_str(), m_aluhid, 7))
-    {
-        if (!suppressHeaderWarning)
-            fbtPrintf("Unknown header ID '%s'\n", m_header.c_str());
-        return FS_INV_HEADER_STR;
-    }
-
-    // now we must convert:
-    char* headerMagic = m_header.ptr();
-    if (headerMagic[9] != '-' || headerMagic[10] != '0' || headerMagic[11] != '1' || headerMagic[12] != 'v')
-    {
-        if (!suppressHeaderWarning)
-            fbtPrintf("Unknown header format version '%c%c%c%c'\n", headerMagic[9], headerMagic[10], headerMagic[11], headerMagic[12]);
-        return FS_INV_HEADER_STR;
-    }
+	return scanChunks(&ms, dir, dnaIndex);
+}
 
-    m_fileHeader = FH_CHUNK_64 | (FBT_ENDIAN_IS_BIG?FH_ENDIAN_SWAP:0); // always LargeBHead8 with this header format
-    m_fileVersion = 0;
 
-    m_fileVersion = atoi(&headerMagic[13]);
-#endif
+// Moves 'len' bytes forward: streams that can't seek read (and drop) them
+static bool fbtStreamSkip(fbtStream* stream, FBTsize len)
+{
+	FBTsize pos = stream->position();
+	const FBTsize target = pos + len;
+	if (len == 0 || stream->seek((FBTint64)len, SEEK_CUR) == target)
+		return true;
 
-	return FS_OK;
+	char scratch[16384];
+	pos = stream->position();
+	while (pos < target)
+	{
+		const FBTsize nr = fbtMin<FBTsize>(target - pos, sizeof(scratch));
+		if (stream->read(scratch, nr) != nr)
+			return false;
+		pos += nr;
+	}
+	return true;
 }
 
 
-int fbtFile::parseStreamImpl(fbtStream* stream, bool suppressHeaderWarning)
+int fbtFile::scanChunks(fbtStream* stream, ChunkDirectory& dir, FBTsizeType* dnaIndex)
 {
-    int status;
-
-    status = parseHeader(stream,suppressHeaderWarning);
+	int status = parseHeader(stream);
 	if (status != FS_OK)
 	{
 		fbtPrintf("Failed to extract header!\n");
 		return status;
 	}
-
-	if (!m_memory)
-	{
-		m_memory = new fbtBinTables();
-
-		status = initializeTables(m_memory);
-		if (status != FS_OK)
-		{
-			fbtPrintf("Failed to initialize builtin tables\n");
-			return status;
-		}
-	}
-
-
-	if (m_file)
-	{
-		delete m_file;
-		m_file = 0;
-	}
-
-
-	// preallocate table
-	m_map.reserve(fbtDefaultAlloc);
+	return readChunkDirectory(stream, dir, dnaIndex);
+}
 
 
+int fbtFile::readChunkDirectory(fbtStream* stream, ChunkDirectory& dir, FBTsizeType* dnaIndex)
+{
+	int status;
 	Chunk chunk;
 
-
-	// Scan chunks
-
 	do
 	{
 		if ((status = fbtChunk::read(&chunk, stream, m_fileHeader)) <= 0)
@@ -2908,1080 +3697,3634 @@ int fbtFile::parseStreamImpl(fbtStream* stream, bool suppressHeaderWarning)
 			return FS_INV_READ;
 		}
 
-
-		if (chunk.m_code == SDNA)
-		{
-			chunk.m_code = DNA1;
-			stream->seek(-status, SEEK_CUR);
-			chunk.m_len = stream->size() - stream->position();
-		}
-
 		// exit on end byte
 		if (chunk.m_code == ENDB)
 			break;
 
+		ChunkInfo info;
+		info.m_offset = stream->position();
+		info.m_len    = chunk.m_len;
+		info.m_old    = chunk.m_old;
+		info.m_nr     = chunk.m_nr;
+		info.m_code   = chunk.m_code;
+		info.m_typeid = chunk.m_typeid;
 
-		void* curPtr = fbtMalloc(chunk.m_len);
-		//printf("alloc curPtr: 0x%x\n", curPtr);fflush(stdout);
-		if (!curPtr)
+		if (chunk.m_code == SDNA)
 		{
-			FBT_MALLOC_FAILED;
-			return FS_BAD_ALLOC;
+			// DNA1 without its chunk header: it's the rest of the file
+			info.m_code   = DNA1;
+			info.m_offset -= status;
+			info.m_len    = stream->size() - info.m_offset;
 		}
 
-		if (stream->read(curPtr, chunk.m_len) <= 0)
+		if (info.m_code == DNA1 && dnaIndex)
+			*dnaIndex = dir.size();
+		dir.push_back(info);
+
+		if (chunk.m_code == SDNA)
+			break;
+
+		if (!fbtStreamSkip(stream, (FBTsize)info.m_len))
 		{
 			FBT_INVALID_READ;
 			return FS_INV_READ;
 		}
+	}
+	while (!stream->eof());
 
-		if (chunk.m_code == DNA1)
-		{
-			m_file = new fbtBinTables(curPtr, chunk.m_len);
-			m_file->m_ptr = m_fileHeader & FH_CHUNK_64 ? 8 : 4;
+	return FS_OK;
+}
 
 
-			if (!m_file->read((m_fileHeader & FH_ENDIAN_SWAP) != 0))
-			{
-				fbtPrintf("Failed to initialize tables\n");
-				return FS_INV_READ;
-			}
+int fbtFile::readThumbnail(const char* path, unsigned char*& pixels, int& width, int& height, const char* uncompressedFileDetectorPrefix)
+{
+	pixels = 0;
+	width = height = 0;
 
-			compileOffsets();
+	fbtStream* stream = openStream(path, uncompressedFileDetectorPrefix, true);
+	if (!stream)
+		return FS_FAILED;
+	if (!stream->isOpen())
+	{
+		fbtPrintf("File '%s' loading failed\n", path);
+		delete stream;
+		return FS_FAILED;
+	}
 
-			if ((status = link()) != FS_OK)
-			{
-				FBT_LINK_FAILED;
-				return FS_LINK_FAILED;
-			}
-			break;
-		}
-		else
-		{
-#if FBT_ASSERT_INSERT
-			FBTsizeType pos;
-			if ((pos = m_map.find(chunk.m_old)) != FBT_NPOS)
-			{
-				fbtFree(curPtr);
-				curPtr = 0;
-				int result = fbtMemcmp(&m_map.at(pos)->m_chunk, &chunk, fbtChunk::BlockSize);
-				if (result != 0)
-				{
-					FBT_INVALID_READ;
-					return FS_INV_READ;
-				}
-			}
-#else
-			if (m_map.find(chunk.m_old) != FBT_NPOS)
-			{
-				//printf("free  curPtr: 0x%x\n", curPtr);
-				fbtFree(curPtr);
-				curPtr = 0;
-			}
-#endif
-			else
-			{
-				MemoryChunk* bin = static_cast<MemoryChunk*>(fbtMalloc(sizeof(MemoryChunk)));
-				if (!bin)
-				{
-					FBT_MALLOC_FAILED;
-					return FS_BAD_ALLOC;
-				}
-				fbtMemset(bin, 0, sizeof(MemoryChunk));
-				bin->m_block = curPtr;
-
-				Chunk* cp    = &bin->m_chunk;
-				cp->m_code   = chunk.m_code;
-				cp->m_len    = chunk.m_len;
-				cp->m_nr     = chunk.m_nr;
-				cp->m_typeid = chunk.m_typeid;
-				cp->m_old    = chunk.m_old;
-				m_chunks.push_back(bin);
-
-				if (m_map.insert(bin->m_chunk.m_old, bin) == false)
-				{
-					FBT_INVALID_INS;
-					return FS_INV_INSERT;
-				}
-			}
-		}
-	}
-	while (!stream->eof());
-	return status;
+	int result = readThumbnail(stream, pixels, width, height);
+	delete stream;
+	return result;
 }
 
 
-class fbtPrimType
-{
-public:
-
-};
-
-class fbtLinkCompiler
+int fbtFile::readThumbnail(const void* memory, FBTsize sizeInBytes, unsigned char*& pixels, int& width, int& height)
 {
-public:
-	fbtBinTables* m_mp;
-	fbtBinTables* m_fp;
-
-	fbtStruct* find(const fbtCharHashKey& kvp);
-	fbtStruct* find(fbtStruct* strc, fbtStruct* member, bool isPointer, bool& needCast);
-	int        link(void);
-};
+	pixels = 0;
+	width = height = 0;
 
+	const int compression = GetFileCompression(memory, sizeInBytes, m_uhid);
+	const bool compressed = compression == FC_GZIP || compression == FC_ZSTD;
 
+	fbtMemoryStream ms;
+	ms.open(memory, sizeInBytes, fbtStream::SM_READ, compressed, !compressed);
 
-fbtStruct* fbtLinkCompiler::find(const fbtCharHashKey& kvp)
-{
-	FBTtype i;
-	if ( (i = m_fp->findTypeId(kvp)) != ((FBTtype)-1))
-		return m_fp->m_offs.at(i);
-	return 0;
+	if (!ms.isOpen())
+	{
+		fbtPrintf("Memory %p(%llu) loading failed\n", memory, (unsigned long long)sizeInBytes);
+		return FS_FAILED;
+	}
+	return readThumbnail(&ms, pixels, width, height);
 }
 
 
-fbtStruct* fbtLinkCompiler::find(fbtStruct* strc, fbtStruct* member, bool isPointer, bool& needCast)
+int fbtFile::readThumbnail(fbtStream* stream, unsigned char*& pixels, int& width, int& height)
 {
-	fbtStruct::Members::Pointer md = strc->m_members.ptr();
-	FBTsizeType i, s = strc->m_members.size();
+	int status = parseHeader(stream);
+	if (status != FS_OK)
+	{
+		fbtPrintf("Failed to extract header!\n");
+		return status;
+	}
 
-	FBTuint32 k1 = member->m_val.k32[0];
+	static const FBTuint32 REND = FBT_ID('R', 'E', 'N', 'D');
+	static const FBTuint32 TEST = FBT_ID('T', 'E', 'S', 'T');
 
-	for (i = 0; i < s; i++)
+	Chunk chunk;
+
+	// Blender writes them first: REND (one per scene), then TEST
+	while (!stream->eof())
 	{
-		fbtStruct* strc2 = &md[i];
+		if (fbtChunk::read(&chunk, stream, m_fileHeader) <= 0)
+		{
+			FBT_INVALID_READ;
+			return FS_INV_READ;
+		}
 
-		if (strc2->m_nr == member->m_nr && strc2->m_dp ==  member->m_dp)
+		if (chunk.m_code == REND)
 		{
-			if (strc2->m_val.k32[1] == member->m_val.k32[1]) //base name
-			{				
-				if (!strc2->m_keyChain.equal(member->m_keyChain))
-					continue;
+			if (!fbtStreamSkip(stream, (FBTsize)chunk.m_len))
+			{
+				FBT_INVALID_READ;
+				return FS_INV_READ;
+			}
+			continue;
+		}
 
-				FBTuint32 k2 = strc2->m_val.k32[0];
-				if (k1 == k2)
-					return strc2;
+		if (chunk.m_code != TEST)
+			break;
 
-				if (isPointer)
-					continue;
+		// int width, height; then width*height RGBA texels
+		FBTint32 size[2];
+		if (chunk.m_len < sizeof(size) || stream->read(size, sizeof(size)) != sizeof(size))
+		{
+			FBT_INVALID_READ;
+			return FS_INV_READ;
+		}
+		if (m_fileHeader & FH_ENDIAN_SWAP)
+			fbtSwap32((FBTuint32*)size, 2);
 
-				if (fbtIsIntType(k1) && fbtIsIntType(k2))
-					return strc2;
+		const FBTuint64 texels = (FBTuint64)(size[0] > 0 ? size[0] : 0) * (FBTuint64)(size[1] > 0 ? size[1] : 0);
+		if (texels == 0 || texels * 4 > (FBTuint64)chunk.m_len - sizeof(size))
+		{
+			FBT_INVALID_READ;
+			return FS_INV_READ;
+		}
 
-				if (fbtIsNumberType(k1) && fbtIsNumberType(k2))
-				{
-					needCast = true;
-					return strc2;
-				}
-			}
+		pixels = new unsigned char[(FBTsize)texels * 4];
+		if (stream->read(pixels, (FBTsize)texels * 4) != (FBTsize)texels * 4)
+		{
+			delete [] pixels;
+			pixels = 0;
+			FBT_INVALID_READ;
+			return FS_INV_READ;
 		}
-	}
 
+		width  = size[0];
+		height = size[1];
+		return FS_OK;
+	}
 
-	return 0;
+	return FS_FAILED;
 }
 
-int fbtLinkCompiler::link(void)
+
+int fbtFile::parseHeader(fbtStream* stream, bool suppressHeaderWarning)
 {
-	fbtBinTables::OffsM::Pointer md = m_mp->m_offs.ptr();
-    //fbtBinTables::OffsM::Pointer fd = m_fp->m_offs.ptr();
+    m_header.resize(FBT_BLEND_HEADER_SIZE);
+    stream->read(m_header.ptr(), FBT_BLEND_HEADER_SIZE);
 
-	FBTsizeType i, i2; 
-    //fbtStruct::Members::Pointer p2;
+#   if BLENDER_VERSION<500
+    /**
+     * Low level version 0: the m_header is 12 bytes long.
+     * 0-6:  'BLENDER'
+     * 7:    '-' for 8-byte pointers (#SmallBHead8) or '_' for 4-byte pointers (#BHead4)
+     * 8:    'v' for little endian or 'V' for big endian
+     * 9-11: 3 ASCII digits encoding #BLENDER_FILE_VERSION (e.g. '305' for Blender 3.5)
+     */
+
+    if (!fbtCharNEq(m_header.c_str(), m_uhid, 6) && !fbtCharNEq(m_header.c_str(), m_aluhid, 7))
+	{
+		if (!suppressHeaderWarning)
+			fbtPrintf("Unknown header ID '%s'\n", m_header.c_str());
+		return FS_INV_HEADER_STR;
+	}
 
+	char* headerMagic = (m_header.ptr() + 7);
 
-	for (i = 0; i < m_mp->m_offs.size(); ++i)
+	m_fileHeader = 0;
+	m_fileVersion = 0;
+
+	if (*(headerMagic++) == FM_64_BIT)
 	{
-		fbtStruct* strc = md[i];
-		strc->m_link = find(m_mp->m_type[strc->m_key.k16[0]].m_name);
+		m_fileHeader |= FH_CHUNK_64;
+		if (FBT_VOID4)
+			m_fileHeader |= FH_VAR_BITS;
+	}
+	else if (FBT_VOID8)
+		m_fileHeader |= FH_VAR_BITS;
 
-		if (strc->m_link)
-			strc->m_link->m_link = strc;
 
-        //p2 = strc->m_members.ptr();
+	if (*(headerMagic++) == FM_BIG_ENDIAN)
+	{
+		if (FBT_ENDIAN_IS_LITTLE)
+			m_fileHeader |= FH_ENDIAN_SWAP;
+	}
+	else if (FBT_ENDIAN_IS_BIG)
+		m_fileHeader |= FH_ENDIAN_SWAP;
+
 
-		//fbtPrintf("+%-3d %s\n", i, m_mp->getStructType(strc));
-		for (i2 = 0; i2 < strc->m_members.size(); ++i2)
-		{
-			fbtStruct* member = &strc->m_members[i2];
-			//fbtPrintf("  %3d %s %s\n", i2, m_mp->getStructType(strc2), m_mp->getStructName(strc2));
+	m_fileVersion = atoi(headerMagic);
+#else
+    /**
+     * Lower level version 1: the m_header is 17 bytes long.
+     * 0-6:   'BLENDER'
+     * 7-8:   size of the header in bytes encoded as ASCII digits (always '17' currently)
+     * 9:     always '-'
+     * 10-11: File version format as ASCII digits (always '01' currently)
+     * 12:    always 'v'
+     * 13-16: 4 ASCII digits encoding #BLENDER_FILE_VERSION (e.g. '0405' for Blender 4.5)
+     *
+     * With this header, #LargeBHead8 is always used.
+     */
 
-			FBT_ASSERT(!member->m_link);
-			member->m_flag |= strc->m_link ? 0 : fbtStruct::MISSING;
+    if (!fbtCharNEq(m_header.c_str(), m_uhid, 6) && !fbtCharNEq(m_header.c_str(), m_aluhid, 7))
+    {
+        if (!suppressHeaderWarning)
+            fbtPrintf("Unknown header ID '%s'\n", m_header.c_str());
+        return FS_INV_HEADER_STR;
+    }
 
-			if (!(member->m_flag & fbtStruct::MISSING))
-			{
-				FBT_ASSERT(member->m_key.k16[1] < m_mp->m_nameNr);
-				bool isPointer = m_mp->m_name[member->m_key.k16[1]].m_ptrCount > 0;
-				bool needCast = false;
-				member->m_link = find(strc->m_link, member, isPointer, needCast);
-				if (member->m_link)
-				{
-					member->m_link->m_link = member;
-					if (needCast)
-					{
-						member->m_flag |= fbtStruct::NEED_CAST;
-						member->m_link->m_flag |= fbtStruct::NEED_CAST;
-					}
-				}
-			}
-		}
+    // now we must convert:
+    char* headerMagic = m_header.ptr();
+    if (headerMagic[9] != '-' || headerMagic[10] != '0' || headerMagic[11] != '1' || headerMagic[12] != 'v')
+    {
+        if (!suppressHeaderWarning)
+            fbtPrintf("Unknown header format version '%c%c%c%c'\n", headerMagic[9], headerMagic[10], headerMagic[11], headerMagic[12]);
+        return FS_INV_HEADER_STR;
+    }
 
-	}
+    m_fileHeader = FH_CHUNK_64 | (FBT_ENDIAN_IS_BIG?FH_ENDIAN_SWAP:0); // always LargeBHead8 with this header format
+    m_fileVersion = 0;
 
-	return fbtFile::FS_OK;
+    m_fileVersion = atoi(&headerMagic[13]);
+#endif
+
+	return FS_OK;
 }
 
-void copyValues(FBTbyte* srcPtr, FBTbyte* dstPtr, FBTsize srcElmSize, FBTsize dstElmSize, FBTsize len)
+
+int fbtFile::parseStreamImpl(fbtStream* stream, bool suppressHeaderWarning)
 {
-	FBTsize i;
-	for (i = 0; i < len; i++)
+    int status;
+
+    status = parseHeader(stream,suppressHeaderWarning);
+	if (status != FS_OK)
 	{
-		fbtMemcpy(srcPtr, dstPtr, srcElmSize);
-		srcPtr += srcElmSize;
-		dstElmSize += dstElmSize;
+		fbtPrintf("Failed to extract header!\n");
+		return status;
 	}
-}
 
-void castValue(FBTsize* srcPtr, FBTsize* dstPtr, FBT_PRIM_TYPE srctp, FBT_PRIM_TYPE dsttp, FBTsize len)
-{
-#define GET_V(value, current, type, cast, ptr, match) \
-	if (current == type) \
-	{ \
-		value = (*(cast*)ptr); \
-		ptr += sizeof(cast); \
-		if (++match >= 2) continue; \
-	}
+	// (built once for all the fbtFiles of the same memory DNA)
+	if (!m_memory && (m_memory = fbtDNACache::findMemory(getFBT(), getFBTlength())) == 0)
+	{
+		fbtBinTables* memory = new fbtBinTables();
 
-#define SET_V(value, current, type, cast, ptr, match) \
-	if (current == type) \
-	{ \
-		(*(cast*)ptr) = (cast)value; \
-		ptr += sizeof(cast); \
-		if (++match >= 2) continue; \
+		status = initializeTables(memory);
+		if (status != FS_OK)
+		{
+			fbtPrintf("Failed to initialize builtin tables\n");
+			delete memory;
+			return status;
+		}
+		m_memory = fbtDNACache::insertMemory(getFBT(), getFBTlength(), memory);
 	}
 
-	double value = 0.0;
 
-	FBTsizeType i;
-	for (i = 0; i < len; i++)
+	if (m_file)
 	{
-		int match = 0;
-		GET_V(value, srctp, FBT_PRIM_CHAR,    char,            srcPtr, match);
-		SET_V(value, dsttp, FBT_PRIM_CHAR,    char,            dstPtr, match);
-		GET_V(value, srctp, FBT_PRIM_SHORT,   short,           srcPtr, match);
-		SET_V(value, dsttp, FBT_PRIM_SHORT,   short,           dstPtr, match);
-		GET_V(value, srctp, FBT_PRIM_USHORT,  unsigned short,  srcPtr, match);
-		SET_V(value, dsttp, FBT_PRIM_USHORT,  unsigned short,  dstPtr, match);
-		GET_V(value, srctp, FBT_PRIM_INT,     int,             srcPtr, match);
-		SET_V(value, dsttp, FBT_PRIM_INT,     int,             dstPtr, match);
-		GET_V(value, srctp, FBT_PRIM_LONG,    int,             srcPtr, match);
-		SET_V(value, dsttp, FBT_PRIM_LONG,    int,             dstPtr, match);
-		GET_V(value, srctp, FBT_PRIM_FLOAT,   float,           srcPtr, match);
-		SET_V(value, dsttp, FBT_PRIM_FLOAT,   float,           dstPtr, match);
-		GET_V(value, srctp, FBT_PRIM_DOUBLE,  double,          srcPtr, match);
-		SET_V(value, dsttp, FBT_PRIM_DOUBLE,  double,          dstPtr, match);
+		fbtDNACache::release(m_file);
+		m_file = 0;
 	}
-#undef GET_V
-#undef SET_V
-}
 
 
-int fbtFile::link(void)
-{
-	fbtBinTables::OffsM::Pointer md = m_memory->m_offs.ptr();
-	fbtBinTables::OffsM::Pointer fd = m_file->m_offs.ptr();
-	FBTsizeType s2, i2, a2, n;
-	fbtStruct::Members::Pointer p2;
-	FBTsize mlen, malen, total, pi;
+	// (streams that can't seek, e.g. gzip, return 0 here)
+	if (m_loadFilter && stream->seek(0, SEEK_CUR) == stream->position())
+		return parseFiltered(stream);
 
-	char* dst, *src;
-	FBTsize* dstPtr, *srcPtr;
 
-	bool endianSwap = (m_fileHeader & FH_ENDIAN_SWAP) != 0;
+	Chunk chunk;
 
-	static const FBThash hk = fbtCharHashKey("Link").hash();
 
+	// Scan chunks
 
-	MemoryChunk* node;
-	for (node = (MemoryChunk*)m_chunks.first; node; node = node->m_next)
+	do
 	{
-		if (node->m_chunk.m_typeid > m_file->m_strcNr || !( fd[node->m_chunk.m_typeid]->m_link))
-			continue;
+		if ((status = fbtChunk::read(&chunk, stream, m_fileHeader)) <= 0)
+		{
+			FBT_INVALID_READ;
+			return FS_INV_READ;
+		}
+
+
+		if (chunk.m_code == SDNA)
+		{
+			chunk.m_code = DNA1;
+			stream->seek(-status, SEEK_CUR);
+			chunk.m_len = stream->size() - stream->position();
+		}
+
+		// exit on end byte
+		if (chunk.m_code == ENDB)
+			break;
 
-		fbtStruct* fs, *ms;
-		fs = fd[node->m_chunk.m_typeid];
-		ms = fs->m_link;
 
-		node->m_newTypeId = ms->m_strcId;
+		void* curPtr = 0;
+		bool inPlace = false;
 
-		if (m_memory->m_type[ms->m_key.k16[0]].m_typeId == hk)
+		// DNA1 is owned (and swapped) by m_file: always copy it
+		if (chunk.m_code != DNA1)
 		{
-			FBTsize totSize = node->m_chunk.m_len;
-			node->m_newBlock = fbtMalloc(totSize);
-			//printf("alloc1 m_newBlock: 0x%x %d\n", node->m_newBlock, totSize);fflush(stdout);
+			curPtr = stream->readInPlace(chunk.m_len);
+			inPlace = curPtr != 0;
+		}
 
-			if (!node->m_newBlock)
+		if (!inPlace)
+		{
+			// (DNA1 is freed by m_file)
+			curPtr = chunk.m_code == DNA1 ? fbtMalloc(chunk.m_len) : m_payloads.alloc(chunk.m_len);
+			//printf("alloc curPtr: 0x%x\n", curPtr);fflush(stdout);
+			if (!curPtr)
 			{
 				FBT_MALLOC_FAILED;
 				return FS_BAD_ALLOC;
 			}
 
-			fbtMemcpy(node->m_newBlock, node->m_block, totSize);
-			continue;
+			if (stream->read(curPtr, chunk.m_len) != (FBTsize)chunk.m_len)
+			{
+				if (chunk.m_code == DNA1)
+					fbtFree(curPtr);
+				FBT_INVALID_READ;
+				return FS_INV_READ;
+			}
 		}
 
+		if (chunk.m_code == DNA1)
+		{
+			if ((status = readFileTables(curPtr, chunk.m_len)) != FS_OK)
+				return status;
 
-		if (skip(m_memory->m_type[ms->m_key.k16[0]].m_typeId))
-			continue;
-
+			if (m_loadFilter && (status = pruneChunks()) != FS_OK)
+				return status;
 
-		FBTsize totSize = (node->m_chunk.m_nr * ms->m_len);
-
-		node->m_chunk.m_len = totSize;
-
-
-		node->m_newBlock = fbtMalloc(totSize);
-		//printf("alloc2 m_newBlock: 0x%x %d\n", node->m_newBlock, totSize);fflush(stdout);
-
-		if (!node->m_newBlock)
-		{
-			FBT_MALLOC_FAILED;
-			return FS_BAD_ALLOC;
+			if ((status = link()) != FS_OK)
+			{
+				FBT_LINK_FAILED;
+				return FS_LINK_FAILED;
+			}
+			break;
 		}
+		else if ((status = insertChunk(chunk, curPtr, inPlace)) != FS_OK)
+			return status;
+	}
+	while (!stream->eof());
+	return status;
+}
 
 
-
-		// always zero this
-		fbtMemset(node->m_newBlock, 0, totSize);
+int fbtFile::insertChunk(const Chunk& chunk, void* block, bool inPlace)
+{
+	// (duplicated old pointers are dropped by buildPtrIndex())
+	MemoryChunk* bin = static_cast<MemoryChunk*>(m_arena.alloc(sizeof(MemoryChunk)));
+	if (!bin)
+	{
+		FBT_MALLOC_FAILED;
+		return FS_BAD_ALLOC;
 	}
+	fbtMemset(bin, 0, sizeof(MemoryChunk));
+	bin->m_block = block;
+	if (inPlace)
+		bin->m_flag |= MemoryChunk::BLK_EXTERNAL;
+	else if (block && m_payloads.isOwnBlock((FBTsize)chunk.m_len))
+		bin->m_flag |= MemoryChunk::BLK_OWN_PAYLOAD;
+
+	Chunk* cp    = &bin->m_chunk;
+	cp->m_code   = chunk.m_code;
+	cp->m_len    = chunk.m_len;
+	cp->m_nr     = chunk.m_nr;
+	cp->m_typeid = chunk.m_typeid;
+	cp->m_old    = chunk.m_old;
+	m_chunks.push_back(bin);
+	return FS_OK;
+}
 
 
+bool fbtFile::ptrRangeLess(const PtrRange& a, const PtrRange& b)
+{
+	return a.m_begin < b.m_begin || (a.m_begin == b.m_begin && a.m_index < b.m_index);
+}
 
-	FBTuint8 mps = m_memory->m_ptr, fps = m_file->m_ptr;
 
-	for (node = (MemoryChunk*)m_chunks.first; node; node = node->m_next)
+void fbtFile::sortPtrIndex(PtrIndex& index)
+{
+	index.sort(ptrRangeLess);
+
+	FBTsizeType i, n = 0;
+	for (i = 0; i < index.size(); ++i)
 	{
-		if (node->m_newTypeId > m_memory->m_strcNr)
+		if (n > 0 && index[n - 1].m_begin == index[i].m_begin)
 			continue;
+		index[n++] = index[i];
+	}
+	index.resize(n);
+}
 
 
+FBTsizeType fbtFile::findPtrRange(const PtrIndex& index, FBTsize ptr)
+{
+	// the last range starting at or before ptr
+	FBTsizeType lo = 0, hi = index.size();
+	while (lo < hi)
+	{
+		const FBTsizeType mid = lo + (hi - lo) / 2;
+		if (index[mid].m_begin <= ptr)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
 
-		fbtStruct* cs = md[node->m_newTypeId];
-		if (m_memory->m_type[cs->m_key.k16[0]].m_typeId == hk)
-			continue;
-
-		if (!cs->m_link || skip(m_memory->m_type[cs->m_key.k16[0]].m_typeId) || !node->m_newBlock)
-		{
-			//printf("free  m_newBlock: 0x%x \n", node->m_newBlock);fflush(stdout);
-
-			fbtFree(node->m_newBlock);
-			node->m_newBlock = 0;
+	if (lo == 0)
+		return FBT_NPOS;
 
-			continue;
-		}
+	const PtrRange& r = index[lo - 1];
+	return (ptr < r.m_end || ptr == r.m_begin) ? lo - 1 : FBT_NPOS;
+}
 
-		s2 = cs->m_members.size();
-		p2 = cs->m_members.ptr();
 
-		for (n = 0; n < node->m_chunk.m_nr; ++n)
-		{
-			dst = static_cast<char*>(node->m_newBlock) + (cs->m_len * n);
-			src = static_cast<char*>(node->m_block) + (cs->m_link->m_len * n);
+int fbtFile::buildPtrIndex(void)
+{
+	m_ptrIndex.clear();
+	m_lastRange = FBT_NPOS;
 
+	MemoryChunk* node;
+	FBTsizeType i = 0;
+	for (node = (MemoryChunk*)m_chunks.first; node; node = node->m_next)
+	{
+		PtrRange r;
+		r.m_begin = node->m_chunk.m_old;
+		r.m_end   = node->m_chunk.m_old + (FBTsize)node->m_chunk.m_len;
+		r.m_index = i++;
+		r.m_chunk = node;
+		m_ptrIndex.push_back(r);
+	}
 
-			for (i2 = 0; i2 < s2; ++i2)
-			{
-				fbtStruct* dstStrc = &p2[i2];
-				fbtStruct* srcStrc = dstStrc->m_link;
+	const FBTsizeType total = m_ptrIndex.size();
+	sortPtrIndex(m_ptrIndex);
+	if (m_ptrIndex.size() == total)
+		return FS_OK;
 
-				// If it's missing we can safely skip this block
-				if (!srcStrc)
-					continue;
 
+	// Keep the first chunk of each old pointer: the others are dropped (their memory stays in the arenas)
+	fbtArray<FBTuint8> keep(total, (FBTuint8)0);
+	for (i = 0; i < m_ptrIndex.size(); ++i)
+		keep[m_ptrIndex[i].m_index] = 1;
 
-				dstPtr = reinterpret_cast<FBTsize*>(dst + dstStrc->m_off);
-				srcPtr = reinterpret_cast<FBTsize*>(src + srcStrc->m_off);
+	int status = FS_OK;
+	node = (MemoryChunk*)m_chunks.first;
+	m_chunks.clear();
+	for (i = 0; node; ++i)
+	{
+		MemoryChunk* next = node->m_next;
+		if (keep[i])
+			m_chunks.push_back(node);
+#if FBT_ASSERT_INSERT
+		else
+		{
+			const FBTsizeType pos = findPtrRange(m_ptrIndex, node->m_chunk.m_old);
+			if (fbtMemcmp(&m_ptrIndex[pos].m_chunk->m_chunk, &node->m_chunk, fbtChunk::BlockSize) != 0)
+			{
+				FBT_INVALID_READ;
+				status = FS_INV_READ;
+			}
+		}
+#endif
+		node = next;
+	}
+	if (m_chunks.last)
+		m_chunks.last->next = 0;
+	return status;
+}
 
 
+fbtDNACache::Memory* fbtDNACache::s_memory = 0;
+fbtDNACache::Entry*  fbtDNACache::s_first  = 0;
+fbtSpinLock          fbtDNACache::s_lock   = {0};
+int                  fbtDNACache::s_files  = 0;
+bool                 fbtDNACache::s_exiting = false;
+fbtDNACache::Teardown fbtDNACache::s_teardown;
 
-				const fbtName& nameD = m_memory->m_name[dstStrc->m_key.k16[1]];
-				const fbtName& nameS = m_file->m_name[srcStrc->m_key.k16[1]];
 
+FBTuint64 fbtDNACache::hash(const void* dna, FBTsize len)
+{
+	// FNV-1a, four bytes at a time
+	const FBTbyte* cp = static_cast<const FBTbyte*>(dna);
+	FBTuint64 h = 0xCBF29CE484222325ULL;
+	FBTsize i = 0;
+	for (; i + 4 <= len; i += 4)
+	{
+		FBTuint32 v;
+		fbtMemcpy(&v, cp + i, 4);
+		h = (h ^ v) * 0x100000001B3ULL;
+	}
+	for (; i < len; ++i)
+		h = (h ^ (FBTubyte)cp[i]) * 0x100000001B3ULL;
+	return h;
+}
 
-				if (nameD.m_ptrCount > 0)
-				{
-					if ((*srcPtr))
-					{
-						if (nameD.m_ptrCount  > 1)
-						{
-							MemoryChunk* bin = findBlock((FBTsize)(*srcPtr));
-							if (bin)
-							{
-								if (bin->m_flag & MemoryChunk::BLK_MODIFIED)
-									(*dstPtr) = (FBTsize)bin->m_newBlock;
-								else
-								{
-									// take pointer size out of the equation
-									total = bin->m_chunk.m_len / fps;
 
+const fbtBinTables* fbtDNACache::findMemory(const void* fbt, FBTsize len)
+{
+	s_lock.lock();
+	Memory* memory;
+	for (memory = s_memory; memory && (memory->m_fbt != fbt || memory->m_len != len); memory = memory->m_next) {}
+	s_lock.unlock();
+	return memory ? memory->m_tables : 0;
+}
 
-									FBTsize* nptr = (FBTsize*)fbtMalloc(total * mps);
-									fbtMemset(nptr, 0, total * mps);
 
-									// always use 32 bit, then offset + 2 for 64 bit (Old pointers are sorted in this mannor)
-									FBTuint32* optr = (FBTuint32*)bin->m_block;
+const fbtBinTables* fbtDNACache::insertMemory(const void* fbt, FBTsize len, fbtBinTables* tables)
+{
+	const fbtBinTables* cached = findMemory(fbt, len);
+	if (cached)
+	{
+		delete tables;
+		return cached;
+	}
 
+	Memory* memory = new Memory;
+	memory->m_fbt    = fbt;
+	memory->m_len    = len;
+	memory->m_tables = tables;
 
-									for (pi = 0; pi < total; pi++, optr += (fps == 4 ? 1 : 2))
-										nptr[pi] = (FBTsize)findPtr((FBTsize) * optr);
+	s_lock.lock();
+	Memory* other;
+	for (other = s_memory; other && (other->m_fbt != fbt || other->m_len != len); other = other->m_next) {}
+	if (!other)
+	{
+		memory->m_next = s_memory;
+		s_memory = memory;
+	}
+	s_lock.unlock();
 
-									(*dstPtr) = (FBTsize)(nptr);
+	if (other)
+	{
+		delete memory;
+		delete tables;
+		return other->m_tables;
+	}
+	return tables;
+}
 
-									bin->m_chunk.m_len = total * mps;
-									bin->m_flag |= MemoryChunk::BLK_MODIFIED;
 
-									fbtFree(bin->m_newBlock);
-									bin->m_newBlock = nptr;
-								}
-							}
-							else
-							{
-								//fbtPrintf("**block not found @ 0x%p)\n", src);
-							}
-						}
-						else
-						{
-							malen = nameD.m_arraySize > nameS.m_arraySize ? nameS.m_arraySize : nameD.m_arraySize;
+fbtBinTables* fbtDNACache::find(const Key& key)
+{
+	s_lock.lock();
 
-							FBTsize* dptr = (FBTsize*)dstPtr;
+	Entry* prev = 0, *entry;
+	for (entry = s_first; entry; prev = entry, entry = entry->m_next)
+	{
+		const Key& k = entry->m_key;
+		if (k.m_hash == key.m_hash && k.m_len == key.m_len && k.m_memory == key.m_memory && k.m_ptr == key.m_ptr &&
+		    k.m_swap == key.m_swap && fbtMemcmp(k.m_dna, key.m_dna, key.m_len) == 0)
+			break;
+	}
 
-							// always use 32 bit, then offset + 2 for 64 bit (Old pointers are sorted in this mannor)
-							FBTuint32* sptr = (FBTuint32*)srcPtr;
+	fbtBinTables* file = 0;
+	if (entry)
+	{
+		if (prev)
+		{
+			prev->m_next = entry->m_next;
+			entry->m_next = s_first;
+			s_first = entry;
+		}
+		++entry->m_users;
+		file = entry->m_file;
+	}
 
+	s_lock.unlock();
+	return file;
+}
 
-							for (a2 = 0; a2 < malen; ++a2, sptr += (fps == 4 ? 1 : 2))
-								dptr[a2] = (FBTsize)findPtr((FBTsize) * sptr);
-						}
-					}
-				}
-				else
-				{
-					FBTsize dstElmSize = dstStrc->m_len / nameD.m_arraySize;
-					FBTsize srcElmSize = srcStrc->m_len / nameS.m_arraySize;
 
-					bool needCast = (dstStrc->m_flag & fbtStruct::NEED_CAST) != 0;
-					bool needSwap = endianSwap && srcElmSize > 1;
+fbtBinTables* fbtDNACache::insert(const Key& key, fbtBinTables* file)
+{
+	fbtBinTables* cached = find(key);
+	if (cached)
+	{
+		fbtFree(const_cast<void*>(key.m_dna));
+		delete file;
+		return cached;
+	}
 
-					if (!needCast && !needSwap && srcStrc->m_val.k32[0] == dstStrc->m_val.k32[0]) //same type
-					{						
-						// Take the minimum length of any array.
-						mlen = fbtMin(srcStrc->m_len, dstStrc->m_len);
+	Entry* entry = new Entry;
+	entry->m_key    = key;
+	entry->m_file   = file;
+	entry->m_users  = 1;
 
-						fbtMemcpy(dstPtr, srcPtr, mlen);
-						continue;
-					}
+	s_lock.lock();
+	entry->m_next = s_first;
+	s_first = entry;
+	Entry* unused = trim();
+	s_lock.unlock();
 
-					FBTbyte* dstBPtr = reinterpret_cast<FBTbyte*>(dstPtr);
-					FBTbyte* srcBPtr = reinterpret_cast<FBTbyte*>(srcPtr);
+	destroy(unused);
+	return file;
+}
 
-					FBT_PRIM_TYPE stp = FBT_PRIM_UNKNOWN, dtp  = FBT_PRIM_UNKNOWN;
 
-					if (needCast || needSwap)
-					{
-						stp = fbtGetPrimType(srcStrc->m_val.k32[0]);
-						dtp = fbtGetPrimType(dstStrc->m_val.k32[0]);
+void fbtDNACache::release(fbtBinTables* file)
+{
+	if (!file)
+		return;
 
-						FBT_ASSERT(fbtIsNumberType(stp) && fbtIsNumberType(dtp) && stp != dtp);
-					}
+	s_lock.lock();
+	Entry* entry;
+	for (entry = s_first; entry && entry->m_file != file; entry = entry->m_next) {}
+	FBT_ASSERT(entry && entry->m_users > 0);
+	if (entry)
+		--entry->m_users;
+	Entry* unused = trim();
+	s_lock.unlock();
 
-					FBTsize alen = fbtMin(nameS.m_arraySize, nameD.m_arraySize);
-					FBTsize elen = fbtMin(srcElmSize, dstElmSize);
+	destroy(unused);
+}
 
-					FBTbyte tmpBuf[8] = {0, };
-					FBTsize i;
-					for (i = 0; i < alen; i++)
-					{
-						FBTbyte* tmp = srcBPtr;
-						if (needSwap)
-						{
-							tmp = tmpBuf;
-							fbtMemcpy(tmpBuf, srcBPtr, srcElmSize);
-
-							if (stp == FBT_PRIM_SHORT || stp == FBT_PRIM_USHORT) 
-								fbtSwap16((FBTuint16*)tmpBuf, 1);
-							else if (stp >= FBT_PRIM_INT && stp <= FBT_PRIM_FLOAT) 
-								fbtSwap32((FBTuint32*)tmpBuf, 1);
-							else if (stp == FBT_PRIM_DOUBLE)
-								fbtSwap64((FBTuint64*)tmpBuf, 1);
-							else
-								fbtMemset(tmpBuf, 0, sizeof(tmpBuf)); //unknown type
-						}
-						
-						if (needCast)
-							castValue((FBTsize*)tmp, (FBTsize*)dstBPtr, stp, dtp, 1);
-						else
-							fbtMemcpy(dstBPtr, tmp, elen);
-
-						dstBPtr += dstElmSize;
-						srcBPtr += srcElmSize;
-					}
-				}
-			}
-		}
 
-		notifyData(node->m_newBlock, node->m_chunk);
+void fbtDNACache::destroy(Entry* list)
+{
+	while (list)
+	{
+		Entry* next = list->m_next;
+		fbtFree(const_cast<void*>(list->m_key.m_dna));
+		delete list->m_file;
+		delete list;
+		list = next;
 	}
+}
 
 
+fbtDNACache::Entry* fbtDNACache::trim(void)
+{
+	// (under s_lock) unlinks the unused entries past the first FBT_DNA_CACHE_SIZE ones
+	Entry* unused = 0;
+	int kept = 0;
 
-	for (node = (MemoryChunk*)m_chunks.first; node; node = node->m_next)
+	Entry** link = &s_first;
+	while (*link)
 	{
-		if (node->m_block)
+		Entry* entry = *link;
+		if (entry->m_users > 0 || kept < FBT_DNA_CACHE_SIZE)
 		{
-			fbtFree(node->m_block);
-			node->m_block = 0;
+			kept += entry->m_users == 0;
+			link = &entry->m_next;
+			continue;
 		}
+		*link = entry->m_next;
+		entry->m_next = unused;
+		unused = entry;
 	}
-
-	return fbtFile::FS_OK;
+	return unused;
 }
 
 
+void fbtDNACache::addFile(void)
+{
+	s_lock.lock();
+	++s_files;
+	s_lock.unlock();
+}
 
 
-void* fbtFile::findPtr(const FBTsize& iptr)
+void fbtDNACache::removeFile(void)
 {
-	FBTsizeType i;
-	if ((i = m_map.find(iptr)) != FBT_NPOS)
-		return m_map.at(i)->m_newBlock;
-	return 0;
+	s_lock.lock();
+	if (--s_files == 0 && s_exiting)
+		clear();
+	s_lock.unlock();
 }
 
 
-fbtFile::MemoryChunk* fbtFile::findBlock(const FBTsize& iptr)
+void fbtDNACache::clear(void)
 {
-	FBTsizeType i;
-	if ((i = m_map.find(iptr)) != FBT_NPOS)
-		return m_map.at(i);
-	return 0;
+	destroy(s_first);
+	s_first = 0;
+	while (s_memory)
+	{
+		Memory* next = s_memory->m_next;
+		delete s_memory->m_tables;
+		delete s_memory;
+		s_memory = next;
+	}
 }
 
 
-
-int fbtFile::compileOffsets(void)
+fbtDNACache::Teardown::~Teardown()
 {
-	fbtLinkCompiler lnk;
-	lnk.m_mp = m_memory;
-	lnk.m_fp = m_file;
-	return lnk.link();
+	// (static fbtFiles of other translation units can outlive this: the last one clears)
+	s_lock.lock();
+	s_exiting = true;
+	if (s_files == 0)
+		clear();
+	s_lock.unlock();
 }
 
-bool fbtFile::_setuid(const char* uid)
+
+int fbtFile::readFileTables(void* dna, FBTsize len)
 {
-	if (!uid || strlen(uid) != 7) return false;
+	fbtDNACache::Key key;
+	key.m_memory = m_memory;
+	key.m_dna    = dna;
+	key.m_hash   = fbtDNACache::hash(dna, len);
+	key.m_len    = len;
+	key.m_ptr    = m_fileHeader & FH_CHUNK_64 ? 8 : 4;
+	key.m_swap   = (m_fileHeader & FH_ENDIAN_SWAP) != 0;
 
-	m_uhid = uid;
-	return true;
-}
+	if ((m_file = fbtDNACache::find(key)) != 0)
+	{
+		fbtFree(dna);
+		return FS_OK;
+	}
 
-int fbtFile::reflect(const char* path, const int mode, const fbtEndian& /*endian*/)
-{
-	fbtStream* fs;
-	
-#if FBT_USE_GZ_FILE == 1
-	if (mode == PM_COMPRESSED)
-		fs = new fbtGzStream();
-	else
-#endif
+
+	// (read() swaps dna)
+	void* original = fbtMalloc(len);
+	if (!original)
 	{
-		fs = new fbtFileStream();
+		FBT_MALLOC_FAILED;
+		fbtFree(dna);
+		return FS_BAD_ALLOC;
 	}
-	
-	fs->open(path, fbtStream::SM_WRITE);
+	fbtMemcpy(original, dna, len);
+	key.m_dna = original;
 
+	fbtBinTables* file = new fbtBinTables(dna, len);
+	file->m_ptr = key.m_ptr;
 
-	FBTuint8 cp = FBT_VOID8 ? FM_64_BIT : FM_32_BIT;
-	FBTuint8 ce = ((FBTuint8)fbtGetEndian()) == FBT_ENDIAN_IS_BIG ? FM_BIG_ENDIAN : FM_LITTLE_ENDIAN;
+	if (!file->read(key.m_swap))
+	{
+		fbtPrintf("Failed to initialize tables\n");
+		fbtFree(original);
+		delete file;
+		return FS_INV_READ;
+	}
 
-//	Commented for now since the rest of the code does not care
-//	if (endian != FBT_ENDIAN_NATIVE)
-//	{
-//		if (endian == FBT_ENDIAN_IS_BIG)
-//			ce = FM_BIG_ENDIAN;
-//		else
-//			ce = FM_LITTLE_ENDIAN;
-//	}
+	compileOffsets(m_memory, file);
+	m_file = fbtDNACache::insert(key, file);
+	return FS_OK;
+}
 
-	// put magic
-	//fs->writef("%s%c%c%i", m_uhid, cp, ce, m_version);
-    char header[FBT_BLEND_HEADER_SIZE] = {};//{0,0,0,0,0,0,0,0,0,0,0,0};
-	char version[33];
-	sprintf(version, "%i",m_version);
-	
-	strncpy(&header[0], m_uhid, 7); // 7 first bytes of header
-#   if BLENDER_VERSION<500
-	header[7] = cp;					// 8th byte = pointer size
-	header[8] = ce;					// 9th byte = endianness
-    strncpy(&header[9], version, 3);// last 3 bytes for 3 version char
-#   else
-    header[7]='1';header[8]='7'; // header size = 17
-    header[9]='-';
-    header[10]='0';header[11]='1'; // file version format = 01
-    header[12]=ce; // endianness
-    strncpy(&header[13], version, 4);// last 4 bytes for 4 version char
-#   endif
-    fs->write(header, FBT_BLEND_HEADER_SIZE);
-	
-	writeData(fs);
 
-	// write DNA1
-	Chunk ch;
-	ch.m_code   = DNA1;
-	ch.m_len    = getFBTlength();
-	ch.m_nr     = 1;
-	ch.m_old    = 0;
-	ch.m_typeid = 0;
-	fs->write(&ch, fbtChunk::BlockSize);
-	fs->write(getFBT(), ch.m_len);
+// Reads the payload of 'info' (in place if the stream allows it, otherwise into 'arena')
+static int fbtReadPayload(fbtStream* stream, fbtMemoryArena& arena, const fbtFile::ChunkInfo& info, void*& block, bool& inPlace)
+{
+	const FBTsize len = (FBTsize)info.m_len;
+	block = 0;
+	inPlace = false;
 
+	if (stream->seek((FBTint64)info.m_offset, SEEK_SET) != (FBTsize)info.m_offset)
+	{
+		FBT_INVALID_READ;
+		return fbtFile::FS_INV_READ;
+	}
 
-	// write ENDB (End Byte | EOF )
-	ch.m_code   = ENDB;
-	ch.m_len    = 0;
-	ch.m_nr     = 0;
-	ch.m_old    = 0;
-	ch.m_typeid = 0;
-	fs->write(&ch, fbtChunk::BlockSize);
-	
-	delete fs;
-	return FS_OK;
+	block = stream->readInPlace(len);
+	inPlace = block != 0;
+	if (inPlace)
+		return fbtFile::FS_OK;
+
+	block = arena.alloc(len);
+	if (!block)
+	{
+		FBT_MALLOC_FAILED;
+		return fbtFile::FS_BAD_ALLOC;
+	}
 
+	if (stream->read(block, len) != len)
+	{
+		block = 0;
+		FBT_INVALID_READ;
+		return fbtFile::FS_INV_READ;
+	}
+	return fbtFile::FS_OK;
 }
 
-void fbtFile::writeStruct(fbtStream* stream, FBTtype index, FBTuint32 code, FBTsize len, void* writeData)
+
+// Old pointers are read whole, unaligned (in place blocks are only FBT_IN_PLACE_ALIGNMENT aligned)
+static FBTsize fbtReadOldPtr(const FBTbyte* p, FBTuint8 fps, bool endianSwap)
 {
-	Chunk ch;
-	ch.m_code   = code;
-	ch.m_len    = len;
-	ch.m_nr     = 1;
-	ch.m_old    = (FBTsize)writeData;
-	ch.m_typeid = index;
+	if (fps == 8)
+	{
+		FBTuint64 v;
+		fbtMemcpy(&v, p, sizeof(v));
+		if (endianSwap)
+			fbtSwap64(&v, 1);
+		return (FBTsize)v;
+	}
 
-	fbtChunk::write(&ch, stream);
+	FBTuint32 v;
+	fbtMemcpy(&v, p, sizeof(v));
+	if (endianSwap)
+		fbtSwap32(&v, 1);
+	return (FBTsize)v;
 }
 
-void fbtFile::writeBuffer(fbtStream* stream, FBTsize len, void* writeData)
+
+int fbtFile::markReachable(fbtStream* stream, const ChunkDirectory& dir, fbtArray<void*>& blocks, fbtArray<FBTuint8>& state)
 {
-	Chunk ch;
-	ch.m_code   = DATA;
-	ch.m_len    = len;
-	ch.m_nr     = 1;
-	ch.m_old    = (FBTsize)writeData;
-	ch.m_typeid = m_memory->findTypeId("Link");
+	fbtBinTables::OffsM::Pointer fd = m_file->m_offs.ptr();
+	const FBTuint8 fps = m_file->m_ptr;
+	const bool endianSwap = (m_fileHeader & FH_ENDIAN_SWAP) != 0;
+	const FBTsizeType nr = dir.size();
+	FBTsizeType i;
 
-	fbtChunk::write(&ch, stream);
+	static const FBThash hk = fbtCharHashKey("Link").hash();
+
+
+	// the same old pointer resolution as link()
+	PtrIndex index;
+	index.reserve(nr);
+
+	fbtArray<FBTsizeType> pending;
+	fbtArray<FBTsize> ptrs;
+
+	for (i = 0; i < nr; ++i)
+	{
+		const ChunkInfo& info = dir[i];
+		if (info.m_code == DNA1)
+			continue;
+
+		PtrRange r;
+		r.m_begin = (FBTsize)info.m_old;
+		r.m_end   = (FBTsize)(info.m_old + info.m_len);
+		r.m_index = i;
+		r.m_chunk = 0;
+		index.push_back(r);
+
+		const FBTuint32* code = m_loadFilter;
+		while (*code != 0 && *code != info.m_code)
+			++code;
+
+		if (*code != 0)
+		{
+			state[i] |= CS_REACHED;
+
+			// (the payload of non ID chunks is read later, if needed)
+			if (info.m_code <= 0xFFFF)
+				pending.push_back(i);
+		}
+	}
+	sortPtrIndex(index);
+
+
+	while (pending.size() > 0)
+	{
+		i = pending[pending.size() - 1];
+		pending.pop_back();
+
+		const ChunkInfo& info = dir[i];
+
+		if (!blocks[i] && stream)
+		{
+			bool inPlace;
+			int status = fbtReadPayload(stream, m_payloads, info, blocks[i], inPlace);
+			if (status != FS_OK)
+				return status;
+			if (inPlace)
+				state[i] |= CS_IN_PLACE;
+		}
+
+		const FBTbyte* data = static_cast<const FBTbyte*>(blocks[i]);
+		const FBTsize len = (FBTsize)info.m_len;
+		if (!data)
+			continue;
+
+
+		ptrs.clear(true);
+
+		fbtStruct* fs = info.m_typeid < m_file->m_strcNr ? fd[info.m_typeid] : 0;
+		if (!fs || m_file->m_type[fs->m_key.k16[0]].m_typeId == hk)
+		{
+			// pointer arrays (and raw data: any value matching an old pointer is followed)
+			for (FBTsize off = 0; off + fps <= len; off += fps)
+				ptrs.push_back(fbtReadOldPtr(data + off, fps, endianSwap));
+		}
+		else if (fs->m_len > 0)
+		{
+			fbtStruct::Members::Pointer mp = fs->m_members.ptr();
+			const FBTsizeType s = fs->m_members.size();
+			const FBTsize elmNr = fbtMin<FBTsize>((FBTsize)info.m_nr, len / fs->m_len);
+			const bool isId = info.m_code <= 0xFFFF;
+
+			for (FBTsize n = 0; n < elmNr; ++n)
+			{
+				const FBTbyte* elm = data + fs->m_len * n;
+
+				for (FBTsizeType m = 0; m < s; ++m)
+				{
+					const fbtStruct& member = mp[m];
+					const fbtName& name = m_file->m_name[member.m_key.k16[1]];
+					if (name.m_ptrCount <= 0 || name.m_isFptr)
+						continue;
+
+					// id.next/prev: the filter alone decides which IDs of a type are loaded
+					if (isId && n == 0 && member.m_off < 2 * fps)
+						continue;
+
+					for (int a = 0; a < name.m_arraySize; ++a)
+						ptrs.push_back(fbtReadOldPtr(elm + member.m_off + a * fps, fps, endianSwap));
+				}
+			}
+		}
+
+
+		for (FBTsizeType p = 0; p < ptrs.size(); ++p)
+		{
+			if (!ptrs[p])
+				continue;
+
+			FBTsizeType pos = findPtrRange(index, ptrs[p]);
+			if (pos == FBT_NPOS)
+				continue;
+
+			FBTsizeType j = index[pos].m_index;
+			if (!(state[j] & CS_REACHED))
+			{
+				state[j] |= CS_REACHED;
+				pending.push_back(j);
+			}
+		}
+	}
+
+	return FS_OK;
+}
+
+
+int fbtFile::parseFiltered(fbtStream* stream)
+{
+	ChunkDirectory dir;
+	FBTsizeType dnaIndex = FBT_NPOS, i;
+
+	int status = readChunkDirectory(stream, dir, &dnaIndex);
+	if (status != FS_OK)
+		return status;
+
+	if (dnaIndex == FBT_NPOS)
+	{
+		fbtPrintf("Missing DNA1 chunk\n");
+		return FS_INV_READ;
+	}
+
+
+	// DNA1 is owned (and swapped) by m_file: always copy it
+	const ChunkInfo& dna = dir[dnaIndex];
+	void* dnaBlock = fbtMalloc((FBTsize)dna.m_len);
+	if (!dnaBlock)
+	{
+		FBT_MALLOC_FAILED;
+		return FS_BAD_ALLOC;
+	}
+
+	if (stream->seek((FBTint64)dna.m_offset, SEEK_SET) != (FBTsize)dna.m_offset ||
+	    stream->read(dnaBlock, (FBTsize)dna.m_len) != (FBTsize)dna.m_len)
+	{
+		fbtFree(dnaBlock);
+		FBT_INVALID_READ;
+		return FS_INV_READ;
+	}
+
+	if ((status = readFileTables(dnaBlock, (FBTsize)dna.m_len)) != FS_OK)
+		return status;
+
+
+	fbtArray<void*> blocks(dir.size(), (void*)0);
+	fbtArray<FBTuint8> state(dir.size(), (FBTuint8)0);
+
+	status = markReachable(stream, dir, blocks, state);
+
+
+	// the memory chunks keep the file order
+	for (i = 0; i < dir.size() && status == FS_OK; ++i)
+	{
+		if (!(state[i] & CS_REACHED) || i == dnaIndex)
+			continue;
+
+		const ChunkInfo& info = dir[i];
+
+		bool inPlace = (state[i] & CS_IN_PLACE) != 0;
+		if (!blocks[i] && (status = fbtReadPayload(stream, m_payloads, info, blocks[i], inPlace)) != FS_OK)
+			break;
+
+		Chunk chunk;
+		chunk.m_code   = info.m_code;
+		chunk.m_len    = info.m_len;
+		chunk.m_old    = (FBTsize)info.m_old;
+		chunk.m_typeid = info.m_typeid;
+		chunk.m_nr     = info.m_nr;
+
+		status = insertChunk(chunk, blocks[i], inPlace);
+	}
+
+	if (status != FS_OK)
+		return status;
+
+	if ((status = link()) != FS_OK)
+	{
+		FBT_LINK_FAILED;
+		return FS_LINK_FAILED;
+	}
+	return FS_OK;
+}
+
+
+int fbtFile::pruneChunks(void)
+{
+	fbtArray<MemoryChunk*> nodes;
+	ChunkDirectory dir;
+	fbtArray<void*> blocks;
+
+	MemoryChunk* node;
+	for (node = (MemoryChunk*)m_chunks.first; node; node = node->m_next)
+	{
+		ChunkInfo info;
+		info.m_offset = 0;
+		info.m_len    = node->m_chunk.m_len;
+		info.m_old    = node->m_chunk.m_old;
+		info.m_nr     = node->m_chunk.m_nr;
+		info.m_code   = node->m_chunk.m_code;
+		info.m_typeid = node->m_chunk.m_typeid;
+
+		nodes.push_back(node);
+		dir.push_back(info);
+		blocks.push_back(node->m_block);
+	}
+
+	fbtArray<FBTuint8> state(dir.size(), (FBTuint8)0);
+
+	int status = markReachable(0, dir, blocks, state);
+	if (status != FS_OK)
+		return status;
+
+
+	m_chunks.clear();
+
+	// (the payloads and records of the others stay in the arenas)
+	for (FBTsizeType i = 0; i < nodes.size(); ++i)
+	{
+		if (state[i] & CS_REACHED)
+			m_chunks.push_back(nodes[i]);
+	}
+
+	if (m_chunks.last)
+		m_chunks.last->next = 0;
+	return FS_OK;
+}
+
+
+void fbtFile::releaseExternalBlocks(void)
+{
+	// The stream memory is going away: on success link() has already dropped them all,
+	// otherwise make sure nobody will ever touch them again.
+	for (MemoryChunk* node = (MemoryChunk*)m_chunks.first; node; node = node->m_next)
+	{
+		if (node->m_flag & MemoryChunk::BLK_EXTERNAL)
+		{
+			node->m_block = 0;
+			node->m_flag  = (FBTuint8)(node->m_flag & ~MemoryChunk::BLK_EXTERNAL);
+		}
+	}
+}
+
+
+class fbtPrimType
+{
+public:
+
+};
+
+class fbtLinkCompiler
+{
+public:
+	const fbtBinTables* m_mp;
+	fbtBinTables*       m_fp;
+
+	fbtLinkCompiler() : m_mp(0), m_fp(0), m_indexed(0), m_mask(0) {}
+
+	fbtStruct* find(const fbtCharHashKey& kvp);
+	fbtStruct* find(fbtStruct* strc, fbtStruct* member, bool isPointer, bool& needCast);
+	bool       sameLayout(fbtStruct* fs);
+	int        link(void);
+
+private:
+	// The members of m_indexed by memberHash(): m_first[hash & m_mask] is the first of them, m_next[i] the one after
+	// member i (in member order, as find() used to scan them)
+	fbtStruct*            m_indexed;
+	fbtArray<FBTsizeType> m_first, m_next;
+	FBThash               m_mask;
+
+	static FBThash memberHash(const fbtStruct* member);
+	void           index(fbtStruct* strc);
+};
+
+
+
+fbtStruct* fbtLinkCompiler::find(const fbtCharHashKey& kvp)
+{
+	FBTtype i;
+	if ( (i = m_fp->findTypeId(kvp)) != ((FBTtype)-1))
+		return m_fp->m_offs.at(i);
+	return 0;
+}
+
+
+FBThash fbtLinkCompiler::memberHash(const fbtStruct* member)
+{
+	// base name, array index, depth and key chain: what find() matches before looking at the types
+	FBThash h = (FBThash)_FBT_INITIAL_FNV;
+	h = (h ^ member->m_val.k32[1]) * _FBT_MULTIPLE_FNV;
+	h = (h ^ (FBThash)member->m_nr) * _FBT_MULTIPLE_FNV;
+	h = (h ^ (FBThash)member->m_dp) * _FBT_MULTIPLE_FNV;
+	for (FBTsizeType i = 0; i < member->m_keyChain.size(); ++i)
+	{
+		h = (h ^ member->m_keyChain[i].k32[0]) * _FBT_MULTIPLE_FNV;
+		h = (h ^ member->m_keyChain[i].k32[1]) * _FBT_MULTIPLE_FNV;
+	}
+	return h;
+}
+
+void fbtLinkCompiler::index(fbtStruct* strc)
+{
+	FBTsizeType i, s = strc->m_members.size(), nr = 16;
+	while (nr < 2 * s)
+		nr <<= 1;
+
+	m_indexed = strc;
+	m_mask = (FBThash)(nr - 1);
+	m_first.resize(nr);
+	m_next.resize(s);
+	for (i = 0; i < nr; ++i)
+		m_first[i] = FBT_NPOS;
+
+	// last to first: each chain lists its members in member order
+	for (i = s; i-- > 0; )
+	{
+		FBThash h = memberHash(&strc->m_members[i]) & m_mask;
+		m_next[i] = m_first[h];
+		m_first[h] = i;
+	}
+}
+
+fbtStruct* fbtLinkCompiler::find(fbtStruct* strc, fbtStruct* member, bool isPointer, bool& needCast)
+{
+	if (m_indexed != strc)
+		index(strc);
+
+	fbtStruct::Members::Pointer md = strc->m_members.ptr();
+	FBTsizeType i;
+
+	FBTuint32 k1 = member->m_val.k32[0];
+
+	for (i = m_first[memberHash(member) & m_mask]; i != FBT_NPOS; i = m_next[i])
+	{
+		fbtStruct* strc2 = &md[i];
+
+		if (strc2->m_nr == member->m_nr && strc2->m_dp ==  member->m_dp)
+		{
+			if (strc2->m_val.k32[1] == member->m_val.k32[1]) //base name
+			{				
+				if (!strc2->m_keyChain.equal(member->m_keyChain))
+					continue;
+
+				FBTuint32 k2 = strc2->m_val.k32[0];
+				if (k1 == k2)
+					return strc2;
+
+				if (isPointer)
+					continue;
+
+				// (int -> short too: copying the bytes neither sign extends nor works in big endian)
+				if (fbtIsNumberType(k1) && fbtIsNumberType(k2))
+				{
+					needCast = true;
+					return strc2;
+				}
+			}
+		}
+	}
+
+
+	return 0;
+}
+
+bool fbtLinkCompiler::sameLayout(fbtStruct* fs)
+{
+	// (each memory member links a file member of its own: the same count links all of them)
+	const fbtStruct* strc = fs->m_link;
+	if (!strc || m_mp->m_ptr != m_fp->m_ptr || strc->m_len != fs->m_len || strc->m_members.size() != fs->m_members.size())
+		return false;
+
+	for (FBTsizeType i = 0; i < fs->m_members.size(); ++i)
+	{
+		const fbtStruct* fm = &fs->m_members[i];
+		const fbtStruct* member = fm->m_link;
+
+		if (!member || (fm->m_flag & fbtStruct::NEED_CAST) || member->m_off != fm->m_off || member->m_len != fm->m_len ||
+		    member->m_val.k32[0] != fm->m_val.k32[0] ||
+		    m_mp->m_name[member->m_key.k16[1]].m_ptrCount != m_fp->m_name[fm->m_key.k16[1]].m_ptrCount)
+			return false;
+	}
+	return true;
+}
+
+
+int fbtLinkCompiler::link(void)
+{
+	fbtBinTables::OffsM::ConstPointer md = m_mp->m_offs.ptr();
+    //fbtBinTables::OffsM::Pointer fd = m_fp->m_offs.ptr();
+
+	FBTsizeType i, i2; 
+    //fbtStruct::Members::Pointer p2;
+
+
+	// Only the file side is written (m_link to the memory struct / member, NEED_CAST, SAME_LAYOUT):
+	// the memory tables are the same for every file.
+	for (i = 0; i < m_mp->m_offs.size(); ++i)
+	{
+		fbtStruct* strc = md[i];
+		fbtStruct* fs = find(m_mp->m_type[strc->m_key.k16[0]].m_name);
+		if (!fs)
+			continue;
+
+		FBT_ASSERT(!fs->m_link);
+		fs->m_link = strc;
+
+		//fbtPrintf("+%-3d %s\n", i, m_mp->getStructType(strc));
+		for (i2 = 0; i2 < strc->m_members.size(); ++i2)
+		{
+			fbtStruct* member = &strc->m_members[i2];
+			//fbtPrintf("  %3d %s %s\n", i2, m_mp->getStructType(strc2), m_mp->getStructName(strc2));
+
+			FBT_ASSERT(member->m_key.k16[1] < m_mp->m_nameNr);
+			bool isPointer = m_mp->m_name[member->m_key.k16[1]].m_ptrCount > 0;
+			bool needCast = false;
+			fbtStruct* fm = find(fs, member, isPointer, needCast);
+			if (fm)
+			{
+				fm->m_link = member;
+				if (needCast)
+					fm->m_flag |= fbtStruct::NEED_CAST;
+			}
+		}
+
+		if (sameLayout(fs))
+			fs->m_flag |= fbtStruct::SAME_LAYOUT;
+	}
+
+	return fbtFile::FS_OK;
+}
+
+void copyValues(const FBTbyte* srcPtr, FBTbyte* dstPtr, FBTsize srcElmSize, FBTsize dstElmSize, FBTsize len)
+{
+	if (srcElmSize == dstElmSize)
+	{
+		fbtMemcpy(dstPtr, srcPtr, len * srcElmSize);
+		return;
+	}
+
+	const FBTsize elmSize = fbtMin(srcElmSize, dstElmSize);
+	FBTsize i;
+	for (i = 0; i < len; i++)
+	{
+		fbtMemcpy(dstPtr, srcPtr, elmSize);
+		srcPtr += srcElmSize;
+		dstPtr += dstElmSize;
+	}
+}
+
+
+template <typename S, typename D>
+void fbtCastValues(const void* src, void* dst, FBTsize len)
+{
+	const FBTbyte* sp = static_cast<const FBTbyte*>(src);
+	D* dp = static_cast<D*>(dst);
+
+	FBTsize i;
+	for (i = 0; i < len; i++, sp += sizeof(S))
+	{
+		S v;
+		fbtMemcpy(&v, sp, sizeof(S));
+		dp[i] = (D)v;
+	}
+}
+
+
+fbtCastKernel fbtGetCastKernel(FBT_PRIM_TYPE src, FBT_PRIM_TYPE dst)
+{
+	// in FBT_PRIM_TYPE order (long and ulong are 32 bit in the DNA)
+#define FBT_CAST_ROW(S) \
+	{fbtCastValues<S, char>, fbtCastValues<S, unsigned char>, fbtCastValues<S, short>, fbtCastValues<S, unsigned short>, \
+	 fbtCastValues<S, int>, fbtCastValues<S, int>, fbtCastValues<S, unsigned int>, fbtCastValues<S, float>, fbtCastValues<S, double>}
+
+	static const fbtCastKernel kernels[FBT_PRIM_VOID][FBT_PRIM_VOID] =
+	{
+		FBT_CAST_ROW(char),
+		FBT_CAST_ROW(unsigned char),
+		FBT_CAST_ROW(short),
+		FBT_CAST_ROW(unsigned short),
+		FBT_CAST_ROW(int),
+		FBT_CAST_ROW(int),
+		FBT_CAST_ROW(unsigned int),
+		FBT_CAST_ROW(float),
+		FBT_CAST_ROW(double),
+	};
+#undef FBT_CAST_ROW
+
+	if (src >= FBT_PRIM_VOID || dst >= FBT_PRIM_VOID)
+		return 0;
+	return kernels[src][dst];
+}
+
+
+#if FBT_USE_THREADS == 1
+struct fbtFile::LinkJob
+{
+	fbtFile*            m_file;
+	MemoryChunk* const* m_nodes;
+	const FBTsizeType*  m_batches;      // first node of each batch (and the end)
+	FBTsizeType*        m_lastRange;    // per worker
+};
+
+
+void fbtFile::linkBatch(void* userData, FBTsize index, int worker)
+{
+	// (the nodes are only read here: the other workers look at their m_flag)
+	LinkJob* job = static_cast<LinkJob*>(userData);
+	for (FBTsizeType i = job->m_batches[index]; i < job->m_batches[index + 1]; ++i)
+		job->m_file->convertBlock(job->m_nodes[i], job->m_lastRange[worker]);
+}
+#endif
+
+
+int fbtFile::link(void)
+{
+	fbtBinTables::OffsM::ConstPointer md = m_memory->m_offs.ptr();
+
+	static const FBThash hk = fbtCharHashKey("Link").hash();
+
+
+	// (before the chunk lengths become the converted ones)
+	int status = buildPtrIndex();
+	if (status != FS_OK)
+		return status;
+
+	// Raw data and the blocks of identical layout are used in place when they have an m_payloads block of their own
+	// (newBlock()): these blocks go to m_arena, the rest of m_payloads is released.
+	m_linkOps.clear();
+	m_linkPlans.resize(0);
+	m_linkPlans.resize(m_file->m_strcNr, FBT_NPOS);
+
+	if (m_lazyLink)
+		return linkLazily();
+
+	MemoryChunk* node;
+	for (node = (MemoryChunk*)m_chunks.first; node; node = node->m_next)
+	{
+		if ((status = newBlock(node)) != FS_OK)
+			return status;
+	}
+
+	// the blocks to convert
+	fbtArray<MemoryChunk*> nodes;
+	for (node = (MemoryChunk*)m_chunks.first; node; node = node->m_next)
+	{
+		if (node->m_newTypeId >= m_memory->m_strcNr)
+			continue;
+
+		fbtStruct* cs = md[node->m_newTypeId];
+		if (m_memory->m_type[cs->m_key.k16[0]].m_typeId == hk)
+			continue;
+
+		if (skip(m_memory->m_type[cs->m_key.k16[0]].m_typeId) || !node->m_newBlock)
+		{
+			// (it stays in m_arena)
+			node->m_newBlock = 0;
+
+			continue;
+		}
+		nodes.push_back(node);
+	}
+
+	FBTsizeType i;
+	for (i = 0; i < nodes.size(); ++i)
+	{
+		if ((status = compilePlan(nodes[i]->m_chunk.m_typeid)) != FS_OK)
+			return status;
+	}
+	for (i = 0; i < nodes.size(); ++i)
+	{
+		if ((status = linkPointerArrays(nodes[i])) != FS_OK)
+			return status;
+	}
+
+
+	// Now the blocks only read each other: they can be converted in any order
+#if FBT_USE_THREADS == 1
+	const int numThreads = fbtGetNumThreads();
+	if (numThreads > 1 && nodes.size() > 1)
+	{
+		// one fbtParallelFor() index per run of nodes converting about 64 KB
+		fbtArray<FBTsizeType> batches;
+		FBTsize bytes = 0;
+		for (i = 0; i < nodes.size(); ++i)
+		{
+			if (bytes == 0)
+				batches.push_back(i);
+			bytes += (FBTsize)nodes[i]->m_chunk.m_len;
+			if (bytes >= (64 << 10))
+				bytes = 0;
+		}
+		batches.push_back(nodes.size());
+
+		fbtArray<FBTsizeType> lastRange(numThreads, FBT_NPOS);
+
+		LinkJob job;
+		job.m_file      = this;
+		job.m_nodes     = nodes.ptr();
+		job.m_batches   = batches.ptr();
+		job.m_lastRange = lastRange.ptr();
+		fbtParallelFor(batches.size() - 1, numThreads, linkBatch, &job);
+
+		for (i = 0; i < nodes.size(); ++i)
+			releasePayload(nodes[i]);
+	}
+	else
+#endif
+	{
+		for (i = 0; i < nodes.size(); ++i)
+		{
+			convertBlock(nodes[i], m_lastRange);
+			releasePayload(nodes[i]);
+		}
+	}
+
+	// in file order, once every block is converted
+	for (i = 0; i < nodes.size(); ++i)
+		notifyData(nodes[i]->m_newBlock, nodes[i]->m_chunk);
+
+	for (node = (MemoryChunk*)m_chunks.first; node; node = node->m_next)
+	{
+		keepPayload(node);
+		node->m_block = 0;
+	}
+	m_payloads.clear();
+	m_linkOps.clear();
+	m_linkPlans.clear();
+
+	return fbtFile::FS_OK;
+}
+
+
+int fbtFile::linkLazily(void)
+{
+	// the stream memory goes away with parse()
+	MemoryChunk* node;
+	for (node = (MemoryChunk*)m_chunks.first; node; node = node->m_next)
+	{
+		if (!(node->m_flag & MemoryChunk::BLK_EXTERNAL))
+			continue;
+
+		void* block = m_payloads.alloc((FBTsize)node->m_chunk.m_len);
+		if (!block)
+		{
+			FBT_MALLOC_FAILED;
+			return FS_BAD_ALLOC;
+		}
+		fbtMemcpy(block, node->m_block, (FBTsize)node->m_chunk.m_len);
+		node->m_block = block;
+		node->m_flag  = (FBTuint8)(node->m_flag & ~MemoryChunk::BLK_EXTERNAL);
+		if (m_payloads.isOwnBlock((FBTsize)node->m_chunk.m_len))
+			node->m_flag |= MemoryChunk::BLK_OWN_PAYLOAD;
+	}
+
+	static const FBThash hk = fbtCharHashKey("Link").hash();
+
+	m_idBlocks.clear();
+	for (node = (MemoryChunk*)m_chunks.first; node; node = node->m_next)
+	{
+		if (node->m_chunk.m_code == DATA || !linkBlock(node))
+			continue;
+
+		fbtStruct* cs = m_memory->m_offs.ptr()[node->m_newTypeId];
+		if (m_memory->m_type[cs->m_key.k16[0]].m_typeId == hk)
+			continue;
+
+		// notifyData() links the ID lists (id.next/prev) with these addresses, that must not be old pointers too
+		while (findBlock((FBTsize)node->m_newBlock))
+		{
+			void* block = m_arena.alloc((FBTsize)node->m_chunk.m_len);
+			if (!block)
+			{
+				FBT_MALLOC_FAILED;
+				return FS_BAD_ALLOC;
+			}
+			fbtMemcpy(block, node->m_newBlock, (FBTsize)node->m_chunk.m_len);
+			node->m_newBlock = block;
+		}
+
+		PtrRange r;
+		r.m_begin = r.m_end = (FBTsize)node->m_newBlock;
+		r.m_index = m_idBlocks.size();
+		r.m_chunk = node;
+		m_idBlocks.push_back(r);
+
+		notifyData(node->m_newBlock, node->m_chunk);
+	}
+	sortPtrIndex(m_idBlocks);
+
+	// (the payloads not converted yet and the plans stay for linkBlock())
+	return FS_OK;
+}
+
+
+void* fbtFile::linkBlock(MemoryChunk* node)
+{
+	if (node->m_flag & MemoryChunk::BLK_LINKED)
+		return node->m_newBlock;
+	node->m_flag |= MemoryChunk::BLK_LINKED;
+
+	if (newBlock(node) != FS_OK || !node->m_newBlock)
+	{
+		node->m_newBlock = 0;
+		return 0;
+	}
+
+	static const FBThash hk = fbtCharHashKey("Link").hash();
+
+	fbtStruct* cs = m_memory->m_offs.ptr()[node->m_newTypeId];
+	if (m_memory->m_type[cs->m_key.k16[0]].m_typeId == hk)
+	{
+		keepPayload(node);
+		return node->m_newBlock;
+	}
+
+	if (compilePlan(node->m_chunk.m_typeid) != FS_OK)
+	{
+		node->m_newBlock = 0;
+		return 0;
+	}
+
+	convertBlock(node, m_lastRange);
+	releasePayload(node);
+	keepPayload(node);
+	return node->m_newBlock;
+}
+
+
+void* fbtFile::resolve(const void* ptr)
+{
+	if (!m_lazyLink || !ptr || findPtrRange(m_idBlocks, (FBTsize)ptr) != FBT_NPOS)
+		return const_cast<void*>(ptr);
+
+	MemoryChunk* bin = findBlock((FBTsize)ptr);
+	if (!bin || !linkBlock(bin))
+		return 0;
+	return findPtr((FBTsize)ptr);
+}
+
+
+void* fbtFile::resolve(const void* ptrArray, FBTsizeType index)
+{
+	if (!m_lazyLink)
+		return ptrArray ? static_cast<void* const*>(ptrArray)[index] : 0;
+
+	// (still the file pointers)
+	const FBTbyte* raw = static_cast<const FBTbyte*>(resolve(ptrArray));
+	if (!raw)
+		return 0;
+	return resolve((const void*)fbtReadOldPtr(raw + index * m_file->m_ptr, m_file->m_ptr, (m_fileHeader & FH_ENDIAN_SWAP) != 0));
+}
+
+
+int fbtFile::newBlock(MemoryChunk* node)
+{
+	fbtBinTables::OffsM::Pointer fd = m_file->m_offs.ptr();
+	const bool swapped = (m_fileHeader & FH_ENDIAN_SWAP) != 0;
+
+	static const FBThash hk = fbtCharHashKey("Link").hash();
+
+	if (node->m_chunk.m_typeid >= m_file->m_strcNr || !( fd[node->m_chunk.m_typeid]->m_link))
+		return FS_OK;
+
+	fbtStruct* fs, *ms;
+	fs = fd[node->m_chunk.m_typeid];
+	ms = fs->m_link;
+
+	node->m_newTypeId = ms->m_strcId;
+	// (the payloads sharing an m_payloads block are released with it)
+	const bool owned = (node->m_flag & MemoryChunk::BLK_OWN_PAYLOAD) != 0;
+
+	if (m_memory->m_type[ms->m_key.k16[0]].m_typeId == hk)
+	{
+		if (owned)
+		{
+			node->m_newBlock = node->m_block;
+			return FS_OK;
+		}
+
+		FBTsize totSize = node->m_chunk.m_len;
+		node->m_newBlock = m_arena.alloc(totSize);
+		//printf("alloc1 m_newBlock: 0x%x %d\n", node->m_newBlock, totSize);fflush(stdout);
+
+		if (!node->m_newBlock)
+		{
+			FBT_MALLOC_FAILED;
+			return FS_BAD_ALLOC;
+		}
+
+		fbtMemcpy(node->m_newBlock, node->m_block, totSize);
+		return FS_OK;
+	}
+
+
+	if (skip(m_memory->m_type[ms->m_key.k16[0]].m_typeId))
+		return FS_OK;
+
+
+	FBTsize totSize = (node->m_chunk.m_nr * ms->m_len);
+
+	node->m_chunk.m_len = totSize;
+
+	if (owned && (fs->m_flag & fbtStruct::SAME_LAYOUT) && !swapped)
+	{
+		node->m_newBlock = node->m_block;
+		return FS_OK;
+	}
+
+	node->m_newBlock = m_arena.alloc(totSize);
+	//printf("alloc2 m_newBlock: 0x%x %d\n", node->m_newBlock, totSize);fflush(stdout);
+
+	if (!node->m_newBlock)
+	{
+		FBT_MALLOC_FAILED;
+		return FS_BAD_ALLOC;
+	}
+
+
+	// (OP_BLOCK overwrites all of it)
+	if ((fs->m_flag & fbtStruct::SAME_LAYOUT) && !swapped)
+		return FS_OK;
+
+	// always zero this
+	fbtMemset(node->m_newBlock, 0, totSize);
+	return FS_OK;
+}
+
+
+int fbtFile::compilePlan(FBTsizeType structId)
+{
+	if (m_linkPlans[structId] != FBT_NPOS)
+		return FS_OK;
+
+	const FBTsizeType first = m_linkOps.size();
+	m_linkPlans[structId] = first;
+
+	const fbtStruct* fs = m_file->m_offs.ptr()[structId];
+	const fbtStruct* cs = fs->m_link;
+	fbtStruct::Members::ConstPointer p2 = fs->m_members.ptr();
+	const FBTsizeType s2 = fs->m_members.size();
+	const bool endianSwap = (m_fileHeader & FH_ENDIAN_SWAP) != 0;
+
+	// the same bytes: copied whole, then only the pointers are patched
+	const bool sameLayout = (fs->m_flag & fbtStruct::SAME_LAYOUT) && !endianSwap;
+	if (sameLayout)
+	{
+		LinkOp op;
+		fbtMemset(&op, 0, sizeof(LinkOp));
+		op.m_code = LinkOp::OP_BLOCK;
+		op.m_len  = cs->m_len;
+		m_linkOps.push_back(op);
+	}
+
+	for (FBTsizeType i2 = 0; i2 < s2; ++i2)
+	{
+		const fbtStruct* srcStrc = &p2[i2];
+		const fbtStruct* dstStrc = srcStrc->m_link;
+
+		// If it's missing we can safely skip this member
+		if (!dstStrc)
+			continue;
+
+		const fbtName& nameD = m_memory->m_name[dstStrc->m_key.k16[1]];
+		const fbtName& nameS = m_file->m_name[srcStrc->m_key.k16[1]];
+		if (sameLayout && nameD.m_ptrCount == 0)
+			continue;
+
+		LinkOp op;
+		fbtMemset(&op, 0, sizeof(LinkOp));
+		op.m_dst = dstStrc->m_off;
+		op.m_src = srcStrc->m_off;
+
+		if (nameD.m_ptrCount > 0)
+		{
+			if (nameD.m_ptrCount > 1)
+			{
+				op.m_code = LinkOp::OP_PTR_ARRAY;
+				op.m_len  = 1;
+			}
+			else
+			{
+				op.m_code = LinkOp::OP_PTR;
+				op.m_len  = fbtMin(nameS.m_arraySize, nameD.m_arraySize);
+			}
+			pushLinkOp(op, first);
+			continue;
+		}
+
+		const FBTint32 dstElmSize = dstStrc->m_len / nameD.m_arraySize;
+		const FBTint32 srcElmSize = srcStrc->m_len / nameS.m_arraySize;
+
+		const bool needCast = (srcStrc->m_flag & fbtStruct::NEED_CAST) != 0;
+		const bool needSwap = endianSwap && srcElmSize > 1;
+
+		if (!needCast && !needSwap && srcStrc->m_val.k32[0] == dstStrc->m_val.k32[0]) //same type
+		{
+			// Take the minimum length of any array.
+			op.m_code = LinkOp::OP_COPY;
+			op.m_len  = fbtMin(srcStrc->m_len, dstStrc->m_len);
+			pushLinkOp(op, first);
+			continue;
+		}
+
+		FBT_PRIM_TYPE stp = FBT_PRIM_UNKNOWN, dtp  = FBT_PRIM_UNKNOWN;
+		if (needCast || needSwap)
+		{
+			stp = fbtGetPrimType(srcStrc->m_val.k32[0]);
+			dtp = fbtGetPrimType(dstStrc->m_val.k32[0]);
+
+			FBT_ASSERT(!needCast || (stp < FBT_PRIM_VOID && dtp < FBT_PRIM_VOID && stp != dtp));
+		}
+
+		if (needSwap)
+		{
+			if (stp == FBT_PRIM_SHORT || stp == FBT_PRIM_USHORT)
+				op.m_swap = 2;
+			else if (stp >= FBT_PRIM_INT && stp <= FBT_PRIM_FLOAT)
+				op.m_swap = 4;
+			else if (stp == FBT_PRIM_DOUBLE)
+				op.m_swap = 8;
+			else
+				op.m_swap = LinkOp::SWAP_ZERO; //unknown type
+		}
+
+		op.m_len     = fbtMin(nameS.m_arraySize, nameD.m_arraySize);
+		op.m_srcSize = srcElmSize;
+		op.m_dstSize = dstElmSize;
+		op.m_cast    = needCast ? fbtGetCastKernel(stp, dtp) : 0;
+		FBT_ASSERT(op.m_swap == 0 || op.m_swap == LinkOp::SWAP_ZERO || srcElmSize <= 8);
+
+		if (!needCast && op.m_swap == srcElmSize && srcElmSize == dstElmSize)
+			op.m_code = LinkOp::OP_SWAP;
+		else
+			op.m_code = LinkOp::OP_VALUES;
+		pushLinkOp(op, first);
+	}
+
+	// a single swap run over the whole element: the block is swapped at once
+	if (m_linkOps.size() == first + 1)
+	{
+		LinkOp& op = m_linkOps[first];
+		if (op.m_code == LinkOp::OP_SWAP && op.m_dst == 0 && op.m_src == 0 &&
+		    op.m_len * op.m_srcSize == cs->m_len && cs->m_len == fs->m_len)
+		{
+			op.m_code = LinkOp::OP_BLOCK;
+			op.m_len  = cs->m_len;
+		}
+	}
+
+	LinkOp end;
+	fbtMemset(&end, 0, sizeof(LinkOp));
+	end.m_code = LinkOp::OP_END;
+	m_linkOps.push_back(end);
+	return FS_OK;
+}
+
+
+void fbtFile::pushLinkOp(const LinkOp& op, FBTsizeType first)
+{
+	if (m_linkOps.size() > first)
+	{
+		LinkOp& last = m_linkOps[m_linkOps.size() - 1];
+		if (last.m_code == op.m_code)
+		{
+			FBTint32 dstStep = 0, srcStep = 0;
+			if (op.m_code == LinkOp::OP_COPY)
+				dstStep = srcStep = 1;
+			else if (op.m_code == LinkOp::OP_SWAP && last.m_srcSize == op.m_srcSize)
+				dstStep = srcStep = op.m_srcSize;
+			else if (op.m_code == LinkOp::OP_VALUES && last.m_cast == op.m_cast && last.m_swap == op.m_swap &&
+			         last.m_srcSize == op.m_srcSize && last.m_dstSize == op.m_dstSize)
+			{
+				dstStep = op.m_dstSize;
+				srcStep = op.m_srcSize;
+			}
+			else if (op.m_code == LinkOp::OP_PTR)
+			{
+				dstStep = m_memory->m_ptr;
+				srcStep = m_file->m_ptr;
+			}
+
+			if (dstStep && last.m_dst + last.m_len * dstStep == op.m_dst && last.m_src + last.m_len * srcStep == op.m_src)
+			{
+				last.m_len += op.m_len;
+				return;
+			}
+		}
+	}
+	m_linkOps.push_back(op);
+}
+
+
+int fbtFile::linkPointerArrays(MemoryChunk* node)
+{
+	const fbtStruct* fs = m_file->m_offs.ptr()[node->m_chunk.m_typeid];
+	const LinkOp* plan = m_linkOps.ptr() + m_linkPlans[node->m_chunk.m_typeid];
+	const LinkOp* op;
+	const FBTuint8 mps = m_memory->m_ptr, fps = m_file->m_ptr;
+	const bool endianSwap = (m_fileHeader & FH_ENDIAN_SWAP) != 0;
+
+	for (op = plan; op->m_code != LinkOp::OP_END; ++op)
+	{
+		if (op->m_code == LinkOp::OP_PTR_ARRAY)
+			break;
+	}
+	if (op->m_code == LinkOp::OP_END)
+		return FS_OK;
+
+
+	for (FBTsize n = 0; n < (FBTsize)node->m_chunk.m_nr; ++n)
+	{
+		const FBTbyte* src = static_cast<const FBTbyte*>(node->m_block) + (fs->m_len * n);
+
+		for (op = plan; op->m_code != LinkOp::OP_END; ++op)
+		{
+			if (op->m_code != LinkOp::OP_PTR_ARRAY)
+				continue;
+
+			const FBTsize srcVal = fbtReadOldPtr(src + op->m_src, fps, endianSwap);
+			if (!srcVal)
+				continue;
+
+			MemoryChunk* bin = findBlock(srcVal);
+			if (!bin || (bin->m_flag & MemoryChunk::BLK_MODIFIED))
+			{
+				//fbtPrintf("**block not found @ 0x%p)\n", src);
+				continue;
+			}
+
+			// take pointer size out of the equation
+			const FBTsize total = (FBTsize)bin->m_chunk.m_len / fps;
+
+			// (each pointer is read before it is overwritten)
+			const bool inPlace = bin->m_newBlock == bin->m_block && mps == fps;
+
+			FBTsize* nptr = inPlace ? static_cast<FBTsize*>(bin->m_block) : (FBTsize*)m_arena.alloc(total * mps);
+			if (!nptr)
+			{
+				FBT_MALLOC_FAILED;
+				return FS_BAD_ALLOC;
+			}
+			if (!inPlace)
+				fbtMemset(nptr, 0, total * mps);
+
+			const FBTbyte* optr = static_cast<const FBTbyte*>(bin->m_block);
+
+			for (FBTsize pi = 0; pi < total; pi++, optr += fps)
+				nptr[pi] = (FBTsize)findPtr(fbtReadOldPtr(optr, fps, endianSwap));
+
+			bin->m_chunk.m_len = total * mps;
+			bin->m_flag |= MemoryChunk::BLK_MODIFIED;
+
+			// (a raw copy in m_arena stays there)
+			bin->m_newBlock = nptr;
+			releasePayload(bin);
+		}
+	}
+	return FS_OK;
+}
+
+
+void fbtFile::releasePayload(MemoryChunk* node)
+{
+	if ((node->m_flag & MemoryChunk::BLK_OWN_PAYLOAD) && node->m_block != node->m_newBlock)
+	{
+		m_payloads.release(node->m_block);
+		node->m_block = 0;
+		node->m_flag  = (FBTuint8)(node->m_flag & ~MemoryChunk::BLK_OWN_PAYLOAD);
+	}
+}
+
+
+void fbtFile::keepPayload(MemoryChunk* node)
+{
+	if ((node->m_flag & MemoryChunk::BLK_OWN_PAYLOAD) && node->m_block == node->m_newBlock)
+	{
+		m_arena.adopt(m_payloads, node->m_block);
+		node->m_flag = (FBTuint8)(node->m_flag & ~MemoryChunk::BLK_OWN_PAYLOAD);
+	}
+}
+
+
+void fbtFile::convertBlock(MemoryChunk* node, FBTsizeType& lastRange)
+{
+	const fbtStruct* fs = m_file->m_offs.ptr()[node->m_chunk.m_typeid];
+	const LinkOp* plan = m_linkOps.ptr() + m_linkPlans[node->m_chunk.m_typeid];
+	const FBTsize dstLen = fs->m_link->m_len, srcLen = fs->m_len;
+	const FBTuint8 fps = m_file->m_ptr;
+	const bool endianSwap = (m_fileHeader & FH_ENDIAN_SWAP) != 0;
+
+	FBTbyte* dst = static_cast<FBTbyte*>(node->m_newBlock);
+	const FBTbyte* src = static_cast<const FBTbyte*>(node->m_block);
+	FBTint32 i;
+
+	if (plan->m_code == LinkOp::OP_BLOCK)
+	{
+		// (nothing to copy in place: the pointers are read before they are patched)
+		const FBTsize total = (FBTsize)node->m_chunk.m_nr * plan->m_len;
+		if (dst != src)
+			fbtMemcpy(dst, src, total);
+
+		if (plan->m_swap == 2)
+			fbtSwap16((FBTuint16*)dst, total / 2);
+		else if (plan->m_swap == 4)
+			fbtSwap32((FBTuint32*)dst, total / 4);
+		else if (plan->m_swap == 8)
+			fbtSwap64((FBTuint64*)dst, total / 8);
+
+		// (the old pointers are already there)
+		if (m_lazyLink && !plan->m_swap)
+			return;
+		if ((++plan)->m_code == LinkOp::OP_END)
+			return;
+	}
+
+	for (FBTsize n = 0; n < (FBTsize)node->m_chunk.m_nr; ++n, dst += dstLen, src += srcLen)
+	{
+		for (const LinkOp* op = plan; op->m_code != LinkOp::OP_END; ++op)
+		{
+			FBTbyte* dstPtr = dst + op->m_dst;
+			const FBTbyte* srcPtr = src + op->m_src;
+
+			switch (op->m_code)
+			{
+			case LinkOp::OP_COPY:
+				fbtMemcpy(dstPtr, srcPtr, op->m_len);
+				break;
+
+			case LinkOp::OP_SWAP:
+				fbtMemcpy(dstPtr, srcPtr, op->m_len * op->m_srcSize);
+				if (op->m_swap == 2)
+					fbtSwap16((FBTuint16*)dstPtr, op->m_len);
+				else if (op->m_swap == 4)
+					fbtSwap32((FBTuint32*)dstPtr, op->m_len);
+				else
+					fbtSwap64((FBTuint64*)dstPtr, op->m_len);
+				break;
+
+			case LinkOp::OP_VALUES:
+			{
+				if (op->m_swap == LinkOp::SWAP_ZERO)
+				{
+					// (unknown type)
+					const FBTsize elen = fbtMin(op->m_srcSize, op->m_dstSize);
+					for (i = 0; i < op->m_len; i++, dstPtr += op->m_dstSize)
+						fbtMemset(dstPtr, 0, elen);
+					break;
+				}
+				if (!op->m_swap)
+				{
+					if (op->m_cast)
+						op->m_cast(srcPtr, dstPtr, op->m_len);
+					else
+						copyValues(srcPtr, dstPtr, op->m_srcSize, op->m_dstSize, op->m_len);
+					break;
+				}
+
+				// swapped in a buffer first, a run at a time
+				FBTuint64 tmpBuf[32];
+				const FBTint32 run = (FBTint32)(sizeof(tmpBuf) / op->m_srcSize);
+				for (i = 0; i < op->m_len; i += run)
+				{
+					const FBTint32 cnt = fbtMin(run, op->m_len - i);
+					FBTbyte* tmp = reinterpret_cast<FBTbyte*>(tmpBuf);
+					fbtMemcpy(tmp, srcPtr, cnt * op->m_srcSize);
+
+					// (only the first m_swap bytes of wider values)
+					if (op->m_swap == 2 && op->m_srcSize == 2)
+						fbtSwap16((FBTuint16*)tmp, cnt);
+					else if (op->m_swap == 4 && op->m_srcSize == 4)
+						fbtSwap32((FBTuint32*)tmp, cnt);
+					else if (op->m_swap == 8 && op->m_srcSize == 8)
+						fbtSwap64((FBTuint64*)tmp, cnt);
+					else
+					{
+						for (FBTint32 k = 0; k < cnt; ++k, tmp += op->m_srcSize)
+						{
+							if (op->m_swap == 2)
+								fbtSwap16((FBTuint16*)tmp, 1);
+							else if (op->m_swap == 4)
+								fbtSwap32((FBTuint32*)tmp, 1);
+							else
+								fbtSwap64((FBTuint64*)tmp, 1);
+						}
+						tmp = reinterpret_cast<FBTbyte*>(tmpBuf);
+					}
+
+					if (op->m_cast)
+						op->m_cast(tmp, dstPtr, cnt);
+					else
+						copyValues(tmp, dstPtr, op->m_srcSize, op->m_dstSize, cnt);
+
+					srcPtr += cnt * op->m_srcSize;
+					dstPtr += cnt * op->m_dstSize;
+				}
+				break;
+			}
+
+			case LinkOp::OP_PTR:
+			{
+				FBTsize* dptr = (FBTsize*)dstPtr;
+				for (i = 0; i < op->m_len; ++i, srcPtr += fps)
+				{
+					const FBTsize srcVal = fbtReadOldPtr(srcPtr, fps, endianSwap);
+					dptr[i] = (srcVal && !m_lazyLink) ? (FBTsize)findPtr(srcVal, lastRange) : srcVal;
+				}
+				break;
+			}
+
+			case LinkOp::OP_PTR_ARRAY:
+			{
+				// (converted by linkPointerArrays())
+				const FBTsize srcVal = fbtReadOldPtr(srcPtr, fps, endianSwap);
+				if (m_lazyLink)
+				{
+					*(FBTsize*)dstPtr = srcVal;
+					break;
+				}
+				MemoryChunk* bin = srcVal ? findBlock(srcVal, lastRange) : 0;
+				*(FBTsize*)dstPtr = (bin && (bin->m_flag & MemoryChunk::BLK_MODIFIED)) ? (FBTsize)findPtr(srcVal, lastRange) : 0;
+				break;
+			}
+			}
+		}
+	}
+}
+
+
+
+
+
+
+void* fbtFile::findPtr(const FBTsize& iptr)
+{
+	return findPtr(iptr, m_lastRange);
+}
+
+
+fbtFile::MemoryChunk* fbtFile::findBlock(const FBTsize& iptr)
+{
+	return findBlock(iptr, m_lastRange);
+}
+
+
+void* fbtFile::findPtr(const FBTsize& iptr, FBTsizeType& lastRange)
+{
+	MemoryChunk* bin = findBlock(iptr, lastRange);
+	if (!bin || !bin->m_newBlock)
+		return 0;
+
+	const FBTsize offset = iptr - bin->m_chunk.m_old;
+#if FBT_RESOLVE_INNER_POINTERS == 1
+	return offset ? findInnerPtr(bin, offset) : bin->m_newBlock;
+#else
+	// (nothing tells a pointer into the block from a stale one that lands there)
+	return offset ? 0 : bin->m_newBlock;
+#endif
+}
+
+
+fbtFile::MemoryChunk* fbtFile::findBlock(const FBTsize& iptr, FBTsizeType& lastRange) const
+{
+	// consecutive lookups often hit the same block (e.g. pointer arrays)
+	FBTsizeType i = lastRange;
+	if (i >= m_ptrIndex.size() || iptr < m_ptrIndex[i].m_begin ||
+	    (iptr >= m_ptrIndex[i].m_end && iptr != m_ptrIndex[i].m_begin))
+	{
+		if ((i = findPtrRange(m_ptrIndex, iptr)) == FBT_NPOS)
+			return 0;
+		lastRange = i;
+	}
+	return m_ptrIndex[i].m_chunk;
+}
+
+
+void* fbtFile::findInnerPtr(MemoryChunk* bin, FBTsize offset)
+{
+	static const FBThash hk = fbtCharHashKey("Link").hash();
+
+	const FBTuint8 mps = m_memory->m_ptr, fps = m_file->m_ptr;
+	char* base = static_cast<char*>(bin->m_newBlock);
+
+	// pointer arrays converted by link()
+	if (bin->m_flag & MemoryChunk::BLK_MODIFIED)
+		return (offset % fps) ? 0 : base + (offset / fps) * mps;
+
+	if (bin->m_chunk.m_typeid >= m_file->m_strcNr)
+		return 0;
+
+	fbtStruct* fs = m_file->m_offs.ptr()[bin->m_chunk.m_typeid];
+	fbtStruct* ms = fs->m_link;
+	if (!ms)
+		return 0;
+
+	// raw copies
+	if (m_memory->m_type[ms->m_key.k16[0]].m_typeId == hk)
+		return base + offset;
+
+	if (fs->m_len == 0 || offset / fs->m_len >= (FBTsize)bin->m_chunk.m_nr)
+		return 0;
+
+	base += (offset / fs->m_len) * ms->m_len;
+	offset %= fs->m_len;
+	if (offset == 0)
+		return base;
+
+
+	// inside an element: the (flattened) member holding it
+	fbtStruct::Members::Pointer fd = fs->m_members.ptr();
+	for (FBTsizeType i = 0; i < fs->m_members.size(); ++i)
+	{
+		const fbtStruct* src = &fd[i];
+		const fbtStruct* dst = src->m_link;
+		if (!dst || offset < (FBTsize)src->m_off || offset >= (FBTsize)(src->m_off + src->m_len))
+			continue;
+
+		const fbtName& nameD = m_memory->m_name[dst->m_key.k16[1]];
+		const fbtName& nameS = m_file->m_name[src->m_key.k16[1]];
+		const FBTsize dstElmSize = dst->m_len / nameD.m_arraySize;
+		const FBTsize srcElmSize = src->m_len / nameS.m_arraySize;
+
+		const FBTsize elm = (offset - src->m_off) / srcElmSize, rest = (offset - src->m_off) % srcElmSize;
+		if (elm >= (FBTsize)nameD.m_arraySize || (rest && srcElmSize != dstElmSize))
+			return 0;
+		return base + dst->m_off + elm * dstElmSize + rest;
+	}
+	return 0;
+}
+
+
+
+int fbtFile::compileOffsets(const fbtBinTables* memory, fbtBinTables* file)
+{
+	fbtLinkCompiler lnk;
+	lnk.m_mp = memory;
+	lnk.m_fp = file;
+	return lnk.link();
+}
+
+bool fbtFile::_setuid(const char* uid)
+{
+	if (!uid || strlen(uid) != 7) return false;
+
+	m_uhid = uid;
+	return true;
+}
+
+int fbtFile::reflect(const char* path, const int mode, const fbtEndian& /*endian*/)
+{
+	fbtStream* fs;
+	
+#if FBT_USE_GZ_FILE == 1
+	if (mode == PM_COMPRESSED)
+		fs = new fbtGzStream();
+	else
+#endif
+	{
+		fs = new fbtFileStream();
+	}
+	
+	fs->open(path, fbtStream::SM_WRITE);
+
+
+	FBTuint8 cp = FBT_VOID8 ? FM_64_BIT : FM_32_BIT;
+	FBTuint8 ce = ((FBTuint8)fbtGetEndian()) == FBT_ENDIAN_IS_BIG ? FM_BIG_ENDIAN : FM_LITTLE_ENDIAN;
+
+//	Commented for now since the rest of the code does not care
+//	if (endian != FBT_ENDIAN_NATIVE)
+//	{
+//		if (endian == FBT_ENDIAN_IS_BIG)
+//			ce = FM_BIG_ENDIAN;
+//		else
+//			ce = FM_LITTLE_ENDIAN;
+//	}
+
+	// put magic
+	//fs->writef("%s%c%c%i", m_uhid, cp, ce, m_version);
+    char header[FBT_BLEND_HEADER_SIZE] = {};//{0,0,0,0,0,0,0,0,0,0,0,0};
+	char version[33];
+	sprintf(version, "%i",m_version);
+	
+	strncpy(&header[0], m_uhid, 7); // 7 first bytes of header
+#   if BLENDER_VERSION<500
+	header[7] = cp;					// 8th byte = pointer size
+	header[8] = ce;					// 9th byte = endianness
+    strncpy(&header[9], version, 3);// last 3 bytes for 3 version char
+#   else
+    header[7]='1';header[8]='7'; // header size = 17
+    header[9]='-';
+    header[10]='0';header[11]='1'; // file version format = 01
+    header[12]=ce; // endianness
+    strncpy(&header[13], version, 4);// last 4 bytes for 4 version char
+#   endif
+    fs->write(header, FBT_BLEND_HEADER_SIZE);
+	
+	writeData(fs);
+
+	// write DNA1
+	Chunk ch;
+	ch.m_code   = DNA1;
+	ch.m_len    = getFBTlength();
+	ch.m_nr     = 1;
+	ch.m_old    = 0;
+	ch.m_typeid = 0;
+	fs->write(&ch, fbtChunk::BlockSize);
+	fs->write(getFBT(), ch.m_len);
+
+
+	// write ENDB (End Byte | EOF )
+	ch.m_code   = ENDB;
+	ch.m_len    = 0;
+	ch.m_nr     = 0;
+	ch.m_old    = 0;
+	ch.m_typeid = 0;
+	fs->write(&ch, fbtChunk::BlockSize);
+	
+	delete fs;
+	return FS_OK;
+
+}
+
+void fbtFile::writeStruct(fbtStream* stream, FBTtype index, FBTuint32 code, FBTsize len, void* writeData)
+{
+	Chunk ch;
+	ch.m_code   = code;
+	ch.m_len    = len;
+	ch.m_nr     = 1;
+	ch.m_old    = (FBTsize)writeData;
+	ch.m_typeid = index;
+
+	fbtChunk::write(&ch, stream);
+}
+
+void fbtFile::writeBuffer(fbtStream* stream, FBTsize len, void* writeData)
+{
+	Chunk ch;
+	ch.m_code   = DATA;
+	ch.m_len    = len;
+	ch.m_nr     = 1;
+	ch.m_old    = (FBTsize)writeData;
+	ch.m_typeid = m_memory->findTypeId("Link");
+
+	fbtChunk::write(&ch, stream);
+}
+
+int fbtChunk::write(fbtFile::Chunk* src, fbtStream* stream)
+{	
+	int size = 0;
+	size += stream->write(src, BlockSize);
+	size += stream->write((void*)src->m_old, src->m_len);
+	return size;
+}
+
+int fbtChunk::read(fbtFile::Chunk* dest, fbtStream* stream, int flags)
+{
+	FBTsize bytesRead = 0;
+    bool bitsVary   = (flags & fbtFile::FH_VAR_BITS) != 0;
+	bool swapEndian = (flags & fbtFile::FH_ENDIAN_SWAP) != 0;
+
+	fbtFile::Chunk64 c64;
+	fbtFile::Chunk32 c32;
+	fbtFile::Chunk*  cpy;
+
+
+	if (FBT_VOID8)
+	{
+        // here we must add support for Blender 5.0+ where most lengths are 64 bit and the Chunk64 field order is different than before
+        if (bitsVary)
+		{
+            FBT_ASSERT(BLENDER_VERSION<500); // old format only (TOTEST: ican this happen?)
+			fbtFile::Chunk32 src;
+			if ((bytesRead = stream->read(&src, Block32)) != Block32)
+			{
+				FBT_INVALID_READ;
+				return fbtFile::FS_INV_READ;
+			}
+
+			c64.m_code    = src.m_code;
+			c64.m_len     = src.m_len;
+
+			union
+			{
+				FBTuint64   m_ptr;
+				FBTuint32   m_doublePtr[2];
+			} ptr;
+			ptr.m_doublePtr[0] = swapEndian ? fbtSwap32(src.m_old) : src.m_old;
+			ptr.m_doublePtr[1] = 0;
+
+			c64.m_old     = ptr.m_ptr;
+			c64.m_typeid  = src.m_typeid;
+			c64.m_nr      = src.m_nr;
+		}
+		else
+		{
+			if ((bytesRead = stream->read(&c64, BlockSize)) != BlockSize)
+			{
+				FBT_INVALID_READ;
+				return fbtFile::FS_INV_READ;
+			}
+
+			// (old pointers are compared with the swapped ones of the blocks)
+			if (swapEndian)
+				c64.m_old = fbtSwap64(c64.m_old);
+		}
+
+		if (swapEndian)
+		{
+			if ((c64.m_code & 0xFFFF) == 0)
+				c64.m_code >>= 16;
+
+#           if BLENDER_VERSION<500
+			c64.m_len    = fbtSwap32(c64.m_len);
+			c64.m_nr     = fbtSwap32(c64.m_nr);
+			c64.m_typeid = fbtSwap32(c64.m_typeid);
+#           else
+            c64.m_typeid = fbtSwap32(c64.m_typeid);
+            c64.m_len    = fbtSwap64(c64.m_len);
+            c64.m_nr     = fbtSwap64(c64.m_nr);
+#           endif
+		}
+
+        cpy = (fbtFile::Chunk*)(&c64);
+	}
+	else
+	{
+        FBT_ASSERT(BLENDER_VERSION<500); // old format only
+		if (bitsVary)
+		{
+			fbtFile::Chunk64 src;
+			if ((bytesRead = stream->read(&src, Block64)) != Block64)
+			{
+				FBT_INVALID_READ;
+				return fbtFile::FS_INV_READ;
+			}
+
+			// copy down
+
+			c32.m_code    = src.m_code;
+			c32.m_len     = src.m_len;
+
+			union
+			{
+				FBTuint64   m_ptr;
+				FBTuint32   m_doublePtr[2];
+			} ptr;
+			ptr.m_doublePtr[0] = 0;
+			ptr.m_doublePtr[1] = 0;
+			ptr.m_ptr = swapEndian ? fbtSwap64(src.m_old) : src.m_old;
+
+			c32.m_old       = ptr.m_doublePtr[0] != 0 ? ptr.m_doublePtr[0] : ptr.m_doublePtr[1];
+			c32.m_typeid    = src.m_typeid;
+			c32.m_nr        = src.m_nr;
+		}
+		else
+		{
+			if ((bytesRead = stream->read(&c32, BlockSize)) != BlockSize)
+			{
+				FBT_INVALID_READ;
+				return fbtFile::FS_INV_READ;
+			}
+
+			if (swapEndian)
+				c32.m_old = fbtSwap32(c32.m_old);
+		}
+
+
+		if (swapEndian)
+		{
+			if ((c32.m_code & 0xFFFF) == 0)
+				c32.m_code >>= 16;
+
+			c32.m_len    = fbtSwap32(c32.m_len);
+			c32.m_nr     = fbtSwap32(c32.m_nr);
+			c32.m_typeid = fbtSwap32(c32.m_typeid);
+		}
+
+
+
+		cpy = (fbtFile::Chunk*)(&c32);
+	}
+
+	if (cpy->m_len == FBT_NPOS)
+	{
+		FBT_INVALID_LEN;
+		return fbtFile::FS_INV_LENGTH;
+	}
+
+	fbtMemcpy(dest, cpy, BlockSize);
+	return (int)bytesRead;    // the header size: the payload length is dest->m_len
+}
+
+
+// Source File "fbtThreads.cpp"
+//#define FBT_IN_SOURCE
+//#include "fbtThreads.h"
+//#include "fbtPlatformHeaders.h"
+
+#if FBT_COMPILER == FBT_COMPILER_MSVC
+void fbtSpinLock::lock(void)        {while (InterlockedExchange(&m_locked, 1)) Sleep(0);}
+void fbtSpinLock::unlock(void)      {InterlockedExchange(&m_locked, 0);}
+#else
+void fbtSpinLock::lock(void)        {while (__sync_lock_test_and_set(&m_locked, 1)) {}}
+void fbtSpinLock::unlock(void)      {__sync_lock_release(&m_locked);}
+#endif
+
+#if FBT_USE_THREADS == 1
+
+#if FBT_PLATFORM == FBT_PLATFORM_WIN32
+fbtMutex::fbtMutex()                {InitializeCriticalSection(&m_cs);}
+fbtMutex::~fbtMutex()               {DeleteCriticalSection(&m_cs);}
+void fbtMutex::lock(void)           {EnterCriticalSection(&m_cs);}
+void fbtMutex::unlock(void)         {LeaveCriticalSection(&m_cs);}
+
+fbtSemaphore::fbtSemaphore(int count)   {m_handle = CreateSemaphore(NULL, count, 0x7FFFFFFF, NULL);}
+fbtSemaphore::~fbtSemaphore()           {CloseHandle(m_handle);}
+void fbtSemaphore::wait(void)           {WaitForSingleObject(m_handle, INFINITE);}
+void fbtSemaphore::post(void)           {ReleaseSemaphore(m_handle, 1, NULL);}
+#else
+fbtMutex::fbtMutex()                {pthread_mutex_init(&m_mutex, 0);}
+fbtMutex::~fbtMutex()               {pthread_mutex_destroy(&m_mutex);}
+void fbtMutex::lock(void)           {pthread_mutex_lock(&m_mutex);}
+void fbtMutex::unlock(void)         {pthread_mutex_unlock(&m_mutex);}
+
+// (unnamed POSIX semaphores are not available everywhere, e.g. on Apple platforms)
+fbtSemaphore::fbtSemaphore(int count)
+	:    m_count(count)
+{
+	pthread_mutex_init(&m_mutex, 0);
+	pthread_cond_init(&m_cond, 0);
+}
+
+fbtSemaphore::~fbtSemaphore()
+{
+	pthread_cond_destroy(&m_cond);
+	pthread_mutex_destroy(&m_mutex);
+}
+
+void fbtSemaphore::wait(void)
+{
+	pthread_mutex_lock(&m_mutex);
+	while (m_count <= 0)
+		pthread_cond_wait(&m_cond, &m_mutex);
+	--m_count;
+	pthread_mutex_unlock(&m_mutex);
+}
+
+void fbtSemaphore::post(void)
+{
+	pthread_mutex_lock(&m_mutex);
+	++m_count;
+	pthread_cond_signal(&m_cond);
+	pthread_mutex_unlock(&m_mutex);
+}
+#endif
+
+
+fbtThread::fbtThread()
+	:    m_func(0), m_arg(0), m_running(false), m_handle()
+{
+}
+
+
+fbtThread::~fbtThread()
+{
+	join();
+}
+
+
+bool fbtThread::start(Func func, void* arg)
+{
+	join();
+
+	m_func = func;
+	m_arg  = arg;
+#if FBT_PLATFORM == FBT_PLATFORM_WIN32
+	m_handle  = CreateThread(0, 0, entry, this, 0, 0);
+	m_running = m_handle != 0;
+#else
+	m_running = pthread_create(&m_handle, 0, entry, this) == 0;
+#endif
+	return m_running;
+}
+
+
+void fbtThread::join(void)
+{
+	if (!m_running)
+		return;
+#if FBT_PLATFORM == FBT_PLATFORM_WIN32
+	WaitForSingleObject(m_handle, INFINITE);
+	CloseHandle(m_handle);
+#else
+	pthread_join(m_handle, 0);
+#endif
+	m_running = false;
+}
+
+
+#if FBT_PLATFORM == FBT_PLATFORM_WIN32
+DWORD WINAPI fbtThread::entry(LPVOID self)
+{
+	((fbtThread*)self)->m_func(((fbtThread*)self)->m_arg);
+	return 0;
+}
+#else
+void* fbtThread::entry(void* self)
+{
+	((fbtThread*)self)->m_func(((fbtThread*)self)->m_arg);
+	return 0;
+}
+#endif
+
+
+struct fbtParallelForJob
+{
+	fbtParallelForFunc m_func;
+	void*              m_userData;
+	FBTsize            m_count;
+	FBTsize            m_next;
+	fbtMutex           m_mutex;
+};
+
+struct fbtParallelForWorker
+{
+	fbtParallelForJob* m_job;
+	int                m_worker;
+};
+
+
+static void fbtParallelForRun(fbtParallelForJob* job, int worker)
+{
+	for (;;)
+	{
+		job->m_mutex.lock();
+		const FBTsize index = job->m_next++;
+		job->m_mutex.unlock();
+
+		if (index >= job->m_count)
+			break;
+		job->m_func(job->m_userData, index, worker);
+	}
+}
+
+
+static void fbtParallelForThread(void* arg)
+{
+	fbtParallelForWorker* w = (fbtParallelForWorker*)arg;
+	fbtParallelForRun(w->m_job, w->m_worker);
+}
+
+
+void fbtParallelFor(FBTsize count, int numThreads, fbtParallelForFunc func, void* userData)
+{
+	fbtParallelForJob job;
+	job.m_func     = func;
+	job.m_userData = userData;
+	job.m_count    = count;
+	job.m_next     = 0;
+
+	if ((FBTsize)numThreads > count)
+		numThreads = (int)count;
+
+	// workers that can't be started just leave more indices to the others
+	fbtParallelForWorker* workers = 0;
+	fbtThread*            threads = 0;
+
+	if (numThreads > 1)
+	{
+		workers = new fbtParallelForWorker[numThreads - 1];
+		threads = new fbtThread[numThreads - 1];
+
+		for (int i = 0; i < numThreads - 1; ++i)
+		{
+			workers[i].m_job    = &job;
+			workers[i].m_worker = i + 1;
+			if (!threads[i].start(fbtParallelForThread, &workers[i]))
+				break;
+		}
+	}
+
+	fbtParallelForRun(&job, 0);
+
+	delete [] threads;  // joins
+	delete [] workers;
+}
+
+
+int fbtGetNumThreads(void)
+{
+#if FBT_MAX_THREADS > 0
+	return FBT_MAX_THREADS;
+#elif FBT_PLATFORM == FBT_PLATFORM_WIN32
+	SYSTEM_INFO info;
+	GetSystemInfo(&info);
+	return fbtMax<int>((int)info.dwNumberOfProcessors, 1);
+#else
+	return fbtMax<int>((int)sysconf(_SC_NPROCESSORS_ONLN), 1);
+#endif
+}
+
+#endif
+
+
+// Source File "fbtStreams.cpp"
+//#define FBT_IN_SOURCE
+//#include "fbtStreams.h"
+//#include "fbtPlatformHeaders.h"
+
+
+#if FBT_USE_GZ_FILE == 1
+#include "zlib.h"
+#include "zconf.h"
+#endif
+
+#if FBT_USE_ZSTD_FILE == 1
+#include "zstd.h"
+#endif
+
+fbtFileStream::fbtFileStream() 
+	:    m_file(), m_handle(0), m_mode(0), m_size(0)
+{
+}
+
+
+fbtFileStream::~fbtFileStream()
+{
+	close();
+}
+
+
+
+void fbtFileStream::open(const char* p, fbtStream::StreamMode mode)
+{
+	if (m_handle != 0 && m_file != p)
+		fclose((FILE *)m_handle);
+
+	char fm[3] = {0, 0, 0};
+	char* mp = &fm[0];
+	if (mode & fbtStream::SM_READ)
+		*mp++ = 'r';
+	else if (mode & fbtStream::SM_WRITE)
+		*mp++ = 'w';
+	*mp++ = 'b';
+	fm[2] = 0;
+
+	m_file = p;
+    m_handle = fbtFile::UTF8_fopen(m_file.c_str(), fm);
+
+	if (m_handle && (mode & fbtStream::SM_READ))
+	{
+		FILE *fp = (FILE*)m_handle;
+
+		fbtFseek(fp, 0, SEEK_END);
+		m_size = (FBTsize)fbtFtell(fp);
+		fbtFseek(fp, 0, SEEK_SET);
+	}
+
+
+}
+
+
+void fbtFileStream::open(FILE* fp, fbtStream::StreamMode mode)
+{
+	close();
+
+	m_handle = fp;
+
+	if (m_handle && (mode & fbtStream::SM_READ))
+	{
+		fbtFseek(fp, 0, SEEK_END);
+		m_size = (FBTsize)fbtFtell(fp);
+		fbtFseek(fp, 0, SEEK_SET);
+	}
+}
+
+
+void fbtFileStream::close(void)
+{
+	if (m_handle != 0)
+	{
+		fclose((FILE*)m_handle);
+		m_handle = 0;
+	}
+
+	m_file.clear();
+}
+
+
+bool fbtFileStream::eof(void) const
+{
+	if (!m_handle)
+		return true;
+	return feof((FILE*)m_handle) != 0;
+}
+
+FBTsize fbtFileStream::position(void) const
+{
+	return (FBTsize)fbtFtell((FILE*)m_handle);
+}
+
+
+FBTsize fbtFileStream::size(void) const
+{
+	return m_size;
+}
+
+FBTsize fbtFileStream::seek(FBTint64 off, FBTint32 way)
+{
+	if (!m_handle)
+		return 0;
+
+	fbtFseek((FILE*)m_handle, off, way);
+	return position();
+}
+
+
+FBTsize fbtFileStream::read(void* dest, FBTsize nr) const
+{
+	if (m_mode == fbtStream::SM_WRITE) 
+		return -1;
+
+	if (!dest || !m_handle) 
+		return -1;
+
+	return fread(dest, 1, nr, (FILE *)m_handle);
+}
+
+
+
+FBTsize fbtFileStream::write(const void* src, FBTsize nr)
+{
+	if (m_mode == fbtStream::SM_READ) return -1;
+	if (!src || !m_handle) return -1;
+
+	return fwrite(src, 1, nr, (FILE*)m_handle);
+}
+
+void fbtFileStream::write(fbtMemoryStream &ms) const
+{
+	FILE *fp = (FILE*)m_handle;
+
+	const FBTint64 oldPos = fbtFtell(fp);
+
+	fbtFseek(fp, 0, SEEK_END);
+	const FBTsize len = (FBTsize)fbtFtell(fp);
+	fbtFseek(fp, 0, SEEK_SET);
+
+	ms.reserve(len + 1);
+	ms.m_size = read(ms.m_buffer, len);
+
+	fbtFseek(fp, oldPos, SEEK_SET);
+}
+
+
+FBTsize fbtFileStream::writef(const char* fmt, ...)
+{
+	static char tmp[1024];
+
+	va_list lst;
+	va_start(lst, fmt);
+	int size = fbtp_printf(tmp, 1024, fmt, lst);
+	va_end(lst);
+
+	if (size > 0)
+	{
+		tmp[size] = 0;
+		return write(tmp, size);
+	}
+	return -1;
+
+}
+
+
+#if FBT_USE_MMAP_FILE == 1
+
+fbtMappedFileStream::fbtMappedFileStream()
+	:    m_buffer(0), m_pos(0), m_size(0)
+{
+}
+
+
+fbtMappedFileStream::~fbtMappedFileStream()
+{
+	close();
+}
+
+
+void fbtMappedFileStream::open(const char* path, fbtStream::StreamMode mode)
+{
+	close();
+
+	if (!path || !(mode & fbtStream::SM_READ))
+		return;
+
+#if FBT_PLATFORM == FBT_PLATFORM_WIN32
+	const int pathLen = (int)strlen(path);
+	wchar_t wpath[MAX_PATH+1] = L"";
+	const int wpathLen = pathLen > 0 ? MultiByteToWideChar(CP_UTF8, 0, path, pathLen, wpath, MAX_PATH) : 0;
+	if (wpathLen <= 0 || wpathLen > MAX_PATH)
+		return;
+	wpath[wpathLen] = L'\0';
+
+	HANDLE file = CreateFileW(wpath, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (file == INVALID_HANDLE_VALUE)
+		return;
+
+	LARGE_INTEGER fileSize;
+	if (GetFileSizeEx(file, &fileSize) && fileSize.QuadPart > 0 && (FBTuint64)fileSize.QuadPart == (FBTuint64)(FBTsize)fileSize.QuadPart)
+	{
+		HANDLE mapping = CreateFileMappingW(file, NULL, PAGE_WRITECOPY, 0, 0, NULL);
+		if (mapping)
+		{
+			m_buffer = (char*)MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0);
+			if (m_buffer)
+				m_size = (FBTsize)fileSize.QuadPart;
+			CloseHandle(mapping);   // the view keeps it alive
+		}
+	}
+	CloseHandle(file);
+#else
+	int fd = ::open(path, O_RDONLY);
+	if (fd < 0)
+		return;
+
+	struct stat st;
+	if (fstat(fd, &st) == 0 && st.st_size > 0 && (FBTuint64)st.st_size == (FBTuint64)(FBTsize)st.st_size)
+	{
+		// private: pages are copied only if somebody writes to them
+		void* addr = mmap(0, (size_t)st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+		if (addr != MAP_FAILED)
+		{
+			m_buffer = (char*)addr;
+			m_size   = (FBTsize)st.st_size;
+		}
+	}
+	::close(fd);    // the mapping keeps it alive
+#endif
+}
+
+
+void fbtMappedFileStream::close(void)
+{
+	if (m_buffer)
+	{
+#if FBT_PLATFORM == FBT_PLATFORM_WIN32
+		UnmapViewOfFile(m_buffer);
+#else
+		munmap(m_buffer, m_size);
+#endif
+	}
+	m_buffer = 0;
+	m_pos = m_size = 0;
+}
+
+
+FBTsize fbtMappedFileStream::read(void* dest, FBTsize nr) const
+{
+	if (m_pos > m_size) return 0;
+	if (!dest || !m_buffer) return 0;
+
+	if ((m_size - m_pos) < nr) nr = m_size - m_pos;
+
+	fbtMemcpy(dest, &m_buffer[m_pos], nr);
+	m_pos += nr;
+	return nr;
+}
+
+
+FBTsize fbtMappedFileStream::seek(FBTint64 off, FBTint32 way)
+{
+	if (way == SEEK_SET)
+		m_pos = (FBTsize)fbtClamp<FBTint64>(off, 0, (FBTint64)m_size);
+	else if (way == SEEK_CUR)
+		m_pos = (FBTsize)fbtClamp<FBTint64>((FBTint64)m_pos + off, 0, (FBTint64)m_size);
+	else if (way == SEEK_END)
+		m_pos = m_size;
+	return m_pos;
+}
+
+
+void* fbtMappedFileStream::readInPlace(FBTsize nr) const
+{
+	if (!m_buffer || nr == 0 || m_pos > m_size || (m_size - m_pos) < nr)
+		return 0;
+
+	char* cp = &m_buffer[m_pos];
+	if (((FBTuintPtr)cp) % FBT_IN_PLACE_ALIGNMENT)
+		return 0;
+
+	m_pos += nr;
+	return cp;
+}
+
+#endif // FBT_USE_MMAP_FILE
+
+
+#if FBT_USE_GZ_FILE == 1
+
+fbtGzStream::fbtGzStream() 
+	:    m_file(), m_handle(0), m_mode(0), m_pos(0)
+{
+}
+
+
+fbtGzStream::~fbtGzStream()
+{
+	close();
+}
+
+
+void fbtGzStream::open(const char* p, fbtStream::StreamMode mode)
+{
+	if (m_handle != 0 && m_file != p)
+        gzclose((gzFile) m_handle);
+
+	char fm[3] = {0, 0, 0};
+	char* mp = &fm[0];
+	if (mode & fbtStream::SM_READ)
+		*mp++ = 'r';
+	else if (mode & fbtStream::SM_WRITE)
+		*mp++ = 'w';
+	*mp++ = 'b';
+	fm[2] = 0;
+
+	m_file = p;
+	m_handle = gzopen(m_file.c_str(), fm);
+	m_pos = 0;
+}
+
+
+void fbtGzStream::open(FILE* fp, fbtStream::StreamMode mode)
+{
+	close();
+
+	if (!fp || !(mode & fbtStream::SM_READ))
+	{
+		if (fp)
+			fclose(fp);
+		return;
+	}
+
+	// zlib wants a descriptor: it gets its own one, rewound after fclose() synced the shared offset
+	int fd = dup(fileno(fp));
+	fclose(fp);
+	if (fd < 0)
+		return;
+
+	lseek(fd, 0, SEEK_SET);
+	m_handle = gzdopen(fd, "rb");
+	m_pos = 0;
+	if (!m_handle)
+		::close(fd);
+}
+
+
+void fbtGzStream::close(void)
+{
+	if (m_handle != 0)
+	{
+        gzclose((gzFile)m_handle);
+		m_handle = 0;
+	}
+
+	m_file.clear();
+	m_pos = 0;
+}
+
+
+
+FBTsize fbtGzStream::read(void* dest, FBTsize nr) const
+{
+	if (m_mode == fbtStream::SM_WRITE) return -1;
+	if (!dest || !m_handle) 
+		return -1;
+
+	// gzread() takes an unsigned and returns an int: big reads are split
+	char*   cp   = (char*)dest;
+	FBTsize done = 0;
+	while (done < nr)
+	{
+		const unsigned len = (unsigned)fbtMin<FBTsize>(nr - done, 1 << 30);
+		const int ret = gzread((gzFile)m_handle, cp + done, len);
+		if (ret < 0)
+			return done > 0 ? done : (FBTsize)-1;
+		done += ret;
+		if ((unsigned)ret < len)
+			break;
+	}
+	m_pos += done;
+	return done;
+}
+
+
+FBTsize fbtGzStream::write(const void* src, FBTsize nr)
+{
+	if (m_mode == fbtStream::SM_READ) return -1;
+	if (!src || !m_handle) return -1;
+
+	const char* cp   = (const char*)src;
+	FBTsize     done = 0;
+	while (done < nr)
+	{
+		const unsigned len = (unsigned)fbtMin<FBTsize>(nr - done, 1 << 30);
+		const int ret = gzwrite((gzFile)m_handle, (/*const*/ voidp)(cp + done), len);
+		if (ret <= 0)
+			break;
+		done += ret;
+	}
+	m_pos += done;
+	return done;
+}
+
+
+bool fbtGzStream::eof(void) const
+{
+	if (!m_handle)
+		return true;
+    return gzeof((gzFile)m_handle) != 0;
+}
+
+FBTsize fbtGzStream::position(void) const
+{
+	return m_pos;
+}
+
+FBTsize fbtGzStream::size(void) const
+{
+	return 0;
+}
+
+
+FBTsize fbtGzStream::writef(const char* fmt, ...)
+{
+	static char tmp[1024];
+
+	va_list lst;
+	va_start(lst, fmt);
+	int size = fbtp_printf(tmp, 1024, fmt, lst);
+	va_end(lst);
+
+	if (size > 0)
+	{
+		tmp[size] = 0;
+		return write(tmp, size);
+	}
+	return -1;
+
+}
+
+#endif // FBT_USE_GZ_FILE
+
+
+#if FBT_USE_ZSTD_FILE == 1
+
+fbtZstdStream::fbtZstdStream()
+	:    m_handle(0), m_dctx(0), m_inBuf(0), m_inCapacity(0), m_inSize(0), m_inPos(0),
+	     m_pos(0), m_lastRet(0), m_inEof(false), m_eof(false)
+{
 }
 
-int fbtChunk::write(fbtFile::Chunk* src, fbtStream* stream)
-{	
-	int size = 0;
-	size += stream->write(src, BlockSize);
-	size += stream->write((void*)src->m_old, src->m_len);
-	return size;
+
+fbtZstdStream::~fbtZstdStream()
+{
+	close();
 }
 
-int fbtChunk::read(fbtFile::Chunk* dest, fbtStream* stream, int flags)
+
+void fbtZstdStream::open(const char* path, fbtStream::StreamMode mode)
 {
-	int bytesRead = 0;
-    bool bitsVary   = (flags & fbtFile::FH_VAR_BITS) != 0;
-	bool swapEndian = (flags & fbtFile::FH_ENDIAN_SWAP) != 0;
+	open((mode & fbtStream::SM_READ) ? fbtFile::UTF8_fopen(path, "rb") : (FILE*)0, mode);
+}
 
-	fbtFile::Chunk64 c64;
-	fbtFile::Chunk32 c32;
-	fbtFile::Chunk*  cpy;
 
+void fbtZstdStream::open(FILE* fp, fbtStream::StreamMode mode)
+{
+	close();
 
-	if (FBT_VOID8)
+	if (!fp || !(mode & fbtStream::SM_READ))
 	{
-        // here we must add support for Blender 5.0+ where most lengths are 64 bit and the Chunk64 field order is different than before
-        if (bitsVary)
-		{
-            FBT_ASSERT(BLENDER_VERSION<500); // old format only (TOTEST: ican this happen?)
-			fbtFile::Chunk32 src;
-			if ((bytesRead = stream->read(&src, Block32)) <= 0)
-			{
-				FBT_INVALID_READ;
-				return fbtFile::FS_INV_READ;
-			}
-
-			c64.m_code    = src.m_code;
-			c64.m_len     = src.m_len;
+		if (fp)
+			fclose(fp);
+		return;
+	}
 
-			union
-			{
-				FBTuint64   m_ptr;
-				FBTuint32   m_doublePtr[2];
-			} ptr;
-			ptr.m_doublePtr[0] = src.m_old;
-			ptr.m_doublePtr[1] = 0;
+	fbtFseek(fp, 0, SEEK_SET);
 
-			c64.m_old     = ptr.m_ptr;
-			c64.m_typeid  = src.m_typeid;
-			c64.m_nr      = src.m_nr;
-		}
-		else
-		{
-			if ((bytesRead = stream->read(&c64, BlockSize)) <= 0)
-			{
-				FBT_INVALID_READ;
-				return fbtFile::FS_INV_READ;
-			}
-		}
+	m_dctx       = ZSTD_createDCtx();
+	m_inCapacity = ZSTD_DStreamInSize();
+	m_inBuf      = new char[m_inCapacity];
 
-		if (swapEndian)
-		{
-			if ((c64.m_code & 0xFFFF) == 0)
-				c64.m_code >>= 16;
+	if (!m_dctx)
+	{
+		fclose(fp);
+		close();
+		return;
+	}
+	m_handle = fp;
+}
 
-#           if BLENDER_VERSION<500
-			c64.m_len    = fbtSwap32(c64.m_len);
-			c64.m_nr     = fbtSwap32(c64.m_nr);
-			c64.m_typeid = fbtSwap32(c64.m_typeid);
-#           else
-            c64.m_typeid = fbtSwap32(c64.m_typeid);
-            c64.m_len    = fbtSwap64(c64.m_len);
-            c64.m_nr     = fbtSwap64(c64.m_nr);
-#           endif
-		}
 
-        cpy = (fbtFile::Chunk*)(&c64);
+void fbtZstdStream::close(void)
+{
+	if (m_handle != 0)
+	{
+		fclose((FILE*)m_handle);
+		m_handle = 0;
 	}
-	else
+	if (m_dctx)
 	{
-        FBT_ASSERT(BLENDER_VERSION<500); // old format only
-		if (bitsVary)
-		{
-			fbtFile::Chunk64 src;
-			if ((bytesRead = stream->read(&src, Block64)) <= 0)
-			{
-				FBT_INVALID_READ;
-				return fbtFile::FS_INV_READ;
-			}
+		ZSTD_freeDCtx((ZSTD_DCtx*)m_dctx);
+		m_dctx = 0;
+	}
+	if (m_inBuf)
+	{
+		delete [] m_inBuf;
+		m_inBuf = 0;
+	}
+	m_inCapacity = m_inSize = m_inPos = 0;
+	m_pos = m_lastRet = 0;
+	m_inEof = m_eof = false;
+}
 
-			// copy down
 
-			c32.m_code    = src.m_code;
-			c32.m_len     = src.m_len;
+FBTsize fbtZstdStream::read(void* dest, FBTsize nr) const
+{
+	if (!dest || !m_handle)
+		return -1;
 
-			union
-			{
-				FBTuint64   m_ptr;
-				FBTuint32   m_doublePtr[2];
-			} ptr;
-			ptr.m_doublePtr[0] = 0;
-			ptr.m_doublePtr[1] = 0;
-			ptr.m_ptr = src.m_old;
+	ZSTD_outBuffer output = {dest, nr, 0};
+	ZSTD_inBuffer  input  = {m_inBuf, m_inSize, m_inPos};
 
-			c32.m_old       = ptr.m_doublePtr[0] != 0 ? ptr.m_doublePtr[0] : ptr.m_doublePtr[1];
-			c32.m_typeid    = src.m_typeid;
-			c32.m_nr        = src.m_nr;
-		}
-		else
+	while (output.pos < output.size)
+	{
+		if (input.pos >= input.size && !m_inEof)
 		{
-			if ((bytesRead = stream->read(&c32, BlockSize)) <= 0)
-			{
-				FBT_INVALID_READ;
-				return fbtFile::FS_INV_READ;
-			}
+			input.size = fread(m_inBuf, 1, m_inCapacity, (FILE*)m_handle);
+			input.pos  = 0;
+			m_inEof    = input.size == 0;
 		}
 
-
-		if (swapEndian)
+		const size_t lastOut = output.pos;
+		const size_t ret = ZSTD_decompressStream((ZSTD_DCtx*)m_dctx, &output, &input);
+		if (ZSTD_isError(ret))
 		{
-			if ((c32.m_code & 0xFFFF) == 0)
-				c32.m_code >>= 16;
-
-			c32.m_len    = fbtSwap32(c32.m_len);
-			c32.m_nr     = fbtSwap32(c32.m_nr);
-			c32.m_typeid = fbtSwap32(c32.m_typeid);
+			fbtPrintf("ZSTD_decompressStream(...) Error: %s\n", ZSTD_getErrorName(ret));
+			m_inEof = true;
+			m_lastRet = 0;
+			break;
 		}
+		m_lastRet = ret;
 
-
-
-		cpy = (fbtFile::Chunk*)(&c32);
+		// no more input and nothing left to flush
+		if (m_inEof && input.pos >= input.size && output.pos == lastOut)
+			break;
 	}
 
-	if (cpy->m_len == FBT_NPOS)
+	m_inSize = input.size;
+	m_inPos  = input.pos;
+
+	if (output.pos < output.size)
 	{
-		FBT_INVALID_LEN;
-		return fbtFile::FS_INV_LENGTH;
+		if (m_lastRet != 0 && !m_eof)
+			fbtPrintf("ZSTD_decompressStream(...) Error: EOF before end of stream: %zu\n", (size_t)m_lastRet);
+		m_eof = true;
 	}
 
-	fbtMemcpy(dest, cpy, BlockSize);
-	return bytesRead;
+	m_pos += output.pos;
+	return output.pos;
 }
 
 
-// Source File "fbtStreams.cpp"
-//#define FBT_IN_SOURCE
-//#include "fbtStreams.h"
-//#include "fbtPlatformHeaders.h"
-
-
-#if FBT_USE_GZ_FILE == 1
-#include "zlib.h"
-#include "zconf.h"
-#endif
+static FBTuint32 fbtReadLE32(const unsigned char* cp)
+{
+	return (FBTuint32)cp[0] | ((FBTuint32)cp[1] << 8) | ((FBTuint32)cp[2] << 16) | ((FBTuint32)cp[3] << 24);
+}
 
-#if FBT_USE_ZSTD_FILE == 1
-#include "zstd.h"
-#endif
 
-fbtFileStream::fbtFileStream() 
-	:    m_file(), m_handle(0), m_mode(0), m_size(0)
+fbtZstdSeekableStream::fbtZstdSeekableStream()
+	:    m_handle(0), m_dctx(0), m_size(0), m_pos(0), m_inBuf(0), m_frameBuf(0),
+	     m_inCapacity(0), m_frameCapacity(0), m_frame(FBT_NPOS)
 {
 }
 
 
-fbtFileStream::~fbtFileStream()
+fbtZstdSeekableStream::~fbtZstdSeekableStream()
 {
 	close();
 }
 
 
+void fbtZstdSeekableStream::open(const char* path, fbtStream::StreamMode mode)
+{
+	FILE* fp = (mode & fbtStream::SM_READ) ? fbtFile::UTF8_fopen(path, "rb") : (FILE*)0;
+	if (fp)
+	{
+		open(fp, mode);
+		if (!isOpen())
+			fclose(fp);
+	}
+}
+
 
-void fbtFileStream::open(const char* p, fbtStream::StreamMode mode)
+void fbtZstdSeekableStream::open(FILE* fp, fbtStream::StreamMode mode)
 {
-	if (m_handle != 0 && m_file != p)
-		fclose((FILE *)m_handle);
+	close();
 
-	char fm[3] = {0, 0, 0};
-	char* mp = &fm[0];
-	if (mode & fbtStream::SM_READ)
-		*mp++ = 'r';
-	else if (mode & fbtStream::SM_WRITE)
-		*mp++ = 'w';
-	*mp++ = 'b';
-	fm[2] = 0;
+	if (!fp || !(mode & fbtStream::SM_READ))
+		return;
 
-	m_file = p;
-    m_handle = fbtFile::UTF8_fopen(m_file.c_str(), fm);
+	m_handle = fp;
+	m_dctx   = ZSTD_createDCtx();
 
-	if (m_handle && (mode & fbtStream::SM_READ))
+	if (!m_dctx || !readSeekTable())
 	{
-		FILE *fp = (FILE*)m_handle;
-
-		position();
-		fseek(fp, 0, SEEK_END);
-		m_size = ftell(fp);
-		fseek(fp, 0, SEEK_SET);
+		// the caller keeps the file
+		m_handle = 0;
+		close();
 	}
-
-
 }
 
 
-void fbtFileStream::close(void)
+void fbtZstdSeekableStream::close(void)
 {
 	if (m_handle != 0)
 	{
 		fclose((FILE*)m_handle);
 		m_handle = 0;
 	}
-
-	m_file.clear();
+	if (m_dctx)
+	{
+		ZSTD_freeDCtx((ZSTD_DCtx*)m_dctx);
+		m_dctx = 0;
+	}
+	if (m_inBuf)
+	{
+		delete [] m_inBuf;
+		m_inBuf = 0;
+	}
+	if (m_frameBuf)
+	{
+		delete [] m_frameBuf;
+		m_frameBuf = 0;
+	}
+	m_srcOffsets.clear();
+	m_dstOffsets.clear();
+	m_inCapacity = m_frameCapacity = 0;
+	m_size = m_pos = 0;
+	m_frame = FBT_NPOS;
 }
 
 
-bool fbtFileStream::eof(void) const
+bool fbtZstdSeekableStream::readSeekTable(void)
 {
-	if (!m_handle)
-		return true;
-	return feof((FILE*)m_handle) != 0;
-}
+	// The seek table is a skippable frame (magic 0x184D2A5E) at the end of the file: one entry per frame
+	// (compressed size, decompressed size, optional checksum) followed by a footer made of
+	// Number_Of_Frames (4 bytes), Seek_Table_Descriptor (1 byte) and the magic number 0x8F92EAB1.
+	FILE* fp = (FILE*)m_handle;
+	unsigned char footer[9];
 
-FBTsize fbtFileStream::position(void) const
-{
-	return ftell((FILE*)m_handle);
-}
+	if (fbtFseek(fp, 0, SEEK_END) != 0)
+		return false;
+	const FBTint64 fileSize = fbtFtell(fp);
+	if (fileSize < 17 || (FBTint64)(FBTsize)fileSize != fileSize ||
+	    fbtFseek(fp, fileSize - 9, SEEK_SET) != 0 || fread(footer, 1, 9, fp) != 9)
+		return false;
+	if (fbtReadLE32(footer + 5) != 0x8F92EAB1 || (footer[4] & 0x7C) != 0)
+		return false;
 
+	const FBTsize numFrames = fbtReadLE32(footer);
+	const FBTsize entrySize = (footer[4] & 0x80) ? 12 : 8;
+	if (numFrames == 0 || numFrames >= FBT_NPOS || numFrames > (FBTsize)fileSize / entrySize)
+		return false;
 
-FBTsize fbtFileStream::size(void) const
-{
-	return m_size;
+	const FBTsize frameSize = numFrames * entrySize + 9;
+	if ((FBTsize)fileSize < frameSize + 8)
+		return false;
+	const FBTsize tableStart = (FBTsize)fileSize - frameSize - 8;
+
+	unsigned char* table = new unsigned char[frameSize + 8];
+	bool ok = fbtFseek(fp, (FBTint64)tableStart, SEEK_SET) == 0 && fread(table, 1, frameSize + 8, fp) == frameSize + 8 &&
+	          fbtReadLE32(table) == 0x184D2A5E && fbtReadLE32(table + 4) == frameSize;
+
+	if (ok)
+	{
+		m_srcOffsets.reserve((FBTsizeType)numFrames + 1);
+		m_dstOffsets.reserve((FBTsizeType)numFrames + 1);
+
+		FBTuint64 src = 0, dst = 0;
+		const unsigned char* entry = table + 8;
+		for (FBTsize i = 0; i < numFrames; ++i, entry += entrySize)
+		{
+			m_srcOffsets.push_back((FBTsize)src);
+			m_dstOffsets.push_back((FBTsize)dst);
+			src += fbtReadLE32(entry);
+			dst += fbtReadLE32(entry + 4);
+		}
+		m_srcOffsets.push_back((FBTsize)src);
+		m_dstOffsets.push_back((FBTsize)dst);
+
+		// the frames must fill the file up to the seek table
+		ok = src == tableStart && dst == (FBTsize)dst;
+		m_size = (FBTsize)dst;
+	}
+	delete [] table;
+
+	if (!ok)
+	{
+		m_srcOffsets.clear();
+		m_dstOffsets.clear();
+		m_size = 0;
+	}
+	return ok;
 }
 
-FBTsize fbtFileStream::seek(FBTint32 off, FBTint32 way)
+
+bool fbtZstdSeekableStream::loadFrame(FBTsizeType frame) const
 {
-	if (!m_handle)
-		return 0;
+	const FBTsize srcSize = m_srcOffsets[frame + 1] - m_srcOffsets[frame];
+	const FBTsize dstSize = m_dstOffsets[frame + 1] - m_dstOffsets[frame];
+
+	m_frame = FBT_NPOS;
+
+	if (m_inCapacity < srcSize)
+	{
+		delete [] m_inBuf;
+		m_inBuf      = new char[srcSize];
+		m_inCapacity = srcSize;
+	}
+	if (m_frameCapacity < dstSize)
+	{
+		delete [] m_frameBuf;
+		m_frameBuf      = new char[dstSize];
+		m_frameCapacity = dstSize;
+	}
+
+	FILE* fp = (FILE*)m_handle;
+	if (fbtFseek(fp, (FBTint64)m_srcOffsets[frame], SEEK_SET) != 0 || fread(m_inBuf, 1, srcSize, fp) != srcSize)
+	{
+		FBT_INVALID_READ;
+		return false;
+	}
+
+	const size_t ret = ZSTD_decompressDCtx((ZSTD_DCtx*)m_dctx, m_frameBuf, dstSize, m_inBuf, srcSize);
+	if (ZSTD_isError(ret) || ret != dstSize)
+	{
+		fbtPrintf("ZSTD_decompressDCtx(...) Error: %s\n", ZSTD_isError(ret) ? ZSTD_getErrorName(ret) : "frame size mismatch");
+		return false;
+	}
 
-	return fseek((FILE*)m_handle, off, way);
+	m_frame = frame;
+	return true;
 }
 
 
-FBTsize fbtFileStream::read(void* dest, FBTsize nr) const
+FBTsize fbtZstdSeekableStream::read(void* dest, FBTsize nr) const
 {
-	if (m_mode == fbtStream::SM_WRITE) 
+	if (!dest || !m_handle)
 		return -1;
 
-	if (!dest || !m_handle) 
-		return -1;
+	char*   cp   = (char*)dest;
+	FBTsize done = 0;
 
-	return fread(dest, 1, nr, (FILE *)m_handle);
-}
+	while (done < nr && m_pos < m_size)
+	{
+		FBTsizeType frame = m_frame;
+		if (frame == FBT_NPOS || m_pos < m_dstOffsets[frame] || m_pos >= m_dstOffsets[frame + 1])
+		{
+			// the last frame starting at or before m_pos (empty frames are skipped this way)
+			FBTsizeType lo = 0, hi = m_dstOffsets.size() - 1;
+			while (hi - lo > 1)
+			{
+				const FBTsizeType mid = lo + (hi - lo) / 2;
+				if (m_dstOffsets[mid] <= m_pos)
+					lo = mid;
+				else
+					hi = mid;
+			}
+			frame = lo;
+
+			if (!loadFrame(frame))
+				break;
+		}
 
+		const FBTsize len = fbtMin<FBTsize>(nr - done, m_dstOffsets[frame + 1] - m_pos);
+		fbtMemcpy(cp + done, m_frameBuf + (m_pos - m_dstOffsets[frame]), len);
+		done  += len;
+		m_pos += len;
+	}
+	return done;
+}
 
 
-FBTsize fbtFileStream::write(const void* src, FBTsize nr)
+FBTsize fbtZstdSeekableStream::seek(FBTint64 off, FBTint32 way)
 {
-	if (m_mode == fbtStream::SM_READ) return -1;
-	if (!src || !m_handle) return -1;
-
-	return fwrite(src, 1, nr, (FILE*)m_handle);
+	if (way == SEEK_SET)
+		m_pos = (FBTsize)fbtClamp<FBTint64>(off, 0, (FBTint64)m_size);
+	else if (way == SEEK_CUR)
+		m_pos = (FBTsize)fbtClamp<FBTint64>((FBTint64)m_pos + off, 0, (FBTint64)m_size);
+	else if (way == SEEK_END)
+		m_pos = m_size;
+	return m_pos;
 }
 
-void fbtFileStream::write(fbtMemoryStream &ms) const
-{
-	FILE *fp = (FILE*)m_handle;
+#endif // FBT_USE_ZSTD_FILE
 
-	int oldPos = ftell(fp);
 
-	fseek(fp, 0, SEEK_END);
-	int len = ftell(fp);
-	fseek(fp, 0, SEEK_SET);
+#if FBT_USE_THREADS == 1
 
-	ms.reserve(len + 1);
-	ms.m_size = read(ms.m_buffer, len);
+struct fbtReadAheadState
+{
+	fbtReadAheadState(int numBuffers)
+		:    m_source(0), m_buffers(0), m_sizes(0), m_bufferSize(0), m_numBuffers(numBuffers),
+		     m_free(numBuffers), m_filled(0), m_stop(false), m_slot(-1), m_offset(0), m_end(false)
+	{
+	}
 
-	fseek(fp, oldPos, SEEK_SET);
-}
+	bool stopping(void)
+	{
+		m_mutex.lock();
+		const bool stop = m_stop;
+		m_mutex.unlock();
+		return stop;
+	}
 
+	static void produce(void* arg);
+
+	fbtStream*      m_source;
+	char*           m_buffers;
+	FBTsize*        m_sizes;        // bytes in each buffer: a short one is the last
+	FBTsize         m_bufferSize;
+	int             m_numBuffers;
+	fbtSemaphore    m_free, m_filled;
+	fbtMutex        m_mutex;        // guards m_stop
+	bool            m_stop;
+	fbtThread       m_thread;
+
+	// consumer side
+	int             m_slot;         // buffer being read (-1 before the first one)
+	FBTsize         m_offset;
+	bool            m_end;
+};
 
-FBTsize fbtFileStream::writef(const char* fmt, ...)
-{
-	static char tmp[1024];
 
-	va_list lst;
-	va_start(lst, fmt);
-	int size = fbtp_printf(tmp, 1024, fmt, lst);
-	va_end(lst);
+void fbtReadAheadState::produce(void* arg)
+{
+	fbtReadAheadState* st = (fbtReadAheadState*)arg;
 
-	if (size > 0)
+	for (int slot = 0; ; slot = (slot + 1) % st->m_numBuffers)
 	{
-		tmp[size] = 0;
-		return write(tmp, size);
-	}
-	return -1;
+		st->m_free.wait();
+		if (st->stopping())
+			break;
 
-}
+		FBTsize nr = st->m_source->read(st->m_buffers + slot * st->m_bufferSize, st->m_bufferSize);
+		if (nr > st->m_bufferSize)  // (FBTsize)-1
+			nr = 0;
+		st->m_sizes[slot] = nr;
+		st->m_filled.post();
 
+		if (nr < st->m_bufferSize)
+			break;
+	}
+}
 
-#if FBT_USE_GZ_FILE == 1
 
-fbtGzStream::fbtGzStream() 
-	:    m_file(), m_handle(0), m_mode(0)
+fbtReadAheadStream::fbtReadAheadStream()
+	:    m_state(0), m_size(0), m_pos(0)
 {
 }
 
 
-fbtGzStream::~fbtGzStream()
+fbtReadAheadStream::~fbtReadAheadStream()
 {
 	close();
 }
 
 
-void fbtGzStream::open(const char* p, fbtStream::StreamMode mode)
+void fbtReadAheadStream::open(fbtStream* source, FBTsize readAheadSize, int numBuffers)
 {
-	if (m_handle != 0 && m_file != p)
-        gzclose((gzFile) m_handle);
+	close();
 
-	char fm[3] = {0, 0, 0};
-	char* mp = &fm[0];
-	if (mode & fbtStream::SM_READ)
-		*mp++ = 'r';
-	else if (mode & fbtStream::SM_WRITE)
-		*mp++ = 'w';
-	*mp++ = 'b';
-	fm[2] = 0;
+	if (!source || !source->isOpen())
+		return;
 
-	m_file = p;
-	m_handle = gzopen(m_file.c_str(), fm);
-}
+	numBuffers = fbtMax(numBuffers, 2);
 
+	fbtReadAheadState* st = new fbtReadAheadState(numBuffers);
+	st->m_source     = source;
+	st->m_bufferSize = fbtMax<FBTsize>(readAheadSize / numBuffers, 4096);
+	st->m_buffers    = new char[st->m_bufferSize * numBuffers];
+	st->m_sizes      = new FBTsize[numBuffers];
 
-void fbtGzStream::close(void)
-{
-	if (m_handle != 0)
+	m_size = source->size();    // before the worker starts using it
+	m_pos  = 0;
+
+	if (!st->m_thread.start(fbtReadAheadState::produce, st))
 	{
-        gzclose((gzFile)m_handle);
-		m_handle = 0;
+		// the caller keeps the source
+		delete [] st->m_buffers;
+		delete [] st->m_sizes;
+		delete st;
+		m_size = 0;
+		return;
 	}
-
-	m_file.clear();
+	m_state = st;
 }
 
 
-
-FBTsize fbtGzStream::read(void* dest, FBTsize nr) const
+void fbtReadAheadStream::close(void)
 {
-	if (m_mode == fbtStream::SM_WRITE) return -1;
-	if (!dest || !m_handle) 
-		return -1;
+	fbtReadAheadState* st = m_state;
+	if (st)
+	{
+		st->m_mutex.lock();
+		st->m_stop = true;
+		st->m_mutex.unlock();
+		st->m_free.post();      // in case the worker is waiting for a buffer
+		st->m_thread.join();
 
-    return gzread((gzFile)m_handle, dest, nr);
+		delete st->m_source;
+		delete [] st->m_buffers;
+		delete [] st->m_sizes;
+		delete st;
+		m_state = 0;
+	}
+	m_size = m_pos = 0;
 }
 
 
-FBTsize fbtGzStream::write(const void* src, FBTsize nr)
+bool fbtReadAheadStream::eof(void) const
 {
-	if (m_mode == fbtStream::SM_READ) return -1;
-	if (!src || !m_handle) return -1;
-    return gzwrite((gzFile)m_handle,(/*const*/ voidp) src, nr);
+	const fbtReadAheadState* st = m_state;
+	if (!st || st->m_end)
+		return true;
+	return st->m_slot >= 0 && st->m_sizes[st->m_slot] < st->m_bufferSize && st->m_offset >= st->m_sizes[st->m_slot];
 }
 
 
-bool fbtGzStream::eof(void) const
+FBTsize fbtReadAheadStream::read(void* dest, FBTsize nr) const
 {
-	if (!m_handle)
-		return true;
-    return gzeof((gzFile)m_handle) != 0;
-}
+	fbtReadAheadState* st = m_state;
+	if (!dest || !st)
+		return -1;
 
-FBTsize fbtGzStream::position(void) const
-{
-    return gztell((gzFile)m_handle);
-}
+	char*   cp   = (char*)dest;
+	FBTsize done = 0;
 
-FBTsize fbtGzStream::size(void) const
-{
-	return 0;
+	while (done < nr)
+	{
+		if (st->m_slot < 0 || st->m_offset >= st->m_sizes[st->m_slot])
+		{
+			if (st->m_end)
+				break;
+			if (st->m_slot >= 0)
+			{
+				if (st->m_sizes[st->m_slot] < st->m_bufferSize)
+				{
+					st->m_end = true;
+					break;
+				}
+				st->m_free.post();
+			}
+
+			st->m_filled.wait();
+			st->m_slot   = (st->m_slot + 1) % st->m_numBuffers;
+			st->m_offset = 0;
+			continue;
+		}
+
+		const FBTsize len = fbtMin<FBTsize>(nr - done, st->m_sizes[st->m_slot] - st->m_offset);
+		fbtMemcpy(cp + done, st->m_buffers + st->m_slot * st->m_bufferSize + st->m_offset, len);
+		st->m_offset += len;
+		done         += len;
+	}
+
+	m_pos += done;
+	return done;
 }
 
 
-FBTsize fbtGzStream::writef(const char* fmt, ...)
+FBTsize fbtReadAheadStream::seek(FBTint64 off, FBTint32 way)
 {
-	static char tmp[1024];
+	fbtReadAheadState* st = m_state;
+	if (!st)
+		return 0;
 
-	va_list lst;
-	va_start(lst, fmt);
-	int size = fbtp_printf(tmp, 1024, fmt, lst);
-	va_end(lst);
+	if (way == SEEK_SET)
+		off -= (FBTint64)m_pos;
+	else if (way != SEEK_CUR)
+		return m_pos;
 
-	if (size > 0)
+	if (off <= 0 && (FBTuint64)(-off) <= (FBTuint64)st->m_offset)
 	{
-		tmp[size] = 0;
-		return write(tmp, size);
+		st->m_offset -= (FBTsize)(-off);
+		m_pos        -= (FBTsize)(-off);
 	}
-	return -1;
-
+	return m_pos;
 }
 
-#endif // FBT_USE_GZ_FILE
+#endif // FBT_USE_THREADS
 
 
 fbtMemoryStream::fbtMemoryStream()
-	:   m_buffer(0), m_pos(0), m_size(0), m_capacity(0), m_mode(0)
+	:   m_buffer(0), m_pos(0), m_size(0), m_capacity(0), m_mode(0), m_borrowed(false)
 {
 }
 
@@ -4011,7 +7354,7 @@ void fbtMemoryStream::open(const fbtFileStream& fs, fbtStream::StreamMode mode)
 }
 
 
-void fbtMemoryStream::open(const void* buffer, FBTsize size, fbtStream::StreamMode mode, bool compressed)
+void fbtMemoryStream::open(const void* buffer, FBTsize size, fbtStream::StreamMode mode, bool compressed, bool borrow)
 {
 	if (buffer && size > 0 && size != FBT_NPOS)
 	{
@@ -4019,7 +7362,16 @@ void fbtMemoryStream::open(const void* buffer, FBTsize size, fbtStream::StreamMo
 		m_pos  = 0;
 
 
-		if (!compressed)
+		if (!compressed && borrow)
+		{
+			if (m_buffer && !m_borrowed)
+				delete [] m_buffer;
+
+			m_buffer   = (char*)buffer;
+			m_size     = m_capacity = size;
+			m_borrowed = true;
+
+		} else if (!compressed)
 		{
 			m_size = size;
 			reserve(m_size);
@@ -4027,22 +7379,15 @@ void fbtMemoryStream::open(const void* buffer, FBTsize size, fbtStream::StreamMo
 
 		} else
 		{
-		    bool result = false;
-#           if BLENDER_VERSION >= 300
-#               if FBT_USE_ZSTD_FILE == 1
-                if (!result) result = zstdInflate((char*)buffer,size);
-#               endif
-#               if FBT_USE_GZ_FILE == 1
-                if (!result) result = gzipInflate((char*)buffer,size);
-#               endif
-#           else //BLENDER_VERSION    		    
-#               if FBT_USE_GZ_FILE == 1
-                if (!result) result = gzipInflate((char*)buffer,size);
-#               endif
-#               if FBT_USE_ZSTD_FILE == 1
-                if (!result) result = zstdInflate((char*)buffer,size);
-#               endif
-#           endif //BLENDER_VERSION
+		    // no trial and error: the magic bytes tell the decoder
+		    const int compression = fbtFile::GetFileCompression(buffer,size,0);
+#           if FBT_USE_ZSTD_FILE == 1
+            if (compression==fbtFile::FC_ZSTD) zstdInflate((char*)buffer,size);
+#           endif
+#           if FBT_USE_GZ_FILE == 1
+            if (compression==fbtFile::FC_GZIP) gzipInflate((char*)buffer,size);
+#           endif
+            (void)compression;
 		}
 
 	}
@@ -4051,127 +7396,207 @@ void fbtMemoryStream::open(const void* buffer, FBTsize size, fbtStream::StreamMo
 #if FBT_USE_GZ_FILE == 1
 // this method was adapted from this snippet:
 // http://windrealm.org/tutorials/decompress-gzip-stream.php
-bool fbtMemoryStream::gzipInflate( char* inBuf, int inSize) {
+bool fbtMemoryStream::gzipInflate( char* inBuf, FBTsize inSize) {
   // 'inBuf' is the whole compressed stream, of compressed size 'inSize'
-  if (m_buffer)
+  if (m_buffer && !m_borrowed)
 	  delete [] m_buffer;
+  m_buffer = 0;
+  m_borrowed = false;
   m_size = m_capacity = 0;
+  if (inSize == 0) return false;
+
+  // The last 4 bytes of a gzip stream (ISIZE) are the uncompressed size modulo 2^32: for the single member
+  // files Blender writes it's exact, so the whole output is inflated into one allocation.
+  // A value beyond deflate's maximum ratio (~1032:1) can't be genuine and is ignored.
+  FBTsize hint = 0;
+  if (inSize >= 18)
+  {
+    const unsigned char* isize = (const unsigned char*) inBuf + inSize - 4;
+    hint = (FBTsize) isize[0] | ((FBTsize) isize[1] << 8) | ((FBTsize) isize[2] << 16) | ((FBTsize) isize[3] << 24);
+    if (hint / 1032 > inSize) hint = 0;
+  }
+  reserve(hint > 0 ? hint : inSize * 4);
 
-  reserve(m_capacity+inSize);
+  // zlib counts in (32 bit) uInt/uLong: the buffers are handed out in slices, and positions are tracked here
+  const FBTsize maxSlice = 1 << 30;
+  FBTsize inPos = 0, outPos = 0;
 
   z_stream strm;
   strm.next_in = (Bytef *) inBuf;
-  strm.avail_in = inSize ;
+  strm.avail_in = 0;
   strm.total_out = 0;
   strm.zalloc = Z_NULL;
   strm.zfree = Z_NULL;
+  strm.opaque = Z_NULL;
 
   bool done = false;
 
   if (inflateInit2(&strm, (16+MAX_WBITS)) != Z_OK) {
-    free( m_buffer );
+    delete [] m_buffer;
+    m_buffer = 0;
+    m_size = m_capacity = 0;
     return false;
   }
 
   while (!done) {
-    // If our output buffer is too small
-    if (strm.total_out >= m_capacity ) {
-      // Increase size of output buffer
-      reserve(m_capacity+(inSize/2));
+    // If our output buffer is too small (the hint was wrong or missing), grow it geometrically
+    if (outPos >= m_capacity ) {
+      m_size = outPos;  // so that reserve() keeps what has been inflated so far
+      reserve(m_capacity*2);
     }
 
-    strm.next_out = (Bytef *) (m_buffer + strm.total_out);
-    strm.avail_out = m_capacity - strm.total_out;
+    if (strm.avail_in == 0 && inPos < inSize) {
+      strm.next_in = (Bytef *) (inBuf + inPos);
+      strm.avail_in = (uInt) fbtMin<FBTsize>(inSize - inPos, maxSlice);
+      inPos += strm.avail_in;
+    }
+    strm.next_out = (Bytef *) (m_buffer + outPos);
+    strm.avail_out = (uInt) fbtMin<FBTsize>(m_capacity - outPos, maxSlice);
+    const uInt availOut = strm.avail_out;
 
     // Inflate another chunk.
     int err = inflate (&strm, Z_SYNC_FLUSH);
+    outPos += availOut - strm.avail_out;
     if (err == Z_STREAM_END) done = true;
     else if (err != Z_OK)  {
+      fbtPrintf("inflate(...) Error: %s\n", strm.msg ? strm.msg : "truncated or corrupted stream");
       break;
     }
   }
 
-  if (inflateEnd (&strm) != Z_OK) {
-    if (m_buffer)   delete [] m_buffer;
+  if (inflateEnd (&strm) != Z_OK) done = false;
+
+  if (!done) {
+    delete [] m_buffer;
+    m_buffer = 0;
     m_size = m_capacity = 0;
     return false;
   }
-  else {
-    m_size = strm.total_out;
-    shrinkToFit();
-    done = true;
-  }
 
-  return done;
+  m_size = outPos;
+  if (m_size != hint) shrinkToFit();  // an exact hint leaves nothing to trim
+  return true;
 }
 #endif
 
 #if FBT_USE_ZSTD_FILE == 1
-bool fbtMemoryStream::zstdInflate(char* inBuf, int inSize) {
+#if FBT_USE_THREADS == 1
+// Blender writes zstd files as a sequence of independent frames: when all of them store their content size,
+// each one has a known place in the output buffer and they're decompressed in parallel.
+struct fbtZstdFrame
+{
+    const unsigned char* m_src;
+    size_t               m_srcSize;
+    FBTsize              m_dstOffset;
+    FBTsize              m_dstSize;
+    size_t               m_result;
+};
+
+struct fbtZstdFrameJob
+{
+    fbtZstdFrame* m_frames;
+    char*         m_dst;
+    ZSTD_DCtx**   m_dctx;   // one per worker
+};
+
+static void fbtZstdDecompressFrame(void* userData, FBTsize index, int worker)
+{
+    fbtZstdFrameJob* job = (fbtZstdFrameJob*) userData;
+    fbtZstdFrame& frame = job->m_frames[index];
+    ZSTD_DCtx*& dctx = job->m_dctx[worker];
+    if (!dctx) dctx = ZSTD_createDCtx();
+    frame.m_result = dctx ? ZSTD_decompressDCtx(dctx, job->m_dst + frame.m_dstOffset, frame.m_dstSize, frame.m_src, frame.m_srcSize)
+                          : (size_t) -1;
+}
+#endif
+
+bool fbtMemoryStream::zstdInflate(char* inBuf, FBTsize inSize) {
     // 'inBuf' is the whole compressed stream, of compressed size 'inSize'  
-    if ( inSize == 0 ) {
-          m_buffer = inBuf;
-          return true;
-    }
-    if (m_buffer)	  delete [] m_buffer;
+    if (m_buffer && !m_borrowed)	  delete [] m_buffer;
+    m_buffer = 0;
+    m_borrowed = false;
     m_size = m_capacity = 0;
+    if (inSize == 0) return false;
     
     const unsigned char* memoryBuffer = (const unsigned char*) inBuf;
     const size_t memoryBufferSize = (size_t) inSize;
   
-    // FIll m_size, m_capacity and m_buffer from memoryBuffer and memoryBufferSize.
-  
+    // Frame headers normally store their content size (skippable frames count as 0): their sum is the exact
+    // output size, so the whole file is decompressed into one allocation. If a frame lacks it, or the total
+    // looks implausible (> 1024:1), the output buffer just grows geometrically instead.
+    unsigned long long hint = 0;
+#   if FBT_USE_THREADS == 1
+    fbtArray<fbtZstdFrame> frames;
+#   endif
+    for (size_t off = 0; off < memoryBufferSize; )  {
+        const size_t frameSize = ZSTD_findFrameCompressedSize(memoryBuffer+off, memoryBufferSize-off);
+        const unsigned long long contentSize = ZSTD_isError(frameSize) ? ZSTD_CONTENTSIZE_ERROR :
+                                               ZSTD_getFrameContentSize(memoryBuffer+off, memoryBufferSize-off);
+        if (contentSize == ZSTD_CONTENTSIZE_UNKNOWN || contentSize == ZSTD_CONTENTSIZE_ERROR) {hint = 0;break;}
+#       if FBT_USE_THREADS == 1
+        if (contentSize > 0)    {
+            fbtZstdFrame frame = {memoryBuffer+off, frameSize, (FBTsize) hint, (FBTsize) contentSize, 0};
+            frames.push_back(frame);
+        }
+#       endif
+        hint+=contentSize;
+        off+=frameSize;
+    }
+    if (hint / 1024 > (unsigned long long) memoryBufferSize || hint != (FBTsize) hint) hint = 0;
+    reserve(hint > 0 ? (FBTsize) hint : inSize * 4);   // initial capacity
+
+#   if FBT_USE_THREADS == 1
+    const int numThreads = hint > 0 ? (int) fbtMin<FBTsize>((FBTsize) fbtGetNumThreads(), frames.size()) : 1;
+    if (numThreads > 1)    {
+        ZSTD_DCtx** dctx = (ZSTD_DCtx**) fbtCalloc(numThreads, sizeof(ZSTD_DCtx*));
+        fbtZstdFrameJob job = {frames.ptr(), m_buffer, dctx};
+        if (dctx) fbtParallelFor(frames.size(), numThreads, fbtZstdDecompressFrame, &job);
+
+        bool failure = !dctx;
+        for (FBTsizeType i = 0; i < frames.size() && !failure; i++)  {
+            const size_t ret = frames[i].m_result;
+            if (ZSTD_isError(ret) || ret != frames[i].m_dstSize)  {
+                fbtPrintf("ZSTD_decompressDCtx(...) Error: %s\n", ZSTD_isError(ret) ? ZSTD_getErrorName(ret) : "frame content size mismatch");
+                failure = true;
+            }
+        }
+        for (int i = 0; dctx && i < numThreads; i++) ZSTD_freeDCtx(dctx[i]);
+        if (dctx) fbtFree(dctx);
+
+        if (failure) {
+            delete [] m_buffer;
+            m_buffer = 0;
+            m_size = m_capacity = 0;
+            return false;
+        }
+        m_size = (FBTsize) hint;
+        return true;
+    }
+#   endif
+
     ZSTD_DCtx* dctx = ZSTD_createDCtx();
-    const size_t capacityStepMultiplier = 4;   
-    
-    // input buffer
-    const size_t minInputSizeStep = ZSTD_DStreamInSize();
-    const size_t inputSizeStep = minInputSizeStep*capacityStepMultiplier;
-    ZSTD_inBuffer input = { memoryBuffer, 0, 0 };
-    input.size = inputSizeStep<=memoryBufferSize?inputSizeStep:memoryBufferSize;
-    
-    // output buffer
-    const size_t minOutputCapacityStep = ZSTD_DStreamOutSize();
-    const size_t outputCapacityStep = minOutputCapacityStep*capacityStepMultiplier;
-    reserve(memoryBufferSize*3);   // initial capacity
+    ZSTD_inBuffer input = { memoryBuffer, memoryBufferSize, 0 };
     ZSTD_outBuffer output = {m_buffer, m_capacity, 0 };
     
     size_t lastRet = 0;
     int failure = 0;
     
-    //size_t last_input_pos = 1;    // optional loop lock prevention [line 1/3]
-    //size_t num_reallocs = 0, num_decompression_calls = 0;   // optional debug [line 1/4]
-    while (input.pos < memoryBufferSize) {
-        //if (lastRet==0 && last_input_pos==input.pos) break;    // optional loop lock prevention [line 2/3]
-        if (input.size<memoryBufferSize && input.size-input.pos<minInputSizeStep)    {
-            input.size+=inputSizeStep;
-            if (input.size>memoryBufferSize) input.size=memoryBufferSize;
+    while (input.pos < input.size) {
+        if (output.pos == output.size)    {
+            m_size = output.pos;    // so that reserve() keeps what has been decompressed so far
+            reserve(m_capacity*2);  // grow strategy
+            output.dst=m_buffer;output.size=m_capacity; // output.pos unchanged
         }
         size_t const ret = ZSTD_decompressStream(dctx, &output , &input);
-        //++num_decompression_calls;   // optional debug [line 2/4]
         if (ZSTD_isError(ret))    {
             fbtPrintf("ZSTD_decompressStream(...) Error: %s\n",ZSTD_getErrorName(ret));
             failure = 1;break;
         }
-        else {
-            m_size=output.pos;
-            if (input.pos < input.size) {
-                if (output.size-output.pos<=outputCapacityStep)    {
-                    reserve(m_capacity+minOutputCapacityStep+m_capacity/4);     // grow strategy               
-                    //++num_reallocs;   // optional debug [line 3/4]
-                    output.dst=m_buffer;output.size=m_capacity; // output.pos unchanged           
-                }
-            }
-                
-            //fbtPrintf("output: %zu/%zu. input: %zu/%zu.\n",output.pos,output.size,input.pos,input.size);
-        }    
         lastRet = ret;
     }
-  
-    //fbtPrintf("num_reallocs: %zu. num_decompression_calls: %zu.\n",num_reallocs,num_decompression_calls);   // optional debug [line 4/4]
-        
+    m_size = output.pos;
 
-    if (lastRet != 0) {
+    if (!failure && lastRet != 0) {
         /* The last return value from ZSTD_decompressStream did not end on a
          * frame, but we reached the end of the file! We assume this is an
          * error, and the input was truncated.
@@ -4180,10 +7605,11 @@ bool fbtMemoryStream::zstdInflate(char* inBuf, int inSize) {
         failure = 1;
     }  
     if (failure) {
-      if (m_buffer) delete [] m_buffer;
+      delete [] m_buffer;
+      m_buffer = 0;
       m_size = m_capacity = 0;    
     }          
-    else shrinkToFit();
+    else if (m_size != hint) shrinkToFit();  // an exact hint leaves nothing to trim
     
     ZSTD_freeDCtx(dctx);dctx=NULL;  
     return !failure;
@@ -4193,7 +7619,7 @@ bool fbtMemoryStream::zstdInflate(char* inBuf, int inSize) {
 
 fbtMemoryStream::~fbtMemoryStream()
 {
-	if (m_buffer != 0 )
+	if (m_buffer != 0 && !m_borrowed)
 	{
 		delete []m_buffer;
 	}
@@ -4207,17 +7633,24 @@ fbtMemoryStream::~fbtMemoryStream()
 void fbtMemoryStream::clear(void)
 {
 	m_size = m_pos = 0;
-	if (m_buffer)
+	if (m_borrowed)
+	{
+		// just forget it
+		m_buffer   = 0;
+		m_capacity = 0;
+		m_borrowed = false;
+	}
+	else if (m_buffer)
 		m_buffer[0] = 0;
 }
 
 
-FBTsize fbtMemoryStream::seek(FBTint32 off, FBTint32 way)
+FBTsize fbtMemoryStream::seek(FBTint64 off, FBTint32 way)
 {
 	if (way == SEEK_SET)
-		m_pos = fbtClamp<FBTsize>(off, 0, m_size);
+		m_pos = (FBTsize)fbtClamp<FBTint64>(off, 0, (FBTint64)m_size);
 	else if (way == SEEK_CUR)
-		m_pos = fbtClamp<FBTsize>(m_pos + off, 0, m_size);
+		m_pos = (FBTsize)fbtClamp<FBTint64>((FBTint64)m_pos + off, 0, (FBTint64)m_size);
 	else if (way == SEEK_END)
 		m_pos = m_size;
 	return m_pos;
@@ -4241,6 +7674,21 @@ FBTsize fbtMemoryStream::read(void* dest, FBTsize nr) const
 }
 
 
+void* fbtMemoryStream::readInPlace(FBTsize nr) const
+{
+	if (m_mode == fbtStream::SM_WRITE) return 0;
+	if (!m_buffer || nr == 0 || m_pos > m_size || (m_size - m_pos) < nr)
+		return 0;
+
+	char* cp = &m_buffer[m_pos];
+	if (((FBTuintPtr)cp) % FBT_IN_PLACE_ALIGNMENT)
+		return 0;
+
+	m_pos += nr;
+	return cp;
+}
+
+
 
 FBTsize fbtMemoryStream::write(const void* src, FBTsize nr)
 {
@@ -4251,7 +7699,7 @@ FBTsize fbtMemoryStream::write(const void* src, FBTsize nr)
 
 	if (m_buffer == 0)
 		reserve(m_pos + (nr));
-	else if (m_pos + nr > m_capacity)
+	else if (m_pos + nr > m_capacity || m_borrowed)
 		reserve(m_pos + (nr > 65535 ? nr : nr + 65535));
 
 	char* cp = &m_buffer[m_pos];
@@ -4285,18 +7733,24 @@ FBTsize fbtMemoryStream::writef(const char* fmt, ...)
 }
 void fbtMemoryStream::reserve(FBTsize nr)
 {
-	if (m_capacity < nr)
+	if (m_capacity < nr || m_borrowed)
 	{
+		// a borrowed buffer is detached into a private copy (of all of it)
+		if (nr < m_size)
+			nr = m_size;
+
 		char* buf = new char[nr + 1];
 		if (m_buffer != 0)
 		{
 			fbtMemcpy(buf, m_buffer, m_size);
-			delete [] m_buffer;
+			if (!m_borrowed)
+				delete [] m_buffer;
 		}
 
 		m_buffer = buf;
 		m_buffer[m_size] = 0;
 		m_capacity = nr;
+		m_borrowed = false;
 	}
 }
 void fbtMemoryStream::shrinkToFit()
@@ -4385,7 +7839,7 @@ bool fbtBinTables::read(bool swap)
 }
 
 
-bool fbtBinTables::read(const void* ptr, const FBTsize& /*len*/, bool swap)
+bool fbtBinTables::read(const void* ptr, const FBTsize& len, bool swap, const FBTuint32* compiled, FBTsize compiledLen)
 {
 	FBTuint32* ip = 0, i, j, k, nl;
 	FBTtype* tp = 0;
@@ -4633,7 +8087,8 @@ bool fbtBinTables::read(const void* ptr, const FBTsize& /*len*/, bool swap)
 		return false;
 	}
 
-	compile();
+	if (!compiled || !load(compiled, compiledLen, len))
+		compile();
 	return true;
 }
 
@@ -4704,24 +8159,9 @@ void fbtBinTables::compile(void)
 	{
 		FBTtype* strc = m_strc[i];
 
-		FBTtype strcType = strc[0];
-
 		depth = 0;
 		cof = 0;
-		fbtStruct* off = new fbtStruct;
-		off->m_key.k16[0] = strcType;
-		off->m_key.k16[1] = 0;
-		off->m_val.k32[0] = m_type[strcType].m_typeId;
-		off->m_val.k32[1] = 0; // no name
-		off->m_nr         = 0;
-		off->m_dp         = 0;
-		off->m_off        = cof;
-		off->m_len        = m_tlen[strcType];
-		off->m_strcId     = i;
-		off->m_link       = 0;
-		off->m_flag       = fbtStruct::CAN_LINK;
-
-		m_offs.push_back(off);
+		fbtStruct* off = putStruct(i);
 
 		memberCount = strc[1];
 
@@ -4750,6 +8190,110 @@ void fbtBinTables::compile(void)
 	}
 }
 
+bool fbtBinTables::load(const FBTuint32* compiled, FBTsize compiledLen, FBTsize len)
+{
+	// compiled: DNA length, struct count, then for each struct its member count followed by its members:
+	// type | name << 16, nr | depth << 16 and, when bit 31 is set (it differs from the previous member one),
+	// the key chain (depth words of type | name << 16).
+	// Offsets, lengths and hashes are not saved: they come from the tables read() just filled (and m_ptr)
+	const FBTuint32* ip = compiled, *ep = compiled + compiledLen;
+	FBTuint32 i, e, d, memberCount, depth, cof;
+	FBTtype cp[2], nr;
+	bool chain, ok = compiledLen >= 2 && ip[0] == len && ip[1] == m_strcNr;
+
+	ip += 2;
+
+	fbtStruct::Keys keys;
+	m_offs.reserve(m_strcNr);
+
+	for (i = 0; ok && i < m_strcNr; i++)
+	{
+		fbtStruct* off = putStruct(i);
+
+		ok = ip < ep && *ip <= (FBTuint32)(ep - ip - 1) / 2;
+		memberCount = ok ? *ip++ : 0;
+		off->m_members.reserve(memberCount);
+		keys.resize(0);
+		cof = 0;
+
+		for (e = 0; ok && e < memberCount; ++e)
+		{
+			if (ep - ip < 2)
+			{
+				ok = false;
+				break;
+			}
+
+			cp[0] = (FBTtype)(ip[0] & 0xFFFF);
+			cp[1] = (FBTtype)(ip[0] >> 16);
+			nr    = (FBTtype)(ip[1] & 0xFFFF);
+			depth = (ip[1] >> 16) & 0x7FFF;
+			chain = (ip[1] & 0x80000000) != 0;
+			ip += 2;
+
+			ok = cp[0] < m_typeNr && cp[1] < m_nameNr;
+			if (chain)
+			{
+				ok = ok && depth <= (FBTuint32)(ep - ip);
+				keys.resize(ok ? depth : 0);
+			}
+			else
+				ok = ok && depth == keys.size();
+
+			for (d = 0; ok && chain && d < depth; ++d, ++ip)
+			{
+				FBTuint32 t = *ip & 0xFFFF, n = *ip >> 16;
+				ok = t < m_typeNr && n < m_nameNr;
+				if (ok)
+				{
+					fbtKey64 k = {{m_type[t].m_typeId, m_name[n].m_nameId}};
+					keys[d] = k;
+				}
+			}
+
+			if (ok)
+				putMember(cp, off, nr, cof, depth, keys);
+		}
+
+		if (ok && (int)cof != (int)off->m_len)
+		{
+			off->m_flag |= fbtStruct::MISALIGNED;
+			fbtPrintf("Build ==> invalid offset %s:%i:%i:%i\n", m_type[off->m_key.k16[0]].m_name, i, cof, off->m_len);
+		}
+	}
+
+	if (ok && ip == ep)
+		return true;
+
+	fbtPrintf("Bin table: the compiled tables do not match the DNA, compiling it.\n");
+
+	for (i = 0; i < m_offs.size(); i++)
+		delete m_offs[i];
+	m_offs.clear();
+	return false;
+}
+
+fbtStruct* fbtBinTables::putStruct(FBTuint32 i)
+{
+	FBTtype strcType = m_strc[i][0];
+
+	fbtStruct* off = new fbtStruct;
+	off->m_key.k16[0] = strcType;
+	off->m_key.k16[1] = 0;
+	off->m_val.k32[0] = m_type[strcType].m_typeId;
+	off->m_val.k32[1] = 0; // no name
+	off->m_nr         = 0;
+	off->m_dp         = 0;
+	off->m_off        = 0;
+	off->m_len        = m_tlen[strcType];
+	off->m_strcId     = i;
+	off->m_link       = 0;
+	off->m_flag       = fbtStruct::CAN_LINK;
+
+	m_offs.push_back(off);
+	return off;
+}
+
 void fbtBinTables::putMember(FBTtype* cp, fbtStruct* off, FBTtype nr, FBTuint32& cof, FBTuint32 depth, fbtStruct::Keys& keys)
 {
 	fbtStruct nof;
@@ -4775,9 +8319,10 @@ void fbtBinTables::putMember(FBTtype* cp, fbtStruct* off, FBTtype nr, FBTuint32&
 }
 
 
-FBTtype fbtBinTables::findTypeId(const fbtCharHashKey &cp)
+FBTtype fbtBinTables::findTypeId(const fbtCharHashKey &cp) const
 {
-	FBTsizeType pos = m_typeFinder.find(cp);
+	// (no last hit memo: the tables are shared)
+	FBTsizeType pos = m_typeFinder.lookup(cp);
 	if (pos != FBT_NPOS)
 		return m_typeFinder.at(pos).m_strcId;
 	return -1;
@@ -4988,6 +8533,124 @@ FBT_PRIM_TYPE fbtGetPrimType(FBTuint32 typeKey)
 }
 
 
+
+// ----------------------------------------------------------------------------
+// Memory Arena
+
+
+void* fbtMemoryArena::alloc(FBTsize size)
+{
+	if (size > ((FBTsize)-1) - HEADER_SIZE - 2 * ALIGNMENT)
+		return 0;
+
+	const bool own = isOwnBlock(size);
+	Block* blk = m_blocks;
+	if (blk && !own)
+	{
+		FBTuintPtr p   = (FBTuintPtr)blk + HEADER_SIZE + blk->m_used;
+		FBTsize    pad = (FBTsize)((ALIGNMENT - (p & (ALIGNMENT - 1))) & (ALIGNMENT - 1));
+		if (pad <= blk->m_size - blk->m_used && size <= blk->m_size - blk->m_used - pad)
+		{
+			blk->m_used += pad + size;
+			return (void*)(p + pad);
+		}
+	}
+
+	// own blocks go behind the one being filled, with their header address right before the data (release())
+	const FBTsize dataSize = own ? size + 2 * ALIGNMENT : fbtMax<FBTsize>(m_blockSize, size + ALIGNMENT);
+
+	Block* nb = static_cast<Block*>(fbtMalloc(HEADER_SIZE + dataSize));
+	if (!nb)
+		return 0;
+
+	nb->m_size = dataSize;
+	nb->m_prev = 0;
+	if (own && blk)
+	{
+		nb->m_next  = blk->m_next;
+		nb->m_prev  = blk;
+		blk->m_next = nb;
+	}
+	else
+	{
+		nb->m_next = blk;
+		m_blocks   = nb;
+	}
+	if (nb->m_next)
+		nb->m_next->m_prev = nb;
+
+	FBTuintPtr p   = (FBTuintPtr)nb + HEADER_SIZE;
+	FBTsize    pad = (FBTsize)((ALIGNMENT - (p & (ALIGNMENT - 1))) & (ALIGNMENT - 1));
+	if (own)
+	{
+		// (full: nothing else goes in)
+		pad += ALIGNMENT;
+		reinterpret_cast<Block**>(p + pad)[-1] = nb;
+		nb->m_used = dataSize;
+	}
+	else
+		nb->m_used = pad + size;
+	return (void*)(p + pad);
+}
+
+
+void fbtMemoryArena::release(void* p)
+{
+	if (!p)
+		return;
+
+	Block* blk = reinterpret_cast<Block**>(p)[-1];
+	if (blk->m_prev)
+		blk->m_prev->m_next = blk->m_next;
+	else
+		m_blocks = blk->m_next;
+	if (blk->m_next)
+		blk->m_next->m_prev = blk->m_prev;
+	fbtFree(blk);
+}
+
+
+void fbtMemoryArena::adopt(fbtMemoryArena& other, void* p)
+{
+	if (!p)
+		return;
+
+	Block* blk = reinterpret_cast<Block**>(p)[-1];
+	if (blk->m_prev)
+		blk->m_prev->m_next = blk->m_next;
+	else
+		other.m_blocks = blk->m_next;
+	if (blk->m_next)
+		blk->m_next->m_prev = blk->m_prev;
+
+	// (behind the one being filled)
+	blk->m_prev = m_blocks;
+	if (m_blocks)
+	{
+		blk->m_next = m_blocks->m_next;
+		m_blocks->m_next = blk;
+	}
+	else
+	{
+		blk->m_next = 0;
+		m_blocks = blk;
+	}
+	if (blk->m_next)
+		blk->m_next->m_prev = blk;
+}
+
+
+void fbtMemoryArena::clear(void)
+{
+	while (m_blocks)
+	{
+		Block* next = m_blocks->m_next;
+		fbtFree(m_blocks);
+		m_blocks = next;
+	}
+}
+
+
 #endif //_fbtFile_imp_
 
 
@@ -5059,10 +8722,12 @@ fbtIdDB fbtData[] =
 
 extern unsigned char bfBlenderFBT[];
 extern int bfBlenderLen;
+extern const FBTuint32 bfBlenderTables[];
+extern int bfBlenderTablesLen;
 
 
 fbtBlend::fbtBlend()
-	:   fbtFile("BLENDER"), m_stripList(0)
+	:   fbtFile("BLENDER"), m_fg(0), m_stripList(0)
 {
 	m_aluhid = "BLENDEs"; //a stripped blend file
 }
@@ -5077,7 +8742,7 @@ fbtBlend::~fbtBlend()
 
 int fbtBlend::initializeTables(fbtBinTables* tables)
 {
-	return tables->read(bfBlenderFBT, bfBlenderLen, false) ? FS_OK : FS_FAILED;
+	return tables->read(bfBlenderFBT, bfBlenderLen, false, bfBlenderTables, bfBlenderTablesLen) ? FS_OK : FS_FAILED;
 }
 
 
@@ -6285,6 +9950,1267 @@ unsigned char bfBlenderFBT[] = {
 0,0,33,0,0,0,30,0,0,0,188,1,22,0,90,20,0,0,91,20,24,0,92,20,88,4,93,20,2,0,94,20,2,0,95,20,2,0,96,20,2,0,97,20,0,0,98,20,7,0,99,20,7,0,100,20,7,0,101,20,2,0,102,20,0,0,211,6,22,0,103,20,106,4,6,0,106,4,28,0,106,4,29,0,0,0,33,0,22,0,84,18,2,0,104,20,0,0,22,0};
 
 int bfBlenderLen=sizeof(bfBlenderFBT);
+
+// bfBlenderFBT already compiled (see fbtBinTables::load())
+const FBTuint32 bfBlenderTables[] = {
+132940,981,0,3,0,0,65540,0,131072,0,5,196608,0,262144,0,0,0,327684,0,393220,0,13,0,2147549184,458766,65540,65536,131072,65536,524292,2147483648,589828,0,655364,0,720900,0,786436,0,851972,
+0,917508,0,983044,0,1048580,0,1114127,0,7,0,2147549184,458766,65540,65536,131072,65536,524300,2147483648,589828,0,1179648,0,983052,0,13,0,2147549184,458766,65540,65536,131072,65536,524296,2147483648,589828,0,131072,0,917511,
+0,1245188,0,655368,0,720904,0,786440,0,851976,0,983048,0,4,0,2147549184,458766,65540,65536,131072,65536,1310720,2147483648,5,0,2147549184,458766,65540,65536,131072,65536,1376258,2147483648,1441792,0,6,1507339,0,131923979,2147549184,
+1572886,131989515,65536,1638423,2147483648,1703940,0,1769476,0,16,1835032,0,1900568,0,1966080,0,2031616,0,2097154,0,2162688,0,2228224,0,1507339,2147549184,2293781,131923979,2147614720,2293781,1572886,131989515,131072,1638423,2147549184,2293781,1703940,65536,1769476,65536,
+2359300,2147483648,2424836,0,2490382,0,12,1835033,0,1900569,0,2555906,0,2097154,0,2621442,0,2686976,0,2752512,0,2818048,0,2883588,0,2949124,0,3014682,0,3080218,0,8,1835035,0,1900571,0,3145728,0,131923979,2147549184,
+3211286,131989515,65536,2621442,2147483648,3276800,0,3342340,0,7,3407898,0,131923979,2147549184,3473430,131989515,65536,3538970,2147483648,3604509,0,2097156,0,3670016,0,1,3735552,0,23,1835019,0,1900555,0,3801114,0,3866655,0,3932192,0,3997696,
+0,2097154,0,2621444,0,4063236,0,4128772,0,4194308,0,4259844,0,4325380,0,4390916,0,3735552,2147549184,4456478,4522008,2147483648,4587544,0,4653067,0,4718620,0,4784154,0,4849675,0,4915233,0,3604514,0,31,1835019,2147549184,4980762,
+1900555,65536,3801114,65536,3866655,65536,3932192,65536,3997696,65536,2097154,65536,2621444,65536,4063236,65536,4128772,65536,4194308,65536,4259844,65536,4325380,65536,4390916,65536,3735552,2147614720,4980762,4456478,4522008,2147549184,4980762,4587544,65536,4653067,65536,4718620,65536,4784154,
+65536,4849675,65536,4915233,65536,3604514,65536,5046272,2147483648,2097155,0,5111811,0,131072,0,5177375,0,5242915,0,3604516,0,5308427,0,3,5373952,0,5439488,0,3276800,0,6,5505028,0,5570564,0,5636098,0,5701634,0,5767172,
+0,3604518,0,2,5832711,0,2097156,0,13,5898279,0,5963780,0,6029316,0,6094852,0,6160391,0,6225927,0,6291460,0,2097156,0,6356992,0,6422569,0,6488106,0,6553642,0,6619147,0,11,4194306,0,6684674,0,
+6750210,0,6815746,0,6881282,0,6946818,0,131072,0,7012356,0,7077892,0,7143428,0,7208964,0,4,7274503,0,7340039,0,7405575,0,7471111,0,15,258670602,2147549184,4390958,9764871,2147549184,7536687,322830343,65536,322895879,65536,322961415,65536,
+7602180,2147483648,7667719,0,2097153,0,7733248,0,7798832,0,7864368,0,7929904,0,7995439,0,8060972,0,6619147,0,94,1835057,0,1900593,0,8126488,0,4587544,0,131923979,2147549184,8192022,131989515,65536,2162688,2147483648,2097154,0,8257538,0,
+8323074,0,8388610,0,8454144,0,8519680,0,8585216,0,8650752,0,2228224,0,8716338,0,8781873,0,8847409,0,131923979,2147549184,8912918,131989515,65536,131923979,2147549184,8978454,131989515,65536,9044008,2147483648,9109555,0,9175089,0,9240583,0,9306119,0,
+9371655,0,9437191,0,9502727,0,9568263,0,9633799,0,9699335,0,9764871,0,9830407,0,9895943,0,9961474,0,1441792,0,10027015,0,10092551,0,10158087,0,10223623,0,10289159,0,10354695,0,10420231,0,10485767,0,10551303,0,
+10616839,0,10682375,0,10747911,0,10813447,0,10878983,0,10944519,0,11010055,0,11075591,0,11141127,0,11206663,0,11272199,0,11337735,0,11403271,0,11468807,0,11534343,0,11599879,0,11665415,0,11730951,0,11796529,0,11862065,0,
+11927563,0,11993140,0,12058673,0,24641548,2147549184,12124213,15532033,65536,298975232,2147614720,12124213,24707132,288489472,131072,288817152,131072,2097154,131072,2686976,131072,5308427,2147483648,258670602,2147614720,12189741,4390958,9764871,2147614720,12189741,7536687,322830343,131072,322895879,131072,322961415,131072,7602180,
+2147549184,12189741,7667719,65536,2097153,65536,7733248,65536,7798832,65536,7864368,65536,7929904,65536,7995439,65536,8060972,65536,6619147,65536,26,131923979,2147549184,12255254,131989515,65536,12320823,2147483648,12386353,0,2097154,0,3276800,0,12451847,0,12517383,0,12582919,0,
+131923979,2147549184,12648470,131989515,65536,12713988,2147483648,12779524,0,12845067,0,12910648,0,4194306,2147549184,12976171,6684674,65536,6750210,65536,6815746,65536,6881282,65536,6946818,65536,131072,65536,7012356,65536,7077892,65536,7143428,65536,7208964,65536,1,12779524,0,12,
+12779524,0,1245191,0,13041666,0,13107202,0,13172743,0,13238279,0,13303810,0,2097154,0,13369351,0,13434887,0,13500423,0,13565959,0,15,1835066,0,1900602,0,131923979,2147549184,13631510,131989515,65536,13697028,2147483648,13762564,0,13828155,0,
+2097156,0,13893636,0,2162688,0,298975232,2147549184,13959228,288489472,65536,288817152,65536,2097154,65536,2686976,65536,45,1835019,2147549184,4980762,1900555,65536,3801114,65536,3866655,65536,3932192,65536,3997696,65536,2097154,65536,2621444,65536,4063236,65536,4128772,65536,4194308,
+65536,4259844,65536,4325380,65536,4390916,65536,3735552,2147614720,4980762,4456478,4522008,2147549184,4980762,4587544,65536,4653067,65536,4718620,65536,4784154,65536,4849675,65536,4915233,65536,3604514,65536,14024766,2147483648,14090244,0,14155780,0,14221375,0,14286852,0,14352388,0,
+14417984,0,14483460,0,2228224,0,131923979,2147549184,14549014,131989515,65536,131923979,2147549184,14614550,131989515,65536,131923979,2147549184,14680086,131989515,65536,2097156,2147483648,14745604,0,14811140,0,14876672,0,14942215,0,15007751,0,15073317,0,9,15138842,0,131923979,2147549184,
+12255254,131989515,65536,15204418,2147483648,15269888,0,15335428,0,15400964,0,2097156,0,15466500,0,2,2097152,0,15532032,0,2,2097156,0,2228224,0,70,1835078,0,1900614,0,131923979,2147549184,15597590,131989515,65536,15663104,2147483648,15728640,0,15794176,
+0,66650119,2147614720,15859783,61145170,58851335,131072,66715655,131072,58916871,131072,66650119,2147614720,15859783,57737298,58851335,131072,66715655,131072,58916871,131072,66650116,2147614720,15859783,323093382,58851332,131072,66715652,131072,58916868,131072,66650116,2147614720,15859783,323158918,58851332,131072,66715652,131072,58916868,
+131072,66650116,2147614720,15859783,323224454,58851332,131072,66715652,131072,58916868,131072,323289095,2147549184,15859783,323354631,65536,323420167,65536,323485703,65536,323551234,65536,323616770,65536,323682306,65536,323747842,65536,323813378,65536,2097154,65536,246939650,65536,247529474,65536,247595010,65536,323878914,65536,
+323944450,65536,261816322,65536,324009984,65536,324075520,65536,3276800,65536,324141063,65536,324207673,65536,324273007,65536,15925309,2147483648,15138842,2147549184,15990849,131923979,2147614720,15990849,12255254,131989515,131072,15204418,2147549184,15990849,15269888,65536,15335428,65536,15400964,65536,2097156,65536,15466500,65536,
+16056327,2147483648,2097154,0,16121856,0,16187392,0,16252928,0,16318464,0,16384000,0,2097156,2147549184,16449604,2228224,65536,2097152,2147549184,12189763,15532032,65536,8,2162688,0,16515079,0,16580609,0,16646156,0,2686977,0,16711752,0,16777220,0,14876673,
+0,6,3997696,0,16842754,0,16908292,0,16973836,0,17039361,0,3604553,0,7,17104908,0,17170433,0,17235972,0,14942215,0,15007751,0,17301511,0,14876673,0,3,17367099,0,17432580,0,131073,0,6,17498116,0,17563652,
+0,17629242,0,131073,0,17694724,0,17760330,0,14,1835083,0,1900619,0,17825866,0,17891339,0,2162688,0,1966082,0,2097154,0,17956866,0,1441792,0,16515079,0,18022407,0,18087943,0,18153479,0,18219015,0,5,18284551,
+0,18350084,0,18415620,0,16121860,0,2097156,0,6,18481159,0,18546695,0,18612231,0,18677767,0,1966084,0,2097156,0,5,655367,0,720903,0,18743303,0,18808834,0,18874370,0,5,17891406,0,18939908,0,19005447,0,
+655367,0,720903,0,4,19070978,0,19136514,0,19202050,0,19267586,0,6,66650119,2147549184,19333202,58851335,65536,66715655,65536,58916871,65536,2097156,2147483648,131072,0,10,19398663,0,19464199,0,19529735,0,19595271,0,19660807,0,19726343,0,
+19791874,0,19857410,0,19922944,0,1179648,0,5,19988487,0,19595271,0,6029319,0,6094855,0,2097156,0,2,20054023,0,20119556,0,11,20185114,0,3145728,0,20250624,0,20316162,0,20381696,0,20447232,0,2097154,0,20512770,
+0,16842756,0,20578308,0,20643847,0,95,1835095,0,1900631,0,2162688,0,20185114,2147549184,20709462,3145728,65536,20250624,65536,20316162,65536,20381696,65536,20447232,65536,2097154,65536,20512770,65536,16842756,65536,20578308,65536,20643847,65536,20185114,65537,3145728,
+65537,20250624,65537,20316162,65537,20381696,65537,20447232,65537,2097154,65537,20512770,65537,16842756,65537,20578308,65537,20643847,65537,20185114,65538,3145728,65538,20250624,65538,20316162,65538,20381696,65538,20447232,65538,2097154,65538,20512770,65538,16842756,65538,20578308,65538,20643847,
+65538,20185114,65539,3145728,65539,20250624,65539,20316162,65539,20381696,65539,20447232,65539,2097154,65539,20512770,65539,16842756,65539,20578308,65539,20643847,65539,20185114,65540,3145728,65540,20250624,65540,20316162,65540,20381696,65540,20447232,65540,2097154,65540,20512770,65540,16842756,
+65540,20578308,65540,20643847,65540,20185114,65541,3145728,65541,20250624,65541,20316162,65541,20381696,65541,20447232,65541,2097154,65541,20512770,65541,16842756,65541,20578308,65541,20643847,65541,20185114,65542,3145728,65542,20250624,65542,20316162,65542,20381696,65542,20447232,65542,2097154,
+65542,20512770,65542,16842756,65542,20578308,65542,20643847,65542,20185114,65543,3145728,65543,20250624,65543,20316162,65543,20381696,65543,20447232,65543,2097154,65543,20512770,65543,16842756,65543,20578308,65543,20643847,65543,20774912,2147483648,1966080,0,2097154,0,20840455,0,9,
+131923979,2147549184,20906006,131989515,65536,20971520,2147483648,21037067,0,21102681,0,20840455,0,16515079,0,1966084,0,2097156,0,3,21168135,0,2097156,0,131072,0,21,1835082,0,1900618,0,21233722,0,21299288,0,131923979,2147549184,21364758,131989515,65536,
+21430363,2147483648,21495898,0,18939908,0,21561348,0,20840455,0,2097154,0,21626882,0,21692416,0,1179648,0,21757956,0,3145728,0,21823492,0,6160391,0,21889031,0,21954567,0,31,1835100,0,1900636,0,131923979,2147549184,22020118,131989515,65536,
+22085693,2147483648,22151172,0,22216704,0,2686976,0,131923979,2147549184,22282262,131989515,65536,131923979,2147549184,21364758,131989515,65536,2162688,2147483648,16515079,0,22347783,0,22413319,0,22478855,0,22544391,0,22609927,0,22675463,0,22740999,0,18153479,0,18219015,0,
+22806530,0,22872066,0,22937600,0,1966082,0,2097156,0,6356992,0,23003228,0,3604573,0,7,1835102,0,1900638,0,131923979,2147549184,22020118,131989515,65536,2097156,2147483648,23068676,0,2162688,0,11,1835103,0,1900639,0,20185114,0,23134208,
+0,16842756,0,23199746,0,2097154,0,3145728,0,21757956,0,23265282,0,23330818,0,13,1835104,0,1900640,0,131923979,2147549184,23396374,131989515,65536,23461888,2147483648,2162688,0,23527424,0,23592960,0,23658500,0,2097154,0,23265282,0,23330818,
+0,1441792,0,5,1835105,0,1900641,0,3145728,0,21757956,0,327687,0,22,15925309,0,17498116,0,23724032,0,2686977,0,23789629,0,23855108,0,23920640,0,22937601,0,131923979,2147549184,23986198,131989515,65536,24051806,2147483648,24117340,0,
+131923979,2147549184,24182806,131989515,65536,131923979,2147549184,24248342,131989515,65536,24313930,2147483648,2097156,0,24379394,0,24444930,0,24510471,0,6356993,0,24,1835019,2147549184,4980762,1900555,65536,3801114,65536,3866655,65536,3932192,65536,3997696,65536,2097154,65536,2621444,65536,
+4063236,65536,4128772,65536,4194308,65536,4259844,65536,4325380,65536,4390916,65536,3735552,2147614720,4980762,4456478,4522008,2147549184,4980762,4587544,65536,4653067,65536,4718620,65536,4784154,65536,4849675,65536,4915233,65536,3604514,65536,24576098,2147483648,7,24641548,0,15532033,0,
+298975232,2147549184,24707132,288489472,65536,288817152,65536,2097154,65536,2686976,65536,2,131923979,2147549184,24772630,131989515,65536,64,1835058,0,1900594,0,8126488,0,4587544,0,24838155,0,8781874,0,131923979,2147549184,24903702,131989515,65536,2162688,2147483648,24969223,0,25034759,
+0,25100295,0,25165831,0,2097156,0,25231372,0,7733248,0,24641548,2147549184,12124213,15532033,65536,298975232,2147614720,12124213,24707132,288489472,131072,288817152,131072,2097154,131072,2686976,131072,25296896,2147483648,1179648,0,25362439,0,25427975,0,25493511,0,25559047,0,
+25624583,0,25690119,0,25755655,0,5963783,0,25821191,0,25886727,0,25952263,0,10878983,0,10944519,0,11010055,0,11075591,0,11141127,0,11206663,0,11272199,0,11337735,0,11403271,0,11468807,0,11534343,0,11599879,0,11665415,0,
+11730951,0,9633799,0,26017796,0,26083330,0,26148864,0,26214400,0,26279936,0,26345472,0,26411012,0,26476546,0,26542082,0,11796530,0,11862066,0,131923979,2147614720,12189796,24772630,131989515,131072,3,26607620,0,2228225,0,26673254,0,50,
+1835019,2147549184,4980762,1900555,65536,3801114,65536,3866655,65536,3932192,65536,3997696,65536,2097154,65536,2621444,65536,4063236,65536,4128772,65536,4194308,65536,4259844,65536,4325380,65536,4390916,65536,3735552,2147614720,4980762,4456478,4522008,2147549184,4980762,4587544,65536,4653067,65536,
+4718620,65536,4784154,65536,4849675,65536,4915233,65536,3604514,65536,24576098,2147483648,131923979,2147549184,26738710,131989515,65536,26804279,2147483648,4653067,0,26869782,0,26935346,0,27000936,0,27066368,0,17170432,0,2097156,0,25231364,0,27131906,0,27197442,0,131923979,
+2147549184,24772630,131989515,65536,27263078,2147483648,27328516,0,27394052,0,27459584,0,27525124,0,26017796,0,27590660,0,27656199,0,26607620,2147549184,12189797,2228225,65536,26673254,65536,11,1835110,0,1900646,0,2162688,0,131923979,2147549184,27721750,131989515,65536,27787265,
+2147483648,15532033,0,27852804,0,27918340,0,8126488,0,4587544,0,3,1835113,0,1900649,0,8716338,0,3,1835114,0,1900650,0,27983974,0,3,1835115,0,1900651,0,2162688,0,18,28049516,0,4522008,0,322371588,2147549184,28115053,
+322437123,65536,322502659,65536,322568193,65536,322633729,65536,322699265,65536,28180480,2147483648,28246016,0,0,0,28311552,0,28377088,0,131923979,2147549184,28442646,131989515,65536,28508162,2147483648,28573698,0,131072,0,3,1966082,0,22937600,0,28639236,0,4,1441792,
+0,28704770,0,28770304,0,28835840,0,3,1835120,0,1900656,0,28901376,0,5,17891339,0,28967026,0,19398665,0,29032460,0,29097984,0,2,17891339,0,28967026,0,6,262144,0,29163522,0,29229068,0,29294604,0,131072,
+0,17891339,0,4,29360244,0,29425668,0,131072,0,3604598,0,5,1835127,0,1900663,0,1966084,0,2097156,0,29491200,0,10,1835127,2147549184,29556855,1900663,65536,1966084,65536,2097156,65536,29491200,65536,29622323,2147483648,20512772,0,29687815,
+0,29753348,0,13631492,0,7,1835127,2147549184,29556855,1900663,65536,1966084,65536,2097156,65536,29491200,65536,20512772,2147483648,29818887,0,12,1835127,2147549184,29556855,1900663,65536,1966084,65536,2097156,65536,29491200,65536,29622323,2147483648,9568263,0,29884423,0,29949959,
+0,30015495,0,20512772,0,30081028,0,9,1835127,2147549184,29556855,1900663,65536,1966084,65536,2097156,65536,29491200,65536,30146567,2147483648,30212103,0,30277639,0,2228224,0,7,1835127,2147549184,29556855,1900663,65536,1966084,65536,2097156,65536,29491200,65536,30015495,
+2147483648,30343175,0,4,30408711,0,30474247,0,30539778,0,16121858,0,17,1835134,0,1900670,0,131923979,2147549184,30605334,131989515,65536,131923979,2147549184,30670870,131989515,65536,131923979,2147549184,30736406,131989515,65536,29491200,2147483648,4980740,0,2097156,0,30801924,0,
+30867463,0,29753348,0,13631492,0,30932999,0,30998535,0,24,20512772,0,31064068,0,31129607,0,31195143,0,31260679,0,31326215,0,30408711,0,31391751,0,19464199,0,31457287,0,31522823,0,31588359,0,31653895,0,31719431,0,31784967,
+0,31850503,0,31916039,0,31981575,0,32047111,0,32112647,0,32178183,0,32243719,0,131923979,2147549184,32309270,131989515,65536,57,32374791,0,32440327,0,32505863,0,32571399,0,32636935,0,32702471,0,32768007,0,32833543,0,32899074,0,32964610,
+0,33030146,0,33095682,0,33161223,0,3276800,0,33226764,0,33292288,0,33357828,0,33423364,0,33488900,0,33554436,0,33619972,0,33685511,0,33751044,0,33816580,0,33882119,0,33947655,0,34013191,0,2097156,0,34078727,0,34144263,
+0,34209799,0,34275335,0,34340868,0,34406404,0,34471940,0,34537472,0,34603010,0,34668551,0,34734087,0,34799623,0,34865156,0,34930688,0,34996231,0,35061764,0,35127425,0,35192961,0,35258497,0,35324033,0,35389569,0,35455105,
+0,35520641,0,35586177,0,35651713,0,35717127,0,35782663,0,35848322,0,35913858,0,11,35979268,0,36044804,0,2097156,0,36110343,0,36175879,0,36241415,0,36306951,0,36372484,0,36438017,0,29097984,0,36503681,0,236,1835019,
+2147549184,4980762,1900555,65536,3801114,65536,3866655,65536,3932192,65536,3997696,65536,2097154,65536,2621444,65536,4063236,65536,4128772,65536,4194308,65536,4259844,65536,4325380,65536,4390916,65536,3735552,2147614720,4980762,4456478,4522008,2147549184,4980762,4587544,65536,4653067,65536,4718620,
+65536,4784154,65536,4849675,65536,4915233,65536,3604514,65536,17825921,2147483648,273154050,2147549184,36569221,273219586,65536,273285122,65536,34537472,65536,105709619,65536,125567207,65536,151715840,65536,273350656,65536,273416192,65536,273481728,65536,185532416,65536,273547264,65536,273612800,65536,273678338,65536,
+273743879,65536,9633799,65536,273809415,65536,273874951,65536,60817415,65536,60882951,65536,60948487,65536,273940487,65536,274006023,65536,274071559,65536,274137095,65536,274202631,65536,274268167,65536,206307335,65536,205651975,65536,274333703,65536,274399239,65536,274464775,65536,274530311,65536,274595847,65536,
+274661383,65536,274726919,65536,274792455,65536,274857991,65536,274923527,65536,273154050,2147549184,36634757,273219586,65536,273285122,65536,34537472,65536,105709619,65536,125567207,65536,151715840,65536,273350656,65536,273416192,65536,273481728,65536,185532416,65536,273547264,65536,273612800,65536,273678338,65536,273743879,
+65536,9633799,65536,273809415,65536,273874951,65536,60817415,65536,60882951,65536,60948487,65536,273940487,65536,274006023,65536,274071559,65536,274137095,65536,274202631,65536,274268167,65536,206307335,65536,205651975,65536,274333703,65536,274399239,65536,274464775,65536,274530311,65536,274595847,65536,274661383,
+65536,274726919,65536,274792455,65536,274857991,65536,274923527,65536,15073317,2147483648,36700294,0,36765831,0,36831239,0,36896775,0,36962306,0,37027842,0,25690119,0,19398660,0,2097156,0,33357828,0,37093380,0,37158924,0,29097984,0,33619972,0,37224452,
+0,37289991,0,37355524,0,37421060,0,37486596,0,37552132,0,37617671,0,37683207,0,6160391,0,34865156,0,37748743,0,35520641,0,35586177,0,35651713,0,37814401,0,35192961,0,35258497,0,37879815,0,37945351,0,38010887,0,38076423,
+0,38141959,0,38207495,0,38273028,0,38338567,0,38404103,0,38469639,0,38535175,0,38600711,0,38666247,0,38731780,0,38797316,0,7405575,0,38862852,0,38928384,0,38993920,0,39059456,0,39124992,0,39190535,0,39256064,0,39321600,
+0,39387136,0,39452672,0,39518208,0,39583744,0,39649280,0,39714816,0,39780352,0,39845888,0,39911424,0,39976967,0,40042503,0,40108039,0,40173575,0,40239111,0,40304647,0,40370183,0,40435719,0,31195143,0,40501255,0,40566791,
+0,40632327,0,40697863,0,40763396,0,40828935,0,40894468,0,40960007,0,41025540,0,41091076,0,41156612,0,41222151,0,41287687,0,41353223,0,41418759,0,41484292,0,41549831,0,41615364,0,41680900,0,41746439,0,41811972,0,41877508,
+0,41943044,0,42008580,0,42074116,0,42139655,0,42205188,0,42270724,0,42336260,0,42401799,0,42467335,0,42532871,0,42598407,0,42663943,0,42729476,0,42795015,0,42860551,0,42926084,0,42991623,0,43057156,0,43122692,0,43188228,
+0,43253764,0,43319300,0,43384839,0,43450375,0,43515908,0,43581444,0,33161223,0,43646983,0,43712519,0,43778055,0,43843591,0,43909127,0,43974663,0,44040320,0,44105859,0,44171268,0,44236807,0,44302465,0,6,1835144,0,
+1900680,0,6160391,0,327687,0,38535175,0,44367879,0,27,1835019,2147549184,4980762,1900555,65536,3801114,65536,3866655,65536,3932192,65536,3997696,65536,2097154,65536,2621444,65536,4063236,65536,4128772,65536,4194308,65536,4259844,65536,4325380,65536,4390916,65536,
+3735552,2147614720,4980762,4456478,4522008,2147549184,4980762,4587544,65536,4653067,65536,4718620,65536,4784154,65536,4849675,65536,4915233,65536,3604514,65536,131923979,2147549184,44433430,131989515,65536,44498948,2147483648,131072,0,18,68222983,2147549184,44564571,68288519,65536,25690119,65536,68354055,65536,
+68419584,65536,68485121,65536,68550657,65536,18808833,65536,18874369,65536,68616193,65536,68681728,65536,68747264,65536,68812807,65536,18481159,65536,68878343,65536,68943872,65536,1179648,65536,44630023,2147483648,26,1835019,2147549184,4980762,1900555,65536,3801114,65536,3866655,65536,3932192,65536,
+3997696,65536,2097154,65536,2621444,65536,4063236,65536,4128772,65536,4194308,65536,4259844,65536,4325380,65536,4390916,65536,3735552,2147614720,4980762,4456478,4522008,2147549184,4980762,4587544,65536,4653067,65536,4718620,65536,4784154,65536,4849675,65536,4915233,65536,3604514,65536,5898378,
+2147483648,44695556,0,44761092,0,3,1835147,0,1900683,0,44826624,0,5,1835148,0,1900684,0,44892160,0,2097156,0,44367876,0,47,1835019,2147549184,4980762,1900555,65536,3801114,65536,3866655,65536,3932192,65536,3997696,65536,2097154,65536,2621444,
+65536,4063236,65536,4128772,65536,4194308,65536,4259844,65536,4325380,65536,4390916,65536,3735552,2147614720,4980762,4456478,4522008,2147549184,4980762,4587544,65536,4653067,65536,4718620,65536,4784154,65536,4849675,65536,4915233,65536,3604514,65536,24576098,2147483648,131923979,2147549184,44957718,131989515,
+65536,131923979,2147549184,45023254,131989515,65536,44892160,2147483648,45088768,0,45154304,0,45219840,0,45285376,0,22740999,0,45350919,0,17301511,0,2097154,0,1966080,0,33292288,0,45416452,0,45481984,0,45547520,0,45613056,0,34930688,0,45678734,0,
+45744128,0,45809807,0,8,45875207,0,45940743,0,46006274,0,46071810,0,2097154,0,3276800,0,46137351,0,46202887,0,26,1835153,0,1900689,0,46268562,0,114622706,2147549184,46334099,114688004,65536,100663300,65536,19595268,65536,18022404,65536,114753536,
+65536,114819072,65536,114884610,65536,114950148,65536,115015682,65536,115081218,65536,26017794,65536,2097154,65536,46399636,2147483648,114688004,2147549184,46465173,164626434,65536,164691970,65536,46530567,2147483648,22740999,0,46596103,0,37879815,0,2097154,0,46661634,0,9,46727219,0,46792704,
+0,46858247,0,46923783,0,46989319,0,47054855,0,47120388,0,2097154,0,3276800,0,5,47185927,0,47251463,0,47316999,0,47382535,0,47448071,0,98,1835019,2147549184,4980762,1900555,65536,3801114,65536,3866655,65536,3932192,65536,3997696,65536,
+2097154,65536,2621444,65536,4063236,65536,4128772,65536,4194308,65536,4259844,65536,4325380,65536,4390916,65536,3735552,2147614720,4980762,4456478,4522008,2147549184,4980762,4587544,65536,4653067,65536,4718620,65536,4784154,65536,4849675,65536,4915233,65536,3604514,65536,24576098,2147483648,1966080,
+0,47513600,0,2097154,0,47579143,0,47644679,0,47710215,0,47775751,0,47841287,0,47906823,0,47972359,0,48037895,0,48103431,0,48168967,0,48234503,0,48300032,0,48365568,0,3276800,0,48431111,0,48496647,0,48562183,0,48627719,
+0,48693255,0,48758791,0,48824327,0,48889863,0,48955399,0,49020935,0,49086471,0,49152007,0,49217543,0,49283079,0,49348615,0,49414151,0,49479687,0,49545369,0,49610752,0,49676288,0,49741824,0,49807364,0,49872900,0,49938483,
+0,46858247,2147549184,50004122,112656391,65536,112721927,65536,112787463,65536,46596103,65536,112852999,65536,112918532,65536,112984068,65536,46727219,2147549184,50069654,46792704,65536,46858247,65536,46923783,65536,46989319,65536,47054855,65536,47120388,65536,2097154,65536,3276800,65536,131923979,2147549184,50135062,
+131989515,65536,45875207,2147549184,50200720,45940743,65536,46006274,65536,46071810,65536,2097154,65536,3276800,65536,46137351,65536,46202887,65536,50266119,2147483648,47185927,2147549184,12189847,47251463,65536,47316999,65536,47382535,65536,47448071,65536,70,50331804,0,50397191,0,50462727,0,50528263,
+0,50593799,0,50659335,0,50724871,0,50790407,0,50855943,0,50921479,0,50987015,0,51052551,0,51118087,0,51183623,0,51249159,0,51314695,0,51380231,0,51445767,0,51511303,0,51576839,0,51642375,0,51707911,0,51773447,0,51838983,
+0,51904519,0,51970055,0,52035591,0,52101127,0,52166663,0,52232199,0,52297735,0,52363271,0,52428807,0,52494343,0,52559879,0,52625410,0,52690944,0,52756487,0,52822023,0,52887556,0,27787268,0,52953092,0,53018628,0,53084162,
+0,53149698,0,53215234,0,53280770,0,53346306,0,53411842,0,53477378,0,53542914,0,53608605,0,53673986,0,53739522,0,53805063,0,53870599,0,53936135,0,54001671,0,54067207,0,54132743,0,54198279,0,54263815,0,54329351,0,54394882,
+0,22937600,0,54460423,0,54525959,0,54591495,0,54657031,0,2228224,0,18,54722716,0,54788103,0,54853639,0,54919175,0,54984711,0,55050247,0,55115783,0,55181319,0,27787268,0,55246850,0,55312386,0,131072,0,55377986,0,
+55443458,0,55508994,0,6356992,0,55574535,0,55640071,0,2,55705601,0,1179649,0,6,1835168,0,1900704,0,29622323,0,55705601,2147549184,55771295,1179649,65536,44367876,2147483648,6,1835169,0,1900705,0,55836738,0,55705601,2147549184,55771295,1179649,
+65536,44367876,2147483648,7,1835170,0,1900706,0,55902208,0,2162688,0,55967768,0,2097156,0,56033284,0,44,1835019,2147549184,4980762,1900555,65536,3801114,65536,3866655,65536,3932192,65536,3997696,65536,2097154,65536,2621444,65536,4063236,65536,4128772,65536,
+4194308,65536,4259844,65536,4325380,65536,4390916,65536,3735552,2147614720,4980762,4456478,4522008,2147549184,4980762,4587544,65536,4653067,65536,4718620,65536,4784154,65536,4849675,65536,4915233,65536,3604514,65536,56098842,2147483648,131923979,2147549184,56164374,131989515,65536,131923979,2147549184,56229910,131989515,
+65536,2228224,2147483648,56295428,0,131923979,2147549184,56360982,131989515,65536,15073317,2147483648,26017796,0,56426503,0,2097153,0,56492044,0,22937600,0,56557569,0,56623105,0,56688641,0,56754177,0,56819875,0,3604644,0,4,56885255,0,56950791,0,2097154,
+0,57016322,0,14,57081858,0,2097154,0,31522823,0,57147399,0,57212935,0,57278471,0,57344007,0,17825957,0,57409701,0,57475237,0,57540615,0,57606151,0,57671682,0,1441792,0,74,2097156,0,57737220,0,57802756,0,57868292,
+0,66650119,2147549184,57933906,58851335,65536,66715655,65536,58916871,65536,66650119,2147549184,57999442,58851335,65536,66715655,65536,58916871,65536,57081858,2147549184,58065062,2097154,65536,31522823,65536,57147399,65536,57212935,65536,57278471,65536,57344007,65536,17825957,65536,57409701,65536,57475237,65536,
+57540615,65536,57606151,65536,57671682,65536,1441792,65536,57081858,65537,2097154,65537,31522823,65537,57147399,65537,57212935,65537,57278471,65537,57344007,65537,17825957,65537,57409701,65537,57475237,65537,57540615,65537,57606151,65537,57671682,65537,1441792,65537,57081858,65538,2097154,65538,
+31522823,65538,57147399,65538,57212935,65538,57278471,65538,57344007,65538,17825957,65538,57409701,65538,57475237,65538,57540615,65538,57606151,65538,57671682,65538,1441792,65538,57081858,65539,2097154,65539,31522823,65539,57147399,65539,57212935,65539,57278471,65539,57344007,65539,17825957,65539,
+57409701,65539,57475237,65539,57540615,65539,57606151,65539,57671682,65539,1441792,65539,58130439,2147483648,58195975,0,58261511,0,58327047,0,58392578,0,1441792,0,13,13631492,0,58458116,0,58523655,0,58589191,0,58654727,0,58720263,0,58785799,0,58851335,
+0,58916871,0,16121858,0,2097154,0,31195140,0,58982407,0,31,59047940,0,59113476,0,59179012,0,59244548,0,59310084,0,59375620,0,59441156,0,59506692,0,31457287,0,59572231,0,59637767,0,59703303,0,59768839,0,13631492,2147549184,
+59834535,58458116,65536,58523655,65536,58589191,65536,58654727,65536,58720263,65536,58785799,65536,58851335,65536,58916871,65536,16121858,65536,2097154,65536,31195140,65536,58982407,65536,59899911,2147483648,59965447,0,60030983,0,60096519,0,60162055,0,10,2097156,0,131072,0,
+60227584,0,60293120,0,60358663,0,60424199,0,60489735,0,60555271,0,60620929,0,5308427,0,3,60686336,0,60751872,0,29097984,0,1,2162688,0,6,60817415,0,60882951,0,60948487,0,61014023,0,61079559,0,57737220,0,198,
+61145090,0,57737218,0,61210624,0,61276160,0,21823488,0,61341696,0,60817415,2147549184,61407404,60882951,65536,60948487,65536,61014023,65536,61079559,65536,57737220,65536,60817415,65537,60882951,65537,60948487,65537,61014023,65537,61079559,65537,57737220,65537,60817415,65538,60882951,
+65538,60948487,65538,61014023,65538,61079559,65538,57737220,65538,60817415,65539,60882951,65539,60948487,65539,61014023,65539,61079559,65539,57737220,65539,60817415,65540,60882951,65540,60948487,65540,61014023,65540,61079559,65540,57737220,65540,60817415,65541,60882951,65541,60948487,65541,61014023,
+65541,61079559,65541,57737220,65541,60817415,65542,60882951,65542,60948487,65542,61014023,65542,61079559,65542,57737220,65542,60817415,65543,60882951,65543,60948487,65543,61014023,65543,61079559,65543,57737220,65543,60817415,65544,60882951,65544,60948487,65544,61014023,65544,61079559,65544,57737220,
+65544,60817415,65545,60882951,65545,60948487,65545,61014023,65545,61079559,65545,57737220,65545,60817415,65546,60882951,65546,60948487,65546,61014023,65546,61079559,65546,57737220,65546,60817415,65547,60882951,65547,60948487,65547,61014023,65547,61079559,65547,57737220,65547,60817415,65548,60882951,
+65548,60948487,65548,61014023,65548,61079559,65548,57737220,65548,60817415,65549,60882951,65549,60948487,65549,61014023,65549,61079559,65549,57737220,65549,60817415,65550,60882951,65550,60948487,65550,61014023,65550,61079559,65550,57737220,65550,60817415,65551,60882951,65551,60948487,65551,61014023,
+65551,61079559,65551,57737220,65551,60817415,65552,60882951,65552,60948487,65552,61014023,65552,61079559,65552,57737220,65552,60817415,65553,60882951,65553,60948487,65553,61014023,65553,61079559,65553,57737220,65553,60817415,65554,60882951,65554,60948487,65554,61014023,65554,61079559,65554,57737220,
+65554,60817415,65555,60882951,65555,60948487,65555,61014023,65555,61079559,65555,57737220,65555,60817415,65556,60882951,65556,60948487,65556,61014023,65556,61079559,65556,57737220,65556,60817415,65557,60882951,65557,60948487,65557,61014023,65557,61079559,65557,57737220,65557,60817415,65558,60882951,
+65558,60948487,65558,61014023,65558,61079559,65558,57737220,65558,60817415,65559,60882951,65559,60948487,65559,61014023,65559,61079559,65559,57737220,65559,60817415,65560,60882951,65560,60948487,65560,61014023,65560,61079559,65560,57737220,65560,60817415,65561,60882951,65561,60948487,65561,61014023,
+65561,61079559,65561,57737220,65561,60817415,65562,60882951,65562,60948487,65562,61014023,65562,61079559,65562,57737220,65562,60817415,65563,60882951,65563,60948487,65563,61014023,65563,61079559,65563,57737220,65563,60817415,65564,60882951,65564,60948487,65564,61014023,65564,61079559,65564,57737220,
+65564,60817415,65565,60882951,65565,60948487,65565,61014023,65565,61079559,65565,57737220,65565,60817415,65566,60882951,65566,60948487,65566,61014023,65566,61079559,65566,57737220,65566,60817415,65567,60882951,65567,60948487,65567,61014023,65567,61079559,65567,57737220,65567,15,1835181,0,
+1900717,0,17891339,0,1966082,0,2097154,0,61472768,0,61538304,0,17956866,0,61603891,0,61669376,0,2162688,0,61734919,0,61800455,0,61865991,0,61931527,0,11,1835182,0,1900718,0,61997107,0,62062592,0,62128135,0,62193666,
+0,2097154,0,1966082,0,62259202,0,25690119,0,131072,0,15,61997107,0,62324738,0,2097154,0,62390274,0,62455810,0,62062592,0,62521395,0,62586880,0,62652423,0,25690119,0,62717959,0,62783495,0,1966082,0,16121858,0,
+25624583,0,12,61997107,0,5898247,0,62849026,0,62914562,0,2097154,0,62980098,0,63045634,0,1179650,0,63111175,0,63176711,0,63242247,0,63307783,0,4,2097156,0,131072,0,131923979,2147549184,63373334,131989515,65536,6,61997107,0,
+63438852,0,63504388,0,27787268,0,131072,0,62062592,0,6,61997107,0,2097156,0,63569920,0,63635456,0,3276800,0,62062592,0,4,61997107,0,2097156,0,63438852,0,62062592,0,4,61997107,0,2097156,0,63700999,0,62062592,
+0,4,2097152,0,16121856,0,3276800,0,30932999,0,5,61997107,0,2097156,0,63635456,0,1179648,0,62062592,0,6,61997107,0,63766532,0,19595271,0,2097156,0,62062592,0,44367876,0,16,61997107,0,1966082,0,63832066,
+0,22413316,0,22478852,0,655367,0,720903,0,2097156,0,63635456,0,1179648,0,63897607,0,22085693,0,22151172,0,22216704,0,22937600,0,62062592,0,4,61997107,0,63963140,0,64028676,0,62062592,0,4,61997107,0,63963140,
+0,131072,0,62062592,0,6,61997107,0,19595271,0,64094215,0,64159748,0,63963138,0,64225282,0,10,61997107,0,2097156,0,64290820,0,64356356,0,64421895,0,63111175,0,63176711,0,63242247,0,63307783,0,62062592,0,14,
+61997107,0,8847411,0,1966084,0,64487431,0,64552967,0,64618503,0,64684039,0,64749575,0,64815111,0,64880647,0,64946183,0,65011719,0,2097154,0,1441792,0,3,61997107,0,2097156,0,33357828,0,5,61997107,0,2097156,0,
+131072,0,65077255,0,62062592,0,24,61997107,0,62062592,0,65142786,0,65208322,0,65273856,0,65339392,0,65404928,0,65470464,0,65536000,0,65601536,0,65667072,0,1179648,0,65732615,0,65798151,0,65863687,0,65929223,0,65994759,
+0,66060295,0,66125831,0,66191367,0,66256903,0,66322439,0,66387975,0,66453511,0,5,61997107,0,62062592,0,66519047,0,66584578,0,2097154,0,8,66650119,0,58851335,0,66715655,0,58916871,0,66781191,0,66846727,0,2097154,
+0,33357826,0,10,66650119,0,58851335,0,66715655,0,58916871,0,66781191,0,66846727,0,2097154,0,33357826,0,63569920,0,1179648,0,8,66650119,0,58851335,0,66715655,0,58916871,0,66781191,0,66846727,0,2097154,0,33357826,
+0,7,61997107,0,62062592,0,25624583,0,66912263,0,2097154,0,16121858,0,131072,0,10,66977843,0,25624583,0,67043330,0,67108864,0,67174400,0,67239943,0,67305472,0,2097152,0,67371008,0,44367872,0,7,46399636,0,
+67436544,0,2097156,0,67502084,0,67567616,0,67633203,0,67698739,0,3,46399636,0,2097156,0,131072,0,6,46399636,0,2097156,0,131072,0,67567616,0,65077255,0,67633203,0,4,67764365,0,67829760,0,67895500,0,67960832,
+0,9,66977843,0,68026368,0,68091908,0,68157441,0,63635457,0,29229057,0,29163521,0,27787265,0,15532032,0,17,68222983,0,68288519,0,25690119,0,68354055,0,68419584,0,68485121,0,68550657,0,18808833,0,18874369,0,68616193,
+0,68681728,0,68747264,0,68812807,0,18481159,0,68878343,0,68943872,0,1179648,0,8,69009415,0,68288519,0,25690119,0,18808833,0,33292288,0,68681730,0,68354055,0,131072,0,22,1835215,0,1900751,0,1966082,0,69074946,
+0,68681730,0,2097154,0,69140484,0,69206020,0,131072,0,69271554,0,69337090,0,69402626,0,69468162,0,69533698,0,69599234,0,69664775,0,69730311,0,69796046,0,21430363,0,69861378,0,69926914,0,69992452,0,4,70057991,0,
+69074946,0,2097152,0,61341696,0,4,56885255,0,56950791,0,70123527,0,70189063,0,101,1835019,2147549184,4980762,1900555,65536,3801114,65536,3866655,65536,3932192,65536,3997696,65536,2097154,65536,2621444,65536,4063236,65536,4128772,65536,4194308,65536,4259844,
+65536,4325380,65536,4390916,65536,3735552,2147614720,4980762,4456478,4522008,2147549184,4980762,4587544,65536,4653067,65536,4718620,65536,4784154,65536,4849675,65536,4915233,65536,3604514,65536,24576098,2147483648,131923979,2147549184,70254614,131989515,65536,70320339,2147483648,70385715,0,70451251,0,70516787,
+0,70582484,0,70647938,0,70713557,0,9568263,0,9633799,0,1966082,0,70778880,0,15532032,0,70844418,0,70909959,0,70975495,0,71041028,0,71106562,0,71172098,0,2097156,0,71237639,0,71303175,0,71368711,0,69271554,0,69337090,
+0,71434242,0,71499778,0,71565316,0,71630852,0,71696384,0,71761920,0,71827456,0,71892992,0,71958528,0,72024064,0,72089600,0,61341696,0,37486599,0,72155143,0,50855943,0,72220679,0,72286215,0,72351751,0,72417287,0,72482823,
+0,72548359,0,72613895,0,61079556,0,72679428,0,72744964,0,72810500,0,2359300,0,72876032,0,72941782,0,73007104,0,73072855,0,73138391,0,73203927,0,73269463,0,73334993,0,73400324,0,73465860,0,73531600,0,70057991,2147549184,73597136,
+69074946,65536,2097152,65536,61341696,65536,12451847,2147483648,73662471,0,73728007,0,73793536,0,73859072,0,73924608,0,73990144,0,74055896,0,74121433,0,9,56885255,0,56950791,0,2097154,0,68485120,0,68550656,0,74186759,0,74252295,0,131072,
+0,74318037,0,16,74383362,0,74448898,0,57802756,0,28901594,0,57409754,0,74514650,0,2097156,0,57868292,0,66650119,2147549184,74580050,58851335,65536,66715655,65536,58916871,65536,66650119,2147549184,74645586,58851335,65536,66715655,65536,58916871,65536,29,74711044,
+0,29360244,2147549184,74776693,29425668,65536,131072,65536,3604598,65536,76153055,2147549184,74842332,76218372,65536,76283908,65536,76349444,65536,76414980,65536,76480737,65536,76546272,65536,76153055,2147549184,74907868,76218372,65536,76283908,65536,76349444,65536,76414980,65536,76480737,65536,76546272,65536,
+74973188,2147483648,75038724,0,131923979,2147549184,75104278,131989515,65536,75169796,2147483648,75235332,0,3604701,0,75300871,0,75366404,0,131072,0,65,1835019,2147549184,4980762,1900555,65536,3801114,65536,3866655,65536,3932192,65536,3997696,65536,2097154,65536,2621444,65536,4063236,
+65536,4128772,65536,4194308,65536,4259844,65536,4325380,65536,4390916,65536,3735552,2147614720,4980762,4456478,4522008,2147549184,4980762,4587544,65536,4653067,65536,4718620,65536,4784154,65536,4849675,65536,4915233,65536,3604514,65536,24576098,2147483648,74711044,2147549184,75432155,29360244,2147614720,75432155,
+74776693,29425668,131072,131072,131072,3604598,131072,76153055,2147614720,75432155,74842332,76218372,131072,76283908,131072,76349444,131072,76414980,131072,76480737,131072,76546272,131072,76153055,2147614720,75432155,74907868,76218372,131072,76283908,131072,76349444,131072,76414980,131072,76480737,131072,76546272,131072,74973188,
+2147549184,75432155,75038724,65536,131923979,2147614720,75432155,75104278,131989515,131072,75169796,2147549184,75432155,75235332,65536,3604701,65536,75300871,65536,75366404,65536,131072,65536,2097156,2147483648,75235332,0,70647938,0,71172098,0,75497472,0,75563008,0,131072,0,75628595,0,75694080,
+0,75759623,0,6356992,0,74121438,0,10,1966084,0,19595268,0,2097156,0,75825156,0,75890692,0,75956228,0,76021760,0,14876672,0,17891339,0,28967026,0,1,76087296,0,7,76153055,0,76218372,0,76283908,0,76349444,0,
+76414980,0,76480737,0,76546272,0,5,76611594,0,76677130,0,76742666,0,76808202,0,76873738,0,48,1835235,0,1900771,0,76939492,0,17891557,0,77004866,0,53608605,0,77070566,0,131923979,2147549184,77135894,131989515,65536,77201412,2147483648,2162688,
+0,77266946,0,1966082,0,77332482,0,77398018,0,77463554,0,77529090,0,27787268,0,77594628,0,77660164,0,77725700,0,6029316,0,6094852,0,77791239,0,77856999,0,77922304,0,77987844,0,78053380,0,78118919,0,78184455,0,78249991,
+0,78315527,0,78381063,0,78446599,0,78512135,0,78577671,0,78643207,0,78708743,0,78774279,0,78839815,0,78905351,0,78970887,0,79036423,0,6356992,0,79101952,0,79167488,0,79233024,0,79298560,0,7,79364328,0,131923979,2147549184,
+79429654,131989515,65536,79495170,2147483648,27787266,0,131072,0,79560704,0,22,79364328,0,79626474,0,27787268,0,79691780,0,60817415,0,60882951,0,60948487,0,37879815,0,79757319,0,79822855,0,79888391,0,79953927,0,80019590,0,80085126,0,
+80150530,0,80216066,0,80281602,0,3276800,0,80347143,0,80412679,0,80478215,0,80543751,0,6,1835243,0,1900779,0,1966082,0,2097154,0,80609282,0,2686976,0,8,1835244,0,1900780,0,1966082,0,2097154,0,80609282,0,
+2686976,0,2359303,0,18022407,0,45,1835245,0,1900781,0,1966082,0,2097154,0,80609282,0,80674818,0,80740354,0,80805890,0,80871431,0,22478855,0,80936967,0,81002500,0,81068036,0,81133572,0,81199111,0,81264647,0,81330183,
+0,81395719,0,81461255,0,81526791,0,81592327,0,81657863,0,81723399,0,81788935,0,81854471,0,131072,0,81920007,0,81985543,0,82051074,0,82116610,0,82182146,0,82247682,0,82313218,0,82378754,0,82444290,0,82509826,0,33357826,
+0,82575362,0,82640898,0,82706434,0,82771968,0,82837504,0,82903047,0,82968814,0,55377986,0,16,1835247,0,1900783,0,1966082,0,2097154,0,80609282,0,80674818,0,83034119,0,83099655,0,31195143,0,71237639,0,83165191,0,
+30277639,0,83230727,0,81592327,0,83296263,0,80936967,0,17,83361792,0,83427330,0,83492866,0,83558402,0,1441792,0,83624177,0,83689714,0,83755171,0,4653067,0,83820548,0,83886084,0,83951626,0,84017152,0,76087296,0,84082688,
+0,84148231,0,45481988,0,188,84214004,0,84279541,0,84345077,0,84410379,0,84475970,0,84541506,0,84607042,0,84672758,0,84738294,0,84803830,0,84869366,0,84934902,0,85000438,0,85065974,0,85131510,0,85197046,0,85262582,0,
+85328118,0,85393654,0,85459190,0,85524531,0,53608605,0,85590023,0,85655559,0,85721095,0,85786631,0,85852167,0,85917703,0,85983236,0,86048775,0,86114311,0,82903047,0,86179847,0,86245383,0,86310919,0,86376452,0,86441988,0,
+86507524,0,86573060,0,86638596,0,86704135,0,22740999,0,86769668,0,86835207,0,86900740,0,86966276,0,87031815,0,87097348,0,87162884,0,87228420,0,27787268,0,50593799,0,87293956,0,1966082,0,87359488,0,37879815,0,87425031,0,
+78053380,0,87490567,0,87556103,0,87621636,0,87687175,0,87752711,0,87818247,0,87883783,0,87949319,0,88014855,0,88080391,0,88145927,0,88211463,0,88276996,0,88342532,0,34930688,0,88408071,0,88473604,0,88539140,0,88604676,0,
+79822855,0,88670215,0,88735751,0,88801287,0,88866823,0,88932356,0,88997890,0,89063424,0,89128967,0,89194496,0,89260039,0,89325575,0,89391108,0,89456647,0,89522183,0,89587719,0,89653252,0,89718788,0,89784324,0,89849858,0,
+89915392,0,89980932,0,90046468,0,90112007,0,90177543,0,90243079,0,90308615,0,90374151,0,90439687,0,90505220,0,90570756,0,90636295,0,90701831,0,90767367,0,90832903,0,90898436,0,90963972,0,91029504,0,91095040,0,52690944,0,
+91160583,0,91226116,0,91291655,0,91357188,0,91422722,0,91488256,0,91553796,0,91619332,0,91684868,0,91750404,0,91815940,0,91881476,0,91947012,0,92012548,0,92078084,0,92143616,0,92209152,0,92274688,0,92340224,0,92405760,0,
+79560704,0,92471298,0,92536832,0,92602368,0,50659335,0,92667911,0,92733447,0,92798983,0,51380231,0,92864519,0,92930052,0,92995588,0,93061127,0,93126663,0,93192199,0,93257735,0,93323398,0,93388807,0,93454343,0,93519879,0,
+93585415,0,93650944,0,93716480,0,93782016,0,93847552,0,93913088,0,93978624,0,94044160,0,94109696,0,94175232,0,94240768,0,94306304,0,94371840,0,94437376,0,94502912,0,94568455,0,94633988,0,94699527,0,94765056,0,94830592,0,
+94896132,0,94961664,0,95027430,0,131923979,2147549184,95092758,131989515,65536,131923979,65537,131989515,65537,95158276,2147483648,95223812,0,95289344,0,95354880,0,31,84214004,0,95420664,0,79626474,0,95486183,0,95551495,0,95617028,0,95682567,0,95748103,0,
+95813639,0,95879175,0,14876672,0,38207495,0,6160391,0,95944711,0,60489735,0,96010247,0,96075783,0,96141319,0,96206852,0,96272391,0,96337927,0,6356992,0,79101952,0,34930688,0,96403458,0,1966082,0,96468994,0,46661634,0,
+96534530,0,96600066,0,27787268,0,12,84214004,0,95420664,0,95551495,0,95617028,0,96075783,0,27787268,0,96206852,0,1966082,0,16384000,0,95682567,0,96665602,0,34537472,0,14,1835258,0,1900794,0,2162688,0,27787268,0,
+96731140,0,96796674,0,22937600,0,96862212,0,96927748,0,96993284,0,97058820,0,6356992,0,55377986,0,97124603,0,5,1835260,0,1900796,0,97190041,0,97255426,0,1441792,0,10,131923979,2147549184,97320982,131989515,65536,16121860,2147483648,97386500,
+0,27787268,0,97452039,0,97517575,0,97583111,0,131923979,2147549184,97648662,131989515,65536,12,56885255,0,56950791,0,97714183,0,44630023,0,19464199,0,18743303,0,2097156,0,97779719,0,97845255,0,97910791,0,97976327,0,6356992,0,1,
+98041860,0,7,1835264,0,1900800,0,98107392,0,98172935,0,98238471,0,2097154,0,1441792,0,7,1835265,0,1900801,0,131923979,2147549184,44433430,131989515,65536,98107392,2147483648,2097154,0,1441792,0,26,68222983,2147549184,98304091,68288519,65536,25690119,
+65536,68354055,65536,68419584,65536,68485121,65536,68550657,65536,18808833,65536,18874369,65536,68616193,65536,68681728,65536,68747264,65536,68812807,65536,18481159,65536,68878343,65536,68943872,65536,1179648,65536,44630023,2147483648,19464199,0,98369540,0,2097156,0,97779719,0,97845255,
+0,97910791,0,97976327,0,131072,0,4,98435330,0,98500612,0,2097154,0,3276800,0,9,98566144,0,98631687,0,98697220,0,98762756,0,98828292,0,98893828,0,56033284,0,98959621,0,5308427,0,35,1835269,0,1900805,0,
+5898494,0,99025151,0,99090436,0,99155972,0,99221506,0,2097154,0,3276802,0,99287048,0,99352576,0,69074948,0,99418114,0,34078727,0,34144263,0,99483655,0,99549191,0,99614727,0,99680263,0,99745796,0,99811328,0,99877126,0,
+99942411,0,100007943,0,100073731,0,98566144,2147549184,12189956,98631687,65536,98697220,65536,98762756,65536,98828292,65536,98893828,65536,56033284,65536,98959621,65536,5308427,65536,100139019,2147483648,2,100204548,0,100270084,0,9,1835272,0,1900808,0,131923979,2147549184,100335638,
+131989515,65536,100401156,2147483648,2097154,0,100466690,0,100204548,2147549184,12189959,100270084,65536,6,1835273,0,1900809,0,100532224,0,2097154,0,100597762,0,131072,0,2,4128772,0,131072,0,39,1835275,0,1900811,0,131923979,2147549184,100663318,131989515,
+65536,100729096,2147483648,2097154,0,100794370,0,98172935,0,98238471,0,100859904,0,99221506,0,100925442,0,8781875,0,100990983,0,101056512,0,101122050,0,101187586,0,101253127,0,101318663,0,101384192,0,101449732,0,101515271,0,101580802,0,101646338,
+0,101711879,0,101777415,0,14876672,0,131923979,2147549184,101842966,131989515,65536,101908484,2147483648,6356992,0,101974023,0,102039559,0,102105095,0,102170631,0,102236167,0,34930688,0,4128772,2147549184,12189962,131072,65536,14,102301965,0,102367234,0,102432770,0,
+102498306,0,22937600,0,102563844,0,102629380,0,100007943,0,99483655,0,102694919,0,102760455,0,102825988,0,102891524,0,131072,0,6,6160391,0,102957063,0,46530567,0,14876672,0,103022596,0,131072,0,75,1835019,2147549184,4980762,1900555,
+65536,3801114,65536,3866655,65536,3932192,65536,3997696,65536,2097154,65536,2621444,65536,4063236,65536,4128772,65536,4194308,65536,4259844,65536,4325380,65536,4390916,65536,3735552,2147614720,4980762,4456478,4522008,2147549184,4980762,4587544,65536,4653067,65536,4718620,65536,4784154,65536,
+4849675,65536,4915233,65536,3604514,65536,24576098,2147483648,131923979,2147549184,45023254,131989515,65536,2097156,2147483648,103088132,0,103153671,0,103219207,0,131923979,2147549184,103284758,131989515,65536,131923979,2147549184,75104278,131989515,65536,103350279,2147483648,103415815,0,103481351,0,103546884,0,100794372,
+0,101580802,0,101646338,0,101711879,0,101777415,0,103612423,0,70647938,0,71172098,0,76283906,0,103677954,0,87359488,0,103743492,0,57081860,0,103809026,0,103874562,0,103940100,0,75169796,0,6160391,2147549184,104005902,102957063,65536,46530567,65536,
+14876672,65536,103022596,65536,131072,65536,102301965,2147549184,12189964,102367234,65536,102432770,65536,102498306,65536,22937600,65536,102563844,65536,102629380,65536,100007943,65536,99483655,65536,102694919,65536,102760455,65536,102825988,65536,102891524,65536,131072,65536,9,1835280,0,1900816,0,
+1966084,0,16121860,0,2228224,0,2097154,0,17956866,0,2162688,0,104071168,0,27,1835280,2147549184,104136976,1900816,65536,1966084,65536,16121860,65536,2228224,65536,2097154,65536,17956866,65536,2162688,65536,104071168,65536,35848322,2147483648,104202240,0,104267776,0,
+104333312,0,100925444,0,2097156,0,104398855,0,104464391,0,104529927,0,104595463,0,88342535,0,104660999,0,104726530,0,3276800,0,917508,0,104792068,0,81133572,0,104857729,0,18,1835280,2147549184,104136976,1900816,65536,1966084,65536,16121860,65536,
+2228224,65536,2097154,65536,17956866,65536,2162688,65536,104071168,65536,35848322,2147483648,104202240,0,104267776,0,100925444,0,2097156,0,30212100,0,104792068,0,1966082,0,1441792,0,20,1835280,2147549184,104136976,1900816,65536,1966084,65536,16121860,65536,2228224,65536,
+2097154,65536,17956866,65536,2162688,65536,104071168,65536,35848322,2147483648,104202240,0,104267776,0,104333312,0,100925444,0,2097156,0,104923143,0,99221508,0,104792068,0,131072,0,104988801,0,6,2162688,0,105054485,0,105119748,0,105185284,0,105250820,
+0,105316356,0,22,1835280,2147549184,104136976,1900816,65536,1966084,65536,16121860,65536,2228224,65536,2097154,65536,17956866,65536,2162688,65536,104071168,65536,35848322,2147483648,104202240,0,104792068,0,2097156,0,19595268,0,105381895,0,16121860,0,18022404,0,18087940,
+0,131072,0,74514708,0,74448900,0,105447428,0,20,1835280,2147549184,104136976,1900816,65536,1966084,65536,16121860,65536,2228224,65536,2097154,65536,17956866,65536,2162688,65536,104071168,65536,35848322,2147483648,104202240,0,104267776,0,100925444,0,2097156,0,105512967,
+0,105578496,0,1179648,0,104792068,0,14876672,0,104857729,0,21,1835280,2147549184,104136976,1900816,65536,1966084,65536,16121860,65536,2228224,65536,2097154,65536,17956866,65536,2162688,65536,104071168,65536,35848322,2147483648,104202240,0,104267776,0,104333312,0,100925444,
+0,2097156,0,104398855,0,105578496,0,1179648,0,104792068,0,105644039,0,104857729,0,19,1835280,2147549184,104136976,1900816,65536,1966084,65536,16121860,65536,2228224,65536,2097154,65536,17956866,65536,2162688,65536,104071168,65536,105709619,2147483648,35848322,0,104202240,
+0,100925444,0,2097156,0,99221508,0,105775111,0,105840644,0,104792068,0,105906306,0,25,1835280,2147549184,104136976,1900816,65536,1966084,65536,16121860,65536,2228224,65536,2097154,65536,17956866,65536,2162688,65536,104071168,65536,105709619,2147483648,35848322,0,105971716,
+0,2097156,0,66519047,0,85983239,0,106037255,0,106102791,0,106168327,0,131072,0,81133572,0,100925444,0,104202240,0,104267776,0,106233860,0,104792068,0,32,1835280,2147549184,104136976,1900816,65536,1966084,65536,16121860,65536,2228224,65536,2097154,
+65536,17956866,65536,2162688,65536,104071168,65536,35848322,2147483648,104202240,0,100925444,0,104267776,0,104792068,0,6029319,0,6094855,0,106299399,0,5963783,0,2097154,0,16121858,0,106364930,0,106430466,0,106496007,0,106561543,0,106627074,0,1441792,
+0,105709619,0,106692615,0,106758151,0,106823680,0,106889223,0,106954759,0,19,1835280,2147549184,104136976,1900816,65536,1966084,65536,16121860,65536,2228224,65536,2097154,65536,17956866,65536,2162688,65536,104071168,65536,105709619,2147483648,35848322,0,104202240,0,104267776,
+0,104333312,0,100925444,0,2097156,0,19464199,0,104792068,0,107020572,0,27,1835280,2147549184,104136976,1900816,65536,1966084,65536,16121860,65536,2228224,65536,2097154,65536,17956866,65536,2162688,65536,104071168,65536,35848322,2147483648,104202240,0,100925444,0,2097156,
+0,104792068,0,107085831,0,107151367,0,107216903,0,107282439,0,107347975,0,107413511,0,81133572,0,917508,0,16121860,0,131072,0,107479047,0,107544583,0,107610119,0,8,2162688,0,107675935,0,107741188,0,107806724,0,68354055,0,
+101318663,0,69074948,0,2097156,0,18,1835280,2147549184,104136976,1900816,65536,1966084,65536,16121860,65536,2228224,65536,2097154,65536,17956866,65536,2162688,65536,104071168,65536,35848322,2147483648,104202240,0,100925444,0,2097156,0,104792068,0,107872260,0,74514718,0,
+74448900,0,105447428,0,17,1835280,2147549184,104136976,1900816,65536,1966084,65536,16121860,65536,2228224,65536,2097154,65536,17956866,65536,2162688,65536,104071168,65536,105709619,2147483648,35848322,0,104202240,0,104267776,0,100925444,0,2097156,0,104792068,0,131072,0,
+26,1835280,2147549184,104136976,1900816,65536,1966084,65536,16121860,65536,2228224,65536,2097154,65536,17956866,65536,2162688,65536,104071168,65536,105709619,2147483648,35848322,0,62062592,0,104202240,0,104267776,0,104333312,0,100925444,0,104792068,0,131072,0,2097156,0,
+107937792,0,7733248,0,108003335,0,108068871,0,30998535,0,108134407,0,108200065,0,21,1835280,2147549184,104136976,1900816,65536,1966084,65536,16121860,65536,2228224,65536,2097154,65536,17956866,65536,2162688,65536,104071168,65536,35848322,2147483648,104202240,0,104267776,0,
+100925444,0,2097156,0,104398855,0,16121858,0,917506,0,104792068,0,5963783,0,43450375,0,30015495,0,27,1835280,2147549184,104136976,1900816,65536,1966084,65536,16121860,65536,2228224,65536,2097154,65536,17956866,65536,2162688,65536,104071168,65536,35848322,2147483648,
+104202240,0,104267776,0,104333312,0,100925444,0,2097156,0,9568263,0,108265479,0,102105095,0,106037255,0,106102791,0,106168327,0,81133572,0,16121860,0,108331012,0,108396548,0,104792068,0,131072,0,20,1835280,2147549184,104136976,1900816,65536,
+1966084,65536,16121860,65536,2228224,65536,2097154,65536,17956866,65536,2162688,65536,104071168,65536,35848322,2147483648,104202240,0,104267776,0,104333312,0,100925444,0,2097156,0,104398855,0,917508,0,104792068,0,14876672,0,104857729,0,15,1835280,2147549184,104136976,
+1900816,65536,1966084,65536,16121860,65536,2228224,65536,2097154,65536,17956866,65536,2162688,65536,104071168,65536,27131906,2147483648,108462082,0,44367876,0,105709619,0,108527623,0,104333312,0,22,1835280,2147549184,104136976,1900816,65536,1966084,65536,16121860,65536,2228224,65536,
+2097154,65536,17956866,65536,2162688,65536,104071168,65536,35848322,2147483648,104202240,0,104267776,0,100925444,0,2097156,0,104792068,0,27787268,0,108593156,0,30015495,0,19595271,0,108658695,0,108724231,0,108789767,0,24,1835280,2147549184,104136976,1900816,65536,
+1966084,65536,16121860,65536,2228224,65536,2097154,65536,17956866,65536,2162688,65536,104071168,65536,105709619,2147483648,35848322,0,104202240,0,104267776,0,104333312,0,100925444,0,104792068,0,2097156,0,16121860,0,104398855,0,68354055,0,38535175,0,1966084,0,
+104857729,0,108855430,0,25,1835280,2147549184,104136976,1900816,65536,1966084,65536,16121860,65536,2228224,65536,2097154,65536,17956866,65536,2162688,65536,104071168,65536,35848322,2147483648,104202240,0,104267776,0,104333312,0,100925444,0,2097156,0,108920839,0,99680263,0,
+108986375,0,109051911,0,109117447,0,104792068,0,109182978,0,16121858,0,109248519,0,131072,0,20,1835280,2147549184,104136976,1900816,65536,1966084,65536,16121860,65536,2228224,65536,2097154,65536,17956866,65536,2162688,65536,104071168,65536,106823680,2147483648,35848322,0,
+104202240,0,104333312,0,100925444,0,2097156,0,109314055,0,104792068,0,109379591,0,109445127,0,105709619,0,20,1835280,2147549184,104136976,1900816,65536,1966084,65536,16121860,65536,2228224,65536,2097154,65536,17956866,65536,2162688,65536,104071168,65536,106823680,2147483648,
+35848322,0,104202240,0,104333312,0,100925444,0,2097156,0,109314055,0,104792068,0,109510658,0,62193666,0,109576199,0,50,1835280,2147549184,104136976,1900816,65536,1966084,65536,16121860,65536,2228224,65536,2097154,65536,17956866,65536,2162688,65536,104071168,65536,
+109641731,2147483648,109707264,0,109772800,0,109838338,0,109903874,0,109969459,0,110034995,0,110100531,0,110166082,0,110231682,0,110297088,0,110362624,0,104333312,0,110428167,0,110493703,0,110559239,0,110624775,0,110690311,0,101318663,0,99221506,0,
+110755840,0,110821376,0,110886912,0,110952448,0,111017984,0,61341696,0,111083527,0,111149063,0,111214599,0,111280135,0,111345668,0,27787268,0,111411207,0,111476736,0,111542272,0,111607810,0,111673344,0,111738880,0,87359488,0,50331948,0,
+111804717,0,28,1835280,2147549184,104136976,1900816,65536,1966084,65536,16121860,65536,2228224,65536,2097154,65536,17956866,65536,2162688,65536,104071168,65536,66977843,2147483648,111870003,0,35848322,0,104202240,0,104333312,0,100925444,0,2097156,0,104792068,0,111935495,0,
+112001026,0,112066560,0,112132096,0,112197639,0,112263168,0,112328704,0,1441792,0,112394247,0,112459780,0,107020591,0,22,1835280,2147549184,104136976,1900816,65536,1966084,65536,16121860,65536,2228224,65536,2097154,65536,17956866,65536,2162688,65536,104071168,65536,
+35848322,2147483648,104202240,0,104333312,0,100925444,0,2097156,0,16121860,0,69074948,0,99221511,0,19464199,0,112525316,0,104792068,0,112590852,0,131072,0,8,46858247,0,112656391,0,112721927,0,112787463,0,46596103,0,112852999,0,112918532,
+0,112984068,0,3,1966092,0,1179648,0,2097156,0,33,1966092,2147549184,459057,1179648,65536,2097156,65536,74711044,2147549184,75432155,29360244,2147614720,75432155,74776693,29425668,131072,131072,131072,3604598,131072,76153055,2147614720,75432155,74842332,76218372,131072,76283908,131072,76349444,
+131072,76414980,131072,76480737,131072,76546272,131072,76153055,2147614720,75432155,74907868,76218372,131072,76283908,131072,76349444,131072,76414980,131072,76480737,131072,76546272,131072,74973188,2147549184,75432155,75038724,65536,131923979,2147614720,75432155,75104278,131989515,131072,75169796,2147549184,75432155,75235332,65536,3604701,
+65536,75300871,65536,75366404,65536,131072,65536,3604787,2147483648,4,1966092,2147549184,459057,1179648,65536,2097156,65536,113049909,2147483648,4,113115140,0,2097156,0,1966092,0,1179648,0,4,82968580,0,113180982,0,19398660,0,2097156,0,5,1835320,0,
+1900856,0,113246208,0,2097155,0,1441792,0,8,1835321,0,1900857,0,8782138,0,262144,0,1966092,0,29097984,0,6160391,0,2097156,0,28,1835321,2147549184,459065,1900857,65536,8782138,65536,262144,65536,1966092,65536,29097984,65536,6160391,
+65536,2097156,65536,82968580,2147549184,113312055,113180982,65536,19398660,65536,2097156,65536,101449740,2147483648,1179648,0,101318663,0,131923979,2147549184,113377302,131989515,65536,113442820,2147483648,6356992,0,8781875,0,113508352,0,108003335,0,113573895,0,102039559,0,102105095,0,34930688,
+0,113639424,0,3604796,0,13,1835321,2147549184,459065,1900857,65536,8782138,65536,262144,65536,1966092,65536,29097984,65536,6160391,65536,2097156,65536,131923979,2147549184,56229910,131989515,65536,56492044,2147483648,29097984,0,3604797,0,10,101318663,0,16121868,0,2097153,
+0,113704961,0,61341696,0,113770498,0,113836034,0,113901575,0,113967111,0,6356992,0,61,1835019,2147549184,4980762,1900555,65536,3801114,65536,3866655,65536,3932192,65536,3997696,65536,2097154,65536,2621444,65536,4063236,65536,4128772,65536,4194308,65536,4259844,
+65536,4325380,65536,4390916,65536,3735552,2147614720,4980762,4456478,4522008,2147549184,4980762,4587544,65536,4653067,65536,4718620,65536,4784154,65536,4849675,65536,4915233,65536,3604514,65536,24576098,2147483648,114032945,0,114098180,0,131072,0,114164026,0,76153055,2147549184,114229468,76218372,
+65536,76283908,65536,76349444,65536,76414980,65536,76480737,65536,76546272,65536,29360244,2147549184,74776693,29425668,65536,131072,65536,3604598,65536,75235332,2147483648,6356992,0,114295097,0,114360450,0,114425858,0,114491392,0,2097156,0,131923979,2147549184,75104278,131989515,65536,75169796,
+2147483648,99811328,0,101318663,2147549184,114557246,16121868,65536,2097153,65536,113704961,65536,61341696,65536,113770498,65536,113836034,65536,113901575,65536,113967111,65536,6356992,65536,3604799,2147483648,13,114622706,0,114688004,0,100663300,0,19595268,0,18022404,0,114753536,0,114819072,
+0,114884610,0,114950148,0,115015682,0,115081218,0,26017794,0,2097154,0,3,1835328,0,1900864,0,115147073,0,4,1835330,0,1900866,0,2162688,0,44892160,0,6,1835331,0,1900867,0,5242915,0,115081220,0,115212292,0,
+44892160,0,4,1835332,0,1900868,0,2162688,0,115278149,0,4,115343364,0,44367876,0,115408900,0,115474436,0,14,1835335,0,1900871,0,115343364,2147549184,12190022,44367876,65536,115408900,65536,115474436,65536,115212292,2147483648,115539972,0,115605508,0,
+115671040,0,115736576,0,115802114,0,115867655,0,115933184,0,63,1835019,2147549184,4980762,1900555,65536,3801114,65536,3866655,65536,3932192,65536,3997696,65536,2097154,65536,2621444,65536,4063236,65536,4128772,65536,4194308,65536,4259844,65536,4325380,65536,4390916,65536,
+3735552,2147614720,4980762,4456478,4522008,2147549184,4980762,4587544,65536,4653067,65536,4718620,65536,4784154,65536,4849675,65536,4915233,65536,3604514,65536,24576098,2147483648,5046272,0,131923979,2147549184,115998742,131989515,65536,116064581,2147483648,131923979,2147549184,116129814,131989515,65536,116195330,2147483648,116260866,
+0,2097156,0,46661634,0,1966082,0,116326404,0,116391938,0,87359488,0,5242915,0,131923979,2147549184,116457494,131989515,65536,15073317,2147483648,34930688,0,115539972,0,115605508,0,115671040,0,115736576,0,115802114,0,115867655,0,116523015,0,116588551,0,
+2162688,2147549184,116654251,116719616,2147483648,44367872,0,116785152,0,116850688,0,116916228,0,131923979,2147549184,116981782,131989515,65536,131923979,2147549184,117047318,131989515,65536,117113160,2147483648,3604809,0,15,1835338,0,1900874,0,61079559,0,20840455,0,1966082,0,22937600,0,
+117178370,0,2097154,0,117243908,0,75956228,0,17891339,0,2162688,0,117309440,0,117374983,0,117440519,0,37,1835019,2147549184,4980762,1900555,65536,3801114,65536,3866655,65536,3932192,65536,3997696,65536,2097154,65536,2621444,65536,4063236,65536,4128772,65536,
+4194308,65536,4259844,65536,4325380,65536,4390916,65536,3735552,2147614720,4980762,4456478,4522008,2147549184,4980762,4587544,65536,4653067,65536,4718620,65536,4784154,65536,4849675,65536,4915233,65536,3604514,65536,24576098,2147483648,117506378,0,117571584,0,117637124,0,131072,0,131923979,
+2147549184,117702678,131989515,65536,117768218,2147483648,81068036,0,2097154,0,1966080,0,49479680,0,12451847,0,117833732,0,52,1835019,2147549184,4980762,1900555,65536,3801114,65536,3866655,65536,3932192,65536,3997696,65536,2097154,65536,2621444,65536,4063236,65536,4128772,65536,
+4194308,65536,4259844,65536,4325380,65536,4390916,65536,3735552,2147614720,4980762,4456478,4522008,2147549184,4980762,4587544,65536,4653067,65536,4718620,65536,4784154,65536,4849675,65536,4915233,65536,3604514,65536,24576098,2147483648,69140482,0,69206018,0,117899266,0,2097154,0,117964802,
+0,118030338,0,118095874,0,45481984,0,118161408,0,118226944,0,118292480,0,118358020,0,118423559,0,118489095,0,118554631,0,118620167,0,118685703,0,118751239,0,118816974,0,70582484,0,99877126,0,117309440,0,131923979,2147549184,75104278,131989515,65536,
+75169796,2147483648,2228224,0,118882636,0,74121549,0,11,1835342,0,1900878,0,105709619,0,118948174,0,119013380,0,2097154,0,119078914,0,119144450,0,119209986,0,119275522,0,22937600,0,11,1835343,0,1900879,0,55836738,0,4653067,0,
+2097154,0,119341058,0,131072,0,131923979,2147549184,119406614,131989515,65536,119275522,2147483648,45481986,0,2,119472132,0,119537671,0,5,1835345,0,1900881,0,2162688,0,2097156,0,1966084,0,3,1835346,0,1900882,0,2162688,0,1,2162688,
+0,43,1835171,0,1900707,0,2162688,0,2097154,0,1441792,0,131923979,2147549184,119603222,131989515,65536,119669076,2147483648,119734606,0,131923979,2147549184,119406614,131989515,65536,26673487,2147483648,119799812,0,119865348,0,119930887,0,119996418,0,120061954,0,120127492,0,
+120193028,0,120258690,0,120324437,0,120389656,0,4587544,0,131923979,2147614720,120455421,97320982,131989515,131072,16121860,2147549184,120455421,97386500,65536,27787268,65536,97452039,65536,97517575,65536,97583111,65536,131923979,2147614720,120455421,97648662,131989515,131072,119472132,2147549184,120521040,119537671,65536,
+131923979,2147549184,120586262,131989515,65536,120652113,2147483648,131923979,2147549184,120717334,131989515,65536,120783186,2147483648,120848718,0,120914262,0,63,1835019,2147549184,4980762,1900555,65536,3801114,65536,3866655,65536,3932192,65536,3997696,65536,2097154,65536,2621444,65536,4063236,65536,4128772,65536,
+4194308,65536,4259844,65536,4325380,65536,4390916,65536,3735552,2147614720,4980762,4456478,4522008,2147549184,4980762,4587544,65536,4653067,65536,4718620,65536,4784154,65536,4849675,65536,4915233,65536,3604514,65536,24576098,2147483648,1966082,0,2097154,0,16121860,0,60817415,0,60882951,
+0,60948487,0,60489735,0,120979463,0,60358663,0,68354055,0,121044999,0,121110535,0,121176066,0,121241602,0,121307143,0,121372679,0,121438215,0,121503751,0,121569287,0,121634818,0,121700354,0,47644679,0,47710215,0,121765895,0,121831431,
+0,121896967,0,121962500,0,122028039,0,122093575,0,122159111,0,122224647,0,122290183,0,122355719,0,122421255,0,122486791,0,15073317,0,122552664,0,122617863,0,49479687,0,57,1835019,2147549184,4980762,1900555,65536,3801114,65536,3866655,65536,3932192,
+65536,3997696,65536,2097154,65536,2621444,65536,4063236,65536,4128772,65536,4194308,65536,4259844,65536,4325380,65536,4390916,65536,3735552,2147614720,4980762,4456478,4522008,2147549184,4980762,4587544,65536,4653067,65536,4718620,65536,4784154,65536,4849675,65536,4915233,65536,3604514,65536,
+24576098,2147483648,1966080,0,2097152,0,122683392,0,122748928,0,122814464,0,17170432,0,122880007,0,122945543,0,30998535,0,47644679,0,47710215,0,123011079,0,123076615,0,123142151,0,123207687,0,123273220,0,123338756,0,123404292,0,123469828,0,
+123535367,0,123600903,0,123666439,0,123731975,0,123797511,0,123863047,0,123928583,0,123994119,0,124059655,0,124125191,0,124190724,0,124256322,0,124321799,0,14876672,0,7,124387335,0,122748935,0,124452871,0,122683399,0,114491399,0,124518407,
+0,124583943,0,15,124649479,0,124715012,0,19595268,0,124780551,0,124846087,0,124911623,0,124977159,0,125042695,0,125108231,0,125173767,0,125239303,0,125304839,0,125370375,0,125435911,0,125501447,0,6,125567222,0,17891328,0,125632516,
+0,29163520,0,125698048,0,3276800,0,24,2097156,0,125763588,0,1966084,0,125829124,0,125894660,0,125960196,0,126025732,0,126091268,0,126156800,0,125567222,2147549184,126222684,17891328,65536,125632516,65536,29163520,65536,125698048,65536,3276800,65536,125567222,
+2147549184,126288220,17891328,65536,125632516,65536,29163520,65536,125698048,65536,3276800,65536,126353756,2147483648,126419290,0,126484827,0,6,126550023,0,126615559,0,126681095,0,126746631,0,126812167,0,126877703,0,4,126550023,0,126615559,0,126681095,0,126746631,0,
+4,126943239,0,127008775,0,127074311,0,127139847,0,1,126812161,0,2,66519044,0,30212100,0,23,9633796,0,127205380,0,127270916,0,127336452,0,127402338,0,126550023,2147549184,127467870,126615559,65536,126681095,65536,126746631,65536,126812167,65536,126877703,
+65536,126550023,2147549184,127533407,126615559,65536,126681095,65536,126746631,65536,126943239,2147549184,127598944,127008775,65536,127074311,65536,127139847,65536,126812161,2147549184,127664481,131072,2147483648,127729668,0,127795211,0,5,92471300,0,127860736,0,127926272,0,2686976,0,127992163,0,7,
+1835365,0,1900901,0,2162688,0,1966084,0,16515079,0,27787268,0,36962308,0,8,1835365,2147549184,104137061,1900901,65536,2162688,65536,1966084,65536,16515079,65536,27787268,65536,36962308,65536,128057478,2147483648,10,1835365,2147549184,104137061,1900901,65536,2162688,65536,
+1966084,65536,16515079,65536,27787268,65536,36962308,65536,17825921,2147483648,27787268,0,131072,0,12,1835365,2147549184,104137061,1900901,65536,2162688,65536,1966084,65536,16515079,65536,27787268,65536,36962308,65536,17825921,2147483648,27787268,0,128122887,0,128188423,0,131072,0,
+10,1835365,2147549184,104137061,1900901,65536,2162688,65536,1966084,65536,16515079,65536,27787268,65536,36962308,65536,128057478,2147483648,128253959,0,128319495,0,12,1835365,2147549184,104137061,1900901,65536,2162688,65536,1966084,65536,16515079,65536,27787268,65536,36962308,65536,17825921,2147483648,
+27787268,0,128253959,0,128319495,0,131072,0,14,1835365,2147549184,104137061,1900901,65536,2162688,65536,1966084,65536,16515079,65536,27787268,65536,36962308,65536,17825921,2147483648,27787268,0,128253959,0,128319495,0,128122887,0,128188423,0,131072,0,11,1835365,
+2147549184,104137061,1900901,65536,2162688,65536,1966084,65536,16515079,65536,27787268,65536,36962308,65536,66977843,2147483648,128057478,0,128253959,0,128319495,0,13,1835365,2147549184,104137061,1900901,65536,2162688,65536,1966084,65536,16515079,65536,27787268,65536,36962308,65536,66977843,2147483648,
+17825921,0,27787268,0,128253959,0,128319495,0,131072,0,15,1835365,2147549184,104137061,1900901,65536,2162688,65536,1966084,65536,16515079,65536,27787268,65536,36962308,65536,66977843,2147483648,17825921,0,27787268,0,128253959,0,128319495,0,128122887,0,128188423,0,
+131072,0,12,1835365,2147549184,104137061,1900901,65536,2162688,65536,1966084,65536,16515079,65536,27787268,65536,36962308,65536,128385031,2147483648,128450567,0,128057478,0,128253959,0,128319495,0,12,1835365,2147549184,104137061,1900901,65536,2162688,65536,1966084,65536,16515079,65536,
+27787268,65536,36962308,65536,17825921,2147483648,27787268,0,128385031,0,128450567,0,131072,0,14,1835365,2147549184,104137061,1900901,65536,2162688,65536,1966084,65536,16515079,65536,27787268,65536,36962308,65536,17825921,2147483648,27787268,0,131072,0,128385031,0,128450567,0,
+128516103,0,128581639,0,12,1835365,2147549184,104137061,1900901,65536,2162688,65536,1966084,65536,16515079,65536,27787268,65536,36962308,65536,128057478,2147483648,68878343,0,18481159,0,81133572,0,131072,0,12,1835365,2147549184,104137061,1900901,65536,2162688,65536,1966084,65536,
+16515079,65536,27787268,65536,36962308,65536,17825921,2147483648,27787268,0,68878343,0,18481159,0,81133572,0,11,1835365,2147549184,104137061,1900901,65536,2162688,65536,1966084,65536,16515079,65536,27787268,65536,36962308,65536,68878343,2147483648,18481159,0,27787268,0,81133572,0,
+10,1835365,2147549184,104137061,1900901,65536,2162688,65536,1966084,65536,16515079,65536,27787268,65536,36962308,65536,128057478,2147483648,128647175,0,107610119,0,12,1835365,2147549184,104137061,1900901,65536,2162688,65536,1966084,65536,16515079,65536,27787268,65536,36962308,65536,17825921,2147483648,
+27787268,0,128647175,0,107610119,0,131072,0,14,1835365,2147549184,104137061,1900901,65536,2162688,65536,1966084,65536,16515079,65536,27787268,65536,36962308,65536,17825921,2147483648,27787268,0,131072,0,128647175,0,107610119,0,128516103,0,128581639,0,8,1835365,
+2147549184,104137061,1900901,65536,2162688,65536,1966084,65536,16515079,65536,27787268,65536,36962308,65536,128057478,2147483648,10,1835365,2147549184,104137061,1900901,65536,2162688,65536,1966084,65536,16515079,65536,27787268,65536,36962308,65536,17825921,2147483648,27787268,0,131072,0,12,1835365,
+2147549184,104137061,1900901,65536,2162688,65536,1966084,65536,16515079,65536,27787268,65536,36962308,65536,17825921,2147483648,27787268,0,128516103,0,128581639,0,131072,0,10,1835365,2147549184,104137061,1900901,65536,2162688,65536,1966084,65536,16515079,65536,27787268,65536,36962308,65536,
+128057478,2147483648,27787268,0,128712708,0,10,1835365,2147549184,104137061,1900901,65536,2162688,65536,1966084,65536,16515079,65536,27787268,65536,36962308,65536,17825921,2147483648,27787268,0,128712708,0,12,1835365,2147549184,104137061,1900901,65536,2162688,65536,1966084,65536,16515079,65536,
+27787268,65536,36962308,65536,17825921,2147483648,27787268,0,128122887,0,128188423,0,128712708,0,9,1835365,2147549184,104137061,1900901,65536,2162688,65536,1966084,65536,16515079,65536,27787268,65536,36962308,65536,128778247,2147483648,131072,0,9,1835365,2147549184,104137061,1900901,65536,
+2162688,65536,1966084,65536,16515079,65536,27787268,65536,36962308,65536,128843783,2147483648,131072,0,11,1835365,2147549184,104137061,1900901,65536,2162688,65536,1966084,65536,16515079,65536,27787268,65536,36962308,65536,128909319,2147483648,18481159,0,19529735,0,131072,0,11,1835365,
+2147549184,104137061,1900901,65536,2162688,65536,1966084,65536,16515079,65536,27787268,65536,36962308,65536,18481159,2147483648,22740999,0,128974852,0,27787268,0,13,1835365,2147549184,104137061,1900901,65536,2162688,65536,1966084,65536,16515079,65536,27787268,65536,36962308,65536,129040391,2147483648,
+18481159,0,109576199,0,128974852,0,81133572,0,14876672,0,13,1835365,2147549184,104137061,1900901,65536,2162688,65536,1966084,65536,16515079,65536,27787268,65536,36962308,65536,129040391,2147483648,18481159,0,109576199,0,128974852,0,81133572,0,14876672,0,9,1835365,
+2147549184,104137061,1900901,65536,2162688,65536,1966084,65536,16515079,65536,27787268,65536,36962308,65536,129105927,2147483648,131072,0,9,1835365,2147549184,104137061,1900901,65536,2162688,65536,1966084,65536,16515079,65536,27787268,65536,36962308,65536,129171463,2147483648,131072,0,9,1835365,
+2147549184,104137061,1900901,65536,2162688,65536,1966084,65536,16515079,65536,27787268,65536,36962308,65536,128843783,2147483648,131072,0,9,1835365,2147549184,104137061,1900901,65536,2162688,65536,1966084,65536,16515079,65536,27787268,65536,36962308,65536,19595271,2147483648,131072,0,13,1835365,
+2147549184,104137061,1900901,65536,2162688,65536,1966084,65536,16515079,65536,27787268,65536,36962308,65536,27787268,2147483648,129236996,0,129105927,0,129302532,0,129368068,0,129433604,0,11,1835365,2147549184,104137061,1900901,65536,2162688,65536,1966084,65536,16515079,65536,27787268,65536,
+36962308,65536,22413319,2147483648,22478855,0,56885255,0,56950791,0,15,1835365,2147549184,104137061,1900901,65536,2162688,65536,1966084,65536,16515079,65536,27787268,65536,36962308,65536,46071812,2147483648,129499143,0,129564679,0,109576199,0,129630215,0,129695751,0,129761287,0,
+131072,0,9,1835365,2147549184,104137061,1900901,65536,2162688,65536,1966084,65536,16515079,65536,27787268,65536,36962308,65536,129826823,2147483648,131072,0,11,1835365,2147549184,104137061,1900901,65536,2162688,65536,1966084,65536,16515079,65536,27787268,65536,36962308,65536,128516103,2147483648,
+128581639,0,129892359,0,131072,0,71,1835019,2147549184,4980762,1900555,65536,3801114,65536,3866655,65536,3932192,65536,3997696,65536,2097154,65536,2621444,65536,4063236,65536,4128772,65536,4194308,65536,4259844,65536,4325380,65536,4390916,65536,3735552,2147614720,4980762,4456478,
+4522008,2147549184,4980762,4587544,65536,4653067,65536,4718620,65536,4784154,65536,4849675,65536,4915233,65536,3604514,65536,24576098,2147483648,60817415,0,60882951,0,60948487,0,37879815,0,99221511,0,129957892,0,130023431,0,2097156,0,130088964,0,130154500,0,129236996,
+0,130220039,0,128647175,0,107610119,0,130285575,0,130351111,0,130416644,0,130482178,0,130547714,0,130613250,0,130678786,0,130744322,0,130809858,0,130875396,0,130940932,0,131006471,0,131072002,0,121634818,0,121700354,0,1441792,0,131137538,
+0,131203074,0,131268610,0,131334146,0,131399682,0,131465218,0,131530756,0,131596421,0,122552664,0,131923979,2147549184,131661846,131989515,65536,131923979,2147549184,131727382,131989515,65536,131923979,2147549184,131792918,131989515,65536,131923979,2147549184,131858454,131989515,65536,2,1835405,0,
+1900941,0,3,1835406,0,1900942,0,17891339,0,2,131923979,0,131989515,0,1,132055050,0,33,1835019,2147549184,4980762,1900555,65536,3801114,65536,3866655,65536,3932192,65536,3997696,65536,2097154,65536,2621444,65536,4063236,65536,4128772,65536,4194308,
+65536,4259844,65536,4325380,65536,4390916,65536,3735552,2147614720,4980762,4456478,4522008,2147549184,4980762,4587544,65536,4653067,65536,4718620,65536,4784154,65536,4849675,65536,4915233,65536,3604514,65536,24576098,2147483648,131923979,2147549184,132120598,131989515,65536,132186116,2147483648,132251652,0,18022404,
+0,18087940,0,2097156,0,131072,0,132055050,2147549184,12190095,7,1376260,0,1966084,0,20185114,0,132317184,0,132382720,0,132448263,0,132513799,0,3,132579335,0,70123527,0,2097156,0,27,68222983,2147549184,98304091,68288519,65536,25690119,65536,
+68354055,65536,68419584,65536,68485121,65536,68550657,65536,18808833,65536,18874369,65536,68616193,65536,68681728,65536,68747264,65536,68812807,65536,18481159,65536,68878343,65536,68943872,65536,1179648,65536,131072,2147483648,132644868,0,132710802,0,1376260,2147549184,132776337,1966084,65536,20185114,
+65536,132317184,65536,132382720,65536,132448263,65536,132513799,65536,15,1835412,0,1900948,0,2097154,0,132841472,0,132907008,0,132972548,0,5898643,0,1376260,2147549184,132776337,1966084,65536,20185114,65536,132317184,65536,132382720,65536,132448263,65536,132513799,65536,133038483,
+2147483648,7,1835413,0,1900949,0,17891335,0,133103620,0,45350916,0,2097152,0,29097984,0,16,1835414,0,1900950,0,2162688,0,131923979,2147549184,133169174,131989515,65536,131923979,2147549184,133234710,131989515,65536,133300628,2147483648,133366163,0,37879815,0,36962304,
+0,133431296,0,30998528,0,29097984,0,2097152,0,133496832,0,6,46268562,0,133562515,0,133627904,0,68026368,0,133693444,0,133758980,0,25,133824658,0,46268562,0,133890055,0,133955591,0,134021127,0,2097154,0,23068674,0,134086658,
+0,134152194,0,134217735,0,134283271,0,134348807,0,6356992,0,134414343,0,134479879,0,134545415,0,134610951,0,134676487,0,134742023,0,134807559,0,16121860,0,134873092,0,134938631,0,135004164,0,109248519,0,5,27787268,0,110821376,0,
+135069696,0,135135232,0,44367872,0,72,1835019,2147549184,4980762,1900555,65536,3801114,65536,3866655,65536,3932192,65536,3997696,65536,2097154,65536,2621444,65536,4063236,65536,4128772,65536,4194308,65536,4259844,65536,4325380,65536,4390916,65536,3735552,2147614720,4980762,4456478,
+4522008,2147549184,4980762,4587544,65536,4653067,65536,4718620,65536,4784154,65536,4849675,65536,4915233,65536,3604514,65536,24576098,2147483648,2097154,0,135200768,0,33292288,0,60817415,0,60882951,0,60948487,0,61014023,0,135266311,0,135331847,0,135397383,0,37879815,
+0,135462919,0,135528455,0,135593991,0,19660807,0,135659527,0,121700352,0,135725056,0,121634818,0,135790594,0,23068674,0,122552664,0,15073317,0,135856135,0,135921666,0,135987202,0,136052738,0,136118274,0,136183810,0,136249344,0,136314880,
+0,136380423,0,136445959,0,136511488,0,136577024,0,133431296,0,136642560,0,136708103,0,34930688,0,136774039,0,131923979,2147549184,136839190,131989515,65536,136905112,2147483648,27787268,2147549184,136970649,110821376,65536,135069696,65536,135135232,65536,44367872,65536,114,1835019,2147549184,
+4980762,1900555,65536,3801114,65536,3866655,65536,3932192,65536,3997696,65536,2097154,65536,2621444,65536,4063236,65536,4128772,65536,4194308,65536,4259844,65536,4325380,65536,4390916,65536,3735552,2147614720,4980762,4456478,4522008,2147549184,4980762,4587544,65536,4653067,65536,4718620,65536,
+4784154,65536,4849675,65536,4915233,65536,3604514,65536,24576098,2147483648,70582484,0,70647938,0,18939908,0,137035780,0,137101316,0,137166852,0,137232388,0,29360244,2147549184,74776693,29425668,65536,131072,65536,3604598,65536,76153055,2147549184,137298140,76218372,65536,76283908,65536,
+76349444,65536,76414980,65536,76480737,65536,76546272,65536,76153055,2147549184,137363676,76218372,65536,76283908,65536,76349444,65536,76414980,65536,76480737,65536,76546272,65536,76153055,2147549184,137429212,76218372,65536,76283908,65536,76349444,65536,76414980,65536,76480737,65536,76546272,65536,76153055,2147549184,
+137494748,76218372,65536,76283908,65536,76349444,65536,76414980,65536,76480737,65536,76546272,65536,131923979,2147549184,75104278,131989515,65536,75169796,2147483648,75235332,0,137560474,0,137625604,0,137691140,0,137756920,0,9568263,0,9633799,0,70778880,0,137822208,0,2097155,0,
+137887751,0,137953287,0,138018823,0,138084356,0,138149892,0,138215424,0,138280960,0,138346496,0,138412032,0,138477568,0,138543104,0,75497472,0,138608640,0,71172098,0,138674176,0,105840640,0,138739712,0,138805248,0,138871195,0,138936732,0,
+139002269,0,139067806,0,99877126,0,139133343,0,139198880,0,139264417,0,139329954,0,76153055,2147549184,139395292,76218372,65536,76283908,65536,76349444,65536,76414980,65536,76480737,65536,76546272,65536,139460612,2147483648,121241600,0,139526156,0,3604899,0,8,139591691,0,
+139657223,0,139722756,0,2097152,0,139788288,0,16121858,0,114950146,0,139853826,0,2,23068676,0,1966084,0,1,139919367,0,1,139984900,0,2,140050432,0,140115968,0,1,60948481,0,1,139984908,0,2,140181508,0,25690119,
+0,3,140247465,0,140312580,0,2097156,0,2,140378119,0,2097156,0,4,60817408,0,60882944,0,60948480,0,61014016,0,1,98172935,0,4,140443652,0,30212100,0,140509191,0,140574724,0,3,17891335,0,30212100,0,131072,
+0,1,2097152,0,1,2097152,0,5,140640260,0,140705796,0,140771328,0,140836864,0,2097154,0,5,140902404,0,137166852,0,69074946,0,2097152,0,44367872,0,2,140967943,0,2097156,0,4,5832711,0,2097152,0,140836864,
+0,3276800,0,2,141033476,0,141099012,0,7,140640260,0,140705796,0,141164548,0,141230084,0,69074946,0,141295616,0,2097152,0,1,139657223,0,4,61014016,0,60817408,0,60882944,0,60948480,0,1,139984900,0,19,1835443,
+0,1900979,0,141361588,0,1966082,0,2097154,0,131072,0,56885255,0,56950791,0,97714183,0,9764871,0,141426695,0,141492231,0,141557767,0,141623303,0,141688839,0,141754375,0,2359303,0,141819911,0,141885447,0,41,1835019,2147549184,
+4980762,1900555,65536,3801114,65536,3866655,65536,3932192,65536,3997696,65536,2097154,65536,2621444,65536,4063236,65536,4128772,65536,4194308,65536,4259844,65536,4325380,65536,4390916,65536,3735552,2147614720,4980762,4456478,4522008,2147549184,4980762,4587544,65536,4653067,65536,4718620,65536,
+4784154,65536,4849675,65536,4915233,65536,3604514,65536,24576098,2147483648,131923979,2147549184,141950998,131989515,65536,142016534,2147483648,70647938,0,2097152,0,33357824,0,71172098,0,70778880,0,3276800,0,27066368,0,9568263,0,9633799,0,142082055,0,142147591,0,142213127,
+0,2228224,0,142279091,0,13,1835446,0,1900982,0,1966084,0,16121860,0,142344199,0,2097154,0,17956866,0,142409731,0,3276800,0,142475268,0,2162688,0,104071168,0,3604491,0,20,1835446,2147549184,104137142,1900982,65536,1966084,65536,
+16121860,65536,142344199,65536,2097154,65536,17956866,65536,142409731,65536,3276800,65536,142475268,65536,2162688,65536,104071168,65536,3604491,65536,142541031,2147483648,142606387,0,142671872,0,79101952,0,14876672,0,142737412,0,142802948,0,23,1835446,2147549184,104137142,1900982,65536,
+1966084,65536,16121860,65536,142344199,65536,2097154,65536,17956866,65536,142409731,65536,3276800,65536,142475268,65536,2162688,65536,104071168,65536,3604491,65536,142868482,2147483648,142934018,0,142999554,0,27787266,0,143065090,0,143130626,0,143196162,0,143261698,0,143327239,0,
+143392775,0,19,1835446,2147549184,104137142,1900982,65536,1966084,65536,16121860,65536,142344199,65536,2097154,65536,17956866,65536,142409731,65536,3276800,65536,142475268,65536,2162688,65536,104071168,65536,3604491,65536,105709619,2147483648,2162688,0,19464199,0,2097154,0,3276800,0,
+4653067,0,19,1835446,2147549184,104137142,1900982,65536,1966084,65536,16121860,65536,142344199,65536,2097154,65536,17956866,65536,142409731,65536,3276800,65536,142475268,65536,2162688,65536,104071168,65536,3604491,65536,105709619,2147483648,2162688,0,143458306,0,2097154,0,131072,0,
+4653067,0,18,1835446,2147549184,104137142,1900982,65536,1966084,65536,16121860,65536,142344199,65536,2097154,65536,17956866,65536,142409731,65536,3276800,65536,142475268,65536,2162688,65536,104071168,65536,3604491,65536,22413319,2147483648,5963783,0,2097154,0,143523842,0,81133572,0,
+19,1835446,2147549184,104137142,1900982,65536,1966084,65536,16121860,65536,142344199,65536,2097154,65536,17956866,65536,142409731,65536,3276800,65536,142475268,65536,2162688,65536,104071168,65536,3604491,65536,143589427,2147483648,117309440,0,16121858,0,2097154,0,143654919,0,4653067,0,
+26,1835446,2147549184,104137142,1900982,65536,1966084,65536,16121860,65536,142344199,65536,2097154,65536,17956866,65536,142409731,65536,3276800,65536,142475268,65536,2162688,65536,104071168,65536,3604491,65536,143720499,2147483648,143786035,0,143851571,0,143917107,0,66519047,0,102105095,0,
+5963783,0,143982599,0,144048132,0,144113668,0,27787268,0,105971716,0,144179207,0,23,1835446,2147549184,104137142,1900982,65536,1966084,65536,16121860,65536,142344199,65536,2097154,65536,17956866,65536,142409731,65536,3276800,65536,142475268,65536,2162688,65536,104071168,65536,
+3604491,65536,109510658,2147483648,2097154,0,129826823,0,144244743,0,144310273,0,1179648,0,144179207,0,144375815,0,144441395,0,4653067,0,15,1835446,2147549184,104137142,1900982,65536,1966084,65536,16121860,65536,142344199,65536,2097154,65536,17956866,65536,142409731,65536,
+3276800,65536,142475268,65536,2162688,65536,104071168,65536,3604491,65536,144506887,2147483648,27787268,0,36,1835446,2147549184,104137142,1900982,65536,1966084,65536,16121860,65536,142344199,65536,2097154,65536,17956866,65536,142409731,65536,3276800,65536,142475268,65536,2162688,65536,104071168,65536,
+3604491,65536,327687,2147483648,144572420,0,27787266,0,144637954,0,144703490,0,144769026,0,144834562,0,144900098,0,144965634,0,145031170,0,145096706,0,145162242,0,145227778,0,145293312,0,44367872,0,145358855,0,145424391,0,112590855,0,145489920,0,
+14876672,0,145555669,0,145620992,0,145686528,0,19,1835446,2147549184,104137142,1900982,65536,1966084,65536,16121860,65536,142344199,65536,2097154,65536,17956866,65536,142409731,65536,3276800,65536,142475268,65536,2162688,65536,104071168,65536,3604491,65536,145752307,2147483648,145817847,0,
+145883385,0,18743303,0,1966084,0,4653067,0,27,1835446,2147549184,104137142,1900982,65536,1966084,65536,16121860,65536,142344199,65536,2097154,65536,17956866,65536,142409731,65536,3276800,65536,142475268,65536,2162688,65536,104071168,65536,3604491,65536,142541031,2147483648,142606387,0,
+142671872,0,79101952,0,14876672,0,142737412,0,142802948,0,19464199,0,145948676,0,145489920,0,146014215,0,62193668,0,2097154,0,87359488,0,22,1835446,2147549184,104137142,1900982,65536,1966084,65536,16121860,65536,142344199,65536,2097154,65536,17956866,65536,
+142409731,65536,3276800,65536,142475268,65536,2162688,65536,104071168,65536,3604491,65536,146079795,2147483648,6356992,0,146145284,0,146210823,0,146276359,0,146341895,0,146407431,0,79101952,0,142737412,0,23,1835446,2147549184,104137142,1900982,65536,1966084,65536,16121860,65536,
+142344199,65536,2097154,65536,17956866,65536,142409731,65536,3276800,65536,142475268,65536,2162688,65536,104071168,65536,3604491,65536,146472967,2147483648,146538498,0,146604032,0,146669568,0,109576199,0,145489920,0,146735111,0,2097154,0,16121858,0,146800644,0,17,1835446,
+2147549184,104137142,1900982,65536,1966084,65536,16121860,65536,142344199,65536,2097154,65536,17956866,65536,142409731,65536,3276800,65536,142475268,65536,2162688,65536,104071168,65536,3604491,65536,146866183,2147483648,145489920,0,2097154,0,22675458,0,21,1835446,2147549184,104137142,1900982,65536,
+1966084,65536,16121860,65536,142344199,65536,2097154,65536,17956866,65536,142409731,65536,3276800,65536,142475268,65536,2162688,65536,104071168,65536,3604491,65536,105709619,2147483648,146866183,0,68354055,0,19398663,0,145489920,0,2097154,0,1966082,0,4653067,0,36,1835446,
+2147549184,104137142,1900982,65536,1966084,65536,16121860,65536,142344199,65536,2097154,65536,17956866,65536,142409731,65536,3276800,65536,142475268,65536,2162688,65536,104071168,65536,3604491,65536,142541031,2147483648,142606387,0,142671872,0,79101952,0,14876672,0,142737412,0,142802948,0,
+146931763,0,145489920,0,2097154,0,34537472,0,83034119,0,83099655,0,31195143,0,71237639,0,83165191,0,30277639,0,81592327,0,30998535,0,83296263,0,80936967,0,34930688,0,146997259,0,19,1835446,2147549184,104137142,1900982,65536,1966084,65536,
+16121860,65536,142344199,65536,2097154,65536,17956866,65536,142409731,65536,3276800,65536,142475268,65536,2162688,65536,104071168,65536,3604491,65536,27131906,2147483648,108462082,0,6356992,0,105709619,0,108527623,0,145489920,0,27,1835446,2147549184,104137142,1900982,65536,1966084,65536,
+16121860,65536,142344199,65536,2097154,65536,17956866,65536,142409731,65536,3276800,65536,142475268,65536,2162688,65536,104071168,65536,3604491,65536,105709619,2147483648,62062592,0,2097152,0,107937792,0,1441792,0,108003335,0,108068871,0,30998535,0,108200065,0,147062788,0,
+147128324,0,108134407,0,2162688,0,4653067,0,13,1835446,2147549184,104137142,1900982,65536,1966084,65536,16121860,65536,142344199,65536,2097154,65536,17956866,65536,142409731,65536,3276800,65536,142475268,65536,2162688,65536,104071168,65536,3604491,65536,25,1835446,2147549184,104137142,
+1900982,65536,1966084,65536,16121860,65536,142344199,65536,2097154,65536,17956866,65536,142409731,65536,3276800,65536,142475268,65536,2162688,65536,104071168,65536,3604491,65536,147194315,2147483648,147259547,0,147325086,0,147390694,0,131923979,2147549184,77135894,131989515,65536,147456460,2147483648,147521543,
+0,147587079,0,147652612,0,147718151,0,147784141,0,27,1835446,2147549184,104137142,1900982,65536,1966084,65536,16121860,65536,142344199,65536,2097154,65536,17956866,65536,142409731,65536,3276800,65536,142475268,65536,2162688,65536,104071168,65536,3604491,65536,147849223,2147483648,147914759,
+0,147980295,0,148045831,0,148111367,0,148176903,0,148242436,0,148307972,0,148373508,0,148439047,0,148504583,0,148570112,0,29097984,0,148636111,0,6,148701191,0,148766727,0,95420664,0,148636113,0,148832260,0,148897796,0,19,1835446,
+2147549184,104137142,1900982,65536,1966084,65536,16121860,65536,142344199,65536,2097154,65536,17956866,65536,142409731,65536,3276800,65536,142475268,65536,2162688,65536,104071168,65536,3604491,65536,148701191,2147549184,12190160,148766727,65536,95420664,65536,148636113,65536,148832260,65536,148897796,65536,22,
+1835446,2147549184,104137142,1900982,65536,1966084,65536,16121860,65536,142344199,65536,2097154,65536,17956866,65536,142409731,65536,3276800,65536,142475268,65536,2162688,65536,104071168,65536,3604491,65536,105709619,2147483648,55836738,0,148963335,0,2555904,0,13303808,0,149028864,0,2097152,
+0,149094400,0,29097984,0,2,149159940,0,25690119,0,2,19595268,0,149225476,0,40,1835446,2147549184,104137142,1900982,65536,1966084,65536,16121860,65536,142344199,65536,2097154,65536,17956866,65536,142409731,65536,3276800,65536,142475268,65536,2162688,65536,104071168,
+65536,3604491,65536,105709619,2147483648,145489920,0,149291010,0,2097154,0,131072,0,149357012,0,149422194,0,149487620,0,149553266,0,149618695,0,149684338,0,18939908,0,149749764,0,149815765,0,149880946,0,149946836,0,150012018,0,150077444,0,150143090,
+0,150208516,0,149225476,0,150274055,0,150339591,0,150405127,0,150470663,0,150536199,0,150601739,0,22,1835446,2147549184,104137142,1900982,65536,1966084,65536,16121860,65536,142344199,65536,2097154,65536,17956866,65536,142409731,65536,3276800,65536,142475268,65536,2162688,
+65536,104071168,65536,3604491,65536,79626474,2147483648,150667512,0,150733048,0,150798340,0,150863876,0,150929412,0,2097154,0,3276800,0,4653067,0,27,1835446,2147549184,104137142,1900982,65536,1966084,65536,16121860,65536,142344199,65536,2097154,65536,17956866,65536,142409731,
+65536,3276800,65536,142475268,65536,2162688,65536,104071168,65536,3604491,65536,29622323,2147483648,150994946,0,2097154,0,109510658,0,62193666,0,151060487,0,151126023,0,46596103,0,151191559,0,151257095,0,151322631,0,151388160,0,151453696,0,4653067,0,20,
+1835446,2147549184,104137142,1900982,65536,1966084,65536,16121860,65536,142344199,65536,2097154,65536,17956866,65536,142409731,65536,3276800,65536,142475268,65536,2162688,65536,104071168,65536,3604491,65536,151519236,2147483648,2097154,0,151584770,0,151650311,0,151715840,0,14876672,0,5308427,
+0,24,1835446,2147549184,104137142,1900982,65536,1966084,65536,16121860,65536,142344199,65536,2097154,65536,17956866,65536,142409731,65536,3276800,65536,142475268,65536,2162688,65536,104071168,65536,3604491,65536,151781376,2147483648,151846912,0,151912448,0,151977984,0,152043520,0,27787264,
+0,3276800,0,143130626,0,143065090,0,143196162,0,34537472,0,15,1835446,2147549184,104137142,1900982,65536,1966084,65536,16121860,65536,142344199,65536,2097154,65536,17956866,65536,142409731,65536,3276800,65536,142475268,65536,2162688,65536,104071168,65536,3604491,65536,152109532,
+2147483648,4653067,0,15,1835446,2147549184,104137142,1900982,65536,1966084,65536,16121860,65536,142344199,65536,2097154,65536,17956866,65536,142409731,65536,3276800,65536,142475268,65536,2162688,65536,104071168,65536,3604491,65536,1966084,2147483648,44367876,0,24,1835446,2147549184,104137142,1900982,
+65536,1966084,65536,16121860,65536,142344199,65536,2097154,65536,17956866,65536,142409731,65536,3276800,65536,142475268,65536,2162688,65536,104071168,65536,3604491,65536,66977843,2147483648,152174643,0,152240128,0,152305671,0,67043330,0,152371200,0,67305472,0,67239943,0,67108864,
+0,152436736,0,3276800,0,22,1835446,2147549184,104137142,1900982,65536,1966084,65536,16121860,65536,142344199,65536,2097154,65536,17956866,65536,142409731,65536,3276800,65536,142475268,65536,2162688,65536,104071168,65536,3604491,65536,152502323,2147483648,152240128,0,104398855,0,152567815,
+0,16121856,0,109510656,0,152633344,0,2097152,0,4653067,0,13,1835446,2147549184,104137142,1900982,65536,1966084,65536,16121860,65536,142344199,65536,2097154,65536,17956866,65536,142409731,65536,3276800,65536,142475268,65536,2162688,65536,104071168,65536,3604491,65536,32,
+1835446,2147549184,104137142,1900982,65536,1966084,65536,16121860,65536,142344199,65536,2097154,65536,17956866,65536,142409731,65536,3276800,65536,142475268,65536,2162688,65536,104071168,65536,3604491,65536,145489920,2147483648,152698880,0,152764416,0,19595271,0,64094215,0,152829959,0,152895495,
+0,16121856,0,152961024,0,153026560,0,44367872,0,153092103,0,153157639,0,153223175,0,2097156,0,153288706,0,153354242,0,153419783,0,153485319,0,24,1835446,2147549184,104137142,1900982,65536,1966084,65536,16121860,65536,142344199,65536,2097154,65536,17956866,
+65536,142409731,65536,3276800,65536,142475268,65536,2162688,65536,104071168,65536,3604491,65536,153550899,2147483648,153616388,0,153681924,0,146538500,0,153747463,0,109576199,0,143982599,0,2097154,0,109510656,0,20447232,0,4653067,0,46,1835446,2147549184,104137142,1900982,
+65536,1966084,65536,16121860,65536,142344199,65536,2097154,65536,17956866,65536,142409731,65536,3276800,65536,142475268,65536,2162688,65536,104071168,65536,3604491,65536,153813476,2147483648,153879013,0,153944068,0,154009604,0,154075140,0,154140679,0,81592327,0,154206215,0,19791879,
+0,154271751,0,154337287,0,154402823,0,154468359,0,154533895,0,18743303,0,154599428,0,154664967,0,154730503,0,154796036,0,154861572,0,154927104,0,154992640,0,155058176,0,155123712,0,155189248,0,2097152,0,49479680,0,155254786,0,155320322,
+0,81133572,0,19398663,0,155385863,0,131072,0,32,1835446,2147549184,104137142,1900982,65536,1966084,65536,16121860,65536,142344199,65536,2097154,65536,17956866,65536,142409731,65536,3276800,65536,142475268,65536,2162688,65536,104071168,65536,3604491,65536,142541031,2147483648,142606387,
+0,142671872,0,79101952,0,14876672,0,142737412,0,142802948,0,155451443,0,155516979,0,155582464,0,155648000,0,108200065,0,145489920,0,19464199,0,155713543,0,2097152,0,107937792,0,87359488,0,99942411,0,29,1835446,2147549184,104137142,1900982,
+65536,1966084,65536,16121860,65536,142344199,65536,2097154,65536,17956866,65536,142409731,65536,3276800,65536,142475268,65536,2162688,65536,104071168,65536,3604491,65536,145489920,2147483648,155779074,0,107937794,0,155844615,0,155910273,0,155975687,0,156041223,0,156106759,0,156172288,
+0,156237828,0,156303591,0,156368947,0,156434432,0,156499972,0,156565504,0,4653067,0,31,1835446,2147549184,104137142,1900982,65536,1966084,65536,16121860,65536,142344199,65536,2097154,65536,17956866,65536,142409731,65536,3276800,65536,142475268,65536,2162688,65536,104071168,
+65536,3604491,65536,156631040,2147483648,156696576,0,156762119,0,156827655,0,63635456,0,156893184,0,15794176,0,156106759,0,156172288,0,156237828,0,156303591,0,156368947,0,156434432,0,156499972,0,156565504,0,14876672,0,2097152,0,45481984,0,31,
+1835446,2147549184,104137142,1900982,65536,1966084,65536,16121860,65536,142344199,65536,2097154,65536,17956866,65536,142409731,65536,3276800,65536,142475268,65536,2162688,65536,104071168,65536,3604491,65536,145489920,2147483648,155910273,0,156958724,0,157024260,0,157089843,0,156106759,0,156172288,
+0,156237828,0,156303591,0,156368947,0,156434432,0,156499972,0,156565504,0,14876672,0,157155335,0,157220871,0,107937794,0,2686976,0,17,1835446,2147549184,104137142,1900982,65536,1966084,65536,16121860,65536,142344199,65536,2097154,65536,17956866,65536,142409731,
+65536,3276800,65536,142475268,65536,2162688,65536,104071168,65536,3604491,65536,76939492,2147483648,157286633,0,1966084,0,131072,0,22,1835446,2147549184,104137142,1900982,65536,1966084,65536,16121860,65536,142344199,65536,2097154,65536,17956866,65536,142409731,65536,3276800,65536,142475268,
+65536,2162688,65536,104071168,65536,3604491,65536,143654919,2147483648,22740999,0,157351943,0,19791872,0,2097152,0,16121856,0,44367872,0,157417479,0,157483015,0,17,1835446,2147549184,104137142,1900982,65536,1966084,65536,16121860,65536,142344199,65536,2097154,65536,17956866,
+65536,142409731,65536,3276800,65536,142475268,65536,2162688,65536,104071168,65536,3604491,65536,157548551,2147483648,2097152,0,157614080,0,3276800,0,17,1835446,2147549184,104137142,1900982,65536,1966084,65536,16121860,65536,142344199,65536,2097154,65536,17956866,65536,142409731,65536,3276800,
+65536,142475268,65536,2162688,65536,104071168,65536,3604491,65536,2097156,2147483648,157679620,0,157745156,0,157810692,0,19,1835446,2147549184,104137142,1900982,65536,1966084,65536,16121860,65536,142344199,65536,2097154,65536,17956866,65536,142409731,65536,3276800,65536,142475268,65536,2162688,
+65536,104071168,65536,3604491,65536,157876231,2147483648,157941767,0,14876672,0,145489920,0,2097154,0,22675458,0,9,158007303,0,158072836,0,157876231,0,22740999,0,22675458,0,2097154,0,158138368,0,158203904,0,1441792,0,33,1835446,2147549184,104137142,
+1900982,65536,1966084,65536,16121860,65536,142344199,65536,2097154,65536,17956866,65536,142409731,65536,3276800,65536,142475268,65536,2162688,65536,104071168,65536,3604491,65536,158269447,2147483648,158335090,0,158400516,0,157876231,0,22740999,0,22675458,0,2097154,0,158138368,0,
+158203904,0,1441792,0,145489920,0,158007303,2147549184,158466542,158072836,65536,157876231,65536,22740999,65536,22675458,65536,2097154,65536,158138368,65536,158203904,65536,1441792,65536,27,1835446,2147549184,104137142,1900982,65536,1966084,65536,16121860,65536,142344199,65536,2097154,65536,17956866,
+65536,142409731,65536,3276800,65536,142475268,65536,2162688,65536,104071168,65536,3604491,65536,158531584,2147483648,158597120,0,2097154,0,158662663,0,46530567,0,102957063,0,46596103,0,158728243,0,158793728,0,158859315,0,158924800,0,152240128,0,79101952,0,131072,
+0,31,1835446,2147549184,104137142,1900982,65536,1966084,65536,16121860,65536,142344199,65536,2097154,65536,17956866,65536,142409731,65536,3276800,65536,142475268,65536,2162688,65536,104071168,65536,3604491,65536,2097152,2147483648,1966080,0,106627072,0,158990336,0,45154304,0,45219840,
+0,159055872,0,133758976,0,104398855,0,159121408,0,145489920,0,29097984,0,14942215,0,105381895,0,159186951,0,63897607,0,159252487,0,44892160,0,21,1835446,2147549184,104137142,1900982,65536,1966084,65536,16121860,65536,142344199,65536,2097154,65536,17956866,
+65536,142409731,65536,3276800,65536,142475268,65536,2162688,65536,104071168,65536,3604491,65536,159318016,2147483648,159383556,0,22675460,0,159449095,0,159514738,0,159580171,0,2097154,0,1441792,0,21,1835446,2147549184,104137142,1900982,65536,1966084,65536,16121860,65536,142344199,
+65536,2097154,65536,17956866,65536,142409731,65536,3276800,65536,142475268,65536,2162688,65536,104071168,65536,3604491,65536,145489920,2147483648,19595271,0,64094215,0,152829959,0,159645703,0,2097154,0,153288706,0,131072,0,18,1835446,2147549184,104137142,1900982,65536,1966084,
+65536,16121860,65536,142344199,65536,2097154,65536,17956866,65536,142409731,65536,3276800,65536,142475268,65536,2162688,65536,104071168,65536,3604491,65536,143982599,2147483648,145489920,0,16121856,0,2097152,0,3276800,0,30,1835446,2147549184,104137142,1900982,65536,1966084,65536,16121860,
+65536,142344199,65536,2097154,65536,17956866,65536,142409731,65536,3276800,65536,142475268,65536,2162688,65536,104071168,65536,3604491,65536,159711283,2147483648,159776772,0,159842308,0,159907844,0,159973380,0,160038916,0,160104455,0,160169991,0,160235527,0,14876672,0,160301060,
+0,160366596,0,63635460,0,134217735,0,145489920,0,27787268,0,5308427,0,24,1835446,2147549184,104137142,1900982,65536,1966084,65536,16121860,65536,142344199,65536,2097154,65536,17956866,65536,142409731,65536,3276800,65536,142475268,65536,2162688,65536,104071168,65536,3604491,
+65536,145489920,2147483648,66977843,0,16121858,0,2097154,0,63635458,0,3276800,0,134217735,0,160432135,0,66519047,0,2228224,0,4653067,0,20,1835446,2147549184,104137142,1900982,65536,1966084,65536,16121860,65536,142344199,65536,2097154,65536,17956866,65536,142409731,
+65536,3276800,65536,142475268,65536,2162688,65536,104071168,65536,3604491,65536,67764365,2147483648,67829760,0,160497664,0,1179648,0,94568455,0,67895500,0,67960832,0,6,160563204,0,95617028,0,16121860,0,160628743,0,160694279,0,16515079,0,3,160760312,
+0,160825348,0,160890884,0,27,1835446,2147549184,104137142,1900982,65536,1966084,65536,16121860,65536,142344199,65536,2097154,65536,17956866,65536,142409731,65536,3276800,65536,142475268,65536,2162688,65536,104071168,65536,3604491,65536,160956923,2147483648,66977843,0,161022457,0,161087602,
+0,30998535,0,161153028,0,95617028,0,161218564,0,161284100,0,27787268,0,124649479,0,19464199,0,145489920,0,49479684,0,18,1835446,2147549184,104137142,1900982,65536,1966084,65536,16121860,65536,142344199,65536,2097154,65536,17956866,65536,142409731,65536,3276800,
+65536,142475268,65536,2162688,65536,104071168,65536,3604491,65536,145489920,2147483648,16121856,0,2097152,0,25690114,0,142213127,0,1,4522008,0,5,161349632,0,161415168,0,20185114,0,1376260,0,131072,0,2,262144,0,161480739,0,4,161546244,
+0,161611780,0,161677823,0,161743359,0,14,4980740,0,2097156,0,161808385,0,161873932,0,1441792,0,161939456,0,14942212,0,15007748,0,162004996,0,162070532,0,162136574,0,162202112,0,5308427,0,162267145,0,2,4980740,0,2097156,
+0,25,1835446,2147549184,104137142,1900982,65536,1966084,65536,16121860,65536,142344199,65536,2097154,65536,17956866,65536,142409731,65536,3276800,65536,142475268,65536,2162688,65536,104071168,65536,3604491,65536,162333016,2147483648,4522008,2147549184,162398717,162463744,2147483648,2097164,0,161873932,0,
+3276800,0,162529284,0,162595329,0,6356992,0,162660356,0,162726402,0,3604996,0,21,1835446,2147549184,104137142,1900982,65536,1966084,65536,16121860,65536,142344199,65536,2097154,65536,17956866,65536,142409731,65536,3276800,65536,142475268,65536,2162688,65536,104071168,65536,
+3604491,65536,105709619,2147483648,162791428,0,157417479,0,162856964,0,162922503,0,38207495,0,6356992,0,99942411,0,19,1835446,2147549184,104137142,1900982,65536,1966084,65536,16121860,65536,142344199,65536,2097154,65536,17956866,65536,142409731,65536,3276800,65536,142475268,65536,
+2162688,65536,104071168,65536,3604491,65536,142541031,2147483648,162988083,0,163053572,0,19464199,0,163119111,0,163184647,0,22,1835446,2147549184,104137142,1900982,65536,1966084,65536,16121860,65536,142344199,65536,2097154,65536,17956866,65536,142409731,65536,3276800,65536,142475268,65536,
+2162688,65536,104071168,65536,3604491,65536,105709619,2147483648,143654919,0,157483015,0,2097156,0,162791428,0,157417479,0,162856964,0,163250176,0,4653067,0,9,2097156,0,14876672,0,163315712,0,35848322,0,104792068,0,163381252,0,163446784,0,163512449,
+0,5308427,0,28,1835446,2147549184,104137142,1900982,65536,1966084,65536,16121860,65536,142344199,65536,2097154,65536,17956866,65536,142409731,65536,3276800,65536,142475268,65536,2162688,65536,104071168,65536,3604491,65536,2097156,2147549184,16515592,14876672,65536,163315712,65536,35848322,65536,
+104792068,65536,163381252,65536,163446784,65536,163512449,65536,5308427,65536,2097156,2147483648,21823488,0,7733248,0,163577863,0,163643399,0,5308427,0,26,1835446,2147549184,104137142,1900982,65536,1966084,65536,16121860,65536,142344199,65536,2097154,65536,17956866,65536,142409731,65536,
+3276800,65536,142475268,65536,2162688,65536,104071168,65536,3604491,65536,2097156,2147549184,16515592,14876672,65536,163315712,65536,35848322,65536,104792068,65536,163381252,65536,163446784,65536,163512449,65536,5308427,65536,1966084,2147483648,30212100,0,163708928,0,4653067,0,26,1835446,2147549184,
+104137142,1900982,65536,1966084,65536,16121860,65536,142344199,65536,2097154,65536,17956866,65536,142409731,65536,3276800,65536,142475268,65536,2162688,65536,104071168,65536,3604491,65536,2097156,2147549184,16515592,14876672,65536,163315712,65536,35848322,65536,104792068,65536,163381252,65536,163446784,65536,
+163512449,65536,5308427,65536,21823488,2147483648,7733248,0,105512967,0,5308427,0,31,1835446,2147549184,104137142,1900982,65536,1966084,65536,16121860,65536,142344199,65536,2097154,65536,17956866,65536,142409731,65536,3276800,65536,142475268,65536,2162688,65536,104071168,65536,3604491,65536,
+2097156,2147549184,16515592,14876672,65536,163315712,65536,35848322,65536,104792068,65536,163381252,65536,163446784,65536,163512449,65536,5308427,65536,2097154,2147483648,21823488,0,163774464,0,104398855,0,68354055,0,6160391,0,105709619,0,128057478,0,6619147,0,27,1835446,2147549184,
+104137142,1900982,65536,1966084,65536,16121860,65536,142344199,65536,2097154,65536,17956866,65536,142409731,65536,3276800,65536,142475268,65536,2162688,65536,104071168,65536,3604491,65536,2097156,2147549184,16515592,14876672,65536,163315712,65536,35848322,65536,104792068,65536,163381252,65536,163446784,65536,
+163512449,65536,5308427,65536,2097156,2147483648,104398855,0,917508,0,131072,0,4653067,0,35,1835446,2147549184,104137142,1900982,65536,1966084,65536,16121860,65536,142344199,65536,2097154,65536,17956866,65536,142409731,65536,3276800,65536,142475268,65536,2162688,65536,104071168,65536,
+3604491,65536,2097156,2147549184,16515592,14876672,65536,163315712,65536,35848322,65536,104792068,65536,163381252,65536,163446784,65536,163512449,65536,5308427,65536,2097156,2147483648,132841476,0,9568263,0,108265479,0,102105095,0,163840007,0,163905543,0,163971079,0,81133572,0,108331012,
+0,108396548,0,14876672,0,5308427,0,34,1835446,2147549184,104137142,1900982,65536,1966084,65536,16121860,65536,142344199,65536,2097154,65536,17956866,65536,142409731,65536,3276800,65536,142475268,65536,2162688,65536,104071168,65536,3604491,65536,2097156,2147549184,16515592,14876672,65536,
+163315712,65536,35848322,65536,104792068,65536,163381252,65536,163446784,65536,163512449,65536,5308427,65536,2097156,2147483648,104398855,0,104464391,0,104529927,0,104595463,0,88342535,0,104660999,0,104726530,0,3276800,0,917508,0,81133572,0,4653067,0,25,1835446,
+2147549184,104137142,1900982,65536,1966084,65536,16121860,65536,142344199,65536,2097154,65536,17956866,65536,142409731,65536,3276800,65536,142475268,65536,2162688,65536,104071168,65536,3604491,65536,2097156,2147549184,16515592,14876672,65536,163315712,65536,35848322,65536,104792068,65536,163381252,65536,163446784,
+65536,163512449,65536,5308427,65536,105709619,2147483648,2097156,0,131072,0,27,1835446,2147549184,104137142,1900982,65536,1966084,65536,16121860,65536,142344199,65536,2097154,65536,17956866,65536,142409731,65536,3276800,65536,142475268,65536,2162688,65536,104071168,65536,3604491,65536,2097156,
+2147549184,16515592,14876672,65536,163315712,65536,35848322,65536,104792068,65536,163381252,65536,163446784,65536,163512449,65536,5308427,65536,2097156,2147483648,104923143,0,99221511,0,131072,0,4653067,0,25,1835446,2147549184,104137142,1900982,65536,1966084,65536,16121860,65536,142344199,65536,
+2097154,65536,17956866,65536,142409731,65536,3276800,65536,142475268,65536,2162688,65536,104071168,65536,3604491,65536,2097156,2147549184,16515592,14876672,65536,163315712,65536,35848322,65536,104792068,65536,163381252,65536,163446784,65536,163512449,65536,5308427,65536,105709619,2147483648,19464199,0,131072,
+0,7,2162688,0,107741188,0,107806724,0,68354055,0,101318663,0,69074948,0,2097156,0,27,1835446,2147549184,104137142,1900982,65536,1966084,65536,16121860,65536,142344199,65536,2097154,65536,17956866,65536,142409731,65536,3276800,65536,142475268,65536,2162688,65536,
+104071168,65536,3604491,65536,2097156,2147549184,16515592,14876672,65536,163315712,65536,35848322,65536,104792068,65536,163381252,65536,163446784,65536,163512449,65536,5308427,65536,164037139,2147483648,164102148,0,105447428,0,107872260,0,131072,0,31,1835446,2147549184,104137142,1900982,65536,1966084,
+65536,16121860,65536,142344199,65536,2097154,65536,17956866,65536,142409731,65536,3276800,65536,142475268,65536,2162688,65536,104071168,65536,3604491,65536,2097156,2147549184,16515592,14876672,65536,163315712,65536,35848322,65536,104792068,65536,163381252,65536,163446784,65536,163512449,65536,5308427,65536,
+2097156,2147483648,108593156,0,30015495,0,19595271,0,108658695,0,108724231,0,108789767,0,56033284,0,6619147,0,37,1835446,2147549184,104137142,1900982,65536,1966084,65536,16121860,65536,142344199,65536,2097154,65536,17956866,65536,142409731,65536,3276800,65536,142475268,65536,
+2162688,65536,104071168,65536,3604491,65536,2097156,2147549184,16515592,14876672,65536,163315712,65536,35848322,65536,104792068,65536,163381252,65536,163446784,65536,163512449,65536,5308427,65536,2097156,2147483648,107085831,0,107151367,0,107216903,0,107282439,0,107347975,0,107413511,0,81133572,
+0,917508,0,16121860,0,131072,0,107479047,0,107544583,0,107610119,0,4653067,0,29,1835446,2147549184,104137142,1900982,65536,1966084,65536,16121860,65536,142344199,65536,2097154,65536,17956866,65536,142409731,65536,3276800,65536,142475268,65536,2162688,65536,104071168,
+65536,3604491,65536,2097156,2147549184,16515592,14876672,65536,163315712,65536,35848322,65536,104792068,65536,163381252,65536,163446784,65536,163512449,65536,5308427,65536,2097156,2147483648,109314055,0,109510658,0,62193666,0,109576199,0,106823680,0,6619147,0,33,1835446,2147549184,104137142,
+1900982,65536,1966084,65536,16121860,65536,142344199,65536,2097154,65536,17956866,65536,142409731,65536,3276800,65536,142475268,65536,2162688,65536,104071168,65536,3604491,65536,2097156,2147549184,16515592,14876672,65536,163315712,65536,35848322,65536,104792068,65536,163381252,65536,163446784,65536,163512449,
+65536,5308427,65536,105709619,2147483648,105971716,0,2097156,0,66519047,0,85983239,0,106037255,0,106102791,0,106168327,0,131072,0,81133572,0,106233860,0,28,1835446,2147549184,104137142,1900982,65536,1966084,65536,16121860,65536,142344199,65536,2097154,65536,17956866,
+65536,142409731,65536,3276800,65536,142475268,65536,2162688,65536,104071168,65536,3604491,65536,2097156,2147549184,16515592,14876672,65536,163315712,65536,35848322,65536,104792068,65536,163381252,65536,163446784,65536,163512449,65536,5308427,65536,2097156,2147483648,106823680,0,109314055,0,109379591,0,
+109445127,0,105709619,0,32,1835446,2147549184,104137142,1900982,65536,1966084,65536,16121860,65536,142344199,65536,2097154,65536,17956866,65536,142409731,65536,3276800,65536,142475268,65536,2162688,65536,104071168,65536,3604491,65536,2097156,2147549184,16515592,14876672,65536,163315712,65536,35848322,
+65536,104792068,65536,163381252,65536,163446784,65536,163512449,65536,5308427,65536,105709619,2147483648,62062592,0,131072,0,2097156,0,107937792,0,7733248,0,108003335,0,108068871,0,30998535,0,108134407,0,57,1835446,2147549184,104137142,1900982,65536,1966084,65536,16121860,
+65536,142344199,65536,2097154,65536,17956866,65536,142409731,65536,3276800,65536,142475268,65536,2162688,65536,104071168,65536,3604491,65536,96993283,2147483648,109707264,0,109772800,0,109838338,0,109903874,0,109969459,0,110034995,0,110100531,0,110166082,0,110231682,0,110297088,
+0,110362624,0,104333312,0,110428167,0,110493703,0,110559239,0,110624775,0,110690311,0,101318663,0,68354055,0,99221506,0,164167680,0,164233216,0,110886912,0,110952448,0,111017984,0,20447232,0,111083527,0,111149063,0,111214599,0,111280135,
+0,111345668,0,27787268,0,111411207,0,111476736,0,111542272,0,111607810,0,111673344,0,111738880,0,87359488,0,164299052,0,50331948,0,111804717,0,3605020,0,25,1835446,2147549184,104137142,1900982,65536,1966084,65536,16121860,65536,142344199,65536,2097154,
+65536,17956866,65536,142409731,65536,3276800,65536,142475268,65536,2162688,65536,104071168,65536,3604491,65536,2097156,2147549184,16515592,14876672,65536,163315712,65536,35848322,65536,104792068,65536,163381252,65536,163446784,65536,163512449,65536,5308427,65536,105709619,2147483648,27131906,0,1441792,0,
+5,2162688,0,164364292,0,164429828,0,164495364,0,164560900,0,31,1835446,2147549184,104137142,1900982,65536,1966084,65536,16121860,65536,142344199,65536,2097154,65536,17956866,65536,142409731,65536,3276800,65536,142475268,65536,2162688,65536,104071168,65536,3604491,65536,2097156,
+2147549184,16515592,14876672,65536,163315712,65536,35848322,65536,104792068,65536,163381252,65536,163446784,65536,163512449,65536,5308427,65536,2097156,2147483648,19595268,0,105381895,0,16121860,0,18022404,0,18087940,0,164037150,0,164102148,0,105447428,0,28,1835446,2147549184,104137142,
+1900982,65536,1966084,65536,16121860,65536,142344199,65536,2097154,65536,17956866,65536,142409731,65536,3276800,65536,142475268,65536,2162688,65536,104071168,65536,3604491,65536,2097156,2147549184,16515592,14876672,65536,163315712,65536,35848322,65536,104792068,65536,163381252,65536,163446784,65536,163512449,
+65536,5308427,65536,16121860,2147483648,69074948,0,99221511,0,19464199,0,112525316,0,112590852,0,28,1835446,2147549184,104137142,1900982,65536,1966084,65536,16121860,65536,142344199,65536,2097154,65536,17956866,65536,142409731,65536,3276800,65536,142475268,65536,2162688,65536,104071168,
+65536,3604491,65536,2097156,2147549184,16515592,14876672,65536,163315712,65536,35848322,65536,104792068,65536,163381252,65536,163446784,65536,163512449,65536,5308427,65536,105709619,2147483648,2097156,0,99221508,0,105775111,0,105840644,0,105906306,0,35,1835446,2147549184,104137142,1900982,65536,
+1966084,65536,16121860,65536,142344199,65536,2097154,65536,17956866,65536,142409731,65536,3276800,65536,142475268,65536,2162688,65536,104071168,65536,3604491,65536,2097156,2147549184,16515592,14876672,65536,163315712,65536,35848322,65536,104792068,65536,163381252,65536,163446784,65536,163512449,65536,5308427,
+65536,66977843,2147483648,111870003,0,111935495,0,112001026,0,112066560,0,112132096,0,112197639,0,112263168,0,112328704,0,3276800,0,112394247,0,112459780,0,107020591,0,40,1835446,2147549184,104137142,1900982,65536,1966084,65536,16121860,65536,142344199,65536,2097154,
+65536,17956866,65536,142409731,65536,3276800,65536,142475268,65536,2162688,65536,104071168,65536,3604491,65536,2097156,2147549184,16515592,14876672,65536,163315712,65536,35848322,65536,104792068,65536,163381252,65536,163446784,65536,163512449,65536,5308427,65536,6029319,2147483648,6094855,0,106299399,0,
+5963783,0,2097154,0,16121858,0,106364930,0,106430466,0,106496007,0,106561543,0,106627074,0,1441792,0,105709619,0,106692615,0,106758151,0,106823680,0,106889223,0,106954759,0,29,1835446,2147549184,104137142,1900982,65536,1966084,65536,16121860,65536,
+142344199,65536,2097154,65536,17956866,65536,142409731,65536,3276800,65536,142475268,65536,2162688,65536,104071168,65536,3604491,65536,2097156,2147549184,16515592,14876672,65536,163315712,65536,35848322,65536,104792068,65536,163381252,65536,163446784,65536,163512449,65536,5308427,65536,16121858,2147483648,131072,
+0,917506,0,104398855,0,5963783,0,43450375,0,30015495,0,32,1835446,2147549184,104137142,1900982,65536,1966084,65536,16121860,65536,142344199,65536,2097154,65536,17956866,65536,142409731,65536,3276800,65536,142475268,65536,2162688,65536,104071168,65536,3604491,65536,2097156,
+2147549184,16515592,14876672,65536,163315712,65536,35848322,65536,104792068,65536,163381252,65536,163446784,65536,163512449,65536,5308427,65536,108920839,2147483648,99680263,0,108986375,0,109051911,0,109117447,0,104792068,0,109182978,0,16121858,0,109248519,0,131072,0,3,114688004,
+0,164626434,0,164691970,0,5,164757504,0,164823042,0,143130626,0,164888578,0,164954114,0,6,1835019,0,1900555,0,114688004,2147549184,165019797,164626434,65536,164691970,65536,165085430,2147483648,3,131923979,2147549184,165150742,131989515,65536,132055050,2147483648,134,1835019,
+2147549184,4980762,1900555,65536,3801114,65536,3866655,65536,3932192,65536,3997696,65536,2097154,65536,2621444,65536,4063236,65536,4128772,65536,4194308,65536,4259844,65536,4325380,65536,4390916,65536,3735552,2147614720,4980762,4456478,4522008,2147549184,4980762,4587544,65536,4653067,65536,4718620,
+65536,4784154,65536,4849675,65536,4915233,65536,3604514,65536,24576098,2147483648,5046272,0,46661636,0,44367876,0,165216260,0,116523015,0,116588551,0,115147073,0,50332201,0,165282063,0,303628290,2147614720,165347882,162399254,303693826,131072,303759367,131072,303824898,131072,303890434,
+131072,303955970,131072,304021506,131072,304087042,131072,304152578,131072,155844615,131072,304218114,131072,30277634,131072,304283652,131072,304349188,131072,304414724,131072,304480260,131072,25624583,131072,304545796,131072,304611332,131072,304676871,131072,304742407,131072,300679179,2147614720,165347882,306775059,300744706,131072,3276800,
+131072,300810247,131072,300875783,131072,300941319,131072,301006850,131072,22937600,131072,301072391,131072,301137927,131072,301203463,131072,301268999,131072,301334535,131072,301400071,131072,301465607,131072,301531143,131072,301596679,131072,301662215,131072,301727751,131072,301793287,131072,301858823,131072,301924359,131072,301989895,
+131072,302055431,131072,302120967,131072,131923979,2147614720,165347882,305790998,131989515,131072,131923979,2147614720,165347882,305856534,131989515,131072,2097156,2147614720,165347882,306054168,128843783,131072,305594372,131072,305659908,131072,305726482,131072,2097156,2147614720,165347882,306840599,304807940,131072,304873476,131072,304939012,131072,305004548,
+131072,305070087,131072,305136174,131072,305201156,131072,305266695,131072,305332231,131072,22740999,131072,305397767,131072,305463303,131072,305528839,131072,113704964,131072,44367876,131072,24052270,2147549184,165347882,306906133,65536,131923979,2147614720,165347882,306970646,131989515,131072,307036164,2147549184,165347882,307101700,65536,119669786,
+65536,59047940,2147614720,165347882,307168285,306577410,131072,2097154,131072,131923979,2147680256,165347882,307168285,306642966,131989515,196608,131923979,2147680256,165347882,307168285,13631510,131989515,196608,306708484,2147614720,165347882,307168285,131072,131072,165412875,2147483648,164757504,2147549184,165478950,164823042,65536,143130626,65536,164888578,65536,
+164954114,65536,2097156,2147483648,2359300,0,6029316,0,17301508,0,2162688,2147549184,116654251,131923979,2147614720,12190248,165150742,131989515,131072,132055050,2147549184,12190248,20,59047938,0,165543938,0,165609476,0,165675012,0,165740548,0,302186503,2147549184,165806636,302252039,65536,302317575,65536,
+302383111,65536,114688004,65536,2097156,65536,165872173,2147483648,165937709,0,166002695,0,166068226,0,166133762,0,166199300,0,166265390,0,166330924,0,166395911,0,10,1835567,0,1901103,0,1966082,0,2097154,0,166461440,0,166526983,0,166592519,0,13631490,
+0,166658050,0,29622323,0,22,1835568,0,1901104,0,2097154,0,16121858,0,166723586,0,166789122,0,22085693,0,105709619,0,22413319,0,22478855,0,22544391,0,22609927,0,166854663,0,166920199,0,22675463,0,22740999,0,18153479,0,
+18219015,0,166985728,0,167051264,0,131923979,2147549184,21364758,131989515,65536,2,167116800,0,29097984,0,14,167116800,2147549184,167182897,29097984,65536,262144,2147483648,0,0,167247872,0,2097156,0,167313410,0,167378946,0,167444480,0,196608,0,167510027,0,
+4522008,0,167575564,0,29097984,0,9,167116800,2147549184,167182897,29097984,65536,262144,2147483648,0,0,2097156,0,131072,0,167641649,0,167706628,0,167772164,0,12,167116800,2147614720,167838259,167182897,29097984,131072,262144,2147549184,167838259,0,65536,2097156,65536,
+131072,65536,167641649,65536,167706628,65536,167772164,65536,167903236,2147483648,167968772,0,3605045,0,11,69009415,0,655367,0,720903,0,17891339,0,168034306,0,168099842,0,168165378,0,168230914,0,168296450,0,168361986,0,131072,0,35,1835575,0,
+1901111,0,8126488,0,168427520,0,2162688,0,168493067,0,1966082,0,2097154,0,168558594,0,168624130,0,168690232,0,23461888,0,1310731,0,168755204,0,168820736,0,167313408,0,3276800,0,115933184,0,168886272,0,167444480,0,168951812,0,
+169017348,0,169083449,0,69009415,2147549184,169148982,655367,65536,720903,65536,17891339,65536,168034306,65536,168099842,65536,168165378,65536,168230914,65536,168296450,65536,168361986,65536,131072,65536,3605050,2147483648,3,167772164,0,2097152,0,1179648,0,36,1835580,0,1901116,
+0,131923979,2147549184,169213974,131989515,65536,131923979,2147549184,169279510,131989515,65536,2162688,2147483648,167772164,0,2097156,0,23461888,0,168690237,0,1966082,0,169345026,0,169410562,0,169476098,0,169541639,0,169607175,0,169672716,0,29097984,0,20185114,0,168493067,
+0,8126488,0,4587544,0,8782396,0,169738247,0,71237639,0,31195143,0,169803783,0,169869319,0,169934855,0,170000391,0,115933184,0,6160391,0,170065924,0,170132027,0,3605054,0,1,327684,0,8,1835577,0,1901113,0,170197564,
+0,170263100,0,170328631,0,170394167,0,2097156,0,170459140,0,2,170524676,0,170590212,0,4,4980740,0,131072,0,170524676,2147549184,170656320,170590212,65536,68,1835019,2147549184,4980762,1900555,65536,3801114,65536,3866655,65536,3932192,65536,3997696,65536,
+2097154,65536,2621444,65536,4063236,65536,4128772,65536,4194308,65536,4259844,65536,4325380,65536,4390916,65536,3735552,2147614720,4980762,4456478,4522008,2147549184,4980762,4587544,65536,4653067,65536,4718620,65536,4784154,65536,4849675,65536,4915233,65536,3604514,65536,24576098,2147483648,56098842,
+0,168690242,0,23461888,0,0,0,165282063,0,170721287,0,131923979,2147549184,170786838,131989515,65536,131923979,2147549184,170852374,131989515,65536,1966084,2147483648,170917892,0,2097156,0,170983428,0,171048964,0,1245188,0,56492036,0,171114500,0,66650119,2147549184,171180114,
+58851335,65536,66715655,65536,58916871,65536,131923979,2147549184,169213974,131989515,65536,131923979,2147549184,169279510,131989515,65536,167116800,2147680256,171246132,167838259,167182897,29097984,196608,262144,2147614720,171246132,167838259,0,131072,2097156,131072,131072,131072,167641649,131072,167706628,131072,167772164,131072,167903236,
+2147549184,171246132,167968772,65536,3605045,65536,327684,2147549184,171311679,171376644,2147483648,171442753,0,171508291,0,15073317,0,3605060,0,4,2031620,0,327684,0,655364,0,720900,0,4,2031620,0,327687,0,655367,0,720903,0,1,327680,0,
+5,2031620,0,171573255,0,655367,0,720903,0,171638788,0,1,171704327,0,1,171573255,0,3,2031620,0,131072,0,171769856,0,1,171835443,0,1,171835538,0,1,171835458,0,1,171835623,0,1,171835522,0,1,
+171835607,0,1,171835634,0,1,171835545,0,1,171835792,0,1,171835990,0,3,327684,0,119341060,0,1114712,0,3,2097156,0,131072,0,171900928,0,2,2097154,0,171966466,0,1,172032000,0,6,100663300,0,18022404,
+0,172097540,0,172163072,0,172228608,0,3276800,0,6,172294151,0,172359687,0,60424199,0,172425223,0,172490759,0,131072,0,26,172294151,2147549184,172556892,172359687,65536,60424199,65536,172425223,65536,172490759,65536,131072,65536,172294151,2147549184,172622428,172359687,
+65536,60424199,65536,172425223,65536,172490759,65536,131072,65536,172294151,2147549184,172687964,172359687,65536,60424199,65536,172425223,65536,172490759,65536,131072,65536,172294151,2147549184,172753500,172359687,65536,60424199,65536,172425223,65536,172490759,65536,131072,65536,172818439,2147483648,172883975,0,5,
+109576199,0,172949508,0,173015047,0,173080583,0,173146119,0,6,56885255,0,56950791,0,46596103,0,31195143,0,71237639,0,131072,0,6,56885255,0,56950791,0,46596103,0,31195143,0,71237639,0,131072,0,2,100925444,0,173211648,
+0,14,173277186,0,173342722,0,120193026,0,173408258,0,173473794,0,117178370,0,173539330,0,173604866,0,146866183,0,173670407,0,173735943,0,173801474,0,173867008,0,60424192,0,8,173932551,0,173998087,0,30015495,0,109576199,0,174063623,
+0,174129159,0,146538498,0,3276800,0,4,174194695,0,174260231,0,146538498,0,3276800,0,7,19398658,0,174325762,0,174391300,0,174456839,0,174522375,0,174587904,0,1179648,0,3,143654919,0,174653447,0,174718983,0,3,174784519,
+0,174850055,0,1703943,0,42,5046272,0,217710592,2147549184,174916201,217776128,65536,19791872,65536,217841664,65536,2097152,65536,143130624,65536,217907200,65536,217972736,65536,218038272,65536,218103808,65536,218169344,65536,218234880,65536,218300416,65536,1179648,65536,218365954,65536,218431490,
+65536,218497031,65536,2097154,2147614720,174916201,218562888,217513984,131072,217579520,131072,217645056,131072,1179648,131072,116850688,2147549184,174916201,218628096,65536,16384000,65536,2097156,2147614720,174916201,179437737,131072,131072,60227584,131072,60293120,131072,60358663,131072,60424199,131072,60489735,131072,60555271,131072,
+60620929,131072,5308427,131072,60686336,2147614720,174916201,179372202,60751872,131072,29097984,131072,2162688,2147614720,174916201,218693803,18022404,2147483648,18087940,0,46,167772164,0,174981122,0,175046656,0,175112192,0,175177728,0,29097984,0,262144,0,217710592,2147549184,77267561,217776128,65536,
+19791872,65536,217841664,65536,2097152,65536,143130624,65536,217907200,65536,217972736,65536,218038272,65536,218103808,65536,218169344,65536,218234880,65536,218300416,65536,1179648,65536,218365954,65536,218431490,65536,218497031,65536,2097154,2147614720,77267561,218562888,217513984,131072,217579520,131072,217645056,131072,
+1179648,131072,116850688,2147549184,77267561,218628096,65536,16384000,65536,2097156,2147614720,77267561,179437737,131072,131072,60227584,131072,60293120,131072,60358663,131072,60424199,131072,60489735,131072,60555271,131072,60620929,131072,5308427,131072,60686336,2147614720,77267561,179372202,60751872,131072,29097984,131072,2162688,
+2147614720,77267561,218693803,46,175243264,0,175308800,0,217710592,2147549184,77267561,217776128,65536,19791872,65536,217841664,65536,2097152,65536,143130624,65536,217907200,65536,217972736,65536,218038272,65536,218103808,65536,218169344,65536,218234880,65536,218300416,65536,1179648,65536,218365954,65536,218431490,
+65536,218497031,65536,2097154,2147614720,77267561,218562888,217513984,131072,217579520,131072,217645056,131072,1179648,131072,116850688,2147549184,77267561,218628096,65536,16384000,65536,2097156,2147614720,77267561,179437737,131072,131072,60227584,131072,60293120,131072,60358663,131072,60424199,131072,60489735,131072,60555271,131072,
+60620929,131072,5308427,131072,60686336,2147614720,77267561,179372202,60751872,131072,29097984,131072,2162688,2147614720,77267561,218693803,175374954,2147483648,175439876,0,175505412,0,175177728,0,29097984,0,46,175570946,0,175636482,0,175177728,0,7733248,0,175702016,0,217710592,2147549184,77267561,
+217776128,65536,19791872,65536,217841664,65536,2097152,65536,143130624,65536,217907200,65536,217972736,65536,218038272,65536,218103808,65536,218169344,65536,218234880,65536,218300416,65536,1179648,65536,218365954,65536,218431490,65536,218497031,65536,2097154,2147614720,77267561,218562888,217513984,131072,217579520,131072,
+217645056,131072,1179648,131072,116850688,2147549184,77267561,218628096,65536,16384000,65536,2097156,2147614720,77267561,179437737,131072,131072,60227584,131072,60293120,131072,60358663,131072,60424199,131072,60489735,131072,60555271,131072,60620929,131072,5308427,131072,60686336,2147614720,77267561,179372202,60751872,131072,29097984,
+131072,2162688,2147614720,77267561,218693803,175767552,2147483648,34537472,0,9,175833095,0,175898631,0,175964167,0,72220679,0,176029703,0,176095239,0,176160775,0,176226306,0,176291842,0,8,176357378,0,176422914,0,176488450,0,176553986,0,176619527,0,176685063,
+0,176750599,0,176816135,0,2,56885255,0,56950791,0,1,2162688,0,2,16121857,0,176881665,0,8,176947200,0,177012736,0,177078272,0,56033280,0,112656391,0,177143815,0,22740999,0,46596103,0,2,177209355,0,177274891,0,
+14,1966080,0,143130624,0,146538496,0,109576192,0,56033280,0,19398656,0,177340416,0,177405952,0,177471495,0,177537031,0,143654919,0,177602567,0,177668103,0,14876672,0,8,177733639,0,19595271,0,60424199,0,139919367,0,177799175,0,
+61014023,0,177864711,0,1966084,0,5,177930242,0,177995778,0,178061314,0,3276800,0,178126852,0,12,178192391,0,66519047,0,178257927,0,178323463,0,131072,0,178388999,0,178454535,0,178520071,0,178585607,0,178651143,0,178716679,0,
+178782215,0,6,178847746,0,178913282,0,178978823,0,179044359,0,179109895,0,179175431,0,2,179240960,0,179306496,0,13,60686336,2147549184,179372202,60751872,65536,29097984,65536,2097156,2147549184,179437737,131072,65536,60227584,65536,60293120,65536,60358663,65536,60424199,
+65536,60489735,65536,60555271,65536,60620929,65536,5308427,65536,1,30998528,0,2,179503108,0,179568644,0,1,16121856,0,219,9568263,2147549184,179634815,108265479,65536,9633799,65536,2097156,65536,273350656,65536,273416192,65536,273481728,65536,185532416,65536,1966084,65536,
+124649479,65536,276955143,65536,277020679,65536,29622323,65536,61145090,2147614720,179700352,277086342,57737218,131072,61210624,131072,61276160,131072,21823488,131072,61341696,131072,60817415,2147680256,179700352,277086342,61407404,60882951,196608,60948487,196608,61014023,196608,61079559,196608,57737220,196608,60817415,196609,60882951,
+196609,60948487,196609,61014023,196609,61079559,196609,57737220,196609,60817415,196610,60882951,196610,60948487,196610,61014023,196610,61079559,196610,57737220,196610,60817415,196611,60882951,196611,60948487,196611,61014023,196611,61079559,196611,57737220,196611,60817415,196612,60882951,196612,60948487,196612,61014023,
+196612,61079559,196612,57737220,196612,60817415,196613,60882951,196613,60948487,196613,61014023,196613,61079559,196613,57737220,196613,60817415,196614,60882951,196614,60948487,196614,61014023,196614,61079559,196614,57737220,196614,60817415,196615,60882951,196615,60948487,196615,61014023,196615,61079559,196615,57737220,
+196615,60817415,196616,60882951,196616,60948487,196616,61014023,196616,61079559,196616,57737220,196616,60817415,196617,60882951,196617,60948487,196617,61014023,196617,61079559,196617,57737220,196617,60817415,196618,60882951,196618,60948487,196618,61014023,196618,61079559,196618,57737220,196618,60817415,196619,60882951,
+196619,60948487,196619,61014023,196619,61079559,196619,57737220,196619,60817415,196620,60882951,196620,60948487,196620,61014023,196620,61079559,196620,57737220,196620,60817415,196621,60882951,196621,60948487,196621,61014023,196621,61079559,196621,57737220,196621,60817415,196622,60882951,196622,60948487,196622,61014023,
+196622,61079559,196622,57737220,196622,60817415,196623,60882951,196623,60948487,196623,61014023,196623,61079559,196623,57737220,196623,60817415,196624,60882951,196624,60948487,196624,61014023,196624,61079559,196624,57737220,196624,60817415,196625,60882951,196625,60948487,196625,61014023,196625,61079559,196625,57737220,
+196625,60817415,196626,60882951,196626,60948487,196626,61014023,196626,61079559,196626,57737220,196626,60817415,196627,60882951,196627,60948487,196627,61014023,196627,61079559,196627,57737220,196627,60817415,196628,60882951,196628,60948487,196628,61014023,196628,61079559,196628,57737220,196628,60817415,196629,60882951,
+196629,60948487,196629,61014023,196629,61079559,196629,57737220,196629,60817415,196630,60882951,196630,60948487,196630,61014023,196630,61079559,196630,57737220,196630,60817415,196631,60882951,196631,60948487,196631,61014023,196631,61079559,196631,57737220,196631,60817415,196632,60882951,196632,60948487,196632,61014023,
+196632,61079559,196632,57737220,196632,60817415,196633,60882951,196633,60948487,196633,61014023,196633,61079559,196633,57737220,196633,60817415,196634,60882951,196634,60948487,196634,61014023,196634,61079559,196634,57737220,196634,60817415,196635,60882951,196635,60948487,196635,61014023,196635,61079559,196635,57737220,
+196635,60817415,196636,60882951,196636,60948487,196636,61014023,196636,61079559,196636,57737220,196636,60817415,196637,60882951,196637,60948487,196637,61014023,196637,61079559,196637,57737220,196637,60817415,196638,60882951,196638,60948487,196638,61014023,196638,61079559,196638,57737220,196638,60817415,196639,60882951,
+196639,60948487,196639,61014023,196639,61079559,196639,57737220,196639,258080775,2147549184,179700352,172359687,65536,172294151,65536,2097156,65536,277151751,65536,262602759,65536,186515460,65536,131072,65536,233,9568263,2147614720,459390,179634815,108265479,131072,9633799,131072,2097156,131072,273350656,131072,273416192,
+131072,273481728,131072,185532416,131072,1966084,131072,124649479,131072,276955143,131072,277020679,131072,29622323,131072,61145090,2147680256,459390,179700352,277086342,57737218,196608,61210624,196608,61276160,196608,21823488,196608,61341696,196608,60817415,2147745792,459390,179700352,277086342,61407404,60882951,262144,60948487,262144,
+61014023,262144,61079559,262144,57737220,262144,60817415,262145,60882951,262145,60948487,262145,61014023,262145,61079559,262145,57737220,262145,60817415,262146,60882951,262146,60948487,262146,61014023,262146,61079559,262146,57737220,262146,60817415,262147,60882951,262147,60948487,262147,61014023,262147,61079559,262147,
+57737220,262147,60817415,262148,60882951,262148,60948487,262148,61014023,262148,61079559,262148,57737220,262148,60817415,262149,60882951,262149,60948487,262149,61014023,262149,61079559,262149,57737220,262149,60817415,262150,60882951,262150,60948487,262150,61014023,262150,61079559,262150,57737220,262150,60817415,262151,
+60882951,262151,60948487,262151,61014023,262151,61079559,262151,57737220,262151,60817415,262152,60882951,262152,60948487,262152,61014023,262152,61079559,262152,57737220,262152,60817415,262153,60882951,262153,60948487,262153,61014023,262153,61079559,262153,57737220,262153,60817415,262154,60882951,262154,60948487,262154,
+61014023,262154,61079559,262154,57737220,262154,60817415,262155,60882951,262155,60948487,262155,61014023,262155,61079559,262155,57737220,262155,60817415,262156,60882951,262156,60948487,262156,61014023,262156,61079559,262156,57737220,262156,60817415,262157,60882951,262157,60948487,262157,61014023,262157,61079559,262157,
+57737220,262157,60817415,262158,60882951,262158,60948487,262158,61014023,262158,61079559,262158,57737220,262158,60817415,262159,60882951,262159,60948487,262159,61014023,262159,61079559,262159,57737220,262159,60817415,262160,60882951,262160,60948487,262160,61014023,262160,61079559,262160,57737220,262160,60817415,262161,
+60882951,262161,60948487,262161,61014023,262161,61079559,262161,57737220,262161,60817415,262162,60882951,262162,60948487,262162,61014023,262162,61079559,262162,57737220,262162,60817415,262163,60882951,262163,60948487,262163,61014023,262163,61079559,262163,57737220,262163,60817415,262164,60882951,262164,60948487,262164,
+61014023,262164,61079559,262164,57737220,262164,60817415,262165,60882951,262165,60948487,262165,61014023,262165,61079559,262165,57737220,262165,60817415,262166,60882951,262166,60948487,262166,61014023,262166,61079559,262166,57737220,262166,60817415,262167,60882951,262167,60948487,262167,61014023,262167,61079559,262167,
+57737220,262167,60817415,262168,60882951,262168,60948487,262168,61014023,262168,61079559,262168,57737220,262168,60817415,262169,60882951,262169,60948487,262169,61014023,262169,61079559,262169,57737220,262169,60817415,262170,60882951,262170,60948487,262170,61014023,262170,61079559,262170,57737220,262170,60817415,262171,
+60882951,262171,60948487,262171,61014023,262171,61079559,262171,57737220,262171,60817415,262172,60882951,262172,60948487,262172,61014023,262172,61079559,262172,57737220,262172,60817415,262173,60882951,262173,60948487,262173,61014023,262173,61079559,262173,57737220,262173,60817415,262174,60882951,262174,60948487,262174,
+61014023,262174,61079559,262174,57737220,262174,60817415,262175,60882951,262175,60948487,262175,61014023,262175,61079559,262175,57737220,262175,258080775,2147614720,459390,179700352,172359687,131072,172294151,131072,2097156,131072,277151751,131072,262602759,131072,186515460,131072,131072,131072,179765252,2147483648,179830791,0,
+179896327,0,179961863,0,180027399,0,180092935,0,180158471,0,180224007,0,180289543,0,180355079,0,180420615,0,180486151,0,180551680,0,29097984,0,238,9568263,2147614720,459390,179634815,108265479,131072,9633799,131072,2097156,131072,273350656,131072,273416192,131072,273481728,
+131072,185532416,131072,1966084,131072,124649479,131072,276955143,131072,277020679,131072,29622323,131072,61145090,2147680256,459390,179700352,277086342,57737218,196608,61210624,196608,61276160,196608,21823488,196608,61341696,196608,60817415,2147745792,459390,179700352,277086342,61407404,60882951,262144,60948487,262144,61014023,262144,
+61079559,262144,57737220,262144,60817415,262145,60882951,262145,60948487,262145,61014023,262145,61079559,262145,57737220,262145,60817415,262146,60882951,262146,60948487,262146,61014023,262146,61079559,262146,57737220,262146,60817415,262147,60882951,262147,60948487,262147,61014023,262147,61079559,262147,57737220,262147,
+60817415,262148,60882951,262148,60948487,262148,61014023,262148,61079559,262148,57737220,262148,60817415,262149,60882951,262149,60948487,262149,61014023,262149,61079559,262149,57737220,262149,60817415,262150,60882951,262150,60948487,262150,61014023,262150,61079559,262150,57737220,262150,60817415,262151,60882951,262151,
+60948487,262151,61014023,262151,61079559,262151,57737220,262151,60817415,262152,60882951,262152,60948487,262152,61014023,262152,61079559,262152,57737220,262152,60817415,262153,60882951,262153,60948487,262153,61014023,262153,61079559,262153,57737220,262153,60817415,262154,60882951,262154,60948487,262154,61014023,262154,
+61079559,262154,57737220,262154,60817415,262155,60882951,262155,60948487,262155,61014023,262155,61079559,262155,57737220,262155,60817415,262156,60882951,262156,60948487,262156,61014023,262156,61079559,262156,57737220,262156,60817415,262157,60882951,262157,60948487,262157,61014023,262157,61079559,262157,57737220,262157,
+60817415,262158,60882951,262158,60948487,262158,61014023,262158,61079559,262158,57737220,262158,60817415,262159,60882951,262159,60948487,262159,61014023,262159,61079559,262159,57737220,262159,60817415,262160,60882951,262160,60948487,262160,61014023,262160,61079559,262160,57737220,262160,60817415,262161,60882951,262161,
+60948487,262161,61014023,262161,61079559,262161,57737220,262161,60817415,262162,60882951,262162,60948487,262162,61014023,262162,61079559,262162,57737220,262162,60817415,262163,60882951,262163,60948487,262163,61014023,262163,61079559,262163,57737220,262163,60817415,262164,60882951,262164,60948487,262164,61014023,262164,
+61079559,262164,57737220,262164,60817415,262165,60882951,262165,60948487,262165,61014023,262165,61079559,262165,57737220,262165,60817415,262166,60882951,262166,60948487,262166,61014023,262166,61079559,262166,57737220,262166,60817415,262167,60882951,262167,60948487,262167,61014023,262167,61079559,262167,57737220,262167,
+60817415,262168,60882951,262168,60948487,262168,61014023,262168,61079559,262168,57737220,262168,60817415,262169,60882951,262169,60948487,262169,61014023,262169,61079559,262169,57737220,262169,60817415,262170,60882951,262170,60948487,262170,61014023,262170,61079559,262170,57737220,262170,60817415,262171,60882951,262171,
+60948487,262171,61014023,262171,61079559,262171,57737220,262171,60817415,262172,60882951,262172,60948487,262172,61014023,262172,61079559,262172,57737220,262172,60817415,262173,60882951,262173,60948487,262173,61014023,262173,61079559,262173,57737220,262173,60817415,262174,60882951,262174,60948487,262174,61014023,262174,
+61079559,262174,57737220,262174,60817415,262175,60882951,262175,60948487,262175,61014023,262175,61079559,262175,57737220,262175,258080775,2147614720,459390,179700352,172359687,131072,172294151,131072,2097156,131072,277151751,131072,262602759,131072,186515460,131072,131072,131072,114622706,2147549184,46334099,114688004,65536,100663300,
+65536,19595268,65536,18022404,65536,114753536,65536,114819072,65536,114884610,65536,114950148,65536,115015682,65536,115081218,65536,26017794,65536,2097154,65536,180617220,2147483648,180682756,0,180748295,0,180813828,0,180879364,0,131072,0,219,9568263,2147614720,459390,179634815,108265479,131072,
+9633799,131072,2097156,131072,273350656,131072,273416192,131072,273481728,131072,185532416,131072,1966084,131072,124649479,131072,276955143,131072,277020679,131072,29622323,131072,61145090,2147680256,459390,179700352,277086342,57737218,196608,61210624,196608,61276160,196608,21823488,196608,61341696,196608,60817415,2147745792,459390,
+179700352,277086342,61407404,60882951,262144,60948487,262144,61014023,262144,61079559,262144,57737220,262144,60817415,262145,60882951,262145,60948487,262145,61014023,262145,61079559,262145,57737220,262145,60817415,262146,60882951,262146,60948487,262146,61014023,262146,61079559,262146,57737220,262146,60817415,262147,60882951,
+262147,60948487,262147,61014023,262147,61079559,262147,57737220,262147,60817415,262148,60882951,262148,60948487,262148,61014023,262148,61079559,262148,57737220,262148,60817415,262149,60882951,262149,60948487,262149,61014023,262149,61079559,262149,57737220,262149,60817415,262150,60882951,262150,60948487,262150,61014023,
+262150,61079559,262150,57737220,262150,60817415,262151,60882951,262151,60948487,262151,61014023,262151,61079559,262151,57737220,262151,60817415,262152,60882951,262152,60948487,262152,61014023,262152,61079559,262152,57737220,262152,60817415,262153,60882951,262153,60948487,262153,61014023,262153,61079559,262153,57737220,
+262153,60817415,262154,60882951,262154,60948487,262154,61014023,262154,61079559,262154,57737220,262154,60817415,262155,60882951,262155,60948487,262155,61014023,262155,61079559,262155,57737220,262155,60817415,262156,60882951,262156,60948487,262156,61014023,262156,61079559,262156,57737220,262156,60817415,262157,60882951,
+262157,60948487,262157,61014023,262157,61079559,262157,57737220,262157,60817415,262158,60882951,262158,60948487,262158,61014023,262158,61079559,262158,57737220,262158,60817415,262159,60882951,262159,60948487,262159,61014023,262159,61079559,262159,57737220,262159,60817415,262160,60882951,262160,60948487,262160,61014023,
+262160,61079559,262160,57737220,262160,60817415,262161,60882951,262161,60948487,262161,61014023,262161,61079559,262161,57737220,262161,60817415,262162,60882951,262162,60948487,262162,61014023,262162,61079559,262162,57737220,262162,60817415,262163,60882951,262163,60948487,262163,61014023,262163,61079559,262163,57737220,
+262163,60817415,262164,60882951,262164,60948487,262164,61014023,262164,61079559,262164,57737220,262164,60817415,262165,60882951,262165,60948487,262165,61014023,262165,61079559,262165,57737220,262165,60817415,262166,60882951,262166,60948487,262166,61014023,262166,61079559,262166,57737220,262166,60817415,262167,60882951,
+262167,60948487,262167,61014023,262167,61079559,262167,57737220,262167,60817415,262168,60882951,262168,60948487,262168,61014023,262168,61079559,262168,57737220,262168,60817415,262169,60882951,262169,60948487,262169,61014023,262169,61079559,262169,57737220,262169,60817415,262170,60882951,262170,60948487,262170,61014023,
+262170,61079559,262170,57737220,262170,60817415,262171,60882951,262171,60948487,262171,61014023,262171,61079559,262171,57737220,262171,60817415,262172,60882951,262172,60948487,262172,61014023,262172,61079559,262172,57737220,262172,60817415,262173,60882951,262173,60948487,262173,61014023,262173,61079559,262173,57737220,
+262173,60817415,262174,60882951,262174,60948487,262174,61014023,262174,61079559,262174,57737220,262174,60817415,262175,60882951,262175,60948487,262175,61014023,262175,61079559,262175,57737220,262175,258080775,2147614720,459390,179700352,172359687,131072,172294151,131072,2097156,131072,277151751,131072,262602759,131072,186515460,
+131072,131072,131072,223,9568263,2147614720,459390,179634815,108265479,131072,9633799,131072,2097156,131072,273350656,131072,273416192,131072,273481728,131072,185532416,131072,1966084,131072,124649479,131072,276955143,131072,277020679,131072,29622323,131072,61145090,2147680256,459390,179700352,277086342,57737218,196608,61210624,
+196608,61276160,196608,21823488,196608,61341696,196608,60817415,2147745792,459390,179700352,277086342,61407404,60882951,262144,60948487,262144,61014023,262144,61079559,262144,57737220,262144,60817415,262145,60882951,262145,60948487,262145,61014023,262145,61079559,262145,57737220,262145,60817415,262146,60882951,262146,60948487,
+262146,61014023,262146,61079559,262146,57737220,262146,60817415,262147,60882951,262147,60948487,262147,61014023,262147,61079559,262147,57737220,262147,60817415,262148,60882951,262148,60948487,262148,61014023,262148,61079559,262148,57737220,262148,60817415,262149,60882951,262149,60948487,262149,61014023,262149,61079559,
+262149,57737220,262149,60817415,262150,60882951,262150,60948487,262150,61014023,262150,61079559,262150,57737220,262150,60817415,262151,60882951,262151,60948487,262151,61014023,262151,61079559,262151,57737220,262151,60817415,262152,60882951,262152,60948487,262152,61014023,262152,61079559,262152,57737220,262152,60817415,
+262153,60882951,262153,60948487,262153,61014023,262153,61079559,262153,57737220,262153,60817415,262154,60882951,262154,60948487,262154,61014023,262154,61079559,262154,57737220,262154,60817415,262155,60882951,262155,60948487,262155,61014023,262155,61079559,262155,57737220,262155,60817415,262156,60882951,262156,60948487,
+262156,61014023,262156,61079559,262156,57737220,262156,60817415,262157,60882951,262157,60948487,262157,61014023,262157,61079559,262157,57737220,262157,60817415,262158,60882951,262158,60948487,262158,61014023,262158,61079559,262158,57737220,262158,60817415,262159,60882951,262159,60948487,262159,61014023,262159,61079559,
+262159,57737220,262159,60817415,262160,60882951,262160,60948487,262160,61014023,262160,61079559,262160,57737220,262160,60817415,262161,60882951,262161,60948487,262161,61014023,262161,61079559,262161,57737220,262161,60817415,262162,60882951,262162,60948487,262162,61014023,262162,61079559,262162,57737220,262162,60817415,
+262163,60882951,262163,60948487,262163,61014023,262163,61079559,262163,57737220,262163,60817415,262164,60882951,262164,60948487,262164,61014023,262164,61079559,262164,57737220,262164,60817415,262165,60882951,262165,60948487,262165,61014023,262165,61079559,262165,57737220,262165,60817415,262166,60882951,262166,60948487,
+262166,61014023,262166,61079559,262166,57737220,262166,60817415,262167,60882951,262167,60948487,262167,61014023,262167,61079559,262167,57737220,262167,60817415,262168,60882951,262168,60948487,262168,61014023,262168,61079559,262168,57737220,262168,60817415,262169,60882951,262169,60948487,262169,61014023,262169,61079559,
+262169,57737220,262169,60817415,262170,60882951,262170,60948487,262170,61014023,262170,61079559,262170,57737220,262170,60817415,262171,60882951,262171,60948487,262171,61014023,262171,61079559,262171,57737220,262171,60817415,262172,60882951,262172,60948487,262172,61014023,262172,61079559,262172,57737220,262172,60817415,
+262173,60882951,262173,60948487,262173,61014023,262173,61079559,262173,57737220,262173,60817415,262174,60882951,262174,60948487,262174,61014023,262174,61079559,262174,57737220,262174,60817415,262175,60882951,262175,60948487,262175,61014023,262175,61079559,262175,57737220,262175,258080775,2147614720,459390,179700352,172359687,
+131072,172294151,131072,2097156,131072,277151751,131072,262602759,131072,186515460,131072,131072,131072,180944900,2147483648,181010436,0,19595271,0,181075975,0,236,9568263,2147614720,459390,179634815,108265479,131072,9633799,131072,2097156,131072,273350656,131072,273416192,131072,273481728,131072,185532416,131072,
+1966084,131072,124649479,131072,276955143,131072,277020679,131072,29622323,131072,61145090,2147680256,459390,179700352,277086342,57737218,196608,61210624,196608,61276160,196608,21823488,196608,61341696,196608,60817415,2147745792,459390,179700352,277086342,61407404,60882951,262144,60948487,262144,61014023,262144,61079559,262144,57737220,
+262144,60817415,262145,60882951,262145,60948487,262145,61014023,262145,61079559,262145,57737220,262145,60817415,262146,60882951,262146,60948487,262146,61014023,262146,61079559,262146,57737220,262146,60817415,262147,60882951,262147,60948487,262147,61014023,262147,61079559,262147,57737220,262147,60817415,262148,60882951,
+262148,60948487,262148,61014023,262148,61079559,262148,57737220,262148,60817415,262149,60882951,262149,60948487,262149,61014023,262149,61079559,262149,57737220,262149,60817415,262150,60882951,262150,60948487,262150,61014023,262150,61079559,262150,57737220,262150,60817415,262151,60882951,262151,60948487,262151,61014023,
+262151,61079559,262151,57737220,262151,60817415,262152,60882951,262152,60948487,262152,61014023,262152,61079559,262152,57737220,262152,60817415,262153,60882951,262153,60948487,262153,61014023,262153,61079559,262153,57737220,262153,60817415,262154,60882951,262154,60948487,262154,61014023,262154,61079559,262154,57737220,
+262154,60817415,262155,60882951,262155,60948487,262155,61014023,262155,61079559,262155,57737220,262155,60817415,262156,60882951,262156,60948487,262156,61014023,262156,61079559,262156,57737220,262156,60817415,262157,60882951,262157,60948487,262157,61014023,262157,61079559,262157,57737220,262157,60817415,262158,60882951,
+262158,60948487,262158,61014023,262158,61079559,262158,57737220,262158,60817415,262159,60882951,262159,60948487,262159,61014023,262159,61079559,262159,57737220,262159,60817415,262160,60882951,262160,60948487,262160,61014023,262160,61079559,262160,57737220,262160,60817415,262161,60882951,262161,60948487,262161,61014023,
+262161,61079559,262161,57737220,262161,60817415,262162,60882951,262162,60948487,262162,61014023,262162,61079559,262162,57737220,262162,60817415,262163,60882951,262163,60948487,262163,61014023,262163,61079559,262163,57737220,262163,60817415,262164,60882951,262164,60948487,262164,61014023,262164,61079559,262164,57737220,
+262164,60817415,262165,60882951,262165,60948487,262165,61014023,262165,61079559,262165,57737220,262165,60817415,262166,60882951,262166,60948487,262166,61014023,262166,61079559,262166,57737220,262166,60817415,262167,60882951,262167,60948487,262167,61014023,262167,61079559,262167,57737220,262167,60817415,262168,60882951,
+262168,60948487,262168,61014023,262168,61079559,262168,57737220,262168,60817415,262169,60882951,262169,60948487,262169,61014023,262169,61079559,262169,57737220,262169,60817415,262170,60882951,262170,60948487,262170,61014023,262170,61079559,262170,57737220,262170,60817415,262171,60882951,262171,60948487,262171,61014023,
+262171,61079559,262171,57737220,262171,60817415,262172,60882951,262172,60948487,262172,61014023,262172,61079559,262172,57737220,262172,60817415,262173,60882951,262173,60948487,262173,61014023,262173,61079559,262173,57737220,262173,60817415,262174,60882951,262174,60948487,262174,61014023,262174,61079559,262174,57737220,
+262174,60817415,262175,60882951,262175,60948487,262175,61014023,262175,61079559,262175,57737220,262175,258080775,2147614720,459390,179700352,172359687,131072,172294151,131072,2097156,131072,277151751,131072,262602759,131072,186515460,131072,131072,131072,114622706,2147549184,46334099,114688004,65536,100663300,65536,19595268,65536,
+18022404,65536,114753536,65536,114819072,65536,114884610,65536,114950148,65536,115015682,65536,115081218,65536,26017794,65536,2097154,65536,180617220,2147483648,180682756,0,180813828,0,131072,0,221,9568263,2147614720,459390,179634815,108265479,131072,9633799,131072,2097156,131072,273350656,131072,273416192,
+131072,273481728,131072,185532416,131072,1966084,131072,124649479,131072,276955143,131072,277020679,131072,29622323,131072,61145090,2147680256,459390,179700352,277086342,57737218,196608,61210624,196608,61276160,196608,21823488,196608,61341696,196608,60817415,2147745792,459390,179700352,277086342,61407404,60882951,262144,60948487,262144,
+61014023,262144,61079559,262144,57737220,262144,60817415,262145,60882951,262145,60948487,262145,61014023,262145,61079559,262145,57737220,262145,60817415,262146,60882951,262146,60948487,262146,61014023,262146,61079559,262146,57737220,262146,60817415,262147,60882951,262147,60948487,262147,61014023,262147,61079559,262147,
+57737220,262147,60817415,262148,60882951,262148,60948487,262148,61014023,262148,61079559,262148,57737220,262148,60817415,262149,60882951,262149,60948487,262149,61014023,262149,61079559,262149,57737220,262149,60817415,262150,60882951,262150,60948487,262150,61014023,262150,61079559,262150,57737220,262150,60817415,262151,
+60882951,262151,60948487,262151,61014023,262151,61079559,262151,57737220,262151,60817415,262152,60882951,262152,60948487,262152,61014023,262152,61079559,262152,57737220,262152,60817415,262153,60882951,262153,60948487,262153,61014023,262153,61079559,262153,57737220,262153,60817415,262154,60882951,262154,60948487,262154,
+61014023,262154,61079559,262154,57737220,262154,60817415,262155,60882951,262155,60948487,262155,61014023,262155,61079559,262155,57737220,262155,60817415,262156,60882951,262156,60948487,262156,61014023,262156,61079559,262156,57737220,262156,60817415,262157,60882951,262157,60948487,262157,61014023,262157,61079559,262157,
+57737220,262157,60817415,262158,60882951,262158,60948487,262158,61014023,262158,61079559,262158,57737220,262158,60817415,262159,60882951,262159,60948487,262159,61014023,262159,61079559,262159,57737220,262159,60817415,262160,60882951,262160,60948487,262160,61014023,262160,61079559,262160,57737220,262160,60817415,262161,
+60882951,262161,60948487,262161,61014023,262161,61079559,262161,57737220,262161,60817415,262162,60882951,262162,60948487,262162,61014023,262162,61079559,262162,57737220,262162,60817415,262163,60882951,262163,60948487,262163,61014023,262163,61079559,262163,57737220,262163,60817415,262164,60882951,262164,60948487,262164,
+61014023,262164,61079559,262164,57737220,262164,60817415,262165,60882951,262165,60948487,262165,61014023,262165,61079559,262165,57737220,262165,60817415,262166,60882951,262166,60948487,262166,61014023,262166,61079559,262166,57737220,262166,60817415,262167,60882951,262167,60948487,262167,61014023,262167,61079559,262167,
+57737220,262167,60817415,262168,60882951,262168,60948487,262168,61014023,262168,61079559,262168,57737220,262168,60817415,262169,60882951,262169,60948487,262169,61014023,262169,61079559,262169,57737220,262169,60817415,262170,60882951,262170,60948487,262170,61014023,262170,61079559,262170,57737220,262170,60817415,262171,
+60882951,262171,60948487,262171,61014023,262171,61079559,262171,57737220,262171,60817415,262172,60882951,262172,60948487,262172,61014023,262172,61079559,262172,57737220,262172,60817415,262173,60882951,262173,60948487,262173,61014023,262173,61079559,262173,57737220,262173,60817415,262174,60882951,262174,60948487,262174,
+61014023,262174,61079559,262174,57737220,262174,60817415,262175,60882951,262175,60948487,262175,61014023,262175,61079559,262175,57737220,262175,258080775,2147614720,459390,179700352,172359687,131072,172294151,131072,2097156,131072,277151751,131072,262602759,131072,186515460,131072,131072,131072,1966080,2147483648,29097984,0,
+221,9568263,2147614720,459390,179634815,108265479,131072,9633799,131072,2097156,131072,273350656,131072,273416192,131072,273481728,131072,185532416,131072,1966084,131072,124649479,131072,276955143,131072,277020679,131072,29622323,131072,61145090,2147680256,459390,179700352,277086342,57737218,196608,61210624,196608,61276160,196608,
+21823488,196608,61341696,196608,60817415,2147745792,459390,179700352,277086342,61407404,60882951,262144,60948487,262144,61014023,262144,61079559,262144,57737220,262144,60817415,262145,60882951,262145,60948487,262145,61014023,262145,61079559,262145,57737220,262145,60817415,262146,60882951,262146,60948487,262146,61014023,262146,
+61079559,262146,57737220,262146,60817415,262147,60882951,262147,60948487,262147,61014023,262147,61079559,262147,57737220,262147,60817415,262148,60882951,262148,60948487,262148,61014023,262148,61079559,262148,57737220,262148,60817415,262149,60882951,262149,60948487,262149,61014023,262149,61079559,262149,57737220,262149,
+60817415,262150,60882951,262150,60948487,262150,61014023,262150,61079559,262150,57737220,262150,60817415,262151,60882951,262151,60948487,262151,61014023,262151,61079559,262151,57737220,262151,60817415,262152,60882951,262152,60948487,262152,61014023,262152,61079559,262152,57737220,262152,60817415,262153,60882951,262153,
+60948487,262153,61014023,262153,61079559,262153,57737220,262153,60817415,262154,60882951,262154,60948487,262154,61014023,262154,61079559,262154,57737220,262154,60817415,262155,60882951,262155,60948487,262155,61014023,262155,61079559,262155,57737220,262155,60817415,262156,60882951,262156,60948487,262156,61014023,262156,
+61079559,262156,57737220,262156,60817415,262157,60882951,262157,60948487,262157,61014023,262157,61079559,262157,57737220,262157,60817415,262158,60882951,262158,60948487,262158,61014023,262158,61079559,262158,57737220,262158,60817415,262159,60882951,262159,60948487,262159,61014023,262159,61079559,262159,57737220,262159,
+60817415,262160,60882951,262160,60948487,262160,61014023,262160,61079559,262160,57737220,262160,60817415,262161,60882951,262161,60948487,262161,61014023,262161,61079559,262161,57737220,262161,60817415,262162,60882951,262162,60948487,262162,61014023,262162,61079559,262162,57737220,262162,60817415,262163,60882951,262163,
+60948487,262163,61014023,262163,61079559,262163,57737220,262163,60817415,262164,60882951,262164,60948487,262164,61014023,262164,61079559,262164,57737220,262164,60817415,262165,60882951,262165,60948487,262165,61014023,262165,61079559,262165,57737220,262165,60817415,262166,60882951,262166,60948487,262166,61014023,262166,
+61079559,262166,57737220,262166,60817415,262167,60882951,262167,60948487,262167,61014023,262167,61079559,262167,57737220,262167,60817415,262168,60882951,262168,60948487,262168,61014023,262168,61079559,262168,57737220,262168,60817415,262169,60882951,262169,60948487,262169,61014023,262169,61079559,262169,57737220,262169,
+60817415,262170,60882951,262170,60948487,262170,61014023,262170,61079559,262170,57737220,262170,60817415,262171,60882951,262171,60948487,262171,61014023,262171,61079559,262171,57737220,262171,60817415,262172,60882951,262172,60948487,262172,61014023,262172,61079559,262172,57737220,262172,60817415,262173,60882951,262173,
+60948487,262173,61014023,262173,61079559,262173,57737220,262173,60817415,262174,60882951,262174,60948487,262174,61014023,262174,61079559,262174,57737220,262174,60817415,262175,60882951,262175,60948487,262175,61014023,262175,61079559,262175,57737220,262175,258080775,2147614720,459390,179700352,172359687,131072,172294151,131072,
+2097156,131072,277151751,131072,262602759,131072,186515460,131072,131072,131072,134873092,2147483648,131072,0,223,9568263,2147614720,459390,179634815,108265479,131072,9633799,131072,2097156,131072,273350656,131072,273416192,131072,273481728,131072,185532416,131072,1966084,131072,124649479,131072,276955143,131072,277020679,
+131072,29622323,131072,61145090,2147680256,459390,179700352,277086342,57737218,196608,61210624,196608,61276160,196608,21823488,196608,61341696,196608,60817415,2147745792,459390,179700352,277086342,61407404,60882951,262144,60948487,262144,61014023,262144,61079559,262144,57737220,262144,60817415,262145,60882951,262145,60948487,262145,
+61014023,262145,61079559,262145,57737220,262145,60817415,262146,60882951,262146,60948487,262146,61014023,262146,61079559,262146,57737220,262146,60817415,262147,60882951,262147,60948487,262147,61014023,262147,61079559,262147,57737220,262147,60817415,262148,60882951,262148,60948487,262148,61014023,262148,61079559,262148,
+57737220,262148,60817415,262149,60882951,262149,60948487,262149,61014023,262149,61079559,262149,57737220,262149,60817415,262150,60882951,262150,60948487,262150,61014023,262150,61079559,262150,57737220,262150,60817415,262151,60882951,262151,60948487,262151,61014023,262151,61079559,262151,57737220,262151,60817415,262152,
+60882951,262152,60948487,262152,61014023,262152,61079559,262152,57737220,262152,60817415,262153,60882951,262153,60948487,262153,61014023,262153,61079559,262153,57737220,262153,60817415,262154,60882951,262154,60948487,262154,61014023,262154,61079559,262154,57737220,262154,60817415,262155,60882951,262155,60948487,262155,
+61014023,262155,61079559,262155,57737220,262155,60817415,262156,60882951,262156,60948487,262156,61014023,262156,61079559,262156,57737220,262156,60817415,262157,60882951,262157,60948487,262157,61014023,262157,61079559,262157,57737220,262157,60817415,262158,60882951,262158,60948487,262158,61014023,262158,61079559,262158,
+57737220,262158,60817415,262159,60882951,262159,60948487,262159,61014023,262159,61079559,262159,57737220,262159,60817415,262160,60882951,262160,60948487,262160,61014023,262160,61079559,262160,57737220,262160,60817415,262161,60882951,262161,60948487,262161,61014023,262161,61079559,262161,57737220,262161,60817415,262162,
+60882951,262162,60948487,262162,61014023,262162,61079559,262162,57737220,262162,60817415,262163,60882951,262163,60948487,262163,61014023,262163,61079559,262163,57737220,262163,60817415,262164,60882951,262164,60948487,262164,61014023,262164,61079559,262164,57737220,262164,60817415,262165,60882951,262165,60948487,262165,
+61014023,262165,61079559,262165,57737220,262165,60817415,262166,60882951,262166,60948487,262166,61014023,262166,61079559,262166,57737220,262166,60817415,262167,60882951,262167,60948487,262167,61014023,262167,61079559,262167,57737220,262167,60817415,262168,60882951,262168,60948487,262168,61014023,262168,61079559,262168,
+57737220,262168,60817415,262169,60882951,262169,60948487,262169,61014023,262169,61079559,262169,57737220,262169,60817415,262170,60882951,262170,60948487,262170,61014023,262170,61079559,262170,57737220,262170,60817415,262171,60882951,262171,60948487,262171,61014023,262171,61079559,262171,57737220,262171,60817415,262172,
+60882951,262172,60948487,262172,61014023,262172,61079559,262172,57737220,262172,60817415,262173,60882951,262173,60948487,262173,61014023,262173,61079559,262173,57737220,262173,60817415,262174,60882951,262174,60948487,262174,61014023,262174,61079559,262174,57737220,262174,60817415,262175,60882951,262175,60948487,262175,
+61014023,262175,61079559,262175,57737220,262175,258080775,2147614720,459390,179700352,172359687,131072,172294151,131072,2097156,131072,277151751,131072,262602759,131072,186515460,131072,131072,131072,171638788,2147483648,1966081,0,181141505,0,3276800,0,225,9568263,2147614720,459390,179634815,108265479,131072,9633799,
+131072,2097156,131072,273350656,131072,273416192,131072,273481728,131072,185532416,131072,1966084,131072,124649479,131072,276955143,131072,277020679,131072,29622323,131072,61145090,2147680256,459390,179700352,277086342,57737218,196608,61210624,196608,61276160,196608,21823488,196608,61341696,196608,60817415,2147745792,459390,179700352,
+277086342,61407404,60882951,262144,60948487,262144,61014023,262144,61079559,262144,57737220,262144,60817415,262145,60882951,262145,60948487,262145,61014023,262145,61079559,262145,57737220,262145,60817415,262146,60882951,262146,60948487,262146,61014023,262146,61079559,262146,57737220,262146,60817415,262147,60882951,262147,
+60948487,262147,61014023,262147,61079559,262147,57737220,262147,60817415,262148,60882951,262148,60948487,262148,61014023,262148,61079559,262148,57737220,262148,60817415,262149,60882951,262149,60948487,262149,61014023,262149,61079559,262149,57737220,262149,60817415,262150,60882951,262150,60948487,262150,61014023,262150,
+61079559,262150,57737220,262150,60817415,262151,60882951,262151,60948487,262151,61014023,262151,61079559,262151,57737220,262151,60817415,262152,60882951,262152,60948487,262152,61014023,262152,61079559,262152,57737220,262152,60817415,262153,60882951,262153,60948487,262153,61014023,262153,61079559,262153,57737220,262153,
+60817415,262154,60882951,262154,60948487,262154,61014023,262154,61079559,262154,57737220,262154,60817415,262155,60882951,262155,60948487,262155,61014023,262155,61079559,262155,57737220,262155,60817415,262156,60882951,262156,60948487,262156,61014023,262156,61079559,262156,57737220,262156,60817415,262157,60882951,262157,
+60948487,262157,61014023,262157,61079559,262157,57737220,262157,60817415,262158,60882951,262158,60948487,262158,61014023,262158,61079559,262158,57737220,262158,60817415,262159,60882951,262159,60948487,262159,61014023,262159,61079559,262159,57737220,262159,60817415,262160,60882951,262160,60948487,262160,61014023,262160,
+61079559,262160,57737220,262160,60817415,262161,60882951,262161,60948487,262161,61014023,262161,61079559,262161,57737220,262161,60817415,262162,60882951,262162,60948487,262162,61014023,262162,61079559,262162,57737220,262162,60817415,262163,60882951,262163,60948487,262163,61014023,262163,61079559,262163,57737220,262163,
+60817415,262164,60882951,262164,60948487,262164,61014023,262164,61079559,262164,57737220,262164,60817415,262165,60882951,262165,60948487,262165,61014023,262165,61079559,262165,57737220,262165,60817415,262166,60882951,262166,60948487,262166,61014023,262166,61079559,262166,57737220,262166,60817415,262167,60882951,262167,
+60948487,262167,61014023,262167,61079559,262167,57737220,262167,60817415,262168,60882951,262168,60948487,262168,61014023,262168,61079559,262168,57737220,262168,60817415,262169,60882951,262169,60948487,262169,61014023,262169,61079559,262169,57737220,262169,60817415,262170,60882951,262170,60948487,262170,61014023,262170,
+61079559,262170,57737220,262170,60817415,262171,60882951,262171,60948487,262171,61014023,262171,61079559,262171,57737220,262171,60817415,262172,60882951,262172,60948487,262172,61014023,262172,61079559,262172,57737220,262172,60817415,262173,60882951,262173,60948487,262173,61014023,262173,61079559,262173,57737220,262173,
+60817415,262174,60882951,262174,60948487,262174,61014023,262174,61079559,262174,57737220,262174,60817415,262175,60882951,262175,60948487,262175,61014023,262175,61079559,262175,57737220,262175,258080775,2147614720,459390,179700352,172359687,131072,172294151,131072,2097156,131072,277151751,131072,262602759,131072,186515460,131072,
+131072,131072,171638788,2147483648,181207044,0,30015492,0,181141508,0,181272580,0,131072,0,221,9568263,2147614720,459390,179634815,108265479,131072,9633799,131072,2097156,131072,273350656,131072,273416192,131072,273481728,131072,185532416,131072,1966084,131072,124649479,131072,276955143,131072,277020679,
+131072,29622323,131072,61145090,2147680256,459390,179700352,277086342,57737218,196608,61210624,196608,61276160,196608,21823488,196608,61341696,196608,60817415,2147745792,459390,179700352,277086342,61407404,60882951,262144,60948487,262144,61014023,262144,61079559,262144,57737220,262144,60817415,262145,60882951,262145,60948487,262145,
+61014023,262145,61079559,262145,57737220,262145,60817415,262146,60882951,262146,60948487,262146,61014023,262146,61079559,262146,57737220,262146,60817415,262147,60882951,262147,60948487,262147,61014023,262147,61079559,262147,57737220,262147,60817415,262148,60882951,262148,60948487,262148,61014023,262148,61079559,262148,
+57737220,262148,60817415,262149,60882951,262149,60948487,262149,61014023,262149,61079559,262149,57737220,262149,60817415,262150,60882951,262150,60948487,262150,61014023,262150,61079559,262150,57737220,262150,60817415,262151,60882951,262151,60948487,262151,61014023,262151,61079559,262151,57737220,262151,60817415,262152,
+60882951,262152,60948487,262152,61014023,262152,61079559,262152,57737220,262152,60817415,262153,60882951,262153,60948487,262153,61014023,262153,61079559,262153,57737220,262153,60817415,262154,60882951,262154,60948487,262154,61014023,262154,61079559,262154,57737220,262154,60817415,262155,60882951,262155,60948487,262155,
+61014023,262155,61079559,262155,57737220,262155,60817415,262156,60882951,262156,60948487,262156,61014023,262156,61079559,262156,57737220,262156,60817415,262157,60882951,262157,60948487,262157,61014023,262157,61079559,262157,57737220,262157,60817415,262158,60882951,262158,60948487,262158,61014023,262158,61079559,262158,
+57737220,262158,60817415,262159,60882951,262159,60948487,262159,61014023,262159,61079559,262159,57737220,262159,60817415,262160,60882951,262160,60948487,262160,61014023,262160,61079559,262160,57737220,262160,60817415,262161,60882951,262161,60948487,262161,61014023,262161,61079559,262161,57737220,262161,60817415,262162,
+60882951,262162,60948487,262162,61014023,262162,61079559,262162,57737220,262162,60817415,262163,60882951,262163,60948487,262163,61014023,262163,61079559,262163,57737220,262163,60817415,262164,60882951,262164,60948487,262164,61014023,262164,61079559,262164,57737220,262164,60817415,262165,60882951,262165,60948487,262165,
+61014023,262165,61079559,262165,57737220,262165,60817415,262166,60882951,262166,60948487,262166,61014023,262166,61079559,262166,57737220,262166,60817415,262167,60882951,262167,60948487,262167,61014023,262167,61079559,262167,57737220,262167,60817415,262168,60882951,262168,60948487,262168,61014023,262168,61079559,262168,
+57737220,262168,60817415,262169,60882951,262169,60948487,262169,61014023,262169,61079559,262169,57737220,262169,60817415,262170,60882951,262170,60948487,262170,61014023,262170,61079559,262170,57737220,262170,60817415,262171,60882951,262171,60948487,262171,61014023,262171,61079559,262171,57737220,262171,60817415,262172,
+60882951,262172,60948487,262172,61014023,262172,61079559,262172,57737220,262172,60817415,262173,60882951,262173,60948487,262173,61014023,262173,61079559,262173,57737220,262173,60817415,262174,60882951,262174,60948487,262174,61014023,262174,61079559,262174,57737220,262174,60817415,262175,60882951,262175,60948487,262175,
+61014023,262175,61079559,262175,57737220,262175,258080775,2147614720,459390,179700352,172359687,131072,172294151,131072,2097156,131072,277151751,131072,262602759,131072,186515460,131072,131072,131072,181338116,2147483648,171638788,0,223,9568263,2147614720,459390,179634815,108265479,131072,9633799,131072,2097156,131072,273350656,
+131072,273416192,131072,273481728,131072,185532416,131072,1966084,131072,124649479,131072,276955143,131072,277020679,131072,29622323,131072,61145090,2147680256,459390,179700352,277086342,57737218,196608,61210624,196608,61276160,196608,21823488,196608,61341696,196608,60817415,2147745792,459390,179700352,277086342,61407404,60882951,262144,
+60948487,262144,61014023,262144,61079559,262144,57737220,262144,60817415,262145,60882951,262145,60948487,262145,61014023,262145,61079559,262145,57737220,262145,60817415,262146,60882951,262146,60948487,262146,61014023,262146,61079559,262146,57737220,262146,60817415,262147,60882951,262147,60948487,262147,61014023,262147,
+61079559,262147,57737220,262147,60817415,262148,60882951,262148,60948487,262148,61014023,262148,61079559,262148,57737220,262148,60817415,262149,60882951,262149,60948487,262149,61014023,262149,61079559,262149,57737220,262149,60817415,262150,60882951,262150,60948487,262150,61014023,262150,61079559,262150,57737220,262150,
+60817415,262151,60882951,262151,60948487,262151,61014023,262151,61079559,262151,57737220,262151,60817415,262152,60882951,262152,60948487,262152,61014023,262152,61079559,262152,57737220,262152,60817415,262153,60882951,262153,60948487,262153,61014023,262153,61079559,262153,57737220,262153,60817415,262154,60882951,262154,
+60948487,262154,61014023,262154,61079559,262154,57737220,262154,60817415,262155,60882951,262155,60948487,262155,61014023,262155,61079559,262155,57737220,262155,60817415,262156,60882951,262156,60948487,262156,61014023,262156,61079559,262156,57737220,262156,60817415,262157,60882951,262157,60948487,262157,61014023,262157,
+61079559,262157,57737220,262157,60817415,262158,60882951,262158,60948487,262158,61014023,262158,61079559,262158,57737220,262158,60817415,262159,60882951,262159,60948487,262159,61014023,262159,61079559,262159,57737220,262159,60817415,262160,60882951,262160,60948487,262160,61014023,262160,61079559,262160,57737220,262160,
+60817415,262161,60882951,262161,60948487,262161,61014023,262161,61079559,262161,57737220,262161,60817415,262162,60882951,262162,60948487,262162,61014023,262162,61079559,262162,57737220,262162,60817415,262163,60882951,262163,60948487,262163,61014023,262163,61079559,262163,57737220,262163,60817415,262164,60882951,262164,
+60948487,262164,61014023,262164,61079559,262164,57737220,262164,60817415,262165,60882951,262165,60948487,262165,61014023,262165,61079559,262165,57737220,262165,60817415,262166,60882951,262166,60948487,262166,61014023,262166,61079559,262166,57737220,262166,60817415,262167,60882951,262167,60948487,262167,61014023,262167,
+61079559,262167,57737220,262167,60817415,262168,60882951,262168,60948487,262168,61014023,262168,61079559,262168,57737220,262168,60817415,262169,60882951,262169,60948487,262169,61014023,262169,61079559,262169,57737220,262169,60817415,262170,60882951,262170,60948487,262170,61014023,262170,61079559,262170,57737220,262170,
+60817415,262171,60882951,262171,60948487,262171,61014023,262171,61079559,262171,57737220,262171,60817415,262172,60882951,262172,60948487,262172,61014023,262172,61079559,262172,57737220,262172,60817415,262173,60882951,262173,60948487,262173,61014023,262173,61079559,262173,57737220,262173,60817415,262174,60882951,262174,
+60948487,262174,61014023,262174,61079559,262174,57737220,262174,60817415,262175,60882951,262175,60948487,262175,61014023,262175,61079559,262175,57737220,262175,258080775,2147614720,459390,179700352,172359687,131072,172294151,131072,2097156,131072,277151751,131072,262602759,131072,186515460,131072,131072,131072,80216068,2147483648,
+181403652,0,181469188,0,181534724,0,221,9568263,2147614720,459390,179634815,108265479,131072,9633799,131072,2097156,131072,273350656,131072,273416192,131072,273481728,131072,185532416,131072,1966084,131072,124649479,131072,276955143,131072,277020679,131072,29622323,131072,61145090,2147680256,459390,179700352,277086342,
+57737218,196608,61210624,196608,61276160,196608,21823488,196608,61341696,196608,60817415,2147745792,459390,179700352,277086342,61407404,60882951,262144,60948487,262144,61014023,262144,61079559,262144,57737220,262144,60817415,262145,60882951,262145,60948487,262145,61014023,262145,61079559,262145,57737220,262145,60817415,262146,
+60882951,262146,60948487,262146,61014023,262146,61079559,262146,57737220,262146,60817415,262147,60882951,262147,60948487,262147,61014023,262147,61079559,262147,57737220,262147,60817415,262148,60882951,262148,60948487,262148,61014023,262148,61079559,262148,57737220,262148,60817415,262149,60882951,262149,60948487,262149,
+61014023,262149,61079559,262149,57737220,262149,60817415,262150,60882951,262150,60948487,262150,61014023,262150,61079559,262150,57737220,262150,60817415,262151,60882951,262151,60948487,262151,61014023,262151,61079559,262151,57737220,262151,60817415,262152,60882951,262152,60948487,262152,61014023,262152,61079559,262152,
+57737220,262152,60817415,262153,60882951,262153,60948487,262153,61014023,262153,61079559,262153,57737220,262153,60817415,262154,60882951,262154,60948487,262154,61014023,262154,61079559,262154,57737220,262154,60817415,262155,60882951,262155,60948487,262155,61014023,262155,61079559,262155,57737220,262155,60817415,262156,
+60882951,262156,60948487,262156,61014023,262156,61079559,262156,57737220,262156,60817415,262157,60882951,262157,60948487,262157,61014023,262157,61079559,262157,57737220,262157,60817415,262158,60882951,262158,60948487,262158,61014023,262158,61079559,262158,57737220,262158,60817415,262159,60882951,262159,60948487,262159,
+61014023,262159,61079559,262159,57737220,262159,60817415,262160,60882951,262160,60948487,262160,61014023,262160,61079559,262160,57737220,262160,60817415,262161,60882951,262161,60948487,262161,61014023,262161,61079559,262161,57737220,262161,60817415,262162,60882951,262162,60948487,262162,61014023,262162,61079559,262162,
+57737220,262162,60817415,262163,60882951,262163,60948487,262163,61014023,262163,61079559,262163,57737220,262163,60817415,262164,60882951,262164,60948487,262164,61014023,262164,61079559,262164,57737220,262164,60817415,262165,60882951,262165,60948487,262165,61014023,262165,61079559,262165,57737220,262165,60817415,262166,
+60882951,262166,60948487,262166,61014023,262166,61079559,262166,57737220,262166,60817415,262167,60882951,262167,60948487,262167,61014023,262167,61079559,262167,57737220,262167,60817415,262168,60882951,262168,60948487,262168,61014023,262168,61079559,262168,57737220,262168,60817415,262169,60882951,262169,60948487,262169,
+61014023,262169,61079559,262169,57737220,262169,60817415,262170,60882951,262170,60948487,262170,61014023,262170,61079559,262170,57737220,262170,60817415,262171,60882951,262171,60948487,262171,61014023,262171,61079559,262171,57737220,262171,60817415,262172,60882951,262172,60948487,262172,61014023,262172,61079559,262172,
+57737220,262172,60817415,262173,60882951,262173,60948487,262173,61014023,262173,61079559,262173,57737220,262173,60817415,262174,60882951,262174,60948487,262174,61014023,262174,61079559,262174,57737220,262174,60817415,262175,60882951,262175,60948487,262175,61014023,262175,61079559,262175,57737220,262175,258080775,2147614720,
+459390,179700352,172359687,131072,172294151,131072,2097156,131072,277151751,131072,262602759,131072,186515460,131072,131072,131072,19791876,2147483648,131072,0,3,181600256,0,1966084,0,131072,0,4,1966084,0,181665796,0,181731332,0,131072,0,2,181796864,0,1179648,
+0,3,181862402,0,181927938,0,131072,0,1,2162688,0,2,181993472,0,182059015,0,12,182124551,0,182190087,0,182255623,0,182321156,0,182386695,0,182452231,0,182517767,0,182583300,0,182648836,0,182714372,0,182779908,0,182845444,
+0,2,181993472,0,182910976,0,3,180813826,0,182976512,0,183042048,0,5,183107584,0,117178368,0,182976514,0,183042050,0,180813826,0,3,180813826,0,182976512,0,183042048,0,3,180813826,0,182976512,0,183042048,0,3,180813826,
+0,182976512,0,183042048,0,3,180813826,0,182976512,0,183042048,0,3,180813826,0,182976512,0,183042048,0,6,181993472,0,183173120,0,2097152,0,183238656,0,3276800,0,183304199,0,5,16121860,0,2097156,0,44892160,0,183369728,
+0,183435264,0,3,183500804,0,109510660,0,183566336,0,5,62193668,0,183566336,0,183631872,0,458752,0,1441792,0,2,181141505,0,29097984,0,1,183566336,0,1,163315712,0,2,16121860,0,44892160,0,1,2162688,0,
+2,183697415,0,183762951,0,5,1835686,0,1901222,0,183828487,0,2162688,0,131072,0,3,1835686,0,1901222,0,2162688,0,4,131923979,2147549184,45023254,131989515,65536,183894023,2147483648,183959559,0,23,114622706,2147549184,46334099,114688004,65536,100663300,
+65536,19595268,65536,18022404,65536,114753536,65536,114819072,65536,114884610,65536,114950148,65536,115015682,65536,115081218,65536,26017794,65536,2097154,65536,131923979,2147549184,184025110,131989515,65536,163315712,2147483648,184090624,0,184156164,0,131072,0,131923979,2147614720,12190376,45023254,131989515,131072,
+183894023,2147549184,12190376,183959559,65536,4,184221696,0,184287232,0,143130624,0,61341696,0,4,29163521,0,184352769,0,55574529,0,20447232,0,1,29163521,0,2,29163521,0,29229057,0,1,184418305,0,1,184483844,0,1,184549383,0,
+1,184614919,0,1,98172935,0,1,184680448,0,1,16121857,0,1,184745985,0,1,162791425,0,1,184745985,0,1,184811521,0,1,162791425,0,1,162791425,0,2,143065089,0,143196161,0,1,184877057,0,1,184877057,
+0,1,184877057,0,1,16121857,0,2,16121857,0,184942593,0,1,185008129,0,4,262144,0,0,0,167772164,0,131072,0,5,185074370,0,167706628,0,167903236,0,185139204,0,131072,0,7,185074370,2147549184,185205443,167706628,
+65536,167903236,65536,185139204,65536,131072,65536,29163521,2147483648,29097984,0,1,185270273,0,1,16121857,0,2,185335809,0,16121857,0,2,185335809,0,16121857,0,1,16121857,0,1,16121857,0,1,16121857,0,1,16121857,0,1,
+16121857,0,2,16121857,0,185401345,0,1,16121857,0,1,16121857,0,1,16121857,0,4,16121857,0,185466892,0,29163532,0,61341696,0,4,29163532,0,29229068,0,16121857,0,61341696,0,4,29163532,0,29229068,0,55574540,
+0,61341696,0,2,185532417,0,29163532,0,2,16121857,0,72089601,0,1,16121857,0,4,29163532,0,1179648,0,167772164,0,262144,0,7,29163532,0,29229068,0,3276800,0,185139204,0,185598680,0,185663492,0,167903236,0,
+2,29163532,0,29229068,0,1,29163532,0,4,71696385,0,185729025,0,71827457,0,185794561,0,2,29229068,0,16121868,0,1,29229068,0,1,16121868,0,1,29229068,0,2,180813836,0,180879372,0,5,262144,0,174981122,
+0,2097153,0,61341696,0,167772164,0,7,175375074,0,167706628,0,167903236,0,185139204,0,29163532,0,29229068,0,3276800,0,1,185860097,0,4,262144,0,174981122,0,167313410,0,167772164,0,1,185925636,0,5,175375077,0,
+167706628,0,167903236,0,185139204,0,44367876,0,4,262144,0,174981122,0,3276800,0,167772164,0,1,185925636,0,5,175375080,0,167706628,0,167903236,0,185139204,0,185991172,0,1,185925636,0,4,262144,0,174981122,0,3276800,
+0,167772164,0,4,262144,0,174981122,0,3276800,0,167772164,0,5,262144,0,174981122,0,29229057,0,61341696,0,167772164,0,5,175375084,0,167706628,0,167903236,0,185139204,0,131072,0,5,175375085,0,167706628,0,167903236,
+0,185139204,0,131072,0,5,175375086,0,167706628,0,167903236,0,185139204,0,131072,0,18,175375084,2147549184,186057455,167706628,65536,167903236,65536,185139204,65536,131072,65536,175375085,2147549184,186122992,167706628,65536,167903236,65536,185139204,65536,131072,65536,175375086,
+2147549184,186188529,167706628,65536,167903236,65536,185139204,65536,131072,65536,185991172,2147483648,29229057,0,1179648,0,1,185925636,0,5,262144,0,174981122,0,167575564,0,61341696,0,167772164,0,5,262144,0,174981122,0,167575564,0,61341696,0,167772164,
+0,5,175375092,0,167706628,0,167903236,0,185139204,0,131072,0,5,175375093,0,167706628,0,167903236,0,185139204,0,131072,0,12,175375092,2147549184,186057462,167706628,65536,167903236,65536,185139204,65536,131072,65536,175375093,2147549184,186254071,167706628,65536,
+167903236,65536,185139204,65536,131072,65536,2097153,2147483648,29097984,0,5,262144,0,174981122,0,167575564,0,61341696,0,167772164,0,5,262144,0,174981122,0,167575564,0,61341696,0,167772164,0,5,175375097,0,167706628,0,167903236,0,185139204,
+0,131072,0,5,175375098,0,167706628,0,167903236,0,185139204,0,131072,0,12,175375097,2147549184,186057467,167706628,65536,167903236,65536,185139204,65536,131072,65536,175375098,2147549184,186254076,167706628,65536,167903236,65536,185139204,65536,131072,65536,2097153,2147483648,29097984,
+0,1,167772164,0,5,175375102,0,167706628,0,29163524,0,185139204,0,131072,0,4,29163532,0,1179648,0,167772164,0,262144,0,6,29163532,0,1179648,0,185139204,0,175375104,0,167706628,0,167903236,0,4,174981132,0,
+1179648,0,167772164,0,262144,0,5,131072,0,185139204,0,175375106,0,167706628,0,167903236,0,1,16121857,0,4,2555916,0,29163532,0,16121868,0,61341696,0,1,16121868,0,6,29163532,0,186318860,0,186384396,0,186449932,
+0,186515468,0,1179648,0,2,186580996,0,186646532,0,1,186580996,0,1,2097156,0,6,262144,0,174981122,0,167313410,0,167772164,0,2097156,0,131072,0,5,175375115,0,167706628,0,185139204,0,167903236,0,131072,0,
+5,262144,0,167772164,0,174981122,0,167575564,0,61341696,0,6,175375117,0,167706628,0,185139204,0,167903236,0,2097153,0,1179648,0,5,262144,0,167772164,0,174981122,0,167575564,0,61341696,0,6,175375119,0,167706628,0,
+185139204,0,167903236,0,2097153,0,1179648,0,4,262144,0,167772164,0,174981122,0,3276800,0,5,175375121,0,167706628,0,185139204,0,167903236,0,131072,0,3,174981122,0,167575564,0,44367872,0,3,174981122,0,167575564,0,
+44367872,0,3,174981122,0,167575564,0,44367872,0,1,186712071,0,51,84214235,0,186777604,0,14876672,0,1966082,0,186843138,0,186908674,0,186974210,0,187039751,0,187105282,0,187170818,0,187236359,0,187301890,0,187367426,0,187432967,
+0,187498503,0,187564039,0,187629572,0,187695108,0,187760644,0,6356992,0,187826183,0,187891716,0,187957255,0,188022791,0,188088327,0,188153856,0,188219399,0,188284935,0,188350466,0,188416000,0,188481536,0,188547079,0,188612612,0,188678151,
+0,188743687,0,188809220,0,2097156,0,188874759,0,188940295,0,189005831,0,189072150,0,18939908,0,189136903,0,189202439,0,189267975,0,189333511,0,189399047,0,189464583,0,189530119,0,189595652,0,189661191,0,50,2097156,0,189726722,0,
+189792258,0,30998530,0,189857794,0,189923330,0,189988866,0,190054402,0,190119938,0,190185479,0,190251015,0,190316551,0,190382087,0,2228224,0,190447623,0,190513159,0,190578695,0,190644231,0,190709767,0,190775303,0,190840839,0,190906375,0,
+190971911,0,191037447,0,191102983,0,191168519,0,191234055,0,191299591,0,191365127,0,191430663,0,191496199,0,191561735,0,191627271,0,191692807,0,191758343,0,191823879,0,191889415,0,191954951,0,125567207,0,192020487,0,81133572,0,192086023,0,
+192151559,0,192217095,0,14876672,0,192282631,0,6356992,0,192348211,0,192413703,0,131072,0,5,55377986,0,192479239,0,192544775,0,2097154,0,3276800,0,1,69009415,0,3,77070566,0,131923979,2147549184,77135894,131989515,65536,55,57081860,
+0,192610308,0,192676635,0,192742172,0,44367872,0,192806912,0,192872450,0,192937991,0,193003520,0,193069063,0,193134599,0,193200135,0,193265671,0,51773447,0,51838983,0,50397191,0,51445767,0,51707911,0,80740354,0,193331200,0,193396738,
+0,193462279,0,193527815,0,193593344,0,16384000,0,63832064,0,193658880,0,193725208,0,193789956,0,81068036,0,193855495,0,193921031,0,193986567,0,194052103,0,194117634,0,194183170,0,194248706,0,194314242,0,194379778,0,194445314,0,194510850,
+0,194576386,0,194642717,0,194707463,0,194772999,0,194839321,0,77070566,0,131923979,2147549184,77135894,131989515,65536,194904130,2147483648,53608605,0,194969607,0,195035143,0,195100679,0,195166212,0,5,1835806,0,1901342,0,2162688,0,2097152,0,15532032,
+0,5,1835807,0,1901343,0,2162688,0,2097152,0,15532032,0,1,195231751,0,5,195297282,0,27787266,0,111083527,0,135135232,0,29097984,0,5,195362826,0,195428362,0,195493889,0,195559425,0,1441793,0,7,195625026,0,
+195690562,0,195362826,2147549184,12190497,195428362,65536,195493889,65536,195559425,65536,1441793,65536,148,1835019,2147549184,4980762,1900555,65536,3801114,65536,3866655,65536,3932192,65536,3997696,65536,2097154,65536,2621444,65536,4063236,65536,4128772,65536,4194308,65536,4259844,65536,4325380,
+65536,4390916,65536,3735552,2147614720,4980762,4456478,4522008,2147549184,4980762,4587544,65536,4653067,65536,4718620,65536,4784154,65536,4849675,65536,4915233,65536,3604514,65536,24576098,2147483648,1966082,0,101122050,0,195756036,0,195821572,0,195887108,0,101056512,0,8781875,0,
+166264883,0,195952691,0,196018227,0,196083763,0,196149309,0,196214838,0,17891354,0,165282063,0,4194306,2147549184,12976171,6684674,65536,6750210,65536,6815746,65536,6881282,65536,6946818,65536,131072,65536,7012356,65536,7077892,65536,7143428,65536,7208964,65536,9044008,
+2147483648,131923979,2147549184,77594646,131989515,65536,131923979,2147549184,196280342,131989515,65536,131923979,2147549184,196345878,131989515,65536,131923979,2147549184,21364758,131989515,65536,131923979,2147549184,196411414,131989515,65536,131923979,2147549184,196476950,131989515,65536,16121860,2147483648,196542468,0,70647938,0,196608000,0,71172100,
+0,196673540,0,9568263,0,196739079,0,9633799,0,196804615,0,196870151,0,108265479,0,196935687,0,9764871,0,197001223,0,9830407,0,197066759,0,9895943,0,197132295,0,108003335,0,10289159,0,119013380,0,2097154,0,197197826,0,197263362,
+0,8323074,0,63963138,0,64225282,0,197328898,0,121241600,0,197394432,0,197459970,0,197525506,0,197591042,0,197656578,0,9961474,0,197722112,0,197787648,0,47513602,0,50659328,0,197853184,0,197918727,0,197984263,0,23068674,0,198049794,
+0,6356992,0,139722759,0,198115330,0,133496834,0,198180866,0,198246400,0,198311936,0,131923979,2147549184,8192022,131989515,65536,131923979,2147549184,198377494,131989515,65536,131923979,2147549184,198443030,131989515,65536,198509335,2147483648,198574874,0,198639682,0,198705628,0,131923979,2147549184,
+198770710,131989515,65536,198837027,2147483648,198902564,0,198967303,0,199032979,0,199098368,0,199163904,0,199229440,0,199294977,0,199360519,0,199426055,0,199491591,0,15073317,0,195297282,2147549184,136971040,27787266,65536,111083527,65536,135135232,65536,29097984,65536,199557459,2147483648,
+199623458,0,199688548,0,3605285,0,14,1835814,0,1901350,0,8781875,0,108003335,0,124649479,0,108068871,0,30998535,0,2162688,0,147062788,0,147128324,0,199753732,0,1966082,0,75825154,0,108134407,0,5,1966082,0,172097538,0,
+2097154,0,199819266,0,20185114,0,3,117243908,0,199884804,0,17892135,0,4,19398660,0,199950340,0,17891339,0,28967026,0,6,5832711,0,18743303,0,25690119,0,137822210,0,3276800,0,200015879,0,5,5832711,0,186712071,0,
+200081415,0,200146951,0,18743303,0,8,200212531,0,30408711,2147549184,2293885,30474247,65536,30539778,65536,16121858,65536,50593799,2147483648,200278023,0,2228224,0,3,200343559,0,200409092,0,200474628,0,7,200540164,0,132775940,0,200605700,0,200671239,0,
+200736775,0,200802311,0,2228224,0,8,1835822,0,1901358,0,29622323,0,150994948,0,2097154,0,16121858,0,18743303,0,200867847,0,7,1835823,0,1901359,0,29622323,0,105971714,0,2097154,0,23068674,0,2686976,0,27,5832711,
+2147549184,200934186,186712071,65536,200081415,65536,200146951,65536,18743303,65536,5832711,2147549184,200999722,186712071,65536,200081415,65536,200146951,65536,18743303,65536,201065257,2147483648,82969386,0,201130795,0,81068036,0,18743303,0,80936967,0,201195527,0,200540164,0,201261060,0,200736775,
+0,200802311,0,19398663,0,201326599,0,131072,0,201392132,0,2097154,0,201457666,0,17,68354055,0,201523207,0,200343559,0,201588743,0,201654279,0,201719815,0,201785351,0,201850887,0,201916423,0,201981959,0,202047495,0,202113031,0,
+202178567,0,2097156,0,202244100,0,13303810,0,1441792,0,168,1835019,2147549184,4980762,1900555,65536,3801114,65536,3866655,65536,3932192,65536,3997696,65536,2097154,65536,2621444,65536,4063236,65536,4128772,65536,4194308,65536,4259844,65536,4325380,65536,4390916,65536,
+3735552,2147614720,4980762,4456478,4522008,2147549184,4980762,4587544,65536,4653067,65536,4718620,65536,4784154,65536,4849675,65536,4915233,65536,3604514,65536,24576098,2147483648,202309759,0,84280113,0,53608605,0,194904130,0,2097156,0,14876672,0,1966082,0,65142786,0,202375170,
+0,131072002,0,202440706,0,9961474,0,202506242,0,202571778,0,202637316,0,202702855,0,202768386,0,202833922,0,6356992,0,202899458,0,96206850,0,202964994,0,203030530,0,203096066,0,203161602,0,203227138,0,203292674,0,203358210,0,82640898,
+0,82378754,0,180813826,0,203423746,0,203489282,0,189988866,0,190054402,0,203554818,0,203620354,0,203685890,0,203751426,0,203816967,0,203882503,0,203948039,0,204013575,0,204079111,0,204144647,0,204210183,0,80871431,0,22478855,0,80936967,
+0,81461255,0,204275719,0,204341255,0,204406791,0,204472327,0,204537863,0,204603399,0,81002500,0,80805892,0,204668932,0,204734468,0,204800002,0,15794176,0,81199111,0,81264647,0,81330183,0,204865543,0,204931079,0,204996615,0,205062151,
+0,205127687,0,205193223,0,205258759,0,205324295,0,205389831,0,50724871,0,19398663,0,205455367,0,30474247,0,205520903,0,205586439,0,205651975,0,205717511,0,205783044,0,34930688,0,205848580,0,205914116,0,205979655,0,206045191,0,206110727,
+0,206176263,0,206241799,0,206307335,0,206372871,0,191823879,0,191692807,0,191758343,0,206438407,0,206503943,0,206569476,0,99811328,0,206635015,0,206700551,0,206766087,0,206831623,0,206897159,0,206962695,0,207028231,0,207093767,0,207159303,
+0,207224839,0,207290375,0,207355911,0,207421447,0,207486983,0,207552519,0,207618055,0,207683591,0,207749127,0,207814660,0,207880196,0,207945857,0,208011393,0,208076807,0,208142343,0,131596421,0,198639682,0,131923979,2147549184,208207894,131989515,65536,
+84541506,2147483648,208273459,0,208338995,0,198509335,0,208405271,0,208470018,0,208535552,0,208601090,0,89915392,0,208666631,0,208732160,0,189857799,0,208797703,0,208863239,0,208928775,0,208994433,0,59,1835242,0,1900778,0,209060658,0,209126192,
+0,8848173,0,209191731,0,209256459,0,209322804,0,209388340,0,131923979,2147549184,209453078,131989515,65536,131923979,2147549184,209518614,131989515,65536,209584586,2147483648,209649912,0,209715448,0,209780787,0,209846556,0,8781875,0,131923979,2147549184,63373334,131989515,65536,2162688,2147483648,
+82903047,0,29949959,0,209911815,0,209977351,0,81133572,0,210042884,0,2097156,0,81002500,0,210108420,0,210173956,0,210239492,0,210305028,0,4194308,0,210370562,0,210436098,0,210501634,0,16384000,0,210567168,0,6356992,0,210632706,0,
+210698242,0,210763778,0,210829312,0,77070566,0,131923979,2147549184,77135894,131989515,65536,210894870,2147483648,210961196,0,211025924,0,211091460,0,211157813,0,148636111,0,211223350,0,211288071,0,211353607,0,74122039,0,211419370,0,5,1835832,0,1901368,0,
+1966084,0,211484676,0,17891339,0,9,1835833,0,1901369,0,45350916,0,57081860,0,159776772,0,2097156,0,211550219,0,131923979,2147549184,211615766,131989515,65536,26,1835238,0,1900774,0,2097156,0,917508,0,211681284,0,211746820,0,211812356,
+0,211877892,0,211943428,0,212008964,0,131072,0,57081860,0,23068676,0,53870594,0,2686976,0,2162688,0,212074496,0,100859904,0,175702016,0,212140032,0,212205572,0,14876672,0,131923979,2147549184,212271126,131989515,65536,209191731,2147483648,209256459,0,
+44,1835019,2147549184,4980762,1900555,65536,3801114,65536,3866655,65536,3932192,65536,3997696,65536,2097154,65536,2621444,65536,4063236,65536,4128772,65536,4194308,65536,4259844,65536,4325380,65536,4390916,65536,3735552,2147614720,4980762,4456478,4522008,2147549184,4980762,4587544,65536,4653067,
+65536,4718620,65536,4784154,65536,4849675,65536,4915233,65536,3604514,65536,24576098,2147483648,2097156,0,57081860,0,29360244,2147549184,74776693,29425668,65536,131072,65536,3604598,65536,76153055,2147549184,137429212,76218372,65536,76283908,65536,76349444,65536,76414980,65536,76480737,65536,76546272,
+65536,75235332,2147483648,125239300,0,70647938,0,71172098,0,212336642,0,3605307,0,74122044,0,4,77070566,0,131923979,2147549184,77135894,131989515,65536,3605310,2147483648,15,53608605,0,55377986,0,212402227,0,212467778,0,131072,0,212533255,0,194839357,0,
+77070566,0,131923979,2147549184,77135894,131989515,65536,212598788,2147483648,212664322,0,212729858,0,2097156,0,51380231,0,18,1966082,0,189857794,0,2097156,0,212795396,0,212860930,0,3276800,0,50724871,0,54919175,0,212926471,0,212992007,0,213057543,0,
+213123079,0,213188615,0,213254151,0,213319687,0,213385223,0,14876672,0,194839360,0,37,213450803,0,213516339,0,1966082,0,212729858,0,2097156,0,213581831,0,213647360,0,1179648,0,213712903,0,213778439,0,213843975,0,213909511,0,213975047,
+0,214040583,0,214106119,0,214171655,0,214237191,0,214302727,0,214368263,0,214433799,0,214499335,0,214564871,0,214630407,0,214695943,0,214761479,0,214827015,0,214892551,0,214958087,0,215023623,0,215089159,0,215154695,0,215220231,0,215285767,
+0,215351303,0,215416839,0,215482375,0,215547915,0,20,1966084,0,215613444,0,215678980,0,215744516,0,215810052,0,215875588,0,215941124,0,216006663,0,216072196,0,216137732,0,27787268,0,216203268,0,216268804,0,216334340,0,216399876,0,
+216465412,0,216530948,0,216596484,0,216662020,0,216727556,0,9,216793092,0,216858631,0,216924167,0,216989703,0,217055236,0,2097154,0,3276800,0,30932999,0,6356992,0,24,1835843,0,1901379,0,2162688,0,120258690,0,120324437,0,
+119013380,0,217120772,0,217186308,0,119799812,0,119865348,0,217251844,0,120193028,0,119930887,0,8126488,0,131923979,2147614720,217317629,97320982,131989515,131072,16121860,2147549184,217317629,97386500,65536,27787268,65536,97452039,65536,97517575,65536,97583111,65536,131923979,2147614720,217317629,
+97648662,131989515,131072,6,1835844,0,1901380,0,2162688,0,217382912,0,217448452,0,6356992,0,5,2097154,0,217513984,0,217579520,0,217645056,0,1179648,0,39,217710592,0,217776128,0,19791872,0,217841664,0,2097152,0,143130624,0,
+217907200,0,217972736,0,218038272,0,218103808,0,218169344,0,218234880,0,218300416,0,1179648,0,218365954,0,218431490,0,218497031,0,2097154,2147549184,218562888,217513984,65536,217579520,65536,217645056,65536,1179648,65536,116850688,2147483648,218628096,0,16384000,0,2097156,
+2147549184,179437737,131072,65536,60227584,65536,60293120,65536,60358663,65536,60424199,65536,60489735,65536,60555271,65536,60620929,65536,5308427,65536,60686336,2147549184,179372202,60751872,65536,29097984,65536,2162688,2147549184,218693803,57,217710592,2147549184,174916201,217776128,65536,19791872,65536,217841664,65536,
+2097152,65536,143130624,65536,217907200,65536,217972736,65536,218038272,65536,218103808,65536,218169344,65536,218234880,65536,218300416,65536,1179648,65536,218365954,65536,218431490,65536,218497031,65536,2097154,2147614720,174916201,218562888,217513984,131072,217579520,131072,217645056,131072,1179648,131072,116850688,2147549184,
+174916201,218628096,65536,16384000,65536,2097156,2147614720,174916201,179437737,131072,131072,60227584,131072,60293120,131072,60358663,131072,60424199,131072,60489735,131072,60555271,131072,60620929,131072,5308427,131072,60686336,2147614720,174916201,179372202,60751872,131072,29097984,131072,2162688,2147614720,174916201,218693803,44892160,
+2147483648,1966084,0,71237634,0,31195138,0,212992002,0,2097154,0,218759175,0,218824711,0,218890244,0,218955776,0,219021312,0,219086848,0,219152384,0,219217920,0,219283456,0,219348992,0,29097984,0,219414579,0,279,217710592,2147549184,174916201,217776128,
+65536,19791872,65536,217841664,65536,2097152,65536,143130624,65536,217907200,65536,217972736,65536,218038272,65536,218103808,65536,218169344,65536,218234880,65536,218300416,65536,1179648,65536,218365954,65536,218431490,65536,218497031,65536,2097154,2147614720,174916201,218562888,217513984,131072,217579520,131072,217645056,
+131072,1179648,131072,116850688,2147549184,174916201,218628096,65536,16384000,65536,2097156,2147614720,174916201,179437737,131072,131072,60227584,131072,60293120,131072,60358663,131072,60424199,131072,60489735,131072,60555271,131072,60620929,131072,5308427,131072,60686336,2147614720,174916201,179372202,60751872,131072,29097984,131072,
+2162688,2147614720,174916201,218693803,1966084,2147549184,219480897,215613444,65536,215678980,65536,215744516,65536,215810052,65536,215875588,65536,215941124,65536,216006663,65536,216072196,65536,216137732,65536,27787268,65536,216203268,65536,216268804,65536,216334340,65536,216399876,65536,216465412,65536,216530948,65536,216596484,
+65536,216662020,65536,216727556,65536,29949956,2147483648,18022404,0,18087940,0,219545607,0,219611140,0,219676676,0,219742212,0,219807748,0,2097154,0,186777602,0,219873287,0,219938820,0,220004354,0,19398658,0,220069892,0,220135428,0,220200964,0,220266500,
+0,217841666,0,217776130,0,220332034,0,143130626,0,220397568,0,220463104,0,220528644,0,16121860,0,220594178,0,220659712,0,220725248,0,66650119,2147549184,220790866,58851335,65536,66715655,65536,58916871,65536,131923979,2147549184,45023254,131989515,65536,220856322,2147483648,22937600,
+0,220921863,0,220987399,0,221052935,0,221118471,0,221184007,0,221249543,0,221315076,0,221380615,0,161808386,0,221446146,0,221511682,0,221577218,0,221642752,0,221708292,0,221773826,0,114491392,0,221839360,0,221904903,0,221970439,0,222035968,
+0,222101504,0,89194496,0,222167042,0,222232578,0,222298114,0,222363655,0,222429191,0,222494727,0,222560260,0,222625799,0,222691328,0,34537472,0,222756866,0,217710592,2147614720,222823237,174916201,217776128,131072,19791872,131072,217841664,131072,2097152,131072,143130624,
+131072,217907200,131072,217972736,131072,218038272,131072,218103808,131072,218169344,131072,218234880,131072,218300416,131072,1179648,131072,218365954,131072,218431490,131072,218497031,131072,2097154,2147680256,222823237,174916201,218562888,217513984,196608,217579520,196608,217645056,196608,1179648,196608,116850688,2147614720,222823237,174916201,
+218628096,131072,16384000,131072,2097156,2147680256,222823237,174916201,179437737,131072,196608,60227584,196608,60293120,196608,60358663,196608,60424199,196608,60489735,196608,60555271,196608,60620929,196608,5308427,196608,60686336,2147680256,222823237,174916201,179372202,60751872,196608,29097984,196608,2162688,2147680256,222823237,174916201,
+218693803,44892160,2147549184,222823237,1966084,65536,71237634,65536,31195138,65536,212992002,65536,2097154,65536,218759175,65536,218824711,65536,218890244,65536,218955776,65536,219021312,65536,219086848,65536,219152384,65536,219217920,65536,219283456,65536,219348992,65536,29097984,65536,219414579,65536,222887940,2147483648,
+222953474,0,125239298,0,131923979,2147549184,117047318,131989515,65536,223019010,2147483648,116850690,0,223084546,0,223150082,0,223215623,0,223281156,0,2097156,2147549184,223346817,57737220,65536,57802756,65536,57868292,65536,66650119,2147614720,223346817,57933906,58851335,131072,66715655,131072,58916871,131072,
+66650119,2147614720,223346817,57999442,58851335,131072,66715655,131072,58916871,131072,57081858,2147614720,223346817,58065062,2097154,131072,31522823,131072,57147399,131072,57212935,131072,57278471,131072,57344007,131072,17825957,131072,57409701,131072,57475237,131072,57540615,131072,57606151,131072,57671682,131072,1441792,131072,
+57081858,131073,2097154,131073,31522823,131073,57147399,131073,57212935,131073,57278471,131073,57344007,131073,17825957,131073,57409701,131073,57475237,131073,57540615,131073,57606151,131073,57671682,131073,1441792,131073,57081858,131074,2097154,131074,31522823,131074,57147399,131074,57212935,131074,57278471,131074,
+57344007,131074,17825957,131074,57409701,131074,57475237,131074,57540615,131074,57606151,131074,57671682,131074,1441792,131074,57081858,131075,2097154,131075,31522823,131075,57147399,131075,57212935,131075,57278471,131075,57344007,131075,17825957,131075,57409701,131075,57475237,131075,57540615,131075,57606151,131075,
+57671682,131075,1441792,131075,58130439,2147549184,223346817,58195975,65536,58261511,65536,58327047,65536,58392578,65536,1441792,65536,223412228,2147483648,223477764,0,223543300,0,223608836,0,223674372,0,223739911,0,223805444,0,223870976,0,7,1835847,0,1901383,0,45350916,0,
+2162688,0,2097156,0,67633203,0,8126488,0,15,19398660,0,43384839,0,37879815,0,25690119,0,6160391,0,38469639,0,38535175,0,38600711,0,34865156,0,37748743,0,35520641,0,35586177,0,35651713,0,33619972,0,2097156,0,4,
+1835849,0,1901385,0,262144,0,223936623,0,3,224002159,0,131923979,2147549184,224067606,131989515,65536,31,157286532,0,223936623,0,224133252,0,224198767,0,224002159,2147549184,224265034,131923979,2147614720,224265034,224067606,131989515,131072,224329865,2147483648,224395393,0,27787268,0,
+224460804,0,224526340,0,224591876,0,224657412,0,224722951,0,19398660,2147549184,224789320,43384839,65536,37879815,65536,25690119,65536,6160391,65536,38469639,65536,38535175,65536,38600711,65536,34865156,65536,37748743,65536,35520641,65536,35586177,65536,35651713,65536,33619972,65536,2097156,
+65536,3605324,2147483648,47,157286532,2147549184,224854859,223936623,65536,224133252,65536,224198767,65536,224002159,2147614720,224854859,224265034,131923979,2147680256,224854859,224265034,224067606,131989515,196608,224329865,2147549184,224854859,224395393,65536,27787268,65536,224460804,65536,224526340,65536,224591876,65536,224657412,65536,224722951,
+65536,19398660,2147614720,224854859,224789320,43384839,131072,37879815,131072,25690119,131072,6160391,131072,38469639,131072,38535175,131072,38600711,131072,34865156,131072,37748743,131072,35520641,131072,35586177,131072,35651713,131072,33619972,131072,2097156,131072,3605324,2147549184,224854859,2097154,2147483648,224919554,0,
+224985090,0,225050626,0,225116162,0,16121860,0,225181842,0,225247378,0,76939410,0,225312775,0,225378311,0,133758980,0,131072,0,225443847,0,225509383,0,6356992,0,16,225574912,0,29097984,0,225640594,0,114622706,2147549184,225706131,114688004,65536,
+100663300,65536,19595268,65536,18022404,65536,114753536,65536,114819072,65536,114884610,65536,114950148,65536,115015682,65536,115081218,65536,26017794,65536,2097154,65536,6,19398658,0,917506,0,225771522,0,105971714,0,2097156,0,19464199,0,56,2097154,0,225837058,0,
+225902594,0,225968130,0,19398658,2147549184,226034511,917506,65536,225771522,65536,105971714,65536,2097156,65536,19464199,65536,19398658,65537,917506,65537,225771522,65537,105971714,65537,2097156,65537,19464199,65537,19398658,65538,917506,65538,225771522,65538,105971714,65538,2097156,65538,19464199,
+65538,19398658,65539,917506,65539,225771522,65539,105971714,65539,2097156,65539,19464199,65539,19398658,65540,917506,65540,225771522,65540,105971714,65540,2097156,65540,19464199,65540,19398658,65541,917506,65541,225771522,65541,105971714,65541,2097156,65541,19464199,65541,19398658,65542,917506,
+65542,225771522,65542,105971714,65542,2097156,65542,19464199,65542,226099211,2147483648,226164743,0,2228224,0,226230276,0,226295812,0,203030532,0,226361348,0,114622706,0,105709619,0,226426931,0,50,157286532,2147549184,224854859,223936623,65536,224133252,65536,224198767,65536,224002159,
+2147614720,224854859,224265034,131923979,2147680256,224854859,224265034,224067606,131989515,196608,224329865,2147549184,224854859,224395393,65536,27787268,65536,224460804,65536,224526340,65536,224591876,65536,224657412,65536,224722951,65536,19398660,2147614720,224854859,224789320,43384839,131072,37879815,131072,25690119,131072,6160391,131072,38469639,
+131072,38535175,131072,38600711,131072,34865156,131072,37748743,131072,35520641,131072,35586177,131072,35651713,131072,33619972,131072,2097156,131072,3605324,2147549184,224854859,27787268,2147483648,226492420,0,41091076,0,226557956,0,226623495,0,226689028,0,226754567,0,226820103,0,226885639,0,
+41156612,0,44171268,0,44236807,0,41222151,0,41287687,0,41353223,0,41418759,0,44302465,0,226951297,0,227016755,0,31,157286532,2147549184,224854859,223936623,65536,224133252,65536,224198767,65536,224002159,2147614720,224854859,224265034,131923979,2147680256,224854859,224265034,224067606,131989515,
+196608,224329865,2147549184,224854859,224395393,65536,27787268,65536,224460804,65536,224526340,65536,224591876,65536,224657412,65536,224722951,65536,19398660,2147614720,224854859,224789320,43384839,131072,37879815,131072,25690119,131072,6160391,131072,38469639,131072,38535175,131072,38600711,131072,34865156,131072,37748743,131072,
+35520641,131072,35586177,131072,35651713,131072,33619972,131072,2097156,131072,3605324,2147549184,224854859,5,227082369,0,19398660,0,19464199,0,40894476,0,29097984,0,33,157286532,2147549184,224854859,223936623,65536,224133252,65536,224198767,65536,224002159,2147614720,224854859,224265034,131923979,2147680256,
+224854859,224265034,224067606,131989515,196608,224329865,2147549184,224854859,224395393,65536,27787268,65536,224460804,65536,224526340,65536,224591876,65536,224657412,65536,224722951,65536,19398660,2147614720,224854859,224789320,43384839,131072,37879815,131072,25690119,131072,6160391,131072,38469639,131072,38535175,131072,38600711,131072,
+34865156,131072,37748743,131072,35520641,131072,35586177,131072,35651713,131072,33619972,131072,2097156,131072,3605324,2147549184,224854859,2097156,2147483648,16121860,0,33,157286532,2147549184,224854859,223936623,65536,224133252,65536,224198767,65536,224002159,2147614720,224854859,224265034,131923979,2147680256,224854859,224265034,224067606,
+131989515,196608,224329865,2147549184,224854859,224395393,65536,27787268,65536,224460804,65536,224526340,65536,224591876,65536,224657412,65536,224722951,65536,19398660,2147614720,224854859,224789320,43384839,131072,37879815,131072,25690119,131072,6160391,131072,38469639,131072,38535175,131072,38600711,131072,34865156,131072,37748743,
+131072,35520641,131072,35586177,131072,35651713,131072,33619972,131072,2097156,131072,3605324,2147549184,224854859,2097156,2147483648,131072,0,33,157286532,2147549184,224854859,223936623,65536,224133252,65536,224198767,65536,224002159,2147614720,224854859,224265034,131923979,2147680256,224854859,224265034,224067606,131989515,196608,224329865,
+2147549184,224854859,224395393,65536,27787268,65536,224460804,65536,224526340,65536,224591876,65536,224657412,65536,224722951,65536,19398660,2147614720,224854859,224789320,43384839,131072,37879815,131072,25690119,131072,6160391,131072,38469639,131072,38535175,131072,38600711,131072,34865156,131072,37748743,131072,35520641,131072,
+35586177,131072,35651713,131072,33619972,131072,2097156,131072,3605324,2147549184,224854859,2097156,2147483648,131072,0,33,157286532,2147549184,224854859,223936623,65536,224133252,65536,224198767,65536,224002159,2147614720,224854859,224265034,131923979,2147680256,224854859,224265034,224067606,131989515,196608,224329865,2147549184,224854859,224395393,
+65536,27787268,65536,224460804,65536,224526340,65536,224591876,65536,224657412,65536,224722951,65536,19398660,2147614720,224854859,224789320,43384839,131072,37879815,131072,25690119,131072,6160391,131072,38469639,131072,38535175,131072,38600711,131072,34865156,131072,37748743,131072,35520641,131072,35586177,131072,35651713,
+131072,33619972,131072,2097156,131072,3605324,2147549184,224854859,2097156,2147483648,131072,0,33,157286532,2147549184,224854859,223936623,65536,224133252,65536,224198767,65536,224002159,2147614720,224854859,224265034,131923979,2147680256,224854859,224265034,224067606,131989515,196608,224329865,2147549184,224854859,224395393,65536,27787268,65536,
+224460804,65536,224526340,65536,224591876,65536,224657412,65536,224722951,65536,19398660,2147614720,224854859,224789320,43384839,131072,37879815,131072,25690119,131072,6160391,131072,38469639,131072,38535175,131072,38600711,131072,34865156,131072,37748743,131072,35520641,131072,35586177,131072,35651713,131072,33619972,131072,
+2097156,131072,3605324,2147549184,224854859,2097152,2147483648,29097984,0,10,227147776,0,227213312,0,227278848,0,1966080,0,6356992,0,109576199,0,227344391,0,37486599,0,101974023,0,227409971,0,17,226099211,0,2097156,0,227475460,0,227540999,0,131072,
+0,227606657,0,227672193,0,227147776,2147549184,227738457,227213312,65536,227278848,65536,1966080,65536,6356992,65536,109576199,65536,227344391,65536,37486599,65536,101974023,65536,227409971,65536,1,227803265,0,13,227868672,0,2097152,0,227934208,0,227999744,0,109182976,0,
+44367872,0,228065282,0,228130823,0,228196359,0,228261895,0,228327431,0,228392967,0,228458503,0,13,1966080,0,22937600,0,228524032,0,228589575,0,228655111,0,228720647,0,228786183,0,228851712,0,45481984,0,228917255,0,228982791,0,229048327,
+0,229113863,0,6,109182980,0,229179394,0,229244930,0,229310468,0,229376004,0,229441540,0,286,229507928,0,229573464,0,229638993,0,227082369,2147549184,229704531,19398660,65536,19464199,65536,40894476,65536,29097984,65536,229770068,2147483648,229835605,0,229901142,0,
+229966679,0,230032210,0,230096903,0,230162439,0,230227968,0,230293504,0,226230272,0,230359040,0,230424576,0,230490112,0,230555648,0,230621184,0,66650119,2147549184,230686802,58851335,65536,66715655,65536,58916871,65536,230752263,2147483648,230817796,0,230883335,0,230948864,
+0,231014402,0,231079936,0,231145472,0,231211008,0,231276544,0,231342082,0,231407623,0,231473152,0,231538688,0,15794176,0,226099211,2147549184,231605082,2097156,65536,227475460,65536,227540999,65536,131072,65536,227606657,65536,227672193,65536,227147776,2147614720,231605082,227738457,
+227213312,131072,227278848,131072,1966080,131072,6356992,131072,109576199,131072,227344391,131072,37486599,131072,101974023,131072,227409971,131072,227803265,2147549184,231670619,157286532,2147614720,231736141,224854859,223936623,131072,224133252,131072,224198767,131072,224002159,2147680256,231736141,224854859,224265034,131923979,2147745792,231736141,224854859,
+224265034,224067606,131989515,262144,224329865,2147614720,231736141,224854859,224395393,131072,27787268,131072,224460804,131072,224526340,131072,224591876,131072,224657412,131072,224722951,131072,19398660,2147680256,231736141,224854859,224789320,43384839,196608,37879815,196608,25690119,196608,6160391,196608,38469639,196608,38535175,196608,38600711,
+196608,34865156,196608,37748743,196608,35520641,196608,35586177,196608,35651713,196608,33619972,196608,2097156,196608,3605324,2147614720,231736141,224854859,2097154,2147549184,231736141,224919554,65536,224985090,65536,225050626,65536,225116162,65536,16121860,65536,225181842,65536,225247378,65536,76939410,65536,225312775,65536,
+225378311,65536,133758980,65536,131072,65536,225443847,65536,225509383,65536,6356992,65536,225574912,2147549184,231801678,29097984,65536,225640594,65536,114622706,2147614720,231801678,225706131,114688004,131072,100663300,131072,19595268,131072,18022404,131072,114753536,131072,114819072,131072,114884610,131072,114950148,131072,115015682,
+131072,115081218,131072,26017794,131072,2097154,131072,2097154,2147549184,231867216,225837058,65536,225902594,65536,225968130,65536,19398658,2147614720,231867216,226034511,917506,131072,225771522,131072,105971714,131072,2097156,131072,19464199,131072,19398658,131073,917506,131073,225771522,131073,105971714,131073,2097156,131073,
+19464199,131073,19398658,131074,917506,131074,225771522,131074,105971714,131074,2097156,131074,19464199,131074,19398658,131075,917506,131075,225771522,131075,105971714,131075,2097156,131075,19464199,131075,19398658,131076,917506,131076,225771522,131076,105971714,131076,2097156,131076,19464199,131076,19398658,131077,
+917506,131077,225771522,131077,105971714,131077,2097156,131077,19464199,131077,19398658,131078,917506,131078,225771522,131078,105971714,131078,2097156,131078,19464199,131078,226099211,2147549184,231867216,226164743,65536,2228224,65536,226230276,65536,226295812,65536,203030532,65536,226361348,65536,114622706,65536,105709619,
+65536,226426931,65536,231931911,2147483648,231997447,0,232062978,0,232128512,0,232194048,0,232259584,0,232325120,0,232390656,0,232456192,0,232521728,0,44367872,0,229179394,0,232587266,0,232652802,0,232718338,0,229244930,0,232783874,0,232849410,0,232914946,
+0,232980482,0,233046018,0,233111554,0,233177088,0,233242624,0,233308162,0,233373696,0,233439232,0,233504768,0,233570304,0,233635840,0,233701376,0,233766912,0,233832448,0,233897984,0,233963520,0,234029056,0,234094592,0,234160128,0,234225664,
+0,234291200,0,234356736,0,234422274,0,234487812,0,234553351,0,234618887,0,19398660,2147549184,224789320,43384839,65536,37879815,65536,25690119,65536,6160391,65536,38469639,65536,38535175,65536,38600711,65536,34865156,65536,37748743,65536,35520641,65536,35586177,65536,35651713,65536,
+33619972,65536,2097156,65536,227868672,2147549184,234685276,2097152,65536,227934208,65536,227999744,65536,109182976,65536,44367872,65536,228065282,65536,228130823,65536,228196359,65536,228261895,65536,228327431,65536,228392967,65536,228458503,65536,1966080,2147549184,234750813,22937600,65536,228524032,65536,228589575,65536,
+228655111,65536,228720647,65536,228786183,65536,228851712,65536,45481984,65536,228917255,65536,228982791,65536,229048327,65536,229113863,65536,234815495,2147483648,234881024,0,234946773,0,235012958,0,235077634,0,235143168,0,40566784,0,235208704,0,235274240,0,235339776,0,235405319,0,
+235470855,0,235536391,0,235601927,0,235667458,0,235732994,0,235798532,0,235864115,0,235929651,0,235995136,0,236060673,0,236126208,0,9,236191751,0,236257280,0,236322816,0,2097154,0,236388352,0,236453888,0,236519424,0,236584960,0,131072,
+0,4,50593799,0,2097156,0,236650500,0,2228224,0,4,236716039,0,236781575,0,236847111,0,236912647,0,41,236978183,0,237043719,0,237109255,0,237174791,0,237240327,0,237305860,0,237371392,0,237436928,0,1441792,0,1966080,2147549184,
+237503332,327090176,65536,327155712,65536,327221248,65536,2097154,65536,327286784,65536,327352320,65536,327417856,65536,327483392,65536,327548928,65536,44367872,65536,327614464,65536,327680000,65536,327745536,65536,327811079,65536,327876615,65536,327942151,65536,328007687,65536,328073223,65536,328138759,65536,328204295,
+65536,328269831,65536,328335367,65536,328400903,65536,328466439,65536,328531975,65536,328597511,65536,328663047,65536,328728580,65536,328794112,65536,8126488,65536,5308427,65536,6,237568007,0,237633543,0,237699079,0,237764612,0,2097156,0,237830148,0,59,2097156,0,237895684,
+0,237961220,0,238026756,0,238092295,0,238157828,0,2228224,0,238223364,0,238288900,0,238354439,0,238419975,0,238485508,0,238551044,0,238616583,0,238682119,0,238747652,0,238813188,0,238878727,0,238944263,0,239009799,0,239075332,0,239140868,
+0,239206404,0,239271943,0,239337479,0,239403015,0,239468551,0,239534080,0,7733248,0,239599623,0,239665159,0,239730695,0,239796231,0,183238660,0,239861764,0,239927300,0,223281156,0,183304199,0,239992839,0,240058372,0,240123908,0,240189444,
+0,240254980,0,240320519,0,240386055,0,240451591,0,240517127,0,240582663,0,240648199,0,240713735,0,240779268,0,237568007,2147549184,240845669,237633543,65536,237699079,65536,237764612,65536,2097156,65536,237830148,65536,110428167,2147483648,240910343,0,4,240975879,0,241041415,
+0,241106948,0,239927300,0,2,241172484,0,56033284,0,4,1966084,0,241238020,0,2097152,0,15532032,0,519,1835019,2147549184,4980762,1900555,65536,3801114,65536,3866655,65536,3932192,65536,3997696,65536,2097154,65536,2621444,65536,4063236,65536,4128772,
+65536,4194308,65536,4259844,65536,4325380,65536,4390916,65536,3735552,2147614720,4980762,4456478,4522008,2147549184,4980762,4587544,65536,4653067,65536,4718620,65536,4784154,65536,4849675,65536,4915233,65536,3604514,65536,24576098,2147483648,67633203,0,241303893,0,241369330,0,131923979,2147549184,
+458774,131989515,65536,119734606,2147483648,101974023,2147549184,241435498,326893575,65536,184549383,65536,326959111,65536,327024647,65536,20381698,65536,1441792,65536,119013380,2147483648,241500164,0,6356992,0,2097154,0,121700352,0,198311936,0,122552664,0,241566040,0,241632107,0,241697631,0,
+236716039,2147549184,241763170,236781575,65536,236847111,65536,236912647,65536,217710592,2147614720,60818246,174916201,217776128,131072,19791872,131072,217841664,131072,2097152,131072,143130624,131072,217907200,131072,217972736,131072,218038272,131072,218103808,131072,218169344,131072,218234880,131072,218300416,131072,1179648,131072,218365954,
+131072,218431490,131072,218497031,131072,2097154,2147680256,60818246,174916201,218562888,217513984,196608,217579520,196608,217645056,196608,1179648,196608,116850688,2147614720,60818246,174916201,218628096,131072,16384000,131072,2097156,2147680256,60818246,174916201,179437737,131072,196608,60227584,196608,60293120,196608,60358663,196608,60424199,
+196608,60489735,196608,60555271,196608,60620929,196608,5308427,196608,60686336,2147680256,60818246,174916201,179372202,60751872,196608,29097984,196608,2162688,2147680256,60818246,174916201,218693803,1966084,2147614720,60818246,219480897,215613444,131072,215678980,131072,215744516,131072,215810052,131072,215875588,131072,215941124,131072,216006663,
+131072,216072196,131072,216137732,131072,27787268,131072,216203268,131072,216268804,131072,216334340,131072,216399876,131072,216465412,131072,216530948,131072,216596484,131072,216662020,131072,216727556,131072,29949956,2147549184,60818246,18022404,65536,18087940,65536,219545607,65536,219611140,65536,219676676,65536,219742212,65536,
+219807748,65536,2097154,65536,186777602,65536,219873287,65536,219938820,65536,220004354,65536,19398658,65536,220069892,65536,220135428,65536,220200964,65536,220266500,65536,217841666,65536,217776130,65536,220332034,65536,143130626,65536,220397568,65536,220463104,65536,220528644,65536,16121860,65536,220594178,65536,
+220659712,65536,220725248,65536,66650119,2147614720,60818246,220790866,58851335,131072,66715655,131072,58916871,131072,131923979,2147614720,60818246,45023254,131989515,131072,220856322,2147549184,60818246,22937600,65536,220921863,65536,220987399,65536,221052935,65536,221118471,65536,221184007,65536,221249543,65536,221315076,65536,221380615,
+65536,161808386,65536,221446146,65536,221511682,65536,221577218,65536,221642752,65536,221708292,65536,221773826,65536,114491392,65536,221839360,65536,221904903,65536,221970439,65536,222035968,65536,222101504,65536,89194496,65536,222167042,65536,222232578,65536,222298114,65536,222363655,65536,222429191,65536,222494727,
+65536,222560260,65536,222625799,65536,222691328,65536,34537472,65536,222756866,65536,217710592,2147680256,60818246,222823237,174916201,217776128,196608,19791872,196608,217841664,196608,2097152,196608,143130624,196608,217907200,196608,217972736,196608,218038272,196608,218103808,196608,218169344,196608,218234880,196608,218300416,196608,
+1179648,196608,218365954,196608,218431490,196608,218497031,196608,2097154,2147745792,60818246,222823237,174916201,218562888,217513984,262144,217579520,262144,217645056,262144,1179648,262144,116850688,2147680256,60818246,222823237,174916201,218628096,196608,16384000,196608,2097156,2147745792,60818246,222823237,174916201,179437737,131072,262144,60227584,
+262144,60293120,262144,60358663,262144,60424199,262144,60489735,262144,60555271,262144,60620929,262144,5308427,262144,60686336,2147745792,60818246,222823237,174916201,179372202,60751872,262144,29097984,262144,2162688,2147745792,60818246,222823237,174916201,218693803,44892160,2147614720,60818246,222823237,1966084,131072,71237634,131072,31195138,
+131072,212992002,131072,2097154,131072,218759175,131072,218824711,131072,218890244,131072,218955776,131072,219021312,131072,219086848,131072,219152384,131072,219217920,131072,219283456,131072,219348992,131072,29097984,131072,219414579,131072,222887940,2147549184,60818246,222953474,65536,125239298,65536,131923979,2147614720,60818246,117047318,
+131989515,131072,223019010,2147549184,60818246,116850690,65536,223084546,65536,223150082,65536,223215623,65536,223281156,65536,2097156,2147614720,60818246,223346817,57737220,131072,57802756,131072,57868292,131072,66650119,2147680256,60818246,223346817,57933906,58851335,196608,66715655,196608,58916871,196608,66650119,2147680256,60818246,223346817,
+57999442,58851335,196608,66715655,196608,58916871,196608,57081858,2147680256,60818246,223346817,58065062,2097154,196608,31522823,196608,57147399,196608,57212935,196608,57278471,196608,57344007,196608,17825957,196608,57409701,196608,57475237,196608,57540615,196608,57606151,196608,57671682,196608,1441792,196608,57081858,196609,
+2097154,196609,31522823,196609,57147399,196609,57212935,196609,57278471,196609,57344007,196609,17825957,196609,57409701,196609,57475237,196609,57540615,196609,57606151,196609,57671682,196609,1441792,196609,57081858,196610,2097154,196610,31522823,196610,57147399,196610,57212935,196610,57278471,196610,57344007,196610,
+17825957,196610,57409701,196610,57475237,196610,57540615,196610,57606151,196610,57671682,196610,1441792,196610,57081858,196611,2097154,196611,31522823,196611,57147399,196611,57212935,196611,57278471,196611,57344007,196611,17825957,196611,57409701,196611,57475237,196611,57540615,196611,57606151,196611,57671682,196611,
+1441792,196611,58130439,2147614720,60818246,223346817,58195975,131072,58261511,131072,58327047,131072,58392578,131072,1441792,131072,223412228,2147549184,60818246,223477764,65536,223543300,65536,223608836,65536,223674372,65536,223739911,65536,223805444,65536,223870976,65536,216793092,2147549184,241828674,216858631,65536,216924167,65536,
+216989703,65536,217055236,65536,2097154,65536,3276800,65536,30932999,65536,6356992,65536,131923979,2147549184,14680086,131989515,65536,131923979,2147549184,241893398,131989515,65536,1966084,2147549184,241959785,241238020,65536,2097152,65536,15532032,65536,1966084,65537,241238020,65537,2097152,65537,15532032,65537,1966084,
+65538,241238020,65538,2097152,65538,15532032,65538,1966084,65539,241238020,65539,2097152,65539,15532032,65539,242024459,2147483648,242090860,0,242155520,0,242221060,0,131923979,2147549184,242286614,131989515,65536,236191751,2147549184,242352992,236257280,65536,236322816,65536,2097154,65536,236388352,65536,236453888,
+65536,236519424,65536,236584960,65536,131072,65536,165282063,2147483648,46399636,0,50593799,2147549184,242418529,2097156,65536,236650500,65536,2228224,65536,76611594,2147549184,242483426,76677130,65536,76742666,65536,76808202,65536,76873738,65536,76611594,2147549184,242548962,76677130,65536,76742666,65536,76808202,65536,
+76873738,65536,2097156,2147549184,179437737,131072,65536,60227584,65536,60293120,65536,60358663,65536,60424199,65536,60489735,65536,60555271,65536,60620929,65536,5308427,65536,60686336,2147549184,179372202,60751872,65536,29097984,65536,2162688,2147549184,242614443,242680639,2147483648,15073317,0,131923979,2147549184,242745366,
+131989515,65536,242810946,2147483648,242876440,0,242941956,0,243007492,0,236978183,2147549184,243073891,237043719,65536,237109255,65536,237174791,65536,237240327,65536,237305860,65536,237371392,65536,237436928,65536,1441792,65536,1966080,2147614720,243073891,237503332,327090176,131072,327155712,131072,327221248,131072,2097154,
+131072,327286784,131072,327352320,131072,327417856,131072,327483392,131072,327548928,131072,44367872,131072,327614464,131072,327680000,131072,327745536,131072,327811079,131072,327876615,131072,327942151,131072,328007687,131072,328073223,131072,328138759,131072,328204295,131072,328269831,131072,328335367,131072,328400903,131072,328466439,
+131072,328531975,131072,328597511,131072,328663047,131072,328728580,131072,328794112,131072,8126488,131072,5308427,131072,2097156,2147549184,120521574,237895684,65536,237961220,65536,238026756,65536,238092295,65536,238157828,65536,2228224,65536,238223364,65536,238288900,65536,238354439,65536,238419975,65536,238485508,65536,
+238551044,65536,238616583,65536,238682119,65536,238747652,65536,238813188,65536,238878727,65536,238944263,65536,239009799,65536,239075332,65536,239140868,65536,239206404,65536,239271943,65536,239337479,65536,239403015,65536,239468551,65536,239534080,65536,7733248,65536,239599623,65536,239665159,65536,239730695,65536,
+239796231,65536,183238660,65536,239861764,65536,239927300,65536,223281156,65536,183304199,65536,239992839,65536,240058372,65536,240123908,65536,240189444,65536,240254980,65536,240320519,65536,240386055,65536,240451591,65536,240517127,65536,240582663,65536,240648199,65536,240713735,65536,240779268,65536,237568007,2147614720,
+120521574,240845669,237633543,131072,237699079,131072,237764612,131072,2097156,131072,237830148,131072,110428167,2147549184,120521574,240910343,65536,240975879,2147549184,243139431,241041415,65536,241106948,65536,239927300,65536,241172484,2147549184,243204968,56033284,65536,3605357,2147483648,52,1835019,2147549184,4980762,1900555,65536,3801114,
+65536,3866655,65536,3932192,65536,3997696,65536,2097154,65536,2621444,65536,4063236,65536,4128772,65536,4194308,65536,4259844,65536,4325380,65536,4390916,65536,3735552,2147614720,4980762,4456478,4522008,2147549184,4980762,4587544,65536,4653067,65536,4718620,65536,4784154,65536,4849675,65536,
+4915233,65536,3604514,65536,131923979,2147549184,243269654,131989515,65536,131923979,2147549184,243335190,131989515,65536,131923979,2147549184,243400726,131989515,65536,131923979,2147549184,15597590,131989515,65536,114622706,2147483648,2097154,0,243466242,0,243531778,0,243597312,0,200933376,0,243662848,0,243728384,0,
+243793920,0,243859456,0,243924992,0,243990528,0,244056064,0,61341696,0,244122478,0,244188015,0,244252683,0,244318210,0,87359488,0,244384624,0,15073317,0,7,1835889,0,1901425,0,244450161,0,56885250,2147549184,244515698,56950786,65536,2097154,2147483648,
+137822210,0,7,1835891,0,1901427,0,244581233,0,244646769,0,220790786,0,2097154,0,131072,0,6,131923979,2147549184,243269654,131989515,65536,131923979,2147549184,243335190,131989515,65536,131923979,2147549184,243400726,131989515,65536,6,1835893,0,1901429,0,244711424,0,
+2097153,0,1179648,0,244776964,0,25,1835894,0,1901430,0,244843383,0,244908920,0,244973568,0,245039104,0,245104644,0,245170180,0,173277188,0,173342724,0,245235716,0,245301252,0,245366786,0,2097154,0,119341058,0,1441792,0,245432324,
+0,245497867,0,131923979,2147549184,56229910,131989515,65536,131923979,2147549184,245563414,131989515,65536,245628932,2147483648,6356992,0,3605369,0,3,1835898,0,1901434,0,23461888,0,15,1835899,0,1901435,0,244843388,0,245694464,0,245760004,0,2097156,0,245825540,
+0,245891076,0,245956612,0,246022148,0,246087680,0,246153220,0,246218756,0,4522008,0,246285181,0,5,246349828,0,246415364,0,2097155,0,1441792,0,246480896,0,8,1835903,0,1901439,0,23461888,0,246349828,2147549184,200934270,246415364,65536,
+2097155,65536,1441792,65536,246480896,65536,5,1835904,0,1901440,0,2162688,0,246546439,0,131072,0,6,1835905,0,1901441,0,246611968,0,31195138,0,2621442,0,246677508,0,6,246743042,0,246808578,0,246874114,0,246939650,0,2097154,
+0,3276800,0,3,247006084,0,247070720,0,15532032,0,35,1835909,0,1901445,0,244581233,0,244646769,0,247137137,0,247202673,0,247267569,0,66650116,2147549184,247333766,58851332,65536,66715652,65536,58916868,65536,15663104,2147483648,247398400,0,247463938,0,
+247529474,0,247595010,0,247660544,0,243728384,0,2097154,0,247726082,0,3276800,0,244843399,0,247792514,0,247857159,0,131923979,2147549184,247922710,131989515,65536,131923979,2147549184,15597590,131989515,65536,131923979,2147549184,247988246,131989515,65536,131923979,2147549184,248053782,131989515,65536,
+247006084,2147549184,12190595,247070720,65536,15532032,65536,71,1835886,0,1901422,0,66650119,2147614720,15859783,61145170,58851335,131072,66715655,131072,58916871,131072,66650119,2147614720,15859783,57737298,58851335,131072,66715655,131072,58916871,131072,66650116,2147614720,15859783,323093382,58851332,131072,66715652,131072,
+58916868,131072,66650116,2147614720,15859783,323158918,58851332,131072,66715652,131072,58916868,131072,66650116,2147614720,15859783,323224454,58851332,131072,66715652,131072,58916868,131072,323289095,2147549184,15859783,323354631,65536,323420167,65536,323485703,65536,323551234,65536,323616770,65536,323682306,65536,323747842,65536,323813378,
+65536,2097154,65536,246939650,65536,247529474,65536,247595010,65536,323878914,65536,323944450,65536,261816322,65536,324009984,65536,324075520,65536,3276800,65536,324141063,65536,324207673,65536,324273007,65536,66650116,2147549184,248120198,58851332,65536,66715652,65536,58916868,65536,247529474,2147483648,247595010,0,
+248184836,0,248250370,0,248315906,0,2097154,0,173277186,0,173342722,0,248381442,0,248446978,0,3276800,0,131923979,2147549184,248512534,131989515,65536,131923979,2147549184,248578070,131989515,65536,131923979,2147549184,248643606,131989515,65536,131923979,2147549184,248709142,131989515,65536,131923979,2147549184,
+248774678,131989515,65536,248840203,2147483648,3605384,0,10,1966082,2147549184,248905838,22937600,65536,28639236,65536,131923979,2147549184,248971286,131989515,65536,249036800,2147483648,249102336,0,249167874,0,249233410,0,14876672,0,17,1835914,0,1901450,0,23461888,0,244843403,0,1966082,
+2147614720,162399113,248905838,22937600,131072,28639236,131072,131923979,2147614720,162399113,248971286,131989515,131072,249036800,2147549184,162399113,249102336,65536,249167874,65536,249233410,65536,14876672,65536,249298946,2147483648,249364482,0,131072,0,3,131923979,2147549184,249430038,131989515,65536,249496458,2147483648,1,244843406,
+0,4,181600256,0,249561092,0,249626628,0,249692167,0,4,249757700,0,249823236,0,249888772,0,249954308,0,7,250019847,0,250085383,0,129499143,0,129564679,0,46596103,0,250150919,0,113704964,0,9,185860100,0,178388999,0,178454535,
+0,178520071,0,178192391,0,66519047,0,178257927,0,2097156,0,131072,0,10,164757504,0,250216448,0,115147073,0,164823042,0,143130626,0,250281986,0,250347522,0,250413058,0,250478592,0,20447232,0,9,1835924,0,1901460,0,250545039,
+0,164757504,0,195953555,0,250610576,0,250676113,0,250741650,0,2162688,2147549184,116654251,6,250806280,0,2097156,0,250871815,0,250937352,0,251002887,0,131072,0,65,1835926,0,1901462,0,2162688,0,2097156,0,1966084,0,2359300,0,
+22413319,0,251068423,0,251133959,0,251199495,0,251265031,0,251330564,0,251396100,0,251461636,0,174850055,0,251527175,0,251592706,0,121241602,0,251658244,0,251723780,0,251790228,0,114622706,0,251854899,0,46399636,0,251920784,0,251985927,0,
+252051463,0,252117910,0,252183446,0,131923979,2147549184,252248086,131989515,65536,131923979,2147549184,13631510,131989515,65536,131923979,2147549184,252313622,131989515,65536,252379734,2147483648,30932999,0,31326215,0,252444679,0,252510215,0,252575751,0,99811328,0,252641291,0,252706820,0,252772356,
+0,101449732,0,252837895,0,56492044,0,116719616,0,34537472,0,252903428,0,18022404,0,116850688,0,212336640,0,117113160,0,8126488,0,4587544,0,131923979,2147549184,21364758,131989515,65536,252968967,2147483648,253034503,0,253100949,0,253165572,0,234881024,0,
+3605399,0,5,1835928,0,1901464,0,253232022,0,253297558,0,253362180,0,5,1835929,0,1901465,0,2162688,0,23068676,0,2097156,0,3,1835930,0,1901466,0,253428630,0,9,253494172,0,253559709,0,253625246,0,253690783,0,
+253756320,0,253821857,0,253887394,0,253952004,0,2097156,0,29,254018454,0,131923979,2147549184,252248086,131989515,65536,131923979,2147549184,254083094,131989515,65536,131923979,2147549184,13631510,131989515,65536,254149526,2147483648,254214144,0,254279684,0,254345220,0,254410756,0,254476292,0,
+66650119,2147549184,254541906,58851335,65536,66715655,65536,58916871,65536,254607364,2147483648,92078084,0,254673827,0,253494172,2147549184,12190619,253559709,65536,253625246,65536,253690783,65536,253756320,65536,253821857,65536,253887394,65536,253952004,65536,2097156,65536,4,254738439,0,109576199,0,254803970,
+0,254869506,0,6,254935047,0,255000583,0,255066119,0,255131655,0,255197188,0,255262724,0,8,255328263,0,255393799,0,255459335,0,255524871,0,255590407,0,146472964,0,180813828,0,255655940,0,2,255721479,0,131072,0,7,255787015,
+0,255852551,0,27787268,0,255918084,0,252051463,0,255983623,0,256049159,0,2,179503111,0,179568647,0,30,256114688,0,256180228,0,6356992,0,256245975,0,256311300,0,256376839,0,98172935,0,256442375,0,256507911,0,256573447,0,256638983,
+0,256704519,0,256770055,0,256835591,0,256901127,0,256966663,0,257032199,0,257097735,0,2097152,0,246939648,0,3276800,0,257163268,0,257228804,0,257294340,0,71827456,0,257359872,0,257425408,0,121241600,0,3605419,0,257490944,0,2,
+257556484,0,104398855,0,13,1835949,0,1901485,0,1966084,0,2097156,0,2162688,0,257622020,0,257687556,0,257754006,0,257819024,0,142475268,0,142409731,0,17956867,0,3605422,0,23,1835949,2147549184,104137645,1901485,65536,1966084,65536,2097156,
+65536,2162688,65536,257622020,65536,257687556,65536,257754006,65536,257819024,65536,142475268,65536,142409731,65536,17956867,65536,3605422,65536,185860100,2147549184,257885074,178388999,65536,178454535,65536,178520071,65536,178192391,65536,66519047,65536,178257927,65536,2097156,65536,131072,65536,257949703,2147483648,
+87,1835949,2147549184,104137645,1901485,65536,1966084,65536,2097156,65536,2162688,65536,257622020,65536,257687556,65536,257754006,65536,257819024,65536,142475268,65536,142409731,65536,17956867,65536,3605422,65536,2097156,2147549184,258015361,57737220,65536,57802756,65536,57868292,65536,66650119,2147614720,258015361,
+57933906,58851335,131072,66715655,131072,58916871,131072,66650119,2147614720,258015361,57999442,58851335,131072,66715655,131072,58916871,131072,57081858,2147614720,258015361,58065062,2097154,131072,31522823,131072,57147399,131072,57212935,131072,57278471,131072,57344007,131072,17825957,131072,57409701,131072,57475237,131072,57540615,
+131072,57606151,131072,57671682,131072,1441792,131072,57081858,131073,2097154,131073,31522823,131073,57147399,131073,57212935,131073,57278471,131073,57344007,131073,17825957,131073,57409701,131073,57475237,131073,57540615,131073,57606151,131073,57671682,131073,1441792,131073,57081858,131074,2097154,131074,31522823,
+131074,57147399,131074,57212935,131074,57278471,131074,57344007,131074,17825957,131074,57409701,131074,57475237,131074,57540615,131074,57606151,131074,57671682,131074,1441792,131074,57081858,131075,2097154,131075,31522823,131075,57147399,131075,57212935,131075,57278471,131075,57344007,131075,17825957,131075,57409701,
+131075,57475237,131075,57540615,131075,57606151,131075,57671682,131075,1441792,131075,58130439,2147549184,258015361,58195975,65536,58261511,65536,58327047,65536,58392578,65536,1441792,65536,87,1835949,2147549184,104137645,1901485,65536,1966084,65536,2097156,65536,2162688,65536,257622020,65536,257687556,65536,
+257754006,65536,257819024,65536,142475268,65536,142409731,65536,17956867,65536,3605422,65536,2097156,2147549184,258015361,57737220,65536,57802756,65536,57868292,65536,66650119,2147614720,258015361,57933906,58851335,131072,66715655,131072,58916871,131072,66650119,2147614720,258015361,57999442,58851335,131072,66715655,131072,58916871,
+131072,57081858,2147614720,258015361,58065062,2097154,131072,31522823,131072,57147399,131072,57212935,131072,57278471,131072,57344007,131072,17825957,131072,57409701,131072,57475237,131072,57540615,131072,57606151,131072,57671682,131072,1441792,131072,57081858,131073,2097154,131073,31522823,131073,57147399,131073,57212935,
+131073,57278471,131073,57344007,131073,17825957,131073,57409701,131073,57475237,131073,57540615,131073,57606151,131073,57671682,131073,1441792,131073,57081858,131074,2097154,131074,31522823,131074,57147399,131074,57212935,131074,57278471,131074,57344007,131074,17825957,131074,57409701,131074,57475237,131074,57540615,
+131074,57606151,131074,57671682,131074,1441792,131074,57081858,131075,2097154,131075,31522823,131075,57147399,131075,57212935,131075,57278471,131075,57344007,131075,17825957,131075,57409701,131075,57475237,131075,57540615,131075,57606151,131075,57671682,131075,1441792,131075,58130439,2147549184,258015361,58195975,65536,
+58261511,65536,58327047,65536,58392578,65536,1441792,65536,15,1835949,2147549184,104137645,1901485,65536,1966084,65536,2097156,65536,2162688,65536,257622020,65536,257687556,65536,257754006,65536,257819024,65536,142475268,65536,142409731,65536,17956867,65536,3605422,65536,258080775,2147483648,172359687,0,
+13,1835949,2147549184,104137645,1901485,65536,1966084,65536,2097156,65536,2162688,65536,257622020,65536,257687556,65536,257754006,65536,257819024,65536,142475268,65536,142409731,65536,17956867,65536,3605422,65536,15,1835949,2147549184,104137645,1901485,65536,1966084,65536,2097156,65536,2162688,65536,
+257622020,65536,257687556,65536,257754006,65536,257819024,65536,142475268,65536,142409731,65536,17956867,65536,3605422,65536,258146311,2147483648,131072,0,21,1835949,2147549184,104137645,1901485,65536,1966084,65536,2097156,65536,2162688,65536,257622020,65536,257687556,65536,257754006,65536,257819024,65536,
+142475268,65536,142409731,65536,17956867,65536,3605422,65536,177733639,2147483648,19595271,0,60424199,0,123207687,0,172359687,0,258211847,0,258277383,0,1966084,0,14,1835949,2147549184,104137645,1901485,65536,1966084,65536,2097156,65536,2162688,65536,257622020,65536,257687556,65536,
+257754006,65536,257819024,65536,142475268,65536,142409731,65536,17956867,65536,3605422,65536,162333016,2147483648,76,1835959,0,1901495,0,2097156,2147549184,258015361,57737220,65536,57802756,65536,57868292,65536,66650119,2147614720,258015361,57933906,58851335,131072,66715655,131072,58916871,131072,66650119,2147614720,
+258015361,57999442,58851335,131072,66715655,131072,58916871,131072,57081858,2147614720,258015361,58065062,2097154,131072,31522823,131072,57147399,131072,57212935,131072,57278471,131072,57344007,131072,17825957,131072,57409701,131072,57475237,131072,57540615,131072,57606151,131072,57671682,131072,1441792,131072,57081858,131073,
+2097154,131073,31522823,131073,57147399,131073,57212935,131073,57278471,131073,57344007,131073,17825957,131073,57409701,131073,57475237,131073,57540615,131073,57606151,131073,57671682,131073,1441792,131073,57081858,131074,2097154,131074,31522823,131074,57147399,131074,57212935,131074,57278471,131074,57344007,131074,
+17825957,131074,57409701,131074,57475237,131074,57540615,131074,57606151,131074,57671682,131074,1441792,131074,57081858,131075,2097154,131075,31522823,131075,57147399,131075,57212935,131075,57278471,131075,57344007,131075,17825957,131075,57409701,131075,57475237,131075,57540615,131075,57606151,131075,57671682,131075,
+1441792,131075,58130439,2147549184,258015361,58195975,65536,58261511,65536,58327047,65536,58392578,65536,1441792,65536,15,1835949,2147549184,104137645,1901485,65536,1966084,65536,2097156,65536,2162688,65536,257622020,65536,257687556,65536,257754006,65536,257819024,65536,142475268,65536,142409731,65536,17956867,
+65536,3605422,65536,131923979,2147549184,258342934,131989515,65536,20,1835949,2147549184,104137645,1901485,65536,1966084,65536,2097156,65536,2162688,65536,257622020,65536,257687556,65536,257754006,65536,257819024,65536,142475268,65536,142409731,65536,17956867,65536,3605422,65536,16121860,2147483648,258408452,0,
+258473988,0,112852999,0,258539520,0,1179648,0,143130628,0,17,1835949,2147549184,104137645,1901485,65536,1966084,65536,2097156,65536,2162688,65536,257622020,65536,257687556,65536,257754006,65536,257819024,65536,142475268,65536,142409731,65536,17956867,65536,3605422,65536,258605063,2147483648,
+13369351,0,177537031,0,131072,0,1,258670602,0,9,1835963,0,1901499,0,1966084,0,16121860,0,2228224,0,2097154,0,17956866,0,2162688,0,104071168,0,5,9568263,0,131072,0,258737085,0,258802621,0,258868157,0,19,
+1835963,2147549184,258933691,1901499,65536,1966084,65536,16121860,65536,2228224,65536,2097154,65536,17956866,65536,2162688,65536,104071168,65536,258998279,2147483648,2097156,0,120193028,0,46596103,0,131072,0,9568263,2147549184,12190652,131072,65536,258737085,65536,258802621,65536,258868157,65536,
+20,1835963,2147549184,258933691,1901499,65536,1966084,65536,16121860,65536,2228224,65536,2097154,65536,17956866,65536,2162688,65536,104071168,65536,16121860,2147483648,259063815,0,259129351,0,104398855,0,2097156,0,131072,0,9568263,2147549184,12190652,131072,65536,258737085,65536,258802621,
+65536,258868157,65536,16,1835963,2147549184,258933691,1901499,65536,1966084,65536,16121860,65536,2228224,65536,2097154,65536,17956866,65536,2162688,65536,104071168,65536,2097156,2147483648,259194884,0,9568263,2147549184,12190652,131072,65536,258737085,65536,258802621,65536,258868157,65536,24,1835963,
+2147549184,258933691,1901499,65536,1966084,65536,16121860,65536,2228224,65536,2097154,65536,17956866,65536,2162688,65536,104071168,65536,259260423,2147483648,259325959,0,143654919,0,2097156,0,16121860,0,259391495,0,120193028,0,46596103,0,101449732,0,131072,0,9568263,2147549184,
+12190652,131072,65536,258737085,65536,258802621,65536,258868157,65536,17,1835963,2147549184,258933691,1901499,65536,1966084,65536,16121860,65536,2228224,65536,2097154,65536,17956866,65536,2162688,65536,104071168,65536,9633796,2147483648,2097156,0,259457031,0,9568263,2147549184,12190652,131072,65536,
+258737085,65536,258802621,65536,258868157,65536,22,1835963,2147549184,258933691,1901499,65536,1966084,65536,16121860,65536,2228224,65536,2097154,65536,17956866,65536,2162688,65536,104071168,65536,46530564,2147483648,2097156,0,259522567,0,259588103,0,16121860,0,259391492,0,120193028,0,
+131072,0,9568263,2147549184,12190652,131072,65536,258737085,65536,258802621,65536,258868157,65536,27,1835963,2147549184,258933691,1901499,65536,1966084,65536,16121860,65536,2228224,65536,2097154,65536,17956866,65536,2162688,65536,104071168,65536,105709619,2147483648,46530564,0,2097156,0,259653639,
+0,18481159,0,68878343,0,19529735,0,129892356,0,102957063,0,46596103,0,259391492,0,120193028,0,131072,0,9568263,2147549184,12190652,131072,65536,258737085,65536,258802621,65536,258868157,65536,19,1835963,2147549184,258933691,1901499,65536,1966084,65536,16121860,65536,
+2228224,65536,2097154,65536,17956866,65536,2162688,65536,104071168,65536,105709619,2147483648,2097156,0,68354052,0,109576199,0,259719172,0,9568263,2147549184,12190652,131072,65536,258737085,65536,258802621,65536,258868157,65536,20,1835963,2147549184,258933691,1901499,65536,1966084,65536,16121860,
+65536,2228224,65536,2097154,65536,17956866,65536,2162688,65536,104071168,65536,18481159,2147483648,68878343,0,19529735,0,129892356,0,2097156,0,131072,0,9568263,2147549184,12190652,131072,65536,258737085,65536,258802621,65536,258868157,65536,40,1835019,2147549184,4980762,1900555,65536,
+3801114,65536,3866655,65536,3932192,65536,3997696,65536,2097154,65536,2621444,65536,4063236,65536,4128772,65536,4194308,65536,4259844,65536,4325380,65536,4390916,65536,3735552,2147614720,4980762,4456478,4522008,2147549184,4980762,4587544,65536,4653067,65536,4718620,65536,4784154,65536,4849675,
+65536,4915233,65536,3604514,65536,5046272,2147483648,5242915,0,259784739,0,24838155,0,259850248,0,30932999,0,259915783,0,31326215,0,259981319,0,260046855,0,30015495,0,215941124,0,260112388,0,27787266,0,16384000,0,3605447,0,5308427,0,7,
+1835078,0,1900614,0,131923979,2147549184,15597590,131989515,65536,15663104,2147483648,15728640,0,15794176,0,9,1835078,0,1900614,0,131923979,2147549184,15597590,131989515,65536,15663104,2147483648,15728640,0,15794176,0,260177920,0,29097984,0,63,1835078,0,1900614,0,
+131923979,2147549184,15597590,131989515,65536,15663104,2147483648,15728640,0,15794176,0,66650119,2147614720,15859783,61145170,58851335,131072,66715655,131072,58916871,131072,66650119,2147614720,15859783,57737298,58851335,131072,66715655,131072,58916871,131072,66650116,2147614720,15859783,323093382,58851332,131072,66715652,131072,58916868,
+131072,66650116,2147614720,15859783,323158918,58851332,131072,66715652,131072,58916868,131072,66650116,2147614720,15859783,323224454,58851332,131072,66715652,131072,58916868,131072,323289095,2147549184,15859783,323354631,65536,323420167,65536,323485703,65536,323551234,65536,323616770,65536,323682306,65536,323747842,65536,323813378,65536,
+2097154,65536,246939650,65536,247529474,65536,247595010,65536,323878914,65536,323944450,65536,261816322,65536,324009984,65536,324075520,65536,3276800,65536,324141063,65536,324207673,65536,324273007,65536,260243458,2147483648,260308994,0,260374530,0,260440066,0,260505604,0,260571138,0,2097152,0,
+260636672,0,28901387,0,27197444,0,260702212,0,260767770,0,260833291,0,3605450,0,65,1835078,0,1900614,0,131923979,2147549184,15597590,131989515,65536,15663104,2147483648,15728640,0,15794176,0,66650119,2147614720,15859783,61145170,58851335,131072,66715655,131072,58916871,131072,
+66650119,2147614720,15859783,57737298,58851335,131072,66715655,131072,58916871,131072,66650116,2147614720,15859783,323093382,58851332,131072,66715652,131072,58916868,131072,66650116,2147614720,15859783,323158918,58851332,131072,66715652,131072,58916868,131072,66650116,2147614720,15859783,323224454,58851332,131072,66715652,131072,58916868,131072,
+323289095,2147549184,15859783,323354631,65536,323420167,65536,323485703,65536,323551234,65536,323616770,65536,323682306,65536,323747842,65536,323813378,65536,2097154,65536,246939650,65536,247529474,65536,247595010,65536,323878914,65536,323944450,65536,261816322,65536,324009984,65536,324075520,65536,3276800,65536,324141063,
+65536,324207673,65536,324273007,65536,131923979,2147549184,260898838,131989515,65536,260964577,2147483648,249102336,0,2097154,0,261029890,0,261095426,0,261160962,0,261226496,0,1441792,0,261292032,0,113704964,0,261357568,0,261423104,0,261488642,0,3605452,0,4,2097152,
+0,29097984,0,131923979,2147549184,261554198,131989515,65536,61,1835078,0,1900614,0,131923979,2147549184,15597590,131989515,65536,15663104,2147483648,15728640,0,15794176,0,66650119,2147614720,15859783,61145170,58851335,131072,66715655,131072,58916871,131072,66650119,2147614720,15859783,57737298,58851335,131072,
+66715655,131072,58916871,131072,66650116,2147614720,15859783,323093382,58851332,131072,66715652,131072,58916868,131072,66650116,2147614720,15859783,323158918,58851332,131072,66715652,131072,58916868,131072,66650116,2147614720,15859783,323224454,58851332,131072,66715652,131072,58916868,131072,323289095,2147549184,15859783,323354631,65536,323420167,
+65536,323485703,65536,323551234,65536,323616770,65536,323682306,65536,323747842,65536,323813378,65536,2097154,65536,246939650,65536,247529474,65536,247595010,65536,323878914,65536,323944450,65536,261816322,65536,324009984,65536,324075520,65536,3276800,65536,324141063,65536,324207673,65536,324273007,65536,261619777,
+2147483648,16121858,0,16252930,0,2097156,0,261685255,0,261750791,0,261816324,0,131072,0,2097152,2147549184,12190669,29097984,65536,131923979,2147614720,12190669,261554198,131989515,131072,53,1835078,0,1900614,0,131923979,2147549184,15597590,131989515,65536,15663104,2147483648,15728640,0,
+15794176,0,16252930,0,2097154,0,131072,0,261619777,0,66650119,2147614720,15859783,61145170,58851335,131072,66715655,131072,58916871,131072,66650119,2147614720,15859783,57737298,58851335,131072,66715655,131072,58916871,131072,66650116,2147614720,15859783,323093382,58851332,131072,66715652,131072,58916868,131072,
+66650116,2147614720,15859783,323158918,58851332,131072,66715652,131072,58916868,131072,66650116,2147614720,15859783,323224454,58851332,131072,66715652,131072,58916868,131072,323289095,2147549184,15859783,323354631,65536,323420167,65536,323485703,65536,323551234,65536,323616770,65536,323682306,65536,323747842,65536,323813378,65536,2097154,
+65536,246939650,65536,247529474,65536,247595010,65536,323878914,65536,323944450,65536,261816322,65536,324009984,65536,324075520,65536,3276800,65536,324141063,65536,324207673,65536,324273007,65536,2,2097156,0,2228224,0,2,2097156,0,2228224,0,2,2097156,0,2228224,0,
+73,1835078,0,1900614,0,131923979,2147549184,15597590,131989515,65536,15663104,2147483648,15728640,0,15794176,0,66650119,2147614720,15859783,61145170,58851335,131072,66715655,131072,58916871,131072,66650119,2147614720,15859783,57737298,58851335,131072,66715655,131072,58916871,131072,66650116,2147614720,15859783,323093382,
+58851332,131072,66715652,131072,58916868,131072,66650116,2147614720,15859783,323158918,58851332,131072,66715652,131072,58916868,131072,66650116,2147614720,15859783,323224454,58851332,131072,66715652,131072,58916868,131072,323289095,2147549184,15859783,323354631,65536,323420167,65536,323485703,65536,323551234,65536,323616770,65536,323682306,
+65536,323747842,65536,323813378,65536,2097154,65536,246939650,65536,247529474,65536,247595010,65536,323878914,65536,323944450,65536,261816322,65536,324009984,65536,324075520,65536,3276800,65536,324141063,65536,324207673,65536,324273007,65536,72482823,2147483648,72548359,0,260308994,0,164626434,0,261881858,
+0,261947394,0,2097156,0,174129159,0,115081216,0,262012928,0,262078464,0,262144000,0,131072,0,262209543,0,165282063,0,2097156,2147549184,262276048,2228224,65536,2097156,2147549184,262341585,2228224,65536,2097156,2147549184,262407122,2228224,65536,114819072,2147483648,26214400,0,
+3605460,0,6,251920784,0,262078464,0,262471680,0,262537216,0,198311936,0,262602759,0,27,262668288,0,262733824,0,250216448,0,262799360,0,262864898,0,131072,0,262930458,0,99942411,0,262995968,0,263061504,0,263127050,0,263192580,0,
+263258116,0,263323652,0,263389188,0,263454722,0,263520258,0,263585794,0,1966082,0,2097154,0,263651330,0,243073026,0,263716864,0,121241600,0,113704964,0,263782402,0,34537472,0,41,262668288,2147549184,263848918,262733824,65536,250216448,65536,262799360,65536,
+262864898,65536,131072,65536,262930458,65536,99942411,65536,262995968,65536,263061504,65536,263127050,65536,263192580,65536,263258116,65536,263323652,65536,263389188,65536,263454722,65536,263520258,65536,263585794,65536,1966082,65536,2097154,65536,263651330,65536,243073026,65536,263716864,65536,121241600,65536,
+113704964,65536,263782402,65536,34537472,65536,1966082,2147549184,263913582,22937600,65536,28639236,65536,263979010,2147483648,1441792,0,322371588,2147549184,28115053,322437123,65536,322502659,65536,322568193,65536,322633729,65536,322699265,65536,264044546,2147483648,264110082,0,6356992,0,8,1835993,0,1901529,
+0,264175616,0,29097984,0,131923979,2147549184,264241174,131989515,65536,131923979,2147549184,264306710,131989515,65536,28,1835078,0,1900614,0,131923979,2147549184,15597590,131989515,65536,15663104,2147483648,15728640,0,15794176,0,264175616,0,33292288,0,28442626,0,246415364,0,264373206,
+0,264438743,0,5308427,0,264504283,0,264568854,0,264634390,0,131923979,2147549184,264699926,131989515,65536,264766428,2147483648,264831855,0,264897391,0,244909021,0,264962050,0,265027586,0,265093122,0,265158658,0,3605470,0,2,2097156,0,265224199,0,98,
+1835078,0,1900614,0,131923979,2147549184,15597590,131989515,65536,15663104,2147483648,15728640,0,15794176,0,265289874,0,114622706,2147549184,46334099,114688004,65536,100663300,65536,19595268,65536,18022404,65536,114753536,65536,114819072,65536,114884610,65536,114950148,65536,115015682,65536,115081218,65536,
+26017794,65536,2097154,65536,59047940,2147549184,265355432,59113476,65536,59179012,65536,59244548,65536,59310084,65536,59375620,65536,59441156,65536,59506692,65536,31457287,65536,59572231,65536,59637767,65536,59703303,65536,59768839,65536,13631492,2147614720,265355432,59834535,58458116,131072,58523655,131072,58589191,
+131072,58654727,131072,58720263,131072,58785799,131072,58851335,131072,58916871,131072,16121858,131072,2097154,131072,31195140,131072,58982407,131072,59899911,2147549184,265355432,59965447,65536,60030983,65536,60096519,65536,60162055,65536,13631492,2147549184,265420967,58458116,65536,58523655,65536,58589191,65536,58654727,
+65536,58720263,65536,58785799,65536,58851335,65536,58916871,65536,16121858,65536,2097154,65536,31195140,65536,58982407,65536,165282063,2147483648,262209543,0,72482823,0,72548359,0,174129159,0,265486343,0,265551879,0,16121856,0,16187392,0,265617408,0,265682944,0,265748480,
+0,265814016,0,265879552,0,261816320,0,262144000,0,265945088,0,16384000,0,2097156,0,266010631,0,266076167,0,266141703,0,266207239,0,266272772,0,266338308,0,251920784,2147549184,266404821,262078464,65536,262471680,65536,262537216,65536,198311936,65536,262602759,65536,
+2097156,2147549184,266470367,265224199,65536,27,1835078,0,1900614,0,131923979,2147549184,15597590,131989515,65536,15663104,2147483648,15728640,0,15794176,0,266535065,0,249757700,0,249888772,0,14876672,0,27787266,0,266600450,0,266665988,0,266731520,0,266797056,0,266862592,
+0,266928128,0,266993664,0,267059200,0,267124736,0,73924608,0,267190272,0,267255808,0,267321346,0,114491392,0,3605474,0,32,1835019,2147549184,4980762,1900555,65536,3801114,65536,3866655,65536,3932192,65536,3997696,65536,2097154,65536,2621444,65536,4063236,
+65536,4128772,65536,4194308,65536,4259844,65536,4325380,65536,4390916,65536,3735552,2147614720,4980762,4456478,4522008,2147549184,4980762,4587544,65536,4653067,65536,4718620,65536,4784154,65536,4849675,65536,4915233,65536,3604514,65536,267386891,2147483648,267452427,0,267517963,0,267583499,0,
+267649035,0,27787268,0,267714564,0,267780096,0,267845632,0,12,1835078,0,1900614,0,131923979,2147549184,15597590,131989515,65536,15663104,2147483648,15728640,0,15794176,0,97190883,0,27787266,0,267911170,0,14876672,0,267976715,0,8,1836005,0,1901541,
+0,122552664,0,327684,2147549184,268042815,131072,2147483648,170721287,0,268107776,0,268173312,0,2,2097156,0,268238852,0,73,1835078,0,1900614,0,131923979,2147549184,15597590,131989515,65536,15663104,2147483648,15728640,0,15794176,0,66650119,2147614720,15859783,61145170,58851335,
+131072,66715655,131072,58916871,131072,66650119,2147614720,15859783,57737298,58851335,131072,66715655,131072,58916871,131072,66650116,2147614720,15859783,323093382,58851332,131072,66715652,131072,58916868,131072,66650116,2147614720,15859783,323158918,58851332,131072,66715652,131072,58916868,131072,66650116,2147614720,15859783,323224454,58851332,
+131072,66715652,131072,58916868,131072,323289095,2147549184,15859783,323354631,65536,323420167,65536,323485703,65536,323551234,65536,323616770,65536,323682306,65536,323747842,65536,323813378,65536,2097154,65536,246939650,65536,247529474,65536,247595010,65536,323878914,65536,323944450,65536,261816322,65536,324009984,65536,
+324075520,65536,3276800,65536,324141063,65536,324207673,65536,324273007,65536,20185114,2147483648,117768218,0,2097154,0,268304384,0,121241600,0,72482823,0,72548359,0,174129159,0,131923979,2147549184,268369942,131989515,65536,268435800,2147483648,122552664,0,268500992,0,268566532,0,268632066,
+0,268697600,0,268763136,0,268829016,0,165282063,0,262144000,0,26214400,0,2097156,2147549184,266470374,268238852,65536,3605480,2147483648,7,1836009,0,1901545,0,268894212,0,2359300,0,268959744,0,241434628,0,1966084,0,17,1835078,0,1900614,0,
+131923979,2147549184,15597590,131989515,65536,15663104,2147483648,15728640,0,15794176,0,131923979,2147549184,269025302,131989515,65536,131923979,2147549184,269090838,131989515,65536,269156352,2147483648,269221888,0,266600452,0,269287428,0,269352964,0,269418500,0,11,1835078,0,1900614,0,131923979,2147549184,
+15597590,131989515,65536,15663104,2147483648,15728640,0,15794176,0,17039360,0,269484032,0,269549568,0,3605484,0,2,2097156,0,2228224,0,62,1835078,0,1900614,0,131923979,2147549184,15597590,131989515,65536,15663104,2147483648,15728640,0,15794176,0,262144000,0,
+7733248,0,72482823,0,72548359,0,269615111,0,269680647,0,174129159,0,114688004,2147549184,165019797,164626434,65536,164691970,65536,46399636,2147483648,59047938,2147549184,265355819,165543938,65536,165609476,65536,165675012,65536,165740548,65536,302186503,2147614720,265355819,165806636,302252039,131072,302317575,131072,
+302383111,131072,114688004,131072,2097156,131072,165872173,2147549184,265355819,165937709,65536,166002695,65536,166068226,65536,166133762,65536,166199300,65536,166265390,65536,166330924,65536,166395911,65536,2097156,2147483648,16121858,0,115081218,0,269746180,0,256638983,0,22740999,0,109576199,0,131072,
+0,269811719,0,269877255,0,269942788,0,270008322,0,34537472,0,261816324,0,99811328,0,262209543,0,251920784,2147549184,266404821,262078464,65536,262471680,65536,262537216,65536,198311936,65536,262602759,65536,2097156,2147549184,266470381,2228224,65536,7,1835078,0,1900614,0,
+131923979,2147549184,15597590,131989515,65536,15663104,2147483648,15728640,0,15794176,0,7,1835078,0,1900614,0,131923979,2147549184,15597590,131989515,65536,15663104,2147483648,15728640,0,15794176,0,1,262144,0,8,20186097,0,29163521,0,17170432,0,2097156,0,71237639,
+0,244776964,0,270073856,0,3605491,0,1,270139396,0,1,1966084,0,1,196608,0,4,270205942,0,270270468,0,270336012,0,1179648,0,22,1966084,2147549184,459765,2228224,2147483648,131923979,2147614720,270402553,170655766,131989515,131072,270467076,2147483648,34930688,
+0,270205942,2147549184,270533623,270270468,65536,270336012,65536,1179648,65536,270599156,2147483648,270663684,0,270729217,0,167313409,0,270794753,0,270860289,0,270205942,2147549184,270926839,270270468,65536,270336012,65536,1179648,65536,14876672,2147483648,270991364,0,6,20186101,0,271057906,0,
+271122436,0,2097156,0,244776964,0,271187972,0,40,1835078,0,1900614,0,131923979,2147549184,15597590,131989515,65536,15663104,2147483648,15728640,0,15794176,0,271254522,0,271319044,0,7733248,0,246153217,0,131923979,2147549184,271384598,131989515,65536,1966084,2147614720,271451128,
+459765,2228224,2147549184,271451128,131923979,2147680256,271451128,270402553,170655766,131989515,196608,270467076,2147549184,271451128,34930688,65536,270205942,2147614720,271451128,270533623,270270468,131072,270336012,131072,1179648,131072,270599156,2147549184,271451128,270663684,65536,270729217,65536,167313409,65536,270794753,65536,270860289,65536,270205942,
+2147614720,271451128,270926839,270270468,131072,270336012,131072,1179648,131072,14876672,2147549184,271451128,270991364,65536,2097156,2147483648,271515652,0,271581188,0,6356992,0,3605500,0,16,1836029,0,1901565,0,271646720,0,2555905,0,2097153,0,15794176,0,271712260,0,271777796,
+0,271843332,0,271908864,0,271974407,0,143654919,0,272039943,0,272105479,0,272171015,0,14876672,0,37,1835019,2147549184,4980762,1900555,65536,3801114,65536,3866655,65536,3932192,65536,3997696,65536,2097154,65536,2621444,65536,4063236,65536,4128772,65536,4194308,
+65536,4259844,65536,4325380,65536,4390916,65536,3735552,2147614720,4980762,4456478,4522008,2147549184,4980762,4587544,65536,4653067,65536,4718620,65536,4784154,65536,4849675,65536,4915233,65536,3604514,65536,24576098,2147483648,252379734,0,272236551,0,272302087,0,272367623,0,272433159,0,
+259915783,0,272498695,0,272564231,0,272629767,0,30932999,0,31326215,0,2097154,0,16384000,0,6,1836031,0,1901567,0,268959744,0,272695296,0,2359300,0,2228224,0,35,1835019,2147549184,4980762,1900555,65536,3801114,65536,3866655,65536,3932192,
+65536,3997696,65536,2097154,65536,2621444,65536,4063236,65536,4128772,65536,4194308,65536,4259844,65536,4325380,65536,4390916,65536,3735552,2147614720,4980762,4456478,4522008,2147549184,4980762,4587544,65536,4653067,65536,4718620,65536,4784154,65536,4849675,65536,4915233,65536,3604514,65536,
+4653067,2147483648,262144,0,272760843,0,27787268,0,2228224,0,131923979,2147549184,103022614,131989515,65536,272827391,2147483648,272892927,0,272957444,0,273022980,0,273088520,0,39,273154050,0,273219586,0,273285122,0,34537472,0,105709619,0,125567207,0,151715840,0,
+273350656,0,273416192,0,273481728,0,185532416,0,273547264,0,273612800,0,273678338,0,273743879,0,9633799,0,273809415,0,273874951,0,60817415,0,60882951,0,60948487,0,273940487,0,274006023,0,274071559,0,274137095,0,274202631,0,274268167,0,
+206307335,0,205651975,0,274333703,0,274399239,0,274464775,0,274530311,0,274595847,0,274661383,0,274726919,0,274792455,0,274857991,0,274923527,0,1,132055050,0,90,1835019,2147549184,4980762,1900555,65536,3801114,65536,3866655,65536,3932192,65536,3997696,
+65536,2097154,65536,2621444,65536,4063236,65536,4128772,65536,4194308,65536,4259844,65536,4325380,65536,4390916,65536,3735552,2147614720,4980762,4456478,4522008,2147549184,4980762,4587544,65536,4653067,65536,4718620,65536,4784154,65536,4849675,65536,4915233,65536,3604514,65536,24576098,2147483648,
+99942411,0,166526983,0,166592519,0,258080775,0,172359687,0,172294151,0,274989063,0,275054599,0,275120135,0,275185671,0,275251207,0,275316743,0,275382279,0,275447815,0,275513351,0,275578887,0,275644423,0,275709959,0,275775495,0,275841031,0,
+275906567,0,275972103,0,276037634,0,276103170,0,276168706,0,276234242,0,276299778,0,276365314,0,276430850,0,2097154,0,1966082,0,80674818,0,276496391,0,276561927,0,276627463,0,276692999,0,276758530,0,276824066,0,21626882,0,56033282,0,
+2359300,0,100663300,0,19595268,0,18022404,0,276889607,0,81657863,0,114622706,2147549184,46334099,114688004,65536,100663300,65536,19595268,65536,18022404,65536,114753536,65536,114819072,65536,114884610,65536,114950148,65536,115015682,65536,115081218,65536,26017794,65536,2097154,65536,122552664,
+2147483648,46268562,0,93323398,0,15073317,0,121700352,0,29097984,0,132055050,2147549184,12190720,13,9568263,0,108265479,0,9633799,0,2097156,0,273350656,0,273416192,0,273481728,0,185532416,0,1966084,0,124649479,0,276955143,0,277020679,0,29622323,
+0,206,61145090,2147549184,277086342,57737218,65536,61210624,65536,61276160,65536,21823488,65536,61341696,65536,60817415,2147614720,277086342,61407404,60882951,131072,60948487,131072,61014023,131072,61079559,131072,57737220,131072,60817415,131073,60882951,131073,60948487,131073,61014023,131073,61079559,131073,57737220,
+131073,60817415,131074,60882951,131074,60948487,131074,61014023,131074,61079559,131074,57737220,131074,60817415,131075,60882951,131075,60948487,131075,61014023,131075,61079559,131075,57737220,131075,60817415,131076,60882951,131076,60948487,131076,61014023,131076,61079559,131076,57737220,131076,60817415,131077,60882951,
+131077,60948487,131077,61014023,131077,61079559,131077,57737220,131077,60817415,131078,60882951,131078,60948487,131078,61014023,131078,61079559,131078,57737220,131078,60817415,131079,60882951,131079,60948487,131079,61014023,131079,61079559,131079,57737220,131079,60817415,131080,60882951,131080,60948487,131080,61014023,
+131080,61079559,131080,57737220,131080,60817415,131081,60882951,131081,60948487,131081,61014023,131081,61079559,131081,57737220,131081,60817415,131082,60882951,131082,60948487,131082,61014023,131082,61079559,131082,57737220,131082,60817415,131083,60882951,131083,60948487,131083,61014023,131083,61079559,131083,57737220,
+131083,60817415,131084,60882951,131084,60948487,131084,61014023,131084,61079559,131084,57737220,131084,60817415,131085,60882951,131085,60948487,131085,61014023,131085,61079559,131085,57737220,131085,60817415,131086,60882951,131086,60948487,131086,61014023,131086,61079559,131086,57737220,131086,60817415,131087,60882951,
+131087,60948487,131087,61014023,131087,61079559,131087,57737220,131087,60817415,131088,60882951,131088,60948487,131088,61014023,131088,61079559,131088,57737220,131088,60817415,131089,60882951,131089,60948487,131089,61014023,131089,61079559,131089,57737220,131089,60817415,131090,60882951,131090,60948487,131090,61014023,
+131090,61079559,131090,57737220,131090,60817415,131091,60882951,131091,60948487,131091,61014023,131091,61079559,131091,57737220,131091,60817415,131092,60882951,131092,60948487,131092,61014023,131092,61079559,131092,57737220,131092,60817415,131093,60882951,131093,60948487,131093,61014023,131093,61079559,131093,57737220,
+131093,60817415,131094,60882951,131094,60948487,131094,61014023,131094,61079559,131094,57737220,131094,60817415,131095,60882951,131095,60948487,131095,61014023,131095,61079559,131095,57737220,131095,60817415,131096,60882951,131096,60948487,131096,61014023,131096,61079559,131096,57737220,131096,60817415,131097,60882951,
+131097,60948487,131097,61014023,131097,61079559,131097,57737220,131097,60817415,131098,60882951,131098,60948487,131098,61014023,131098,61079559,131098,57737220,131098,60817415,131099,60882951,131099,60948487,131099,61014023,131099,61079559,131099,57737220,131099,60817415,131100,60882951,131100,60948487,131100,61014023,
+131100,61079559,131100,57737220,131100,60817415,131101,60882951,131101,60948487,131101,61014023,131101,61079559,131101,57737220,131101,60817415,131102,60882951,131102,60948487,131102,61014023,131102,61079559,131102,57737220,131102,60817415,131103,60882951,131103,60948487,131103,61014023,131103,61079559,131103,57737220,
+131103,258080775,2147483648,172359687,0,172294151,0,2097156,0,277151751,0,262602759,0,186515460,0,131072,0,12,277217282,0,22937600,0,277282823,0,277348354,0,277413890,0,277479426,0,277544962,0,277610498,0,2686976,0,277676039,0,277741575,0,
+277807108,0,62,1836034,0,1901570,0,2162688,0,277217282,2147549184,277873665,22937600,65536,277282823,65536,277348354,65536,277413890,65536,277479426,65536,277544962,65536,277610498,65536,2686976,65536,277676039,65536,277741575,65536,277807108,65536,277217282,2147549184,277939201,22937600,65536,277282823,
+65536,277348354,65536,277413890,65536,277479426,65536,277544962,65536,277610498,65536,2686976,65536,277676039,65536,277741575,65536,277807108,65536,277217282,2147549184,278004737,22937600,65536,277282823,65536,277348354,65536,277413890,65536,277479426,65536,277544962,65536,277610498,65536,2686976,65536,277676039,65536,
+277741575,65536,277807108,65536,277217282,2147549184,278070273,22937600,65536,277282823,65536,277348354,65536,277413890,65536,277479426,65536,277544962,65536,277610498,65536,2686976,65536,277676039,65536,277741575,65536,277807108,65536,278134791,2147483648,278200322,0,278265858,0,278331394,0,278396930,0,278462466,
+0,278528002,0,278593538,0,278659074,0,278724610,0,2686976,0,2,278790144,0,278855680,0,4,278790144,0,278921216,0,278986752,0,2228224,0,4,278790144,0,278921216,0,279052288,0,279117824,0,2,278790144,0,279183360,0,12,
+278790144,2147549184,279249923,278855680,65536,278790144,2147549184,13632516,278921216,65536,278986752,65536,2228224,65536,278790144,2147549184,244057093,278921216,65536,279052288,65536,279117824,65536,278790144,2147549184,279315462,279183360,65536,24,279379968,0,279445504,0,279511040,0,279576576,0,279642112,0,279707648,
+0,279773184,0,279838720,0,279904256,0,279969792,0,280035328,0,280100864,0,280166400,0,280231936,0,280297472,0,280363008,0,280428544,0,280494080,0,280559616,0,280625152,0,280690688,0,280756224,0,280821760,0,2228224,0,14,280887296,0,
+280952832,0,281018368,0,281083904,0,281149440,0,281214976,0,281280512,0,281346048,0,281411584,0,281477120,0,281542656,0,281608192,0,281673728,0,17170432,0,39,279379968,2147549184,281740296,279445504,65536,279511040,65536,279576576,65536,279642112,65536,279707648,65536,
+279773184,65536,279838720,65536,279904256,65536,279969792,65536,280035328,65536,280100864,65536,280166400,65536,280231936,65536,280297472,65536,280363008,65536,280428544,65536,280494080,65536,280559616,65536,280625152,65536,280690688,65536,280756224,65536,280821760,65536,2228224,65536,280887296,2147549184,14550025,280952832,
+65536,281018368,65536,281083904,65536,281149440,65536,281214976,65536,281280512,65536,281346048,65536,281411584,65536,281477120,65536,281542656,65536,281608192,65536,281673728,65536,17170432,65536,2228224,2147483648,12,281804800,0,281870336,0,281935872,0,282001408,0,282066944,0,278921216,0,
+282132480,0,282198016,0,17170432,0,282263554,0,282329090,0,282394631,0,16,282460160,0,282525696,0,282591232,0,282656768,0,282722304,0,282787840,0,282853376,0,282918912,0,282984448,0,283049984,0,283115520,0,283181056,0,283246592,0,283312128,
+0,36962311,0,2228224,0,309,281804800,2147549184,283378699,281870336,65536,281935872,65536,282001408,65536,282066944,65536,278921216,65536,282132480,65536,282198016,65536,17170432,65536,282263554,65536,282329090,65536,282394631,65536,281804800,2147549184,283444235,281870336,65536,281935872,65536,282001408,65536,
+282066944,65536,278921216,65536,282132480,65536,282198016,65536,17170432,65536,282263554,65536,282329090,65536,282394631,65536,281804800,2147549184,283509771,281870336,65536,281935872,65536,282001408,65536,282066944,65536,278921216,65536,282132480,65536,282198016,65536,17170432,65536,282263554,65536,282329090,65536,282394631,
+65536,281804800,2147549184,283575307,281870336,65536,281935872,65536,282001408,65536,282066944,65536,278921216,65536,282132480,65536,282198016,65536,17170432,65536,282263554,65536,282329090,65536,282394631,65536,281804800,2147549184,283640843,281870336,65536,281935872,65536,282001408,65536,282066944,65536,278921216,65536,282132480,
+65536,282198016,65536,17170432,65536,282263554,65536,282329090,65536,282394631,65536,281804800,2147549184,283706379,281870336,65536,281935872,65536,282001408,65536,282066944,65536,278921216,65536,282132480,65536,282198016,65536,17170432,65536,282263554,65536,282329090,65536,282394631,65536,281804800,2147549184,283771915,281870336,
+65536,281935872,65536,282001408,65536,282066944,65536,278921216,65536,282132480,65536,282198016,65536,17170432,65536,282263554,65536,282329090,65536,282394631,65536,281804800,2147549184,283837451,281870336,65536,281935872,65536,282001408,65536,282066944,65536,278921216,65536,282132480,65536,282198016,65536,17170432,65536,
+282263554,65536,282329090,65536,282394631,65536,281804800,2147549184,283902987,281870336,65536,281935872,65536,282001408,65536,282066944,65536,278921216,65536,282132480,65536,282198016,65536,17170432,65536,282263554,65536,282329090,65536,282394631,65536,281804800,2147549184,283968523,281870336,65536,281935872,65536,282001408,65536,
+282066944,65536,278921216,65536,282132480,65536,282198016,65536,17170432,65536,282263554,65536,282329090,65536,282394631,65536,281804800,2147549184,284034059,281870336,65536,281935872,65536,282001408,65536,282066944,65536,278921216,65536,282132480,65536,282198016,65536,17170432,65536,282263554,65536,282329090,65536,282394631,
+65536,281804800,2147549184,284099595,281870336,65536,281935872,65536,282001408,65536,282066944,65536,278921216,65536,282132480,65536,282198016,65536,17170432,65536,282263554,65536,282329090,65536,282394631,65536,281804800,2147549184,284165131,281870336,65536,281935872,65536,282001408,65536,282066944,65536,278921216,65536,282132480,
+65536,282198016,65536,17170432,65536,282263554,65536,282329090,65536,282394631,65536,281804800,2147549184,284230667,281870336,65536,281935872,65536,282001408,65536,282066944,65536,278921216,65536,282132480,65536,282198016,65536,17170432,65536,282263554,65536,282329090,65536,282394631,65536,281804800,2147549184,284296203,281870336,
+65536,281935872,65536,282001408,65536,282066944,65536,278921216,65536,282132480,65536,282198016,65536,17170432,65536,282263554,65536,282329090,65536,282394631,65536,281804800,2147549184,284361739,281870336,65536,281935872,65536,282001408,65536,282066944,65536,278921216,65536,282132480,65536,282198016,65536,17170432,65536,
+282263554,65536,282329090,65536,282394631,65536,281804800,2147549184,284427275,281870336,65536,281935872,65536,282001408,65536,282066944,65536,278921216,65536,282132480,65536,282198016,65536,17170432,65536,282263554,65536,282329090,65536,282394631,65536,281804800,2147549184,284492811,281870336,65536,281935872,65536,282001408,65536,
+282066944,65536,278921216,65536,282132480,65536,282198016,65536,17170432,65536,282263554,65536,282329090,65536,282394631,65536,281804800,2147549184,284558347,281870336,65536,281935872,65536,282001408,65536,282066944,65536,278921216,65536,282132480,65536,282198016,65536,17170432,65536,282263554,65536,282329090,65536,282394631,
+65536,281804800,2147549184,284623883,281870336,65536,281935872,65536,282001408,65536,282066944,65536,278921216,65536,282132480,65536,282198016,65536,17170432,65536,282263554,65536,282329090,65536,282394631,65536,281804800,2147549184,284689419,281870336,65536,281935872,65536,282001408,65536,282066944,65536,278921216,65536,282132480,
+65536,282198016,65536,17170432,65536,282263554,65536,282329090,65536,282394631,65536,282460160,2147549184,284754956,282525696,65536,282591232,65536,282656768,65536,282722304,65536,282787840,65536,282853376,65536,282918912,65536,282984448,65536,283049984,65536,283115520,65536,283181056,65536,283246592,65536,283312128,65536,
+36962311,65536,2228224,65536,284819456,2147483648,284884999,0,284950530,0,285016064,0,285081600,0,285147136,0,285212672,0,285278208,0,285343744,0,285409280,0,285474823,0,285540359,0,285605888,0,285671424,0,285736960,0,285802496,0,285868032,0,285933568,0,
+285999104,0,286064640,0,286130176,0,286195712,0,286261248,0,286326784,0,286392320,0,286457856,0,286523392,0,286588928,0,286654464,0,286720000,0,286785536,0,34930688,0,286851079,0,286916615,0,286982144,0,287047680,0,287113216,0,287178752,0,
+287244288,0,287309824,0,287375360,0,185,278790144,0,287440896,0,287506432,0,17170432,0,287571968,0,278921216,0,287637504,0,287703040,0,287768576,0,287834112,0,287899648,0,287965184,0,288030720,0,288096256,0,288161792,0,288227328,0,89194496,
+0,288292864,0,288358400,0,288423936,0,288489472,0,288555008,0,288620544,0,288686080,0,288751616,0,288817152,0,288882688,0,288948224,0,289013760,0,289079296,0,289144832,0,289210368,0,289275904,0,289341440,0,289406976,0,289472512,0,289538048,
+0,289603584,0,289669120,0,289734656,0,289800192,0,289865728,0,289931264,0,289996800,0,290062336,0,290127872,0,290193408,0,290258944,0,290324480,0,290390016,0,290455552,0,290521088,0,290586624,0,290652160,0,290717696,0,290783232,0,290848768,
+0,290914304,0,290979840,0,291045376,0,291110912,0,291176448,0,291241984,0,291307520,0,291373056,0,291438592,0,291504128,0,291569664,0,291635200,0,291700736,0,96600064,0,291766272,0,291831808,0,291897344,0,291962880,0,292028416,0,292093952,
+0,292159488,0,292225024,0,257097728,0,292290560,0,292356096,0,292421632,0,292487168,0,34537472,0,292552711,0,292618240,0,292683776,0,292749312,0,292814848,0,292880384,0,292945920,0,293011456,0,293076992,0,293142528,0,293208064,0,293273600,
+0,293339136,0,293404672,0,293470208,0,293535744,0,293601280,0,293666816,0,293732352,0,293797888,0,293863424,0,293928960,0,293994496,0,294060032,0,294125568,0,294191104,0,294256640,0,294322176,0,294387712,0,294453248,0,294518784,0,294584320,
+0,294649856,0,294715392,0,294780928,0,294846464,0,294912000,0,294977536,0,295043072,0,295108615,0,295174144,0,198311936,0,295239680,0,295305216,0,295370752,0,295436288,0,295501824,0,295567360,0,295632896,0,295698432,0,295763968,0,295829504,
+0,295895040,0,295960576,0,296026112,0,296091648,0,22937600,0,296157184,0,296222720,0,296288256,0,296353792,0,296419328,0,296484864,0,296550400,0,296615936,0,296681472,0,296747008,0,296812544,0,296878080,0,296943616,0,297009152,0,297074688,
+0,297140224,0,297205760,0,297271296,0,297336832,0,297402368,0,297467904,0,297533440,0,297598976,0,297664512,0,297730048,0,297795584,0,297861120,0,297926656,0,297992192,0,298057728,0,298123264,0,298188800,0,298254336,0,298319872,0,298385408,
+0,298450944,0,298516480,0,298582016,0,298647552,0,298713088,0,298778624,0,298844160,0,298909696,0,5,298975232,0,288489472,0,288817152,0,2097154,0,2686976,0,1,98172928,0,1,98172928,0,3812,1836049,0,1901585,0,2162688,
+0,44892160,0,281804800,2147614720,299041805,283378699,281870336,131072,281935872,131072,282001408,131072,282066944,131072,278921216,131072,282132480,131072,282198016,131072,17170432,131072,282263554,131072,282329090,131072,282394631,131072,281804800,2147614720,299041805,283444235,281870336,131072,281935872,131072,282001408,131072,282066944,
+131072,278921216,131072,282132480,131072,282198016,131072,17170432,131072,282263554,131072,282329090,131072,282394631,131072,281804800,2147614720,299041805,283509771,281870336,131072,281935872,131072,282001408,131072,282066944,131072,278921216,131072,282132480,131072,282198016,131072,17170432,131072,282263554,131072,282329090,131072,282394631,
+131072,281804800,2147614720,299041805,283575307,281870336,131072,281935872,131072,282001408,131072,282066944,131072,278921216,131072,282132480,131072,282198016,131072,17170432,131072,282263554,131072,282329090,131072,282394631,131072,281804800,2147614720,299041805,283640843,281870336,131072,281935872,131072,282001408,131072,282066944,131072,278921216,
+131072,282132480,131072,282198016,131072,17170432,131072,282263554,131072,282329090,131072,282394631,131072,281804800,2147614720,299041805,283706379,281870336,131072,281935872,131072,282001408,131072,282066944,131072,278921216,131072,282132480,131072,282198016,131072,17170432,131072,282263554,131072,282329090,131072,282394631,131072,281804800,
+2147614720,299041805,283771915,281870336,131072,281935872,131072,282001408,131072,282066944,131072,278921216,131072,282132480,131072,282198016,131072,17170432,131072,282263554,131072,282329090,131072,282394631,131072,281804800,2147614720,299041805,283837451,281870336,131072,281935872,131072,282001408,131072,282066944,131072,278921216,131072,282132480,
+131072,282198016,131072,17170432,131072,282263554,131072,282329090,131072,282394631,131072,281804800,2147614720,299041805,283902987,281870336,131072,281935872,131072,282001408,131072,282066944,131072,278921216,131072,282132480,131072,282198016,131072,17170432,131072,282263554,131072,282329090,131072,282394631,131072,281804800,2147614720,299041805,
+283968523,281870336,131072,281935872,131072,282001408,131072,282066944,131072,278921216,131072,282132480,131072,282198016,131072,17170432,131072,282263554,131072,282329090,131072,282394631,131072,281804800,2147614720,299041805,284034059,281870336,131072,281935872,131072,282001408,131072,282066944,131072,278921216,131072,282132480,131072,282198016,
+131072,17170432,131072,282263554,131072,282329090,131072,282394631,131072,281804800,2147614720,299041805,284099595,281870336,131072,281935872,131072,282001408,131072,282066944,131072,278921216,131072,282132480,131072,282198016,131072,17170432,131072,282263554,131072,282329090,131072,282394631,131072,281804800,2147614720,299041805,284165131,281870336,
+131072,281935872,131072,282001408,131072,282066944,131072,278921216,131072,282132480,131072,282198016,131072,17170432,131072,282263554,131072,282329090,131072,282394631,131072,281804800,2147614720,299041805,284230667,281870336,131072,281935872,131072,282001408,131072,282066944,131072,278921216,131072,282132480,131072,282198016,131072,17170432,
+131072,282263554,131072,282329090,131072,282394631,131072,281804800,2147614720,299041805,284296203,281870336,131072,281935872,131072,282001408,131072,282066944,131072,278921216,131072,282132480,131072,282198016,131072,17170432,131072,282263554,131072,282329090,131072,282394631,131072,281804800,2147614720,299041805,284361739,281870336,131072,281935872,
+131072,282001408,131072,282066944,131072,278921216,131072,282132480,131072,282198016,131072,17170432,131072,282263554,131072,282329090,131072,282394631,131072,281804800,2147614720,299041805,284427275,281870336,131072,281935872,131072,282001408,131072,282066944,131072,278921216,131072,282132480,131072,282198016,131072,17170432,131072,282263554,
+131072,282329090,131072,282394631,131072,281804800,2147614720,299041805,284492811,281870336,131072,281935872,131072,282001408,131072,282066944,131072,278921216,131072,282132480,131072,282198016,131072,17170432,131072,282263554,131072,282329090,131072,282394631,131072,281804800,2147614720,299041805,284558347,281870336,131072,281935872,131072,282001408,
+131072,282066944,131072,278921216,131072,282132480,131072,282198016,131072,17170432,131072,282263554,131072,282329090,131072,282394631,131072,281804800,2147614720,299041805,284623883,281870336,131072,281935872,131072,282001408,131072,282066944,131072,278921216,131072,282132480,131072,282198016,131072,17170432,131072,282263554,131072,282329090,
+131072,282394631,131072,281804800,2147614720,299041805,284689419,281870336,131072,281935872,131072,282001408,131072,282066944,131072,278921216,131072,282132480,131072,282198016,131072,17170432,131072,282263554,131072,282329090,131072,282394631,131072,282460160,2147614720,299041805,284754956,282525696,131072,282591232,131072,282656768,131072,282722304,
+131072,282787840,131072,282853376,131072,282918912,131072,282984448,131072,283049984,131072,283115520,131072,283181056,131072,283246592,131072,283312128,131072,36962311,131072,2228224,131072,284819456,2147549184,299041805,284884999,65536,284950530,65536,285016064,65536,285081600,65536,285147136,65536,285212672,65536,285278208,65536,
+285343744,65536,285409280,65536,285474823,65536,285540359,65536,285605888,65536,285671424,65536,285736960,65536,285802496,65536,285868032,65536,285933568,65536,285999104,65536,286064640,65536,286130176,65536,286195712,65536,286261248,65536,286326784,65536,286392320,65536,286457856,65536,286523392,65536,286588928,65536,
+286654464,65536,286720000,65536,286785536,65536,34930688,65536,286851079,65536,286916615,65536,286982144,65536,287047680,65536,287113216,65536,287178752,65536,287244288,65536,287309824,65536,287375360,65536,278790144,2147614720,299107335,279249923,278855680,131072,278790144,2147614720,299107335,13632516,278921216,131072,278986752,131072,
+2228224,131072,278790144,2147614720,299107335,244057093,278921216,131072,279052288,131072,279117824,131072,278790144,2147614720,299107335,279315462,279183360,131072,279379968,2147614720,299172874,281740296,279445504,131072,279511040,131072,279576576,131072,279642112,131072,279707648,131072,279773184,131072,279838720,131072,279904256,131072,279969792,131072,
+280035328,131072,280100864,131072,280166400,131072,280231936,131072,280297472,131072,280363008,131072,280428544,131072,280494080,131072,280559616,131072,280625152,131072,280690688,131072,280756224,131072,280821760,131072,2228224,131072,280887296,2147614720,299172874,14550025,280952832,131072,281018368,131072,281083904,131072,281149440,131072,
+281214976,131072,281280512,131072,281346048,131072,281411584,131072,281477120,131072,281542656,131072,281608192,131072,281673728,131072,17170432,131072,2228224,2147549184,299172874,278790144,2147549184,299238414,287440896,65536,287506432,65536,17170432,65536,287571968,65536,278921216,65536,287637504,65536,287703040,65536,287768576,65536,
+287834112,65536,287899648,65536,287965184,65536,288030720,65536,288096256,65536,288161792,65536,288227328,65536,89194496,65536,288292864,65536,288358400,65536,288423936,65536,288489472,65536,288555008,65536,288620544,65536,288686080,65536,288751616,65536,288817152,65536,288882688,65536,288948224,65536,289013760,65536,
+289079296,65536,289144832,65536,289210368,65536,289275904,65536,289341440,65536,289406976,65536,289472512,65536,289538048,65536,289603584,65536,289669120,65536,289734656,65536,289800192,65536,289865728,65536,289931264,65536,289996800,65536,290062336,65536,290127872,65536,290193408,65536,290258944,65536,290324480,65536,
+290390016,65536,290455552,65536,290521088,65536,290586624,65536,290652160,65536,290717696,65536,290783232,65536,290848768,65536,290914304,65536,290979840,65536,291045376,65536,291110912,65536,291176448,65536,291241984,65536,291307520,65536,291373056,65536,291438592,65536,291504128,65536,291569664,65536,291635200,65536,
+291700736,65536,96600064,65536,291766272,65536,291831808,65536,291897344,65536,291962880,65536,292028416,65536,292093952,65536,292159488,65536,292225024,65536,257097728,65536,292290560,65536,292356096,65536,292421632,65536,292487168,65536,34537472,65536,292552711,65536,292618240,65536,292683776,65536,292749312,65536,
+292814848,65536,292880384,65536,292945920,65536,293011456,65536,293076992,65536,293142528,65536,293208064,65536,293273600,65536,293339136,65536,293404672,65536,293470208,65536,293535744,65536,293601280,65536,293666816,65536,293732352,65536,293797888,65536,293863424,65536,293928960,65536,293994496,65536,294060032,65536,
+294125568,65536,294191104,65536,294256640,65536,294322176,65536,294387712,65536,294453248,65536,294518784,65536,294584320,65536,294649856,65536,294715392,65536,294780928,65536,294846464,65536,294912000,65536,294977536,65536,295043072,65536,295108615,65536,295174144,65536,198311936,65536,295239680,65536,295305216,65536,
+295370752,65536,295436288,65536,295501824,65536,295567360,65536,295632896,65536,295698432,65536,295763968,65536,295829504,65536,295895040,65536,295960576,65536,296026112,65536,296091648,65536,22937600,65536,296157184,65536,296222720,65536,296288256,65536,296353792,65536,296419328,65536,296484864,65536,296550400,65536,
+296615936,65536,296681472,65536,296747008,65536,296812544,65536,296878080,65536,296943616,65536,297009152,65536,297074688,65536,297140224,65536,297205760,65536,297271296,65536,297336832,65536,297402368,65536,297467904,65536,297533440,65536,297598976,65536,297664512,65536,297730048,65536,297795584,65536,297861120,65536,
+297926656,65536,297992192,65536,298057728,65536,298123264,65536,298188800,65536,298254336,65536,298319872,65536,298385408,65536,298450944,65536,298516480,65536,298582016,65536,298647552,65536,298713088,65536,298778624,65536,298844160,65536,298909696,65536,278790144,2147549184,299303950,287440896,65536,287506432,65536,17170432,
+65536,287571968,65536,278921216,65536,287637504,65536,287703040,65536,287768576,65536,287834112,65536,287899648,65536,287965184,65536,288030720,65536,288096256,65536,288161792,65536,288227328,65536,89194496,65536,288292864,65536,288358400,65536,288423936,65536,288489472,65536,288555008,65536,288620544,65536,288686080,
+65536,288751616,65536,288817152,65536,288882688,65536,288948224,65536,289013760,65536,289079296,65536,289144832,65536,289210368,65536,289275904,65536,289341440,65536,289406976,65536,289472512,65536,289538048,65536,289603584,65536,289669120,65536,289734656,65536,289800192,65536,289865728,65536,289931264,65536,289996800,
+65536,290062336,65536,290127872,65536,290193408,65536,290258944,65536,290324480,65536,290390016,65536,290455552,65536,290521088,65536,290586624,65536,290652160,65536,290717696,65536,290783232,65536,290848768,65536,290914304,65536,290979840,65536,291045376,65536,291110912,65536,291176448,65536,291241984,65536,291307520,
+65536,291373056,65536,291438592,65536,291504128,65536,291569664,65536,291635200,65536,291700736,65536,96600064,65536,291766272,65536,291831808,65536,291897344,65536,291962880,65536,292028416,65536,292093952,65536,292159488,65536,292225024,65536,257097728,65536,292290560,65536,292356096,65536,292421632,65536,292487168,
+65536,34537472,65536,292552711,65536,292618240,65536,292683776,65536,292749312,65536,292814848,65536,292880384,65536,292945920,65536,293011456,65536,293076992,65536,293142528,65536,293208064,65536,293273600,65536,293339136,65536,293404672,65536,293470208,65536,293535744,65536,293601280,65536,293666816,65536,293732352,
+65536,293797888,65536,293863424,65536,293928960,65536,293994496,65536,294060032,65536,294125568,65536,294191104,65536,294256640,65536,294322176,65536,294387712,65536,294453248,65536,294518784,65536,294584320,65536,294649856,65536,294715392,65536,294780928,65536,294846464,65536,294912000,65536,294977536,65536,295043072,
+65536,295108615,65536,295174144,65536,198311936,65536,295239680,65536,295305216,65536,295370752,65536,295436288,65536,295501824,65536,295567360,65536,295632896,65536,295698432,65536,295763968,65536,295829504,65536,295895040,65536,295960576,65536,296026112,65536,296091648,65536,22937600,65536,296157184,65536,296222720,
+65536,296288256,65536,296353792,65536,296419328,65536,296484864,65536,296550400,65536,296615936,65536,296681472,65536,296747008,65536,296812544,65536,296878080,65536,296943616,65536,297009152,65536,297074688,65536,297140224,65536,297205760,65536,297271296,65536,297336832,65536,297402368,65536,297467904,65536,297533440,
+65536,297598976,65536,297664512,65536,297730048,65536,297795584,65536,297861120,65536,297926656,65536,297992192,65536,298057728,65536,298123264,65536,298188800,65536,298254336,65536,298319872,65536,298385408,65536,298450944,65536,298516480,65536,298582016,65536,298647552,65536,298713088,65536,298778624,65536,298844160,
+65536,298909696,65536,278790144,2147549184,299369486,287440896,65536,287506432,65536,17170432,65536,287571968,65536,278921216,65536,287637504,65536,287703040,65536,287768576,65536,287834112,65536,287899648,65536,287965184,65536,288030720,65536,288096256,65536,288161792,65536,288227328,65536,89194496,65536,288292864,65536,
+288358400,65536,288423936,65536,288489472,65536,288555008,65536,288620544,65536,288686080,65536,288751616,65536,288817152,65536,288882688,65536,288948224,65536,289013760,65536,289079296,65536,289144832,65536,289210368,65536,289275904,65536,289341440,65536,289406976,65536,289472512,65536,289538048,65536,289603584,65536,
+289669120,65536,289734656,65536,289800192,65536,289865728,65536,289931264,65536,289996800,65536,290062336,65536,290127872,65536,290193408,65536,290258944,65536,290324480,65536,290390016,65536,290455552,65536,290521088,65536,290586624,65536,290652160,65536,290717696,65536,290783232,65536,290848768,65536,290914304,65536,
+290979840,65536,291045376,65536,291110912,65536,291176448,65536,291241984,65536,291307520,65536,291373056,65536,291438592,65536,291504128,65536,291569664,65536,291635200,65536,291700736,65536,96600064,65536,291766272,65536,291831808,65536,291897344,65536,291962880,65536,292028416,65536,292093952,65536,292159488,65536,
+292225024,65536,257097728,65536,292290560,65536,292356096,65536,292421632,65536,292487168,65536,34537472,65536,292552711,65536,292618240,65536,292683776,65536,292749312,65536,292814848,65536,292880384,65536,292945920,65536,293011456,65536,293076992,65536,293142528,65536,293208064,65536,293273600,65536,293339136,65536,
+293404672,65536,293470208,65536,293535744,65536,293601280,65536,293666816,65536,293732352,65536,293797888,65536,293863424,65536,293928960,65536,293994496,65536,294060032,65536,294125568,65536,294191104,65536,294256640,65536,294322176,65536,294387712,65536,294453248,65536,294518784,65536,294584320,65536,294649856,65536,
+294715392,65536,294780928,65536,294846464,65536,294912000,65536,294977536,65536,295043072,65536,295108615,65536,295174144,65536,198311936,65536,295239680,65536,295305216,65536,295370752,65536,295436288,65536,295501824,65536,295567360,65536,295632896,65536,295698432,65536,295763968,65536,295829504,65536,295895040,65536,
+295960576,65536,296026112,65536,296091648,65536,22937600,65536,296157184,65536,296222720,65536,296288256,65536,296353792,65536,296419328,65536,296484864,65536,296550400,65536,296615936,65536,296681472,65536,296747008,65536,296812544,65536,296878080,65536,296943616,65536,297009152,65536,297074688,65536,297140224,65536,
+297205760,65536,297271296,65536,297336832,65536,297402368,65536,297467904,65536,297533440,65536,297598976,65536,297664512,65536,297730048,65536,297795584,65536,297861120,65536,297926656,65536,297992192,65536,298057728,65536,298123264,65536,298188800,65536,298254336,65536,298319872,65536,298385408,65536,298450944,65536,
+298516480,65536,298582016,65536,298647552,65536,298713088,65536,298778624,65536,298844160,65536,298909696,65536,278790144,2147549184,299435022,287440896,65536,287506432,65536,17170432,65536,287571968,65536,278921216,65536,287637504,65536,287703040,65536,287768576,65536,287834112,65536,287899648,65536,287965184,65536,288030720,
+65536,288096256,65536,288161792,65536,288227328,65536,89194496,65536,288292864,65536,288358400,65536,288423936,65536,288489472,65536,288555008,65536,288620544,65536,288686080,65536,288751616,65536,288817152,65536,288882688,65536,288948224,65536,289013760,65536,289079296,65536,289144832,65536,289210368,65536,289275904,
+65536,289341440,65536,289406976,65536,289472512,65536,289538048,65536,289603584,65536,289669120,65536,289734656,65536,289800192,65536,289865728,65536,289931264,65536,289996800,65536,290062336,65536,290127872,65536,290193408,65536,290258944,65536,290324480,65536,290390016,65536,290455552,65536,290521088,65536,290586624,
+65536,290652160,65536,290717696,65536,290783232,65536,290848768,65536,290914304,65536,290979840,65536,291045376,65536,291110912,65536,291176448,65536,291241984,65536,291307520,65536,291373056,65536,291438592,65536,291504128,65536,291569664,65536,291635200,65536,291700736,65536,96600064,65536,291766272,65536,291831808,
+65536,291897344,65536,291962880,65536,292028416,65536,292093952,65536,292159488,65536,292225024,65536,257097728,65536,292290560,65536,292356096,65536,292421632,65536,292487168,65536,34537472,65536,292552711,65536,292618240,65536,292683776,65536,292749312,65536,292814848,65536,292880384,65536,292945920,65536,293011456,
+65536,293076992,65536,293142528,65536,293208064,65536,293273600,65536,293339136,65536,293404672,65536,293470208,65536,293535744,65536,293601280,65536,293666816,65536,293732352,65536,293797888,65536,293863424,65536,293928960,65536,293994496,65536,294060032,65536,294125568,65536,294191104,65536,294256640,65536,294322176,
+65536,294387712,65536,294453248,65536,294518784,65536,294584320,65536,294649856,65536,294715392,65536,294780928,65536,294846464,65536,294912000,65536,294977536,65536,295043072,65536,295108615,65536,295174144,65536,198311936,65536,295239680,65536,295305216,65536,295370752,65536,295436288,65536,295501824,65536,295567360,
+65536,295632896,65536,295698432,65536,295763968,65536,295829504,65536,295895040,65536,295960576,65536,296026112,65536,296091648,65536,22937600,65536,296157184,65536,296222720,65536,296288256,65536,296353792,65536,296419328,65536,296484864,65536,296550400,65536,296615936,65536,296681472,65536,296747008,65536,296812544,
+65536,296878080,65536,296943616,65536,297009152,65536,297074688,65536,297140224,65536,297205760,65536,297271296,65536,297336832,65536,297402368,65536,297467904,65536,297533440,65536,297598976,65536,297664512,65536,297730048,65536,297795584,65536,297861120,65536,297926656,65536,297992192,65536,298057728,65536,298123264,
+65536,298188800,65536,298254336,65536,298319872,65536,298385408,65536,298450944,65536,298516480,65536,298582016,65536,298647552,65536,298713088,65536,298778624,65536,298844160,65536,298909696,65536,278790144,2147549184,299500558,287440896,65536,287506432,65536,17170432,65536,287571968,65536,278921216,65536,287637504,65536,
+287703040,65536,287768576,65536,287834112,65536,287899648,65536,287965184,65536,288030720,65536,288096256,65536,288161792,65536,288227328,65536,89194496,65536,288292864,65536,288358400,65536,288423936,65536,288489472,65536,288555008,65536,288620544,65536,288686080,65536,288751616,65536,288817152,65536,288882688,65536,
+288948224,65536,289013760,65536,289079296,65536,289144832,65536,289210368,65536,289275904,65536,289341440,65536,289406976,65536,289472512,65536,289538048,65536,289603584,65536,289669120,65536,289734656,65536,289800192,65536,289865728,65536,289931264,65536,289996800,65536,290062336,65536,290127872,65536,290193408,65536,
+290258944,65536,290324480,65536,290390016,65536,290455552,65536,290521088,65536,290586624,65536,290652160,65536,290717696,65536,290783232,65536,290848768,65536,290914304,65536,290979840,65536,291045376,65536,291110912,65536,291176448,65536,291241984,65536,291307520,65536,291373056,65536,291438592,65536,291504128,65536,
+291569664,65536,291635200,65536,291700736,65536,96600064,65536,291766272,65536,291831808,65536,291897344,65536,291962880,65536,292028416,65536,292093952,65536,292159488,65536,292225024,65536,257097728,65536,292290560,65536,292356096,65536,292421632,65536,292487168,65536,34537472,65536,292552711,65536,292618240,65536,
+292683776,65536,292749312,65536,292814848,65536,292880384,65536,292945920,65536,293011456,65536,293076992,65536,293142528,65536,293208064,65536,293273600,65536,293339136,65536,293404672,65536,293470208,65536,293535744,65536,293601280,65536,293666816,65536,293732352,65536,293797888,65536,293863424,65536,293928960,65536,
+293994496,65536,294060032,65536,294125568,65536,294191104,65536,294256640,65536,294322176,65536,294387712,65536,294453248,65536,294518784,65536,294584320,65536,294649856,65536,294715392,65536,294780928,65536,294846464,65536,294912000,65536,294977536,65536,295043072,65536,295108615,65536,295174144,65536,198311936,65536,
+295239680,65536,295305216,65536,295370752,65536,295436288,65536,295501824,65536,295567360,65536,295632896,65536,295698432,65536,295763968,65536,295829504,65536,295895040,65536,295960576,65536,296026112,65536,296091648,65536,22937600,65536,296157184,65536,296222720,65536,296288256,65536,296353792,65536,296419328,65536,
+296484864,65536,296550400,65536,296615936,65536,296681472,65536,296747008,65536,296812544,65536,296878080,65536,296943616,65536,297009152,65536,297074688,65536,297140224,65536,297205760,65536,297271296,65536,297336832,65536,297402368,65536,297467904,65536,297533440,65536,297598976,65536,297664512,65536,297730048,65536,
+297795584,65536,297861120,65536,297926656,65536,297992192,65536,298057728,65536,298123264,65536,298188800,65536,298254336,65536,298319872,65536,298385408,65536,298450944,65536,298516480,65536,298582016,65536,298647552,65536,298713088,65536,298778624,65536,298844160,65536,298909696,65536,278790144,2147549184,299566094,287440896,
+65536,287506432,65536,17170432,65536,287571968,65536,278921216,65536,287637504,65536,287703040,65536,287768576,65536,287834112,65536,287899648,65536,287965184,65536,288030720,65536,288096256,65536,288161792,65536,288227328,65536,89194496,65536,288292864,65536,288358400,65536,288423936,65536,288489472,65536,288555008,
+65536,288620544,65536,288686080,65536,288751616,65536,288817152,65536,288882688,65536,288948224,65536,289013760,65536,289079296,65536,289144832,65536,289210368,65536,289275904,65536,289341440,65536,289406976,65536,289472512,65536,289538048,65536,289603584,65536,289669120,65536,289734656,65536,289800192,65536,289865728,
+65536,289931264,65536,289996800,65536,290062336,65536,290127872,65536,290193408,65536,290258944,65536,290324480,65536,290390016,65536,290455552,65536,290521088,65536,290586624,65536,290652160,65536,290717696,65536,290783232,65536,290848768,65536,290914304,65536,290979840,65536,291045376,65536,291110912,65536,291176448,
+65536,291241984,65536,291307520,65536,291373056,65536,291438592,65536,291504128,65536,291569664,65536,291635200,65536,291700736,65536,96600064,65536,291766272,65536,291831808,65536,291897344,65536,291962880,65536,292028416,65536,292093952,65536,292159488,65536,292225024,65536,257097728,65536,292290560,65536,292356096,
+65536,292421632,65536,292487168,65536,34537472,65536,292552711,65536,292618240,65536,292683776,65536,292749312,65536,292814848,65536,292880384,65536,292945920,65536,293011456,65536,293076992,65536,293142528,65536,293208064,65536,293273600,65536,293339136,65536,293404672,65536,293470208,65536,293535744,65536,293601280,
+65536,293666816,65536,293732352,65536,293797888,65536,293863424,65536,293928960,65536,293994496,65536,294060032,65536,294125568,65536,294191104,65536,294256640,65536,294322176,65536,294387712,65536,294453248,65536,294518784,65536,294584320,65536,294649856,65536,294715392,65536,294780928,65536,294846464,65536,294912000,
+65536,294977536,65536,295043072,65536,295108615,65536,295174144,65536,198311936,65536,295239680,65536,295305216,65536,295370752,65536,295436288,65536,295501824,65536,295567360,65536,295632896,65536,295698432,65536,295763968,65536,295829504,65536,295895040,65536,295960576,65536,296026112,65536,296091648,65536,22937600,
+65536,296157184,65536,296222720,65536,296288256,65536,296353792,65536,296419328,65536,296484864,65536,296550400,65536,296615936,65536,296681472,65536,296747008,65536,296812544,65536,296878080,65536,296943616,65536,297009152,65536,297074688,65536,297140224,65536,297205760,65536,297271296,65536,297336832,65536,297402368,
+65536,297467904,65536,297533440,65536,297598976,65536,297664512,65536,297730048,65536,297795584,65536,297861120,65536,297926656,65536,297992192,65536,298057728,65536,298123264,65536,298188800,65536,298254336,65536,298319872,65536,298385408,65536,298450944,65536,298516480,65536,298582016,65536,298647552,65536,298713088,
+65536,298778624,65536,298844160,65536,298909696,65536,278790144,2147549184,299631630,287440896,65536,287506432,65536,17170432,65536,287571968,65536,278921216,65536,287637504,65536,287703040,65536,287768576,65536,287834112,65536,287899648,65536,287965184,65536,288030720,65536,288096256,65536,288161792,65536,288227328,65536,
+89194496,65536,288292864,65536,288358400,65536,288423936,65536,288489472,65536,288555008,65536,288620544,65536,288686080,65536,288751616,65536,288817152,65536,288882688,65536,288948224,65536,289013760,65536,289079296,65536,289144832,65536,289210368,65536,289275904,65536,289341440,65536,289406976,65536,289472512,65536,
+289538048,65536,289603584,65536,289669120,65536,289734656,65536,289800192,65536,289865728,65536,289931264,65536,289996800,65536,290062336,65536,290127872,65536,290193408,65536,290258944,65536,290324480,65536,290390016,65536,290455552,65536,290521088,65536,290586624,65536,290652160,65536,290717696,65536,290783232,65536,
+290848768,65536,290914304,65536,290979840,65536,291045376,65536,291110912,65536,291176448,65536,291241984,65536,291307520,65536,291373056,65536,291438592,65536,291504128,65536,291569664,65536,291635200,65536,291700736,65536,96600064,65536,291766272,65536,291831808,65536,291897344,65536,291962880,65536,292028416,65536,
+292093952,65536,292159488,65536,292225024,65536,257097728,65536,292290560,65536,292356096,65536,292421632,65536,292487168,65536,34537472,65536,292552711,65536,292618240,65536,292683776,65536,292749312,65536,292814848,65536,292880384,65536,292945920,65536,293011456,65536,293076992,65536,293142528,65536,293208064,65536,
+293273600,65536,293339136,65536,293404672,65536,293470208,65536,293535744,65536,293601280,65536,293666816,65536,293732352,65536,293797888,65536,293863424,65536,293928960,65536,293994496,65536,294060032,65536,294125568,65536,294191104,65536,294256640,65536,294322176,65536,294387712,65536,294453248,65536,294518784,65536,
+294584320,65536,294649856,65536,294715392,65536,294780928,65536,294846464,65536,294912000,65536,294977536,65536,295043072,65536,295108615,65536,295174144,65536,198311936,65536,295239680,65536,295305216,65536,295370752,65536,295436288,65536,295501824,65536,295567360,65536,295632896,65536,295698432,65536,295763968,65536,
+295829504,65536,295895040,65536,295960576,65536,296026112,65536,296091648,65536,22937600,65536,296157184,65536,296222720,65536,296288256,65536,296353792,65536,296419328,65536,296484864,65536,296550400,65536,296615936,65536,296681472,65536,296747008,65536,296812544,65536,296878080,65536,296943616,65536,297009152,65536,
+297074688,65536,297140224,65536,297205760,65536,297271296,65536,297336832,65536,297402368,65536,297467904,65536,297533440,65536,297598976,65536,297664512,65536,297730048,65536,297795584,65536,297861120,65536,297926656,65536,297992192,65536,298057728,65536,298123264,65536,298188800,65536,298254336,65536,298319872,65536,
+298385408,65536,298450944,65536,298516480,65536,298582016,65536,298647552,65536,298713088,65536,298778624,65536,298844160,65536,298909696,65536,278790144,2147549184,299697166,287440896,65536,287506432,65536,17170432,65536,287571968,65536,278921216,65536,287637504,65536,287703040,65536,287768576,65536,287834112,65536,287899648,
+65536,287965184,65536,288030720,65536,288096256,65536,288161792,65536,288227328,65536,89194496,65536,288292864,65536,288358400,65536,288423936,65536,288489472,65536,288555008,65536,288620544,65536,288686080,65536,288751616,65536,288817152,65536,288882688,65536,288948224,65536,289013760,65536,289079296,65536,289144832,
+65536,289210368,65536,289275904,65536,289341440,65536,289406976,65536,289472512,65536,289538048,65536,289603584,65536,289669120,65536,289734656,65536,289800192,65536,289865728,65536,289931264,65536,289996800,65536,290062336,65536,290127872,65536,290193408,65536,290258944,65536,290324480,65536,290390016,65536,290455552,
+65536,290521088,65536,290586624,65536,290652160,65536,290717696,65536,290783232,65536,290848768,65536,290914304,65536,290979840,65536,291045376,65536,291110912,65536,291176448,65536,291241984,65536,291307520,65536,291373056,65536,291438592,65536,291504128,65536,291569664,65536,291635200,65536,291700736,65536,96600064,
+65536,291766272,65536,291831808,65536,291897344,65536,291962880,65536,292028416,65536,292093952,65536,292159488,65536,292225024,65536,257097728,65536,292290560,65536,292356096,65536,292421632,65536,292487168,65536,34537472,65536,292552711,65536,292618240,65536,292683776,65536,292749312,65536,292814848,65536,292880384,
+65536,292945920,65536,293011456,65536,293076992,65536,293142528,65536,293208064,65536,293273600,65536,293339136,65536,293404672,65536,293470208,65536,293535744,65536,293601280,65536,293666816,65536,293732352,65536,293797888,65536,293863424,65536,293928960,65536,293994496,65536,294060032,65536,294125568,65536,294191104,
+65536,294256640,65536,294322176,65536,294387712,65536,294453248,65536,294518784,65536,294584320,65536,294649856,65536,294715392,65536,294780928,65536,294846464,65536,294912000,65536,294977536,65536,295043072,65536,295108615,65536,295174144,65536,198311936,65536,295239680,65536,295305216,65536,295370752,65536,295436288,
+65536,295501824,65536,295567360,65536,295632896,65536,295698432,65536,295763968,65536,295829504,65536,295895040,65536,295960576,65536,296026112,65536,296091648,65536,22937600,65536,296157184,65536,296222720,65536,296288256,65536,296353792,65536,296419328,65536,296484864,65536,296550400,65536,296615936,65536,296681472,
+65536,296747008,65536,296812544,65536,296878080,65536,296943616,65536,297009152,65536,297074688,65536,297140224,65536,297205760,65536,297271296,65536,297336832,65536,297402368,65536,297467904,65536,297533440,65536,297598976,65536,297664512,65536,297730048,65536,297795584,65536,297861120,65536,297926656,65536,297992192,
+65536,298057728,65536,298123264,65536,298188800,65536,298254336,65536,298319872,65536,298385408,65536,298450944,65536,298516480,65536,298582016,65536,298647552,65536,298713088,65536,298778624,65536,298844160,65536,298909696,65536,278790144,2147549184,299762702,287440896,65536,287506432,65536,17170432,65536,287571968,65536,
+278921216,65536,287637504,65536,287703040,65536,287768576,65536,287834112,65536,287899648,65536,287965184,65536,288030720,65536,288096256,65536,288161792,65536,288227328,65536,89194496,65536,288292864,65536,288358400,65536,288423936,65536,288489472,65536,288555008,65536,288620544,65536,288686080,65536,288751616,65536,
+288817152,65536,288882688,65536,288948224,65536,289013760,65536,289079296,65536,289144832,65536,289210368,65536,289275904,65536,289341440,65536,289406976,65536,289472512,65536,289538048,65536,289603584,65536,289669120,65536,289734656,65536,289800192,65536,289865728,65536,289931264,65536,289996800,65536,290062336,65536,
+290127872,65536,290193408,65536,290258944,65536,290324480,65536,290390016,65536,290455552,65536,290521088,65536,290586624,65536,290652160,65536,290717696,65536,290783232,65536,290848768,65536,290914304,65536,290979840,65536,291045376,65536,291110912,65536,291176448,65536,291241984,65536,291307520,65536,291373056,65536,
+291438592,65536,291504128,65536,291569664,65536,291635200,65536,291700736,65536,96600064,65536,291766272,65536,291831808,65536,291897344,65536,291962880,65536,292028416,65536,292093952,65536,292159488,65536,292225024,65536,257097728,65536,292290560,65536,292356096,65536,292421632,65536,292487168,65536,34537472,65536,
+292552711,65536,292618240,65536,292683776,65536,292749312,65536,292814848,65536,292880384,65536,292945920,65536,293011456,65536,293076992,65536,293142528,65536,293208064,65536,293273600,65536,293339136,65536,293404672,65536,293470208,65536,293535744,65536,293601280,65536,293666816,65536,293732352,65536,293797888,65536,
+293863424,65536,293928960,65536,293994496,65536,294060032,65536,294125568,65536,294191104,65536,294256640,65536,294322176,65536,294387712,65536,294453248,65536,294518784,65536,294584320,65536,294649856,65536,294715392,65536,294780928,65536,294846464,65536,294912000,65536,294977536,65536,295043072,65536,295108615,65536,
+295174144,65536,198311936,65536,295239680,65536,295305216,65536,295370752,65536,295436288,65536,295501824,65536,295567360,65536,295632896,65536,295698432,65536,295763968,65536,295829504,65536,295895040,65536,295960576,65536,296026112,65536,296091648,65536,22937600,65536,296157184,65536,296222720,65536,296288256,65536,
+296353792,65536,296419328,65536,296484864,65536,296550400,65536,296615936,65536,296681472,65536,296747008,65536,296812544,65536,296878080,65536,296943616,65536,297009152,65536,297074688,65536,297140224,65536,297205760,65536,297271296,65536,297336832,65536,297402368,65536,297467904,65536,297533440,65536,297598976,65536,
+297664512,65536,297730048,65536,297795584,65536,297861120,65536,297926656,65536,297992192,65536,298057728,65536,298123264,65536,298188800,65536,298254336,65536,298319872,65536,298385408,65536,298450944,65536,298516480,65536,298582016,65536,298647552,65536,298713088,65536,298778624,65536,298844160,65536,298909696,65536,
+278790144,2147549184,299828238,287440896,65536,287506432,65536,17170432,65536,287571968,65536,278921216,65536,287637504,65536,287703040,65536,287768576,65536,287834112,65536,287899648,65536,287965184,65536,288030720,65536,288096256,65536,288161792,65536,288227328,65536,89194496,65536,288292864,65536,288358400,65536,288423936,
+65536,288489472,65536,288555008,65536,288620544,65536,288686080,65536,288751616,65536,288817152,65536,288882688,65536,288948224,65536,289013760,65536,289079296,65536,289144832,65536,289210368,65536,289275904,65536,289341440,65536,289406976,65536,289472512,65536,289538048,65536,289603584,65536,289669120,65536,289734656,
+65536,289800192,65536,289865728,65536,289931264,65536,289996800,65536,290062336,65536,290127872,65536,290193408,65536,290258944,65536,290324480,65536,290390016,65536,290455552,65536,290521088,65536,290586624,65536,290652160,65536,290717696,65536,290783232,65536,290848768,65536,290914304,65536,290979840,65536,291045376,
+65536,291110912,65536,291176448,65536,291241984,65536,291307520,65536,291373056,65536,291438592,65536,291504128,65536,291569664,65536,291635200,65536,291700736,65536,96600064,65536,291766272,65536,291831808,65536,291897344,65536,291962880,65536,292028416,65536,292093952,65536,292159488,65536,292225024,65536,257097728,
+65536,292290560,65536,292356096,65536,292421632,65536,292487168,65536,34537472,65536,292552711,65536,292618240,65536,292683776,65536,292749312,65536,292814848,65536,292880384,65536,292945920,65536,293011456,65536,293076992,65536,293142528,65536,293208064,65536,293273600,65536,293339136,65536,293404672,65536,293470208,
+65536,293535744,65536,293601280,65536,293666816,65536,293732352,65536,293797888,65536,293863424,65536,293928960,65536,293994496,65536,294060032,65536,294125568,65536,294191104,65536,294256640,65536,294322176,65536,294387712,65536,294453248,65536,294518784,65536,294584320,65536,294649856,65536,294715392,65536,294780928,
+65536,294846464,65536,294912000,65536,294977536,65536,295043072,65536,295108615,65536,295174144,65536,198311936,65536,295239680,65536,295305216,65536,295370752,65536,295436288,65536,295501824,65536,295567360,65536,295632896,65536,295698432,65536,295763968,65536,295829504,65536,295895040,65536,295960576,65536,296026112,
+65536,296091648,65536,22937600,65536,296157184,65536,296222720,65536,296288256,65536,296353792,65536,296419328,65536,296484864,65536,296550400,65536,296615936,65536,296681472,65536,296747008,65536,296812544,65536,296878080,65536,296943616,65536,297009152,65536,297074688,65536,297140224,65536,297205760,65536,297271296,
+65536,297336832,65536,297402368,65536,297467904,65536,297533440,65536,297598976,65536,297664512,65536,297730048,65536,297795584,65536,297861120,65536,297926656,65536,297992192,65536,298057728,65536,298123264,65536,298188800,65536,298254336,65536,298319872,65536,298385408,65536,298450944,65536,298516480,65536,298582016,
+65536,298647552,65536,298713088,65536,298778624,65536,298844160,65536,298909696,65536,278790144,2147549184,299893774,287440896,65536,287506432,65536,17170432,65536,287571968,65536,278921216,65536,287637504,65536,287703040,65536,287768576,65536,287834112,65536,287899648,65536,287965184,65536,288030720,65536,288096256,65536,
+288161792,65536,288227328,65536,89194496,65536,288292864,65536,288358400,65536,288423936,65536,288489472,65536,288555008,65536,288620544,65536,288686080,65536,288751616,65536,288817152,65536,288882688,65536,288948224,65536,289013760,65536,289079296,65536,289144832,65536,289210368,65536,289275904,65536,289341440,65536,
+289406976,65536,289472512,65536,289538048,65536,289603584,65536,289669120,65536,289734656,65536,289800192,65536,289865728,65536,289931264,65536,289996800,65536,290062336,65536,290127872,65536,290193408,65536,290258944,65536,290324480,65536,290390016,65536,290455552,65536,290521088,65536,290586624,65536,290652160,65536,
+290717696,65536,290783232,65536,290848768,65536,290914304,65536,290979840,65536,291045376,65536,291110912,65536,291176448,65536,291241984,65536,291307520,65536,291373056,65536,291438592,65536,291504128,65536,291569664,65536,291635200,65536,291700736,65536,96600064,65536,291766272,65536,291831808,65536,291897344,65536,
+291962880,65536,292028416,65536,292093952,65536,292159488,65536,292225024,65536,257097728,65536,292290560,65536,292356096,65536,292421632,65536,292487168,65536,34537472,65536,292552711,65536,292618240,65536,292683776,65536,292749312,65536,292814848,65536,292880384,65536,292945920,65536,293011456,65536,293076992,65536,
+293142528,65536,293208064,65536,293273600,65536,293339136,65536,293404672,65536,293470208,65536,293535744,65536,293601280,65536,293666816,65536,293732352,65536,293797888,65536,293863424,65536,293928960,65536,293994496,65536,294060032,65536,294125568,65536,294191104,65536,294256640,65536,294322176,65536,294387712,65536,
+294453248,65536,294518784,65536,294584320,65536,294649856,65536,294715392,65536,294780928,65536,294846464,65536,294912000,65536,294977536,65536,295043072,65536,295108615,65536,295174144,65536,198311936,65536,295239680,65536,295305216,65536,295370752,65536,295436288,65536,295501824,65536,295567360,65536,295632896,65536,
+295698432,65536,295763968,65536,295829504,65536,295895040,65536,295960576,65536,296026112,65536,296091648,65536,22937600,65536,296157184,65536,296222720,65536,296288256,65536,296353792,65536,296419328,65536,296484864,65536,296550400,65536,296615936,65536,296681472,65536,296747008,65536,296812544,65536,296878080,65536,
+296943616,65536,297009152,65536,297074688,65536,297140224,65536,297205760,65536,297271296,65536,297336832,65536,297402368,65536,297467904,65536,297533440,65536,297598976,65536,297664512,65536,297730048,65536,297795584,65536,297861120,65536,297926656,65536,297992192,65536,298057728,65536,298123264,65536,298188800,65536,
+298254336,65536,298319872,65536,298385408,65536,298450944,65536,298516480,65536,298582016,65536,298647552,65536,298713088,65536,298778624,65536,298844160,65536,298909696,65536,278790144,2147549184,299959310,287440896,65536,287506432,65536,17170432,65536,287571968,65536,278921216,65536,287637504,65536,287703040,65536,287768576,
+65536,287834112,65536,287899648,65536,287965184,65536,288030720,65536,288096256,65536,288161792,65536,288227328,65536,89194496,65536,288292864,65536,288358400,65536,288423936,65536,288489472,65536,288555008,65536,288620544,65536,288686080,65536,288751616,65536,288817152,65536,288882688,65536,288948224,65536,289013760,
+65536,289079296,65536,289144832,65536,289210368,65536,289275904,65536,289341440,65536,289406976,65536,289472512,65536,289538048,65536,289603584,65536,289669120,65536,289734656,65536,289800192,65536,289865728,65536,289931264,65536,289996800,65536,290062336,65536,290127872,65536,290193408,65536,290258944,65536,290324480,
+65536,290390016,65536,290455552,65536,290521088,65536,290586624,65536,290652160,65536,290717696,65536,290783232,65536,290848768,65536,290914304,65536,290979840,65536,291045376,65536,291110912,65536,291176448,65536,291241984,65536,291307520,65536,291373056,65536,291438592,65536,291504128,65536,291569664,65536,291635200,
+65536,291700736,65536,96600064,65536,291766272,65536,291831808,65536,291897344,65536,291962880,65536,292028416,65536,292093952,65536,292159488,65536,292225024,65536,257097728,65536,292290560,65536,292356096,65536,292421632,65536,292487168,65536,34537472,65536,292552711,65536,292618240,65536,292683776,65536,292749312,
+65536,292814848,65536,292880384,65536,292945920,65536,293011456,65536,293076992,65536,293142528,65536,293208064,65536,293273600,65536,293339136,65536,293404672,65536,293470208,65536,293535744,65536,293601280,65536,293666816,65536,293732352,65536,293797888,65536,293863424,65536,293928960,65536,293994496,65536,294060032,
+65536,294125568,65536,294191104,65536,294256640,65536,294322176,65536,294387712,65536,294453248,65536,294518784,65536,294584320,65536,294649856,65536,294715392,65536,294780928,65536,294846464,65536,294912000,65536,294977536,65536,295043072,65536,295108615,65536,295174144,65536,198311936,65536,295239680,65536,295305216,
+65536,295370752,65536,295436288,65536,295501824,65536,295567360,65536,295632896,65536,295698432,65536,295763968,65536,295829504,65536,295895040,65536,295960576,65536,296026112,65536,296091648,65536,22937600,65536,296157184,65536,296222720,65536,296288256,65536,296353792,65536,296419328,65536,296484864,65536,296550400,
+65536,296615936,65536,296681472,65536,296747008,65536,296812544,65536,296878080,65536,296943616,65536,297009152,65536,297074688,65536,297140224,65536,297205760,65536,297271296,65536,297336832,65536,297402368,65536,297467904,65536,297533440,65536,297598976,65536,297664512,65536,297730048,65536,297795584,65536,297861120,
+65536,297926656,65536,297992192,65536,298057728,65536,298123264,65536,298188800,65536,298254336,65536,298319872,65536,298385408,65536,298450944,65536,298516480,65536,298582016,65536,298647552,65536,298713088,65536,298778624,65536,298844160,65536,298909696,65536,278790144,2147549184,300024846,287440896,65536,287506432,65536,
+17170432,65536,287571968,65536,278921216,65536,287637504,65536,287703040,65536,287768576,65536,287834112,65536,287899648,65536,287965184,65536,288030720,65536,288096256,65536,288161792,65536,288227328,65536,89194496,65536,288292864,65536,288358400,65536,288423936,65536,288489472,65536,288555008,65536,288620544,65536,
+288686080,65536,288751616,65536,288817152,65536,288882688,65536,288948224,65536,289013760,65536,289079296,65536,289144832,65536,289210368,65536,289275904,65536,289341440,65536,289406976,65536,289472512,65536,289538048,65536,289603584,65536,289669120,65536,289734656,65536,289800192,65536,289865728,65536,289931264,65536,
+289996800,65536,290062336,65536,290127872,65536,290193408,65536,290258944,65536,290324480,65536,290390016,65536,290455552,65536,290521088,65536,290586624,65536,290652160,65536,290717696,65536,290783232,65536,290848768,65536,290914304,65536,290979840,65536,291045376,65536,291110912,65536,291176448,65536,291241984,65536,
+291307520,65536,291373056,65536,291438592,65536,291504128,65536,291569664,65536,291635200,65536,291700736,65536,96600064,65536,291766272,65536,291831808,65536,291897344,65536,291962880,65536,292028416,65536,292093952,65536,292159488,65536,292225024,65536,257097728,65536,292290560,65536,292356096,65536,292421632,65536,
+292487168,65536,34537472,65536,292552711,65536,292618240,65536,292683776,65536,292749312,65536,292814848,65536,292880384,65536,292945920,65536,293011456,65536,293076992,65536,293142528,65536,293208064,65536,293273600,65536,293339136,65536,293404672,65536,293470208,65536,293535744,65536,293601280,65536,293666816,65536,
+293732352,65536,293797888,65536,293863424,65536,293928960,65536,293994496,65536,294060032,65536,294125568,65536,294191104,65536,294256640,65536,294322176,65536,294387712,65536,294453248,65536,294518784,65536,294584320,65536,294649856,65536,294715392,65536,294780928,65536,294846464,65536,294912000,65536,294977536,65536,
+295043072,65536,295108615,65536,295174144,65536,198311936,65536,295239680,65536,295305216,65536,295370752,65536,295436288,65536,295501824,65536,295567360,65536,295632896,65536,295698432,65536,295763968,65536,295829504,65536,295895040,65536,295960576,65536,296026112,65536,296091648,65536,22937600,65536,296157184,65536,
+296222720,65536,296288256,65536,296353792,65536,296419328,65536,296484864,65536,296550400,65536,296615936,65536,296681472,65536,296747008,65536,296812544,65536,296878080,65536,296943616,65536,297009152,65536,297074688,65536,297140224,65536,297205760,65536,297271296,65536,297336832,65536,297402368,65536,297467904,65536,
+297533440,65536,297598976,65536,297664512,65536,297730048,65536,297795584,65536,297861120,65536,297926656,65536,297992192,65536,298057728,65536,298123264,65536,298188800,65536,298254336,65536,298319872,65536,298385408,65536,298450944,65536,298516480,65536,298582016,65536,298647552,65536,298713088,65536,298778624,65536,
+298844160,65536,298909696,65536,278790144,2147549184,300090382,287440896,65536,287506432,65536,17170432,65536,287571968,65536,278921216,65536,287637504,65536,287703040,65536,287768576,65536,287834112,65536,287899648,65536,287965184,65536,288030720,65536,288096256,65536,288161792,65536,288227328,65536,89194496,65536,288292864,
+65536,288358400,65536,288423936,65536,288489472,65536,288555008,65536,288620544,65536,288686080,65536,288751616,65536,288817152,65536,288882688,65536,288948224,65536,289013760,65536,289079296,65536,289144832,65536,289210368,65536,289275904,65536,289341440,65536,289406976,65536,289472512,65536,289538048,65536,289603584,
+65536,289669120,65536,289734656,65536,289800192,65536,289865728,65536,289931264,65536,289996800,65536,290062336,65536,290127872,65536,290193408,65536,290258944,65536,290324480,65536,290390016,65536,290455552,65536,290521088,65536,290586624,65536,290652160,65536,290717696,65536,290783232,65536,290848768,65536,290914304,
+65536,290979840,65536,291045376,65536,291110912,65536,291176448,65536,291241984,65536,291307520,65536,291373056,65536,291438592,65536,291504128,65536,291569664,65536,291635200,65536,291700736,65536,96600064,65536,291766272,65536,291831808,65536,291897344,65536,291962880,65536,292028416,65536,292093952,65536,292159488,
+65536,292225024,65536,257097728,65536,292290560,65536,292356096,65536,292421632,65536,292487168,65536,34537472,65536,292552711,65536,292618240,65536,292683776,65536,292749312,65536,292814848,65536,292880384,65536,292945920,65536,293011456,65536,293076992,65536,293142528,65536,293208064,65536,293273600,65536,293339136,
+65536,293404672,65536,293470208,65536,293535744,65536,293601280,65536,293666816,65536,293732352,65536,293797888,65536,293863424,65536,293928960,65536,293994496,65536,294060032,65536,294125568,65536,294191104,65536,294256640,65536,294322176,65536,294387712,65536,294453248,65536,294518784,65536,294584320,65536,294649856,
+65536,294715392,65536,294780928,65536,294846464,65536,294912000,65536,294977536,65536,295043072,65536,295108615,65536,295174144,65536,198311936,65536,295239680,65536,295305216,65536,295370752,65536,295436288,65536,295501824,65536,295567360,65536,295632896,65536,295698432,65536,295763968,65536,295829504,65536,295895040,
+65536,295960576,65536,296026112,65536,296091648,65536,22937600,65536,296157184,65536,296222720,65536,296288256,65536,296353792,65536,296419328,65536,296484864,65536,296550400,65536,296615936,65536,296681472,65536,296747008,65536,296812544,65536,296878080,65536,296943616,65536,297009152,65536,297074688,65536,297140224,
+65536,297205760,65536,297271296,65536,297336832,65536,297402368,65536,297467904,65536,297533440,65536,297598976,65536,297664512,65536,297730048,65536,297795584,65536,297861120,65536,297926656,65536,297992192,65536,298057728,65536,298123264,65536,298188800,65536,298254336,65536,298319872,65536,298385408,65536,298450944,
+65536,298516480,65536,298582016,65536,298647552,65536,298713088,65536,298778624,65536,298844160,65536,298909696,65536,278790144,2147549184,300155918,287440896,65536,287506432,65536,17170432,65536,287571968,65536,278921216,65536,287637504,65536,287703040,65536,287768576,65536,287834112,65536,287899648,65536,287965184,65536,
+288030720,65536,288096256,65536,288161792,65536,288227328,65536,89194496,65536,288292864,65536,288358400,65536,288423936,65536,288489472,65536,288555008,65536,288620544,65536,288686080,65536,288751616,65536,288817152,65536,288882688,65536,288948224,65536,289013760,65536,289079296,65536,289144832,65536,289210368,65536,
+289275904,65536,289341440,65536,289406976,65536,289472512,65536,289538048,65536,289603584,65536,289669120,65536,289734656,65536,289800192,65536,289865728,65536,289931264,65536,289996800,65536,290062336,65536,290127872,65536,290193408,65536,290258944,65536,290324480,65536,290390016,65536,290455552,65536,290521088,65536,
+290586624,65536,290652160,65536,290717696,65536,290783232,65536,290848768,65536,290914304,65536,290979840,65536,291045376,65536,291110912,65536,291176448,65536,291241984,65536,291307520,65536,291373056,65536,291438592,65536,291504128,65536,291569664,65536,291635200,65536,291700736,65536,96600064,65536,291766272,65536,
+291831808,65536,291897344,65536,291962880,65536,292028416,65536,292093952,65536,292159488,65536,292225024,65536,257097728,65536,292290560,65536,292356096,65536,292421632,65536,292487168,65536,34537472,65536,292552711,65536,292618240,65536,292683776,65536,292749312,65536,292814848,65536,292880384,65536,292945920,65536,
+293011456,65536,293076992,65536,293142528,65536,293208064,65536,293273600,65536,293339136,65536,293404672,65536,293470208,65536,293535744,65536,293601280,65536,293666816,65536,293732352,65536,293797888,65536,293863424,65536,293928960,65536,293994496,65536,294060032,65536,294125568,65536,294191104,65536,294256640,65536,
+294322176,65536,294387712,65536,294453248,65536,294518784,65536,294584320,65536,294649856,65536,294715392,65536,294780928,65536,294846464,65536,294912000,65536,294977536,65536,295043072,65536,295108615,65536,295174144,65536,198311936,65536,295239680,65536,295305216,65536,295370752,65536,295436288,65536,295501824,65536,
+295567360,65536,295632896,65536,295698432,65536,295763968,65536,295829504,65536,295895040,65536,295960576,65536,296026112,65536,296091648,65536,22937600,65536,296157184,65536,296222720,65536,296288256,65536,296353792,65536,296419328,65536,296484864,65536,296550400,65536,296615936,65536,296681472,65536,296747008,65536,
+296812544,65536,296878080,65536,296943616,65536,297009152,65536,297074688,65536,297140224,65536,297205760,65536,297271296,65536,297336832,65536,297402368,65536,297467904,65536,297533440,65536,297598976,65536,297664512,65536,297730048,65536,297795584,65536,297861120,65536,297926656,65536,297992192,65536,298057728,65536,
+298123264,65536,298188800,65536,298254336,65536,298319872,65536,298385408,65536,298450944,65536,298516480,65536,298582016,65536,298647552,65536,298713088,65536,298778624,65536,298844160,65536,298909696,65536,278790144,2147549184,300221454,287440896,65536,287506432,65536,17170432,65536,287571968,65536,278921216,65536,287637504,
+65536,287703040,65536,287768576,65536,287834112,65536,287899648,65536,287965184,65536,288030720,65536,288096256,65536,288161792,65536,288227328,65536,89194496,65536,288292864,65536,288358400,65536,288423936,65536,288489472,65536,288555008,65536,288620544,65536,288686080,65536,288751616,65536,288817152,65536,288882688,
+65536,288948224,65536,289013760,65536,289079296,65536,289144832,65536,289210368,65536,289275904,65536,289341440,65536,289406976,65536,289472512,65536,289538048,65536,289603584,65536,289669120,65536,289734656,65536,289800192,65536,289865728,65536,289931264,65536,289996800,65536,290062336,65536,290127872,65536,290193408,
+65536,290258944,65536,290324480,65536,290390016,65536,290455552,65536,290521088,65536,290586624,65536,290652160,65536,290717696,65536,290783232,65536,290848768,65536,290914304,65536,290979840,65536,291045376,65536,291110912,65536,291176448,65536,291241984,65536,291307520,65536,291373056,65536,291438592,65536,291504128,
+65536,291569664,65536,291635200,65536,291700736,65536,96600064,65536,291766272,65536,291831808,65536,291897344,65536,291962880,65536,292028416,65536,292093952,65536,292159488,65536,292225024,65536,257097728,65536,292290560,65536,292356096,65536,292421632,65536,292487168,65536,34537472,65536,292552711,65536,292618240,
+65536,292683776,65536,292749312,65536,292814848,65536,292880384,65536,292945920,65536,293011456,65536,293076992,65536,293142528,65536,293208064,65536,293273600,65536,293339136,65536,293404672,65536,293470208,65536,293535744,65536,293601280,65536,293666816,65536,293732352,65536,293797888,65536,293863424,65536,293928960,
+65536,293994496,65536,294060032,65536,294125568,65536,294191104,65536,294256640,65536,294322176,65536,294387712,65536,294453248,65536,294518784,65536,294584320,65536,294649856,65536,294715392,65536,294780928,65536,294846464,65536,294912000,65536,294977536,65536,295043072,65536,295108615,65536,295174144,65536,198311936,
+65536,295239680,65536,295305216,65536,295370752,65536,295436288,65536,295501824,65536,295567360,65536,295632896,65536,295698432,65536,295763968,65536,295829504,65536,295895040,65536,295960576,65536,296026112,65536,296091648,65536,22937600,65536,296157184,65536,296222720,65536,296288256,65536,296353792,65536,296419328,
+65536,296484864,65536,296550400,65536,296615936,65536,296681472,65536,296747008,65536,296812544,65536,296878080,65536,296943616,65536,297009152,65536,297074688,65536,297140224,65536,297205760,65536,297271296,65536,297336832,65536,297402368,65536,297467904,65536,297533440,65536,297598976,65536,297664512,65536,297730048,
+65536,297795584,65536,297861120,65536,297926656,65536,297992192,65536,298057728,65536,298123264,65536,298188800,65536,298254336,65536,298319872,65536,298385408,65536,298450944,65536,298516480,65536,298582016,65536,298647552,65536,298713088,65536,298778624,65536,298844160,65536,298909696,65536,278790144,2147549184,300286990,
+287440896,65536,287506432,65536,17170432,65536,287571968,65536,278921216,65536,287637504,65536,287703040,65536,287768576,65536,287834112,65536,287899648,65536,287965184,65536,288030720,65536,288096256,65536,288161792,65536,288227328,65536,89194496,65536,288292864,65536,288358400,65536,288423936,65536,288489472,65536,
+288555008,65536,288620544,65536,288686080,65536,288751616,65536,288817152,65536,288882688,65536,288948224,65536,289013760,65536,289079296,65536,289144832,65536,289210368,65536,289275904,65536,289341440,65536,289406976,65536,289472512,65536,289538048,65536,289603584,65536,289669120,65536,289734656,65536,289800192,65536,
+289865728,65536,289931264,65536,289996800,65536,290062336,65536,290127872,65536,290193408,65536,290258944,65536,290324480,65536,290390016,65536,290455552,65536,290521088,65536,290586624,65536,290652160,65536,290717696,65536,290783232,65536,290848768,65536,290914304,65536,290979840,65536,291045376,65536,291110912,65536,
+291176448,65536,291241984,65536,291307520,65536,291373056,65536,291438592,65536,291504128,65536,291569664,65536,291635200,65536,291700736,65536,96600064,65536,291766272,65536,291831808,65536,291897344,65536,291962880,65536,292028416,65536,292093952,65536,292159488,65536,292225024,65536,257097728,65536,292290560,65536,
+292356096,65536,292421632,65536,292487168,65536,34537472,65536,292552711,65536,292618240,65536,292683776,65536,292749312,65536,292814848,65536,292880384,65536,292945920,65536,293011456,65536,293076992,65536,293142528,65536,293208064,65536,293273600,65536,293339136,65536,293404672,65536,293470208,65536,293535744,65536,
+293601280,65536,293666816,65536,293732352,65536,293797888,65536,293863424,65536,293928960,65536,293994496,65536,294060032,65536,294125568,65536,294191104,65536,294256640,65536,294322176,65536,294387712,65536,294453248,65536,294518784,65536,294584320,65536,294649856,65536,294715392,65536,294780928,65536,294846464,65536,
+294912000,65536,294977536,65536,295043072,65536,295108615,65536,295174144,65536,198311936,65536,295239680,65536,295305216,65536,295370752,65536,295436288,65536,295501824,65536,295567360,65536,295632896,65536,295698432,65536,295763968,65536,295829504,65536,295895040,65536,295960576,65536,296026112,65536,296091648,65536,
+22937600,65536,296157184,65536,296222720,65536,296288256,65536,296353792,65536,296419328,65536,296484864,65536,296550400,65536,296615936,65536,296681472,65536,296747008,65536,296812544,65536,296878080,65536,296943616,65536,297009152,65536,297074688,65536,297140224,65536,297205760,65536,297271296,65536,297336832,65536,
+297402368,65536,297467904,65536,297533440,65536,297598976,65536,297664512,65536,297730048,65536,297795584,65536,297861120,65536,297926656,65536,297992192,65536,298057728,65536,298123264,65536,298188800,65536,298254336,65536,298319872,65536,298385408,65536,298450944,65536,298516480,65536,298582016,65536,298647552,65536,
+298713088,65536,298778624,65536,298844160,65536,298909696,65536,278790144,2147549184,300352526,287440896,65536,287506432,65536,17170432,65536,287571968,65536,278921216,65536,287637504,65536,287703040,65536,287768576,65536,287834112,65536,287899648,65536,287965184,65536,288030720,65536,288096256,65536,288161792,65536,288227328,
+65536,89194496,65536,288292864,65536,288358400,65536,288423936,65536,288489472,65536,288555008,65536,288620544,65536,288686080,65536,288751616,65536,288817152,65536,288882688,65536,288948224,65536,289013760,65536,289079296,65536,289144832,65536,289210368,65536,289275904,65536,289341440,65536,289406976,65536,289472512,
+65536,289538048,65536,289603584,65536,289669120,65536,289734656,65536,289800192,65536,289865728,65536,289931264,65536,289996800,65536,290062336,65536,290127872,65536,290193408,65536,290258944,65536,290324480,65536,290390016,65536,290455552,65536,290521088,65536,290586624,65536,290652160,65536,290717696,65536,290783232,
+65536,290848768,65536,290914304,65536,290979840,65536,291045376,65536,291110912,65536,291176448,65536,291241984,65536,291307520,65536,291373056,65536,291438592,65536,291504128,65536,291569664,65536,291635200,65536,291700736,65536,96600064,65536,291766272,65536,291831808,65536,291897344,65536,291962880,65536,292028416,
+65536,292093952,65536,292159488,65536,292225024,65536,257097728,65536,292290560,65536,292356096,65536,292421632,65536,292487168,65536,34537472,65536,292552711,65536,292618240,65536,292683776,65536,292749312,65536,292814848,65536,292880384,65536,292945920,65536,293011456,65536,293076992,65536,293142528,65536,293208064,
+65536,293273600,65536,293339136,65536,293404672,65536,293470208,65536,293535744,65536,293601280,65536,293666816,65536,293732352,65536,293797888,65536,293863424,65536,293928960,65536,293994496,65536,294060032,65536,294125568,65536,294191104,65536,294256640,65536,294322176,65536,294387712,65536,294453248,65536,294518784,
+65536,294584320,65536,294649856,65536,294715392,65536,294780928,65536,294846464,65536,294912000,65536,294977536,65536,295043072,65536,295108615,65536,295174144,65536,198311936,65536,295239680,65536,295305216,65536,295370752,65536,295436288,65536,295501824,65536,295567360,65536,295632896,65536,295698432,65536,295763968,
+65536,295829504,65536,295895040,65536,295960576,65536,296026112,65536,296091648,65536,22937600,65536,296157184,65536,296222720,65536,296288256,65536,296353792,65536,296419328,65536,296484864,65536,296550400,65536,296615936,65536,296681472,65536,296747008,65536,296812544,65536,296878080,65536,296943616,65536,297009152,
+65536,297074688,65536,297140224,65536,297205760,65536,297271296,65536,297336832,65536,297402368,65536,297467904,65536,297533440,65536,297598976,65536,297664512,65536,297730048,65536,297795584,65536,297861120,65536,297926656,65536,297992192,65536,298057728,65536,298123264,65536,298188800,65536,298254336,65536,298319872,
+65536,298385408,65536,298450944,65536,298516480,65536,298582016,65536,298647552,65536,298713088,65536,298778624,65536,298844160,65536,298909696,65536,298975232,2147549184,300417084,288489472,65536,288817152,65536,2097154,65536,2686976,65536,298975232,65537,288489472,65537,288817152,65537,2097154,65537,2686976,65537,
+298975232,65538,288489472,65538,288817152,65538,2097154,65538,2686976,65538,298975232,65539,288489472,65539,288817152,65539,2097154,65539,2686976,65539,298975232,65540,288489472,65540,288817152,65540,2097154,65540,2686976,65540,298975232,65541,288489472,65541,288817152,65541,2097154,65541,2686976,65541,
+298975232,65542,288489472,65542,288817152,65542,2097154,65542,2686976,65542,298975232,65543,288489472,65543,288817152,65543,2097154,65543,2686976,65543,298975232,65544,288489472,65544,288817152,65544,2097154,65544,2686976,65544,298975232,65545,288489472,65545,288817152,65545,2097154,65545,2686976,65545,
+298975232,65546,288489472,65546,288817152,65546,2097154,65546,2686976,65546,298975232,65547,288489472,65547,288817152,65547,2097154,65547,2686976,65547,298975232,65548,288489472,65548,288817152,65548,2097154,65548,2686976,65548,298975232,65549,288489472,65549,288817152,65549,2097154,65549,2686976,65549,
+298975232,65550,288489472,65550,288817152,65550,2097154,65550,2686976,65550,298975232,65551,288489472,65551,288817152,65551,2097154,65551,2686976,65551,298975232,65552,288489472,65552,288817152,65552,2097154,65552,2686976,65552,298975232,65553,288489472,65553,288817152,65553,2097154,65553,2686976,65553,
+298975232,65554,288489472,65554,288817152,65554,2097154,65554,2686976,65554,298975232,65555,288489472,65555,288817152,65555,2097154,65555,2686976,65555,98172928,2147549184,300483599,98172928,65537,98172928,65538,98172928,65539,98172928,65540,98172928,65541,98172928,65542,98172928,65543,98172928,2147549184,300549136,
+98172928,65537,98172928,65538,98172928,65539,98172928,65540,98172928,65541,98172928,65542,98172928,65543,98172928,65544,300613636,2147483648,3,114688004,0,128843783,0,124649479,0,25,300679179,0,300744706,0,3276800,0,300810247,0,300875783,0,300941319,0,301006850,0,
+22937600,0,301072391,0,301137927,0,301203463,0,301268999,0,301334535,0,301400071,0,301465607,0,301531143,0,301596679,0,301662215,0,301727751,0,301793287,0,301858823,0,301924359,0,301989895,0,302055431,0,302120967,0,6,302186503,0,302252039,
+0,302317575,0,302383111,0,114688004,0,2097156,0,26,1835566,0,1901102,0,2162688,0,302448647,0,302514183,0,302317575,0,302383111,0,46530567,0,302579716,0,44367876,0,302645804,0,302710791,0,128843783,0,2097156,0,302776324,0,
+302841860,0,6160391,0,302907394,0,212992002,0,302972930,0,303038466,0,303104004,0,303169543,0,165282063,0,25690119,0,303235079,0,3,303300615,0,114688004,0,2097156,0,12,1836053,0,1901589,0,2162688,0,303366702,0,303431684,0,
+131072,0,302646292,0,302579716,0,2097156,0,265289874,0,303497223,0,303562756,0,21,303628290,0,303693826,0,303759367,0,303824898,0,303890434,0,303955970,0,304021506,0,304087042,0,304152578,0,155844615,0,304218114,0,30277634,0,304283652,
+0,304349188,0,304414724,0,304480260,0,25624583,0,304545796,0,304611332,0,304676871,0,304742407,0,16,2097156,0,304807940,0,304873476,0,304939012,0,305004548,0,305070087,0,305136174,0,305201156,0,305266695,0,305332231,0,22740999,0,
+305397767,0,305463303,0,305528839,0,113704964,0,44367876,0,5,2097156,0,128843783,0,305594372,0,305659908,0,305726482,0,18,1836057,0,1901593,0,2162688,0,2097156,0,22740999,0,131923979,2147549184,305790998,131989515,65536,131923979,2147549184,305856534,
+131989515,65536,305922606,2147483648,305988629,0,2097156,2147549184,306054168,128843783,65536,305594372,65536,305659908,65536,305726482,65536,304283652,2147483648,304349188,0,1,306118656,0,11,1836059,0,1901595,0,166265390,0,131072,0,2162688,0,306184196,0,74514436,0,306249732,
+0,306315268,0,306380804,0,306446340,0,6,1836060,0,1901596,0,306511876,0,6029316,0,6094852,0,131072,0,9,59047940,0,306577410,0,2097154,0,131923979,2147549184,306642966,131989515,65536,131923979,2147549184,13631510,131989515,65536,306708484,2147483648,131072,
+0,87,303628290,2147549184,162399254,303693826,65536,303759367,65536,303824898,65536,303890434,65536,303955970,65536,304021506,65536,304087042,65536,304152578,65536,155844615,65536,304218114,65536,30277634,65536,304283652,65536,304349188,65536,304414724,65536,304480260,65536,25624583,65536,304545796,65536,304611332,
+65536,304676871,65536,304742407,65536,300679179,2147549184,306775059,300744706,65536,3276800,65536,300810247,65536,300875783,65536,300941319,65536,301006850,65536,22937600,65536,301072391,65536,301137927,65536,301203463,65536,301268999,65536,301334535,65536,301400071,65536,301465607,65536,301531143,65536,301596679,65536,
+301662215,65536,301727751,65536,301793287,65536,301858823,65536,301924359,65536,301989895,65536,302055431,65536,302120967,65536,131923979,2147549184,305790998,131989515,65536,131923979,2147549184,305856534,131989515,65536,2097156,2147549184,306054168,128843783,65536,305594372,65536,305659908,65536,305726482,65536,2097156,2147549184,306840599,
+304807940,65536,304873476,65536,304939012,65536,305004548,65536,305070087,65536,305136174,65536,305201156,65536,305266695,65536,305332231,65536,22740999,65536,305397767,65536,305463303,65536,305528839,65536,113704964,65536,44367876,65536,24052270,2147483648,306906133,0,131923979,2147549184,306970646,131989515,65536,307036164,
+2147483648,307101700,0,119669786,0,59047940,2147549184,307168285,306577410,65536,2097154,65536,131923979,2147614720,307168285,306642966,131989515,131072,131923979,2147614720,307168285,13631510,131989515,131072,306708484,2147549184,307168285,131072,65536,4,1836062,0,1901598,0,307232768,0,8126488,0,5,1836063,
+0,1901599,0,307298304,0,2097152,0,15532032,0,7,1836064,0,1901600,0,307363840,0,15532032,0,307429376,0,131923979,2147549184,307494934,131989515,65536,5,1836065,0,1901601,0,307560448,0,1966080,0,15532032,0,10,1836065,2147549184,167183393,
+1901601,65536,307560448,65536,1966080,65536,15532032,65536,307625984,2147483648,8126488,0,307691520,0,307757056,0,15532032,0,6,1836065,2147549184,167183393,1901601,65536,307560448,65536,1966080,65536,15532032,65536,307822592,2147483648,9,1836065,2147549184,167183393,1901601,65536,307560448,65536,
+1966080,65536,15532032,65536,307888128,2147483648,307953664,0,308019204,0,2228224,0,7,1836069,0,1901605,0,2162688,0,175702016,0,308084738,0,2097154,0,2228224,0,10,1836070,0,1901606,0,2162688,0,308150272,0,308215808,0,308281344,0,
+308346880,0,2097153,0,46661633,0,15794176,0,5,2097156,0,308412423,0,139722759,0,308477959,0,69009415,0,8,308543495,0,308609031,0,308674567,0,308740103,0,308805639,0,308871175,0,2097154,0,15794176,0,5,308936711,0,309002247,
+0,309067783,0,2097154,0,2686976,0,2,309133312,0,15532032,0,3,309198848,0,2097152,0,15794176,0,7,309264388,0,263454724,0,309329924,0,263716868,0,2097156,0,56033284,0,263127050,0,24,66650119,2147549184,309395538,58851335,65536,
+66715655,65536,58916871,65536,66650119,2147549184,309461074,58851335,65536,66715655,65536,58916871,65536,66650119,2147549184,309526610,58851335,65536,66715655,65536,58916871,65536,66650119,2147549184,309592146,58851335,65536,66715655,65536,58916871,65536,66650119,2147549184,309657682,58851335,65536,66715655,65536,58916871,65536,
+66650119,2147549184,309723218,58851335,65536,66715655,65536,58916871,65536,21,309788672,0,309854208,0,309919744,0,309985280,0,310050816,0,310116352,0,310181888,0,310247424,0,310312960,0,310378496,0,310444032,0,310509568,0,310575104,0,310640640,0,310706176,0,
+310771712,0,310837248,0,310902784,0,310968320,0,311033856,0,131072,0,4,1836079,0,1901615,0,2162688,0,311099392,0,5,1836080,0,1901616,0,311164928,0,131923979,2147549184,248971286,131989515,65536,470,311230468,0,311296004,0,2097156,0,
+311361540,0,311427072,0,311492608,0,311558144,0,311623680,0,311689216,0,311754752,0,311820288,0,311885824,0,311951360,0,312016896,0,312082432,0,312147968,0,312213504,0,312279040,0,312344576,0,312410112,0,312475652,0,312541186,0,312606722,0,
+312672258,0,312737794,0,2686976,0,312803328,0,312868864,0,312934404,0,312999936,0,313065472,0,313131008,0,313196544,0,313262080,0,313327618,0,313393156,0,313458692,0,313524228,0,313589764,0,313655300,0,313720839,0,313786372,0,313851908,0,
+313917447,0,313982983,0,314048519,0,314114052,0,269025284,0,314179584,0,314245120,0,314310658,0,314376194,0,314441730,0,314507264,0,131923979,2147549184,314572822,131989515,65536,131923979,2147549184,314638358,131989515,65536,131923979,2147549184,314703894,131989515,65536,131923979,2147549184,314769430,
+131989515,65536,131923979,2147549184,314834966,131989515,65536,131923979,2147549184,314900502,131989515,65536,131923979,2147549184,314966038,131989515,65536,131923979,2147549184,315031574,131989515,65536,131923979,2147549184,315097110,131989515,65536,131923979,2147549184,315162646,131989515,65536,131923979,2147549184,315228182,131989515,65536,131923979,2147549184,315293718,
+131989515,65536,315359232,2147483648,315424770,0,315490306,0,315555840,0,315621377,0,315686913,0,315752448,0,315817986,0,315883524,0,315949063,0,316014594,0,316080130,0,316145666,0,316211202,0,316276736,0,2097156,2147549184,316343335,308412423,65536,139722759,65536,308477959,
+65536,69009415,65536,2097156,65537,308412423,65537,139722759,65537,308477959,65537,69009415,65537,2097156,65538,308412423,65538,139722759,65538,308477959,65538,69009415,65538,2097156,65539,308412423,65539,139722759,65539,308477959,65539,69009415,65539,316407815,2147483648,262144000,0,316473344,0,316538880,
+0,316604416,0,316669954,0,316735490,0,316801026,0,316866562,0,316932098,0,316997634,0,317063172,0,317128708,0,317194247,0,94961664,0,317259778,0,317325314,0,317390850,0,317456386,0,317521922,0,317587458,0,317652992,0,317718528,0,317784064,
+0,317849600,0,317915136,0,317980676,0,318046215,0,318111748,0,318177284,0,318242820,0,318308354,0,318373890,0,318439424,0,318504962,0,318570498,0,318636034,0,318701570,0,318767106,0,318832647,0,318898183,0,318963716,0,319029255,0,319094791,
+0,319160327,0,319225860,0,319291393,0,319356928,0,319422466,0,319488007,0,232128514,0,319553538,0,319619074,0,319684608,0,319750146,0,319815680,0,319881216,0,319946759,0,320012295,0,61145090,2147549184,320077958,57737218,65536,61210624,65536,61276160,65536,
+21823488,65536,61341696,65536,60817415,2147614720,320077958,61407404,60882951,131072,60948487,131072,61014023,131072,61079559,131072,57737220,131072,60817415,131073,60882951,131073,60948487,131073,61014023,131073,61079559,131073,57737220,131073,60817415,131074,60882951,131074,60948487,131074,61014023,131074,61079559,131074,
+57737220,131074,60817415,131075,60882951,131075,60948487,131075,61014023,131075,61079559,131075,57737220,131075,60817415,131076,60882951,131076,60948487,131076,61014023,131076,61079559,131076,57737220,131076,60817415,131077,60882951,131077,60948487,131077,61014023,131077,61079559,131077,57737220,131077,60817415,131078,
+60882951,131078,60948487,131078,61014023,131078,61079559,131078,57737220,131078,60817415,131079,60882951,131079,60948487,131079,61014023,131079,61079559,131079,57737220,131079,60817415,131080,60882951,131080,60948487,131080,61014023,131080,61079559,131080,57737220,131080,60817415,131081,60882951,131081,60948487,131081,
+61014023,131081,61079559,131081,57737220,131081,60817415,131082,60882951,131082,60948487,131082,61014023,131082,61079559,131082,57737220,131082,60817415,131083,60882951,131083,60948487,131083,61014023,131083,61079559,131083,57737220,131083,60817415,131084,60882951,131084,60948487,131084,61014023,131084,61079559,131084,
+57737220,131084,60817415,131085,60882951,131085,60948487,131085,61014023,131085,61079559,131085,57737220,131085,60817415,131086,60882951,131086,60948487,131086,61014023,131086,61079559,131086,57737220,131086,60817415,131087,60882951,131087,60948487,131087,61014023,131087,61079559,131087,57737220,131087,60817415,131088,
+60882951,131088,60948487,131088,61014023,131088,61079559,131088,57737220,131088,60817415,131089,60882951,131089,60948487,131089,61014023,131089,61079559,131089,57737220,131089,60817415,131090,60882951,131090,60948487,131090,61014023,131090,61079559,131090,57737220,131090,60817415,131091,60882951,131091,60948487,131091,
+61014023,131091,61079559,131091,57737220,131091,60817415,131092,60882951,131092,60948487,131092,61014023,131092,61079559,131092,57737220,131092,60817415,131093,60882951,131093,60948487,131093,61014023,131093,61079559,131093,57737220,131093,60817415,131094,60882951,131094,60948487,131094,61014023,131094,61079559,131094,
+57737220,131094,60817415,131095,60882951,131095,60948487,131095,61014023,131095,61079559,131095,57737220,131095,60817415,131096,60882951,131096,60948487,131096,61014023,131096,61079559,131096,57737220,131096,60817415,131097,60882951,131097,60948487,131097,61014023,131097,61079559,131097,57737220,131097,60817415,131098,
+60882951,131098,60948487,131098,61014023,131098,61079559,131098,57737220,131098,60817415,131099,60882951,131099,60948487,131099,61014023,131099,61079559,131099,57737220,131099,60817415,131100,60882951,131100,60948487,131100,61014023,131100,61079559,131100,57737220,131100,60817415,131101,60882951,131101,60948487,131101,
+61014023,131101,61079559,131101,57737220,131101,60817415,131102,60882951,131102,60948487,131102,61014023,131102,61079559,131102,57737220,131102,60817415,131103,60882951,131103,60948487,131103,61014023,131103,61079559,131103,57737220,131103,320143367,2147483648,320208903,0,320274432,0,320339968,0,320405504,0,
+320471040,0,320536576,0,320602112,0,320667652,0,320733191,0,320798722,0,320864258,0,320929794,0,320995330,0,321060866,0,321126402,0,321191940,0,321257472,0,237371392,0,321323008,0,321388544,0,321454080,0,321519616,0,321585154,0,121241602,0,
+321650695,0,321716224,0,321781760,0,321847296,0,321912832,0,308543495,2147549184,321979432,308609031,65536,308674567,65536,308740103,65536,308805639,65536,308871175,65536,2097154,65536,15794176,65536,308936711,2147549184,322044969,309002247,65536,309067783,65536,2097154,65536,2686976,65536,309198848,2147549184,
+322110507,2097152,65536,15794176,65536,309264388,2147549184,322176044,263454724,65536,309329924,65536,263716868,65536,2097156,65536,56033284,65536,263127050,65536,66650119,2147614720,322241581,309395538,58851335,131072,66715655,131072,58916871,131072,66650119,2147614720,322241581,309461074,58851335,131072,66715655,131072,58916871,131072,
+66650119,2147614720,322241581,309526610,58851335,131072,66715655,131072,58916871,131072,66650119,2147614720,322241581,309592146,58851335,131072,66715655,131072,58916871,131072,66650119,2147614720,322241581,309657682,58851335,131072,66715655,131072,58916871,131072,66650119,2147614720,322241581,309723218,58851335,131072,66715655,131072,58916871,131072,
+309788672,2147549184,322307118,309854208,65536,309919744,65536,309985280,65536,310050816,65536,310116352,65536,310181888,65536,310247424,65536,310312960,65536,310378496,65536,310444032,65536,310509568,65536,310575104,65536,310640640,65536,310706176,65536,310771712,65536,310837248,65536,310902784,65536,310968320,65536,311033856,
+65536,131072,65536,309133312,2147549184,12190762,15532032,65536,6,322371588,0,322437123,0,322502659,0,322568193,0,322633729,0,322699265,0,2,56885250,0,56950786,0,2,56885255,0,56950791,0,2,56885252,0,56950788,0,3,56885252,0,56950788,
+0,97714180,0,3,56885255,0,56950791,0,97714183,0,4,56885255,0,56950791,0,97714183,0,70123527,0,1,322764807,0,4,66650116,0,58851332,0,66715652,0,58916868,0,4,66650119,0,58851335,0,66715655,0,58916871,0,
+4,9764871,0,322830343,0,322895879,0,322961415,0,27,1835019,2147549184,4980762,1900555,65536,3801114,65536,3866655,65536,3932192,65536,3997696,65536,2097154,65536,2621444,65536,4063236,65536,4128772,65536,4194308,65536,4259844,65536,4325380,65536,4390916,65536,3735552,
+2147614720,4980762,4456478,4522008,2147549184,4980762,4587544,65536,4653067,65536,4718620,65536,4784154,65536,4849675,65536,4915233,65536,3604514,65536,5046272,2147483648,17892408,0,5242915,0,323026979,0,42,66650119,2147549184,61145170,58851335,65536,66715655,65536,58916871,65536,66650119,2147549184,
+57737298,58851335,65536,66715655,65536,58916871,65536,66650116,2147549184,323093382,58851332,65536,66715652,65536,58916868,65536,66650116,2147549184,323158918,58851332,65536,66715652,65536,58916868,65536,66650116,2147549184,323224454,58851332,65536,66715652,65536,58916868,65536,323289095,2147483648,323354631,0,323420167,0,
+323485703,0,323551234,0,323616770,0,323682306,0,323747842,0,323813378,0,2097154,0,246939650,0,247529474,0,247595010,0,323878914,0,323944450,0,261816322,0,324009984,0,324075520,0,3276800,0,324141063,0,324207673,0,324273007,0,47,324337671,
+0,324403207,0,324468743,0,324534279,0,324599815,0,324665351,0,324730887,0,324796423,0,324861959,0,324927495,0,324993460,0,325059642,0,325125179,0,324207676,0,324273007,0,325189639,0,325255175,0,325320711,0,325386247,0,325451783,0,325517319,
+0,25624583,0,325582855,0,325648391,0,325713927,0,273743879,0,325779463,0,325844992,0,325910528,0,115081216,0,325976064,0,326041600,0,326107136,0,326172672,0,61341696,0,326238215,0,326303746,0,326369282,0,326434823,0,326500352,0,326565888,
+0,326631424,0,208732160,0,319225856,0,326696967,0,326762503,0,326828039,0,7,101974023,0,326893575,0,184549383,0,326959111,0,327024647,0,20381698,0,1441792,0,32,1966080,0,327090176,0,327155712,0,327221248,0,2097154,0,327286784,
+0,327352320,0,327417856,0,327483392,0,327548928,0,44367872,0,327614464,0,327680000,0,327745536,0,327811079,0,327876615,0,327942151,0,328007687,0,328073223,0,328138759,0,328204295,0,328269831,0,328335367,0,328400903,0,328466439,0,328531975,
+0,328597511,0,328663047,0,328728580,0,328794112,0,8126488,0,5308427,0,28,2097156,0,328859652,0,328925191,0,328990727,0,329056260,0,329121796,0,329187335,0,329252871,0,329318407,0,329383943,0,329449479,0,329515015,0,329580551,0,
+329646087,0,329711623,0,329777159,0,329842695,0,329908231,0,329973767,0,330039303,0,330104839,0,330170375,0,330235911,0,330301447,0,330366980,0,330432519,0,330498052,0,330563591,0,7,330629131,0,330694667,0,2097156,0,330760199,0,330826068,
+0,330891271,0,330956807,0,130,1835078,0,1900614,0,131923979,2147549184,15597590,131989515,65536,15663104,2147483648,15728640,0,15794176,0,325517319,0,25624583,0,331022343,0,331087872,0,25231360,0,198311936,0,114819072,0,331153412,0,331218948,0,325910530,
+0,115081218,0,67633203,0,331284531,0,66650119,2147549184,331350098,58851335,65536,66715655,65536,58916871,65536,325059647,2147483648,331415552,0,331481090,0,89915392,0,241500164,0,331546626,0,235339778,0,331612162,0,331677698,0,331743234,0,331808770,0,2097154,0,
+33357828,0,47775751,0,104005639,0,331874311,0,331939847,0,332005383,0,332070919,0,61341696,0,262144000,0,332136448,0,332201984,0,332267520,0,332333056,0,332398592,0,332464128,0,332529666,0,332595202,0,332660743,0,165282063,0,332726274,0,
+332791808,0,125239296,0,332857351,0,332922887,0,332988423,0,1966080,2147549184,237503332,327090176,65536,327155712,65536,327221248,65536,2097154,65536,327286784,65536,327352320,65536,327417856,65536,327483392,65536,327548928,65536,44367872,65536,327614464,65536,327680000,65536,327745536,65536,327811079,
+65536,327876615,65536,327942151,65536,328007687,65536,328073223,65536,328138759,65536,328204295,65536,328269831,65536,328335367,65536,328400903,65536,328466439,65536,328531975,65536,328597511,65536,328663047,65536,328728580,65536,328794112,65536,8126488,65536,5308427,65536,2097156,2147549184,266470461,328859652,65536,
+328925191,65536,328990727,65536,329056260,65536,329121796,65536,329187335,65536,329252871,65536,329318407,65536,329383943,65536,329449479,65536,329515015,65536,329580551,65536,329646087,65536,329711623,65536,329777159,65536,329842695,65536,329908231,65536,329973767,65536,330039303,65536,330104839,65536,330170375,65536,
+330235911,65536,330301447,65536,330366980,65536,330432519,65536,330498052,65536,330563591,65536,131923979,2147614720,270402553,170655766,131989515,131072,330629131,2147549184,12190782,330694667,65536,2097156,65536,330760199,65536,330826068,65536,330891271,65536,330956807,65536,5,1836096,0,1901632,0,1966084,0,
+131072,0,333053952,0,6,1836096,2147549184,459840,1901632,65536,1966084,65536,131072,65536,333053952,65536,20185114,2147483648,7,1836096,2147549184,459840,1901632,65536,1966084,65536,131072,65536,333053952,65536,333119492,2147483648,131072,0,7,1836096,2147549184,459840,1901632,65536,
+1966084,65536,131072,65536,333053952,65536,170524676,2147483648,14876672,0,7,1836096,2147549184,459840,1901632,65536,1966084,65536,131072,65536,333053952,65536,333185028,2147483648,14876672,0,7,1836096,2147549184,459840,1901632,65536,1966084,65536,131072,65536,333053952,65536,333250564,2147483648,
+333316100,0,7,1836096,2147549184,459840,1901632,65536,1966084,65536,131072,65536,333053952,65536,333381636,2147483648,23068676,0,7,1836096,2147549184,459840,1901632,65536,1966084,65536,131072,65536,333053952,65536,170524676,2147483648,14876672,0,8,1836096,2147549184,459840,1901632,65536,
+1966084,65536,131072,65536,333053952,65536,333447172,2147483648,333512708,0,333578584,0,2,131923979,2147549184,170655766,131989515,65536,8,38207495,0,333643780,0,333709316,0,333774852,0,93650948,0,93716484,0,93126663,0,61341700,0,4,1245188,0,62193668,0,
+19988487,0,94699527,0,55,1835019,2147549184,4980762,1900555,65536,3801114,65536,3866655,65536,3932192,65536,3997696,65536,2097154,65536,2621444,65536,4063236,65536,4128772,65536,4194308,65536,4259844,65536,4325380,65536,4390916,65536,3735552,2147614720,4980762,4456478,4522008,2147549184,
+4980762,4587544,65536,4653067,65536,4718620,65536,4784154,65536,4849675,65536,4915233,65536,3604514,65536,24576098,2147483648,44892160,0,5242915,0,45088768,0,333840384,0,22937600,0,14942212,0,333905924,0,17301508,0,2097156,0,333971460,0,70647938,0,71172098,
+0,45481986,0,1245188,2147549184,334038090,62193668,65536,19988487,65536,94699527,65536,38207495,2147549184,243074121,333643780,65536,333709316,65536,333774852,65536,93650948,65536,93716484,65536,93126663,65536,61341700,65536,334102528,2147483648,212336640,0,45547520,0,94568455,0,74122316,0,3605581,
+0,49,3605583,0,1966080,2147614720,334169168,237503332,327090176,131072,327155712,131072,327221248,131072,2097154,131072,327286784,131072,327352320,131072,327417856,131072,327483392,131072,327548928,131072,44367872,131072,327614464,131072,327680000,131072,327745536,131072,327811079,131072,327876615,131072,327942151,131072,
+328007687,131072,328073223,131072,328138759,131072,328204295,131072,328269831,131072,328335367,131072,328400903,131072,328466439,131072,328531975,131072,328597511,131072,328663047,131072,328728580,131072,328794112,131072,8126488,131072,5308427,131072,340197383,2147549184,334169168,1179648,65536,340262912,65536,340328499,65536,340393991,
+65536,340459527,65536,340525056,65536,340590592,65536,34537472,65536,340656135,65536,340721671,65536,2097156,65536,331153412,65536,331218948,65536,340787207,65536,340852743,65536,85,1835019,2147549184,4980762,1900555,65536,3801114,65536,3866655,65536,3932192,65536,3997696,65536,2097154,65536,2621444,
+65536,4063236,65536,4128772,65536,4194308,65536,4259844,65536,4325380,65536,4390916,65536,3735552,2147614720,4980762,4456478,4522008,2147549184,4980762,4587544,65536,4653067,65536,4718620,65536,4784154,65536,4849675,65536,4915233,65536,3604514,65536,131923979,2147549184,334233622,131989515,65536,334299137,
+2147483648,220725248,0,334364674,0,334430210,0,334495746,0,334561284,0,334626820,0,334693231,0,334757888,0,26214400,0,3605583,2147549184,334824526,1966080,2147680256,334824526,334169168,237503332,327090176,196608,327155712,196608,327221248,196608,2097154,196608,327286784,196608,327352320,196608,327417856,
+196608,327483392,196608,327548928,196608,44367872,196608,327614464,196608,327680000,196608,327745536,196608,327811079,196608,327876615,196608,327942151,196608,328007687,196608,328073223,196608,328138759,196608,328204295,196608,328269831,196608,328335367,196608,328400903,196608,328466439,196608,328531975,196608,328597511,196608,328663047,
+196608,328728580,196608,328794112,196608,8126488,196608,5308427,196608,340197383,2147614720,334824526,334169168,1179648,131072,340262912,131072,340328499,131072,340393991,131072,340459527,131072,340525056,131072,340590592,131072,34537472,131072,340656135,131072,340721671,131072,2097156,131072,331153412,131072,331218948,131072,340787207,
+131072,340852743,131072,3605586,2147483648,39,1836115,0,1901651,0,8782931,0,114622706,0,334889202,0,334954496,0,335020274,0,335086676,0,131923979,2147614720,335151988,243269654,131989515,131072,131923979,2147614720,335151988,243335190,131989515,131072,131923979,2147614720,335151988,243400726,131989515,131072,
+335216881,2147483648,243466244,0,335282178,0,335347714,0,173277186,0,173342722,0,335413248,0,75825152,0,241434626,0,335478786,0,335544322,0,335609858,0,335675394,0,335740930,0,335806464,0,335872000,0,335937536,0,336003072,0,336068610,0,336134148,0,
+336200789,0,336265216,0,17039360,0,117113160,0,3605590,0,20,1836119,0,1901655,0,23461888,0,4522008,0,336330752,0,336396290,0,1966082,0,1703948,0,145948684,0,336461836,0,336527372,0,336592908,0,336658444,0,336723980,0,15532032,
+0,336789506,0,2097153,0,336855041,0,4980738,0,336921688,0,4,1836121,0,1901657,0,336987223,0,337052759,0,15,1836122,0,1901658,0,131923979,2147549184,307494934,131989515,65536,131923979,2147549184,337117206,131989515,65536,23461888,2147483648,337182722,0,337248258,
+0,337313792,0,2097154,0,337379330,0,337445979,0,337511515,0,337575947,0,4,1836124,0,1901660,0,23461888,0,8126488,0,9,1836125,0,1901661,0,23461888,0,337641472,0,131923979,2147549184,337707030,131989515,65536,337772548,2147483648,2097154,0,
+2686976,0,15,1835996,0,1901532,0,23461888,0,4522008,0,244843614,0,337838091,0,4849675,0,336921688,0,337904735,0,131923979,2147549184,337969174,131989515,65536,338035676,2147483648,244908920,0,2097154,0,1441792,0,10,1835908,0,1901444,0,23461888,
+0,338100224,0,338165760,0,2621442,0,307363842,0,16121860,0,4522008,0,3605600,0,4,1836129,0,1901665,0,335216881,0,2162688,0,3,1836130,0,1901666,0,100532224,0,43,1835019,2147549184,4980762,1900555,65536,3801114,65536,3866655,
+65536,3932192,65536,3997696,65536,2097154,65536,2621444,65536,4063236,65536,4128772,65536,4194308,65536,4259844,65536,4325380,65536,4390916,65536,3735552,2147614720,4980762,4456478,4522008,2147549184,4980762,4587544,65536,4653067,65536,4718620,65536,4784154,65536,4849675,65536,4915233,65536,
+3604514,65536,131923979,2147549184,338231318,131989515,65536,131923979,2147549184,338296854,131989515,65536,131923979,2147549184,338362390,131989515,65536,131923979,2147549184,338427926,131989515,65536,338493682,2147483648,338559218,0,131072,0,338624516,0,27787268,0,338690052,0,3605604,0,1966082,2147549184,263913582,22937600,
+65536,28639236,65536,131923979,2147614720,270402553,170655766,131989515,131072,6,1836133,0,1901669,0,8781835,0,171835403,0,338755588,0,338821120,0,4,338887779,0,338953313,0,339018851,0,339084385,0,56,1835019,2147549184,4980762,1900555,65536,3801114,65536,3866655,
+65536,3932192,65536,3997696,65536,2097154,65536,2621444,65536,4063236,65536,4128772,65536,4194308,65536,4259844,65536,4325380,65536,4390916,65536,3735552,2147614720,4980762,4456478,4522008,2147549184,4980762,4587544,65536,4653067,65536,4718620,65536,4784154,65536,4849675,65536,4915233,65536,
+3604514,65536,24576098,2147483648,2228224,0,131072002,0,339148802,0,339214343,0,339279879,0,339345415,0,60358663,0,339410951,0,31522823,0,16121858,0,2097154,0,339476487,0,339542023,0,339607559,0,339673095,0,339738631,0,339804167,0,339869700,0,
+339935239,0,121569287,0,340000775,0,340066311,0,340131847,0,121634818,0,121700354,0,15073317,0,122552664,0,199557459,0,4653067,0,131923979,2147549184,136839190,131989515,65536,132055050,2147483648,48,1966080,2147549184,237503332,327090176,65536,327155712,65536,327221248,65536,2097154,
+65536,327286784,65536,327352320,65536,327417856,65536,327483392,65536,327548928,65536,44367872,65536,327614464,65536,327680000,65536,327745536,65536,327811079,65536,327876615,65536,327942151,65536,328007687,65536,328073223,65536,328138759,65536,328204295,65536,328269831,65536,328335367,65536,328400903,65536,328466439,
+65536,328531975,65536,328597511,65536,328663047,65536,328728580,65536,328794112,65536,8126488,65536,5308427,65536,340197383,2147483648,1179648,0,340262912,0,340328499,0,340393991,0,340459527,0,340525056,0,340590592,0,34537472,0,340656135,0,340721671,0,2097156,0,331153412,
+0,331218948,0,340787207,0,340852743,0,3,1836134,0,1901670,0,340918272,0,11,1836135,0,1901671,0,2162688,0,340983808,0,131923979,2147549184,341049366,131989515,65536,341114887,2147483648,341180418,0,3276800,0,341245959,0,341311495,0,3,1836136,
+0,1901672,0,341377024,0,22,1836137,0,1901673,0,2162688,0,1966080,0,29097984,0,131923979,2147549184,341442582,131989515,65536,341508096,2147483648,341573656,0,341640280,0,341704706,0,341770242,0,341835778,0,341901314,0,341966848,0,342032391,0,342097927,
+0,342163463,0,342228994,0,114491392,0,131923979,2147549184,342294550,131989515,65536,7,1836138,0,1901674,0,2162688,0,131923979,2147549184,307494934,131989515,65536,342360066,2147483648,1441792,0};
+
+int bfBlenderTablesLen=sizeof(bfBlenderTables)/sizeof(bfBlenderTables[0]);
 //===============================================================================================
 
 #endif //bftBlend_imp_
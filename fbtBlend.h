@@ -48,6 +48,51 @@
      -> Updated the "ID enums" (please search: [DNA_ID_enums 1/2] and [DNA_ID_enums 2/2]).
 
      -> Added some mods to change Chunk struct size fields if BLENDER_VERSION>=500 is defined
+
+     -> Added fbtFile::PM_MMAP: parse(path, fbtFile::PM_MMAP) maps an uncompressed .blend file in memory and
+        uses the chunk payloads in place (instead of copying each of them into the heap before link()).
+     -> fbtFile::parse(const void* memory, ...) borrows uncompressed memory instead of copying it (see its declaration).
+     -> fbtFile::parse(const char* path, ...) opens the file only once: its magic bytes (BLENDER, gzip or zstd) select the decoder.
+     -> Added #define FBT_USE_THREADS 1 (needs -pthread on POSIX): the frames of multi-frame zstd files are decompressed in parallel
+        (FBT_MAX_THREADS workers, one per core by default).
+     -> Added fbtZstdSeekableStream: random access to zstd files in the seekable format (only the frames covering
+        the bytes read are decompressed). parse(path) uses it when the file has a seek table.
+     -> With FBT_USE_THREADS, parse(path) reads (and inflates) uncompressed and gzip files on a worker thread,
+        FBT_READ_AHEAD_SIZE bytes ahead of the parser (fbtReadAheadStream).
+     -> Added fbtFile::scanChunks(...): lists the chunk headers (and their file offsets) without loading anything.
+     -> Added fbtFile::setLoadFilter(...): only the listed ID types (and the blocks they reach) are read and linked.
+     -> Chunk payloads, MemoryChunk records and linked blocks are bump allocated (fbtMemoryArena, FBT_ARENA_BLOCK_SIZE):
+        the payloads are released all together after linking, the rest with the fbtFile.
+     -> Old pointers are resolved through a sorted index of the chunk address ranges and are read whole: the file pointer
+        size and endianness are honored. With #define FBT_RESOLVE_INNER_POINTERS 1 the pointers into the middle of a block
+        resolve too (by default they become 0, as before: a stale pointer can land inside an unrelated block).
+     -> Added fbtFile::readThumbnail(...): reads the preview image (TEST chunk) only, stopping right after it.
+     -> With FBT_USE_THREADS, link() converts the blocks on the worker pool (pointer arrays first, notifyData() last,
+        both in file order).
+     -> link() compiles the conversion of each struct once (fbtFile::LinkOp plans: adjacent members merged into
+        single copy/swap/pointer runs) and runs it for every element.
+     -> Structs with a byte-identical layout in the file (fbtStruct::SAME_LAYOUT) are copied a block at a time:
+        only their pointers are patched.
+     -> Raw data and the blocks of identical layout are linked in place, in their payload (when the file was read
+        into the heap and the payload has an arena block of its own, which is kept); the other big payloads are
+        released as soon as they are converted, the small ones all together after linking.
+     -> fbtSwap16/32/64(pointer, len) swap whole arrays with AVX2/SSSE3/SSE2/NEON when the compiler targets them
+        (#define FBT_USE_SIMD 0: scalar only). link() swaps runs of members, and blocks of one type, in one call.
+     -> The old pointers of the chunk headers of files of the other endianness are swapped too (they did not match any block).
+     -> Number type changes between the file and the memory DNA (integer ones included, e.g. int -> short) go through
+        whole-array cast kernels (fbtGetCastKernel()), which replace castValue(): it zeroed the values it could not read
+        before writing them. copyValues() copies the right way.
+     -> Added fbtFile::setLazyLink(...): parse() converts the ID blocks only, the others are converted the first time
+        fbtFile::resolve(...)/get<T>(...) reach them (which pass the ID blocks the ID lists link through).
+     -> The file DNA tables are cached (fbtDNACache, FBT_DNA_CACHE_SIZE) by their DNA1 block (hashed, then compared), already
+        linked: the next files of the same Blender build skip reading, compiling and linking them. Linking only writes the
+        file tables (fbtFile::getFileTable() returns them const). The cache is freed at exit, once the last fbtFile is gone.
+     -> The memory DNA tables are built once per process and shared, read only, by every fbtFile (fbtFile::getMemoryTable()
+        returns them const).
+     -> fbtBlendUpdater saves the compiled memory tables next to bfBlenderFBT (bfBlenderTables): fbtBlend loads them
+        instead of running fbtBinTables::compile() (which still runs when they do not match the DNA).
+     -> fbtLinkCompiler matches the members of a struct through a hash index of the file members (base name, array index,
+        depth and key chain) instead of scanning all of them for each memory member.
 */
 #ifndef _fbtBlend_h_
 #define _fbtBlend_h_
@@ -64,6 +109,7 @@
 // global config settings
 //#define FBT_USE_GZ_FILE 1           // Adds support to PM_COMPRESSED .blend < 3.00 files (needs linking to zlib: -lz)
 //#define FBT_USE_ZSTD_FILE 1         // Adds support to PM_COMPRESSED .blend 3.00 files (needs linking to zlib: -lzstd)
+//#define FBT_USE_THREADS 1           // Decompresses multi-frame zstd files and links the blocks on a worker pool (needs -pthread on POSIX)
 #define fbtDEBUG        1           // Traceback detail
 //#define FBT_TYPE_LEN_VALIDATE   1   // Write a validation file (use MakeFBT.cmake->ADD_FBT_VALIDATOR to add a self validating build)
 // global config settings end
@@ -81,6 +127,11 @@
 #   undef FBT_USE_ZSTD_FILE
 #   define FBT_USE_ZSTD_FILE 1
 #endif
+// Workaround for people just defining FBT_USE_THREADS, without setting it to 1
+#ifdef FBT_USE_THREADS
+#   undef FBT_USE_THREADS
+#   define FBT_USE_THREADS 1
+#endif
 
 #include <string.h> //memcmp
 
@@ -116,8 +167,48 @@
 #       define FBT_ARRAY_SLOTS         2   // Maximum dimensional array, eg: (int m_member[..][..] -> [FBT_ARRAY_SLOTS])
 #   endif
 #endif
+#ifndef FBT_USE_MMAP_FILE
+#   define FBT_USE_MMAP_FILE       1   // PM_MMAP maps uncompressed files in memory (when 0, PM_MMAP falls back to PM_UNCOMPRESSED)
+#endif
+#ifndef FBT_IN_PLACE_ALIGNMENT
+#   define FBT_IN_PLACE_ALIGNMENT  4   // Memory backed chunk payloads are used in place only if aligned to this (otherwise they're copied)
+#endif
+#ifndef FBT_MAX_THREADS
+#   define FBT_MAX_THREADS         0   // Worker threads used when FBT_USE_THREADS is 1 (0: one per core)
+#endif
+#ifndef FBT_READ_AHEAD_SIZE
+#   define FBT_READ_AHEAD_SIZE     (4 << 20)   // Bytes a worker thread reads (and decompresses) ahead of the parser when FBT_USE_THREADS is 1 (0: none)
+#endif
+#ifndef FBT_ARENA_BLOCK_SIZE
+#   define FBT_ARENA_BLOCK_SIZE    (1 << 20)   // Chunk payloads and linked blocks are carved out of blocks this big (0: one malloc each)
+#endif
+#ifndef FBT_RESOLVE_INNER_POINTERS
+#   define FBT_RESOLVE_INNER_POINTERS 0   // Old pointers into the middle of a block resolve into its converted copy (0: they become 0)
+#endif
+#ifndef FBT_DNA_CACHE_SIZE
+#   define FBT_DNA_CACHE_SIZE      4   // File DNA tables (compiled and linked) kept for the next files of the same Blender build (0: none)
+#endif
+#ifndef FBT_USE_SIMD
+#   define FBT_USE_SIMD            1   // Bulk byte swapping uses the AVX2/SSSE3/SSE2/NEON instructions the compiler targets (0: scalar only)
+#endif
 // global config settings end
 
+#if FBT_USE_SIMD == 1
+#   if defined(__AVX2__)
+#       define FBT_SIMD_AVX2   1
+#       include <immintrin.h>
+#   elif defined(__SSSE3__)
+#       define FBT_SIMD_SSSE3  1
+#       include <tmmintrin.h>
+#   elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#       define FBT_SIMD_SSE2   1
+#       include <emmintrin.h>
+#   elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#       define FBT_SIMD_NEON   1
+#       include <arm_neon.h>
+#   endif
+#endif
+
 
 /** \addtogroup FBT
 *  @{
@@ -364,35 +455,90 @@ FBT_INLINE FBTuint64 fbtSwap64(const FBTuint64& in)
 }
 
 
-FBT_INLINE void fbtSwap16(FBTuint16* sp, FBTsize len)
+// Swaps the bytes of the first values of the len N-byte values at p, 16 or 32 bytes at a time:
+// returns how many it did (the caller swaps the rest). p needs no alignment.
+template <int N>
+FBT_INLINE FBTsize fbtSwapVector(FBTubyte* p, FBTsize len)
 {
-	FBTsizeType i;
-	for (i = 0; i < len; ++i)
+	const FBTsize bytes = len * N;
+	FBTsize i = 0;
+
+#if defined(FBT_SIMD_AVX2) || defined(FBT_SIMD_SSSE3)
+	// (shuffles pick bytes within 16 byte lanes)
+	static const FBTubyte order2[32] = {1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14,
+	                                    1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14};
+	static const FBTubyte order4[32] = {3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+	                                    3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12};
+	static const FBTubyte order8[32] = {7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8,
+	                                    7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8};
+	const FBTubyte* order = N == 2 ? order2 : (N == 4 ? order4 : order8);
+
+#   if defined(FBT_SIMD_AVX2)
+	const __m256i order32 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(order));
+	for (; i + 32 <= bytes; i += 32)
+	{
+		__m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i));
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(p + i), _mm256_shuffle_epi8(v, order32));
+	}
+#   endif
+	const __m128i order16 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(order));
+	for (; i + 16 <= bytes; i += 16)
+	{
+		__m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(p + i), _mm_shuffle_epi8(v, order16));
+	}
+#elif defined(FBT_SIMD_SSE2)
+	for (; i + 16 <= bytes; i += 16)
+	{
+		__m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+		v = _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+		if (N == 4)
+		{
+			v = _mm_shufflelo_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+			v = _mm_shufflehi_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+		}
+		else if (N == 8)
+		{
+			v = _mm_shufflelo_epi16(v, _MM_SHUFFLE(0, 1, 2, 3));
+			v = _mm_shufflehi_epi16(v, _MM_SHUFFLE(0, 1, 2, 3));
+		}
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(p + i), v);
+	}
+#elif defined(FBT_SIMD_NEON)
+	for (; i + 16 <= bytes; i += 16)
 	{
-		*sp = fbtSwap16(*sp);
-		++sp;	
-	}	
+		uint8x16_t v = vld1q_u8(p + i);
+		v = N == 2 ? vrev16q_u8(v) : (N == 4 ? vrev32q_u8(v) : vrev64q_u8(v));
+		vst1q_u8(p + i, v);
+	}
+#else
+	(void)p;
+	(void)bytes;
+#endif
+	return i / N;
+}
+
+
+FBT_INLINE void fbtSwap16(FBTuint16* sp, FBTsize len)
+{
+	FBTsize i = fbtSwapVector<2>(reinterpret_cast<FBTubyte*>(sp), len);
+	for (; i < len; ++i)
+		sp[i] = fbtSwap16(sp[i]);
 }
 
 FBT_INLINE void fbtSwap32(FBTuint32* ip, FBTsize len)
-{	 
-	FBTsizeType i;
-	for (i = 0; i < len; ++i)
-	{
-		*ip = fbtSwap32(*ip);
-		++ip;
-	}
+{
+	FBTsize i = fbtSwapVector<4>(reinterpret_cast<FBTubyte*>(ip), len);
+	for (; i < len; ++i)
+		ip[i] = fbtSwap32(ip[i]);
 }
 
 
 FBT_INLINE void fbtSwap64(FBTuint64* dp, FBTsize len)
-{	 
-	FBTsizeType i;
-	for (i = 0; i < len; ++i)
-	{
-		*dp = fbtSwap64(*dp);
-		++dp;
-	}
+{
+	FBTsize i = fbtSwapVector<8>(reinterpret_cast<FBTubyte*>(dp), len);
+	for (; i < len; ++i)
+		dp[i] = fbtSwap64(dp[i]);
 }
 
 
@@ -462,6 +608,40 @@ public:
 
 
 
+// Bump allocator: its memory is only released all together (clear() or destruction)
+class fbtMemoryArena
+{
+public:
+	enum {ALIGNMENT = 16};
+
+	fbtMemoryArena(FBTsize blockSize = FBT_ARENA_BLOCK_SIZE) : m_blocks(0), m_blockSize(blockSize) {}
+	~fbtMemoryArena() { clear(); }
+
+	void*   alloc(FBTsize size);    // ALIGNMENT aligned (if malloc() is), not zeroed: 0 on failure
+	void    clear(void);
+
+	// Big requests get a block of their own, that can be released before the others
+	bool    isOwnBlock(FBTsize size) const {return size > m_blockSize / 4;}
+	void    release(void* p);               // p: alloc(size) with isOwnBlock(size)
+	void    adopt(fbtMemoryArena& other, void* p);  // takes the block of p from other (p: other.alloc(size) with isOwnBlock(size))
+
+private:
+	struct Block
+	{
+		Block*  m_next, *m_prev;
+		FBTsize m_size, m_used;
+	};
+	enum {HEADER_SIZE = (sizeof(Block) + ALIGNMENT - 1) & ~(ALIGNMENT - 1)};
+
+	Block*  m_blocks;   // the first one is the one being filled
+	FBTsize m_blockSize;
+
+	fbtMemoryArena(const fbtMemoryArena&);
+	fbtMemoryArena& operator=(const fbtMemoryArena&);
+};
+
+
+
 template <typename T>
 class fbtArrayIterator
 {
@@ -1155,6 +1335,22 @@ public:
 		if (m_lastPos != FBT_NPOS && m_lastKey == hk)
 			return m_lastPos;
 
+		FBTsizeType fh = lookup(key);
+		if (fh != FBT_NPOS)
+		{
+			m_lastKey = hk;
+			m_lastPos = fh;
+		}
+		return fh;
+	}
+
+	// find() without the last hit memo: for tables read by several threads
+	FBTsizeType lookup(const Key& key) const
+	{
+		if (m_capacity == 0 || m_capacity == FBT_NPOS || m_size == 0)
+			return FBT_NPOS;
+
+		FBTsizeType hk = key.hash();
 		FBThash hr = _FBT_UTHASHTABLE_HKHASH(hk);
 
 		FBT_ASSERT(m_bptr && m_iptr && m_nptr);
@@ -1163,14 +1359,7 @@ public:
 		while (fh != FBT_NPOS && (key != m_bptr[fh].first))
 			fh = m_nptr[fh];
 
-
-		if (fh != FBT_NPOS)
-		{
-			m_lastKey = hk;
-			m_lastPos = fh;
-
-			FBT_ASSERT(fh >= 0  && fh < m_size);
-		}
+		FBT_ASSERT(fh == FBT_NPOS || (fh >= 0  && fh < m_size));
 		return fh;
 	}
 
@@ -1855,6 +2044,10 @@ FBT_INLINE bool fbtIsNumberType(FBTuint32 typeKey)
 	return tp != FBT_PRIM_VOID && tp != FBT_PRIM_UNKNOWN;
 }
 
+// Converts len values of a number type into another one (src needs no alignment)
+typedef void (*fbtCastKernel)(const void* src, void* dst, FBTsize len);
+fbtCastKernel fbtGetCastKernel(FBT_PRIM_TYPE src, FBT_PRIM_TYPE dst);  // 0 if either is not a number type
+
 
 
 /** @}*/
@@ -1904,9 +2097,18 @@ public:
 		PM_UNCOMPRESSED,
 		PM_COMPRESSED,
 		PM_READTOMEMORY,
+		PM_MMAP,            // uncompressed only: chunk payloads are used in place from the mapped file
 
 	};
 
+	enum FileCompression
+	{
+		FC_UNKNOWN,
+		FC_NONE,            // starts with the uncompressed file detector prefix ("BLENDER")
+		FC_GZIP,
+		FC_ZSTD,
+	};
+
 	enum FileHeader
 	{
 		FH_ENDIAN_SWAP  = (1 << 0),
@@ -1960,6 +2162,9 @@ public:
 		enum Flag
 		{
 			BLK_MODIFIED = (1 << 0),
+			BLK_EXTERNAL = (1 << 1),    // m_block points into the stream memory: it must not be freed
+			BLK_OWN_PAYLOAD = (1 << 2), // m_block has an m_payloads block of its own: released once converted
+			BLK_LINKED   = (1 << 3),    // lazy link: already converted (or found unconvertible)
 		};
 
 		MemoryChunk* m_next, *m_prev;
@@ -1972,6 +2177,18 @@ public:
 		FBTtype      m_newTypeId;
 	};
 
+	// A chunk header, as listed by scanChunks()
+	struct ChunkInfo
+	{
+		FBTuint64    m_offset;      // of the payload, in the (uncompressed) file
+		FBTuint64    m_len;
+		FBTuint64    m_old;
+		FBTuint64    m_nr;
+		FBTuint32    m_code;
+		FBTuint32    m_typeid;
+	};
+	typedef fbtArray<ChunkInfo> ChunkDirectory;
+
 public:
 
 
@@ -1980,8 +2197,40 @@ public:
 
     int parse(const char* path,const char* uncompressedFileDetectorPrefix="BLENDER");
     int parse(const char* path, int mode/* = PM_UNCOMPRESSED*/);
+    // Uncompressed memory is borrowed, not copied: the chunk table references it directly, so it must stay valid
+    // (and unmodified) until parse() returns. Nothing references it afterwards: the caller can free it right away.
     int parse(const void* memory, FBTsize sizeInBytes, int mode = PM_UNCOMPRESSED, bool suppressHeaderWarning=false);
 
+    // Lists the chunk headers in file order (ENDB excluded) without reading their payloads: they're seeked over
+    // (skipped on streams that can't seek, e.g. gzip). 'dnaIndex' (optional) gets the position of DNA1 in 'dir'
+    // (FBT_NPOS if missing). Nothing is loaded or linked: only getHeader() and getVersion() change.
+    int scanChunks(const char* path, ChunkDirectory& dir, FBTsizeType* dnaIndex = 0, const char* uncompressedFileDetectorPrefix="BLENDER");
+    int scanChunks(const void* memory, FBTsize sizeInBytes, ChunkDirectory& dir, FBTsizeType* dnaIndex = 0);
+
+    // Reads the preview image Blender stores (TEST chunk) near the start of the file: only the header and the leading
+    // REND/TEST chunks are read (compressed files are decompressed only that far), nothing is loaded or linked.
+    // 'pixels' gets width*height RGBA texels (bottom row first), that the caller must free using: delete[] pixels;
+    // Returns FS_FAILED (quietly) if the file has no preview.
+    int readThumbnail(const char* path, unsigned char*& pixels, int& width, int& height, const char* uncompressedFileDetectorPrefix="BLENDER");
+    int readThumbnail(const void* memory, FBTsize sizeInBytes, unsigned char*& pixels, int& width, int& height);
+
+    // Load filter: parse() loads only the chunks whose code is in 'idCodes' (0-terminated, e.g. FBT_ID2('O','B'))
+    // and the blocks their pointers reach. ID lists (id.next/prev) are not followed, and neither are the pointers of
+    // listed non ID chunks (e.g. GLOB). The list must stay valid while parsing: 0 (the default) loads everything.
+    // Streams that can seek (plain files, memory, mmap, seekable zstd) read only the payloads that are needed.
+    void setLoadFilter(const FBTuint32* idCodes) {m_loadFilter = idCodes;}
+
+    // Lazy link: parse() converts only the ID blocks (the ones notifyData() gets, e.g. the fbtBlend lists), the others
+    // are converted the first time they are resolved. Pointers inside the blocks keep their file value: resolve() returns
+    // what they point to (converting it if needed), get<T>() does the same with a cast. Without lazy link they just
+    // return the pointer (already resolved), so the same code works both ways. Resolving is not thread safe.
+    // The ID lists notifyData() links (id.next/prev, e.g. the fbtBlend lists) hold the converted ID blocks: resolve()
+    // returns them as they are, so they are walked the same way (e.g. ob = fp.get<Blender::Object>(ob->id.next)).
+    void setLazyLink(bool lazy) {m_lazyLink = lazy;}
+    void* resolve(const void* ptr);
+    void* resolve(const void* ptrArray, FBTsizeType index);    // element of a pointer array (e.g. Mesh::mat)
+    template <typename T> T* get(const void* ptr) {return static_cast<T*>(resolve(ptr));}
+
 	/// Saving in non native endianness is not implemented yet.
 	int reflect(const char* path, const int mode = PM_UNCOMPRESSED, const fbtEndian& endian = FBT_ENDIAN_NATIVE);
 
@@ -1991,8 +2240,8 @@ public:
 	const char*                 getPath(void)       const {return m_curFile; }
 
 
-	fbtBinTables* getMemoryTable(void)  {return m_memory;}
-	fbtBinTables* getFileTable(void)    {return m_file;}
+	const fbtBinTables* getMemoryTable(void)  const {return m_memory;}
+	const fbtBinTables* getFileTable(void)  const {return m_file;}   // shared with the files of the same DNA (fbtDNACache)
 
 
 	fbtList& getChunks(void) {return m_chunks;}
@@ -2004,6 +2253,8 @@ public:
     // General Programming Staic Helper Methods:
     static FILE* UTF8_fopen(const char* filename, const char* mode);    // Used to allow UTF8 chars on Windows
     static unsigned char* FBT_GetFileContent(const char *filePath,unsigned long* pSizeOut=NULL,const char modes[] = "rb");  // Returns a memory buffer (that user must free using: delete[] mybuffname;) with the content of 'filePath'.
+    static unsigned char* FBT_GetFileContent(FILE* f,unsigned long* pSizeOut=NULL);   // Same as above, for an already opened file (read from its start, 'f' is not closed).
+    static int GetFileCompression(const void* magic,FBTsize len,const char* uncompressedFileDetectorPrefix="BLENDER");  // Returns a FileCompression, from the first bytes of a file
 
 
 protected:
@@ -2030,13 +2281,57 @@ protected:
 	int m_version, m_fileVersion, m_fileHeader;
 	char* m_curFile;
 
-	typedef fbtHashTable<fbtSizeHashKey, MemoryChunk*> ChunkMap;
+	// The old address range of a chunk: [m_begin, m_end) in the file (an empty chunk still owns m_begin)
+	struct PtrRange
+	{
+		FBTsize      m_begin, m_end;
+		FBTsizeType  m_index;       // file order: the first chunk of an old pointer wins
+		MemoryChunk* m_chunk;
+	};
+	typedef fbtArray<PtrRange> PtrIndex;
+
+	// What converting one element of a file struct does: compiled once per struct by compilePlan(),
+	// with the adjacent members merged into single runs.
+	struct LinkOp
+	{
+		enum Code
+		{
+			OP_END,
+			OP_BLOCK,       // first op of fbtStruct::SAME_LAYOUT plans: every element at once (m_len: element size),
+			                // then swapped as m_swap byte values if a struct of one type only needs that
+			OP_COPY,        // m_len bytes
+			OP_SWAP,        // m_len values of m_srcSize bytes, swapped
+			OP_VALUES,      // m_len values, swapped (m_swap: byte count, or SWAP_ZERO) and/or cast
+			OP_PTR,         // m_len old pointers
+			OP_PTR_ARRAY,   // an old pointer to a pointer array (converted by linkPointerArrays())
+		};
+		enum {SWAP_ZERO = 0xFF};    // unknown type: the value is zeroed
+
+		FBTuint8 m_code;
+		FBTuint8 m_swap;
+		FBTint32 m_dst, m_src;          // member offsets
+		FBTint32 m_len;
+		FBTint32 m_srcSize, m_dstSize;  // per value (OP_SWAP, OP_VALUES)
+		fbtCastKernel m_cast;           // OP_VALUES: 0 copies the values
+	};
+
 	fbtList     m_chunks;
-	ChunkMap    m_map;
-	fbtBinTables* m_memory, *m_file;
+	PtrIndex    m_ptrIndex;         // of m_chunks, sorted by m_begin (built by link())
+	PtrIndex    m_idBlocks;         // lazy link: the converted ID blocks (m_begin: m_newBlock), that resolve() passes through
+	FBTsizeType m_lastRange;        // last m_ptrIndex hit
+	fbtArray<LinkOp>      m_linkOps;    // the plans, each one ended by OP_END (built by link())
+	fbtArray<FBTsizeType> m_linkPlans;  // per file struct: the m_linkOps index of its plan (FBT_NPOS: none)
+	const fbtBinTables* m_memory;   // shared by every fbtFile of the same memory DNA (fbtDNACache)
+	fbtBinTables* m_file;
+	const FBTuint32* m_loadFilter;
+	bool m_lazyLink;
+
+	fbtMemoryArena m_arena;         // MemoryChunk records and linked blocks (m_newBlock): released with the file
+	fbtMemoryArena m_payloads;      // chunk payloads (m_block): released when link() is done (the ones used in place go to m_arena)
 
 
     virtual bool skip(const FBTuint32& /*id*/) {return false;}
+	// Pointers into the middle of a block resolve too
 	void* findPtr(const FBTsize& iptr);
 	MemoryChunk* findBlock(const FBTsize& iptr);
 
@@ -2045,11 +2340,59 @@ protected:
 private:
 
 
+	// The decoder is selected by the magic bytes. 'scan' prefers streams that can seek to the ones reading
+	// everything faster (in parallel, or ahead of the parser). They return 0 (after reporting it) on failure.
+	fbtStream* openStream(const char* path, const char* uncompressedFileDetectorPrefix, bool scan);
+	fbtStream* openStream(FILE* fp, const char* path, int compression, bool scan);  // takes ownership of fp
+	static unsigned char* readFileContent(FILE* f, FBTsize& size);  // FBT_GetFileContent() with a pointer sized size
+	int parseStream(fbtStream* stream, const char* path);           // takes ownership of stream
+	int scanChunks(fbtStream* stream, ChunkDirectory& dir, FBTsizeType* dnaIndex);
+	int readChunkDirectory(fbtStream* stream, ChunkDirectory& dir, FBTsizeType* dnaIndex);
+	int readThumbnail(fbtStream* stream, unsigned char*& pixels, int& width, int& height);
 	int parseHeader(fbtStream* stream, bool suppressHeaderWarning=false);
 	int parseStreamImpl(fbtStream* stream, bool suppressHeaderWarning=false);
+	int insertChunk(const Chunk& chunk, void* block, bool inPlace);     // block: in place or from m_payloads
+	int buildPtrIndex(void);
+	void* findPtr(const FBTsize& iptr, FBTsizeType& lastRange);     // lastRange: the m_lastRange of a worker
+	MemoryChunk* findBlock(const FBTsize& iptr, FBTsizeType& lastRange) const;
+	void* findInnerPtr(MemoryChunk* bin, FBTsize offset);          // FBT_RESOLVE_INNER_POINTERS
+
+	static bool ptrRangeLess(const PtrRange& a, const PtrRange& b);
+	static void sortPtrIndex(PtrIndex& index);      // drops the later chunks of an old pointer
+	static FBTsizeType findPtrRange(const PtrIndex& index, FBTsize ptr);
+	int readFileTables(void* dna, FBTsize len);                         // takes ownership of dna
+	void releaseExternalBlocks(void);
+
+	enum ChunkState
+	{
+		CS_REACHED  = (1 << 0),
+		CS_IN_PLACE = (1 << 1),    // the payload points into the stream memory
+	};
+
+	// Load filter (m_loadFilter): parseFiltered() reads the payloads of seekable streams on demand,
+	// pruneChunks() drops what the others have already read.
+	int parseFiltered(fbtStream* stream);
+	int pruneChunks(void);
+	int markReachable(fbtStream* stream, const ChunkDirectory& dir, fbtArray<void*>& blocks, fbtArray<FBTuint8>& state);
 
-	int compileOffsets(void);
+	int compileOffsets(const fbtBinTables* memory, fbtBinTables* file);
 	int link(void);
+
+	// link() converts the pointer arrays (the only blocks other blocks change) first, then
+	// the blocks on their own: in parallel with FBT_USE_THREADS.
+	int newBlock(MemoryChunk* node);        // m_newBlock (in place, zeroed or raw copied), 0 if the chunk is not linked
+	int linkLazily(void);
+	void* linkBlock(MemoryChunk* node);     // lazy link: converted on first use
+	int compilePlan(FBTsizeType structId);  // structId: of m_file
+	void pushLinkOp(const LinkOp& op, FBTsizeType first);   // merges op into the last one of the plan when adjacent
+	int linkPointerArrays(MemoryChunk* node);
+	void convertBlock(MemoryChunk* node, FBTsizeType& lastRange);
+	void releasePayload(MemoryChunk* node);     // of BLK_OWN_PAYLOAD blocks no more in use
+	void keepPayload(MemoryChunk* node);        // moves the BLK_OWN_PAYLOAD block used in place to m_arena
+#if FBT_USE_THREADS == 1
+	struct LinkJob;
+	static void linkBatch(void* userData, FBTsize index, int worker);
+#endif
 };
 
 /** @}*/
@@ -2183,7 +2526,12 @@ public:
 	virtual FBTsize  position(void) const = 0;
 	virtual FBTsize  size(void) const = 0;
 
-    virtual FBTsize seek(FBTint32 /*off*/, FBTint32 /*way*/) {return 0;}
+    // returns the new position (fseek() semantics for 'way', offsets are 64 bit)
+    virtual FBTsize seek(FBTint64 /*off*/, FBTint32 /*way*/) {return 0;}
+
+	// Memory backed streams return the address of the next 'nr' bytes (and skip them),
+	// so that the caller can use them without copying. Returns 0 when 'nr' bytes must be read().
+    virtual void*   readInPlace(FBTsize /*nr*/) const {return 0;}
 
 protected:
     virtual void reserve(FBTsize /*nr*/) {}
@@ -2202,6 +2550,7 @@ public:
 	~fbtFileStream();
 
 	void open(const char* path, fbtStream::StreamMode mode);
+	void open(FILE* fp, fbtStream::StreamMode mode);    // takes ownership of an already opened file (rewound)
 	void close(void);
 
 	bool isOpen(void)   const {return m_handle != 0;}
@@ -2214,7 +2563,7 @@ public:
 
 	FBTsize  position(void) const;
 	FBTsize  size(void)     const;
-	FBTsize seek(FBTint32 off, FBTint32 way);
+	FBTsize seek(FBTint64 off, FBTint32 way);
 
 	void write(fbtMemoryStream &ms) const;
 
@@ -2224,12 +2573,44 @@ protected:
 	fbtFixedString<272> m_file;
 	fbtFileHandle       m_handle;
 	int                 m_mode;
-	int					m_size;
+	FBTsize             m_size;
 };
 
 
 
 
+#if FBT_USE_MMAP_FILE == 1
+// Read-only stream over a private (copy on write) memory mapping of a file
+class fbtMappedFileStream : public fbtStream
+{
+public:
+	fbtMappedFileStream();
+	~fbtMappedFileStream();
+
+	void open(const char* path, fbtStream::StreamMode mode);
+	void close(void);
+
+	bool     isOpen(void)    const   {return m_buffer != 0;}
+	bool     eof(void)       const   {return !m_buffer || m_pos >= m_size;}
+	FBTsize  position(void)  const   {return m_pos;}
+	FBTsize  size(void)      const   {return m_size;}
+
+	FBTsize  read(void* dest, FBTsize nr) const;
+	FBTsize  write(const void* /*src*/, FBTsize /*nr*/) {return -1;}
+
+	FBTsize  seek(FBTint64 off, FBTint32 way);
+
+	void*    readInPlace(FBTsize nr) const;
+
+protected:
+
+	char*            m_buffer;
+	mutable FBTsize  m_pos;
+	FBTsize          m_size;
+};
+#endif
+
+
 #if FBT_USE_GZ_FILE == 1
 class fbtGzStream : public fbtStream
 {
@@ -2238,6 +2619,7 @@ public:
 	~fbtGzStream();
 
 	void open(const char* path, fbtStream::StreamMode mode);
+	void open(FILE* fp, fbtStream::StreamMode mode);    // reads an already opened file from its start (fp is closed)
 	void close(void);
 
 	bool isOpen(void)   const {return m_handle != 0;}
@@ -2259,6 +2641,123 @@ protected:
 	fbtFixedString<272> m_file;
 	fbtFileHandle       m_handle;
 	int                 m_mode;
+	mutable FBTsize     m_pos;      // gztell() is only 32 bit on some platforms
+};
+#endif
+
+
+#if FBT_USE_ZSTD_FILE == 1
+// Read-only stream that decompresses a zstd file incrementally, as it's read
+// (memory usage: the decompression window plus a small input buffer)
+class fbtZstdStream : public fbtStream
+{
+public:
+	fbtZstdStream();
+	~fbtZstdStream();
+
+	void open(const char* path, fbtStream::StreamMode mode);
+	void open(FILE* fp, fbtStream::StreamMode mode);    // takes ownership of an already opened file (rewound)
+	void close(void);
+
+	bool isOpen(void)   const {return m_handle != 0;}
+	bool eof(void)      const {return !m_handle || m_eof;}
+
+	FBTsize  read(void* dest, FBTsize nr) const;
+	FBTsize  write(const void* /*src*/, FBTsize /*nr*/) {return -1;}
+
+	FBTsize  position(void) const {return m_pos;}
+	FBTsize  size(void) const {return 0;}
+
+	// watch it no size / seek
+
+protected:
+
+	fbtFileHandle       m_handle;
+	void*               m_dctx;
+	char*               m_inBuf;
+	FBTsize             m_inCapacity;
+	mutable FBTsize     m_inSize, m_inPos;
+	mutable FBTsize     m_pos;
+	mutable FBTsize     m_lastRet;
+	mutable bool        m_inEof, m_eof;
+};
+
+
+// Read-only stream over a zstd file in the seekable format (independent frames plus a seek table at its end, as
+// Blender writes them): any byte range can be read (and seek() works) decompressing only the frames covering it.
+// open() fails (isOpen() is false) if the file has no valid seek table.
+class fbtZstdSeekableStream : public fbtStream
+{
+public:
+	fbtZstdSeekableStream();
+	~fbtZstdSeekableStream();
+
+	void open(const char* path, fbtStream::StreamMode mode);
+	void open(FILE* fp, fbtStream::StreamMode mode);    // takes ownership of an already opened file (closed on failure)
+	void close(void);
+
+	bool isOpen(void)   const {return m_handle != 0;}
+	bool eof(void)      const {return !m_handle || m_pos >= m_size;}
+
+	FBTsize  read(void* dest, FBTsize nr) const;
+	FBTsize  write(const void* /*src*/, FBTsize /*nr*/) {return -1;}
+
+	FBTsize  position(void) const {return m_pos;}
+	FBTsize  size(void) const {return m_size;}
+	FBTsize  seek(FBTint64 off, FBTint32 way);
+
+	FBTsizeType getNumFrames(void) const {return m_dstOffsets.empty() ? 0 : m_dstOffsets.size() - 1;}
+
+protected:
+
+	bool readSeekTable(void);
+	bool loadFrame(FBTsizeType frame) const;
+
+	fbtFileHandle        m_handle;
+	void*                m_dctx;
+	fbtArray<FBTsize>    m_srcOffsets, m_dstOffsets;   // frame start offsets (plus the end ones), compressed and not
+	FBTsize              m_size;
+	mutable FBTsize      m_pos;
+	mutable char*        m_inBuf;
+	mutable char*        m_frameBuf;
+	mutable FBTsize      m_inCapacity, m_frameCapacity;
+	mutable FBTsizeType  m_frame;                       // the frame in m_frameBuf (FBT_NPOS if none)
+};
+#endif
+
+
+#if FBT_USE_THREADS == 1
+struct fbtReadAheadState;
+
+// Read-only stream reading another one on a worker thread, into a ring of buffers ahead of the consumer:
+// disk (and decompression) latency is hidden behind the parsing of what has been read already.
+class fbtReadAheadStream : public fbtStream
+{
+public:
+	fbtReadAheadStream();
+	~fbtReadAheadStream();
+
+	// takes ownership of 'source' (open for reading): 'readAheadSize' bytes are split into 'numBuffers' buffers
+	void open(fbtStream* source, FBTsize readAheadSize = FBT_READ_AHEAD_SIZE, int numBuffers = 4);
+	void close(void);
+
+	bool isOpen(void)   const {return m_state != 0;}
+	bool eof(void)      const;
+
+	FBTsize  read(void* dest, FBTsize nr) const;
+	FBTsize  write(const void* /*src*/, FBTsize /*nr*/) {return -1;}
+
+	FBTsize  position(void) const {return m_pos;}
+	FBTsize  size(void) const {return m_size;}
+
+	// only backwards, within the last buffer read
+	FBTsize  seek(FBTint64 off, FBTint32 way);
+
+protected:
+
+	fbtReadAheadState*  m_state;
+	FBTsize             m_size;
+	mutable FBTsize     m_pos;
 };
 #endif
 
@@ -2274,7 +2773,9 @@ public:
 	void open(fbtStream::StreamMode mode);
 	void open(const char* path, fbtStream::StreamMode mode);
 	void open(const fbtFileStream& fs, fbtStream::StreamMode mode);
-	void open(const void* buffer, FBTsize size, fbtStream::StreamMode mode,bool compressed=false);
+	// borrow: reference 'buffer' (uncompressed only) instead of copying it. It must outlive the stream (or the
+	// next open()/clear()) and it's never written: write() and reserve() detach the stream into a private copy first.
+	void open(const void* buffer, FBTsize size, fbtStream::StreamMode mode,bool compressed=false,bool borrow=false);
 
 
 	bool     isOpen(void)    const   {return m_buffer != 0;}
@@ -2286,15 +2787,17 @@ public:
 	FBTsize  write(const void* src, FBTsize nr);
 	FBTsize  writef(const char* buf, ...);
 #if FBT_USE_GZ_FILE == 1
-	bool gzipInflate( char* inBuf, int inSize);
+	bool gzipInflate( char* inBuf, FBTsize inSize);
 #endif
 #if FBT_USE_ZSTD_FILE == 1
-	bool zstdInflate( char* inBuf, int inSize);
+	bool zstdInflate( char* inBuf, FBTsize inSize);
 #endif
 	void*            ptr(void)          {return m_buffer;}
 	const void*      ptr(void) const    {return m_buffer;}
 
-	FBTsize seek(FBTint32 off, FBTint32 way);
+	FBTsize seek(FBTint64 off, FBTint32 way);
+
+	void*   readInPlace(FBTsize nr) const;
 
 
 	void reserve(FBTsize nr);
@@ -2306,6 +2809,7 @@ protected:
 	mutable FBTsize  m_pos;
 	FBTsize          m_size, m_capacity;
 	int              m_mode;
+	bool             m_borrowed;
 };
 
 /** @}*/
@@ -2396,7 +2900,8 @@ public:
 		MISSING     = (1 << 0),
 		MISALIGNED  = (1 << 1),
 		SKIP        = (1 << 2),
-		NEED_CAST	= (1 << 3)
+		NEED_CAST	= (1 << 3),
+		SAME_LAYOUT = (1 << 4)     // byte-identical to its m_link (set on the file side by fbtLinkCompiler)
 	};
 
 
@@ -2424,7 +2929,7 @@ public:
 	FBTint32        m_strcId;
 	FBTint32        m_flag;
 	Members         m_members;
-	fbtStruct*      m_link;		//file/memory table struct link
+	fbtStruct*      m_link;		//file table: the memory table struct it converts to (0 in the memory table)
 	Keys            m_keyChain; //parent key hash chain(0: type hash, 1: name hash), size() == m_dp
 
 	FBTsizeType     getUnlinkedMemberCount();
@@ -2459,9 +2964,12 @@ public:
 	~fbtBinTables();
 
 	bool read(bool swap);
-	bool read(const void* ptr, const FBTsize& len, bool swap);
 
-	FBTtype findTypeId(const fbtCharHashKey &cp);
+	// compiled: the output of compile() saved by fbtBlendUpdater next to the DNA (bfBlenderTables),
+	// loaded instead of compiling the tables again (compile() runs when it does not match the DNA)
+	bool read(const void* ptr, const FBTsize& len, bool swap, const FBTuint32* compiled = 0, FBTsize compiledLen = 0);
+
+	FBTtype findTypeId(const fbtCharHashKey &cp) const;
 
 	const char* getStructType(const fbtStruct* strc);
 	const char* getStructName(const fbtStruct* strc);
@@ -2490,9 +2998,11 @@ private:
 
 	TypeFinder m_typeFinder;
 
+	fbtStruct* putStruct(FBTuint32 i);
 	void putMember(FBTtype* cp, fbtStruct* off, FBTtype nr, FBTuint32& cof, FBTuint32 depth, fbtStruct::Keys& keys);
 	void compile(FBTtype i, FBTtype nr, fbtStruct* off, FBTuint32& cof, FBTuint32 depth, fbtStruct::Keys& keys);
 	void compile(void);
+	bool load(const FBTuint32* compiled, FBTsize compiledLen, FBTsize len);
 	bool sikp(const FBTuint32& type);
 
 };
@@ -2519,6 +3029,15 @@ private:
 # include <windows.h>
 # include <io.h>
 #else
+# include <unistd.h>
+# if FBT_USE_MMAP_FILE == 1
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <fcntl.h>
+# endif
+# if FBT_USE_THREADS == 1
+#  include <pthread.h>
+# endif
 #endif
 
 #include <stdio.h>
@@ -2541,8 +3060,124 @@ private:
 # define fbtp_printf vsnprintf
 #endif
 
+// 64 bit file offsets (32 bit POSIX builds also need _FILE_OFFSET_BITS=64 defined before any include)
+#if FBT_COMPILER == FBT_COMPILER_MSVC
+#   define fbtFseek(fp, off, way)   _fseeki64(fp, (__int64)(off), way)
+#   define fbtFtell(fp)             ((FBTint64)_ftelli64(fp))
+#elif FBT_PLATFORM == FBT_PLATFORM_WIN32
+#   define fbtFseek(fp, off, way)   fseeko64(fp, (off64_t)(off), way)
+#   define fbtFtell(fp)             ((FBTint64)ftello64(fp))
+#else
+#   define fbtFseek(fp, off, way)   fseeko(fp, (off_t)(off), way)
+#   define fbtFtell(fp)             ((FBTint64)ftello(fp))
+#endif
+
 #endif//_fbtPlatformHeaders_h_
 
+//#include "fbtThreads.h"
+#ifndef _fbtThreads_h_
+#define _fbtThreads_h_
+
+// Guards the few process-wide tables (it needs no thread library). A zeroed one is unlocked,
+// so a static one needs no constructor.
+class fbtSpinLock
+{
+public:
+	void lock(void);
+	void unlock(void);
+
+	volatile long m_locked;
+};
+
+#if FBT_USE_THREADS == 1
+
+class fbtMutex
+{
+public:
+	fbtMutex();
+	~fbtMutex();
+
+	void lock(void);
+	void unlock(void);
+
+private:
+	fbtMutex(const fbtMutex&);
+	fbtMutex& operator=(const fbtMutex&);
+
+#if FBT_PLATFORM == FBT_PLATFORM_WIN32
+	CRITICAL_SECTION m_cs;
+#else
+	pthread_mutex_t  m_mutex;
+#endif
+};
+
+
+class fbtSemaphore
+{
+public:
+	fbtSemaphore(int count = 0);
+	~fbtSemaphore();
+
+	void wait(void);    // blocks until the count is positive, then decrements it
+	void post(void);
+
+private:
+	fbtSemaphore(const fbtSemaphore&);
+	fbtSemaphore& operator=(const fbtSemaphore&);
+
+#if FBT_PLATFORM == FBT_PLATFORM_WIN32
+	HANDLE           m_handle;
+#else
+	pthread_mutex_t  m_mutex;
+	pthread_cond_t   m_cond;
+	int              m_count;
+#endif
+};
+
+
+class fbtThread
+{
+public:
+	typedef void (*Func)(void* arg);
+
+	fbtThread();
+	~fbtThread();   // joins
+
+	bool start(Func func, void* arg);
+	void join(void);
+
+	bool isRunning(void) const {return m_running;}
+
+private:
+	fbtThread(const fbtThread&);
+	fbtThread& operator=(const fbtThread&);
+
+	Func            m_func;
+	void*           m_arg;
+	bool            m_running;
+#if FBT_PLATFORM == FBT_PLATFORM_WIN32
+	HANDLE          m_handle;
+	static DWORD WINAPI entry(LPVOID self);
+#else
+	pthread_t       m_handle;
+	static void*    entry(void* self);
+#endif
+};
+
+
+// Calls func(userData, index, worker) for every index in [0, count), handing indices out one at a time
+// to 'numThreads' workers (the calling thread is worker 0). 'worker' is in [0, numThreads): use it to
+// index per-thread state. Returns when all the calls have returned.
+typedef void (*fbtParallelForFunc)(void* userData, FBTsize index, int worker);
+void fbtParallelFor(FBTsize count, int numThreads, fbtParallelForFunc func, void* userData);
+
+// FBT_MAX_THREADS, or the number of cores if it's 0
+int  fbtGetNumThreads(void);
+
+#endif
+
+#endif//_fbtThreads_h_
+
 // Common Identifiers
 const FBTuint32 ENDB = FBT_ID('E', 'N', 'D', 'B');
 const FBTuint32 DNA1 = FBT_ID('D', 'N', 'A', '1');
@@ -2585,43 +3220,101 @@ struct fbtChunk
 };
 
 
+// Process-wide, read only once built:
+// - the memory tables, one per memory DNA (getFBT()): built by the first fbtFile that needs them, kept for good.
+// - the file tables (compiled, then linked to memory tables) of the DNA1 blocks parsed, shared by the fbtFiles
+//   reading the same block (Blender writes the same one for the same build). FBT_DNA_CACHE_SIZE unused ones
+//   are kept, the least recently used go first.
+class fbtDNACache
+{
+public:
+	struct Key
+	{
+		const fbtBinTables* m_memory;
+		const void*         m_dna;      // the DNA1 block (as in the file): compared on a hash hit
+		FBTuint64           m_hash;     // of m_dna
+		FBTsize             m_len;
+		FBTuint8            m_ptr;
+		bool                m_swap;
+	};
 
+	static FBTuint64 hash(const void* dna, FBTsize len);
 
-fbtFile::fbtFile(const char* uid)
-    :   m_uhid(uid), m_aluhid(0), m_version(-1), m_fileVersion(0), m_fileHeader(0),
-        m_curFile(0), m_memory(0), m_file(0)
-{
-}
+	// the memory tables of 'fbt' (0 if not built yet)
+	static const fbtBinTables* findMemory(const void* fbt, FBTsize len);
 
+	// shares 'memory' (or the tables an other fbtFile built first: 'memory' is then deleted)
+	static const fbtBinTables* insertMemory(const void* fbt, FBTsize len, fbtBinTables* memory);
 
-fbtFile::~fbtFile()
-{
-	if (m_curFile)
-		fbtFree(m_curFile);
-	m_curFile = 0;
+	// the file tables of 'key' (0 if not cached): release() them when done
+	static fbtBinTables* find(const Key& key);
 
-	MemoryChunk* node = (MemoryChunk*)m_chunks.first, *tnd;
-	while (node)
-	{
-		if (node->m_block)
-		{
-			//printf("free  m_block: 0x%x\n", node->m_block);fflush(stdout);
-			fbtFree(node->m_block);
-		}
-		if (node->m_newBlock)
-		{
-			//printf("free m_newBlock: 0x%x\n", node->m_newBlock);fflush(stdout);
-			fbtFree(node->m_newBlock);
-		}
+	// shares 'file' (or the tables of an other fbtFile that got there first: 'file' is then deleted).
+	// Takes ownership of key.m_dna (fbtMalloc()ed: the tables swap theirs).
+	static fbtBinTables* insert(const Key& key, fbtBinTables* file);
 
-		tnd  = node;
-		node = node->m_next;
+	static void release(fbtBinTables* file);
 
-		fbtFree(tnd);
-	}
+	// Every fbtFile is counted: the cache (memory tables included) is freed at exit, once the last one is gone
+	static void addFile(void);
+	static void removeFile(void);
 
-	delete m_file;
-	delete m_memory;
+private:
+	struct Memory
+	{
+		Memory*             m_next;
+		const void*         m_fbt;
+		FBTsize             m_len;
+		const fbtBinTables* m_tables;
+	};
+
+	struct Entry
+	{
+		Entry*        m_next;
+		Key           m_key;
+		fbtBinTables* m_file;
+		int           m_users;
+	};
+
+	struct Teardown
+	{
+		~Teardown();
+	};
+
+	static Entry* trim(void);
+	static void   destroy(Entry* list);
+	static void   clear(void);      // (under s_lock, no fbtFile left)
+
+	static Memory*     s_memory;
+	static Entry*      s_first;     // most recently used first
+	static fbtSpinLock s_lock;
+	static int         s_files;
+	static bool        s_exiting;
+	static Teardown    s_teardown;
+};
+
+
+
+
+fbtFile::fbtFile(const char* uid)
+    :   m_uhid(uid), m_aluhid(0), m_version(-1), m_fileVersion(0), m_fileHeader(0),
+        m_curFile(0), m_lastRange(FBT_NPOS), m_memory(0), m_file(0), m_loadFilter(0), m_lazyLink(false)
+{
+	fbtDNACache::addFile();
+}
+
+
+fbtFile::~fbtFile()
+{
+	if (m_curFile)
+		fbtFree(m_curFile);
+	m_curFile = 0;
+
+	// the chunk records, their payloads and linked blocks go away with the arenas
+	m_chunks.clear();
+
+	fbtDNACache::release(m_file);
+	fbtDNACache::removeFile();
 }
 
 bool fbtFile::FileStartsWith(const char* path,const char* cmp) {
@@ -2631,10 +3324,10 @@ bool fbtFile::FileStartsWith(const char* path,const char* cmp) {
     bool match = false;
     FILE* f = UTF8_fopen(path,"rb");
     if (f) {
-        if (fseek(f, 0, SEEK_END))  {fclose(f);return match;}
-        const long f_size = ftell(f);
-        if (f_size<=0 || (size_t)f_size < numCharsToMatch)    {fclose(f);return match;}
-        if (fseek(f, 0, SEEK_SET))  {fclose(f);return match;}
+        if (fbtFseek(f, 0, SEEK_END))  {fclose(f);return match;}
+        const FBTint64 f_size = fbtFtell(f);
+        if (f_size<=0 || (FBTuint64)f_size < numCharsToMatch)    {fclose(f);return match;}
+        if (fbtFseek(f, 0, SEEK_SET))  {fclose(f);return match;}
         char buff[256]="";
         if (fread(buff,numCharsToMatch,1,f) && strncmp(buff,cmp,numCharsToMatch)==0) match = true;
         fclose(f);
@@ -2673,69 +3366,206 @@ unsigned char* fbtFile::FBT_GetFileContent(const char *filePath,unsigned long* p
     if (!filePath) return ptr;
     FILE* f;
     if ((f = fbtFile::UTF8_fopen(filePath, modes)) == NULL) return ptr;
-    if (fseek(f, 0, SEEK_END))  {fclose(f);return ptr;}
-    const long f_size_signed = ftell(f);
-    if (f_size_signed == -1)    {fclose(f);return ptr;}
-    size_t f_size = (size_t)f_size_signed;
-    if (fseek(f, 0, SEEK_SET))  {fclose(f);return ptr;}
+    ptr = FBT_GetFileContent(f,pSizeOut);
+    fclose(f);
+    return ptr;
+}
+
+unsigned char* fbtFile::FBT_GetFileContent(FILE* f,unsigned long* pSizeOut)   {
+    if (pSizeOut) *pSizeOut=0;
+    FBTsize f_size = 0;
+    unsigned char* ptr = readFileContent(f,f_size);
+    if (ptr && (FBTsize)(unsigned long)f_size != f_size)  {delete[] (ptr);ptr=NULL;}  // too big for unsigned long (Win64)
+    else if (ptr && pSizeOut) *pSizeOut=(unsigned long)f_size;
+    return ptr;
+}
+
+unsigned char* fbtFile::readFileContent(FILE* f,FBTsize& size)   {
+    unsigned char* ptr = NULL;
+    size = 0;
+    if (!f) return ptr;
+    if (fbtFseek(f, 0, SEEK_END))  return ptr;
+    const FBTint64 f_size_signed = fbtFtell(f);
+    if (f_size_signed == -1)    return ptr;
+    FBTsize f_size = (FBTsize)f_size_signed;
+    if ((FBTint64)f_size != f_size_signed) return ptr;  // too big for this platform
+    if (fbtFseek(f, 0, SEEK_SET))  return ptr;
     ptr = new unsigned char[f_size];
     if (!ptr) return ptr;
     const size_t f_size_read = f_size>0 ? fread((unsigned char*)ptr, 1, f_size, f) : 0;
-    fclose(f);
     if (f_size_read == 0 || f_size_read!=f_size)    {delete[] (ptr);ptr=NULL;}
-    else if (pSizeOut) *pSizeOut=f_size;
+    else size=f_size;
     return ptr;
 }
 
+int fbtFile::GetFileCompression(const void* magic, FBTsize len, const char* uncompressedFileDetectorPrefix)    {
+    const unsigned char* cp = (const unsigned char*) magic;
+    if (!cp) return FC_UNKNOWN;
+    if (uncompressedFileDetectorPrefix) {
+        const size_t numCharsToMatch = strlen(uncompressedFileDetectorPrefix);
+        if (numCharsToMatch>0 && len>=numCharsToMatch && strncmp((const char*)cp,uncompressedFileDetectorPrefix,numCharsToMatch)==0) return FC_NONE;
+    }
+    if (len>=2 && cp[0]==0x1F && cp[1]==0x8B) return FC_GZIP;
+    if (len>=4 && cp[0]==0x28 && cp[1]==0xB5 && cp[2]==0x2F && cp[3]==0xFD) return FC_ZSTD;
+    if (len>=4 && (cp[0]&0xF0)==0x50 && cp[1]==0x2A && cp[2]==0x4D && cp[3]==0x18) return FC_ZSTD;    // skippable frame
+    return FC_UNKNOWN;
+}
+
 int fbtFile::parse(const char* path,const char* uncompressedFileDetectorPrefix)    {
-    return parse(path,FileStartsWith(path,uncompressedFileDetectorPrefix) ? PM_UNCOMPRESSED : PM_COMPRESSED);
+    // the load filter reads only the payloads it needs: it prefers streams that can seek
+    fbtStream* stream = openStream(path,uncompressedFileDetectorPrefix,m_loadFilter!=0);
+    if (!stream) return FS_FAILED;
+    return parseStream(stream,path);
 }
 
 int fbtFile::parse(const char* path, int mode)
 {
-	fbtStream* stream = 0;
+	// the magic bytes are more reliable than the caller
+	if (mode == PM_UNCOMPRESSED || mode == PM_COMPRESSED)
+		return parse(path, m_uhid);
 
-#   if ((FBT_USE_ZSTD_FILE==1) && (BLENDER_VERSION>=300))
-    if (mode==PM_COMPRESSED)    {
-        unsigned long memorySize = 0;
-        unsigned char* memory = fbtFile::FBT_GetFileContent(path,&memorySize,"rb");
-        int rv = FS_FAILED;
-        if (memory) {
-            rv = parse((const void*) memory, memorySize, mode, /*bool suppressHeaderWarning*/false); // rv == -4 is FS_INV_READ
-            delete[] (memory);memory=NULL;memorySize=0;
-        }
-        if (rv==FS_OK) return rv;
-        else {
-            fbtPrintf("Warning: fbtFile::parse(\"%s\" has failed with error code %d, when using the zstd decoder.",path,rv);
-#           if FBT_USE_GZ_FILE == 1
-            fbtPrintf("Trying with the gzip decoder now.");
-#           endif
-        }
-    }
-#   endif //((FBT_USE_ZSTD_FILE==1) && (BLENDER_VERSION>=300))
+#   if FBT_USE_MMAP_FILE != 1
+	if (mode == PM_MMAP)
+		return parse(path, m_uhid);
+#   endif
 
-	if (mode == PM_UNCOMPRESSED || mode == PM_COMPRESSED)
+	fbtStream* stream = 0;
+
+#   if FBT_USE_MMAP_FILE == 1
+	if (mode == PM_MMAP)
 	{
-#   if FBT_USE_GZ_FILE == 1
-		if (mode == PM_COMPRESSED)  {
-            stream = new fbtGzStream();
-	    }
-		else
-#   endif  // FBT_USE_GZ_FILE == 1
+		stream = new fbtMappedFileStream();
+		stream->open(path, fbtStream::SM_READ);
+
+		if (!stream->isOpen())
 		{
+			// (e.g. empty files): let the plain file stream report it
+			delete stream;
 			stream = new fbtFileStream();
+			stream->open(path, fbtStream::SM_READ);
 		}
-		stream->open(path, fbtStream::SM_READ);
 	}
 	else
+#   endif
 	{
 		stream = new fbtMemoryStream();
 		stream->open(path, fbtStream::SM_READ);
 	}
 
+	return parseStream(stream, path);
+}
+
+
+fbtStream* fbtFile::openStream(const char* path, const char* uncompressedFileDetectorPrefix, bool scan)
+{
+	// The file is opened only once: its magic bytes select the decoder, that gets the same file handle
+	FILE* fp = UTF8_fopen(path,"rb");
+	if (!fp)
+	{
+		fbtPrintf("File '%s' loading failed\n", path);
+		return 0;
+	}
+	unsigned char magic[256];
+	size_t magicLen = uncompressedFileDetectorPrefix ? strlen(uncompressedFileDetectorPrefix) : 0;
+	magicLen = fread(magic,1,fbtClamp<size_t>(magicLen,4,sizeof(magic)),fp);
+	int compression = GetFileCompression(magic,magicLen,uncompressedFileDetectorPrefix);
+	if (compression==FC_UNKNOWN) compression = FC_NONE;    // e.g. stripped files: parseHeader() will tell
+	return openStream(fp,path,compression,scan);
+}
+
+
+fbtStream* fbtFile::openStream(FILE* fp, const char* path, int compression, bool scan)
+{
+	fbtStream* stream = 0;
+	(void)scan;
+	(void)path;     // (reported when a decoder is missing)
+
+	switch (compression)
+	{
+	case FC_GZIP:
+		{
+#   if FBT_USE_GZ_FILE == 1
+			fbtGzStream* gs = new fbtGzStream();
+			gs->open(fp, fbtStream::SM_READ);
+			stream = gs;
+#   else
+			fbtPrintf("File '%s' is gzip compressed (FBT_USE_GZ_FILE is needed)\n", path);
+			fclose(fp);
+			return 0;
+#   endif
+		}
+		break;
+	case FC_ZSTD:
+		{
+#   if FBT_USE_ZSTD_FILE == 1
+#       if FBT_USE_THREADS == 1
+			if (!scan)
+			{
+				// the whole file is needed to decompress its frames in parallel
+				FBTsize size = 0;
+				unsigned char* buffer = readFileContent(fp, size);
+				fclose(fp);
+				fbtMemoryStream* ms = new fbtMemoryStream();
+				if (buffer)
+				{
+					ms->open(buffer, size, fbtStream::SM_READ, true);
+					delete [] buffer;
+				}
+				stream = ms;
+				break;
+			}
+#       endif
+			// files with a seek table (Blender writes it) can also seek(), the others are decompressed as a stream
+			fbtZstdSeekableStream* ss = new fbtZstdSeekableStream();
+			ss->open(fp, fbtStream::SM_READ);
+			if (ss->isOpen())
+				stream = ss;
+			else
+			{
+				delete ss;
+				fbtZstdStream* zs = new fbtZstdStream();
+				zs->open(fp, fbtStream::SM_READ);
+				stream = zs;
+			}
+#   else
+			fbtPrintf("File '%s' is zstd compressed (FBT_USE_ZSTD_FILE is needed)\n", path);
+			fclose(fp);
+			return 0;
+#   endif
+		}
+		break;
+	default:
+		{
+			fbtFileStream* fs = new fbtFileStream();
+			fs->open(fp, fbtStream::SM_READ);
+			stream = fs;
+		}
+		break;
+	}
+
+#   if FBT_USE_THREADS == 1 && FBT_READ_AHEAD_SIZE > 0
+	// zstd files are already in memory at this point
+	if (!scan && compression != FC_ZSTD && stream->isOpen())
+	{
+		fbtReadAheadStream* ras = new fbtReadAheadStream();
+		ras->open(stream);
+		if (ras->isOpen())
+			stream = ras;
+		else
+			delete ras;
+	}
+#   endif
+
+	return stream;
+}
+
+
+int fbtFile::parseStream(fbtStream* stream, const char* path)
+{
 	if (!stream->isOpen())
 	{
 		fbtPrintf("File '%s' loading failed\n", path);
+		delete stream;
 		return FS_FAILED;
 	}
 
@@ -2753,6 +3583,7 @@ int fbtFile::parse(const char* path, int mode)
 	}
 
     int result = parseStreamImpl(stream);
+	releaseExternalBlocks();
 	delete stream;
 	return result;
 }
@@ -2762,144 +3593,102 @@ int fbtFile::parse(const char* path, int mode)
 int fbtFile::parse(const void* memory, FBTsize sizeInBytes, int mode, bool suppressHeaderWarning)
 {
 	fbtMemoryStream ms;
-	ms.open( memory, sizeInBytes, fbtStream::SM_READ, mode==PM_COMPRESSED );
+	ms.open( memory, sizeInBytes, fbtStream::SM_READ, mode==PM_COMPRESSED, mode!=PM_COMPRESSED );
 
 	if (!ms.isOpen())
 	{
-		fbtPrintf("Memory %p(%i) loading failed\n", memory, sizeInBytes);
+		fbtPrintf("Memory %p(%llu) loading failed\n", memory, (unsigned long long)sizeInBytes);
 		return FS_FAILED;
 	}
 
-	return parseStreamImpl(&ms,suppressHeaderWarning);
+	int result = parseStreamImpl(&ms,suppressHeaderWarning);
+	releaseExternalBlocks();
+	return result;
 }
 
 
 
-int fbtFile::parseHeader(fbtStream* stream, bool suppressHeaderWarning)
+int fbtFile::scanChunks(const char* path, ChunkDirectory& dir, FBTsizeType* dnaIndex, const char* uncompressedFileDetectorPrefix)
 {
-    m_header.resize(FBT_BLEND_HEADER_SIZE);
-    stream->read(m_header.ptr(), FBT_BLEND_HEADER_SIZE);
-
-#   if BLENDER_VERSION<500
-    /**
-     * Low level version 0: the m_header is 12 bytes long.
-     * 0-6:  'BLENDER'
-     * 7:    '-' for 8-byte pointers (#SmallBHead8) or '_' for 4-byte pointers (#BHead4)
-     * 8:    'v' for little endian or 'V' for big endian
-     * 9-11: 3 ASCII digits encoding #BLENDER_FILE_VERSION (e.g. '305' for Blender 3.5)
-     */
+	dir.clear();
+	if (dnaIndex)
+		*dnaIndex = FBT_NPOS;
 
-    if (!fbtCharNEq(m_header.c_str(), m_uhid, 6) && !fbtCharNEq(m_header.c_str(), m_aluhid, 7))
+	fbtStream* stream = openStream(path, uncompressedFileDetectorPrefix, true);
+	if (!stream)
+		return FS_FAILED;
+	if (!stream->isOpen())
 	{
-		if (!suppressHeaderWarning)
-			fbtPrintf("Unknown header ID '%s'\n", m_header.c_str());
-		return FS_INV_HEADER_STR;
+		fbtPrintf("File '%s' loading failed\n", path);
+		delete stream;
+		return FS_FAILED;
 	}
 
-	char* headerMagic = (m_header.ptr() + 7);
+	int result = scanChunks(stream, dir, dnaIndex);
+	delete stream;
+	return result;
+}
 
-	m_fileHeader = 0;
-	m_fileVersion = 0;
 
-	if (*(headerMagic++) == FM_64_BIT)
-	{
-		m_fileHeader |= FH_CHUNK_64;
-		if (FBT_VOID4)
-			m_fileHeader |= FH_VAR_BITS;
-	}
-	else if (FBT_VOID8)
-		m_fileHeader |= FH_VAR_BITS;
+int fbtFile::scanChunks(const void* memory, FBTsize sizeInBytes, ChunkDirectory& dir, FBTsizeType* dnaIndex)
+{
+	dir.clear();
+	if (dnaIndex)
+		*dnaIndex = FBT_NPOS;
 
+	const int compression = GetFileCompression(memory, sizeInBytes, m_uhid);
+	const bool compressed = compression == FC_GZIP || compression == FC_ZSTD;
 
-	if (*(headerMagic++) == FM_BIG_ENDIAN)
+	fbtMemoryStream ms;
+	ms.open(memory, sizeInBytes, fbtStream::SM_READ, compressed, !compressed);
+
+	if (!ms.isOpen())
 	{
-		if (FBT_ENDIAN_IS_LITTLE)
-			m_fileHeader |= FH_ENDIAN_SWAP;
+		fbtPrintf("Memory %p(%llu) loading failed\n", memory, (unsigned long long)sizeInBytes);
+		return FS_FAILED;
 	}
-	else if (FBT_ENDIAN_IS_BIG)
-		m_fileHeader |= FH_ENDIAN_SWAP;
-
-
-	m_fileVersion = atoi(headerMagic);
-#else
-    /**
-     * Lower level version 1: the m_header is 17 bytes long.
-     * 0-6:   'BLENDER'
-     * 7-8:   size of the header in bytes encoded as ASCII digits (always '17' currently)
-     * 9:     always '-'
-     * 10-11: File version format as ASCII digits (always '01' currently)
-     * 12:    always 'v'
-     * 13-16: 4 ASCII digits encoding #BLENDER_FILE_VERSION (e.g. '0405' for Blender 4.5)
-     *
-     * With this header, #LargeBHead8 is always used.
-     */
-
-    if (!fbtCharNEq(m_header.c_str(), m_uhid, 6) && !fbtCharNEq(m_header.c_str(), m_aluhid, 7))
-    {
-        if (!suppressHeaderWarning)
-            fbtPrintf("Unknown header ID '%s'\n", m_header.c_str());
-        return FS_INV_HEADER_STR;
-    }
-
-    // now we must convert:
-    char* headerMagic = m_header.ptr();
-    if (headerMagic[9] != '-' || headerMagic[10] != '0' || headerMagic[11] != '1' || headerMagic[12] != 'v')
-    {
-        if (!suppressHeaderWarning)
-            fbtPrintf("Unknown header format version '%c%c%c%c'\n", headerMagic[9], headerMagic[10], headerMagic[11], headerMagic[12]);
-        return FS_INV_HEADER_STR;
-    }
+	return scanChunks(&ms, dir, dnaIndex);
+}
 
-    m_fileHeader = FH_CHUNK_64 | (FBT_ENDIAN_IS_BIG?FH_ENDIAN_SWAP:0); // always LargeBHead8 with this header format
-    m_fileVersion = 0;
 
-    m_fileVersion = atoi(&headerMagic[13]);
-#endif
+// Moves 'len' bytes forward: streams that can't seek read (and drop) them
+static bool fbtStreamSkip(fbtStream* stream, FBTsize len)
+{
+	FBTsize pos = stream->position();
+	const FBTsize target = pos + len;
+	if (len == 0 || stream->seek((FBTint64)len, SEEK_CUR) == target)
+		return true;
 
-	return FS_OK;
+	char scratch[16384];
+	pos = stream->position();
+	while (pos < target)
+	{
+		const FBTsize nr = fbtMin<FBTsize>(target - pos, sizeof(scratch));
+		if (stream->read(scratch, nr) != nr)
+			return false;
+		pos += nr;
+	}
+	return true;
 }
 
 
-int fbtFile::parseStreamImpl(fbtStream* stream, bool suppressHeaderWarning)
+int fbtFile::scanChunks(fbtStream* stream, ChunkDirectory& dir, FBTsizeType* dnaIndex)
 {
-    int status;
-
-    status = parseHeader(stream,suppressHeaderWarning);
+	int status = parseHeader(stream);
 	if (status != FS_OK)
 	{
 		fbtPrintf("Failed to extract header!\n");
 		return status;
 	}
-
-	if (!m_memory)
-	{
-		m_memory = new fbtBinTables();
-
-		status = initializeTables(m_memory);
-		if (status != FS_OK)
-		{
-			fbtPrintf("Failed to initialize builtin tables\n");
-			return status;
-		}
-	}
-
-
-	if (m_file)
-	{
-		delete m_file;
-		m_file = 0;
-	}
-
-
-	// preallocate table
-	m_map.reserve(fbtDefaultAlloc);
+	return readChunkDirectory(stream, dir, dnaIndex);
+}
 
 
+int fbtFile::readChunkDirectory(fbtStream* stream, ChunkDirectory& dir, FBTsizeType* dnaIndex)
+{
+	int status;
 	Chunk chunk;
 
-
-	// Scan chunks
-
 	do
 	{
 		if ((status = fbtChunk::read(&chunk, stream, m_fileHeader)) <= 0)
@@ -2908,1080 +3697,3634 @@ int fbtFile::parseStreamImpl(fbtStream* stream, bool suppressHeaderWarning)
 			return FS_INV_READ;
 		}
 
-
-		if (chunk.m_code == SDNA)
-		{
-			chunk.m_code = DNA1;
-			stream->seek(-status, SEEK_CUR);
-			chunk.m_len = stream->size() - stream->position();
-		}
-
 		// exit on end byte
 		if (chunk.m_code == ENDB)
 			break;
 
+		ChunkInfo info;
+		info.m_offset = stream->position();
+		info.m_len    = chunk.m_len;
+		info.m_old    = chunk.m_old;
+		info.m_nr     = chunk.m_nr;
+		info.m_code   = chunk.m_code;
+		info.m_typeid = chunk.m_typeid;
 
-		void* curPtr = fbtMalloc(chunk.m_len);
-		//printf("alloc curPtr: 0x%x\n", curPtr);fflush(stdout);
-		if (!curPtr)
+		if (chunk.m_code == SDNA)
 		{
-			FBT_MALLOC_FAILED;
-			return FS_BAD_ALLOC;
+			// DNA1 without its chunk header: it's the rest of the file
+			info.m_code   = DNA1;
+			info.m_offset -= status;
+			info.m_len    = stream->size() - info.m_offset;
 		}
 
-		if (stream->read(curPtr, chunk.m_len) <= 0)
+		if (info.m_code == DNA1 && dnaIndex)
+			*dnaIndex = dir.size();
+		dir.push_back(info);
+
+		if (chunk.m_code == SDNA)
+			break;
+
+		if (!fbtStreamSkip(stream, (FBTsize)info.m_len))
 		{
 			FBT_INVALID_READ;
 			return FS_INV_READ;
 		}
+	}
+	while (!stream->eof());
 
-		if (chunk.m_code == DNA1)
-		{
-			m_file = new fbtBinTables(curPtr, chunk.m_len);
-			m_file->m_ptr = m_fileHeader & FH_CHUNK_64 ? 8 : 4;
+	return FS_OK;
+}
 
 
-			if (!m_file->read((m_fileHeader & FH_ENDIAN_SWAP) != 0))
-			{
-				fbtPrintf("Failed to initialize tables\n");
-				return FS_INV_READ;
-			}
+int fbtFile::readThumbnail(const char* path, unsigned char*& pixels, int& width, int& height, const char* uncompressedFileDetectorPrefix)
+{
+	pixels = 0;
+	width = height = 0;
 
-			compileOffsets();
+	fbtStream* stream = openStream(path, uncompressedFileDetectorPrefix, true);
+	if (!stream)
+		return FS_FAILED;
+	if (!stream->isOpen())
+	{
+		fbtPrintf("File '%s' loading failed\n", path);
+		delete stream;
+		return FS_FAILED;
+	}
 
-			if ((status = link()) != FS_OK)
-			{
-				FBT_LINK_FAILED;
-				return FS_LINK_FAILED;
-			}
-			break;
-		}
-		else
-		{
-#if FBT_ASSERT_INSERT
-			FBTsizeType pos;
-			if ((pos = m_map.find(chunk.m_old)) != FBT_NPOS)
-			{
-				fbtFree(curPtr);
-				curPtr = 0;
-				int result = fbtMemcmp(&m_map.at(pos)->m_chunk, &chunk, fbtChunk::BlockSize);
-				if (result != 0)
-				{
-					FBT_INVALID_READ;
-					return FS_INV_READ;
-				}
-			}
-#else
-			if (m_map.find(chunk.m_old) != FBT_NPOS)
-			{
-				//printf("free  curPtr: 0x%x\n", curPtr);
-				fbtFree(curPtr);
-				curPtr = 0;
-			}
-#endif
-			else
-			{
-				MemoryChunk* bin = static_cast<MemoryChunk*>(fbtMalloc(sizeof(MemoryChunk)));
-				if (!bin)
-				{
-					FBT_MALLOC_FAILED;
-					return FS_BAD_ALLOC;
-				}
-				fbtMemset(bin, 0, sizeof(MemoryChunk));
-				bin->m_block = curPtr;
-
-				Chunk* cp    = &bin->m_chunk;
-				cp->m_code   = chunk.m_code;
-				cp->m_len    = chunk.m_len;
-				cp->m_nr     = chunk.m_nr;
-				cp->m_typeid = chunk.m_typeid;
-				cp->m_old    = chunk.m_old;
-				m_chunks.push_back(bin);
-
-				if (m_map.insert(bin->m_chunk.m_old, bin) == false)
-				{
-					FBT_INVALID_INS;
-					return FS_INV_INSERT;
-				}
-			}
-		}
-	}
-	while (!stream->eof());
-	return status;
+	int result = readThumbnail(stream, pixels, width, height);
+	delete stream;
+	return result;
 }
 
 
-class fbtPrimType
-{
-public:
-
-};
-
-class fbtLinkCompiler
+int fbtFile::readThumbnail(const void* memory, FBTsize sizeInBytes, unsigned char*& pixels, int& width, int& height)
 {
-public:
-	fbtBinTables* m_mp;
-	fbtBinTables* m_fp;
-
-	fbtStruct* find(const fbtCharHashKey& kvp);
-	fbtStruct* find(fbtStruct* strc, fbtStruct* member, bool isPointer, bool& needCast);
-	int        link(void);
-};
+	pixels = 0;
+	width = height = 0;
 
+	const int compression = GetFileCompression(memory, sizeInBytes, m_uhid);
+	const bool compressed = compression == FC_GZIP || compression == FC_ZSTD;
 
+	fbtMemoryStream ms;
+	ms.open(memory, sizeInBytes, fbtStream::SM_READ, compressed, !compressed);
 
-fbtStruct* fbtLinkCompiler::find(const fbtCharHashKey& kvp)
-{
-	FBTtype i;
-	if ( (i = m_fp->findTypeId(kvp)) != ((FBTtype)-1))
-		return m_fp->m_offs.at(i);
-	return 0;
+	if (!ms.isOpen())
+	{
+		fbtPrintf("Memory %p(%llu) loading failed\n", memory, (unsigned long long)sizeInBytes);
+		return FS_FAILED;
+	}
+	return readThumbnail(&ms, pixels, width, height);
 }
 
 
-fbtStruct* fbtLinkCompiler::find(fbtStruct* strc, fbtStruct* member, bool isPointer, bool& needCast)
+int fbtFile::readThumbnail(fbtStream* stream, unsigned char*& pixels, int& width, int& height)
 {
-	fbtStruct::Members::Pointer md = strc->m_members.ptr();
-	FBTsizeType i, s = strc->m_members.size();
+	int status = parseHeader(stream);
+	if (status != FS_OK)
+	{
+		fbtPrintf("Failed to extract header!\n");
+		return status;
+	}
 
-	FBTuint32 k1 = member->m_val.k32[0];
+	static const FBTuint32 REND = FBT_ID('R', 'E', 'N', 'D');
+	static const FBTuint32 TEST = FBT_ID('T', 'E', 'S', 'T');
 
-	for (i = 0; i < s; i++)
+	Chunk chunk;
+
+	// Blender writes them first: REND (one per scene), then TEST
+	while (!stream->eof())
 	{
-		fbtStruct* strc2 = &md[i];
+		if (fbtChunk::read(&chunk, stream, m_fileHeader) <= 0)
+		{
+			FBT_INVALID_READ;
+			return FS_INV_READ;
+		}
 
-		if (strc2->m_nr == member->m_nr && strc2->m_dp ==  member->m_dp)
+		if (chunk.m_code == REND)
 		{
-			if (strc2->m_val.k32[1] == member->m_val.k32[1]) //base name
-			{				
-				if (!strc2->m_keyChain.equal(member->m_keyChain))
-					continue;
+			if (!fbtStreamSkip(stream, (FBTsize)chunk.m_len))
+			{
+				FBT_INVALID_READ;
+				return FS_INV_READ;
+			}
+			continue;
+		}
 
-				FBTuint32 k2 = strc2->m_val.k32[0];
-				if (k1 == k2)
-					return strc2;
+		if (chunk.m_code != TEST)
+			break;
 
-				if (isPointer)
-					continue;
+		// int width, height; then width*height RGBA texels
+		FBTint32 size[2];
+		if (chunk.m_len < sizeof(size) || stream->read(size, sizeof(size)) != sizeof(size))
+		{
+			FBT_INVALID_READ;
+			return FS_INV_READ;
+		}
+		if (m_fileHeader & FH_ENDIAN_SWAP)
+			fbtSwap32((FBTuint32*)size, 2);
 
-				if (fbtIsIntType(k1) && fbtIsIntType(k2))
-					return strc2;
+		const FBTuint64 texels = (FBTuint64)(size[0] > 0 ? size[0] : 0) * (FBTuint64)(size[1] > 0 ? size[1] : 0);
+		if (texels == 0 || texels * 4 > (FBTuint64)chunk.m_len - sizeof(size))
+		{
+			FBT_INVALID_READ;
+			return FS_INV_READ;
+		}
 
-				if (fbtIsNumberType(k1) && fbtIsNumberType(k2))
-				{
-					needCast = true;
-					return strc2;
-				}
-			}
+		pixels = new unsigned char[(FBTsize)texels * 4];
+		if (stream->read(pixels, (FBTsize)texels * 4) != (FBTsize)texels * 4)
+		{
+			delete [] pixels;
+			pixels = 0;
+			FBT_INVALID_READ;
+			return FS_INV_READ;
 		}
-	}
 
+		width  = size[0];
+		height = size[1];
+		return FS_OK;
+	}
 
-	return 0;
+	return FS_FAILED;
 }
 
-int fbtLinkCompiler::link(void)
+
+int fbtFile::parseHeader(fbtStream* stream, bool suppressHeaderWarning)
 {
-	fbtBinTables::OffsM::Pointer md = m_mp->m_offs.ptr();
-    //fbtBinTables::OffsM::Pointer fd = m_fp->m_offs.ptr();
+    m_header.resize(FBT_BLEND_HEADER_SIZE);
+    stream->read(m_header.ptr(), FBT_BLEND_HEADER_SIZE);
 
-	FBTsizeType i, i2; 
-    //fbtStruct::Members::Pointer p2;
+#   if BLENDER_VERSION<500
+    /**
+     * Low level version 0: the m_header is 12 bytes long.
+     * 0-6:  'BLENDER'
+     * 7:    '-' for 8-byte pointers (#SmallBHead8) or '_' for 4-byte pointers (#BHead4)
+     * 8:    'v' for little endian or 'V' for big endian
+     * 9-11: 3 ASCII digits encoding #BLENDER_FILE_VERSION (e.g. '305' for Blender 3.5)
+     */
+
+    if (!fbtCharNEq(m_header.c_str(), m_uhid, 6) && !fbtCharNEq(m_header.c_str(), m_aluhid, 7))
+	{
+		if (!suppressHeaderWarning)
+			fbtPrintf("Unknown header ID '%s'\n", m_header.c_str());
+		return FS_INV_HEADER_STR;
+	}
 
+	char* headerMagic = (m_header.ptr() + 7);
 
-	for (i = 0; i < m_mp->m_offs.size(); ++i)
+	m_fileHeader = 0;
+	m_fileVersion = 0;
+
+	if (*(headerMagic++) == FM_64_BIT)
 	{
-		fbtStruct* strc = md[i];
-		strc->m_link = find(m_mp->m_type[strc->m_key.k16[0]].m_name);
+		m_fileHeader |= FH_CHUNK_64;
+		if (FBT_VOID4)
+			m_fileHeader |= FH_VAR_BITS;
+	}
+	else if (FBT_VOID8)
+		m_fileHeader |= FH_VAR_BITS;
 
-		if (strc->m_link)
-			strc->m_link->m_link = strc;
 
-        //p2 = strc->m_members.ptr();
+	if (*(headerMagic++) == FM_BIG_ENDIAN)
+	{
+		if (FBT_ENDIAN_IS_LITTLE)
+			m_fileHeader |= FH_ENDIAN_SWAP;
+	}
+	else if (FBT_ENDIAN_IS_BIG)
+		m_fileHeader |= FH_ENDIAN_SWAP;
+
 
-		//fbtPrintf("+%-3d %s\n", i, m_mp->getStructType(strc));
-		for (i2 = 0; i2 < strc->m_members.size(); ++i2)
-		{
-			fbtStruct* member = &strc->m_members[i2];
-			//fbtPrintf("  %3d %s %s\n", i2, m_mp->getStructType(strc2), m_mp->getStructName(strc2));
+	m_fileVersion = atoi(headerMagic);
+#else
+    /**
+     * Lower level version 1: the m_header is 17 bytes long.
+     * 0-6:   'BLENDER'
+     * 7-8:   size of the header in bytes encoded as ASCII digits (always '17' currently)
+     * 9:     always '-'
+     * 10-11: File version format as ASCII digits (always '01' currently)
+     * 12:    always 'v'
+     * 13-16: 4 ASCII digits encoding #BLENDER_FILE_VERSION (e.g. '0405' for Blender 4.5)
+     *
+     * With this header, #LargeBHead8 is always used.
+     */
 
-			FBT_ASSERT(!member->m_link);
-			member->m_flag |= strc->m_link ? 0 : fbtStruct::MISSING;
+    if (!fbtCharNEq(m_header.c_str(), m_uhid, 6) && !fbtCharNEq(m_header.c_str(), m_aluhid, 7))
+    {
+        if (!suppressHeaderWarning)
+            fbtPrintf("Unknown header ID '%s'\n", m_header.c_str());
+        return FS_INV_HEADER_STR;
+    }
 
-			if (!(member->m_flag & fbtStruct::MISSING))
-			{
-				FBT_ASSERT(member->m_key.k16[1] < m_mp->m_nameNr);
-				bool isPointer = m_mp->m_name[member->m_key.k16[1]].m_ptrCount > 0;
-				bool needCast = false;
-				member->m_link = find(strc->m_link, member, isPointer, needCast);
-				if (member->m_link)
-				{
-					member->m_link->m_link = member;
-					if (needCast)
-					{
-						member->m_flag |= fbtStruct::NEED_CAST;
-						member->m_link->m_flag |= fbtStruct::NEED_CAST;
-					}
-				}
-			}
-		}
+    // now we must convert:
+    char* headerMagic = m_header.ptr();
+    if (headerMagic[9] != '-' || headerMagic[10] != '0' || headerMagic[11] != '1' || headerMagic[12] != 'v')
+    {
+        if (!suppressHeaderWarning)
+            fbtPrintf("Unknown header format version '%c%c%c%c'\n", headerMagic[9], headerMagic[10], headerMagic[11], headerMagic[12]);
+        return FS_INV_HEADER_STR;
+    }
 
-	}
+    m_fileHeader = FH_CHUNK_64 | (FBT_ENDIAN_IS_BIG?FH_ENDIAN_SWAP:0); // always LargeBHead8 with this header format
+    m_fileVersion = 0;
 
-	return fbtFile::FS_OK;
+    m_fileVersion = atoi(&headerMagic[13]);
+#endif
+
+	return FS_OK;
 }
 
-void copyValues(FBTbyte* srcPtr, FBTbyte* dstPtr, FBTsize srcElmSize, FBTsize dstElmSize, FBTsize len)
+
+int fbtFile::parseStreamImpl(fbtStream* stream, bool suppressHeaderWarning)
 {
-	FBTsize i;
-	for (i = 0; i < len; i++)
+    int status;
+
+    status = parseHeader(stream,suppressHeaderWarning);
+	if (status != FS_OK)
 	{
-		fbtMemcpy(srcPtr, dstPtr, srcElmSize);
-		srcPtr += srcElmSize;
-		dstElmSize += dstElmSize;
+		fbtPrintf("Failed to extract header!\n");
+		return status;
 	}
-}
 
-void castValue(FBTsize* srcPtr, FBTsize* dstPtr, FBT_PRIM_TYPE srctp, FBT_PRIM_TYPE dsttp, FBTsize len)
-{
-#define GET_V(value, current, type, cast, ptr, match) \
-	if (current == type) \
-	{ \
-		value = (*(cast*)ptr); \
-		ptr += sizeof(cast); \
-		if (++match >= 2) continue; \
-	}
+	// (built once for all the fbtFiles of the same memory DNA)
+	if (!m_memory && (m_memory = fbtDNACache::findMemory(getFBT(), getFBTlength())) == 0)
+	{
+		fbtBinTables* memory = new fbtBinTables();
 
-#define SET_V(value, current, type, cast, ptr, match) \
-	if (current == type) \
-	{ \
-		(*(cast*)ptr) = (cast)value; \
-		ptr += sizeof(cast); \
-		if (++match >= 2) continue; \
+		status = initializeTables(memory);
+		if (status != FS_OK)
+		{
+			fbtPrintf("Failed to initialize builtin tables\n");
+			delete memory;
+			return status;
+		}
+		m_memory = fbtDNACache::insertMemory(getFBT(), getFBTlength(), memory);
 	}
 
-	double value = 0.0;
 
-	FBTsizeType i;
-	for (i = 0; i < len; i++)
+	if (m_file)
 	{
-		int match = 0;
-		GET_V(value, srctp, FBT_PRIM_CHAR,    char,            srcPtr, match);
-		SET_V(value, dsttp, FBT_PRIM_CHAR,    char,            dstPtr, match);
-		GET_V(value, srctp, FBT_PRIM_SHORT,   short,           srcPtr, match);
-		SET_V(value, dsttp, FBT_PRIM_SHORT,   short,           dstPtr, match);
-		GET_V(value, srctp, FBT_PRIM_USHORT,  unsigned short,  srcPtr, match);
-		SET_V(value, dsttp, FBT_PRIM_USHORT,  unsigned short,  dstPtr, match);
-		GET_V(value, srctp, FBT_PRIM_INT,     int,             srcPtr, match);
-		SET_V(value, dsttp, FBT_PRIM_INT,     int,             dstPtr, match);
-		GET_V(value, srctp, FBT_PRIM_LONG,    int,             srcPtr, match);
-		SET_V(value, dsttp, FBT_PRIM_LONG,    int,             dstPtr, match);
-		GET_V(value, srctp, FBT_PRIM_FLOAT,   float,           srcPtr, match);
-		SET_V(value, dsttp, FBT_PRIM_FLOAT,   float,           dstPtr, match);
-		GET_V(value, srctp, FBT_PRIM_DOUBLE,  double,          srcPtr, match);
-		SET_V(value, dsttp, FBT_PRIM_DOUBLE,  double,          dstPtr, match);
+		fbtDNACache::release(m_file);
+		m_file = 0;
 	}
-#undef GET_V
-#undef SET_V
-}
 
 
-int fbtFile::link(void)
-{
-	fbtBinTables::OffsM::Pointer md = m_memory->m_offs.ptr();
-	fbtBinTables::OffsM::Pointer fd = m_file->m_offs.ptr();
-	FBTsizeType s2, i2, a2, n;
-	fbtStruct::Members::Pointer p2;
-	FBTsize mlen, malen, total, pi;
+	// (streams that can't seek, e.g. gzip, return 0 here)
+	if (m_loadFilter && stream->seek(0, SEEK_CUR) == stream->position())
+		return parseFiltered(stream);
 
-	char* dst, *src;
-	FBTsize* dstPtr, *srcPtr;
 
-	bool endianSwap = (m_fileHeader & FH_ENDIAN_SWAP) != 0;
+	Chunk chunk;
 
-	static const FBThash hk = fbtCharHashKey("Link").hash();
 
+	// Scan chunks
 
-	MemoryChunk* node;
-	for (node = (MemoryChunk*)m_chunks.first; node; node = node->m_next)
+	do
 	{
-		if (node->m_chunk.m_typeid > m_file->m_strcNr || !( fd[node->m_chunk.m_typeid]->m_link))
-			continue;
+		if ((status = fbtChunk::read(&chunk, stream, m_fileHeader)) <= 0)
+		{
+			FBT_INVALID_READ;
+			return FS_INV_READ;
+		}
+
+
+		if (chunk.m_code == SDNA)
+		{
+			chunk.m_code = DNA1;
+			stream->seek(-status, SEEK_CUR);
+			chunk.m_len = stream->size() - stream->position();
+		}
+
+		// exit on end byte
+		if (chunk.m_code == ENDB)
+			break;
 
-		fbtStruct* fs, *ms;
-		fs = fd[node->m_chunk.m_typeid];
-		ms = fs->m_link;
 
-		node->m_newTypeId = ms->m_strcId;
+		void* curPtr = 0;
+		bool inPlace = false;
 
-		if (m_memory->m_type[ms->m_key.k16[0]].m_typeId == hk)
+		// DNA1 is owned (and swapped) by m_file: always copy it
+		if (chunk.m_code != DNA1)
 		{
-			FBTsize totSize = node->m_chunk.m_len;
-			node->m_newBlock = fbtMalloc(totSize);
-			//printf("alloc1 m_newBlock: 0x%x %d\n", node->m_newBlock, totSize);fflush(stdout);
+			curPtr = stream->readInPlace(chunk.m_len);
+			inPlace = curPtr != 0;
+		}
 
-			if (!node->m_newBlock)
+		if (!inPlace)
+		{
+			// (DNA1 is freed by m_file)
+			curPtr = chunk.m_code == DNA1 ? fbtMalloc(chunk.m_len) : m_payloads.alloc(chunk.m_len);
+			//printf("alloc curPtr: 0x%x\n", curPtr);fflush(stdout);
+			if (!curPtr)
 			{
 				FBT_MALLOC_FAILED;
 				return FS_BAD_ALLOC;
 			}
 
-			fbtMemcpy(node->m_newBlock, node->m_block, totSize);
-			continue;
+			if (stream->read(curPtr, chunk.m_len) != (FBTsize)chunk.m_len)
+			{
+				if (chunk.m_code == DNA1)
+					fbtFree(curPtr);
+				FBT_INVALID_READ;
+				return FS_INV_READ;
+			}
 		}
 
+		if (chunk.m_code == DNA1)
+		{
+			if ((status = readFileTables(curPtr, chunk.m_len)) != FS_OK)
+				return status;
 
-		if (skip(m_memory->m_type[ms->m_key.k16[0]].m_typeId))
-			continue;
-
+			if (m_loadFilter && (status = pruneChunks()) != FS_OK)
+				return status;
 
-		FBTsize totSize = (node->m_chunk.m_nr * ms->m_len);
-
-		node->m_chunk.m_len = totSize;
-
-
-		node->m_newBlock = fbtMalloc(totSize);
-		//printf("alloc2 m_newBlock: 0x%x %d\n", node->m_newBlock, totSize);fflush(stdout);
-
-		if (!node->m_newBlock)
-		{
-			FBT_MALLOC_FAILED;
-			return FS_BAD_ALLOC;
+			if ((status = link()) != FS_OK)
+			{
+				FBT_LINK_FAILED;
+				return FS_LINK_FAILED;
+			}
+			break;
 		}
+		else if ((status = insertChunk(chunk, curPtr, inPlace)) != FS_OK)
+			return status;
+	}
+	while (!stream->eof());
+	return status;
+}
 
 
-
-		// always zero this
-		fbtMemset(node->m_newBlock, 0, totSize);
+int fbtFile::insertChunk(const Chunk& chunk, void* block, bool inPlace)
+{
+	// (duplicated old pointers are dropped by buildPtrIndex())
+	MemoryChunk* bin = static_cast<MemoryChunk*>(m_arena.alloc(sizeof(MemoryChunk)));
+	if (!bin)
+	{
+		FBT_MALLOC_FAILED;
+		return FS_BAD_ALLOC;
 	}
+	fbtMemset(bin, 0, sizeof(MemoryChunk));
+	bin->m_block = block;
+	if (inPlace)
+		bin->m_flag |= MemoryChunk::BLK_EXTERNAL;
+	else if (block && m_payloads.isOwnBlock((FBTsize)chunk.m_len))
+		bin->m_flag |= MemoryChunk::BLK_OWN_PAYLOAD;
+
+	Chunk* cp    = &bin->m_chunk;
+	cp->m_code   = chunk.m_code;
+	cp->m_len    = chunk.m_len;
+	cp->m_nr     = chunk.m_nr;
+	cp->m_typeid = chunk.m_typeid;
+	cp->m_old    = chunk.m_old;
+	m_chunks.push_back(bin);
+	return FS_OK;
+}
 
 
+bool fbtFile::ptrRangeLess(const PtrRange& a, const PtrRange& b)
+{
+	return a.m_begin < b.m_begin || (a.m_begin == b.m_begin && a.m_index < b.m_index);
+}
 
-	FBTuint8 mps = m_memory->m_ptr, fps = m_file->m_ptr;
 
-	for (node = (MemoryChunk*)m_chunks.first; node; node = node->m_next)
+void fbtFile::sortPtrIndex(PtrIndex& index)
+{
+	index.sort(ptrRangeLess);
+
+	FBTsizeType i, n = 0;
+	for (i = 0; i < index.size(); ++i)
 	{
-		if (node->m_newTypeId > m_memory->m_strcNr)
+		if (n > 0 && index[n - 1].m_begin == index[i].m_begin)
 			continue;
+		index[n++] = index[i];
+	}
+	index.resize(n);
+}
 
 
+FBTsizeType fbtFile::findPtrRange(const PtrIndex& index, FBTsize ptr)
+{
+	// the last range starting at or before ptr
+	FBTsizeType lo = 0, hi = index.size();
+	while (lo < hi)
+	{
+		const FBTsizeType mid = lo + (hi - lo) / 2;
+		if (index[mid].m_begin <= ptr)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
 
-		fbtStruct* cs = md[node->m_newTypeId];
-		if (m_memory->m_type[cs->m_key.k16[0]].m_typeId == hk)
-			continue;
-
-		if (!cs->m_link || skip(m_memory->m_type[cs->m_key.k16[0]].m_typeId) || !node->m_newBlock)
-		{
-			//printf("free  m_newBlock: 0x%x \n", node->m_newBlock);fflush(stdout);
-
-			fbtFree(node->m_newBlock);
-			node->m_newBlock = 0;
+	if (lo == 0)
+		return FBT_NPOS;
 
-			continue;
-		}
+	const PtrRange& r = index[lo - 1];
+	return (ptr < r.m_end || ptr == r.m_begin) ? lo - 1 : FBT_NPOS;
+}
 
-		s2 = cs->m_members.size();
-		p2 = cs->m_members.ptr();
 
-		for (n = 0; n < node->m_chunk.m_nr; ++n)
-		{
-			dst = static_cast<char*>(node->m_newBlock) + (cs->m_len * n);
-			src = static_cast<char*>(node->m_block) + (cs->m_link->m_len * n);
+int fbtFile::buildPtrIndex(void)
+{
+	m_ptrIndex.clear();
+	m_lastRange = FBT_NPOS;
 
+	MemoryChunk* node;
+	FBTsizeType i = 0;
+	for (node = (MemoryChunk*)m_chunks.first; node; node = node->m_next)
+	{
+		PtrRange r;
+		r.m_begin = node->m_chunk.m_old;
+		r.m_end   = node->m_chunk.m_old + (FBTsize)node->m_chunk.m_len;
+		r.m_index = i++;
+		r.m_chunk = node;
+		m_ptrIndex.push_back(r);
+	}
 
-			for (i2 = 0; i2 < s2; ++i2)
-			{
-				fbtStruct* dstStrc = &p2[i2];
-				fbtStruct* srcStrc = dstStrc->m_link;
+	const FBTsizeType total = m_ptrIndex.size();
+	sortPtrIndex(m_ptrIndex);
+	if (m_ptrIndex.size() == total)
+		return FS_OK;
 
-				// If it's missing we can safely skip this block
-				if (!srcStrc)
-					continue;
 
+	// Keep the first chunk of each old pointer: the others are dropped (their memory stays in the arenas)
+	fbtArray<FBTuint8> keep(total, (FBTuint8)0);
+	for (i = 0; i < m_ptrIndex.size(); ++i)
+		keep[m_ptrIndex[i].m_index] = 1;
 
-				dstPtr = reinterpret_cast<FBTsize*>(dst + dstStrc->m_off);
-				srcPtr = reinterpret_cast<FBTsize*>(src + srcStrc->m_off);
+	int status = FS_OK;
+	node = (MemoryChunk*)m_chunks.first;
+	m_chunks.clear();
+	for (i = 0; node; ++i)
+	{
+		MemoryChunk* next = node->m_next;
+		if (keep[i])
+			m_chunks.push_back(node);
+#if FBT_ASSERT_INSERT
+		else
+		{
+			const FBTsizeType pos = findPtrRange(m_ptrIndex, node->m_chunk.m_old);
+			if (fbtMemcmp(&m_ptrIndex[pos].m_chunk->m_chunk, &node->m_chunk, fbtChunk::BlockSize) != 0)
+			{
+				FBT_INVALID_READ;
+				status = FS_INV_READ;
+			}
+		}
+#endif
+		node = next;
+	}
+	if (m_chunks.last)
+		m_chunks.last->next = 0;
+	return status;
+}
 
 
+fbtDNACache::Memory* fbtDNACache::s_memory = 0;
+fbtDNACache::Entry*  fbtDNACache::s_first  = 0;
+fbtSpinLock          fbtDNACache::s_lock   = {0};
+int                  fbtDNACache::s_files  = 0;
+bool                 fbtDNACache::s_exiting = false;
+fbtDNACache::Teardown fbtDNACache::s_teardown;
 
-				const fbtName& nameD = m_memory->m_name[dstStrc->m_key.k16[1]];
-				const fbtName& nameS = m_file->m_name[srcStrc->m_key.k16[1]];
 
+FBTuint64 fbtDNACache::hash(const void* dna, FBTsize len)
+{
+	// FNV-1a, four bytes at a time
+	const FBTbyte* cp = static_cast<const FBTbyte*>(dna);
+	FBTuint64 h = 0xCBF29CE484222325ULL;
+	FBTsize i = 0;
+	for (; i + 4 <= len; i += 4)
+	{
+		FBTuint32 v;
+		fbtMemcpy(&v, cp + i, 4);
+		h = (h ^ v) * 0x100000001B3ULL;
+	}
+	for (; i < len; ++i)
+		h = (h ^ (FBTubyte)cp[i]) * 0x100000001B3ULL;
+	return h;
+}
 
-				if (nameD.m_ptrCount > 0)
-				{
-					if ((*srcPtr))
-					{
-						if (nameD.m_ptrCount  > 1)
-						{
-							MemoryChunk* bin = findBlock((FBTsize)(*srcPtr));
-							if (bin)
-							{
-								if (bin->m_flag & MemoryChunk::BLK_MODIFIED)
-									(*dstPtr) = (FBTsize)bin->m_newBlock;
-								else
-								{
-									// take pointer size out of the equation
-									total = bin->m_chunk.m_len / fps;
 
+const fbtBinTables* fbtDNACache::findMemory(const void* fbt, FBTsize len)
+{
+	s_lock.lock();
+	Memory* memory;
+	for (memory = s_memory; memory && (memory->m_fbt != fbt || memory->m_len != len); memory = memory->m_next) {}
+	s_lock.unlock();
+	return memory ? memory->m_tables : 0;
+}
 
-									FBTsize* nptr = (FBTsize*)fbtMalloc(total * mps);
-									fbtMemset(nptr, 0, total * mps);
 
-									// always use 32 bit, then offset + 2 for 64 bit (Old pointers are sorted in this mannor)
-									FBTuint32* optr = (FBTuint32*)bin->m_block;
+const fbtBinTables* fbtDNACache::insertMemory(const void* fbt, FBTsize len, fbtBinTables* tables)
+{
+	const fbtBinTables* cached = findMemory(fbt, len);
+	if (cached)
+	{
+		delete tables;
+		return cached;
+	}
 
+	Memory* memory = new Memory;
+	memory->m_fbt    = fbt;
+	memory->m_len    = len;
+	memory->m_tables = tables;
 
-									for (pi = 0; pi < total; pi++, optr += (fps == 4 ? 1 : 2))
-										nptr[pi] = (FBTsize)findPtr((FBTsize) * optr);
+	s_lock.lock();
+	Memory* other;
+	for (other = s_memory; other && (other->m_fbt != fbt || other->m_len != len); other = other->m_next) {}
+	if (!other)
+	{
+		memory->m_next = s_memory;
+		s_memory = memory;
+	}
+	s_lock.unlock();
 
-									(*dstPtr) = (FBTsize)(nptr);
+	if (other)
+	{
+		delete memory;
+		delete tables;
+		return other->m_tables;
+	}
+	return tables;
+}
 
-									bin->m_chunk.m_len = total * mps;
-									bin->m_flag |= MemoryChunk::BLK_MODIFIED;
 
-									fbtFree(bin->m_newBlock);
-									bin->m_newBlock = nptr;
-								}
-							}
-							else
-							{
-								//fbtPrintf("**block not found @ 0x%p)\n", src);
-							}
-						}
-						else
-						{
-							malen = nameD.m_arraySize > nameS.m_arraySize ? nameS.m_arraySize : nameD.m_arraySize;
+fbtBinTables* fbtDNACache::find(const Key& key)
+{
+	s_lock.lock();
 
-							FBTsize* dptr = (FBTsize*)dstPtr;
+	Entry* prev = 0, *entry;
+	for (entry = s_first; entry; prev = entry, entry = entry->m_next)
+	{
+		const Key& k = entry->m_key;
+		if (k.m_hash == key.m_hash && k.m_len == key.m_len && k.m_memory == key.m_memory && k.m_ptr == key.m_ptr &&
+		    k.m_swap == key.m_swap && fbtMemcmp(k.m_dna, key.m_dna, key.m_len) == 0)
+			break;
+	}
 
-							// always use 32 bit, then offset + 2 for 64 bit (Old pointers are sorted in this mannor)
-							FBTuint32* sptr = (FBTuint32*)srcPtr;
+	fbtBinTables* file = 0;
+	if (entry)
+	{
+		if (prev)
+		{
+			prev->m_next = entry->m_next;
+			entry->m_next = s_first;
+			s_first = entry;
+		}
+		++entry->m_users;
+		file = entry->m_file;
+	}
 
+	s_lock.unlock();
+	return file;
+}
 
-							for (a2 = 0; a2 < malen; ++a2, sptr += (fps == 4 ? 1 : 2))
-								dptr[a2] = (FBTsize)findPtr((FBTsize) * sptr);
-						}
-					}
-				}
-				else
-				{
-					FBTsize dstElmSize = dstStrc->m_len / nameD.m_arraySize;
-					FBTsize srcElmSize = srcStrc->m_len / nameS.m_arraySize;
 
-					bool needCast = (dstStrc->m_flag & fbtStruct::NEED_CAST) != 0;
-					bool needSwap = endianSwap && srcElmSize > 1;
+fbtBinTables* fbtDNACache::insert(const Key& key, fbtBinTables* file)
+{
+	fbtBinTables* cached = find(key);
+	if (cached)
+	{
+		fbtFree(const_cast<void*>(key.m_dna));
+		delete file;
+		return cached;
+	}
 
-					if (!needCast && !needSwap && srcStrc->m_val.k32[0] == dstStrc->m_val.k32[0]) //same type
-					{						
-						// Take the minimum length of any array.
-						mlen = fbtMin(srcStrc->m_len, dstStrc->m_len);
+	Entry* entry = new Entry;
+	entry->m_key    = key;
+	entry->m_file   = file;
+	entry->m_users  = 1;
 
-						fbtMemcpy(dstPtr, srcPtr, mlen);
-						continue;
-					}
+	s_lock.lock();
+	entry->m_next = s_first;
+	s_first = entry;
+	Entry* unused = trim();
+	s_lock.unlock();
 
-					FBTbyte* dstBPtr = reinterpret_cast<FBTbyte*>(dstPtr);
-					FBTbyte* srcBPtr = reinterpret_cast<FBTbyte*>(srcPtr);
+	destroy(unused);
+	return file;
+}
 
-					FBT_PRIM_TYPE stp = FBT_PRIM_UNKNOWN, dtp  = FBT_PRIM_UNKNOWN;
 
-					if (needCast || needSwap)
-					{
-						stp = fbtGetPrimType(srcStrc->m_val.k32[0]);
-						dtp = fbtGetPrimType(dstStrc->m_val.k32[0]);
+void fbtDNACache::release(fbtBinTables* file)
+{
+	if (!file)
+		return;
 
-						FBT_ASSERT(fbtIsNumberType(stp) && fbtIsNumberType(dtp) && stp != dtp);
-					}
+	s_lock.lock();
+	Entry* entry;
+	for (entry = s_first; entry && entry->m_file != file; entry = entry->m_next) {}
+	FBT_ASSERT(entry && entry->m_users > 0);
+	if (entry)
+		--entry->m_users;
+	Entry* unused = trim();
+	s_lock.unlock();
 
-					FBTsize alen = fbtMin(nameS.m_arraySize, nameD.m_arraySize);
-					FBTsize elen = fbtMin(srcElmSize, dstElmSize);
+	destroy(unused);
+}
 
-					FBTbyte tmpBuf[8] = {0, };
-					FBTsize i;
-					for (i = 0; i < alen; i++)
-					{
-						FBTbyte* tmp = srcBPtr;
-						if (needSwap)
-						{
-							tmp = tmpBuf;
-							fbtMemcpy(tmpBuf, srcBPtr, srcElmSize);
-
-							if (stp == FBT_PRIM_SHORT || stp == FBT_PRIM_USHORT) 
-								fbtSwap16((FBTuint16*)tmpBuf, 1);
-							else if (stp >= FBT_PRIM_INT && stp <= FBT_PRIM_FLOAT) 
-								fbtSwap32((FBTuint32*)tmpBuf, 1);
-							else if (stp == FBT_PRIM_DOUBLE)
-								fbtSwap64((FBTuint64*)tmpBuf, 1);
-							else
-								fbtMemset(tmpBuf, 0, sizeof(tmpBuf)); //unknown type
-						}
-						
-						if (needCast)
-							castValue((FBTsize*)tmp, (FBTsize*)dstBPtr, stp, dtp, 1);
-						else
-							fbtMemcpy(dstBPtr, tmp, elen);
-
-						dstBPtr += dstElmSize;
-						srcBPtr += srcElmSize;
-					}
-				}
-			}
-		}
 
-		notifyData(node->m_newBlock, node->m_chunk);
+void fbtDNACache::destroy(Entry* list)
+{
+	while (list)
+	{
+		Entry* next = list->m_next;
+		fbtFree(const_cast<void*>(list->m_key.m_dna));
+		delete list->m_file;
+		delete list;
+		list = next;
 	}
+}
 
 
+fbtDNACache::Entry* fbtDNACache::trim(void)
+{
+	// (under s_lock) unlinks the unused entries past the first FBT_DNA_CACHE_SIZE ones
+	Entry* unused = 0;
+	int kept = 0;
 
-	for (node = (MemoryChunk*)m_chunks.first; node; node = node->m_next)
+	Entry** link = &s_first;
+	while (*link)
 	{
-		if (node->m_block)
+		Entry* entry = *link;
+		if (entry->m_users > 0 || kept < FBT_DNA_CACHE_SIZE)
 		{
-			fbtFree(node->m_block);
-			node->m_block = 0;
+			kept += entry->m_users == 0;
+			link = &entry->m_next;
+			continue;
 		}
+		*link = entry->m_next;
+		entry->m_next = unused;
+		unused = entry;
 	}
-
-	return fbtFile::FS_OK;
+	return unused;
 }
 
 
+void fbtDNACache::addFile(void)
+{
+	s_lock.lock();
+	++s_files;
+	s_lock.unlock();
+}
 
 
-void* fbtFile::findPtr(const FBTsize& iptr)
+void fbtDNACache::removeFile(void)
 {
-	FBTsizeType i;
-	if ((i = m_map.find(iptr)) != FBT_NPOS)
-		return m_map.at(i)->m_newBlock;
-	return 0;
+	s_lock.lock();
+	if (--s_files == 0 && s_exiting)
+		clear();
+	s_lock.unlock();
 }
 
 
-fbtFile::MemoryChunk* fbtFile::findBlock(const FBTsize& iptr)
+void fbtDNACache::clear(void)
 {
-	FBTsizeType i;
-	if ((i = m_map.find(iptr)) != FBT_NPOS)
-		return m_map.at(i);
-	return 0;
+	destroy(s_first);
+	s_first = 0;
+	while (s_memory)
+	{
+		Memory* next = s_memory->m_next;
+		delete s_memory->m_tables;
+		delete s_memory;
+		s_memory = next;
+	}
 }
 
 
-
-int fbtFile::compileOffsets(void)
+fbtDNACache::Teardown::~Teardown()
 {
-	fbtLinkCompiler lnk;
-	lnk.m_mp = m_memory;
-	lnk.m_fp = m_file;
-	return lnk.link();
+	// (static fbtFiles of other translation units can outlive this: the last one clears)
+	s_lock.lock();
+	s_exiting = true;
+	if (s_files == 0)
+		clear();
+	s_lock.unlock();
 }
 
-bool fbtFile::_setuid(const char* uid)
+
+int fbtFile::readFileTables(void* dna, FBTsize len)
 {
-	if (!uid || strlen(uid) != 7) return false;
+	fbtDNACache::Key key;
+	key.m_memory = m_memory;
+	key.m_dna    = dna;
+	key.m_hash   = fbtDNACache::hash(dna, len);
+	key.m_len    = len;
+	key.m_ptr    = m_fileHeader & FH_CHUNK_64 ? 8 : 4;
+	key.m_swap   = (m_fileHeader & FH_ENDIAN_SWAP) != 0;
 
-	m_uhid = uid;
-	return true;
-}
+	if ((m_file = fbtDNACache::find(key)) != 0)
+	{
+		fbtFree(dna);
+		return FS_OK;
+	}
 
-int fbtFile::reflect(const char* path, const int mode, const fbtEndian& /*endian*/)
-{
-	fbtStream* fs;
-	
-#if FBT_USE_GZ_FILE == 1
-	if (mode == PM_COMPRESSED)
-		fs = new fbtGzStream();
-	else
-#endif
+
+	// (read() swaps dna)
+	void* original = fbtMalloc(len);
+	if (!original)
 	{
-		fs = new fbtFileStream();
+		FBT_MALLOC_FAILED;
+		fbtFree(dna);
+		return FS_BAD_ALLOC;
 	}
-	
-	fs->open(path, fbtStream::SM_WRITE);
+	fbtMemcpy(original, dna, len);
+	key.m_dna = original;
 
+	fbtBinTables* file = new fbtBinTables(dna, len);
+	file->m_ptr = key.m_ptr;
 
-	FBTuint8 cp = FBT_VOID8 ? FM_64_BIT : FM_32_BIT;
-	FBTuint8 ce = ((FBTuint8)fbtGetEndian()) == FBT_ENDIAN_IS_BIG ? FM_BIG_ENDIAN : FM_LITTLE_ENDIAN;
+	if (!file->read(key.m_swap))
+	{
+		fbtPrintf("Failed to initialize tables\n");
+		fbtFree(original);
+		delete file;
+		return FS_INV_READ;
+	}
 
-//	Commented for now since the rest of the code does not care
-//	if (endian != FBT_ENDIAN_NATIVE)
-//	{
-//		if (endian == FBT_ENDIAN_IS_BIG)
-//			ce = FM_BIG_ENDIAN;
-//		else
-//			ce = FM_LITTLE_ENDIAN;
-//	}
+	compileOffsets(m_memory, file);
+	m_file = fbtDNACache::insert(key, file);
+	return FS_OK;
+}
 
-	// put magic
-	//fs->writef("%s%c%c%i", m_uhid, cp, ce, m_version);
-    char header[FBT_BLEND_HEADER_SIZE] = {};//{0,0,0,0,0,0,0,0,0,0,0,0};
-	char version[33];
-	sprintf(version, "%i",m_version);
-	
-	strncpy(&header[0], m_uhid, 7); // 7 first bytes of header
-#   if BLENDER_VERSION<500
-	header[7] = cp;					// 8th byte = pointer size
-	header[8] = ce;					// 9th byte = endianness
-    strncpy(&header[9], version, 3);// last 3 bytes for 3 version char
-#   else
-    header[7]='1';header[8]='7'; // header size = 17
-    header[9]='-';
-    header[10]='0';header[11]='1'; // file version format = 01
-    header[12]=ce; // endianness
-    strncpy(&header[13], version, 4);// last 4 bytes for 4 version char
-#   endif
-    fs->write(header, FBT_BLEND_HEADER_SIZE);
-	
-	writeData(fs);
 
-	// write DNA1
-	Chunk ch;
-	ch.m_code   = DNA1;
-	ch.m_len    = getFBTlength();
-	ch.m_nr     = 1;
-	ch.m_old    = 0;
-	ch.m_typeid = 0;
-	fs->write(&ch, fbtChunk::BlockSize);
-	fs->write(getFBT(), ch.m_len);
+// Reads the payload of 'info' (in place if the stream allows it, otherwise into 'arena')
+static int fbtReadPayload(fbtStream* stream, fbtMemoryArena& arena, const fbtFile::ChunkInfo& info, void*& block, bool& inPlace)
+{
+	const FBTsize len = (FBTsize)info.m_len;
+	block = 0;
+	inPlace = false;
 
+	if (stream->seek((FBTint64)info.m_offset, SEEK_SET) != (FBTsize)info.m_offset)
+	{
+		FBT_INVALID_READ;
+		return fbtFile::FS_INV_READ;
+	}
 
-	// write ENDB (End Byte | EOF )
-	ch.m_code   = ENDB;
-	ch.m_len    = 0;
-	ch.m_nr     = 0;
-	ch.m_old    = 0;
-	ch.m_typeid = 0;
-	fs->write(&ch, fbtChunk::BlockSize);
-	
-	delete fs;
-	return FS_OK;
+	block = stream->readInPlace(len);
+	inPlace = block != 0;
+	if (inPlace)
+		return fbtFile::FS_OK;
+
+	block = arena.alloc(len);
+	if (!block)
+	{
+		FBT_MALLOC_FAILED;
+		return fbtFile::FS_BAD_ALLOC;
+	}
 
+	if (stream->read(block, len) != len)
+	{
+		block = 0;
+		FBT_INVALID_READ;
+		return fbtFile::FS_INV_READ;
+	}
+	return fbtFile::FS_OK;
 }
 
-void fbtFile::writeStruct(fbtStream* stream, FBTtype index, FBTuint32 code, FBTsize len, void* writeData)
+
+// Old pointers are read whole, unaligned (in place blocks are only FBT_IN_PLACE_ALIGNMENT aligned)
+static FBTsize fbtReadOldPtr(const FBTbyte* p, FBTuint8 fps, bool endianSwap)
 {
-	Chunk ch;
-	ch.m_code   = code;
-	ch.m_len    = len;
-	ch.m_nr     = 1;
-	ch.m_old    = (FBTsize)writeData;
-	ch.m_typeid = index;
+	if (fps == 8)
+	{
+		FBTuint64 v;
+		fbtMemcpy(&v, p, sizeof(v));
+		if (endianSwap)
+			fbtSwap64(&v, 1);
+		return (FBTsize)v;
+	}
 
-	fbtChunk::write(&ch, stream);
+	FBTuint32 v;
+	fbtMemcpy(&v, p, sizeof(v));
+	if (endianSwap)
+		fbtSwap32(&v, 1);
+	return (FBTsize)v;
 }
 
-void fbtFile::writeBuffer(fbtStream* stream, FBTsize len, void* writeData)
+
+int fbtFile::markReachable(fbtStream* stream, const ChunkDirectory& dir, fbtArray<void*>& blocks, fbtArray<FBTuint8>& state)
 {
-	Chunk ch;
-	ch.m_code   = DATA;
-	ch.m_len    = len;
-	ch.m_nr     = 1;
-	ch.m_old    = (FBTsize)writeData;
-	ch.m_typeid = m_memory->findTypeId("Link");
+	fbtBinTables::OffsM::Pointer fd = m_file->m_offs.ptr();
+	const FBTuint8 fps = m_file->m_ptr;
+	const bool endianSwap = (m_fileHeader & FH_ENDIAN_SWAP) != 0;
+	const FBTsizeType nr = dir.size();
+	FBTsizeType i;
 
-	fbtChunk::write(&ch, stream);
+	static const FBThash hk = fbtCharHashKey("Link").hash();
+
+
+	// the same old pointer resolution as link()
+	PtrIndex index;
+	index.reserve(nr);
+
+	fbtArray<FBTsizeType> pending;
+	fbtArray<FBTsize> ptrs;
+
+	for (i = 0; i < nr; ++i)
+	{
+		const ChunkInfo& info = dir[i];
+		if (info.m_code == DNA1)
+			continue;
+
+		PtrRange r;
+		r.m_begin = (FBTsize)info.m_old;
+		r.m_end   = (FBTsize)(info.m_old + info.m_len);
+		r.m_index = i;
+		r.m_chunk = 0;
+		index.push_back(r);
+
+		const FBTuint32* code = m_loadFilter;
+		while (*code != 0 && *code != info.m_code)
+			++code;
+
+		if (*code != 0)
+		{
+			state[i] |= CS_REACHED;
+
+			// (the payload of non ID chunks is read later, if needed)
+			if (info.m_code <= 0xFFFF)
+				pending.push_back(i);
+		}
+	}
+	sortPtrIndex(index);
+
+
+	while (pending.size() > 0)
+	{
+		i = pending[pending.size() - 1];
+		pending.pop_back();
+
+		const ChunkInfo& info = dir[i];
+
+		if (!blocks[i] && stream)
+		{
+			bool inPlace;
+			int status = fbtReadPayload(stream, m_payloads, info, blocks[i], inPlace);
+			if (status != FS_OK)
+				return status;
+			if (inPlace)
+				state[i] |= CS_IN_PLACE;
+		}
+
+		const FBTbyte* data = static_cast<const FBTbyte*>(blocks[i]);
+		const FBTsize len = (FBTsize)info.m_len;
+		if (!data)
+			continue;
+
+
+		ptrs.clear(true);
+
+		fbtStruct* fs = info.m_typeid < m_file->m_strcNr ? fd[info.m_typeid] : 0;
+		if (!fs || m_file->m_type[fs->m_key.k16[0]].m_typeId == hk)
+		{
+			// pointer arrays (and raw data: any value matching an old pointer is followed)
+			for (FBTsize off = 0; off + fps <= len; off += fps)
+				ptrs.push_back(fbtReadOldPtr(data + off, fps, endianSwap));
+		}
+		else if (fs->m_len > 0)
+		{
+			fbtStruct::Members::Pointer mp = fs->m_members.ptr();
+			const FBTsizeType s = fs->m_members.size();
+			const FBTsize elmNr = fbtMin<FBTsize>((FBTsize)info.m_nr, len / fs->m_len);
+			const bool isId = info.m_code <= 0xFFFF;
+
+			for (FBTsize n = 0; n < elmNr; ++n)
+			{
+				const FBTbyte* elm = data + fs->m_len * n;
+
+				for (FBTsizeType m = 0; m < s; ++m)
+				{
+					const fbtStruct& member = mp[m];
+					const fbtName& name = m_file->m_name[member.m_key.k16[1]];
+					if (name.m_ptrCount <= 0 || name.m_isFptr)
+						continue;
+
+					// id.next/prev: the filter alone decides which IDs of a type are loaded
+					if (isId && n == 0 && member.m_off < 2 * fps)
+						continue;
+
+					for (int a = 0; a < name.m_arraySize; ++a)
+						ptrs.push_back(fbtReadOldPtr(elm + member.m_off + a * fps, fps, endianSwap));
+				}
+			}
+		}
+
+
+		for (FBTsizeType p = 0; p < ptrs.size(); ++p)
+		{
+			if (!ptrs[p])
+				continue;
+
+			FBTsizeType pos = findPtrRange(index, ptrs[p]);
+			if (pos == FBT_NPOS)
+				continue;
+
+			FBTsizeType j = index[pos].m_index;
+			if (!(state[j] & CS_REACHED))
+			{
+				state[j] |= CS_REACHED;
+				pending.push_back(j);
+			}
+		}
+	}
+
+	return FS_OK;
+}
+
+
+int fbtFile::parseFiltered(fbtStream* stream)
+{
+	ChunkDirectory dir;
+	FBTsizeType dnaIndex = FBT_NPOS, i;
+
+	int status = readChunkDirectory(stream, dir, &dnaIndex);
+	if (status != FS_OK)
+		return status;
+
+	if (dnaIndex == FBT_NPOS)
+	{
+		fbtPrintf("Missing DNA1 chunk\n");
+		return FS_INV_READ;
+	}
+
+
+	// DNA1 is owned (and swapped) by m_file: always copy it
+	const ChunkInfo& dna = dir[dnaIndex];
+	void* dnaBlock = fbtMalloc((FBTsize)dna.m_len);
+	if (!dnaBlock)
+	{
+		FBT_MALLOC_FAILED;
+		return FS_BAD_ALLOC;
+	}
+
+	if (stream->seek((FBTint64)dna.m_offset, SEEK_SET) != (FBTsize)dna.m_offset ||
+	    stream->read(dnaBlock, (FBTsize)dna.m_len) != (FBTsize)dna.m_len)
+	{
+		fbtFree(dnaBlock);
+		FBT_INVALID_READ;
+		return FS_INV_READ;
+	}
+
+	if ((status = readFileTables(dnaBlock, (FBTsize)dna.m_len)) != FS_OK)
+		return status;
+
+
+	fbtArray<void*> blocks(dir.size(), (void*)0);
+	fbtArray<FBTuint8> state(dir.size(), (FBTuint8)0);
+
+	status = markReachable(stream, dir, blocks, state);
+
+
+	// the memory chunks keep the file order
+	for (i = 0; i < dir.size() && status == FS_OK; ++i)
+	{
+		if (!(state[i] & CS_REACHED) || i == dnaIndex)
+			continue;
+
+		const ChunkInfo& info = dir[i];
+
+		bool inPlace = (state[i] & CS_IN_PLACE) != 0;
+		if (!blocks[i] && (status = fbtReadPayload(stream, m_payloads, info, blocks[i], inPlace)) != FS_OK)
+			break;
+
+		Chunk chunk;
+		chunk.m_code   = info.m_code;
+		chunk.m_len    = info.m_len;
+		chunk.m_old    = (FBTsize)info.m_old;
+		chunk.m_typeid = info.m_typeid;
+		chunk.m_nr     = info.m_nr;
+
+		status = insertChunk(chunk, blocks[i], inPlace);
+	}
+
+	if (status != FS_OK)
+		return status;
+
+	if ((status = link()) != FS_OK)
+	{
+		FBT_LINK_FAILED;
+		return FS_LINK_FAILED;
+	}
+	return FS_OK;
+}
+
+
+int fbtFile::pruneChunks(void)
+{
+	fbtArray<MemoryChunk*> nodes;
+	ChunkDirectory dir;
+	fbtArray<void*> blocks;
+
+	MemoryChunk* node;
+	for (node = (MemoryChunk*)m_chunks.first; node; node = node->m_next)
+	{
+		ChunkInfo info;
+		info.m_offset = 0;
+		info.m_len    = node->m_chunk.m_len;
+		info.m_old    = node->m_chunk.m_old;
+		info.m_nr     = node->m_chunk.m_nr;
+		info.m_code   = node->m_chunk.m_code;
+		info.m_typeid = node->m_chunk.m_typeid;
+
+		nodes.push_back(node);
+		dir.push_back(info);
+		blocks.push_back(node->m_block);
+	}
+
+	fbtArray<FBTuint8> state(dir.size(), (FBTuint8)0);
+
+	int status = markReachable(0, dir, blocks, state);
+	if (status != FS_OK)
+		return status;
+
+
+	m_chunks.clear();
+
+	// (the payloads and records of the others stay in the arenas)
+	for (FBTsizeType i = 0; i < nodes.size(); ++i)
+	{
+		if (state[i] & CS_REACHED)
+			m_chunks.push_back(nodes[i]);
+	}
+
+	if (m_chunks.last)
+		m_chunks.last->next = 0;
+	return FS_OK;
+}
+
+
+void fbtFile::releaseExternalBlocks(void)
+{
+	// The stream memory is going away: on success link() has already dropped them all,
+	// otherwise make sure nobody will ever touch them again.
+	for (MemoryChunk* node = (MemoryChunk*)m_chunks.first; node; node = node->m_next)
+	{
+		if (node->m_flag & MemoryChunk::BLK_EXTERNAL)
+		{
+			node->m_block = 0;
+			node->m_flag  = (FBTuint8)(node->m_flag & ~MemoryChunk::BLK_EXTERNAL);
+		}
+	}
+}
+
+
+class fbtPrimType
+{
+public:
+
+};
+
+class fbtLinkCompiler
+{
+public:
+	const fbtBinTables* m_mp;
+	fbtBinTables*       m_fp;
+
+	fbtLinkCompiler() : m_mp(0), m_fp(0), m_indexed(0), m_mask(0) {}
+
+	fbtStruct* find(const fbtCharHashKey& kvp);
+	fbtStruct* find(fbtStruct* strc, fbtStruct* member, bool isPointer, bool& needCast);
+	bool       sameLayout(fbtStruct* fs);
+	int        link(void);
+
+private:
+	// The members of m_indexed by memberHash(): m_first[hash & m_mask] is the first of them, m_next[i] the one after
+	// member i (in member order, as find() used to scan them)
+	fbtStruct*            m_indexed;
+	fbtArray<FBTsizeType> m_first, m_next;
+	FBThash               m_mask;
+
+	static FBThash memberHash(const fbtStruct* member);
+	void           index(fbtStruct* strc);
+};
+
+
+
+fbtStruct* fbtLinkCompiler::find(const fbtCharHashKey& kvp)
+{
+	FBTtype i;
+	if ( (i = m_fp->findTypeId(kvp)) != ((FBTtype)-1))
+		return m_fp->m_offs.at(i);
+	return 0;
+}
+
+
+FBThash fbtLinkCompiler::memberHash(const fbtStruct* member)
+{
+	// base name, array index, depth and key chain: what find() matches before looking at the types
+	FBThash h = (FBThash)_FBT_INITIAL_FNV;
+	h = (h ^ member->m_val.k32[1]) * _FBT_MULTIPLE_FNV;
+	h = (h ^ (FBThash)member->m_nr) * _FBT_MULTIPLE_FNV;
+	h = (h ^ (FBThash)member->m_dp) * _FBT_MULTIPLE_FNV;
+	for (FBTsizeType i = 0; i < member->m_keyChain.size(); ++i)
+	{
+		h = (h ^ member->m_keyChain[i].k32[0]) * _FBT_MULTIPLE_FNV;
+		h = (h ^ member->m_keyChain[i].k32[1]) * _FBT_MULTIPLE_FNV;
+	}
+	return h;
+}
+
+void fbtLinkCompiler::index(fbtStruct* strc)
+{
+	FBTsizeType i, s = strc->m_members.size(), nr = 16;
+	while (nr < 2 * s)
+		nr <<= 1;
+
+	m_indexed = strc;
+	m_mask = (FBThash)(nr - 1);
+	m_first.resize(nr);
+	m_next.resize(s);
+	for (i = 0; i < nr; ++i)
+		m_first[i] = FBT_NPOS;
+
+	// last to first: each chain lists its members in member order
+	for (i = s; i-- > 0; )
+	{
+		FBThash h = memberHash(&strc->m_members[i]) & m_mask;
+		m_next[i] = m_first[h];
+		m_first[h] = i;
+	}
+}
+
+fbtStruct* fbtLinkCompiler::find(fbtStruct* strc, fbtStruct* member, bool isPointer, bool& needCast)
+{
+	if (m_indexed != strc)
+		index(strc);
+
+	fbtStruct::Members::Pointer md = strc->m_members.ptr();
+	FBTsizeType i;
+
+	FBTuint32 k1 = member->m_val.k32[0];
+
+	for (i = m_first[memberHash(member) & m_mask]; i != FBT_NPOS; i = m_next[i])
+	{
+		fbtStruct* strc2 = &md[i];
+
+		if (strc2->m_nr == member->m_nr && strc2->m_dp ==  member->m_dp)
+		{
+			if (strc2->m_val.k32[1] == member->m_val.k32[1]) //base name
+			{				
+				if (!strc2->m_keyChain.equal(member->m_keyChain))
+					continue;
+
+				FBTuint32 k2 = strc2->m_val.k32[0];
+				if (k1 == k2)
+					return strc2;
+
+				if (isPointer)
+					continue;
+
+				// (int -> short too: copying the bytes neither sign extends nor works in big endian)
+				if (fbtIsNumberType(k1) && fbtIsNumberType(k2))
+				{
+					needCast = true;
+					return strc2;
+				}
+			}
+		}
+	}
+
+
+	return 0;
+}
+
+bool fbtLinkCompiler::sameLayout(fbtStruct* fs)
+{
+	// (each memory member links a file member of its own: the same count links all of them)
+	const fbtStruct* strc = fs->m_link;
+	if (!strc || m_mp->m_ptr != m_fp->m_ptr || strc->m_len != fs->m_len || strc->m_members.size() != fs->m_members.size())
+		return false;
+
+	for (FBTsizeType i = 0; i < fs->m_members.size(); ++i)
+	{
+		const fbtStruct* fm = &fs->m_members[i];
+		const fbtStruct* member = fm->m_link;
+
+		if (!member || (fm->m_flag & fbtStruct::NEED_CAST) || member->m_off != fm->m_off || member->m_len != fm->m_len ||
+		    member->m_val.k32[0] != fm->m_val.k32[0] ||
+		    m_mp->m_name[member->m_key.k16[1]].m_ptrCount != m_fp->m_name[fm->m_key.k16[1]].m_ptrCount)
+			return false;
+	}
+	return true;
+}
+
+
+int fbtLinkCompiler::link(void)
+{
+	fbtBinTables::OffsM::ConstPointer md = m_mp->m_offs.ptr();
+    //fbtBinTables::OffsM::Pointer fd = m_fp->m_offs.ptr();
+
+	FBTsizeType i, i2; 
+    //fbtStruct::Members::Pointer p2;
+
+
+	// Only the file side is written (m_link to the memory struct / member, NEED_CAST, SAME_LAYOUT):
+	// the memory tables are the same for every file.
+	for (i = 0; i < m_mp->m_offs.size(); ++i)
+	{
+		fbtStruct* strc = md[i];
+		fbtStruct* fs = find(m_mp->m_type[strc->m_key.k16[0]].m_name);
+		if (!fs)
+			continue;
+
+		FBT_ASSERT(!fs->m_link);
+		fs->m_link = strc;
+
+		//fbtPrintf("+%-3d %s\n", i, m_mp->getStructType(strc));
+		for (i2 = 0; i2 < strc->m_members.size(); ++i2)
+		{
+			fbtStruct* member = &strc->m_members[i2];
+			//fbtPrintf("  %3d %s %s\n", i2, m_mp->getStructType(strc2), m_mp->getStructName(strc2));
+
+			FBT_ASSERT(member->m_key.k16[1] < m_mp->m_nameNr);
+			bool isPointer = m_mp->m_name[member->m_key.k16[1]].m_ptrCount > 0;
+			bool needCast = false;
+			fbtStruct* fm = find(fs, member, isPointer, needCast);
+			if (fm)
+			{
+				fm->m_link = member;
+				if (needCast)
+					fm->m_flag |= fbtStruct::NEED_CAST;
+			}
+		}
+
+		if (sameLayout(fs))
+			fs->m_flag |= fbtStruct::SAME_LAYOUT;
+	}
+
+	return fbtFile::FS_OK;
+}
+
+void copyValues(const FBTbyte* srcPtr, FBTbyte* dstPtr, FBTsize srcElmSize, FBTsize dstElmSize, FBTsize len)
+{
+	if (srcElmSize == dstElmSize)
+	{
+		fbtMemcpy(dstPtr, srcPtr, len * srcElmSize);
+		return;
+	}
+
+	const FBTsize elmSize = fbtMin(srcElmSize, dstElmSize);
+	FBTsize i;
+	for (i = 0; i < len; i++)
+	{
+		fbtMemcpy(dstPtr, srcPtr, elmSize);
+		srcPtr += srcElmSize;
+		dstPtr += dstElmSize;
+	}
+}
+
+
+template <typename S, typename D>
+void fbtCastValues(const void* src, void* dst, FBTsize len)
+{
+	const FBTbyte* sp = static_cast<const FBTbyte*>(src);
+	D* dp = static_cast<D*>(dst);
+
+	FBTsize i;
+	for (i = 0; i < len; i++, sp += sizeof(S))
+	{
+		S v;
+		fbtMemcpy(&v, sp, sizeof(S));
+		dp[i] = (D)v;
+	}
+}
+
+
+fbtCastKernel fbtGetCastKernel(FBT_PRIM_TYPE src, FBT_PRIM_TYPE dst)
+{
+	// in FBT_PRIM_TYPE order (long and ulong are 32 bit in the DNA)
+#define FBT_CAST_ROW(S) \
+	{fbtCastValues<S, char>, fbtCastValues<S, unsigned char>, fbtCastValues<S, short>, fbtCastValues<S, unsigned short>, \
+	 fbtCastValues<S, int>, fbtCastValues<S, int>, fbtCastValues<S, unsigned int>, fbtCastValues<S, float>, fbtCastValues<S, double>}
+
+	static const fbtCastKernel kernels[FBT_PRIM_VOID][FBT_PRIM_VOID] =
+	{
+		FBT_CAST_ROW(char),
+		FBT_CAST_ROW(unsigned char),
+		FBT_CAST_ROW(short),
+		FBT_CAST_ROW(unsigned short),
+		FBT_CAST_ROW(int),
+		FBT_CAST_ROW(int),
+		FBT_CAST_ROW(unsigned int),
+		FBT_CAST_ROW(float),
+		FBT_CAST_ROW(double),
+	};
+#undef FBT_CAST_ROW
+
+	if (src >= FBT_PRIM_VOID || dst >= FBT_PRIM_VOID)
+		return 0;
+	return kernels[src][dst];
+}
+
+
+#if FBT_USE_THREADS == 1
+struct fbtFile::LinkJob
+{
+	fbtFile*            m_file;
+	MemoryChunk* const* m_nodes;
+	const FBTsizeType*  m_batches;      // first node of each batch (and the end)
+	FBTsizeType*        m_lastRange;    // per worker
+};
+
+
+void fbtFile::linkBatch(void* userData, FBTsize index, int worker)
+{
+	// (the nodes are only read here: the other workers look at their m_flag)
+	LinkJob* job = static_cast<LinkJob*>(userData);
+	for (FBTsizeType i = job->m_batches[index]; i < job->m_batches[index + 1]; ++i)
+		job->m_file->convertBlock(job->m_nodes[i], job->m_lastRange[worker]);
+}
+#endif
+
+
+int fbtFile::link(void)
+{
+	fbtBinTables::OffsM::ConstPointer md = m_memory->m_offs.ptr();
+
+	static const FBThash hk = fbtCharHashKey("Link").hash();
+
+
+	// (before the chunk lengths become the converted ones)
+	int status = buildPtrIndex();
+	if (status != FS_OK)
+		return status;
+
+	// Raw data and the blocks of identical layout are used in place when they have an m_payloads block of their own
+	// (newBlock()): these blocks go to m_arena, the rest of m_payloads is released.
+	m_linkOps.clear();
+	m_linkPlans.resize(0);
+	m_linkPlans.resize(m_file->m_strcNr, FBT_NPOS);
+
+	if (m_lazyLink)
+		return linkLazily();
+
+	MemoryChunk* node;
+	for (node = (MemoryChunk*)m_chunks.first; node; node = node->m_next)
+	{
+		if ((status = newBlock(node)) != FS_OK)
+			return status;
+	}
+
+	// the blocks to convert
+	fbtArray<MemoryChunk*> nodes;
+	for (node = (MemoryChunk*)m_chunks.first; node; node = node->m_next)
+	{
+		if (node->m_newTypeId >= m_memory->m_strcNr)
+			continue;
+
+		fbtStruct* cs = md[node->m_newTypeId];
+		if (m_memory->m_type[cs->m_key.k16[0]].m_typeId == hk)
+			continue;
+
+		if (skip(m_memory->m_type[cs->m_key.k16[0]].m_typeId) || !node->m_newBlock)
+		{
+			// (it stays in m_arena)
+			node->m_newBlock = 0;
+
+			continue;
+		}
+		nodes.push_back(node);
+	}
+
+	FBTsizeType i;
+	for (i = 0; i < nodes.size(); ++i)
+	{
+		if ((status = compilePlan(nodes[i]->m_chunk.m_typeid)) != FS_OK)
+			return status;
+	}
+	for (i = 0; i < nodes.size(); ++i)
+	{
+		if ((status = linkPointerArrays(nodes[i])) != FS_OK)
+			return status;
+	}
+
+
+	// Now the blocks only read each other: they can be converted in any order
+#if FBT_USE_THREADS == 1
+	const int numThreads = fbtGetNumThreads();
+	if (numThreads > 1 && nodes.size() > 1)
+	{
+		// one fbtParallelFor() index per run of nodes converting about 64 KB
+		fbtArray<FBTsizeType> batches;
+		FBTsize bytes = 0;
+		for (i = 0; i < nodes.size(); ++i)
+		{
+			if (bytes == 0)
+				batches.push_back(i);
+			bytes += (FBTsize)nodes[i]->m_chunk.m_len;
+			if (bytes >= (64 << 10))
+				bytes = 0;
+		}
+		batches.push_back(nodes.size());
+
+		fbtArray<FBTsizeType> lastRange(numThreads, FBT_NPOS);
+
+		LinkJob job;
+		job.m_file      = this;
+		job.m_nodes     = nodes.ptr();
+		job.m_batches   = batches.ptr();
+		job.m_lastRange = lastRange.ptr();
+		fbtParallelFor(batches.size() - 1, numThreads, linkBatch, &job);
+
+		for (i = 0; i < nodes.size(); ++i)
+			releasePayload(nodes[i]);
+	}
+	else
+#endif
+	{
+		for (i = 0; i < nodes.size(); ++i)
+		{
+			convertBlock(nodes[i], m_lastRange);
+			releasePayload(nodes[i]);
+		}
+	}
+
+	// in file order, once every block is converted
+	for (i = 0; i < nodes.size(); ++i)
+		notifyData(nodes[i]->m_newBlock, nodes[i]->m_chunk);
+
+	for (node = (MemoryChunk*)m_chunks.first; node; node = node->m_next)
+	{
+		keepPayload(node);
+		node->m_block = 0;
+	}
+	m_payloads.clear();
+	m_linkOps.clear();
+	m_linkPlans.clear();
+
+	return fbtFile::FS_OK;
+}
+
+
+int fbtFile::linkLazily(void)
+{
+	// the stream memory goes away with parse()
+	MemoryChunk* node;
+	for (node = (MemoryChunk*)m_chunks.first; node; node = node->m_next)
+	{
+		if (!(node->m_flag & MemoryChunk::BLK_EXTERNAL))
+			continue;
+
+		void* block = m_payloads.alloc((FBTsize)node->m_chunk.m_len);
+		if (!block)
+		{
+			FBT_MALLOC_FAILED;
+			return FS_BAD_ALLOC;
+		}
+		fbtMemcpy(block, node->m_block, (FBTsize)node->m_chunk.m_len);
+		node->m_block = block;
+		node->m_flag  = (FBTuint8)(node->m_flag & ~MemoryChunk::BLK_EXTERNAL);
+		if (m_payloads.isOwnBlock((FBTsize)node->m_chunk.m_len))
+			node->m_flag |= MemoryChunk::BLK_OWN_PAYLOAD;
+	}
+
+	static const FBThash hk = fbtCharHashKey("Link").hash();
+
+	m_idBlocks.clear();
+	for (node = (MemoryChunk*)m_chunks.first; node; node = node->m_next)
+	{
+		if (node->m_chunk.m_code == DATA || !linkBlock(node))
+			continue;
+
+		fbtStruct* cs = m_memory->m_offs.ptr()[node->m_newTypeId];
+		if (m_memory->m_type[cs->m_key.k16[0]].m_typeId == hk)
+			continue;
+
+		// notifyData() links the ID lists (id.next/prev) with these addresses, that must not be old pointers too
+		while (findBlock((FBTsize)node->m_newBlock))
+		{
+			void* block = m_arena.alloc((FBTsize)node->m_chunk.m_len);
+			if (!block)
+			{
+				FBT_MALLOC_FAILED;
+				return FS_BAD_ALLOC;
+			}
+			fbtMemcpy(block, node->m_newBlock, (FBTsize)node->m_chunk.m_len);
+			node->m_newBlock = block;
+		}
+
+		PtrRange r;
+		r.m_begin = r.m_end = (FBTsize)node->m_newBlock;
+		r.m_index = m_idBlocks.size();
+		r.m_chunk = node;
+		m_idBlocks.push_back(r);
+
+		notifyData(node->m_newBlock, node->m_chunk);
+	}
+	sortPtrIndex(m_idBlocks);
+
+	// (the payloads not converted yet and the plans stay for linkBlock())
+	return FS_OK;
+}
+
+
+void* fbtFile::linkBlock(MemoryChunk* node)
+{
+	if (node->m_flag & MemoryChunk::BLK_LINKED)
+		return node->m_newBlock;
+	node->m_flag |= MemoryChunk::BLK_LINKED;
+
+	if (newBlock(node) != FS_OK || !node->m_newBlock)
+	{
+		node->m_newBlock = 0;
+		return 0;
+	}
+
+	static const FBThash hk = fbtCharHashKey("Link").hash();
+
+	fbtStruct* cs = m_memory->m_offs.ptr()[node->m_newTypeId];
+	if (m_memory->m_type[cs->m_key.k16[0]].m_typeId == hk)
+	{
+		keepPayload(node);
+		return node->m_newBlock;
+	}
+
+	if (compilePlan(node->m_chunk.m_typeid) != FS_OK)
+	{
+		node->m_newBlock = 0;
+		return 0;
+	}
+
+	convertBlock(node, m_lastRange);
+	releasePayload(node);
+	keepPayload(node);
+	return node->m_newBlock;
+}
+
+
+void* fbtFile::resolve(const void* ptr)
+{
+	if (!m_lazyLink || !ptr || findPtrRange(m_idBlocks, (FBTsize)ptr) != FBT_NPOS)
+		return const_cast<void*>(ptr);
+
+	MemoryChunk* bin = findBlock((FBTsize)ptr);
+	if (!bin || !linkBlock(bin))
+		return 0;
+	return findPtr((FBTsize)ptr);
+}
+
+
+void* fbtFile::resolve(const void* ptrArray, FBTsizeType index)
+{
+	if (!m_lazyLink)
+		return ptrArray ? static_cast<void* const*>(ptrArray)[index] : 0;
+
+	// (still the file pointers)
+	const FBTbyte* raw = static_cast<const FBTbyte*>(resolve(ptrArray));
+	if (!raw)
+		return 0;
+	return resolve((const void*)fbtReadOldPtr(raw + index * m_file->m_ptr, m_file->m_ptr, (m_fileHeader & FH_ENDIAN_SWAP) != 0));
+}
+
+
+int fbtFile::newBlock(MemoryChunk* node)
+{
+	fbtBinTables::OffsM::Pointer fd = m_file->m_offs.ptr();
+	const bool swapped = (m_fileHeader & FH_ENDIAN_SWAP) != 0;
+
+	static const FBThash hk = fbtCharHashKey("Link").hash();
+
+	if (node->m_chunk.m_typeid >= m_file->m_strcNr || !( fd[node->m_chunk.m_typeid]->m_link))
+		return FS_OK;
+
+	fbtStruct* fs, *ms;
+	fs = fd[node->m_chunk.m_typeid];
+	ms = fs->m_link;
+
+	node->m_newTypeId = ms->m_strcId;
+	// (the payloads sharing an m_payloads block are released with it)
+	const bool owned = (node->m_flag & MemoryChunk::BLK_OWN_PAYLOAD) != 0;
+
+	if (m_memory->m_type[ms->m_key.k16[0]].m_typeId == hk)
+	{
+		if (owned)
+		{
+			node->m_newBlock = node->m_block;
+			return FS_OK;
+		}
+
+		FBTsize totSize = node->m_chunk.m_len;
+		node->m_newBlock = m_arena.alloc(totSize);
+		//printf("alloc1 m_newBlock: 0x%x %d\n", node->m_newBlock, totSize);fflush(stdout);
+
+		if (!node->m_newBlock)
+		{
+			FBT_MALLOC_FAILED;
+			return FS_BAD_ALLOC;
+		}
+
+		fbtMemcpy(node->m_newBlock, node->m_block, totSize);
+		return FS_OK;
+	}
+
+
+	if (skip(m_memory->m_type[ms->m_key.k16[0]].m_typeId))
+		return FS_OK;
+
+
+	FBTsize totSize = (node->m_chunk.m_nr * ms->m_len);
+
+	node->m_chunk.m_len = totSize;
+
+	if (owned && (fs->m_flag & fbtStruct::SAME_LAYOUT) && !swapped)
+	{
+		node->m_newBlock = node->m_block;
+		return FS_OK;
+	}
+
+	node->m_newBlock = m_arena.alloc(totSize);
+	//printf("alloc2 m_newBlock: 0x%x %d\n", node->m_newBlock, totSize);fflush(stdout);
+
+	if (!node->m_newBlock)
+	{
+		FBT_MALLOC_FAILED;
+		return FS_BAD_ALLOC;
+	}
+
+
+	// (OP_BLOCK overwrites all of it)
+	if ((fs->m_flag & fbtStruct::SAME_LAYOUT) && !swapped)
+		return FS_OK;
+
+	// always zero this
+	fbtMemset(node->m_newBlock, 0, totSize);
+	return FS_OK;
+}
+
+
+int fbtFile::compilePlan(FBTsizeType structId)
+{
+	if (m_linkPlans[structId] != FBT_NPOS)
+		return FS_OK;
+
+	const FBTsizeType first = m_linkOps.size();
+	m_linkPlans[structId] = first;
+
+	const fbtStruct* fs = m_file->m_offs.ptr()[structId];
+	const fbtStruct* cs = fs->m_link;
+	fbtStruct::Members::ConstPointer p2 = fs->m_members.ptr();
+	const FBTsizeType s2 = fs->m_members.size();
+	const bool endianSwap = (m_fileHeader & FH_ENDIAN_SWAP) != 0;
+
+	// the same bytes: copied whole, then only the pointers are patched
+	const bool sameLayout = (fs->m_flag & fbtStruct::SAME_LAYOUT) && !endianSwap;
+	if (sameLayout)
+	{
+		LinkOp op;
+		fbtMemset(&op, 0, sizeof(LinkOp));
+		op.m_code = LinkOp::OP_BLOCK;
+		op.m_len  = cs->m_len;
+		m_linkOps.push_back(op);
+	}
+
+	for (FBTsizeType i2 = 0; i2 < s2; ++i2)
+	{
+		const fbtStruct* srcStrc = &p2[i2];
+		const fbtStruct* dstStrc = srcStrc->m_link;
+
+		// If it's missing we can safely skip this member
+		if (!dstStrc)
+			continue;
+
+		const fbtName& nameD = m_memory->m_name[dstStrc->m_key.k16[1]];
+		const fbtName& nameS = m_file->m_name[srcStrc->m_key.k16[1]];
+		if (sameLayout && nameD.m_ptrCount == 0)
+			continue;
+
+		LinkOp op;
+		fbtMemset(&op, 0, sizeof(LinkOp));
+		op.m_dst = dstStrc->m_off;
+		op.m_src = srcStrc->m_off;
+
+		if (nameD.m_ptrCount > 0)
+		{
+			if (nameD.m_ptrCount > 1)
+			{
+				op.m_code = LinkOp::OP_PTR_ARRAY;
+				op.m_len  = 1;
+			}
+			else
+			{
+				op.m_code = LinkOp::OP_PTR;
+				op.m_len  = fbtMin(nameS.m_arraySize, nameD.m_arraySize);
+			}
+			pushLinkOp(op, first);
+			continue;
+		}
+
+		const FBTint32 dstElmSize = dstStrc->m_len / nameD.m_arraySize;
+		const FBTint32 srcElmSize = srcStrc->m_len / nameS.m_arraySize;
+
+		const bool needCast = (srcStrc->m_flag & fbtStruct::NEED_CAST) != 0;
+		const bool needSwap = endianSwap && srcElmSize > 1;
+
+		if (!needCast && !needSwap && srcStrc->m_val.k32[0] == dstStrc->m_val.k32[0]) //same type
+		{
+			// Take the minimum length of any array.
+			op.m_code = LinkOp::OP_COPY;
+			op.m_len  = fbtMin(srcStrc->m_len, dstStrc->m_len);
+			pushLinkOp(op, first);
+			continue;
+		}
+
+		FBT_PRIM_TYPE stp = FBT_PRIM_UNKNOWN, dtp  = FBT_PRIM_UNKNOWN;
+		if (needCast || needSwap)
+		{
+			stp = fbtGetPrimType(srcStrc->m_val.k32[0]);
+			dtp = fbtGetPrimType(dstStrc->m_val.k32[0]);
+
+			FBT_ASSERT(!needCast || (stp < FBT_PRIM_VOID && dtp < FBT_PRIM_VOID && stp != dtp));
+		}
+
+		if (needSwap)
+		{
+			if (stp == FBT_PRIM_SHORT || stp == FBT_PRIM_USHORT)
+				op.m_swap = 2;
+			else if (stp >= FBT_PRIM_INT && stp <= FBT_PRIM_FLOAT)
+				op.m_swap = 4;
+			else if (stp == FBT_PRIM_DOUBLE)
+				op.m_swap = 8;
+			else
+				op.m_swap = LinkOp::SWAP_ZERO; //unknown type
+		}
+
+		op.m_len     = fbtMin(nameS.m_arraySize, nameD.m_arraySize);
+		op.m_srcSize = srcElmSize;
+		op.m_dstSize = dstElmSize;
+		op.m_cast    = needCast ? fbtGetCastKernel(stp, dtp) : 0;
+		FBT_ASSERT(op.m_swap == 0 || op.m_swap == LinkOp::SWAP_ZERO || srcElmSize <= 8);
+
+		if (!needCast && op.m_swap == srcElmSize && srcElmSize == dstElmSize)
+			op.m_code = LinkOp::OP_SWAP;
+		else
+			op.m_code = LinkOp::OP_VALUES;
+		pushLinkOp(op, first);
+	}
+
+	// a single swap run over the whole element: the block is swapped at once
+	if (m_linkOps.size() == first + 1)
+	{
+		LinkOp& op = m_linkOps[first];
+		if (op.m_code == LinkOp::OP_SWAP && op.m_dst == 0 && op.m_src == 0 &&
+		    op.m_len * op.m_srcSize == cs->m_len && cs->m_len == fs->m_len)
+		{
+			op.m_code = LinkOp::OP_BLOCK;
+			op.m_len  = cs->m_len;
+		}
+	}
+
+	LinkOp end;
+	fbtMemset(&end, 0, sizeof(LinkOp));
+	end.m_code = LinkOp::OP_END;
+	m_linkOps.push_back(end);
+	return FS_OK;
+}
+
+
+void fbtFile::pushLinkOp(const LinkOp& op, FBTsizeType first)
+{
+	if (m_linkOps.size() > first)
+	{
+		LinkOp& last = m_linkOps[m_linkOps.size() - 1];
+		if (last.m_code == op.m_code)
+		{
+			FBTint32 dstStep = 0, srcStep = 0;
+			if (op.m_code == LinkOp::OP_COPY)
+				dstStep = srcStep = 1;
+			else if (op.m_code == LinkOp::OP_SWAP && last.m_srcSize == op.m_srcSize)
+				dstStep = srcStep = op.m_srcSize;
+			else if (op.m_code == LinkOp::OP_VALUES && last.m_cast == op.m_cast && last.m_swap == op.m_swap &&
+			         last.m_srcSize == op.m_srcSize && last.m_dstSize == op.m_dstSize)
+			{
+				dstStep = op.m_dstSize;
+				srcStep = op.m_srcSize;
+			}
+			else if (op.m_code == LinkOp::OP_PTR)
+			{
+				dstStep = m_memory->m_ptr;
+				srcStep = m_file->m_ptr;
+			}
+
+			if (dstStep && last.m_dst + last.m_len * dstStep == op.m_dst && last.m_src + last.m_len * srcStep == op.m_src)
+			{
+				last.m_len += op.m_len;
+				return;
+			}
+		}
+	}
+	m_linkOps.push_back(op);
+}
+
+
+int fbtFile::linkPointerArrays(MemoryChunk* node)
+{
+	const fbtStruct* fs = m_file->m_offs.ptr()[node->m_chunk.m_typeid];
+	const LinkOp* plan = m_linkOps.ptr() + m_linkPlans[node->m_chunk.m_typeid];
+	const LinkOp* op;
+	const FBTuint8 mps = m_memory->m_ptr, fps = m_file->m_ptr;
+	const bool endianSwap = (m_fileHeader & FH_ENDIAN_SWAP) != 0;
+
+	for (op = plan; op->m_code != LinkOp::OP_END; ++op)
+	{
+		if (op->m_code == LinkOp::OP_PTR_ARRAY)
+			break;
+	}
+	if (op->m_code == LinkOp::OP_END)
+		return FS_OK;
+
+
+	for (FBTsize n = 0; n < (FBTsize)node->m_chunk.m_nr; ++n)
+	{
+		const FBTbyte* src = static_cast<const FBTbyte*>(node->m_block) + (fs->m_len * n);
+
+		for (op = plan; op->m_code != LinkOp::OP_END; ++op)
+		{
+			if (op->m_code != LinkOp::OP_PTR_ARRAY)
+				continue;
+
+			const FBTsize srcVal = fbtReadOldPtr(src + op->m_src, fps, endianSwap);
+			if (!srcVal)
+				continue;
+
+			MemoryChunk* bin = findBlock(srcVal);
+			if (!bin || (bin->m_flag & MemoryChunk::BLK_MODIFIED))
+			{
+				//fbtPrintf("**block not found @ 0x%p)\n", src);
+				continue;
+			}
+
+			// take pointer size out of the equation
+			const FBTsize total = (FBTsize)bin->m_chunk.m_len / fps;
+
+			// (each pointer is read before it is overwritten)
+			const bool inPlace = bin->m_newBlock == bin->m_block && mps == fps;
+
+			FBTsize* nptr = inPlace ? static_cast<FBTsize*>(bin->m_block) : (FBTsize*)m_arena.alloc(total * mps);
+			if (!nptr)
+			{
+				FBT_MALLOC_FAILED;
+				return FS_BAD_ALLOC;
+			}
+			if (!inPlace)
+				fbtMemset(nptr, 0, total * mps);
+
+			const FBTbyte* optr = static_cast<const FBTbyte*>(bin->m_block);
+
+			for (FBTsize pi = 0; pi < total; pi++, optr += fps)
+				nptr[pi] = (FBTsize)findPtr(fbtReadOldPtr(optr, fps, endianSwap));
+
+			bin->m_chunk.m_len = total * mps;
+			bin->m_flag |= MemoryChunk::BLK_MODIFIED;
+
+			// (a raw copy in m_arena stays there)
+			bin->m_newBlock = nptr;
+			releasePayload(bin);
+		}
+	}
+	return FS_OK;
+}
+
+
+void fbtFile::releasePayload(MemoryChunk* node)
+{
+	if ((node->m_flag & MemoryChunk::BLK_OWN_PAYLOAD) && node->m_block != node->m_newBlock)
+	{
+		m_payloads.release(node->m_block);
+		node->m_block = 0;
+		node->m_flag  = (FBTuint8)(node->m_flag & ~MemoryChunk::BLK_OWN_PAYLOAD);
+	}
+}
+
+
+void fbtFile::keepPayload(MemoryChunk* node)
+{
+	if ((node->m_flag & MemoryChunk::BLK_OWN_PAYLOAD) && node->m_block == node->m_newBlock)
+	{
+		m_arena.adopt(m_payloads, node->m_block);
+		node->m_flag = (FBTuint8)(node->m_flag & ~MemoryChunk::BLK_OWN_PAYLOAD);
+	}
+}
+
+
+void fbtFile::convertBlock(MemoryChunk* node, FBTsizeType& lastRange)
+{
+	const fbtStruct* fs = m_file->m_offs.ptr()[node->m_chunk.m_typeid];
+	const LinkOp* plan = m_linkOps.ptr() + m_linkPlans[node->m_chunk.m_typeid];
+	const FBTsize dstLen = fs->m_link->m_len, srcLen = fs->m_len;
+	const FBTuint8 fps = m_file->m_ptr;
+	const bool endianSwap = (m_fileHeader & FH_ENDIAN_SWAP) != 0;
+
+	FBTbyte* dst = static_cast<FBTbyte*>(node->m_newBlock);
+	const FBTbyte* src = static_cast<const FBTbyte*>(node->m_block);
+	FBTint32 i;
+
+	if (plan->m_code == LinkOp::OP_BLOCK)
+	{
+		// (nothing to copy in place: the pointers are read before they are patched)
+		const FBTsize total = (FBTsize)node->m_chunk.m_nr * plan->m_len;
+		if (dst != src)
+			fbtMemcpy(dst, src, total);
+
+		if (plan->m_swap == 2)
+			fbtSwap16((FBTuint16*)dst, total / 2);
+		else if (plan->m_swap == 4)
+			fbtSwap32((FBTuint32*)dst, total / 4);
+		else if (plan->m_swap == 8)
+			fbtSwap64((FBTuint64*)dst, total / 8);
+
+		// (the old pointers are already there)
+		if (m_lazyLink && !plan->m_swap)
+			return;
+		if ((++plan)->m_code == LinkOp::OP_END)
+			return;
+	}
+
+	for (FBTsize n = 0; n < (FBTsize)node->m_chunk.m_nr; ++n, dst += dstLen, src += srcLen)
+	{
+		for (const LinkOp* op = plan; op->m_code != LinkOp::OP_END; ++op)
+		{
+			FBTbyte* dstPtr = dst + op->m_dst;
+			const FBTbyte* srcPtr = src + op->m_src;
+
+			switch (op->m_code)
+			{
+			case LinkOp::OP_COPY:
+				fbtMemcpy(dstPtr, srcPtr, op->m_len);
+				break;
+
+			case LinkOp::OP_SWAP:
+				fbtMemcpy(dstPtr, srcPtr, op->m_len * op->m_srcSize);
+				if (op->m_swap == 2)
+					fbtSwap16((FBTuint16*)dstPtr, op->m_len);
+				else if (op->m_swap == 4)
+					fbtSwap32((FBTuint32*)dstPtr, op->m_len);
+				else
+					fbtSwap64((FBTuint64*)dstPtr, op->m_len);
+				break;
+
+			case LinkOp::OP_VALUES:
+			{
+				if (op->m_swap == LinkOp::SWAP_ZERO)
+				{
+					// (unknown type)
+					const FBTsize elen = fbtMin(op->m_srcSize, op->m_dstSize);
+					for (i = 0; i < op->m_len; i++, dstPtr += op->m_dstSize)
+						fbtMemset(dstPtr, 0, elen);
+					break;
+				}
+				if (!op->m_swap)
+				{
+					if (op->m_cast)
+						op->m_cast(srcPtr, dstPtr, op->m_len);
+					else
+						copyValues(srcPtr, dstPtr, op->m_srcSize, op->m_dstSize, op->m_len);
+					break;
+				}
+
+				// swapped in a buffer first, a run at a time
+				FBTuint64 tmpBuf[32];
+				const FBTint32 run = (FBTint32)(sizeof(tmpBuf) / op->m_srcSize);
+				for (i = 0; i < op->m_len; i += run)
+				{
+					const FBTint32 cnt = fbtMin(run, op->m_len - i);
+					FBTbyte* tmp = reinterpret_cast<FBTbyte*>(tmpBuf);
+					fbtMemcpy(tmp, srcPtr, cnt * op->m_srcSize);
+
+					// (only the first m_swap bytes of wider values)
+					if (op->m_swap == 2 && op->m_srcSize == 2)
+						fbtSwap16((FBTuint16*)tmp, cnt);
+					else if (op->m_swap == 4 && op->m_srcSize == 4)
+						fbtSwap32((FBTuint32*)tmp, cnt);
+					else if (op->m_swap == 8 && op->m_srcSize == 8)
+						fbtSwap64((FBTuint64*)tmp, cnt);
+					else
+					{
+						for (FBTint32 k = 0; k < cnt; ++k, tmp += op->m_srcSize)
+						{
+							if (op->m_swap == 2)
+								fbtSwap16((FBTuint16*)tmp, 1);
+							else if (op->m_swap == 4)
+								fbtSwap32((FBTuint32*)tmp, 1);
+							else
+								fbtSwap64((FBTuint64*)tmp, 1);
+						}
+						tmp = reinterpret_cast<FBTbyte*>(tmpBuf);
+					}
+
+					if (op->m_cast)
+						op->m_cast(tmp, dstPtr, cnt);
+					else
+						copyValues(tmp, dstPtr, op->m_srcSize, op->m_dstSize, cnt);
+
+					srcPtr += cnt * op->m_srcSize;
+					dstPtr += cnt * op->m_dstSize;
+				}
+				break;
+			}
+
+			case LinkOp::OP_PTR:
+			{
+				FBTsize* dptr = (FBTsize*)dstPtr;
+				for (i = 0; i < op->m_len; ++i, srcPtr += fps)
+				{
+					const FBTsize srcVal = fbtReadOldPtr(srcPtr, fps, endianSwap);
+					dptr[i] = (srcVal && !m_lazyLink) ? (FBTsize)findPtr(srcVal, lastRange) : srcVal;
+				}
+				break;
+			}
+
+			case LinkOp::OP_PTR_ARRAY:
+			{
+				// (converted by linkPointerArrays())
+				const FBTsize srcVal = fbtReadOldPtr(srcPtr, fps, endianSwap);
+				if (m_lazyLink)
+				{
+					*(FBTsize*)dstPtr = srcVal;
+					break;
+				}
+				MemoryChunk* bin = srcVal ? findBlock(srcVal, lastRange) : 0;
+				*(FBTsize*)dstPtr = (bin && (bin->m_flag & MemoryChunk::BLK_MODIFIED)) ? (FBTsize)findPtr(srcVal, lastRange) : 0;
+				break;
+			}
+			}
+		}
+	}
+}
+
+
+
+
+
+
+void* fbtFile::findPtr(const FBTsize& iptr)
+{
+	return findPtr(iptr, m_lastRange);
+}
+
+
+fbtFile::MemoryChunk* fbtFile::findBlock(const FBTsize& iptr)
+{
+	return findBlock(iptr, m_lastRange);
+}
+
+
+void* fbtFile::findPtr(const FBTsize& iptr, FBTsizeType& lastRange)
+{
+	MemoryChunk* bin = findBlock(iptr, lastRange);
+	if (!bin || !bin->m_newBlock)
+		return 0;
+
+	const FBTsize offset = iptr - bin->m_chunk.m_old;
+#if FBT_RESOLVE_INNER_POINTERS == 1
+	return offset ? findInnerPtr(bin, offset) : bin->m_newBlock;
+#else
+	// (nothing tells a pointer into the block from a stale one that lands there)
+	return offset ? 0 : bin->m_newBlock;
+#endif
+}
+
+
+fbtFile::MemoryChunk* fbtFile::findBlock(const FBTsize& iptr, FBTsizeType& lastRange) const
+{
+	// consecutive lookups often hit the same block (e.g. pointer arrays)
+	FBTsizeType i = lastRange;
+	if (i >= m_ptrIndex.size() || iptr < m_ptrIndex[i].m_begin ||
+	    (iptr >= m_ptrIndex[i].m_end && iptr != m_ptrIndex[i].m_begin))
+	{
+		if ((i = findPtrRange(m_ptrIndex, iptr)) == FBT_NPOS)
+			return 0;
+		lastRange = i;
+	}
+	return m_ptrIndex[i].m_chunk;
+}
+
+
+void* fbtFile::findInnerPtr(MemoryChunk* bin, FBTsize offset)
+{
+	static const FBThash hk = fbtCharHashKey("Link").hash();
+
+	const FBTuint8 mps = m_memory->m_ptr, fps = m_file->m_ptr;
+	char* base = static_cast<char*>(bin->m_newBlock);
+
+	// pointer arrays converted by link()
+	if (bin->m_flag & MemoryChunk::BLK_MODIFIED)
+		return (offset % fps) ? 0 : base + (offset / fps) * mps;
+
+	if (bin->m_chunk.m_typeid >= m_file->m_strcNr)
+		return 0;
+
+	fbtStruct* fs = m_file->m_offs.ptr()[bin->m_chunk.m_typeid];
+	fbtStruct* ms = fs->m_link;
+	if (!ms)
+		return 0;
+
+	// raw copies
+	if (m_memory->m_type[ms->m_key.k16[0]].m_typeId == hk)
+		return base + offset;
+
+	if (fs->m_len == 0 || offset / fs->m_len >= (FBTsize)bin->m_chunk.m_nr)
+		return 0;
+
+	base += (offset / fs->m_len) * ms->m_len;
+	offset %= fs->m_len;
+	if (offset == 0)
+		return base;
+
+
+	// inside an element: the (flattened) member holding it
+	fbtStruct::Members::Pointer fd = fs->m_members.ptr();
+	for (FBTsizeType i = 0; i < fs->m_members.size(); ++i)
+	{
+		const fbtStruct* src = &fd[i];
+		const fbtStruct* dst = src->m_link;
+		if (!dst || offset < (FBTsize)src->m_off || offset >= (FBTsize)(src->m_off + src->m_len))
+			continue;
+
+		const fbtName& nameD = m_memory->m_name[dst->m_key.k16[1]];
+		const fbtName& nameS = m_file->m_name[src->m_key.k16[1]];
+		const FBTsize dstElmSize = dst->m_len / nameD.m_arraySize;
+		const FBTsize srcElmSize = src->m_len / nameS.m_arraySize;
+
+		const FBTsize elm = (offset - src->m_off) / srcElmSize, rest = (offset - src->m_off) % srcElmSize;
+		if (elm >= (FBTsize)nameD.m_arraySize || (rest && srcElmSize != dstElmSize))
+			return 0;
+		return base + dst->m_off + elm * dstElmSize + rest;
+	}
+	return 0;
+}
+
+
+
+int fbtFile::compileOffsets(const fbtBinTables* memory, fbtBinTables* file)
+{
+	fbtLinkCompiler lnk;
+	lnk.m_mp = memory;
+	lnk.m_fp = file;
+	return lnk.link();
+}
+
+bool fbtFile::_setuid(const char* uid)
+{
+	if (!uid || strlen(uid) != 7) return false;
+
+	m_uhid = uid;
+	return true;
+}
+
+int fbtFile::reflect(const char* path, const int mode, const fbtEndian& /*endian*/)
+{
+	fbtStream* fs;
+	
+#if FBT_USE_GZ_FILE == 1
+	if (mode == PM_COMPRESSED)
+		fs = new fbtGzStream();
+	else
+#endif
+	{
+		fs = new fbtFileStream();
+	}
+	
+	fs->open(path, fbtStream::SM_WRITE);
+
+
+	FBTuint8 cp = FBT_VOID8 ? FM_64_BIT : FM_32_BIT;
+	FBTuint8 ce = ((FBTuint8)fbtGetEndian()) == FBT_ENDIAN_IS_BIG ? FM_BIG_ENDIAN : FM_LITTLE_ENDIAN;
+
+//	Commented for now since the rest of the code does not care
+//	if (endian != FBT_ENDIAN_NATIVE)
+//	{
+//		if (endian == FBT_ENDIAN_IS_BIG)
+//			ce = FM_BIG_ENDIAN;
+//		else
+//			ce = FM_LITTLE_ENDIAN;
+//	}
+
+	// put magic
+	//fs->writef("%s%c%c%i", m_uhid, cp, ce, m_version);
+    char header[FBT_BLEND_HEADER_SIZE] = {};//{0,0,0,0,0,0,0,0,0,0,0,0};
+	char version[33];
+	sprintf(version, "%i",m_version);
+	
+	strncpy(&header[0], m_uhid, 7); // 7 first bytes of header
+#   if BLENDER_VERSION<500
+	header[7] = cp;					// 8th byte = pointer size
+	header[8] = ce;					// 9th byte = endianness
+    strncpy(&header[9], version, 3);// last 3 bytes for 3 version char
+#   else
+    header[7]='1';header[8]='7'; // header size = 17
+    header[9]='-';
+    header[10]='0';header[11]='1'; // file version format = 01
+    header[12]=ce; // endianness
+    strncpy(&header[13], version, 4);// last 4 bytes for 4 version char
+#   endif
+    fs->write(header, FBT_BLEND_HEADER_SIZE);
+	
+	writeData(fs);
+
+	// write DNA1
+	Chunk ch;
+	ch.m_code   = DNA1;
+	ch.m_len    = getFBTlength();
+	ch.m_nr     = 1;
+	ch.m_old    = 0;
+	ch.m_typeid = 0;
+	fs->write(&ch, fbtChunk::BlockSize);
+	fs->write(getFBT(), ch.m_len);
+
+
+	// write ENDB (End Byte | EOF )
+	ch.m_code   = ENDB;
+	ch.m_len    = 0;
+	ch.m_nr     = 0;
+	ch.m_old    = 0;
+	ch.m_typeid = 0;
+	fs->write(&ch, fbtChunk::BlockSize);
+	
+	delete fs;
+	return FS_OK;
+
+}
+
+void fbtFile::writeStruct(fbtStream* stream, FBTtype index, FBTuint32 code, FBTsize len, void* writeData)
+{
+	Chunk ch;
+	ch.m_code   = code;
+	ch.m_len    = len;
+	ch.m_nr     = 1;
+	ch.m_old    = (FBTsize)writeData;
+	ch.m_typeid = index;
+
+	fbtChunk::write(&ch, stream);
+}
+
+void fbtFile::writeBuffer(fbtStream* stream, FBTsize len, void* writeData)
+{
+	Chunk ch;
+	ch.m_code   = DATA;
+	ch.m_len    = len;
+	ch.m_nr     = 1;
+	ch.m_old    = (FBTsize)writeData;
+	ch.m_typeid = m_memory->findTypeId("Link");
+
+	fbtChunk::write(&ch, stream);
+}
+
+int fbtChunk::write(fbtFile::Chunk* src, fbtStream* stream)
+{	
+	int size = 0;
+	size += stream->write(src, BlockSize);
+	size += stream->write((void*)src->m_old, src->m_len);
+	return size;
+}
+
+int fbtChunk::read(fbtFile::Chunk* dest, fbtStream* stream, int flags)
+{
+	FBTsize bytesRead = 0;
+    bool bitsVary   = (flags & fbtFile::FH_VAR_BITS) != 0;
+	bool swapEndian = (flags & fbtFile::FH_ENDIAN_SWAP) != 0;
+
+	fbtFile::Chunk64 c64;
+	fbtFile::Chunk32 c32;
+	fbtFile::Chunk*  cpy;
+
+
+	if (FBT_VOID8)
+	{
+        // here we must add support for Blender 5.0+ where most lengths are 64 bit and the Chunk64 field order is different than before
+        if (bitsVary)
+		{
+            FBT_ASSERT(BLENDER_VERSION<500); // old format only (TOTEST: ican this happen?)
+			fbtFile::Chunk32 src;
+			if ((bytesRead = stream->read(&src, Block32)) != Block32)
+			{
+				FBT_INVALID_READ;
+				return fbtFile::FS_INV_READ;
+			}
+
+			c64.m_code    = src.m_code;
+			c64.m_len     = src.m_len;
+
+			union
+			{
+				FBTuint64   m_ptr;
+				FBTuint32   m_doublePtr[2];
+			} ptr;
+			ptr.m_doublePtr[0] = swapEndian ? fbtSwap32(src.m_old) : src.m_old;
+			ptr.m_doublePtr[1] = 0;
+
+			c64.m_old     = ptr.m_ptr;
+			c64.m_typeid  = src.m_typeid;
+			c64.m_nr      = src.m_nr;
+		}
+		else
+		{
+			if ((bytesRead = stream->read(&c64, BlockSize)) != BlockSize)
+			{
+				FBT_INVALID_READ;
+				return fbtFile::FS_INV_READ;
+			}
+
+			// (old pointers are compared with the swapped ones of the blocks)
+			if (swapEndian)
+				c64.m_old = fbtSwap64(c64.m_old);
+		}
+
+		if (swapEndian)
+		{
+			if ((c64.m_code & 0xFFFF) == 0)
+				c64.m_code >>= 16;
+
+#           if BLENDER_VERSION<500
+			c64.m_len    = fbtSwap32(c64.m_len);
+			c64.m_nr     = fbtSwap32(c64.m_nr);
+			c64.m_typeid = fbtSwap32(c64.m_typeid);
+#           else
+            c64.m_typeid = fbtSwap32(c64.m_typeid);
+            c64.m_len    = fbtSwap64(c64.m_len);
+            c64.m_nr     = fbtSwap64(c64.m_nr);
+#           endif
+		}
+
+        cpy = (fbtFile::Chunk*)(&c64);
+	}
+	else
+	{
+        FBT_ASSERT(BLENDER_VERSION<500); // old format only
+		if (bitsVary)
+		{
+			fbtFile::Chunk64 src;
+			if ((bytesRead = stream->read(&src, Block64)) != Block64)
+			{
+				FBT_INVALID_READ;
+				return fbtFile::FS_INV_READ;
+			}
+
+			// copy down
+
+			c32.m_code    = src.m_code;
+			c32.m_len     = src.m_len;
+
+			union
+			{
+				FBTuint64   m_ptr;
+				FBTuint32   m_doublePtr[2];
+			} ptr;
+			ptr.m_doublePtr[0] = 0;
+			ptr.m_doublePtr[1] = 0;
+			ptr.m_ptr = swapEndian ? fbtSwap64(src.m_old) : src.m_old;
+
+			c32.m_old       = ptr.m_doublePtr[0] != 0 ? ptr.m_doublePtr[0] : ptr.m_doublePtr[1];
+			c32.m_typeid    = src.m_typeid;
+			c32.m_nr        = src.m_nr;
+		}
+		else
+		{
+			if ((bytesRead = stream->read(&c32, BlockSize)) != BlockSize)
+			{
+				FBT_INVALID_READ;
+				return fbtFile::FS_INV_READ;
+			}
+
+			if (swapEndian)
+				c32.m_old = fbtSwap32(c32.m_old);
+		}
+
+
+		if (swapEndian)
+		{
+			if ((c32.m_code & 0xFFFF) == 0)
+				c32.m_code >>= 16;
+
+			c32.m_len    = fbtSwap32(c32.m_len);
+			c32.m_nr     = fbtSwap32(c32.m_nr);
+			c32.m_typeid = fbtSwap32(c32.m_typeid);
+		}
+
+
+
+		cpy = (fbtFile::Chunk*)(&c32);
+	}
+
+	if (cpy->m_len == FBT_NPOS)
+	{
+		FBT_INVALID_LEN;
+		return fbtFile::FS_INV_LENGTH;
+	}
+
+	fbtMemcpy(dest, cpy, BlockSize);
+	return (int)bytesRead;    // the header size: the payload length is dest->m_len
+}
+
+
+// Source File "fbtThreads.cpp"
+//#define FBT_IN_SOURCE
+//#include "fbtThreads.h"
+//#include "fbtPlatformHeaders.h"
+
+#if FBT_COMPILER == FBT_COMPILER_MSVC
+void fbtSpinLock::lock(void)        {while (InterlockedExchange(&m_locked, 1)) Sleep(0);}
+void fbtSpinLock::unlock(void)      {InterlockedExchange(&m_locked, 0);}
+#else
+void fbtSpinLock::lock(void)        {while (__sync_lock_test_and_set(&m_locked, 1)) {}}
+void fbtSpinLock::unlock(void)      {__sync_lock_release(&m_locked);}
+#endif
+
+#if FBT_USE_THREADS == 1
+
+#if FBT_PLATFORM == FBT_PLATFORM_WIN32
+fbtMutex::fbtMutex()                {InitializeCriticalSection(&m_cs);}
+fbtMutex::~fbtMutex()               {DeleteCriticalSection(&m_cs);}
+void fbtMutex::lock(void)           {EnterCriticalSection(&m_cs);}
+void fbtMutex::unlock(void)         {LeaveCriticalSection(&m_cs);}
+
+fbtSemaphore::fbtSemaphore(int count)   {m_handle = CreateSemaphore(NULL, count, 0x7FFFFFFF, NULL);}
+fbtSemaphore::~fbtSemaphore()           {CloseHandle(m_handle);}
+void fbtSemaphore::wait(void)           {WaitForSingleObject(m_handle, INFINITE);}
+void fbtSemaphore::post(void)           {ReleaseSemaphore(m_handle, 1, NULL);}
+#else
+fbtMutex::fbtMutex()                {pthread_mutex_init(&m_mutex, 0);}
+fbtMutex::~fbtMutex()               {pthread_mutex_destroy(&m_mutex);}
+void fbtMutex::lock(void)           {pthread_mutex_lock(&m_mutex);}
+void fbtMutex::unlock(void)         {pthread_mutex_unlock(&m_mutex);}
+
+// (unnamed POSIX semaphores are not available everywhere, e.g. on Apple platforms)
+fbtSemaphore::fbtSemaphore(int count)
+	:    m_count(count)
+{
+	pthread_mutex_init(&m_mutex, 0);
+	pthread_cond_init(&m_cond, 0);
+}
+
+fbtSemaphore::~fbtSemaphore()
+{
+	pthread_cond_destroy(&m_cond);
+	pthread_mutex_destroy(&m_mutex);
+}
+
+void fbtSemaphore::wait(void)
+{
+	pthread_mutex_lock(&m_mutex);
+	while (m_count <= 0)
+		pthread_cond_wait(&m_cond, &m_mutex);
+	--m_count;
+	pthread_mutex_unlock(&m_mutex);
+}
+
+void fbtSemaphore::post(void)
+{
+	pthread_mutex_lock(&m_mutex);
+	++m_count;
+	pthread_cond_signal(&m_cond);
+	pthread_mutex_unlock(&m_mutex);
+}
+#endif
+
+
+fbtThread::fbtThread()
+	:    m_func(0), m_arg(0), m_running(false), m_handle()
+{
+}
+
+
+fbtThread::~fbtThread()
+{
+	join();
+}
+
+
+bool fbtThread::start(Func func, void* arg)
+{
+	join();
+
+	m_func = func;
+	m_arg  = arg;
+#if FBT_PLATFORM == FBT_PLATFORM_WIN32
+	m_handle  = CreateThread(0, 0, entry, this, 0, 0);
+	m_running = m_handle != 0;
+#else
+	m_running = pthread_create(&m_handle, 0, entry, this) == 0;
+#endif
+	return m_running;
+}
+
+
+void fbtThread::join(void)
+{
+	if (!m_running)
+		return;
+#if FBT_PLATFORM == FBT_PLATFORM_WIN32
+	WaitForSingleObject(m_handle, INFINITE);
+	CloseHandle(m_handle);
+#else
+	pthread_join(m_handle, 0);
+#endif
+	m_running = false;
+}
+
+
+#if FBT_PLATFORM == FBT_PLATFORM_WIN32
+DWORD WINAPI fbtThread::entry(LPVOID self)
+{
+	((fbtThread*)self)->m_func(((fbtThread*)self)->m_arg);
+	return 0;
+}
+#else
+void* fbtThread::entry(void* self)
+{
+	((fbtThread*)self)->m_func(((fbtThread*)self)->m_arg);
+	return 0;
+}
+#endif
+
+
+struct fbtParallelForJob
+{
+	fbtParallelForFunc m_func;
+	void*              m_userData;
+	FBTsize            m_count;
+	FBTsize            m_next;
+	fbtMutex           m_mutex;
+};
+
+struct fbtParallelForWorker
+{
+	fbtParallelForJob* m_job;
+	int                m_worker;
+};
+
+
+static void fbtParallelForRun(fbtParallelForJob* job, int worker)
+{
+	for (;;)
+	{
+		job->m_mutex.lock();
+		const FBTsize index = job->m_next++;
+		job->m_mutex.unlock();
+
+		if (index >= job->m_count)
+			break;
+		job->m_func(job->m_userData, index, worker);
+	}
+}
+
+
+static void fbtParallelForThread(void* arg)
+{
+	fbtParallelForWorker* w = (fbtParallelForWorker*)arg;
+	fbtParallelForRun(w->m_job, w->m_worker);
+}
+
+
+void fbtParallelFor(FBTsize count, int numThreads, fbtParallelForFunc func, void* userData)
+{
+	fbtParallelForJob job;
+	job.m_func     = func;
+	job.m_userData = userData;
+	job.m_count    = count;
+	job.m_next     = 0;
+
+	if ((FBTsize)numThreads > count)
+		numThreads = (int)count;
+
+	// workers that can't be started just leave more indices to the others
+	fbtParallelForWorker* workers = 0;
+	fbtThread*            threads = 0;
+
+	if (numThreads > 1)
+	{
+		workers = new fbtParallelForWorker[numThreads - 1];
+		threads = new fbtThread[numThreads - 1];
+
+		for (int i = 0; i < numThreads - 1; ++i)
+		{
+			workers[i].m_job    = &job;
+			workers[i].m_worker = i + 1;
+			if (!threads[i].start(fbtParallelForThread, &workers[i]))
+				break;
+		}
+	}
+
+	fbtParallelForRun(&job, 0);
+
+	delete [] threads;  // joins
+	delete [] workers;
+}
+
+
+int fbtGetNumThreads(void)
+{
+#if FBT_MAX_THREADS > 0
+	return FBT_MAX_THREADS;
+#elif FBT_PLATFORM == FBT_PLATFORM_WIN32
+	SYSTEM_INFO info;
+	GetSystemInfo(&info);
+	return fbtMax<int>((int)info.dwNumberOfProcessors, 1);
+#else
+	return fbtMax<int>((int)sysconf(_SC_NPROCESSORS_ONLN), 1);
+#endif
+}
+
+#endif
+
+
+// Source File "fbtStreams.cpp"
+//#define FBT_IN_SOURCE
+//#include "fbtStreams.h"
+//#include "fbtPlatformHeaders.h"
+
+
+#if FBT_USE_GZ_FILE == 1
+#include "zlib.h"
+#include "zconf.h"
+#endif
+
+#if FBT_USE_ZSTD_FILE == 1
+#include "zstd.h"
+#endif
+
+fbtFileStream::fbtFileStream() 
+	:    m_file(), m_handle(0), m_mode(0), m_size(0)
+{
+}
+
+
+fbtFileStream::~fbtFileStream()
+{
+	close();
+}
+
+
+
+void fbtFileStream::open(const char* p, fbtStream::StreamMode mode)
+{
+	if (m_handle != 0 && m_file != p)
+		fclose((FILE *)m_handle);
+
+	char fm[3] = {0, 0, 0};
+	char* mp = &fm[0];
+	if (mode & fbtStream::SM_READ)
+		*mp++ = 'r';
+	else if (mode & fbtStream::SM_WRITE)
+		*mp++ = 'w';
+	*mp++ = 'b';
+	fm[2] = 0;
+
+	m_file = p;
+    m_handle = fbtFile::UTF8_fopen(m_file.c_str(), fm);
+
+	if (m_handle && (mode & fbtStream::SM_READ))
+	{
+		FILE *fp = (FILE*)m_handle;
+
+		fbtFseek(fp, 0, SEEK_END);
+		m_size = (FBTsize)fbtFtell(fp);
+		fbtFseek(fp, 0, SEEK_SET);
+	}
+
+
+}
+
+
+void fbtFileStream::open(FILE* fp, fbtStream::StreamMode mode)
+{
+	close();
+
+	m_handle = fp;
+
+	if (m_handle && (mode & fbtStream::SM_READ))
+	{
+		fbtFseek(fp, 0, SEEK_END);
+		m_size = (FBTsize)fbtFtell(fp);
+		fbtFseek(fp, 0, SEEK_SET);
+	}
+}
+
+
+void fbtFileStream::close(void)
+{
+	if (m_handle != 0)
+	{
+		fclose((FILE*)m_handle);
+		m_handle = 0;
+	}
+
+	m_file.clear();
+}
+
+
+bool fbtFileStream::eof(void) const
+{
+	if (!m_handle)
+		return true;
+	return feof((FILE*)m_handle) != 0;
+}
+
+FBTsize fbtFileStream::position(void) const
+{
+	return (FBTsize)fbtFtell((FILE*)m_handle);
+}
+
+
+FBTsize fbtFileStream::size(void) const
+{
+	return m_size;
+}
+
+FBTsize fbtFileStream::seek(FBTint64 off, FBTint32 way)
+{
+	if (!m_handle)
+		return 0;
+
+	fbtFseek((FILE*)m_handle, off, way);
+	return position();
+}
+
+
+FBTsize fbtFileStream::read(void* dest, FBTsize nr) const
+{
+	if (m_mode == fbtStream::SM_WRITE) 
+		return -1;
+
+	if (!dest || !m_handle) 
+		return -1;
+
+	return fread(dest, 1, nr, (FILE *)m_handle);
+}
+
+
+
+FBTsize fbtFileStream::write(const void* src, FBTsize nr)
+{
+	if (m_mode == fbtStream::SM_READ) return -1;
+	if (!src || !m_handle) return -1;
+
+	return fwrite(src, 1, nr, (FILE*)m_handle);
+}
+
+void fbtFileStream::write(fbtMemoryStream &ms) const
+{
+	FILE *fp = (FILE*)m_handle;
+
+	const FBTint64 oldPos = fbtFtell(fp);
+
+	fbtFseek(fp, 0, SEEK_END);
+	const FBTsize len = (FBTsize)fbtFtell(fp);
+	fbtFseek(fp, 0, SEEK_SET);
+
+	ms.reserve(len + 1);
+	ms.m_size = read(ms.m_buffer, len);
+
+	fbtFseek(fp, oldPos, SEEK_SET);
+}
+
+
+FBTsize fbtFileStream::writef(const char* fmt, ...)
+{
+	static char tmp[1024];
+
+	va_list lst;
+	va_start(lst, fmt);
+	int size = fbtp_printf(tmp, 1024, fmt, lst);
+	va_end(lst);
+
+	if (size > 0)
+	{
+		tmp[size] = 0;
+		return write(tmp, size);
+	}
+	return -1;
+
+}
+
+
+#if FBT_USE_MMAP_FILE == 1
+
+fbtMappedFileStream::fbtMappedFileStream()
+	:    m_buffer(0), m_pos(0), m_size(0)
+{
+}
+
+
+fbtMappedFileStream::~fbtMappedFileStream()
+{
+	close();
+}
+
+
+void fbtMappedFileStream::open(const char* path, fbtStream::StreamMode mode)
+{
+	close();
+
+	if (!path || !(mode & fbtStream::SM_READ))
+		return;
+
+#if FBT_PLATFORM == FBT_PLATFORM_WIN32
+	const int pathLen = (int)strlen(path);
+	wchar_t wpath[MAX_PATH+1] = L"";
+	const int wpathLen = pathLen > 0 ? MultiByteToWideChar(CP_UTF8, 0, path, pathLen, wpath, MAX_PATH) : 0;
+	if (wpathLen <= 0 || wpathLen > MAX_PATH)
+		return;
+	wpath[wpathLen] = L'\0';
+
+	HANDLE file = CreateFileW(wpath, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (file == INVALID_HANDLE_VALUE)
+		return;
+
+	LARGE_INTEGER fileSize;
+	if (GetFileSizeEx(file, &fileSize) && fileSize.QuadPart > 0 && (FBTuint64)fileSize.QuadPart == (FBTuint64)(FBTsize)fileSize.QuadPart)
+	{
+		HANDLE mapping = CreateFileMappingW(file, NULL, PAGE_WRITECOPY, 0, 0, NULL);
+		if (mapping)
+		{
+			m_buffer = (char*)MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0);
+			if (m_buffer)
+				m_size = (FBTsize)fileSize.QuadPart;
+			CloseHandle(mapping);   // the view keeps it alive
+		}
+	}
+	CloseHandle(file);
+#else
+	int fd = ::open(path, O_RDONLY);
+	if (fd < 0)
+		return;
+
+	struct stat st;
+	if (fstat(fd, &st) == 0 && st.st_size > 0 && (FBTuint64)st.st_size == (FBTuint64)(FBTsize)st.st_size)
+	{
+		// private: pages are copied only if somebody writes to them
+		void* addr = mmap(0, (size_t)st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+		if (addr != MAP_FAILED)
+		{
+			m_buffer = (char*)addr;
+			m_size   = (FBTsize)st.st_size;
+		}
+	}
+	::close(fd);    // the mapping keeps it alive
+#endif
+}
+
+
+void fbtMappedFileStream::close(void)
+{
+	if (m_buffer)
+	{
+#if FBT_PLATFORM == FBT_PLATFORM_WIN32
+		UnmapViewOfFile(m_buffer);
+#else
+		munmap(m_buffer, m_size);
+#endif
+	}
+	m_buffer = 0;
+	m_pos = m_size = 0;
+}
+
+
+FBTsize fbtMappedFileStream::read(void* dest, FBTsize nr) const
+{
+	if (m_pos > m_size) return 0;
+	if (!dest || !m_buffer) return 0;
+
+	if ((m_size - m_pos) < nr) nr = m_size - m_pos;
+
+	fbtMemcpy(dest, &m_buffer[m_pos], nr);
+	m_pos += nr;
+	return nr;
+}
+
+
+FBTsize fbtMappedFileStream::seek(FBTint64 off, FBTint32 way)
+{
+	if (way == SEEK_SET)
+		m_pos = (FBTsize)fbtClamp<FBTint64>(off, 0, (FBTint64)m_size);
+	else if (way == SEEK_CUR)
+		m_pos = (FBTsize)fbtClamp<FBTint64>((FBTint64)m_pos + off, 0, (FBTint64)m_size);
+	else if (way == SEEK_END)
+		m_pos = m_size;
+	return m_pos;
+}
+
+
+void* fbtMappedFileStream::readInPlace(FBTsize nr) const
+{
+	if (!m_buffer || nr == 0 || m_pos > m_size || (m_size - m_pos) < nr)
+		return 0;
+
+	char* cp = &m_buffer[m_pos];
+	if (((FBTuintPtr)cp) % FBT_IN_PLACE_ALIGNMENT)
+		return 0;
+
+	m_pos += nr;
+	return cp;
+}
+
+#endif // FBT_USE_MMAP_FILE
+
+
+#if FBT_USE_GZ_FILE == 1
+
+fbtGzStream::fbtGzStream() 
+	:    m_file(), m_handle(0), m_mode(0), m_pos(0)
+{
+}
+
+
+fbtGzStream::~fbtGzStream()
+{
+	close();
+}
+
+
+void fbtGzStream::open(const char* p, fbtStream::StreamMode mode)
+{
+	if (m_handle != 0 && m_file != p)
+        gzclose((gzFile) m_handle);
+
+	char fm[3] = {0, 0, 0};
+	char* mp = &fm[0];
+	if (mode & fbtStream::SM_READ)
+		*mp++ = 'r';
+	else if (mode & fbtStream::SM_WRITE)
+		*mp++ = 'w';
+	*mp++ = 'b';
+	fm[2] = 0;
+
+	m_file = p;
+	m_handle = gzopen(m_file.c_str(), fm);
+	m_pos = 0;
+}
+
+
+void fbtGzStream::open(FILE* fp, fbtStream::StreamMode mode)
+{
+	close();
+
+	if (!fp || !(mode & fbtStream::SM_READ))
+	{
+		if (fp)
+			fclose(fp);
+		return;
+	}
+
+	// zlib wants a descriptor: it gets its own one, rewound after fclose() synced the shared offset
+	int fd = dup(fileno(fp));
+	fclose(fp);
+	if (fd < 0)
+		return;
+
+	lseek(fd, 0, SEEK_SET);
+	m_handle = gzdopen(fd, "rb");
+	m_pos = 0;
+	if (!m_handle)
+		::close(fd);
+}
+
+
+void fbtGzStream::close(void)
+{
+	if (m_handle != 0)
+	{
+        gzclose((gzFile)m_handle);
+		m_handle = 0;
+	}
+
+	m_file.clear();
+	m_pos = 0;
+}
+
+
+
+FBTsize fbtGzStream::read(void* dest, FBTsize nr) const
+{
+	if (m_mode == fbtStream::SM_WRITE) return -1;
+	if (!dest || !m_handle) 
+		return -1;
+
+	// gzread() takes an unsigned and returns an int: big reads are split
+	char*   cp   = (char*)dest;
+	FBTsize done = 0;
+	while (done < nr)
+	{
+		const unsigned len = (unsigned)fbtMin<FBTsize>(nr - done, 1 << 30);
+		const int ret = gzread((gzFile)m_handle, cp + done, len);
+		if (ret < 0)
+			return done > 0 ? done : (FBTsize)-1;
+		done += ret;
+		if ((unsigned)ret < len)
+			break;
+	}
+	m_pos += done;
+	return done;
+}
+
+
+FBTsize fbtGzStream::write(const void* src, FBTsize nr)
+{
+	if (m_mode == fbtStream::SM_READ) return -1;
+	if (!src || !m_handle) return -1;
+
+	const char* cp   = (const char*)src;
+	FBTsize     done = 0;
+	while (done < nr)
+	{
+		const unsigned len = (unsigned)fbtMin<FBTsize>(nr - done, 1 << 30);
+		const int ret = gzwrite((gzFile)m_handle, (/*const*/ voidp)(cp + done), len);
+		if (ret <= 0)
+			break;
+		done += ret;
+	}
+	m_pos += done;
+	return done;
+}
+
+
+bool fbtGzStream::eof(void) const
+{
+	if (!m_handle)
+		return true;
+    return gzeof((gzFile)m_handle) != 0;
+}
+
+FBTsize fbtGzStream::position(void) const
+{
+	return m_pos;
+}
+
+FBTsize fbtGzStream::size(void) const
+{
+	return 0;
+}
+
+
+FBTsize fbtGzStream::writef(const char* fmt, ...)
+{
+	static char tmp[1024];
+
+	va_list lst;
+	va_start(lst, fmt);
+	int size = fbtp_printf(tmp, 1024, fmt, lst);
+	va_end(lst);
+
+	if (size > 0)
+	{
+		tmp[size] = 0;
+		return write(tmp, size);
+	}
+	return -1;
+
+}
+
+#endif // FBT_USE_GZ_FILE
+
+
+#if FBT_USE_ZSTD_FILE == 1
+
+fbtZstdStream::fbtZstdStream()
+	:    m_handle(0), m_dctx(0), m_inBuf(0), m_inCapacity(0), m_inSize(0), m_inPos(0),
+	     m_pos(0), m_lastRet(0), m_inEof(false), m_eof(false)
+{
 }
 
-int fbtChunk::write(fbtFile::Chunk* src, fbtStream* stream)
-{	
-	int size = 0;
-	size += stream->write(src, BlockSize);
-	size += stream->write((void*)src->m_old, src->m_len);
-	return size;
+
+fbtZstdStream::~fbtZstdStream()
+{
+	close();
 }
 
-int fbtChunk::read(fbtFile::Chunk* dest, fbtStream* stream, int flags)
+
+void fbtZstdStream::open(const char* path, fbtStream::StreamMode mode)
 {
-	int bytesRead = 0;
-    bool bitsVary   = (flags & fbtFile::FH_VAR_BITS) != 0;
-	bool swapEndian = (flags & fbtFile::FH_ENDIAN_SWAP) != 0;
+	open((mode & fbtStream::SM_READ) ? fbtFile::UTF8_fopen(path, "rb") : (FILE*)0, mode);
+}
 
-	fbtFile::Chunk64 c64;
-	fbtFile::Chunk32 c32;
-	fbtFile::Chunk*  cpy;
 
+void fbtZstdStream::open(FILE* fp, fbtStream::StreamMode mode)
+{
+	close();
 
-	if (FBT_VOID8)
+	if (!fp || !(mode & fbtStream::SM_READ))
 	{
-        // here we must add support for Blender 5.0+ where most lengths are 64 bit and the Chunk64 field order is different than before
-        if (bitsVary)
-		{
-            FBT_ASSERT(BLENDER_VERSION<500); // old format only (TOTEST: ican this happen?)
-			fbtFile::Chunk32 src;
-			if ((bytesRead = stream->read(&src, Block32)) <= 0)
-			{
-				FBT_INVALID_READ;
-				return fbtFile::FS_INV_READ;
-			}
-
-			c64.m_code    = src.m_code;
-			c64.m_len     = src.m_len;
+		if (fp)
+			fclose(fp);
+		return;
+	}
 
-			union
-			{
-				FBTuint64   m_ptr;
-				FBTuint32   m_doublePtr[2];
-			} ptr;
-			ptr.m_doublePtr[0] = src.m_old;
-			ptr.m_doublePtr[1] = 0;
+	fbtFseek(fp, 0, SEEK_SET);
 
-			c64.m_old     = ptr.m_ptr;
-			c64.m_typeid  = src.m_typeid;
-			c64.m_nr      = src.m_nr;
-		}
-		else
-		{
-			if ((bytesRead = stream->read(&c64, BlockSize)) <= 0)
-			{
-				FBT_INVALID_READ;
-				return fbtFile::FS_INV_READ;
-			}
-		}
+	m_dctx       = ZSTD_createDCtx();
+	m_inCapacity = ZSTD_DStreamInSize();
+	m_inBuf      = new char[m_inCapacity];
 
-		if (swapEndian)
-		{
-			if ((c64.m_code & 0xFFFF) == 0)
-				c64.m_code >>= 16;
+	if (!m_dctx)
+	{
+		fclose(fp);
+		close();
+		return;
+	}
+	m_handle = fp;
+}
 
-#           if BLENDER_VERSION<500
-			c64.m_len    = fbtSwap32(c64.m_len);
-			c64.m_nr     = fbtSwap32(c64.m_nr);
-			c64.m_typeid = fbtSwap32(c64.m_typeid);
-#           else
-            c64.m_typeid = fbtSwap32(c64.m_typeid);
-            c64.m_len    = fbtSwap64(c64.m_len);
-            c64.m_nr     = fbtSwap64(c64.m_nr);
-#           endif
-		}
 
-        cpy = (fbtFile::Chunk*)(&c64);
+void fbtZstdStream::close(void)
+{
+	if (m_handle != 0)
+	{
+		fclose((FILE*)m_handle);
+		m_handle = 0;
 	}
-	else
+	if (m_dctx)
 	{
-        FBT_ASSERT(BLENDER_VERSION<500); // old format only
-		if (bitsVary)
-		{
-			fbtFile::Chunk64 src;
-			if ((bytesRead = stream->read(&src, Block64)) <= 0)
-			{
-				FBT_INVALID_READ;
-				return fbtFile::FS_INV_READ;
-			}
+		ZSTD_freeDCtx((ZSTD_DCtx*)m_dctx);
+		m_dctx = 0;
+	}
+	if (m_inBuf)
+	{
+		delete [] m_inBuf;
+		m_inBuf = 0;
+	}
+	m_inCapacity = m_inSize = m_inPos = 0;
+	m_pos = m_lastRet = 0;
+	m_inEof = m_eof = false;
+}
 
-			// copy down
 
-			c32.m_code    = src.m_code;
-			c32.m_len     = src.m_len;
+FBTsize fbtZstdStream::read(void* dest, FBTsize nr) const
+{
+	if (!dest || !m_handle)
+		return -1;
 
-			union
-			{
-				FBTuint64   m_ptr;
-				FBTuint32   m_doublePtr[2];
-			} ptr;
-			ptr.m_doublePtr[0] = 0;
-			ptr.m_doublePtr[1] = 0;
-			ptr.m_ptr = src.m_old;
+	ZSTD_outBuffer output = {dest, nr, 0};
+	ZSTD_inBuffer  input  = {m_inBuf, m_inSize, m_inPos};
 
-			c32.m_old       = ptr.m_doublePtr[0] != 0 ? ptr.m_doublePtr[0] : ptr.m_doublePtr[1];
-			c32.m_typeid    = src.m_typeid;
-			c32.m_nr        = src.m_nr;
-		}
-		else
+	while (output.pos < output.size)
+	{
+		if (input.pos >= input.size && !m_inEof)
 		{
-			if ((bytesRead = stream->read(&c32, BlockSize)) <= 0)
-			{
-				FBT_INVALID_READ;
-				return fbtFile::FS_INV_READ;
-			}
+			input.size = fread(m_inBuf, 1, m_inCapacity, (FILE*)m_handle);
+			input.pos  = 0;
+			m_inEof    = input.size == 0;
 		}
 
-
-		if (swapEndian)
+		const size_t lastOut = output.pos;
+		const size_t ret = ZSTD_decompressStream((ZSTD_DCtx*)m_dctx, &output, &input);
+		if (ZSTD_isError(ret))
 		{
-			if ((c32.m_code & 0xFFFF) == 0)
-				c32.m_code >>= 16;
-
-			c32.m_len    = fbtSwap32(c32.m_len);
-			c32.m_nr     = fbtSwap32(c32.m_nr);
-			c32.m_typeid = fbtSwap32(c32.m_typeid);
+			fbtPrintf("ZSTD_decompressStream(...) Error: %s\n", ZSTD_getErrorName(ret));
+			m_inEof = true;
+			m_lastRet = 0;
+			break;
 		}
+		m_lastRet = ret;
 
-
-
-		cpy = (fbtFile::Chunk*)(&c32);
+		// no more input and nothing left to flush
+		if (m_inEof && input.pos >= input.size && output.pos == lastOut)
+			break;
 	}
 
-	if (cpy->m_len == FBT_NPOS)
+	m_inSize = input.size;
+	m_inPos  = input.pos;
+
+	if (output.pos < output.size)
 	{
-		FBT_INVALID_LEN;
-		return fbtFile::FS_INV_LENGTH;
+		if (m_lastRet != 0 && !m_eof)
+			fbtPrintf("ZSTD_decompressStream(...) Error: EOF before end of stream: %zu\n", (size_t)m_lastRet);
+		m_eof = true;
 	}
 
-	fbtMemcpy(dest, cpy, BlockSize);
-	return bytesRead;
+	m_pos += output.pos;
+	return output.pos;
 }
 
 
-// Source File "fbtStreams.cpp"
-//#define FBT_IN_SOURCE
-//#include "fbtStreams.h"
-//#include "fbtPlatformHeaders.h"
-
-
-#if FBT_USE_GZ_FILE == 1
-#include "zlib.h"
-#include "zconf.h"
-#endif
+static FBTuint32 fbtReadLE32(const unsigned char* cp)
+{
+	return (FBTuint32)cp[0] | ((FBTuint32)cp[1] << 8) | ((FBTuint32)cp[2] << 16) | ((FBTuint32)cp[3] << 24);
+}
 
-#if FBT_USE_ZSTD_FILE == 1
-#include "zstd.h"
-#endif
 
-fbtFileStream::fbtFileStream() 
-	:    m_file(), m_handle(0), m_mode(0), m_size(0)
+fbtZstdSeekableStream::fbtZstdSeekableStream()
+	:    m_handle(0), m_dctx(0), m_size(0), m_pos(0), m_inBuf(0), m_frameBuf(0),
+	     m_inCapacity(0), m_frameCapacity(0), m_frame(FBT_NPOS)
 {
 }
 
 
-fbtFileStream::~fbtFileStream()
+fbtZstdSeekableStream::~fbtZstdSeekableStream()
 {
 	close();
 }
 
 
+void fbtZstdSeekableStream::open(const char* path, fbtStream::StreamMode mode)
+{
+	FILE* fp = (mode & fbtStream::SM_READ) ? fbtFile::UTF8_fopen(path, "rb") : (FILE*)0;
+	if (fp)
+	{
+		open(fp, mode);
+		if (!isOpen())
+			fclose(fp);
+	}
+}
+
 
-void fbtFileStream::open(const char* p, fbtStream::StreamMode mode)
+void fbtZstdSeekableStream::open(FILE* fp, fbtStream::StreamMode mode)
 {
-	if (m_handle != 0 && m_file != p)
-		fclose((FILE *)m_handle);
+	close();
 
-	char fm[3] = {0, 0, 0};
-	char* mp = &fm[0];
-	if (mode & fbtStream::SM_READ)
-		*mp++ = 'r';
-	else if (mode & fbtStream::SM_WRITE)
-		*mp++ = 'w';
-	*mp++ = 'b';
-	fm[2] = 0;
+	if (!fp || !(mode & fbtStream::SM_READ))
+		return;
 
-	m_file = p;
-    m_handle = fbtFile::UTF8_fopen(m_file.c_str(), fm);
+	m_handle = fp;
+	m_dctx   = ZSTD_createDCtx();
 
-	if (m_handle && (mode & fbtStream::SM_READ))
+	if (!m_dctx || !readSeekTable())
 	{
-		FILE *fp = (FILE*)m_handle;
-
-		position();
-		fseek(fp, 0, SEEK_END);
-		m_size = ftell(fp);
-		fseek(fp, 0, SEEK_SET);
+		// the caller keeps the file
+		m_handle = 0;
+		close();
 	}
-
-
 }
 
 
-void fbtFileStream::close(void)
+void fbtZstdSeekableStream::close(void)
 {
 	if (m_handle != 0)
 	{
 		fclose((FILE*)m_handle);
 		m_handle = 0;
 	}
-
-	m_file.clear();
+	if (m_dctx)
+	{
+		ZSTD_freeDCtx((ZSTD_DCtx*)m_dctx);
+		m_dctx = 0;
+	}
+	if (m_inBuf)
+	{
+		delete [] m_inBuf;
+		m_inBuf = 0;
+	}
+	if (m_frameBuf)
+	{
+		delete [] m_frameBuf;
+		m_frameBuf = 0;
+	}
+	m_srcOffsets.clear();
+	m_dstOffsets.clear();
+	m_inCapacity = m_frameCapacity = 0;
+	m_size = m_pos = 0;
+	m_frame = FBT_NPOS;
 }
 
 
-bool fbtFileStream::eof(void) const
+bool fbtZstdSeekableStream::readSeekTable(void)
 {
-	if (!m_handle)
-		return true;
-	return feof((FILE*)m_handle) != 0;
-}
+	// The seek table is a skippable frame (magic 0x184D2A5E) at the end of the file: one entry per frame
+	// (compressed size, decompressed size, optional checksum) followed by a footer made of
+	// Number_Of_Frames (4 bytes), Seek_Table_Descriptor (1 byte) and the magic number 0x8F92EAB1.
+	FILE* fp = (FILE*)m_handle;
+	unsigned char footer[9];
 
-FBTsize fbtFileStream::position(void) const
-{
-	return ftell((FILE*)m_handle);
-}
+	if (fbtFseek(fp, 0, SEEK_END) != 0)
+		return false;
+	const FBTint64 fileSize = fbtFtell(fp);
+	if (fileSize < 17 || (FBTint64)(FBTsize)fileSize != fileSize ||
+	    fbtFseek(fp, fileSize - 9, SEEK_SET) != 0 || fread(footer, 1, 9, fp) != 9)
+		return false;
+	if (fbtReadLE32(footer + 5) != 0x8F92EAB1 || (footer[4] & 0x7C) != 0)
+		return false;
 
+	const FBTsize numFrames = fbtReadLE32(footer);
+	const FBTsize entrySize = (footer[4] & 0x80) ? 12 : 8;
+	if (numFrames == 0 || numFrames >= FBT_NPOS || numFrames > (FBTsize)fileSize / entrySize)
+		return false;
 
-FBTsize fbtFileStream::size(void) const
-{
-	return m_size;
+	const FBTsize frameSize = numFrames * entrySize + 9;
+	if ((FBTsize)fileSize < frameSize + 8)
+		return false;
+	const FBTsize tableStart = (FBTsize)fileSize - frameSize - 8;
+
+	unsigned char* table = new unsigned char[frameSize + 8];
+	bool ok = fbtFseek(fp, (FBTint64)tableStart, SEEK_SET) == 0 && fread(table, 1, frameSize + 8, fp) == frameSize + 8 &&
+	          fbtReadLE32(table) == 0x184D2A5E && fbtReadLE32(table + 4) == frameSize;
+
+	if (ok)
+	{
+		m_srcOffsets.reserve((FBTsizeType)numFrames + 1);
+		m_dstOffsets.reserve((FBTsizeType)numFrames + 1);
+
+		FBTuint64 src = 0, dst = 0;
+		const unsigned char* entry = table + 8;
+		for (FBTsize i = 0; i < numFrames; ++i, entry += entrySize)
+		{
+			m_srcOffsets.push_back((FBTsize)src);
+			m_dstOffsets.push_back((FBTsize)dst);
+			src += fbtReadLE32(entry);
+			dst += fbtReadLE32(entry + 4);
+		}
+		m_srcOffsets.push_back((FBTsize)src);
+		m_dstOffsets.push_back((FBTsize)dst);
+
+		// the frames must fill the file up to the seek table
+		ok = src == tableStart && dst == (FBTsize)dst;
+		m_size = (FBTsize)dst;
+	}
+	delete [] table;
+
+	if (!ok)
+	{
+		m_srcOffsets.clear();
+		m_dstOffsets.clear();
+		m_size = 0;
+	}
+	return ok;
 }
 
-FBTsize fbtFileStream::seek(FBTint32 off, FBTint32 way)
+
+bool fbtZstdSeekableStream::loadFrame(FBTsizeType frame) const
 {
-	if (!m_handle)
-		return 0;
+	const FBTsize srcSize = m_srcOffsets[frame + 1] - m_srcOffsets[frame];
+	const FBTsize dstSize = m_dstOffsets[frame + 1] - m_dstOffsets[frame];
+
+	m_frame = FBT_NPOS;
+
+	if (m_inCapacity < srcSize)
+	{
+		delete [] m_inBuf;
+		m_inBuf      = new char[srcSize];
+		m_inCapacity = srcSize;
+	}
+	if (m_frameCapacity < dstSize)
+	{
+		delete [] m_frameBuf;
+		m_frameBuf      = new char[dstSize];
+		m_frameCapacity = dstSize;
+	}
+
+	FILE* fp = (FILE*)m_handle;
+	if (fbtFseek(fp, (FBTint64)m_srcOffsets[frame], SEEK_SET) != 0 || fread(m_inBuf, 1, srcSize, fp) != srcSize)
+	{
+		FBT_INVALID_READ;
+		return false;
+	}
+
+	const size_t ret = ZSTD_decompressDCtx((ZSTD_DCtx*)m_dctx, m_frameBuf, dstSize, m_inBuf, srcSize);
+	if (ZSTD_isError(ret) || ret != dstSize)
+	{
+		fbtPrintf("ZSTD_decompressDCtx(...) Error: %s\n", ZSTD_isError(ret) ? ZSTD_getErrorName(ret) : "frame size mismatch");
+		return false;
+	}
 
-	return fseek((FILE*)m_handle, off, way);
+	m_frame = frame;
+	return true;
 }
 
 
-FBTsize fbtFileStream::read(void* dest, FBTsize nr) const
+FBTsize fbtZstdSeekableStream::read(void* dest, FBTsize nr) const
 {
-	if (m_mode == fbtStream::SM_WRITE) 
+	if (!dest || !m_handle)
 		return -1;
 
-	if (!dest || !m_handle) 
-		return -1;
+	char*   cp   = (char*)dest;
+	FBTsize done = 0;
 
-	return fread(dest, 1, nr, (FILE *)m_handle);
-}
+	while (done < nr && m_pos < m_size)
+	{
+		FBTsizeType frame = m_frame;
+		if (frame == FBT_NPOS || m_pos < m_dstOffsets[frame] || m_pos >= m_dstOffsets[frame + 1])
+		{
+			// the last frame starting at or before m_pos (empty frames are skipped this way)
+			FBTsizeType lo = 0, hi = m_dstOffsets.size() - 1;
+			while (hi - lo > 1)
+			{
+				const FBTsizeType mid = lo + (hi - lo) / 2;
+				if (m_dstOffsets[mid] <= m_pos)
+					lo = mid;
+				else
+					hi = mid;
+			}
+			frame = lo;
+
+			if (!loadFrame(frame))
+				break;
+		}
 
+		const FBTsize len = fbtMin<FBTsize>(nr - done, m_dstOffsets[frame + 1] - m_pos);
+		fbtMemcpy(cp + done, m_frameBuf + (m_pos - m_dstOffsets[frame]), len);
+		done  += len;
+		m_pos += len;
+	}
+	return done;
+}
 
 
-FBTsize fbtFileStream::write(const void* src, FBTsize nr)
+FBTsize fbtZstdSeekableStream::seek(FBTint64 off, FBTint32 way)
 {
-	if (m_mode == fbtStream::SM_READ) return -1;
-	if (!src || !m_handle) return -1;
-
-	return fwrite(src, 1, nr, (FILE*)m_handle);
+	if (way == SEEK_SET)
+		m_pos = (FBTsize)fbtClamp<FBTint64>(off, 0, (FBTint64)m_size);
+	else if (way == SEEK_CUR)
+		m_pos = (FBTsize)fbtClamp<FBTint64>((FBTint64)m_pos + off, 0, (FBTint64)m_size);
+	else if (way == SEEK_END)
+		m_pos = m_size;
+	return m_pos;
 }
 
-void fbtFileStream::write(fbtMemoryStream &ms) const
-{
-	FILE *fp = (FILE*)m_handle;
+#endif // FBT_USE_ZSTD_FILE
 
-	int oldPos = ftell(fp);
 
-	fseek(fp, 0, SEEK_END);
-	int len = ftell(fp);
-	fseek(fp, 0, SEEK_SET);
+#if FBT_USE_THREADS == 1
 
-	ms.reserve(len + 1);
-	ms.m_size = read(ms.m_buffer, len);
+struct fbtReadAheadState
+{
+	fbtReadAheadState(int numBuffers)
+		:    m_source(0), m_buffers(0), m_sizes(0), m_bufferSize(0), m_numBuffers(numBuffers),
+		     m_free(numBuffers), m_filled(0), m_stop(false), m_slot(-1), m_offset(0), m_end(false)
+	{
+	}
 
-	fseek(fp, oldPos, SEEK_SET);
-}
+	bool stopping(void)
+	{
+		m_mutex.lock();
+		const bool stop = m_stop;
+		m_mutex.unlock();
+		return stop;
+	}
 
+	static void produce(void* arg);
+
+	fbtStream*      m_source;
+	char*           m_buffers;
+	FBTsize*        m_sizes;        // bytes in each buffer: a short one is the last
+	FBTsize         m_bufferSize;
+	int             m_numBuffers;
+	fbtSemaphore    m_free, m_filled;
+	fbtMutex        m_mutex;        // guards m_stop
+	bool            m_stop;
+	fbtThread       m_thread;
+
+	// consumer side
+	int             m_slot;         // buffer being read (-1 before the first one)
+	FBTsize         m_offset;
+	bool            m_end;
+};
 
-FBTsize fbtFileStream::writef(const char* fmt, ...)
-{
-	static char tmp[1024];
 
-	va_list lst;
-	va_start(lst, fmt);
-	int size = fbtp_printf(tmp, 1024, fmt, lst);
-	va_end(lst);
+void fbtReadAheadState::produce(void* arg)
+{
+	fbtReadAheadState* st = (fbtReadAheadState*)arg;
 
-	if (size > 0)
+	for (int slot = 0; ; slot = (slot + 1) % st->m_numBuffers)
 	{
-		tmp[size] = 0;
-		return write(tmp, size);
-	}
-	return -1;
+		st->m_free.wait();
+		if (st->stopping())
+			break;
 
-}
+		FBTsize nr = st->m_source->read(st->m_buffers + slot * st->m_bufferSize, st->m_bufferSize);
+		if (nr > st->m_bufferSize)  // (FBTsize)-1
+			nr = 0;
+		st->m_sizes[slot] = nr;
+		st->m_filled.post();
 
+		if (nr < st->m_bufferSize)
+			break;
+	}
+}
 
-#if FBT_USE_GZ_FILE == 1
 
-fbtGzStream::fbtGzStream() 
-	:    m_file(), m_handle(0), m_mode(0)
+fbtReadAheadStream::fbtReadAheadStream()
+	:    m_state(0), m_size(0), m_pos(0)
 {
 }
 
 
-fbtGzStream::~fbtGzStream()
+fbtReadAheadStream::~fbtReadAheadStream()
 {
 	close();
 }
 
 
-void fbtGzStream::open(const char* p, fbtStream::StreamMode mode)
+void fbtReadAheadStream::open(fbtStream* source, FBTsize readAheadSize, int numBuffers)
 {
-	if (m_handle != 0 && m_file != p)
-        gzclose((gzFile) m_handle);
+	close();
 
-	char fm[3] = {0, 0, 0};
-	char* mp = &fm[0];
-	if (mode & fbtStream::SM_READ)
-		*mp++ = 'r';
-	else if (mode & fbtStream::SM_WRITE)
-		*mp++ = 'w';
-	*mp++ = 'b';
-	fm[2] = 0;
+	if (!source || !source->isOpen())
+		return;
 
-	m_file = p;
-	m_handle = gzopen(m_file.c_str(), fm);
-}
+	numBuffers = fbtMax(numBuffers, 2);
 
+	fbtReadAheadState* st = new fbtReadAheadState(numBuffers);
+	st->m_source     = source;
+	st->m_bufferSize = fbtMax<FBTsize>(readAheadSize / numBuffers, 4096);
+	st->m_buffers    = new char[st->m_bufferSize * numBuffers];
+	st->m_sizes      = new FBTsize[numBuffers];
 
-void fbtGzStream::close(void)
-{
-	if (m_handle != 0)
+	m_size = source->size();    // before the worker starts using it
+	m_pos  = 0;
+
+	if (!st->m_thread.start(fbtReadAheadState::produce, st))
 	{
-        gzclose((gzFile)m_handle);
-		m_handle = 0;
+		// the caller keeps the source
+		delete [] st->m_buffers;
+		delete [] st->m_sizes;
+		delete st;
+		m_size = 0;
+		return;
 	}
-
-	m_file.clear();
+	m_state = st;
 }
 
 
-
-FBTsize fbtGzStream::read(void* dest, FBTsize nr) const
+void fbtReadAheadStream::close(void)
 {
-	if (m_mode == fbtStream::SM_WRITE) return -1;
-	if (!dest || !m_handle) 
-		return -1;
+	fbtReadAheadState* st = m_state;
+	if (st)
+	{
+		st->m_mutex.lock();
+		st->m_stop = true;
+		st->m_mutex.unlock();
+		st->m_free.post();      // in case the worker is waiting for a buffer
+		st->m_thread.join();
 
-    return gzread((gzFile)m_handle, dest, nr);
+		delete st->m_source;
+		delete [] st->m_buffers;
+		delete [] st->m_sizes;
+		delete st;
+		m_state = 0;
+	}
+	m_size = m_pos = 0;
 }
 
 
-FBTsize fbtGzStream::write(const void* src, FBTsize nr)
+bool fbtReadAheadStream::eof(void) const
 {
-	if (m_mode == fbtStream::SM_READ) return -1;
-	if (!src || !m_handle) return -1;
-    return gzwrite((gzFile)m_handle,(/*const*/ voidp) src, nr);
+	const fbtReadAheadState* st = m_state;
+	if (!st || st->m_end)
+		return true;
+	return st->m_slot >= 0 && st->m_sizes[st->m_slot] < st->m_bufferSize && st->m_offset >= st->m_sizes[st->m_slot];
 }
 
 
-bool fbtGzStream::eof(void) const
+FBTsize fbtReadAheadStream::read(void* dest, FBTsize nr) const
 {
-	if (!m_handle)
-		return true;
-    return gzeof((gzFile)m_handle) != 0;
-}
+	fbtReadAheadState* st = m_state;
+	if (!dest || !st)
+		return -1;
 
-FBTsize fbtGzStream::position(void) const
-{
-    return gztell((gzFile)m_handle);
-}
+	char*   cp   = (char*)dest;
+	FBTsize done = 0;
 
-FBTsize fbtGzStream::size(void) const
-{
-	return 0;
+	while (done < nr)
+	{
+		if (st->m_slot < 0 || st->m_offset >= st->m_sizes[st->m_slot])
+		{
+			if (st->m_end)
+				break;
+			if (st->m_slot >= 0)
+			{
+				if (st->m_sizes[st->m_slot] < st->m_bufferSize)
+				{
+					st->m_end = true;
+					break;
+				}
+				st->m_free.post();
+			}
+
+			st->m_filled.wait();
+			st->m_slot   = (st->m_slot + 1) % st->m_numBuffers;
+			st->m_offset = 0;
+			continue;
+		}
+
+		const FBTsize len = fbtMin<FBTsize>(nr - done, st->m_sizes[st->m_slot] - st->m_offset);
+		fbtMemcpy(cp + done, st->m_buffers + st->m_slot * st->m_bufferSize + st->m_offset, len);
+		st->m_offset += len;
+		done         += len;
+	}
+
+	m_pos += done;
+	return done;
 }
 
 
-FBTsize fbtGzStream::writef(const char* fmt, ...)
+FBTsize fbtReadAheadStream::seek(FBTint64 off, FBTint32 way)
 {
-	static char tmp[1024];
+	fbtReadAheadState* st = m_state;
+	if (!st)
+		return 0;
 
-	va_list lst;
-	va_start(lst, fmt);
-	int size = fbtp_printf(tmp, 1024, fmt, lst);
-	va_end(lst);
+	if (way == SEEK_SET)
+		off -= (FBTint64)m_pos;
+	else if (way != SEEK_CUR)
+		return m_pos;
 
-	if (size > 0)
+	if (off <= 0 && (FBTuint64)(-off) <= (FBTuint64)st->m_offset)
 	{
-		tmp[size] = 0;
-		return write(tmp, size);
+		st->m_offset -= (FBTsize)(-off);
+		m_pos        -= (FBTsize)(-off);
 	}
-	return -1;
-
+	return m_pos;
 }
 
-#endif // FBT_USE_GZ_FILE
+#endif // FBT_USE_THREADS
 
 
 fbtMemoryStream::fbtMemoryStream()
-	:   m_buffer(0), m_pos(0), m_size(0), m_capacity(0), m_mode(0)
+	:   m_buffer(0), m_pos(0), m_size(0), m_capacity(0), m_mode(0), m_borrowed(false)
 {
 }
 
@@ -4011,7 +7354,7 @@ void fbtMemoryStream::open(const fbtFileStream& fs, fbtStream::StreamMode mode)
 }
 
 
-void fbtMemoryStream::open(const void* buffer, FBTsize size, fbtStream::StreamMode mode, bool compressed)
+void fbtMemoryStream::open(const void* buffer, FBTsize size, fbtStream::StreamMode mode, bool compressed, bool borrow)
 {
 	if (buffer && size > 0 && size != FBT_NPOS)
 	{
@@ -4019,7 +7362,16 @@ void fbtMemoryStream::open(const void* buffer, FBTsize size, fbtStream::StreamMo
 		m_pos  = 0;
 
 
-		if (!compressed)
+		if (!compressed && borrow)
+		{
+			if (m_buffer && !m_borrowed)
+				delete [] m_buffer;
+
+			m_buffer   = (char*)buffer;
+			m_size     = m_capacity = size;
+			m_borrowed = true;
+
+		} else if (!compressed)
 		{
 			m_size = size;
 			reserve(m_size);
@@ -4027,22 +7379,15 @@ void fbtMemoryStream::open(const void* buffer, FBTsize size, fbtStream::StreamMo
 
 		} else
 		{
-		    bool result = false;
-#           if BLENDER_VERSION >= 300
-#               if FBT_USE_ZSTD_FILE == 1
-                if (!result) result = zstdInflate((char*)buffer,size);
-#               endif
-#               if FBT_USE_GZ_FILE == 1
-                if (!result) result = gzipInflate((char*)buffer,size);
-#               endif
-#           else //BLENDER_VERSION    		    
-#               if FBT_USE_GZ_FILE == 1
-                if (!result) result = gzipInflate((char*)buffer,size);
-#               endif
-#               if FBT_USE_ZSTD_FILE == 1
-                if (!result) result = zstdInflate((char*)buffer,size);
-#               endif
-#           endif //BLENDER_VERSION
+		    // no trial and error: the magic bytes tell the decoder
+		    const int compression = fbtFile::GetFileCompression(buffer,size,0);
+#           if FBT_USE_ZSTD_FILE == 1
+            if (compression==fbtFile::FC_ZSTD) zstdInflate((char*)buffer,size);
+#           endif
+#           if FBT_USE_GZ_FILE == 1
+            if (compression==fbtFile::FC_GZIP) gzipInflate((char*)buffer,size);
+#           endif
+            (void)compression;
 		}
 
 	}
@@ -4051,127 +7396,207 @@ void fbtMemoryStream::open(const void* buffer, FBTsize size, fbtStream::StreamMo
 #if FBT_USE_GZ_FILE == 1
 // this method was adapted from this snippet:
 // http://windrealm.org/tutorials/decompress-gzip-stream.php
-bool fbtMemoryStream::gzipInflate( char* inBuf, int inSize) {
+bool fbtMemoryStream::gzipInflate( char* inBuf, FBTsize inSize) {
   // 'inBuf' is the whole compressed stream, of compressed size 'inSize'
-  if (m_buffer)
+  if (m_buffer && !m_borrowed)
 	  delete [] m_buffer;
+  m_buffer = 0;
+  m_borrowed = false;
   m_size = m_capacity = 0;
+  if (inSize == 0) return false;
+
+  // The last 4 bytes of a gzip stream (ISIZE) are the uncompressed size modulo 2^32: for the single member
+  // files Blender writes it's exact, so the whole output is inflated into one allocation.
+  // A value beyond deflate's maximum ratio (~1032:1) can't be genuine and is ignored.
+  FBTsize hint = 0;
+  if (inSize >= 18)
+  {
+    const unsigned char* isize = (const unsigned char*) inBuf + inSize - 4;
+    hint = (FBTsize) isize[0] | ((FBTsize) isize[1] << 8) | ((FBTsize) isize[2] << 16) | ((FBTsize) isize[3] << 24);
+    if (hint / 1032 > inSize) hint = 0;
+  }
+  reserve(hint > 0 ? hint : inSize * 4);
 
-  reserve(m_capacity+inSize);
+  // zlib counts in (32 bit) uInt/uLong: the buffers are handed out in slices, and positions are tracked here
+  const FBTsize maxSlice = 1 << 30;
+  FBTsize inPos = 0, outPos = 0;
 
   z_stream strm;
   strm.next_in = (Bytef *) inBuf;
-  strm.avail_in = inSize ;
+  strm.avail_in = 0;
   strm.total_out = 0;
   strm.zalloc = Z_NULL;
   strm.zfree = Z_NULL;
+  strm.opaque = Z_NULL;
 
   bool done = false;
 
   if (inflateInit2(&strm, (16+MAX_WBITS)) != Z_OK) {
-    free( m_buffer );
+    delete [] m_buffer;
+    m_buffer = 0;
+    m_size = m_capacity = 0;
     return false;
   }
 
   while (!done) {
-    // If our output buffer is too small
-    if (strm.total_out >= m_capacity ) {
-      // Increase size of output buffer
-      reserve(m_capacity+(inSize/2));
+    // If our output buffer is too small (the hint was wrong or missing), grow it geometrically
+    if (outPos >= m_capacity ) {
+      m_size = outPos;  // so that reserve() keeps what has been inflated so far
+      reserve(m_capacity*2);
     }
 
-    strm.next_out = (Bytef *) (m_buffer + strm.total_out);
-    strm.avail_out = m_capacity - strm.total_out;
+    if (strm.avail_in == 0 && inPos < inSize) {
+      strm.next_in = (Bytef *) (inBuf + inPos);
+      strm.avail_in = (uInt) fbtMin<FBTsize>(inSize - inPos, maxSlice);
+      inPos += strm.avail_in;
+    }
+    strm.next_out = (Bytef *) (m_buffer + outPos);
+    strm.avail_out = (uInt) fbtMin<FBTsize>(m_capacity - outPos, maxSlice);
+    const uInt availOut = strm.avail_out;
 
     // Inflate another chunk.
     int err = inflate (&strm, Z_SYNC_FLUSH);
+    outPos += availOut - strm.avail_out;
     if (err == Z_STREAM_END) done = true;
     else if (err != Z_OK)  {
+      fbtPrintf("inflate(...) Error: %s\n", strm.msg ? strm.msg : "truncated or corrupted stream");
       break;
     }
   }
 
-  if (inflateEnd (&strm) != Z_OK) {
-    if (m_buffer)   delete [] m_buffer;
+  if (inflateEnd (&strm) != Z_OK) done = false;
+
+  if (!done) {
+    delete [] m_buffer;
+    m_buffer = 0;
     m_size = m_capacity = 0;
     return false;
   }
-  else {
-    m_size = strm.total_out;
-    shrinkToFit();
-    done = true;
-  }
 
-  return done;
+  m_size = outPos;
+  if (m_size != hint) shrinkToFit();  // an exact hint leaves nothing to trim
+  return true;
 }
 #endif
 
 #if FBT_USE_ZSTD_FILE == 1
-bool fbtMemoryStream::zstdInflate(char* inBuf, int inSize) {
+#if FBT_USE_THREADS == 1
+// Blender writes zstd files as a sequence of independent frames: when all of them store their content size,
+// each one has a known place in the output buffer and they're decompressed in parallel.
+struct fbtZstdFrame
+{
+    const unsigned char* m_src;
+    size_t               m_srcSize;
+    FBTsize              m_dstOffset;
+    FBTsize              m_dstSize;
+    size_t               m_result;
+};
+
+struct fbtZstdFrameJob
+{
+    fbtZstdFrame* m_frames;
+    char*         m_dst;
+    ZSTD_DCtx**   m_dctx;   // one per worker
+};
+
+static void fbtZstdDecompressFrame(void* userData, FBTsize index, int worker)
+{
+    fbtZstdFrameJob* job = (fbtZstdFrameJob*) userData;
+    fbtZstdFrame& frame = job->m_frames[index];
+    ZSTD_DCtx*& dctx = job->m_dctx[worker];
+    if (!dctx) dctx = ZSTD_createDCtx();
+    frame.m_result = dctx ? ZSTD_decompressDCtx(dctx, job->m_dst + frame.m_dstOffset, frame.m_dstSize, frame.m_src, frame.m_srcSize)
+                          : (size_t) -1;
+}
+#endif
+
+bool fbtMemoryStream::zstdInflate(char* inBuf, FBTsize inSize) {
     // 'inBuf' is the whole compressed stream, of compressed size 'inSize'  
-    if ( inSize == 0 ) {
-          m_buffer = inBuf;
-          return true;
-    }
-    if (m_buffer)	  delete [] m_buffer;
+    if (m_buffer && !m_borrowed)	  delete [] m_buffer;
+    m_buffer = 0;
+    m_borrowed = false;
     m_size = m_capacity = 0;
+    if (inSize == 0) return false;
     
     const unsigned char* memoryBuffer = (const unsigned char*) inBuf;
     const size_t memoryBufferSize = (size_t) inSize;
   
-    // FIll m_size, m_capacity and m_buffer from memoryBuffer and memoryBufferSize.
-  
+    // Frame headers normally store their content size (skippable frames count as 0): their sum is the exact
+    // output size, so the whole file is decompressed into one allocation. If a frame lacks it, or the total
+    // looks implausible (> 1024:1), the output buffer just grows geometrically instead.
+    unsigned long long hint = 0;
+#   if FBT_USE_THREADS == 1
+    fbtArray<fbtZstdFrame> frames;
+#   endif
+    for (size_t off = 0; off < memoryBufferSize; )  {
+        const size_t frameSize = ZSTD_findFrameCompressedSize(memoryBuffer+off, memoryBufferSize-off);
+        const unsigned long long contentSize = ZSTD_isError(frameSize) ? ZSTD_CONTENTSIZE_ERROR :
+                                               ZSTD_getFrameContentSize(memoryBuffer+off, memoryBufferSize-off);
+        if (contentSize == ZSTD_CONTENTSIZE_UNKNOWN || contentSize == ZSTD_CONTENTSIZE_ERROR) {hint = 0;break;}
+#       if FBT_USE_THREADS == 1
+        if (contentSize > 0)    {
+            fbtZstdFrame frame = {memoryBuffer+off, frameSize, (FBTsize) hint, (FBTsize) contentSize, 0};
+            frames.push_back(frame);
+        }
+#       endif
+        hint+=contentSize;
+        off+=frameSize;
+    }
+    if (hint / 1024 > (unsigned long long) memoryBufferSize || hint != (FBTsize) hint) hint = 0;
+    reserve(hint > 0 ? (FBTsize) hint : inSize * 4);   // initial capacity
+
+#   if FBT_USE_THREADS == 1
+    const int numThreads = hint > 0 ? (int) fbtMin<FBTsize>((FBTsize) fbtGetNumThreads(), frames.size()) : 1;
+    if (numThreads > 1)    {
+        ZSTD_DCtx** dctx = (ZSTD_DCtx**) fbtCalloc(numThreads, sizeof(ZSTD_DCtx*));
+        fbtZstdFrameJob job = {frames.ptr(), m_buffer, dctx};
+        if (dctx) fbtParallelFor(frames.size(), numThreads, fbtZstdDecompressFrame, &job);
+
+        bool failure = !dctx;
+        for (FBTsizeType i = 0; i < frames.size() && !failure; i++)  {
+            const size_t ret = frames[i].m_result;
+            if (ZSTD_isError(ret) || ret != frames[i].m_dstSize)  {
+                fbtPrintf("ZSTD_decompressDCtx(...) Error: %s\n", ZSTD_isError(ret) ? ZSTD_getErrorName(ret) : "frame content size mismatch");
+                failure = true;
+            }
+        }
+        for (int i = 0; dctx && i < numThreads; i++) ZSTD_freeDCtx(dctx[i]);
+        if (dctx) fbtFree(dctx);
+
+        if (failure) {
+            delete [] m_buffer;
+            m_buffer = 0;
+            m_size = m_capacity = 0;
+            return false;
+        }
+        m_size = (FBTsize) hint;
+        return true;
+    }
+#   endif
+
     ZSTD_DCtx* dctx = ZSTD_createDCtx();
-    const size_t capacityStepMultiplier = 4;   
-    
-    // input buffer
-    const size_t minInputSizeStep = ZSTD_DStreamInSize();
-    const size_t inputSizeStep = minInputSizeStep*capacityStepMultiplier;
-    ZSTD_inBuffer input = { memoryBuffer, 0, 0 };
-    input.size = inputSizeStep<=memoryBufferSize?inputSizeStep:memoryBufferSize;
-    
-    // output buffer
-    const size_t minOutputCapacityStep = ZSTD_DStreamOutSize();
-    const size_t outputCapacityStep = minOutputCapacityStep*capacityStepMultiplier;
-    reserve(memoryBufferSize*3);   // initial capacity
+    ZSTD_inBuffer input = { memoryBuffer, memoryBufferSize, 0 };
     ZSTD_outBuffer output = {m_buffer, m_capacity, 0 };
     
     size_t lastRet = 0;
     int failure = 0;
     
-    //size_t last_input_pos = 1;    // optional loop lock prevention [line 1/3]
-    //size_t num_reallocs = 0, num_decompression_calls = 0;   // optional debug [line 1/4]
-    while (input.pos < memoryBufferSize) {
-        //if (lastRet==0 && last_input_pos==input.pos) break;    // optional loop lock prevention [line 2/3]
-        if (input.size<memoryBufferSize && input.size-input.pos<minInputSizeStep)    {
-            input.size+=inputSizeStep;
-            if (input.size>memoryBufferSize) input.size=memoryBufferSize;
+    while (input.pos < input.size) {
+        if (output.pos == output.size)    {
+            m_size = output.pos;    // so that reserve() keeps what has been decompressed so far
+            reserve(m_capacity*2);  // grow strategy
+            output.dst=m_buffer;output.size=m_capacity; // output.pos unchanged
         }
         size_t const ret = ZSTD_decompressStream(dctx, &output , &input);
-        //++num_decompression_calls;   // optional debug [line 2/4]
         if (ZSTD_isError(ret))    {
             fbtPrintf("ZSTD_decompressStream(...) Error: %s\n",ZSTD_getErrorName(ret));
             failure = 1;break;
         }
-        else {
-            m_size=output.pos;
-            if (input.pos < input.size) {
-                if (output.size-output.pos<=outputCapacityStep)    {
-                    reserve(m_capacity+minOutputCapacityStep+m_capacity/4);     // grow strategy               
-                    //++num_reallocs;   // optional debug [line 3/4]
-                    output.dst=m_buffer;output.size=m_capacity; // output.pos unchanged           
-                }
-            }
-                
-            //fbtPrintf("output: %zu/%zu. input: %zu/%zu.\n",output.pos,output.size,input.pos,input.size);
-        }    
         lastRet = ret;
     }
-  
-    //fbtPrintf("num_reallocs: %zu. num_decompression_calls: %zu.\n",num_reallocs,num_decompression_calls);   // optional debug [line 4/4]
-        
+    m_size = output.pos;
 
-    if (lastRet != 0) {
+    if (!failure && lastRet != 0) {
         /* The last return value from ZSTD_decompressStream did not end on a
          * frame, but we reached the end of the file! We assume this is an
          * error, and the input was truncated.
@@ -4180,10 +7605,11 @@ bool fbtMemoryStream::zstdInflate(char* inBuf, int inSize) {
         failure = 1;
     }  
     if (failure) {
-      if (m_buffer) delete [] m_buffer;
+      delete [] m_buffer;
+      m_buffer = 0;
       m_size = m_capacity = 0;    
     }          
-    else shrinkToFit();
+    else if (m_size != hint) shrinkToFit();  // an exact hint leaves nothing to trim
     
     ZSTD_freeDCtx(dctx);dctx=NULL;  
     return !failure;
@@ -4193,7 +7619,7 @@ bool fbtMemoryStream::zstdInflate(char* inBuf, int inSize) {
 
 fbtMemoryStream::~fbtMemoryStream()
 {
-	if (m_buffer != 0 )
+	if (m_buffer != 0 && !m_borrowed)
 	{
 		delete []m_buffer;
 	}
@@ -4207,17 +7633,24 @@ fbtMemoryStream::~fbtMemoryStream()
 void fbtMemoryStream::clear(void)
 {
 	m_size = m_pos = 0;
-	if (m_buffer)
+	if (m_borrowed)
+	{
+		// just forget it
+		m_buffer   = 0;
+		m_capacity = 0;
+		m_borrowed = false;
+	}
+	else if (m_buffer)
 		m_buffer[0] = 0;
 }
 
 
-FBTsize fbtMemoryStream::seek(FBTint32 off, FBTint32 way)
+FBTsize fbtMemoryStream::seek(FBTint64 off, FBTint32 way)
 {
 	if (way == SEEK_SET)
-		m_pos = fbtClamp<FBTsize>(off, 0, m_size);
+		m_pos = (FBTsize)fbtClamp<FBTint64>(off, 0, (FBTint64)m_size);
 	else if (way == SEEK_CUR)
-		m_pos = fbtClamp<FBTsize>(m_pos + off, 0, m_size);
+		m_pos = (FBTsize)fbtClamp<FBTint64>((FBTint64)m_pos + off, 0, (FBTint64)m_size);
 	else if (way == SEEK_END)
 		m_pos = m_size;
 	return m_pos;
@@ -4241,6 +7674,21 @@ FBTsize fbtMemoryStream::read(void* dest, FBTsize nr) const
 }
 
 
+void* fbtMemoryStream::readInPlace(FBTsize nr) const
+{
+	if (m_mode == fbtStream::SM_WRITE) return 0;
+	if (!m_buffer || nr == 0 || m_pos > m_size || (m_size - m_pos) < nr)
+		return 0;
+
+	char* cp = &m_buffer[m_pos];
+	if (((FBTuintPtr)cp) % FBT_IN_PLACE_ALIGNMENT)
+		return 0;
+
+	m_pos += nr;
+	return cp;
+}
+
+
 
 FBTsize fbtMemoryStream::write(const void* src, FBTsize nr)
 {
@@ -4251,7 +7699,7 @@ FBTsize fbtMemoryStream::write(const void* src, FBTsize nr)
 
 	if (m_buffer == 0)
 		reserve(m_pos + (nr));
-	else if (m_pos + nr > m_capacity)
+	else if (m_pos + nr > m_capacity || m_borrowed)
 		reserve(m_pos + (nr > 65535 ? nr : nr + 65535));
 
 	char* cp = &m_buffer[m_pos];
@@ -4285,18 +7733,24 @@ FBTsize fbtMemoryStream::writef(const char* fmt, ...)
 }
 void fbtMemoryStream::reserve(FBTsize nr)
 {
-	if (m_capacity < nr)
+	if (m_capacity < nr || m_borrowed)
 	{
+		// a borrowed buffer is detached into a private copy (of all of it)
+		if (nr < m_size)
+			nr = m_size;
+
 		char* buf = new char[nr + 1];
 		if (m_buffer != 0)
 		{
 			fbtMemcpy(buf, m_buffer, m_size);
-			delete [] m_buffer;
+			if (!m_borrowed)
+				delete [] m_buffer;
 		}
 
 		m_buffer = buf;
 		m_buffer[m_size] = 0;
 		m_capacity = nr;
+		m_borrowed = false;
 	}
 }
 void fbtMemoryStream::shrinkToFit()
@@ -4385,7 +7839,7 @@ bool fbtBinTables::read(bool swap)
 }
 
 
-bool fbtBinTables::read(const void* ptr, const FBTsize& /*len*/, bool swap)
+bool fbtBinTables::read(const void* ptr, const FBTsize& len, bool swap, const FBTuint32* compiled, FBTsize compiledLen)
 {
 	FBTuint32* ip = 0, i, j, k, nl;
 	FBTtype* tp = 0;
@@ -4633,7 +8087,8 @@ bool fbtBinTables::read(const void* ptr, const FBTsize& /*len*/, bool swap)
 		return false;
 	}
 
-	compile();
+	if (!compiled || !load(compiled, compiledLen, len))
+		compile();
 	return true;
 }
 
@@ -4704,24 +8159,9 @@ void fbtBinTables::compile(void)
 	{
 		FBTtype* strc = m_strc[i];
 
-		FBTtype strcType = strc[0];
-
 		depth = 0;
 		cof = 0;
-		fbtStruct* off = new fbtStruct;
-		off->m_key.k16[0] = strcType;
-		off->m_key.k16[1] = 0;
-		off->m_val.k32[0] = m_type[strcType].m_typeId;
-		off->m_val.k32[1] = 0; // no name
-		off->m_nr         = 0;
-		off->m_dp         = 0;
-		off->m_off        = cof;
-		off->m_len        = m_tlen[strcType];
-		off->m_strcId     = i;
-		off->m_link       = 0;
-		off->m_flag       = fbtStruct::CAN_LINK;
-
-		m_offs.push_back(off);
+		fbtStruct* off = putStruct(i);
 
 		memberCount = strc[1];
 
@@ -4750,6 +8190,110 @@ void fbtBinTables::compile(void)
 	}
 }
 
+bool fbtBinTables::load(const FBTuint32* compiled, FBTsize compiledLen, FBTsize len)
+{
+	// compiled: DNA length, struct count, then for each struct its member count followed by its members:
+	// type | name << 16, nr | depth << 16 and, when bit 31 is set (it differs from the previous member one),
+	// the key chain (depth words of type | name << 16).
+	// Offsets, lengths and hashes are not saved: they come from the tables read() just filled (and m_ptr)
+	const FBTuint32* ip = compiled, *ep = compiled + compiledLen;
+	FBTuint32 i, e, d, memberCount, depth, cof;
+	FBTtype cp[2], nr;
+	bool chain, ok = compiledLen >= 2 && ip[0] == len && ip[1] == m_strcNr;
+
+	ip += 2;
+
+	fbtStruct::Keys keys;
+	m_offs.reserve(m_strcNr);
+
+	for (i = 0; ok && i < m_strcNr; i++)
+	{
+		fbtStruct* off = putStruct(i);
+
+		ok = ip < ep && *ip <= (FBTuint32)(ep - ip - 1) / 2;
+		memberCount = ok ? *ip++ : 0;
+		off->m_members.reserve(memberCount);
+		keys.resize(0);
+		cof = 0;
+
+		for (e = 0; ok && e < memberCount; ++e)
+		{
+			if (ep - ip < 2)
+			{
+				ok = false;
+				break;
+			}
+
+			cp[0] = (FBTtype)(ip[0] & 0xFFFF);
+			cp[1] = (FBTtype)(ip[0] >> 16);
+			nr    = (FBTtype)(ip[1] & 0xFFFF);
+			depth = (ip[1] >> 16) & 0x7FFF;
+			chain = (ip[1] & 0x80000000) != 0;
+			ip += 2;
+
+			ok = cp[0] < m_typeNr && cp[1] < m_nameNr;
+			if (chain)
+			{
+				ok = ok && depth <= (FBTuint32)(ep - ip);
+				keys.resize(ok ? depth : 0);
+			}
+			else
+				ok = ok && depth == keys.size();
+
+			for (d = 0; ok && chain && d < depth; ++d, ++ip)
+			{
+				FBTuint32 t = *ip & 0xFFFF, n = *ip >> 16;
+				ok = t < m_typeNr && n < m_nameNr;
+				if (ok)
+				{
+					fbtKey64 k = {{m_type[t].m_typeId, m_name[n].m_nameId}};
+					keys[d] = k;
+				}
+			}
+
+			if (ok)
+				putMember(cp, off, nr, cof, depth, keys);
+		}
+
+		if (ok && (int)cof != (int)off->m_len)
+		{
+			off->m_flag |= fbtStruct::MISALIGNED;
+			fbtPrintf("Build ==> invalid offset %s:%i:%i:%i\n", m_type[off->m_key.k16[0]].m_name, i, cof, off->m_len);
+		}
+	}
+
+	if (ok && ip == ep)
+		return true;
+
+	fbtPrintf("Bin table: the compiled tables do not match the DNA, compiling it.\n");
+
+	for (i = 0; i < m_offs.size(); i++)
+		delete m_offs[i];
+	m_offs.clear();
+	return false;
+}
+
+fbtStruct* fbtBinTables::putStruct(FBTuint32 i)
+{
+	FBTtype strcType = m_strc[i][0];
+
+	fbtStruct* off = new fbtStruct;
+	off->m_key.k16[0] = strcType;
+	off->m_key.k16[1] = 0;
+	off->m_val.k32[0] = m_type[strcType].m_typeId;
+	off->m_val.k32[1] = 0; // no name
+	off->m_nr         = 0;
+	off->m_dp         = 0;
+	off->m_off        = 0;
+	off->m_len        = m_tlen[strcType];
+	off->m_strcId     = i;
+	off->m_link       = 0;
+	off->m_flag       = fbtStruct::CAN_LINK;
+
+	m_offs.push_back(off);
+	return off;
+}
+
 void fbtBinTables::putMember(FBTtype* cp, fbtStruct* off, FBTtype nr, FBTuint32& cof, FBTuint32 depth, fbtStruct::Keys& keys)
 {
 	fbtStruct nof;
@@ -4775,9 +8319,10 @@ void fbtBinTables::putMember(FBTtype* cp, fbtStruct* off, FBTtype nr, FBTuint32&
 }
 
 
-FBTtype fbtBinTables::findTypeId(const fbtCharHashKey &cp)
+FBTtype fbtBinTables::findTypeId(const fbtCharHashKey &cp) const
 {
-	FBTsizeType pos = m_typeFinder.find(cp);
+	// (no last hit memo: the tables are shared)
+	FBTsizeType pos = m_typeFinder.lookup(cp);
 	if (pos != FBT_NPOS)
 		return m_typeFinder.at(pos).m_strcId;
 	return -1;
@@ -4988,6 +8533,124 @@ FBT_PRIM_TYPE fbtGetPrimType(FBTuint32 typeKey)
 }
 
 
+
+// ----------------------------------------------------------------------------
+// Memory Arena
+
+
+void* fbtMemoryArena::alloc(FBTsize size)
+{
+	if (size > ((FBTsize)-1) - HEADER_SIZE - 2 * ALIGNMENT)
+		return 0;
+
+	const bool own = isOwnBlock(size);
+	Block* blk = m_blocks;
+	if (blk && !own)
+	{
+		FBTuintPtr p   = (FBTuintPtr)blk + HEADER_SIZE + blk->m_used;
+		FBTsize    pad = (FBTsize)((ALIGNMENT - (p & (ALIGNMENT - 1))) & (ALIGNMENT - 1));
+		if (pad <= blk->m_size - blk->m_used && size <= blk->m_size - blk->m_used - pad)
+		{
+			blk->m_used += pad + size;
+			return (void*)(p + pad);
+		}
+	}
+
+	// own blocks go behind the one being filled, with their header address right before the data (release())
+	const FBTsize dataSize = own ? size + 2 * ALIGNMENT : fbtMax<FBTsize>(m_blockSize, size + ALIGNMENT);
+
+	Block* nb = static_cast<Block*>(fbtMalloc(HEADER_SIZE + dataSize));
+	if (!nb)
+		return 0;
+
+	nb->m_size = dataSize;
+	nb->m_prev = 0;
+	if (own && blk)
+	{
+		nb->m_next  = blk->m_next;
+		nb->m_prev  = blk;
+		blk->m_next = nb;
+	}
+	else
+	{
+		nb->m_next = blk;
+		m_blocks   = nb;
+	}
+	if (nb->m_next)
+		nb->m_next->m_prev = nb;
+
+	FBTuintPtr p   = (FBTuintPtr)nb + HEADER_SIZE;
+	FBTsize    pad = (FBTsize)((ALIGNMENT - (p & (ALIGNMENT - 1))) & (ALIGNMENT - 1));
+	if (own)
+	{
+		// (full: nothing else goes in)
+		pad += ALIGNMENT;
+		reinterpret_cast<Block**>(p + pad)[-1] = nb;
+		nb->m_used = dataSize;
+	}
+	else
+		nb->m_used = pad + size;
+	return (void*)(p + pad);
+}
+
+
+void fbtMemoryArena::release(void* p)
+{
+	if (!p)
+		return;
+
+	Block* blk = reinterpret_cast<Block**>(p)[-1];
+	if (blk->m_prev)
+		blk->m_prev->m_next = blk->m_next;
+	else
+		m_blocks = blk->m_next;
+	if (blk->m_next)
+		blk->m_next->m_prev = blk->m_prev;
+	fbtFree(blk);
+}
+
+
+void fbtMemoryArena::adopt(fbtMemoryArena& other, void* p)
+{
+	if (!p)
+		return;
+
+	Block* blk = reinterpret_cast<Block**>(p)[-1];
+	if (blk->m_prev)
+		blk->m_prev->m_next = blk->m_next;
+	else
+		other.m_blocks = blk->m_next;
+	if (blk->m_next)
+		blk->m_next->m_prev = blk->m_prev;
+
+	// (behind the one being filled)
+	blk->m_prev = m_blocks;
+	if (m_blocks)
+	{
+		blk->m_next = m_blocks->m_next;
+		m_blocks->m_next = blk;
+	}
+	else
+	{
+		blk->m_next = 0;
+		m_blocks = blk;
+	}
+	if (blk->m_next)
+		blk->m_next->m_prev = blk;
+}
+
+
+void fbtMemoryArena::clear(void)
+{
+	while (m_blocks)
+	{
+		Block* next = m_blocks->m_next;
+		fbtFree(m_blocks);
+		m_blocks = next;
+	}
+}
+
+
 #endif //_fbtFile_imp_
 
 
@@ -5059,10 +8722,12 @@ fbtIdDB fbtData[] =
 
 extern unsigned char bfBlenderFBT[];
 extern int bfBlenderLen;
+extern const FBTuint32 bfBlenderTables[];
+extern int bfBlenderTablesLen;
 
 
 fbtBlend::fbtBlend()
-	:   fbtFile("BLENDER"), m_stripList(0)
+	:   fbtFile("BLENDER"), m_fg(0), m_stripList(0)
 {
 	m_aluhid = "BLENDEs"; //a stripped blend file
 }
@@ -5077,7 +8742,7 @@ fbtBlend::~fbtBlend()
 
 int fbtBlend::initializeTables(fbtBinTables* tables)
 {
-	return tables->read(bfBlenderFBT, bfBlenderLen, false) ? FS_OK : FS_FAILED;
+	return tables->read(bfBlenderFBT, bfBlenderLen, false, bfBlenderTables, bfBlenderTablesLen) ? FS_OK : FS_FAILED;
 }
 
 
@@ -5933,6 +9598,964 @@ unsigned char bfBlenderFBT[] = {
 14,0,186,16,14,0,187,16,14,0,188,16,192,2,3,0,192,2,0,0,192,2,1,0,0,0,189,16,196,0,14,0,22,0,32,0,36,0,79,0,193,2,139,11,11,0,190,16,14,0,191,16,0,0,35,0,0,0,192,16,0,0,250,3,0,0,251,3,0,0,193,16,7,0,226,3,7,0,217,4,2,0,18,0,2,0,5,8};
 
 int bfBlenderLen=sizeof(bfBlenderFBT);
+
+// bfBlenderFBT already compiled (see fbtBinTables::load())
+const FBTuint32 bfBlenderTables[] = {
+90688,621,2,12,0,65548,0,3,13,0,65549,0,131083,0,2,196619,0,262155,0,2,327682,0,393218,0,2,327687,0,393223,0,3,327687,0,393223,0,458759,0,4,524292,0,589828,
+0,655364,0,720900,0,4,524295,0,589831,0,655367,0,720903,0,5,786443,0,196619,2147549184,851982,262155,65536,917508,2147483648,983044,0,14,21,0,65557,0,1048576,0,1114112,0,1179650,0,1245184,0,1310724,
+0,786443,2147549184,1376276,196619,2147614720,1376276,851982,262155,131072,917508,2147549184,1376276,983044,65536,1441796,2147483648,1507332,0,11,11,0,65547,0,1572886,0,1638423,0,1703936,0,1179650,0,1769474,0,1835010,0,1900548,0,1966084,0,
+2031637,0,19,11,2147549184,2097174,65547,65536,1572886,65536,1638423,65536,1703936,65536,1179650,65536,1769474,65536,1835010,65536,1900548,65536,1966084,65536,2031637,65536,2162712,2147483648,2228224,0,2293760,0,2359319,0,2424857,0,2490372,0,2555906,0,
+2621442,0,9,2686980,0,2752516,0,2818050,0,2883586,0,2949124,0,3014683,0,1966084,0,1769474,0,3080192,0,6,3145757,0,3211266,0,3276802,0,1048578,0,1179650,0,3342336,0,27,30,0,65566,0,3407903,
+0,3473440,0,524295,2147549184,3538963,589831,65536,655367,65536,720903,65536,524295,2147549184,3604499,589831,65536,655367,65536,720903,65536,3211266,2147483648,3276802,0,3670018,0,3735554,0,3801090,0,3866626,0,1179650,0,3932162,0,655367,0,720903,
+0,3997700,0,4063239,0,4128775,0,4194311,0,4259868,0,21,11,2147549184,2097174,65547,65536,1572886,65536,1638423,65536,1703936,65536,1179650,65536,1769474,65536,1835010,65536,1900548,65536,1966084,65536,2031637,65536,196619,2147549184,4325390,262155,65536,
+524295,2147549184,4390931,589831,65536,655367,65536,720903,65536,3211266,2147483648,4456450,0,4521986,0,4587522,0,15,34,0,65570,0,4653063,0,4194311,0,1048578,0,4718594,0,4784130,0,1179650,0,4849668,0,4915204,0,131083,0,
+1245184,0,4980736,0,5046279,0,5111815,0,26,11,2147549184,2097174,65547,65536,1572886,65536,1638423,65536,1703936,65536,1179650,65536,1769474,65536,1835010,65536,1900548,65536,1966084,65536,2031637,65536,5177380,2147483648,5242914,0,5308416,0,5373956,0,
+4587524,0,196619,2147549184,5439502,262155,65536,5505057,2147483648,5570582,0,5636100,0,1179650,0,1048576,0,5701632,0,5767175,0,5832708,0,6,37,0,65573,0,5898240,0,5963776,0,1441796,0,6029316,0,25,11,2147549184,2097174,
+65547,65536,1572886,65536,1638423,65536,1703936,65536,1179650,65536,1769474,65536,1835010,65536,1900548,65536,1966084,65536,2031637,65536,6094848,2147483648,6160388,0,6225924,0,196619,2147549184,6291470,262155,65536,6357029,2147483648,6422565,0,6488068,0,6553604,0,6619136,
+0,6684676,0,6750212,0,6815755,0,6881288,0,3,6946820,0,7012356,0,131083,0,6,7077895,0,7143431,0,7208967,0,7274503,0,7340036,0,7405572,0,6,7471111,0,7536647,0,7602183,0,7667719,0,7733252,0,
+4587524,0,4,7798823,0,7864360,0,7929856,0,7995392,0,8,8060935,0,8126471,0,8192002,0,8257538,0,1179650,0,4587522,0,8323079,0,8388615,0,44,11,2147549184,2097174,65547,65536,1572886,65536,1638423,65536,1703936,65536,
+1179650,65536,1769474,65536,1835010,65536,1900548,65536,1966084,65536,2031637,65536,5177380,2147483648,1048576,0,8454144,0,1179650,0,8519687,0,8585223,0,8650759,0,8716295,0,8781831,0,8847367,0,8912903,0,8978439,0,9043975,0,9109511,0,
+9175047,0,5505057,0,9240605,0,7077895,2147549184,9306151,7143431,65536,7208967,65536,7274503,65536,7340036,65536,7405572,65536,9371648,2147483648,7995392,0,8060935,2147549184,9437226,8126471,65536,8192002,65536,8257538,65536,1179650,65536,4587522,65536,8323079,65536,8388615,65536,
+15,9502765,0,9568260,0,9633796,0,9699332,0,9764868,0,9830400,0,9895936,0,9961472,0,10027008,0,10092546,0,4587522,0,10158082,0,10223618,0,10289154,0,1179650,0,3,46,0,65582,0,10354735,0,4,48,
+0,65584,0,1245184,0,2293760,0,4,49,0,65585,0,2424857,0,2293760,0,1,1245184,0,65,11,2147549184,2097174,65547,65536,1572886,65536,1638423,65536,1703936,65536,1179650,65536,1769474,65536,1835010,65536,1900548,65536,1966084,
+65536,2031637,65536,2228224,2147483648,10420276,0,3014683,0,196619,2147549184,10485774,262155,65536,10551349,2147483648,10616885,0,10682370,0,10747906,0,1179652,0,10813442,0,1048578,0,10878980,0,10944514,0,11010050,0,11075586,0,11141122,0,11206658,0,
+11272194,0,11337732,0,11403264,0,11468804,0,2424857,0,196619,2147549184,11534350,262155,65536,11599898,2147483648,11665415,0,11730948,0,11796482,0,9961474,0,11862020,0,11927556,0,11993088,0,12058624,0,12124162,0,12189703,0,12255239,0,12320775,
+0,1245184,2147549184,12386358,12451840,2147483648,12517376,0,12582912,0,12648448,0,196619,2147549184,12713998,262155,65536,12779575,2147483648,1245184,2147549184,12845106,1245184,65537,1245184,65538,1245184,65539,1245184,65540,1245184,65541,1245184,65542,1245184,65543,69,12910594,0,12976130,
+0,13041666,0,13107202,0,13172765,0,13238329,0,13303808,0,13369344,0,13434880,0,13500416,0,13565952,0,13631488,0,13697024,0,3080192,0,13762567,0,13828103,0,13893639,0,13959175,0,14024706,0,14090242,0,14155778,0,14221314,
+0,14286850,0,14352386,0,14417927,0,14483463,0,14548999,0,14614535,0,14680071,0,3932167,0,14745607,0,14811143,0,14876679,0,14942215,0,15007751,0,15073287,0,15138823,0,15204359,0,15269895,0,15335431,0,15400967,0,15466503,
+0,15532039,0,15597575,0,15663111,0,15728647,0,15794183,0,15859719,0,15925255,0,15990791,0,16056327,0,16121863,0,16187399,0,16252935,0,16318471,0,16384007,0,16449543,0,16515079,0,16580615,0,16646151,0,16711687,0,16777223,
+0,16842759,0,16908295,0,5701636,0,16973831,0,17039367,0,17104903,0,17170439,0,6,14417927,0,14483463,0,14548999,0,17235975,0,4653063,0,4390916,0,198,17301506,0,4390914,0,17367040,0,17432576,0,17498112,0,17563648,
+0,14417927,2147549184,17629242,14483463,65536,14548999,65536,17235975,65536,4653063,65536,4390916,65536,14417927,65537,14483463,65537,14548999,65537,17235975,65537,4653063,65537,4390916,65537,14417927,65538,14483463,65538,14548999,65538,17235975,65538,4653063,65538,4390916,65538,14417927,65539,
+14483463,65539,14548999,65539,17235975,65539,4653063,65539,4390916,65539,14417927,65540,14483463,65540,14548999,65540,17235975,65540,4653063,65540,4390916,65540,14417927,65541,14483463,65541,14548999,65541,17235975,65541,4653063,65541,4390916,65541,14417927,65542,14483463,65542,14548999,65542,
+17235975,65542,4653063,65542,4390916,65542,14417927,65543,14483463,65543,14548999,65543,17235975,65543,4653063,65543,4390916,65543,14417927,65544,14483463,65544,14548999,65544,17235975,65544,4653063,65544,4390916,65544,14417927,65545,14483463,65545,14548999,65545,17235975,65545,4653063,65545,
+4390916,65545,14417927,65546,14483463,65546,14548999,65546,17235975,65546,4653063,65546,4390916,65546,14417927,65547,14483463,65547,14548999,65547,17235975,65547,4653063,65547,4390916,65547,14417927,65548,14483463,65548,14548999,65548,17235975,65548,4653063,65548,4390916,65548,14417927,65549,
+14483463,65549,14548999,65549,17235975,65549,4653063,65549,4390916,65549,14417927,65550,14483463,65550,14548999,65550,17235975,65550,4653063,65550,4390916,65550,14417927,65551,14483463,65551,14548999,65551,17235975,65551,4653063,65551,4390916,65551,14417927,65552,14483463,65552,14548999,65552,
+17235975,65552,4653063,65552,4390916,65552,14417927,65553,14483463,65553,14548999,65553,17235975,65553,4653063,65553,4390916,65553,14417927,65554,14483463,65554,14548999,65554,17235975,65554,4653063,65554,4390916,65554,14417927,65555,14483463,65555,14548999,65555,17235975,65555,4653063,65555,
+4390916,65555,14417927,65556,14483463,65556,14548999,65556,17235975,65556,4653063,65556,4390916,65556,14417927,65557,14483463,65557,14548999,65557,17235975,65557,4653063,65557,4390916,65557,14417927,65558,14483463,65558,14548999,65558,17235975,65558,4653063,65558,4390916,65558,14417927,65559,
+14483463,65559,14548999,65559,17235975,65559,4653063,65559,4390916,65559,14417927,65560,14483463,65560,14548999,65560,17235975,65560,4653063,65560,4390916,65560,14417927,65561,14483463,65561,14548999,65561,17235975,65561,4653063,65561,4390916,65561,14417927,65562,14483463,65562,14548999,65562,
+17235975,65562,4653063,65562,4390916,65562,14417927,65563,14483463,65563,14548999,65563,17235975,65563,4653063,65563,4390916,65563,14417927,65564,14483463,65564,14548999,65564,17235975,65564,4653063,65564,4390916,65564,14417927,65565,14483463,65565,14548999,65565,17235975,65565,4653063,65565,
+4390916,65565,14417927,65566,14483463,65566,14548999,65566,17235975,65566,4653063,65566,4390916,65566,14417927,65567,14483463,65567,14548999,65567,17235975,65567,4653063,65567,4390916,65567,17,13172765,0,17694771,0,17760317,0,17825799,0,17891335,0,1048578,0,17956866,
+0,8585223,0,8650759,0,18022407,0,18087940,0,18153474,0,18219010,0,9961476,0,10878980,0,18284546,0,18350082,0,27,1179650,0,18415618,0,18481159,0,18546695,0,10813442,0,18612226,0,18677762,0,18743298,0,18808836,0,
+13172765,0,18874372,0,18939906,0,19005442,0,19070976,0,19136523,0,19202055,0,19267591,0,19333122,0,19398658,0,19464194,0,19529730,0,19595271,0,19660807,0,19726343,0,5701639,0,19791931,0,19857471,0,16,19922948,0,19988484,
+0,20054018,0,1179650,0,20119554,0,20185090,0,20250626,0,20316162,0,20381700,0,13172765,0,20447239,0,20512772,0,20578304,0,20643847,0,20709380,0,9961476,0,4,13172765,0,20774912,0,20840452,0,4587524,0,87,11,
+2147549184,2097174,65547,65536,1572886,65536,1638423,65536,1703936,65536,1179650,65536,1769474,65536,1835010,65536,1900548,65536,1966084,65536,2031637,65536,5177380,2147483648,20905991,0,20971527,0,21037063,0,21102599,0,21168135,0,21233671,0,21299207,0,21364743,0,
+21430279,0,5701639,0,21495815,0,21561351,0,21626887,0,21692423,0,21757959,0,21823495,0,21889031,0,21954567,0,22020103,0,22085639,0,22151175,0,22216711,0,22282242,0,22347778,0,22413314,0,22478850,0,22544386,0,22609922,0,
+22675458,0,1179650,0,1048578,0,17956866,0,22740999,0,22806535,0,22872071,0,22937607,0,23003140,0,23068676,0,23134210,0,23199746,0,20119554,0,9830402,0,1441796,0,9633796,0,9699332,0,9764868,0,23265287,0,23330823,0,
+4718599,0,9502765,2147549184,23396396,9568260,65536,9633796,65536,9699332,65536,9764868,65536,9830400,65536,9895936,65536,9961472,65536,10027008,65536,10092546,65536,4587522,65536,10158082,65536,10223618,65536,10289154,65536,1179650,65536,23461954,2147483648,5505057,0,17694771,0,19791931,
+0,23527484,0,11599898,0,23593022,0,23658560,0,23724097,0,23789568,0,7995392,0,13,23855111,0,23920647,0,13828103,0,1179652,0,13369344,0,13434880,0,13500416,0,13565952,0,1048580,0,23986183,0,24051719,0,24117255,0,
+3145757,0,206,17301506,2147549184,24182843,4390914,65536,17367040,65536,17432576,65536,17498112,65536,17563648,65536,14417927,2147614720,24182843,17629242,14483463,131072,14548999,131072,17235975,131072,4653063,131072,4390916,131072,14417927,131073,14483463,131073,14548999,131073,17235975,131073,4653063,131073,
+4390916,131073,14417927,131074,14483463,131074,14548999,131074,17235975,131074,4653063,131074,4390916,131074,14417927,131075,14483463,131075,14548999,131075,17235975,131075,4653063,131075,4390916,131075,14417927,131076,14483463,131076,14548999,131076,17235975,131076,4653063,131076,4390916,131076,14417927,131077,
+14483463,131077,14548999,131077,17235975,131077,4653063,131077,4390916,131077,14417927,131078,14483463,131078,14548999,131078,17235975,131078,4653063,131078,4390916,131078,14417927,131079,14483463,131079,14548999,131079,17235975,131079,4653063,131079,4390916,131079,14417927,131080,14483463,131080,14548999,131080,
+17235975,131080,4653063,131080,4390916,131080,14417927,131081,14483463,131081,14548999,131081,17235975,131081,4653063,131081,4390916,131081,14417927,131082,14483463,131082,14548999,131082,17235975,131082,4653063,131082,4390916,131082,14417927,131083,14483463,131083,14548999,131083,17235975,131083,4653063,131083,
+4390916,131083,14417927,131084,14483463,131084,14548999,131084,17235975,131084,4653063,131084,4390916,131084,14417927,131085,14483463,131085,14548999,131085,17235975,131085,4653063,131085,4390916,131085,14417927,131086,14483463,131086,14548999,131086,17235975,131086,4653063,131086,4390916,131086,14417927,131087,
+14483463,131087,14548999,131087,17235975,131087,4653063,131087,4390916,131087,14417927,131088,14483463,131088,14548999,131088,17235975,131088,4653063,131088,4390916,131088,14417927,131089,14483463,131089,14548999,131089,17235975,131089,4653063,131089,4390916,131089,14417927,131090,14483463,131090,14548999,131090,
+17235975,131090,4653063,131090,4390916,131090,14417927,131091,14483463,131091,14548999,131091,17235975,131091,4653063,131091,4390916,131091,14417927,131092,14483463,131092,14548999,131092,17235975,131092,4653063,131092,4390916,131092,14417927,131093,14483463,131093,14548999,131093,17235975,131093,4653063,131093,
+4390916,131093,14417927,131094,14483463,131094,14548999,131094,17235975,131094,4653063,131094,4390916,131094,14417927,131095,14483463,131095,14548999,131095,17235975,131095,4653063,131095,4390916,131095,14417927,131096,14483463,131096,14548999,131096,17235975,131096,4653063,131096,4390916,131096,14417927,131097,
+14483463,131097,14548999,131097,17235975,131097,4653063,131097,4390916,131097,14417927,131098,14483463,131098,14548999,131098,17235975,131098,4653063,131098,4390916,131098,14417927,131099,14483463,131099,14548999,131099,17235975,131099,4653063,131099,4390916,131099,14417927,131100,14483463,131100,14548999,131100,
+17235975,131100,4653063,131100,4390916,131100,14417927,131101,14483463,131101,14548999,131101,17235975,131101,4653063,131101,4390916,131101,14417927,131102,14483463,131102,14548999,131102,17235975,131102,4653063,131102,4390916,131102,14417927,131103,14483463,131103,14548999,131103,17235975,131103,4653063,131103,
+4390916,131103,21037063,2147483648,21102599,0,21168135,0,1179652,0,24248327,0,24313863,0,24379396,0,24444932,0,89,11,2147549184,2097174,65547,65536,1572886,65536,1638423,65536,1703936,65536,1179650,65536,1769474,65536,1835010,65536,1900548,65536,1966084,65536,
+2031637,65536,5177380,2147483648,1048578,0,1179650,0,24510468,0,14090242,0,24576002,0,14417927,0,14483463,0,14548999,0,14614535,0,24641543,0,24707079,0,24772615,0,24838151,0,24903687,0,24969223,0,25034759,0,25100295,0,25165831,0,
+25231367,0,25296903,0,25362439,0,25427975,0,25493511,0,25559047,0,25624639,0,18415618,0,5701634,0,8585223,0,8650759,0,25690119,0,25755655,0,25821191,0,25886727,0,25952263,0,26017794,0,26083330,0,26148866,0,26214402,0,
+26279936,0,26345472,0,26411010,0,26476546,0,26542082,0,26607618,0,26673154,0,26738695,0,26804231,0,26869767,0,26935303,0,27000834,0,27066370,0,27131906,0,27197442,0,27262978,0,27328514,0,27394055,0,27459591,0,27525127,0,
+27590663,0,27656199,0,27721735,0,27787271,0,27852807,0,27918343,0,27983879,0,28049415,0,28114951,0,28180487,0,28246018,0,28311552,0,5505057,0,28377144,0,28442626,0,23789570,0,28508160,0,11599898,0,23461954,0,18,28573703,
+0,28639239,0,28704775,0,28770311,0,28835847,0,28901383,0,28966919,0,29032455,0,29097991,0,29163527,0,29229058,0,29294594,0,29360130,0,29425666,0,29491207,0,29556743,0,29622279,0,29687815,0,4,1179652,0,29753348,0,
+29818884,0,4718596,0,4,17694771,0,29884416,0,29949956,0,4587524,0,171,11,2147549184,2097174,65547,65536,1572886,65536,1638423,65536,1703936,65536,1179650,65536,1769474,65536,1835010,65536,1900548,65536,1966084,65536,2031637,65536,5177380,2147483648,30015490,
+0,1179650,0,14417927,0,14483463,0,14548999,0,30081031,0,30146567,0,30212103,0,30277639,0,30343175,0,30408711,0,30474247,0,30539783,0,30605319,0,30670855,0,30736391,0,30801927,0,30867463,0,30932999,0,30998535,0,31064071,
+0,31129607,0,31195143,0,31260679,0,31326215,0,28573703,2147549184,31391814,28639239,65536,28704775,65536,28770311,65536,28835847,65536,28901383,65536,28966919,65536,29032455,65536,29097991,65536,29163527,65536,29229058,65536,29294594,65536,29360130,65536,29425666,65536,29491207,65536,
+29556743,65536,29622279,65536,29687815,65536,1179652,2147549184,31457351,29753348,65536,29818884,65536,4718596,65536,31522823,2147483648,31588359,0,31653895,0,31719431,0,31784967,0,31850503,0,31916039,0,31981570,0,32047106,0,32112642,0,32178176,0,32243712,0,32309255,
+0,32374791,0,32440322,0,32505858,0,32571399,0,32636935,0,32702471,0,32768007,0,32833538,0,32899074,0,24510468,0,32964612,0,33030148,0,33095684,0,33161218,0,33226754,0,33292290,0,33357826,0,33423367,0,33488903,0,33554439,
+0,33619975,0,33685511,0,33751047,0,33816583,0,33882119,0,33947655,0,34013191,0,34078720,0,34144263,0,34209799,0,34275335,0,34340868,0,34406400,0,27131904,0,34471936,0,23789568,0,34537474,0,28442626,0,34603010,0,34668544,
+0,4587520,0,34734082,0,34799618,0,34865159,0,34930695,0,34996231,0,35061767,0,35127303,0,12910594,0,12976130,0,35192891,0,35258427,0,35323904,0,35389440,0,35454976,0,35520512,0,35586050,0,35651586,0,35717127,0,35782663,
+0,28377144,0,23461954,0,5505057,0,35848266,0,11599898,0,35913735,0,35979271,0,36044807,0,36110343,0,36175879,0,36241410,0,5701634,0,36306951,0,36372487,0,36438023,0,36503559,0,36569095,0,36634631,0,36700167,0,36765703,
+0,36831239,0,36896770,0,36962306,0,37027844,0,37093378,0,29949954,0,37158919,0,37224450,0,37289986,0,37355522,0,37421058,0,37486594,0,37552130,0,37617664,0,37683204,0,25952260,0,37748808,0,196619,2147549184,37814286,262155,65536,
+15,11,2147549184,2097174,65547,65536,1572886,65536,1638423,65536,1703936,65536,1179650,65536,1769474,65536,1835010,65536,1900548,65536,1966084,65536,2031637,65536,2228224,2147483648,131148,0,2424857,0,37879833,0,20,77,0,65613,0,37945422,0,1048578,
+0,1179650,0,38010882,0,38076418,0,327687,0,393223,0,458759,0,38141959,0,38207495,0,38273031,0,38338567,0,38404103,0,38469639,0,38535175,0,1441799,0,38600711,0,38666247,0,31,11,2147549184,2097174,65547,65536,1572886,
+65536,1638423,65536,1703936,65536,1179650,65536,1769474,65536,1835010,65536,1900548,65536,1966084,65536,2031637,65536,5177380,2147483648,196619,2147549184,38731790,262155,65536,196619,2147549184,38797326,262155,65536,38862862,2147483648,5505057,0,38928457,0,1179648,0,38993920,0,39059458,
+0,14024706,0,4587522,0,23855111,0,13828103,0,23920647,0,39124999,0,39190535,0,39256071,0,39321677,0,16,39387143,0,39452679,0,39518215,0,18546695,0,3801088,0,39583744,0,39649280,0,39714816,0,39780352,0,39845888,0,
+39911424,0,39976960,0,40042503,0,40108039,0,40173575,0,40239104,0,7,40304647,0,39452679,0,39518215,0,39714818,0,39911426,0,18546695,0,4587527,0,22,80,0,65616,0,1048578,0,40370178,0,39911426,0,1179650,0,
+40435716,0,40501252,0,3080194,0,40566786,0,40632322,0,40697858,0,40763394,0,40828930,0,40894466,0,40960007,0,41025543,0,3407903,0,3473440,0,41091074,0,41156610,0,41222148,0,5,41287682,0,40370178,0,1179648,0,4587520,
+0,5701634,0,4,327687,0,393223,0,41353223,0,41418759,0,5,196619,2147549184,41484302,262155,65536,41549908,2147483648,41615364,0,40239104,0,85,11,2147549184,2097174,65547,65536,1572886,65536,1638423,65536,1703936,65536,1179650,65536,1769474,65536,
+1835010,65536,1900548,65536,1966084,65536,2031637,65536,5177380,2147483648,37945422,0,196619,2147549184,41680910,262155,65536,41746515,2147483648,41811997,0,41877533,0,41943069,0,5505057,0,42008611,0,38928457,0,23855111,0,13828103,0,23920647,0,1048578,0,14024706,
+0,42074114,0,42139650,0,42205191,0,42270727,0,42336260,0,42401794,0,39059458,0,1179652,0,42467335,0,42532871,0,42598407,0,40566786,0,40632322,0,42663938,0,42729474,0,42795012,0,42860548,0,40239104,0,6291458,0,42926080,
+0,42991616,0,43057159,0,43122695,0,43188231,0,43253767,0,43319303,0,43384839,0,43450375,0,43515911,0,43581447,0,43646983,0,4653060,0,43712516,0,43778052,0,43843588,0,1441796,0,43909120,0,43974742,0,44040192,0,44105803,
+0,44171339,0,44236875,0,44302411,0,44367954,0,44433412,0,44498948,0,44564561,0,41287682,2147549184,44630097,40370178,65536,1179648,65536,4587520,65536,5701634,65536,5767175,2147483648,44695559,0,44761095,0,44826624,0,44892160,0,44957696,0,94,11,
+2147549184,2097174,65547,65536,1572886,65536,1638423,65536,1703936,65536,1179650,65536,1769474,65536,1835010,65536,1900548,65536,1966084,65536,2031637,65536,5177380,2147483648,37945422,0,5505057,0,42008611,0,38928457,0,45023320,0,45088857,0,45154394,0,45219931,0,
+45285468,0,45351005,0,45416542,0,45482079,0,45547616,0,45613153,0,45678690,0,45744227,0,45809764,0,45875287,0,45940837,0,228065842,2147549184,46006374,228130820,65536,64094212,65536,228196356,65536,228261892,65536,228327428,65536,228393253,65536,228459059,65536,228065842,
+2147549184,46071910,228130820,65536,64094212,65536,228196356,65536,228261892,65536,228327428,65536,228393253,65536,228459059,65536,228065842,2147549184,46137446,228130820,65536,64094212,65536,228196356,65536,228261892,65536,228327428,65536,228393253,65536,228459059,65536,228065842,2147549184,46202982,228130820,65536,64094212,65536,
+228196356,65536,228261892,65536,228327428,65536,228393253,65536,228459059,65536,228065842,2147549184,46268518,228130820,65536,64094212,65536,228196356,65536,228261892,65536,228327428,65536,228393253,65536,228459059,65536,3735556,2147483648,46333956,0,46399492,0,46465028,0,46530564,0,46596100,0,46661636,
+0,23855111,0,13828103,0,23920647,0,42074116,0,14024706,0,1179650,0,46727175,0,5701636,0,46792704,0,4587520,0,46858240,0,46923776,0,46989312,0,47054848,0,39059458,0,47120487,0,8,47185931,0,47251463,0,47316996,0,
+1179648,0,47382528,0,24510466,0,47448066,0,47513602,0,7,47579140,0,47644676,0,47710212,0,47775748,0,40370178,0,47841280,0,1179648,0,5,47579140,0,47644676,0,47906816,0,47972352,0,1179650,0,2,48037892,0,39518215,
+0,3,48103528,0,48168964,0,1179652,0,4,48234503,0,48300034,0,1179648,0,47972352,0,4,17235968,0,14417920,0,14483456,0,14548992,0,5,48365572,0,46596100,0,40370178,0,1179648,0,4587520,0,2,48431108,0,
+48496644,0,6,47185971,0,1179648,0,47382528,0,24510466,0,47448066,0,4587522,0,2,48562183,0,1179652,0,4,14417920,0,14483456,0,14548992,0,17235968,0,2,29949956,0,1048580,0,7,47251463,0,47185971,0,1179648,
+0,47382528,0,24510466,0,47448066,0,47513602,0,1,48627719,0,1,48693252,0,2,48758784,0,48824320,0,1,47251463,0,1,48562183,0,4,48889860,0,48955396,0,49020935,0,49086468,0,4,17235975,0,14417927,0,
+14483463,0,14548999,0,16,17235975,2147549184,47317103,14417927,65536,14483463,65536,14548999,65536,17235975,65537,14417927,65537,14483463,65537,14548999,65537,17235975,65538,14417927,65538,14483463,65538,14548999,65538,17235975,65539,14417927,65539,14483463,65539,14548999,65539,5,49152004,
+0,49217540,0,1179648,0,40370176,0,3080192,0,2,49283076,0,49217540,0,10,115,0,65651,0,49348721,0,49414256,0,49479794,0,3735556,0,46399492,0,46333956,0,4587524,0,49545313,0,29,196619,2147549184,49610766,262155,
+65536,49545313,2147483648,49676288,0,49741824,0,49807360,0,49872896,0,49938432,0,50003968,0,50069504,0,1179648,0,228065842,2147549184,46006374,228130820,65536,64094212,65536,228196356,65536,228261892,65536,228327428,65536,228393253,65536,228459059,65536,228065842,2147549184,46137446,228130820,
+65536,64094212,65536,228196356,65536,228261892,65536,228327428,65536,228393253,65536,228459059,65536,50135042,2147483648,50200576,0,1,48693252,0,3,131079,0,48955396,0,4587524,0,2,50266119,0,1179652,0,2,1179648,0,24444928,0,2,1179648,0,
+24444928,0,9,121,0,65657,0,1048580,0,24510468,0,50331652,0,4587524,0,1245184,0,9502765,0,50397184,0,14,121,2147549184,50462841,65657,65536,1048580,65536,24510468,65536,50331652,65536,4587524,65536,1245184,65536,9502765,65536,50397184,
+65536,50528313,2147483648,50593821,0,50659328,0,50724868,0,50790404,0,17,121,2147549184,50462841,65657,65536,1048580,65536,24510468,65536,50331652,65536,4587524,65536,1245184,65536,9502765,65536,50397184,65536,50855938,2147483648,49610754,0,50921474,0,6160386,0,50987010,
+0,24444930,0,51052555,0,51118091,0,13,121,2147549184,50462841,65657,65536,1048580,65536,24510468,65536,50331652,65536,4587524,65536,1245184,65536,9502765,65536,50397184,65536,13172765,2147483648,1245184,0,51183623,0,40239104,0,13,121,2147549184,50462841,65657,
+65536,1048580,65536,24510468,65536,50331652,65536,4587524,65536,1245184,65536,9502765,65536,50397184,65536,13172765,2147483648,1245184,0,51249154,0,51314688,0,14,121,2147549184,50462841,65657,65536,1048580,65536,24510468,65536,50331652,65536,4587524,65536,1245184,65536,9502765,
+65536,50397184,65536,51380231,2147483648,51445767,0,1179650,0,51511298,0,51576836,0,13,121,2147549184,50462841,65657,65536,1048580,65536,24510468,65536,50331652,65536,4587524,65536,1245184,65536,9502765,65536,50397184,65536,51642397,2147483648,4980736,0,24510468,0,1179652,
+0,21,121,2147549184,50462841,65657,65536,1048580,65536,24510468,65536,50331652,65536,4587524,65536,1245184,65536,9502765,65536,50397184,65536,51707933,2147483648,51773469,0,51839005,0,51904541,0,51970055,0,52035591,0,51445767,0,52101127,0,52166660,0,52232196,
+0,6160388,0,52297732,0,14,121,2147549184,50462841,65657,65536,1048580,65536,24510468,65536,50331652,65536,4587524,65536,1245184,65536,9502765,65536,50397184,65536,52363266,2147483648,1179650,0,52428807,0,52494343,0,52559901,0,11,121,2147549184,50462841,65657,
+65536,1048580,65536,24510468,65536,50331652,65536,4587524,65536,1245184,65536,9502765,65536,50397184,65536,52625415,2147483648,6160388,0,21,121,2147549184,50462841,65657,65536,1048580,65536,24510468,65536,50331652,65536,4587524,65536,1245184,65536,9502765,65536,50397184,65536,52690951,
+2147483648,52756484,0,6160386,0,52822018,0,52887554,0,52953090,0,53018626,0,4587522,0,5701636,0,53084167,0,53149703,0,53215232,0,14,121,2147549184,50462841,65657,65536,1048580,65536,24510468,65536,50331652,65536,4587524,65536,1245184,65536,9502765,
+65536,50397184,65536,53280901,2147483648,53346438,0,53411975,0,53477383,0,1048580,0,19,121,2147549184,50462841,65657,65536,1048580,65536,24510468,65536,50331652,65536,4587524,65536,1245184,65536,9502765,65536,50397184,65536,50528313,2147483648,50593821,0,50659328,0,50724868,
+0,50790404,0,51183623,0,53542916,0,53215232,0,53608455,0,53673988,0,20,121,2147549184,50462841,65657,65536,1048580,65536,24510468,65536,50331652,65536,4587524,65536,1245184,65536,9502765,65536,50397184,65536,53739549,2147483648,53805107,0,6160388,0,53870596,
+0,53936135,0,54001671,0,54067207,0,54132743,0,50659328,0,50724868,0,4587524,0,19,121,2147549184,50462841,65657,65536,1048580,65536,24510468,65536,50331652,65536,4587524,65536,1245184,65536,9502765,65536,50397184,65536,54198279,2147483648,54263810,0,54329344,
+0,54394880,0,54460423,0,53215232,0,54525959,0,1179650,0,24510466,0,54591492,0,13,121,2147549184,50462841,65657,65536,1048580,65536,24510468,65536,50331652,65536,4587524,65536,1245184,65536,9502765,65536,50397184,65536,54657031,2147483648,53215232,0,1179650,
+0,54722562,0,16,121,2147549184,50462841,65657,65536,1048580,65536,24510468,65536,50331652,65536,4587524,65536,1245184,65536,9502765,65536,50397184,65536,13172765,2147483648,54657031,0,18546695,0,6946823,0,53215232,0,1179650,0,1048578,0,29,121,2147549184,
+50462841,65657,65536,1048580,65536,24510468,65536,50331652,65536,4587524,65536,1245184,65536,9502765,65536,50397184,65536,50528313,2147483648,50593821,0,50659328,0,50724868,0,50790404,0,54788125,0,53215232,0,1179650,0,4587522,0,54853639,0,54919175,0,54984711,
+0,42467335,0,55050247,0,55115783,0,55181319,0,55246855,0,55312391,0,55377927,0,4718599,0,15,121,2147549184,50462841,65657,65536,1048580,65536,24510468,65536,50331652,65536,4587524,65536,1245184,65536,9502765,65536,50397184,65536,55443458,2147483648,55508994,
+0,5701636,0,13172765,0,55574535,0,53215232,0,22,121,2147549184,50462841,65657,65536,1048580,65536,24510468,65536,50331652,65536,4587524,65536,1245184,65536,9502765,65536,50397184,65536,13172765,2147483648,55640064,0,1179648,0,18415616,0,51314688,0,55705607,
+0,55771143,0,55246855,0,25624639,0,55836676,0,55902212,0,55967751,0,1245184,0,9,121,2147549184,50462841,65657,65536,1048580,65536,24510468,65536,50331652,65536,4587524,65536,1245184,65536,9502765,65536,50397184,65536,22,121,2147549184,50462841,65657,
+65536,1048580,65536,24510468,65536,50331652,65536,4587524,65536,1245184,65536,9502765,65536,50397184,65536,9502765,2147483648,56033426,0,56098963,0,56164500,0,56230037,0,196619,2147549184,56295438,262155,65536,56361110,2147483648,56426503,0,56492039,0,56557572,0,56623111,0,
+56688791,0,23,121,2147549184,50462841,65657,65536,1048580,65536,24510468,65536,50331652,65536,4587524,65536,1245184,65536,9502765,65536,50397184,65536,56754273,2147483648,56819809,0,56885345,0,56950881,0,57016417,0,57081953,0,57147545,0,57212932,0,57278468,0,
+57344007,0,57409543,0,57475072,0,7995392,0,57540762,0,15,121,2147549184,50462841,65657,65536,1048580,65536,24510468,65536,50331652,65536,4587524,65536,1245184,65536,9502765,65536,50397184,65536,56754273,2147483648,57606241,0,57671836,0,57540765,0,57737220,0,
+57802756,0,14,121,2147549184,50462841,65657,65536,1048580,65536,24510468,65536,50331652,65536,4587524,65536,1245184,65536,9502765,65536,50397184,65536,13172765,2147483648,57868288,0,57933824,0,3080192,0,57999367,0,2,58064900,0,39518215,0,2,9699332,0,
+58130436,0,30,121,2147549184,50462841,65657,65536,1048580,65536,24510468,65536,50331652,65536,4587524,65536,1245184,65536,9502765,65536,50397184,65536,13172765,2147483648,53215232,0,58195970,0,1179650,0,3080194,0,58261663,0,58327044,0,58392583,0,3735556,0,
+58458116,0,58523808,0,58589343,0,58654724,0,58720260,0,58130436,0,58785799,0,58851335,0,58916871,0,58982407,0,59047943,0,59113483,0,17,121,2147549184,50462841,65657,65536,1048580,65536,24510468,65536,50331652,65536,4587524,65536,1245184,65536,
+9502765,65536,50397184,65536,59179171,2147483648,59244700,0,59310236,0,59375620,0,59441156,0,59506692,0,1179650,0,4587522,0,16,121,2147549184,50462841,65657,65536,1048580,65536,24510468,65536,50331652,65536,4587524,65536,1245184,65536,9502765,65536,50397184,65536,
+3145757,2147483648,18874370,0,1179650,0,52363266,0,4587522,0,59572231,0,59637767,0,14,121,2147549184,50462841,65657,65536,1048580,65536,24510468,65536,50331652,65536,4587524,65536,1245184,65536,9502765,65536,50397184,65536,59703300,2147483648,1179650,0,59768834,0,
+59834375,0,13303808,0,16,121,2147549184,50462841,65657,65536,1048580,65536,24510468,65536,50331652,65536,4587524,65536,1245184,65536,9502765,65536,50397184,65536,59899904,2147483648,59965440,0,50003968,0,60030976,0,60096512,0,6160384,0,3080192,0,11,121,
+2147549184,50462841,65657,65536,1048580,65536,24510468,65536,50331652,65536,4587524,65536,1245184,65536,9502765,65536,50397184,65536,60162216,2147483648,56230037,0,20,121,2147549184,50462841,65657,65536,1048580,65536,24510468,65536,50331652,65536,4587524,65536,1245184,65536,9502765,65536,
+50397184,65536,60227613,2147483648,60293149,0,60358656,0,60424199,0,60489730,0,60555264,0,4718592,0,60620807,0,60686336,0,60751872,0,3080192,0,17,121,2147549184,50462841,65657,65536,1048580,65536,24510468,65536,50331652,65536,4587524,65536,1245184,65536,
+9502765,65536,50397184,65536,60817437,2147483648,60358656,0,7471111,0,60882951,0,24510464,0,52363264,0,1179648,0,4587520,0,9,121,2147549184,50462841,65657,65536,1048580,65536,24510468,65536,50331652,65536,4587524,65536,1245184,65536,9502765,65536,50397184,65536,
+21,121,2147549184,50462841,65657,65536,1048580,65536,24510468,65536,50331652,65536,4587524,65536,1245184,65536,9502765,65536,50397184,65536,53215232,2147483648,9699335,0,60948487,0,61014023,0,61079559,0,4587527,0,61145095,0,61210631,0,61276167,0,1179652,0,
+61341698,0,61407234,0,19,121,2147549184,50462841,65657,65536,1048580,65536,24510468,65536,50331652,65536,4587524,65536,1245184,65536,9502765,65536,50397184,65536,61472797,2147483648,61538308,0,61603844,0,54263812,0,61669383,0,54460423,0,52101127,0,1179650,0,
+52363264,0,12517376,0,37,121,2147549184,50462841,65657,65536,1048580,65536,24510468,65536,50331652,65536,4587524,65536,1245184,65536,9502765,65536,50397184,65536,61735087,2147483648,61800624,0,61865988,0,61931524,0,61997063,0,55181319,0,62062599,0,18219015,0,
+62128135,0,62193671,0,62259207,0,62324743,0,62390279,0,53477383,0,62455812,0,62521348,0,62586880,0,62652416,0,62717952,0,62783488,0,1179648,0,62849024,0,62914562,0,62980098,0,51576836,0,6946823,0,63045639,0,4587524,0,
+23,121,2147549184,50462841,65657,65536,1048580,65536,24510468,65536,50331652,65536,4587524,65536,1245184,65536,9502765,65536,50397184,65536,50528313,2147483648,50593821,0,50659328,0,50724868,0,50790404,0,63111197,0,63176733,0,25624639,0,53215232,0,51183623,0,
+63242247,0,1179648,0,18415616,0,51314688,0,24,121,2147549184,50462841,65657,65536,1048580,65536,24510468,65536,50331652,65536,4587524,65536,1245184,65536,9502765,65536,50397184,65536,53215232,2147483648,63307778,0,18415618,0,63373319,0,63438911,0,63504391,0,
+63569927,0,63635463,0,63700992,0,63766532,0,63832121,0,63897629,0,63963140,0,64028672,0,64094212,0,24,121,2147549184,50462841,65657,65536,1048580,65536,24510468,65536,50331652,65536,4587524,65536,1245184,65536,9502765,65536,50397184,65536,64159744,2147483648,
+64225280,0,64290823,0,64356359,0,64421888,0,64487424,0,64552960,0,63635463,0,63700992,0,63766532,0,63832121,0,63897629,0,63963140,0,64028672,0,64094212,0,24,121,2147549184,50462841,65657,65536,1048580,65536,24510468,65536,50331652,65536,
+4587524,65536,1245184,65536,9502765,65536,50397184,65536,53215232,2147483648,64618500,0,64684036,0,64749597,0,63635463,0,63700992,0,63766532,0,63832121,0,63897629,0,63963140,0,64028672,0,64815111,0,64880647,0,18415618,0,1835010,0,13,121,
+2147549184,50462841,65657,65536,1048580,65536,24510468,65536,50331652,65536,4587524,65536,1245184,65536,9502765,65536,50397184,65536,64946358,2147483648,65011895,0,1048580,0,4587524,0,16,121,2147549184,50462841,65657,65536,1048580,65536,24510468,65536,50331652,65536,4587524,65536,
+1245184,65536,9502765,65536,50397184,65536,65077255,2147483648,65142791,0,65208327,0,18219008,0,1179648,0,24510464,0,4587520,0,13,121,2147549184,50462841,65657,65536,1048580,65536,24510468,65536,50331652,65536,4587524,65536,1245184,65536,9502765,65536,50397184,65536,
+65273863,2147483648,1179648,0,65339392,0,3080192,0,13,121,2147549184,50462841,65657,65536,1048580,65536,24510468,65536,50331652,65536,4587524,65536,1245184,65536,9502765,65536,50397184,65536,1179652,2147483648,65404932,0,65470468,0,4587524,0,15,121,2147549184,50462841,
+65657,65536,1048580,65536,24510468,65536,50331652,65536,4587524,65536,1245184,65536,9502765,65536,50397184,65536,65536007,2147483648,65601543,0,4718599,0,53215232,0,1179650,0,54722562,0,21,121,2147549184,50462841,65657,65536,1048580,65536,24510468,65536,50331652,65536,
+4587524,65536,1245184,65536,9502765,65536,50397184,65536,65667079,2147483648,65732612,0,65536007,0,54722562,0,1179650,0,65798144,0,65863680,0,3080192,0,53215232,0,65929223,0,65994756,0,66060288,0,19,121,2147549184,50462841,65657,65536,1048580,65536,
+24510468,65536,50331652,65536,4587524,65536,1245184,65536,9502765,65536,50397184,65536,66125824,2147483648,66191360,0,51314688,0,66256903,0,66322461,0,66387968,0,66453533,0,66519040,0,60358656,0,50659328,0,26,121,2147549184,50462841,65657,65536,1048580,65536,
+24510468,65536,50331652,65536,4587524,65536,1245184,65536,9502765,65536,50397184,65536,1179648,2147483648,1048576,0,66584576,0,66650112,0,66715648,0,66781184,0,66846720,0,66912256,0,7471111,0,66977792,0,7995392,0,67043335,0,67108871,0,67174407,0,
+67239943,0,67305479,0,2293760,0,16,121,2147549184,50462841,65657,65536,1048580,65536,24510468,65536,50331652,65536,4587524,65536,1245184,65536,9502765,65536,50397184,65536,67371008,2147483648,67436548,0,54722564,0,67502087,0,67567627,0,1179650,0,24444930,0,
+17,121,2147549184,50462841,65657,65536,1048580,65536,24510468,65536,50331652,65536,4587524,65536,1245184,65536,9502765,65536,50397184,65536,53215232,2147483648,9699335,0,60948487,0,61014023,0,67633159,0,1179650,0,61341698,0,3080194,0,25,121,2147549184,50462841,
+65657,65536,1048580,65536,24510468,65536,50331652,65536,4587524,65536,1245184,65536,9502765,65536,50397184,65536,67698717,2147483648,67764228,0,67829764,0,67895300,0,67960836,0,68026372,0,68091911,0,68157447,0,68222983,0,64094212,0,68288516,0,68354052,0,
+64421892,0,68419591,0,53215232,0,6160388,0,19,121,2147549184,50462841,65657,65536,1048580,65536,24510468,65536,50331652,65536,4587524,65536,1245184,65536,9502765,65536,50397184,65536,53215232,2147483648,60227613,0,24510466,0,1179650,0,64421890,0,3080192,0,
+68419591,0,68485127,0,51970055,0,68550663,0,14,121,2147549184,50462841,65657,65536,1048580,65536,24510468,65536,50331652,65536,4587524,65536,1245184,65536,9502765,65536,50397184,65536,68616388,2147483648,68681925,0,68747264,0,68812800,0,7995392,0,6,68878340,
+0,57802756,0,24510468,0,68943879,0,69009415,0,69074951,0,3,69140678,0,69206020,0,40239104,0,16,121,2147549184,50462841,65657,65536,1048580,65536,24510468,65536,50331652,65536,4587524,65536,1245184,65536,9502765,65536,50397184,65536,60227613,2147483648,
+49545415,0,55246855,0,57802756,0,69271556,0,6160388,0,23986183,0,3,69337290,0,41615364,0,40239104,0,37,11,2147549184,2097174,65547,65536,1572886,65536,1638423,65536,1703936,65536,1179650,65536,1769474,65536,1835010,65536,1900548,65536,1966084,
+65536,2031637,65536,5177380,2147483648,40435714,0,40501250,0,69402626,0,1179650,0,69468162,0,69533698,0,69599234,0,5701634,0,69664768,0,69730304,0,69795840,0,35651584,0,69861380,0,69926919,0,69992455,0,70057991,0,70123527,0,70189063,
+0,70254599,0,70320159,0,5505057,0,42008611,0,45744227,0,4980736,0,70385865,0,5,203,0,65739,0,1245184,0,1179648,0,7995392,0,3,70451207,0,1179652,0,4587524,0,7,204,0,65740,0,70516765,0,
+6160388,0,70582279,0,4587527,0,70647812,0,179,11,2147549184,2097174,65547,65536,1572886,65536,1638423,65536,1703936,65536,1179650,65536,1769474,65536,1835010,65536,1900548,65536,1966084,65536,2031637,65536,5177380,2147483648,70713549,0,1048578,0,70778882,0,
+70844420,0,70909956,0,70975492,0,71041024,0,2359325,0,71106589,0,71172125,0,71237661,0,71303197,0,5505057,0,37945422,0,71368910,0,71434446,0,71499983,0,131083,0,71565520,0,197197828,2147549184,71631057,197263364,65536,197328900,65536,197394436,
+65536,197459970,65536,197525506,65536,197591042,65536,18284546,65536,197656578,65536,197722114,65536,197787650,65536,197853186,65536,197918724,65536,197984260,65536,198049796,65536,198115332,65536,71696594,2147483648,196619,2147549184,71761934,262155,65536,196619,2147549184,71827470,262155,65536,196619,2147549184,71893006,
+262155,65536,196619,2147549184,71958542,262155,65536,24510468,2147483648,72024068,0,38928457,0,72089600,0,39059460,0,72155140,0,23855111,0,72220679,0,72286215,0,13828103,0,72351751,0,72417287,0,23920647,0,72482823,0,38141959,0,72548359,0,72613895,
+0,72679431,0,72744967,0,72810503,0,72876039,0,55705607,0,72941575,0,17825799,0,73007111,0,73072644,0,1179650,0,73138178,0,73203714,0,73269250,0,73334786,0,73400322,0,73465858,0,73531394,0,73596928,0,73662464,0,73728000,
+0,4587520,0,73793540,0,73859076,0,73924612,0,73990148,0,74055687,0,74121223,0,74186759,0,74252295,0,74317831,0,74383367,0,74448903,0,74514439,0,74579975,0,74645511,0,74711047,0,74776583,0,74842119,0,74907655,0,74973184,
+0,75038720,0,75104258,0,75169794,0,75235330,0,75300864,0,75366400,0,8454146,0,75431936,0,75497472,0,75563015,0,75628551,0,196619,2147549184,75694094,262155,65536,196619,2147549184,75759630,262155,65536,196619,2147549184,75825166,262155,65536,196619,2147549184,
+75890702,262155,65536,75956231,2147483648,29949954,0,76021762,0,47316999,0,76087300,0,76152836,0,76218579,0,76283904,0,18284544,0,76349442,0,76414983,0,196619,2147549184,76480526,262155,65536,196619,2147549184,76546062,262155,65536,196619,2147549184,76611598,262155,65536,
+196619,2147549184,76677134,262155,65536,23593172,2147483648,76742869,0,76808266,0,76873728,0,76939264,0,41615362,0,46727175,0,77004968,0,77070550,0,77136028,0,77201564,0,77266954,0,77332490,0,77398020,0,77463556,0,196619,2147549184,77529102,262155,65536,
+196619,2147549184,77594638,262155,65536,77660174,2147483648,77725911,0,77791448,0,77856775,0,77922348,0,196619,2147549184,77987854,262155,65536,78053580,2147483648,11599898,0,14,217,0,65753,0,2359325,0,55705607,0,23986183,0,55771143,0,55246855,0,1245184,
+0,55836676,0,55902212,0,78118916,0,1048578,0,78184450,0,55967751,0,13,218,0,65754,0,3145757,0,23986183,0,78249991,0,48562183,0,1048578,0,78315520,0,78381056,0,78446596,0,78512291,0,78577668,0,4587524,0,
+41,1179652,0,78643202,0,78708738,0,55246850,0,78774274,0,78839810,0,78905346,0,78970882,0,79036418,0,79101959,0,79167495,0,79233031,0,79298567,0,79364103,0,79429639,0,79495175,0,79560711,0,79626247,0,79691783,0,79757319,
+0,79822855,0,79888391,0,79953927,0,80019463,0,80084999,0,80150535,0,80216071,0,80281607,0,80347143,0,80412679,0,80478215,0,80543751,0,80609287,0,80674823,0,80740359,0,80805895,0,13238329,0,80871643,0,80936967,0,51576836,
+0,81002525,0,6,35848266,0,81068039,0,81133575,0,1179650,0,81199106,0,4587524,0,5,221,0,65757,0,1048580,0,81264644,0,131083,0,10,222,0,65758,0,81330180,0,81395716,0,67764228,0,1179652,0,
+81461259,0,81526795,0,196619,2147549184,81592334,262155,65536,24,149,0,65685,0,1179652,0,81657860,0,81723396,0,81788932,0,81854468,0,81920004,0,81985540,0,82051076,0,4587524,0,81395716,0,29949956,0,82116610,0,3932162,0,
+1245184,0,82182144,0,82247680,0,82313216,0,82378752,0,196619,2147549184,82444302,262155,65536,82510047,2147483648,82575371,0,1,40304647,0,30,1179652,0,82640903,0,82706439,0,82771975,0,82837508,0,82903044,0,82968580,0,83034116,0,83099655,
+0,83165191,0,83230727,0,83296263,0,83361799,0,83427335,0,83492871,0,83558407,0,83623943,0,83689479,0,83755015,0,83820551,0,83886087,0,83951623,0,84017159,0,84082695,0,84148231,0,84213767,0,84279300,0,84344836,0,84410375,
+0,74383367,0,56,81395716,0,84475908,0,84541665,0,84607202,0,4587520,0,84672512,0,84738050,0,84803591,0,84869120,0,84934663,0,85000199,0,85065735,0,85131271,0,85196807,0,85262343,0,85327879,0,85393415,0,85458951,0,
+85524482,0,85590016,0,85655554,0,85721095,0,85786631,0,85852160,0,9764868,0,85917700,0,85983236,0,86048770,0,86114306,0,86180064,0,86245380,0,5636100,0,86310919,0,86376455,0,86441991,0,86507527,0,86573058,0,86638594,0,
+86704130,0,86769666,0,86835202,0,86900738,0,86966274,0,87031810,0,87097571,0,87162887,0,87228423,0,87294101,0,196619,2147549184,56295438,262155,65536,87359562,2147483648,87425244,0,87490567,0,87556103,0,87621639,0,87687172,0,1,87752711,0,
+52,87818407,0,87883780,0,4718596,0,1048578,0,87949314,0,88014850,0,88080386,0,88145927,0,88211458,0,88276994,0,88342535,0,88408066,0,88473602,0,88539143,0,88604679,0,88670215,0,88735748,0,88801284,0,88866820,0,5701636,
+0,88932359,0,88997892,0,89063431,0,89128967,0,89194503,0,89260032,0,89325575,0,89391111,0,5505057,0,89456642,0,89522176,0,89587712,0,89653255,0,89718788,0,89784327,0,89849863,0,89915396,0,1179652,0,89980935,0,90046471,
+0,90112007,0,90177764,0,3735556,0,90243079,0,90308615,0,90374151,0,90439687,0,90505223,0,90570759,0,90636295,0,90701828,0,90767367,0,88,11,2147549184,2097174,65547,65536,1572886,65536,1638423,65536,1703936,65536,1179650,65536,1769474,
+65536,1835010,65536,1900548,65536,1966084,65536,2031637,65536,5177380,2147483648,14090242,0,24576002,0,27131906,0,90832898,0,90898439,0,90963975,0,91029511,0,91095047,0,91160583,0,91226119,0,30474247,0,30605319,0,30539783,0,91291655,0,91357191,
+0,91422727,0,91488263,0,91553799,0,91619335,0,91684871,0,91750402,0,24510466,0,91815938,0,91881474,0,91947010,0,92012546,0,92078082,0,92143618,0,92209159,0,92274695,0,92340231,0,92405767,0,92471303,0,92536839,0,92602375,
+0,92667911,0,92733447,0,92798983,0,92864519,0,92930055,0,92995586,0,93061122,0,93126658,0,93192194,0,93257735,0,93323271,0,93388807,0,93454343,0,93519874,0,93585410,0,93650946,0,93716482,0,93782023,0,93847559,0,93913095,
+0,93978631,0,94044167,0,94109703,0,94175239,0,94240770,0,94306306,0,94371842,0,94437378,0,94502914,0,1179650,0,94568455,0,94633991,0,5505057,0,28377144,0,28442626,0,23789570,0,3080194,0,11599898,0,23461954,0,196619,
+2147549184,37814286,262155,65536,8,230,0,65766,0,73072644,0,94699524,0,1179652,0,94765058,0,94830594,0,13172765,0,13,94896139,0,94961675,0,95027204,0,95092740,0,95158276,0,95223812,0,95289348,0,95354884,0,95420420,0,
+95485956,0,95551492,0,4587524,0,95617024,0,5,95682571,0,95748107,0,95813636,0,5701636,0,95879168,0,17,95944708,0,96010244,0,96075780,0,96141316,0,96206852,0,96272388,0,96337924,0,96403460,0,96468996,0,96534532,0,
+96600068,0,96665604,0,96731138,0,96796674,0,96862212,0,96927748,0,4718596,0,21,1048580,0,96075780,0,96993284,0,97058820,0,97124356,0,97189892,0,97255428,0,97320964,0,97386503,0,97452036,0,97517572,0,6160388,0,97583108,
+0,97648644,0,97714180,0,97779716,0,97845252,0,97910788,0,97976324,0,4718596,0,2031637,0,9,98041860,0,98107399,0,98172935,0,98238471,0,98304004,0,1179650,0,4587522,0,82771975,0,5701639,0,24,236,0,65772,
+0,1245184,0,98369609,0,98435146,0,73072644,0,98500612,0,98566148,0,98631684,0,98697220,0,98762756,0,7733252,0,98828295,0,98893845,0,196619,2147614720,98959597,276824078,262155,131072,24510468,2147549184,98959597,276889604,65536,6160388,65536,276955143,65536,
+277020679,65536,277086215,65536,196619,2147614720,98959597,277151758,262155,131072,7,238,0,65774,0,1245184,0,99024896,0,99090436,0,3080196,0,66060288,0,5,1179650,0,99155968,0,99221504,0,99287040,0,24444928,0,30,99352576,0,18219008,
+0,99418112,0,1179648,0,99483648,0,99549184,0,99614720,0,99680256,0,99745794,0,99811330,0,99876871,0,99942400,0,100007936,0,100073472,0,40239104,0,12648448,0,1179650,2147549184,100139063,99155968,65536,99221504,65536,99287040,65536,24444928,65536,
+1179652,2147549184,100204784,4587524,65536,224198656,65536,224264192,65536,91291655,65536,183894023,65536,224329791,65536,224395275,65536,224460800,2147549184,100270321,42,99352576,2147549184,100335855,18219008,65536,99418112,65536,1179648,65536,99483648,65536,99549184,65536,99614720,65536,99680256,65536,99745794,65536,
+99811330,65536,99876871,65536,99942400,65536,100007936,65536,100073472,65536,40239104,65536,12648448,65536,1179650,2147614720,100335855,100139063,99155968,131072,99221504,131072,99287040,131072,24444928,131072,1179652,2147614720,100335855,100204784,4587524,131072,224198656,131072,224264192,131072,91291655,131072,183894023,131072,
+224329791,131072,224395275,131072,224460800,2147614720,100335855,100270321,2293760,2147483648,42467330,0,54984706,0,74383362,0,1179650,0,100401159,0,100466692,0,100532224,0,100597760,0,100663296,0,24444928,0,100728832,0,308,99352576,2147549184,100335855,18219008,65536,99418112,65536,
+1179648,65536,99483648,65536,99549184,65536,99614720,65536,99680256,65536,99745794,65536,99811330,65536,99876871,65536,99942400,65536,100007936,65536,100073472,65536,40239104,65536,12648448,65536,1179650,2147614720,100335855,100139063,99155968,131072,99221504,131072,99287040,131072,24444928,131072,1179652,2147614720,
+100335855,100204784,4587524,131072,224198656,131072,224264192,131072,91291655,131072,183894023,131072,224329791,131072,224395275,131072,224460800,2147614720,100335855,100270321,100794599,2147483648,100860136,0,95944708,2147549184,100925673,96010244,65536,96075780,65536,96141316,65536,96206852,65536,96272388,65536,96337924,65536,96403460,
+65536,96468996,65536,96534532,65536,96600068,65536,96665604,65536,96731138,65536,96796674,65536,96862212,65536,96927748,65536,4718596,65536,1048580,2147549184,100991210,96075780,65536,96993284,65536,97058820,65536,97124356,65536,97189892,65536,97255428,65536,97320964,65536,97386503,65536,97452036,65536,
+97517572,65536,6160388,65536,97583108,65536,97648644,65536,97714180,65536,97779716,65536,97845252,65536,97910788,65536,97976324,65536,4718596,65536,2031637,65536,57737220,2147483648,9764868,0,85917700,0,101056519,0,101122052,0,101187588,0,101253124,0,101318660,0,1179650,0,
+87883778,0,101384199,0,101449735,0,101515271,0,101580807,0,101646343,0,101711874,0,101777410,0,101842946,0,101908482,0,18219010,0,101974018,0,102039556,0,102105090,0,102170626,0,26214402,0,6946818,0,102236162,0,102301698,0,102367236,0,
+102432772,0,102498306,0,102563842,0,102629380,0,102694916,0,99418114,0,99352578,0,102760450,0,99483650,0,102825986,0,102891520,0,102957056,0,103022596,0,24510468,0,103088132,0,103153666,0,4718594,0,103219202,0,103284738,0,103350274,0,
+103415810,0,103481346,0,103546882,0,524295,2147549184,103612435,589831,65536,655367,65536,720903,65536,524295,2147549184,103677971,589831,65536,655367,65536,720903,65536,524292,2147549184,103743506,589828,65536,655364,65536,720900,65536,196619,2147549184,103809038,262155,65536,103874562,2147483648,
+103940098,0,104005639,0,104071175,0,104136711,0,104202247,0,104267780,0,104333319,0,104398855,0,104464391,0,104529927,0,104595458,0,104660994,0,104726530,0,104792066,0,104857602,0,104923138,0,104988679,0,105054215,0,105119746,0,105185282,0,
+105250823,0,105316359,0,105381888,0,105447428,0,105512962,0,35651586,0,105578496,0,105644039,0,105709575,0,105775104,0,105840640,0,105906176,0,105971712,0,106037252,0,106102786,0,106168322,0,106233858,0,106299394,0,106364935,0,106430471,0,
+106496007,0,106561538,0,106627074,0,106692615,0,106758146,0,106823682,0,106889220,0,106954754,0,107020290,0,107085826,0,107151362,0,107216903,0,5701639,0,107282470,0,107347972,0,107413511,0,107479040,0,99352576,2147614720,107544818,100335855,18219008,131072,
+99418112,131072,1179648,131072,99483648,131072,99549184,131072,99614720,131072,99680256,131072,99745794,131072,99811330,131072,99876871,131072,99942400,131072,100007936,131072,100073472,131072,40239104,131072,12648448,131072,1179650,2147680256,107544818,100335855,100139063,99155968,196608,99221504,196608,99287040,196608,24444928,
+196608,1179652,2147680256,107544818,100335855,100204784,4587524,196608,224198656,196608,224264192,196608,91291655,196608,183894023,196608,224329791,196608,224395275,196608,224460800,2147680256,107544818,100335855,100270321,2293760,2147549184,107544818,42467330,65536,54984706,65536,74383362,65536,1179650,65536,100401159,65536,100466692,65536,
+100532224,65536,100597760,65536,100663296,65536,24444928,65536,100728832,65536,107610116,2147483648,107675650,0,4587522,0,196619,2147549184,12713998,262155,65536,107741186,2147483648,12648450,0,107806722,0,1179652,2147549184,107872319,4390916,65536,222101508,65536,222167044,65536,524295,2147614720,107872319,222232595,
+589831,131072,655367,131072,720903,131072,524295,2147614720,107872319,222298131,589831,131072,655367,131072,720903,131072,81395714,2147614720,107872319,222364205,1179650,131072,91422727,131072,221511687,131072,221577223,131072,221642759,131072,221708295,131072,221774380,131072,221839916,131072,221905452,131072,221970439,131072,
+222035975,131072,81395714,131073,1179650,131073,91422727,131073,221511687,131073,221577223,131073,221642759,131073,221708295,131073,221774380,131073,221839916,131073,221905452,131073,221970439,131073,222035975,131073,81395714,131074,1179650,131074,91422727,131074,221511687,131074,221577223,131074,221642759,131074,221708295,131074,
+221774380,131074,221839916,131074,221905452,131074,221970439,131074,222035975,131074,81395714,131075,1179650,131075,91422727,131075,221511687,131075,221577223,131075,221642759,131075,221708295,131075,221774380,131075,221839916,131075,221905452,131075,221970439,131075,222035975,131075,222429191,2147549184,107872319,222494727,65536,222560263,
+65536,222625799,65536,9,244,0,65780,0,107937792,0,108003330,0,108068866,0,108134402,0,4718594,0,108199943,0,5701639,0,7,52756482,0,24510466,0,54460418,0,108265474,0,108331015,0,5701639,0,108396582,0,5,108462087,0,
+1048576,0,4718592,0,5701632,0,35651584,0,16,108527623,0,108593159,0,108658695,0,108724231,0,108789767,0,108855303,0,108920839,0,108986375,0,109051911,0,109117447,0,109182980,0,109248519,0,109314055,0,109379584,0,4718592,0,5701634,
+0,64,108462087,2147549184,109445366,1048576,65536,4718592,65536,5701632,65536,35651584,65536,109510658,2147483648,101777410,0,101842946,0,101908482,0,18219010,0,101974018,0,109576194,0,109641730,0,109707266,0,37552130,0,52756482,2147549184,109773045,24510466,65536,54460418,65536,
+108265474,65536,108331015,65536,5701639,65536,108396582,65536,109838338,2147483648,102105090,0,109903879,0,108527623,2147549184,109969655,108593159,65536,108658695,65536,108724231,65536,108789767,65536,108855303,65536,108920839,65536,108986375,65536,109051911,65536,109117447,65536,109182980,65536,109248519,65536,109314055,
+65536,109379584,65536,4718592,65536,5701634,65536,91619335,2147483648,91684871,0,1179652,0,24510466,0,110034946,0,91815938,0,91881474,0,110100482,0,110166018,0,91947010,0,92012546,0,92078082,0,92143618,0,110231554,0,110297090,0,110362631,0,110428167,
+0,110493703,0,110559239,0,110624770,0,5701634,0,110690308,0,25952260,0,6,249,0,65785,0,81330180,0,1245184,0,1179652,0,110755869,0,10,65011963,0,110821628,0,110886975,0,110952459,0,111017984,0,6160388,0,111083524,
+0,111149060,0,111214599,0,5701636,0,22,65011963,2147549184,111280378,110821628,65536,110886975,65536,110952459,65536,111017984,65536,6160388,65536,111083524,65536,111149060,65536,111214599,65536,5701636,65536,1179650,2147483648,111345666,0,111411202,0,111476738,0,111542274,0,24510468,
+0,111607819,0,111673395,0,111738931,0,64946227,0,111804423,0,111869959,0,6,6946818,0,81657858,0,111935490,0,52297730,0,1179652,0,51183623,0,56,1179650,0,112001026,0,112066562,0,112132098,0,6946818,2147549184,112197886,81657858,65536,
+111935490,65536,52297730,65536,1179652,65536,51183623,65536,6946818,65537,81657858,65537,111935490,65537,52297730,65537,1179652,65537,51183623,65537,6946818,65538,81657858,65538,111935490,65538,52297730,65538,1179652,65538,51183623,65538,6946818,65539,81657858,65539,111935490,65539,52297730,65539,
+1179652,65539,51183623,65539,6946818,65540,81657858,65540,111935490,65540,52297730,65540,1179652,65540,51183623,65540,6946818,65541,81657858,65541,111935490,65541,52297730,65541,1179652,65541,51183623,65541,6946818,65542,81657858,65542,111935490,65542,52297730,65542,1179652,65542,51183623,65542,
+111607819,2147483648,112263175,0,3932167,0,112328708,0,112394244,0,112459780,0,112525316,0,9502765,0,13172765,0,112590877,0,19,65011963,2147549184,111280378,110821628,65536,110886975,65536,110952459,65536,111017984,65536,6160388,65536,111083524,65536,111149060,65536,111214599,65536,
+5701636,65536,6160388,2147483648,112656388,0,112721927,0,112787460,0,112852999,0,112918535,0,112984071,0,4587527,0,113049629,0,10,65011963,2147549184,111280378,110821628,65536,110886975,65536,110952459,65536,111017984,65536,6160388,65536,111083524,65536,111149060,65536,111214599,65536,
+5701636,65536,16,65011963,2147549184,111280378,110821628,65536,110886975,65536,110952459,65536,111017984,65536,6160388,65536,111083524,65536,111149060,65536,111214599,65536,5701636,65536,1179650,2147483648,4587522,0,17301508,0,113115140,0,113180771,0,111607819,0,3,6946818,0,1179650,
+0,51183623,0,38,6946818,2147549184,113246467,1179650,65536,51183623,65536,6946818,65537,1179650,65537,51183623,65537,6946818,65538,1179650,65538,51183623,65538,6946818,65539,1179650,65539,51183623,65539,6946818,65540,1179650,65540,51183623,65540,6946818,65541,1179650,65541,51183623,
+65541,6946818,65542,1179650,65542,51183623,65542,6946818,65543,1179650,65543,51183623,65543,6946818,65544,1179650,65544,51183623,65544,6946818,65545,1179650,65545,51183623,65545,6946818,65546,1179650,65546,51183623,65546,111607819,2147483648,112132100,0,1179652,0,113311748,0,30998535,
+0,7,1179650,0,1048576,0,39976960,0,40042503,0,40108039,0,40173575,0,113377343,0,5,262,0,65798,0,1245184,0,113442823,0,4587524,0,28,6946820,0,113508359,0,30998535,0,39518215,0,113573895,0,113639431,0,
+1179652,0,113704967,0,113770503,0,113836036,0,113901575,0,113967108,0,114032647,0,114098183,0,114163716,0,114229255,0,114294784,0,114360320,0,114425856,0,114491392,0,114556935,0,114622468,0,114688007,0,114753543,0,114819079,0,114884615,0,
+114950151,0,115015944,0,13,115081216,0,1179648,0,115146752,0,115212288,0,115277824,0,4587520,0,115343362,0,115408903,0,115474439,0,115539975,0,115605511,0,115671047,0,115736583,0,13,1048576,0,115802112,0,115867648,0,115933191,0,
+115998727,0,116064263,0,116129799,0,116195328,0,116260864,0,116326407,0,116391943,0,116457479,0,116523015,0,258,116588802,0,116654338,0,70713600,0,116719873,0,116785159,0,116850695,0,116916231,0,116981762,0,112328706,0,117047296,0,117112832,
+0,117178368,0,117243904,0,117309447,0,117374978,0,117440512,0,117506048,0,117571584,0,117637120,0,117702656,0,117768192,0,6946818,2147614720,117833988,113246467,1179650,131072,51183623,131072,6946818,131073,1179650,131073,51183623,131073,6946818,131074,1179650,131074,51183623,
+131074,6946818,131075,1179650,131075,51183623,131075,6946818,131076,1179650,131076,51183623,131076,6946818,131077,1179650,131077,51183623,131077,6946818,131078,1179650,131078,51183623,131078,6946818,131079,1179650,131079,51183623,131079,6946818,131080,1179650,131080,51183623,131080,6946818,131081,1179650,
+131081,51183623,131081,6946818,131082,1179650,131082,51183623,131082,111607819,2147549184,117833988,112132100,65536,1179652,65536,113311748,65536,30998535,65536,1179650,2147549184,117899525,1048576,65536,39976960,65536,40042503,65536,40108039,65536,40173575,65536,113377343,65536,196619,2147549184,117964814,262155,65536,
+65011963,2147614720,118030589,111280378,110821628,131072,110886975,131072,110952459,131072,111017984,131072,6160388,131072,111083524,131072,111149060,131072,111214599,131072,5701636,131072,1179650,2147549184,118030589,111345666,65536,111411202,65536,111476738,65536,111542274,65536,24510468,65536,111607819,65536,111673395,65536,111738931,
+65536,64946227,65536,111804423,65536,111869959,65536,1179650,2147549184,118096127,112001026,65536,112066562,65536,112132098,65536,6946818,2147614720,118096127,112197886,81657858,131072,111935490,131072,52297730,131072,1179652,131072,51183623,131072,6946818,131073,81657858,131073,111935490,131073,52297730,131073,1179652,131073,
+51183623,131073,6946818,131074,81657858,131074,111935490,131074,52297730,131074,1179652,131074,51183623,131074,6946818,131075,81657858,131075,111935490,131075,52297730,131075,1179652,131075,51183623,131075,6946818,131076,81657858,131076,111935490,131076,52297730,131076,1179652,131076,51183623,131076,6946818,131077,
+81657858,131077,111935490,131077,52297730,131077,1179652,131077,51183623,131077,6946818,131078,81657858,131078,111935490,131078,52297730,131078,1179652,131078,51183623,131078,111607819,2147549184,118096127,112263175,65536,3932167,65536,112328708,65536,112394244,65536,112459780,65536,112525316,65536,9502765,65536,13172765,
+65536,112590877,65536,118161415,2147483648,118226951,0,118292482,0,118358018,0,118423552,0,118489088,0,118554626,0,118620167,0,118685703,0,118751239,0,118816775,0,118882311,0,118947847,0,119013383,0,119078919,0,119144455,0,119209991,0,119275522,0,119341056,
+0,119406592,0,119472128,0,119537664,0,119603229,0,119668736,0,119734272,0,119799808,0,119865344,0,119930880,0,119996416,0,120061952,0,120127488,0,120193024,0,120258560,0,120324096,0,120389632,0,120455170,0,120520706,0,120586242,0,120651778,
+0,120717312,0,120782848,0,120848384,0,120913920,0,120979456,0,121044992,0,121110528,0,121176064,0,121241600,0,121307136,0,121372676,0,121438212,0,121503748,0,121569284,0,121634818,0,25952258,0,121700356,0,121765895,0,121831431,0,6946820,
+2147549184,121897223,113508359,65536,30998535,65536,39518215,65536,113573895,65536,113639431,65536,1179652,65536,113704967,65536,113770503,65536,113836036,65536,113901575,65536,113967108,65536,114032647,65536,114098183,65536,114163716,65536,114229255,65536,114294784,65536,114360320,65536,114425856,65536,114491392,65536,
+114556935,65536,114622468,65536,114688007,65536,114753543,65536,114819079,65536,114884615,65536,114950151,65536,115015944,65536,115081216,2147549184,121962761,1179648,65536,115146752,65536,115212288,65536,115277824,65536,4587520,65536,115343362,65536,115408903,65536,115474439,65536,115539975,65536,115605511,65536,115671047,
+65536,115736583,65536,1048576,2147549184,122028298,115802112,65536,115867648,65536,115933191,65536,115998727,65536,116064263,65536,116129799,65536,116195328,65536,116260864,65536,116326407,65536,116391943,65536,116457479,65536,116523015,65536,8,122093572,0,122159108,0,122224644,0,122290180,0,122355716,
+0,122421252,0,3735556,0,46399492,0,4,122486791,0,122552320,0,122617856,0,1179650,0,4,122683399,0,1179652,0,122748932,0,3932164,0,4,122814471,0,122880007,0,122945543,0,123011079,0,464,11,2147549184,2097174,65547,65536,
+1572886,65536,1638423,65536,1703936,65536,1179650,65536,1769474,65536,1835010,65536,1900548,65536,1966084,65536,2031637,65536,5177380,2147483648,110755869,0,123076837,0,123142189,0,196619,2147549184,123207694,262155,65536,123273446,2147483648,123338781,0,123404295,0,123469831,0,123535367,
+0,123600903,0,73072644,0,123666436,0,123731972,0,1179650,0,23789568,0,17563648,0,23461954,0,123797776,0,123863307,0,123928849,0,122814471,2147549184,123994383,122880007,65536,122945543,65536,123011079,65536,99352576,2147614720,14418163,100335855,18219008,131072,99418112,131072,
+1179648,131072,99483648,131072,99549184,131072,99614720,131072,99680256,131072,99745794,131072,99811330,131072,99876871,131072,99942400,131072,100007936,131072,100073472,131072,40239104,131072,12648448,131072,1179650,2147680256,14418163,100335855,100139063,99155968,196608,99221504,196608,99287040,196608,24444928,196608,1179652,
+2147680256,14418163,100335855,100204784,4587524,196608,224198656,196608,224264192,196608,91291655,196608,183894023,196608,224329791,196608,224395275,196608,224460800,2147680256,14418163,100335855,100270321,100794599,2147549184,14418163,100860136,65536,95944708,2147614720,14418163,100925673,96010244,131072,96075780,131072,96141316,131072,96206852,131072,
+96272388,131072,96337924,131072,96403460,131072,96468996,131072,96534532,131072,96600068,131072,96665604,131072,96731138,131072,96796674,131072,96862212,131072,96927748,131072,4718596,131072,1048580,2147614720,14418163,100991210,96075780,131072,96993284,131072,97058820,131072,97124356,131072,97189892,131072,97255428,131072,
+97320964,131072,97386503,131072,97452036,131072,97517572,131072,6160388,131072,97583108,131072,97648644,131072,97714180,131072,97779716,131072,97845252,131072,97910788,131072,97976324,131072,4718596,131072,2031637,131072,57737220,2147549184,14418163,9764868,65536,85917700,65536,101056519,65536,101122052,65536,101187588,
+65536,101253124,65536,101318660,65536,1179650,65536,87883778,65536,101384199,65536,101449735,65536,101515271,65536,101580807,65536,101646343,65536,101711874,65536,101777410,65536,101842946,65536,101908482,65536,18219010,65536,101974018,65536,102039556,65536,102105090,65536,102170626,65536,26214402,65536,6946818,
+65536,102236162,65536,102301698,65536,102367236,65536,102432772,65536,102498306,65536,102563842,65536,102629380,65536,102694916,65536,99418114,65536,99352578,65536,102760450,65536,99483650,65536,102825986,65536,102891520,65536,102957056,65536,103022596,65536,24510468,65536,103088132,65536,103153666,65536,4718594,
+65536,103219202,65536,103284738,65536,103350274,65536,103415810,65536,103481346,65536,103546882,65536,524295,2147614720,14418163,103612435,589831,131072,655367,131072,720903,131072,524295,2147614720,14418163,103677971,589831,131072,655367,131072,720903,131072,524292,2147614720,14418163,103743506,589828,131072,655364,
+131072,720900,131072,196619,2147614720,14418163,103809038,262155,131072,103874562,2147549184,14418163,103940098,65536,104005639,65536,104071175,65536,104136711,65536,104202247,65536,104267780,65536,104333319,65536,104398855,65536,104464391,65536,104529927,65536,104595458,65536,104660994,65536,104726530,65536,104792066,65536,
+104857602,65536,104923138,65536,104988679,65536,105054215,65536,105119746,65536,105185282,65536,105250823,65536,105316359,65536,105381888,65536,105447428,65536,105512962,65536,35651586,65536,105578496,65536,105644039,65536,105709575,65536,105775104,65536,105840640,65536,105906176,65536,105971712,65536,106037252,65536,
+106102786,65536,106168322,65536,106233858,65536,106299394,65536,106364935,65536,106430471,65536,106496007,65536,106561538,65536,106627074,65536,106692615,65536,106758146,65536,106823682,65536,106889220,65536,106954754,65536,107020290,65536,107085826,65536,107151362,65536,107216903,65536,5701639,65536,107282470,65536,
+107347972,65536,107413511,65536,107479040,65536,99352576,2147680256,14418163,107544818,100335855,18219008,196608,99418112,196608,1179648,196608,99483648,196608,99549184,196608,99614720,196608,99680256,196608,99745794,196608,99811330,196608,99876871,196608,99942400,196608,100007936,196608,100073472,196608,40239104,196608,12648448,
+196608,1179650,2147745792,14418163,107544818,100335855,100139063,99155968,262144,99221504,262144,99287040,262144,24444928,262144,1179652,2147745792,14418163,107544818,100335855,100204784,4587524,262144,224198656,262144,224264192,262144,91291655,262144,183894023,262144,224329791,262144,224395275,262144,224460800,2147745792,14418163,107544818,100335855,
+100270321,2293760,2147614720,14418163,107544818,42467330,131072,54984706,131072,74383362,131072,1179650,131072,100401159,131072,100466692,131072,100532224,131072,100597760,131072,100663296,131072,24444928,131072,100728832,131072,107610116,2147549184,14418163,107675650,65536,4587522,65536,196619,2147614720,14418163,12713998,262155,131072,
+107741186,2147549184,14418163,12648450,65536,107806722,65536,1179652,2147614720,14418163,107872319,4390916,131072,222101508,131072,222167044,131072,524295,2147680256,14418163,107872319,222232595,589831,196608,655367,196608,720903,196608,524295,2147680256,14418163,107872319,222298131,589831,196608,655367,196608,720903,196608,81395714,
+2147680256,14418163,107872319,222364205,1179650,196608,91422727,196608,221511687,196608,221577223,196608,221642759,196608,221708295,196608,221774380,196608,221839916,196608,221905452,196608,221970439,196608,222035975,196608,81395714,196609,1179650,196609,91422727,196609,221511687,196609,221577223,196609,221642759,196609,221708295,196609,
+221774380,196609,221839916,196609,221905452,196609,221970439,196609,222035975,196609,81395714,196610,1179650,196610,91422727,196610,221511687,196610,221577223,196610,221642759,196610,221708295,196610,221774380,196610,221839916,196610,221905452,196610,221970439,196610,222035975,196610,81395714,196611,1179650,196611,91422727,196611,
+221511687,196611,221577223,196611,221642759,196611,221708295,196611,221774380,196611,221839916,196611,221905452,196611,221970439,196611,222035975,196611,222429191,2147614720,14418163,107872319,222494727,131072,222560263,131072,222625799,131072,98041860,2147549184,124059883,98107399,65536,98172935,65536,98238471,65536,98304004,65536,1179650,
+65536,4587522,65536,82771975,65536,5701639,65536,196619,2147549184,124125198,262155,65536,196619,2147549184,124190734,262155,65536,124256267,2147483648,124321803,0,124387339,0,124452875,0,124518411,0,124584210,0,124649483,0,124715283,0,124780546,0,35651586,0,124846084,0,196619,
+2147549184,124911630,262155,65536,108462087,2147549184,109445366,1048576,65536,4718592,65536,5701632,65536,35651584,65536,108462087,2147614720,124977400,109445366,1048576,131072,4718592,131072,5701632,131072,35651584,131072,109510658,2147549184,124977400,101777410,65536,101842946,65536,101908482,65536,18219010,65536,101974018,65536,
+109576194,65536,109641730,65536,109707266,65536,37552130,65536,52756482,2147614720,124977400,109773045,24510466,131072,54460418,131072,108265474,131072,108331015,131072,5701639,131072,108396582,131072,109838338,2147549184,124977400,102105090,65536,109903879,65536,108527623,2147614720,124977400,109969655,108593159,131072,108658695,131072,108724231,
+131072,108789767,131072,108855303,131072,108920839,131072,108986375,131072,109051911,131072,109117447,131072,109182980,131072,109248519,131072,109314055,131072,109379584,131072,4718592,131072,5701634,131072,91619335,2147549184,124977400,91684871,65536,1179652,65536,24510466,65536,110034946,65536,91815938,65536,91881474,65536,
+110100482,65536,110166018,65536,91947010,65536,92012546,65536,92078082,65536,92143618,65536,110231554,65536,110297090,65536,110362631,65536,110428167,65536,110493703,65536,110559239,65536,110624770,65536,5701634,65536,110690308,65536,25952260,65536,122486791,2147549184,125042957,122552320,65536,122617856,65536,1179650,
+65536,71565520,2147483648,122683399,2147549184,125108494,1179652,65536,122748932,65536,3932164,65536,125174036,2147483648,77332490,0,125239306,0,1179652,2147549184,100204784,4587524,65536,224198656,65536,224264192,65536,91291655,65536,183894023,65536,224329791,65536,224395275,65536,224460800,2147549184,100270321,1245184,2147549184,
+125304886,125370645,2147483648,11599898,0,31,278,0,65814,0,17694771,0,9502765,2147549184,23396396,9568260,65536,9633796,65536,9699332,65536,9764868,65536,9830400,65536,9895936,65536,9961472,65536,10027008,65536,10092546,65536,4587522,65536,10158082,65536,10223618,65536,10289154,
+65536,1179650,65536,125174036,2147483648,9568260,2147549184,125436183,134217730,65536,261292034,65536,43515911,2147483648,43581447,0,6946823,0,125501447,0,125566983,0,10223618,0,1179650,0,10813442,0,51314688,0,42,125632519,0,125698055,0,125763591,0,125829127,0,125894663,
+0,125960199,0,126025735,0,126091271,0,126156807,0,126222343,0,126287950,0,126353688,0,126419225,0,126484762,0,126550027,0,126615835,0,126681372,0,126746631,0,126812167,0,24969223,0,126877703,0,126943239,0,127008775,0,13762567,0,127074311,
+0,127139840,0,127205376,0,10223616,0,127270912,0,127336448,0,24444928,0,127401991,0,127467522,0,127533058,0,127598599,0,127664130,0,127729666,0,127795207,0,127860743,0,127926279,0,127991815,0,128057629,0,76,287,0,65823,0,
+196619,2147549184,128122894,262155,65536,128188420,2147483648,128253959,0,128319490,0,126812167,0,24969223,0,128385031,0,128450560,0,24444928,0,128516100,0,128581636,0,127205378,0,10223618,0,110755869,0,128647197,0,524295,2147549184,128712723,589831,65536,655367,65536,
+720903,65536,196619,2147549184,128778254,262155,65536,128844054,2147483648,126353694,0,128909312,0,73072644,0,123666436,0,128974850,0,129040386,0,129105922,0,129171458,0,1179650,0,38993922,0,8716295,0,129236999,0,129302535,0,129368071,0,13762567,0,123404295,
+0,129433602,0,129499138,0,129564674,0,129630208,0,129695744,0,129761280,0,129826816,0,129892354,0,196619,2147549184,129957902,262155,65536,196619,2147549184,130023438,262155,65536,196619,2147549184,130088974,262155,65536,130154496,2147483648,47382528,0,130220032,0,10027008,0,
+130285568,0,7798823,2147549184,130351145,7864360,65536,7929856,65536,7995392,65536,130416651,2147483648,130482249,0,71565520,0,130547714,0,130613248,0,103284736,0,130678791,0,130744327,0,130809863,0,130875394,0,4718594,0,5701639,0,41,524295,2147549184,17301523,589831,
+65536,655367,65536,720903,65536,524295,2147549184,4390931,589831,65536,655367,65536,720903,65536,524292,2147549184,130940946,589828,65536,655364,65536,720900,65536,524292,2147549184,131006482,589828,65536,655364,65536,720900,65536,524292,2147549184,131072018,589828,65536,655364,65536,720900,
+65536,131137543,2147483648,131203079,0,131268615,0,131334151,0,131399682,0,131465218,0,131530754,0,131596290,0,131661826,0,1179650,0,131727362,0,131792898,0,131858434,0,131923970,0,131989506,0,129171458,0,132055047,0,132120580,0,132186116,0,126615841,
+0,126681372,0,7,287,0,65823,0,196619,2147549184,128122894,262155,65536,128188420,2147483648,128253959,0,128319490,0,9,287,0,65823,0,196619,2147549184,128122894,262155,65536,128188420,2147483648,128253959,0,128319490,0,132251648,0,7995392,0,63,
+287,0,65823,0,196619,2147549184,128122894,262155,65536,128188420,2147483648,128253959,0,128319490,0,524295,2147614720,132317472,17301523,589831,131072,655367,131072,720903,131072,524295,2147614720,132317472,4390931,589831,131072,655367,131072,720903,131072,524292,2147614720,132317472,130940946,589828,
+131072,655364,131072,720900,131072,524292,2147614720,132317472,131006482,589828,131072,655364,131072,720900,131072,524292,2147614720,132317472,131072018,589828,131072,655364,131072,720900,131072,131137543,2147549184,132317472,131203079,65536,131268615,65536,131334151,65536,131399682,65536,131465218,65536,131530754,65536,
+131596290,65536,131661826,65536,1179650,65536,131727362,65536,131792898,65536,131858434,65536,131923970,65536,131989506,65536,129171458,65536,132055047,65536,132120580,65536,132186116,65536,126615841,65536,126681372,65536,132382722,2147483648,132448258,0,132513794,0,132579330,0,131727362,0,132644866,0,
+132710402,0,132775938,0,1179648,0,7995392,0,132841483,0,132907012,0,132972548,0,133038102,0,133103627,0,62,287,0,65823,0,196619,2147549184,128122894,262155,65536,128188420,2147483648,128253959,0,128319490,0,524295,2147614720,132317472,17301523,589831,131072,
+655367,131072,720903,131072,524295,2147614720,132317472,4390931,589831,131072,655367,131072,720903,131072,524292,2147614720,132317472,130940946,589828,131072,655364,131072,720900,131072,524292,2147614720,132317472,131006482,589828,131072,655364,131072,720900,131072,524292,2147614720,132317472,131072018,589828,131072,
+655364,131072,720900,131072,131137543,2147549184,132317472,131203079,65536,131268615,65536,131334151,65536,131399682,65536,131465218,65536,131530754,65536,131596290,65536,131661826,65536,1179650,65536,131727362,65536,131792898,65536,131858434,65536,131923970,65536,131989506,65536,129171458,65536,132055047,65536,132120580,
+65536,132186116,65536,126615841,65536,126681372,65536,196619,2147549184,133169166,262155,65536,133234981,2147483648,133300224,0,1048578,2147549184,133366054,186515458,65536,1179650,65536,186580994,65536,142606358,65536,1179650,2147483648,133431298,0,133496834,0,133562370,0,133627915,0,58,287,0,
+65823,0,196619,2147549184,128122894,262155,65536,128188420,2147483648,128253959,0,128319490,0,524295,2147614720,132317472,17301523,589831,131072,655367,131072,720903,131072,524295,2147614720,132317472,4390931,589831,131072,655367,131072,720903,131072,524292,2147614720,132317472,130940946,589828,131072,655364,
+131072,720900,131072,524292,2147614720,132317472,131006482,589828,131072,655364,131072,720900,131072,524292,2147614720,132317472,131072018,589828,131072,655364,131072,720900,131072,131137543,2147549184,132317472,131203079,65536,131268615,65536,131334151,65536,131399682,65536,131465218,65536,131530754,65536,131596290,65536,
+131661826,65536,1179650,65536,131727362,65536,131792898,65536,131858434,65536,131923970,65536,131989506,65536,129171458,65536,132055047,65536,132120580,65536,132186116,65536,126615841,65536,126681372,65536,133693736,2147483648,196619,2147549184,133758990,262155,65536,24510466,2147483648,133824514,0,1179652,0,133890055,
+0,133955591,0,129171460,0,4587524,0,52,287,0,65823,0,196619,2147549184,128122894,262155,65536,128188420,2147483648,128253959,0,128319490,0,133824514,0,1179650,0,4587524,0,133693736,0,524295,2147614720,132317472,17301523,589831,131072,655367,131072,720903,
+131072,524295,2147614720,132317472,4390931,589831,131072,655367,131072,720903,131072,524292,2147614720,132317472,130940946,589828,131072,655364,131072,720900,131072,524292,2147614720,132317472,131006482,589828,131072,655364,131072,720900,131072,524292,2147614720,132317472,131072018,589828,131072,655364,131072,720900,
+131072,131137543,2147549184,132317472,131203079,65536,131268615,65536,131334151,65536,131399682,65536,131465218,65536,131530754,65536,131596290,65536,131661826,65536,1179650,65536,131727362,65536,131792898,65536,131858434,65536,131923970,65536,131989506,65536,129171458,65536,132055047,65536,132120580,65536,132186116,65536,
+126615841,65536,126681372,65536,3,298,0,65834,0,134021127,0,51,287,0,65823,0,196619,2147549184,128122894,262155,65536,128188420,2147483648,128253959,0,524295,2147614720,132317472,17301523,589831,131072,655367,131072,720903,131072,524295,2147614720,132317472,4390931,589831,
+131072,655367,131072,720903,131072,524292,2147614720,132317472,130940946,589828,131072,655364,131072,720900,131072,524292,2147614720,132317472,131006482,589828,131072,655364,131072,720900,131072,524292,2147614720,132317472,131072018,589828,131072,655364,131072,720900,131072,131137543,2147549184,132317472,131203079,65536,
+131268615,65536,131334151,65536,131399682,65536,131465218,65536,131530754,65536,131596290,65536,131661826,65536,1179650,65536,131727362,65536,131792898,65536,131858434,65536,131923970,65536,131989506,65536,129171458,65536,132055047,65536,132120580,65536,132186116,65536,126615841,65536,126681372,65536,196619,2147549184,
+134086670,262155,65536,134152196,2147483648,1179652,0,69,287,0,65823,0,196619,2147549184,128122894,262155,65536,128188420,2147483648,128253959,0,128319490,0,524295,2147614720,132317472,17301523,589831,131072,655367,131072,720903,131072,524295,2147614720,132317472,4390931,589831,131072,655367,
+131072,720903,131072,524292,2147614720,132317472,130940946,589828,131072,655364,131072,720900,131072,524292,2147614720,132317472,131006482,589828,131072,655364,131072,720900,131072,524292,2147614720,132317472,131072018,589828,131072,655364,131072,720900,131072,131137543,2147549184,132317472,131203079,65536,131268615,65536,
+131334151,65536,131399682,65536,131465218,65536,131530754,65536,131596290,65536,131661826,65536,1179650,65536,131727362,65536,131792898,65536,131858434,65536,131923970,65536,131989506,65536,129171458,65536,132055047,65536,132120580,65536,132186116,65536,126615841,65536,126681372,65536,43515911,2147483648,43581447,0,
+132382722,0,134217730,0,134283266,0,134348802,0,1179652,0,134414343,0,10223620,0,134479876,0,134545412,0,4587524,0,71565520,0,184156221,2147549184,134611245,184221757,65536,184287293,65536,184352829,65536,184418365,65536,184483901,65536,10027008,2147483648,134676480,0,5,
+134742319,0,134545408,0,134807552,0,134873088,0,134938624,0,23,135004160,0,135069696,0,135135232,0,135200768,0,135266304,0,135331840,0,135397376,0,135462912,0,135528452,0,135593988,0,135659524,0,135725060,0,135790596,0,135856130,0,4587522,
+0,1048578,0,1179650,0,135921666,0,135987202,0,31784964,0,136052738,0,136118274,0,136183808,0,18,287,0,65823,0,196619,2147549184,128122894,262155,65536,128188420,2147483648,136249348,0,136315184,0,136380722,0,136445966,0,136511502,0,136577331,
+0,136642844,0,136708380,0,136773940,0,136839170,0,136904706,0,136970242,0,137035778,0,6,309,0,132841472,0,137101312,0,137166850,0,137232386,0,3080194,0,3,137297924,0,137363460,0,137428996,0,3,137494838,0,137560068,0,
+4587524,0,10,312,0,65848,0,137625600,0,95748107,0,137691140,0,6946826,0,53477385,0,137756672,0,137822208,0,137887744,0,9,313,0,65849,0,137691140,0,6094848,0,137953280,0,196619,2147549184,138018830,262155,65536,138084356,
+2147483648,138149892,0,19,314,0,65850,0,137691140,0,6094848,0,137953280,0,138215736,0,138280964,0,138346500,0,138412032,0,138477579,0,53805117,0,138543104,0,138608644,0,138674178,0,6160386,0,196619,2147549184,138739726,262155,65536,138805252,
+2147483648,138870788,0,7,196619,2147549184,138936334,262155,65536,139001860,2147483648,139067396,0,139132932,0,139198468,0,139264000,0,88,287,0,65823,0,196619,2147549184,128122894,262155,65536,128188420,2147483648,1179652,0,53805107,0,9502765,2147549184,23396396,9568260,65536,
+9633796,65536,9699332,65536,9764868,65536,9830400,65536,9895936,65536,9961472,65536,10027008,65536,10092546,65536,4587522,65536,10158082,65536,10223618,65536,10289154,65536,1179650,65536,9961476,2147549184,134611261,223150084,65536,223215620,65536,223281159,65536,223346692,65536,223412231,65536,223477767,
+65536,223543300,65536,223608839,65536,223674372,65536,223739911,65536,201195524,2147614720,134611261,223805758,222691332,131072,222756871,131072,222822407,131072,222887943,131072,222953479,131072,223019015,131072,589831,131072,720903,131072,24510466,131072,1179650,131072,54984708,131072,223084551,131072,223870983,2147549184,134611261,
+223936519,65536,224002055,65536,224067591,65536,224133124,65536,4587524,65536,201195524,2147549184,139329854,222691332,65536,222756871,65536,222822407,65536,222887943,65536,222953479,65536,223019015,65536,589831,65536,720903,65536,24510466,65536,1179650,65536,54984708,65536,223084551,65536,71565520,2147483648,139395079,
+0,43515911,0,43581447,0,134414343,0,139460615,0,139526151,0,24510464,0,139591680,0,4587522,0,139657218,0,139722754,0,139788288,0,139853824,0,139919360,0,129171456,0,139984900,0,5701636,0,134742319,2147549184,140050734,134545408,65536,134807552,65536,
+134873088,65536,134938624,65536,40,287,0,65823,0,196619,2147549184,128122894,262155,65536,128188420,2147483648,128253959,0,128319490,0,140116006,0,140181508,0,140247044,0,6160386,0,140312578,0,140378114,0,140443648,0,140509184,0,140574724,0,140640260,0,
+140705796,0,140771330,0,140836866,0,140902402,0,140967938,0,141033479,0,524292,2147549184,141099026,589828,65536,655364,65536,720900,65536,524292,2147549184,141164562,589828,65536,655364,65536,720900,65536,141230084,2147483648,141295620,0,141361152,0,141426688,0,141492226,0,
+141557762,0,40239104,0,141623307,0,141688839,0,20,11,2147549184,2097174,65547,65536,1572886,65536,1638423,65536,1703936,65536,1179650,65536,1769474,65536,1835010,65536,1900548,65536,1966084,65536,2031637,65536,141754379,2147483648,141819915,0,141885451,0,141950987,0,
+142016523,0,6160388,0,142082052,0,142147584,0,142213120,0,11,287,0,65823,0,196619,2147549184,128122894,262155,65536,128188420,2147483648,128253959,0,142278976,0,6160386,0,140312578,0,4718596,0,142344203,0,7,322,0,65858,0,23461954,
+0,52690948,2147549184,142410051,4587524,2147483648,142475271,0,142540800,0,74,287,0,65823,0,196619,2147549184,128122894,262155,65536,128188420,2147483648,128253959,0,128319490,0,524295,2147614720,132317472,17301523,589831,131072,655367,131072,720903,131072,524295,2147614720,132317472,4390931,
+589831,131072,655367,131072,720903,131072,524292,2147614720,132317472,130940946,589828,131072,655364,131072,720900,131072,524292,2147614720,132317472,131006482,589828,131072,655364,131072,720900,131072,524292,2147614720,132317472,131072018,589828,131072,655364,131072,720900,131072,131137543,2147549184,132317472,131203079,
+65536,131268615,65536,131334151,65536,131399682,65536,131465218,65536,131530754,65536,131596290,65536,131661826,65536,1179650,65536,131727362,65536,131792898,65536,131858434,65536,131923970,65536,131989506,65536,129171458,65536,132055047,65536,132120580,65536,132186116,65536,126615841,65536,126681372,65536,142606358,
+2147483648,5570582,0,1179650,0,4718594,0,142671879,0,5701639,0,43515911,0,43581447,0,134414343,0,139395079,0,196619,2147549184,142737422,262155,65536,23461954,2147483648,142803010,0,142868480,0,142934020,0,35651588,0,142999554,0,143065090,0,18284546,0,
+143130624,0,103284736,0,196619,2147549184,143196174,262155,65536,143262021,2147483648,71565520,0,11,287,0,65823,0,196619,2147549184,128122894,262155,65536,128188420,2147483648,128253959,0,128319490,0,1179650,0,73531394,0,4587524,0,71565520,0,7,327,0,
+65863,0,143327236,0,1441796,0,5898240,0,143392772,0,1048580,0,17,287,0,65823,0,196619,2147549184,128122894,262155,65536,128188420,2147483648,128253959,0,128319490,0,140378116,0,4587524,0,196619,2147549184,143458318,262155,65536,196619,2147549184,143523854,
+262155,65536,143589376,2147483648,143654912,0,143720452,0,143785988,0,8,287,0,65823,0,196619,2147549184,128122894,262155,65536,128188420,2147483648,24444928,0,143851520,0,143917056,0,55,287,0,65823,0,196619,2147549184,128122894,262155,65536,128188420,2147483648,
+43515911,0,43581447,0,143982599,0,144048135,0,134414343,0,9568260,2147549184,144113943,134217730,65536,261292034,65536,125174036,2147483648,9961474,2147549184,134611275,261816322,65536,261881860,65536,261947396,65536,262012932,65536,263454727,2147614720,134611275,262079103,263520263,131072,263585799,131072,263651335,131072,
+9568260,131072,1179652,131072,262144061,2147549184,134611275,262209597,65536,262275079,65536,262340610,65536,262406146,65536,9568260,65536,71107200,65536,262472319,65536,262537223,65536,1179652,2147483648,24510466,0,10223618,0,144179204,0,144244743,0,65142791,0,54460423,0,4587524,0,144310279,
+0,144375815,0,144441348,0,117506050,0,5701634,0,129171460,0,103284740,0,139395079,0,134742319,2147549184,140050734,134545408,65536,134807552,65536,134873088,65536,134938624,65536,7,332,0,65868,0,144506880,0,144572418,0,144637954,0,144703490,0,144769026,
+0,13,144637954,0,144834562,0,144900098,0,144965632,0,12517376,0,145031170,0,145096706,0,145162242,0,145227778,0,145293314,0,131727362,0,145358855,0,145424391,0,66,334,0,65870,0,1245184,0,144637954,2147549184,145490253,144834562,65536,
+144900098,65536,144965632,65536,12517376,65536,145031170,65536,145096706,65536,145162242,65536,145227778,65536,145293314,65536,131727362,65536,145358855,65536,145424391,65536,144637954,2147549184,145555789,144834562,65536,144900098,65536,144965632,65536,12517376,65536,145031170,65536,145096706,65536,145162242,65536,145227778,
+65536,145293314,65536,131727362,65536,145358855,65536,145424391,65536,144637954,2147549184,145621325,144834562,65536,144900098,65536,144965632,65536,12517376,65536,145031170,65536,145096706,65536,145162242,65536,145227778,65536,145293314,65536,131727362,65536,145358855,65536,145424391,65536,144637954,2147549184,145686861,144834562,
+65536,144900098,65536,144965632,65536,12517376,65536,145031170,65536,145096706,65536,145162242,65536,145227778,65536,145293314,65536,131727362,65536,145358855,65536,145424391,65536,145752071,2147483648,145817602,0,145883138,0,145948674,0,146014210,0,146079746,0,146145282,0,146210818,0,146276354,
+0,146341890,0,4587522,0,10,146407424,0,146472960,0,146538496,0,146604032,0,146669568,0,146735104,0,146800642,0,146866178,0,146931714,0,146997250,0,8,147062784,0,147128320,0,147193856,0,147259392,0,147324928,0,147390464,0,125501447,
+0,4587527,0,5,147456000,0,147521536,0,147587074,0,147652610,0,4587524,0,4,147718144,0,147783680,0,147849220,0,5701636,0,202,146407424,2147549184,147915087,146472960,65536,146538496,65536,146604032,65536,146669568,65536,146735104,65536,146800642,65536,146866178,
+65536,146931714,65536,146997250,65536,146407424,2147549184,147980623,146472960,65536,146538496,65536,146604032,65536,146669568,65536,146735104,65536,146800642,65536,146866178,65536,146931714,65536,146997250,65536,146407424,2147549184,148046159,146472960,65536,146538496,65536,146604032,65536,146669568,65536,146735104,65536,146800642,
+65536,146866178,65536,146931714,65536,146997250,65536,146407424,2147549184,148111695,146472960,65536,146538496,65536,146604032,65536,146669568,65536,146735104,65536,146800642,65536,146866178,65536,146931714,65536,146997250,65536,146407424,2147549184,148177231,146472960,65536,146538496,65536,146604032,65536,146669568,65536,146735104,
+65536,146800642,65536,146866178,65536,146931714,65536,146997250,65536,146407424,2147549184,148242767,146472960,65536,146538496,65536,146604032,65536,146669568,65536,146735104,65536,146800642,65536,146866178,65536,146931714,65536,146997250,65536,146407424,2147549184,148308303,146472960,65536,146538496,65536,146604032,65536,146669568,
+65536,146735104,65536,146800642,65536,146866178,65536,146931714,65536,146997250,65536,146407424,2147549184,148373839,146472960,65536,146538496,65536,146604032,65536,146669568,65536,146735104,65536,146800642,65536,146866178,65536,146931714,65536,146997250,65536,146407424,2147549184,148439375,146472960,65536,146538496,65536,146604032,
+65536,146669568,65536,146735104,65536,146800642,65536,146866178,65536,146931714,65536,146997250,65536,146407424,2147549184,148504911,146472960,65536,146538496,65536,146604032,65536,146669568,65536,146735104,65536,146800642,65536,146866178,65536,146931714,65536,146997250,65536,146407424,2147549184,148570447,146472960,65536,146538496,
+65536,146604032,65536,146669568,65536,146735104,65536,146800642,65536,146866178,65536,146931714,65536,146997250,65536,146407424,2147549184,148635983,146472960,65536,146538496,65536,146604032,65536,146669568,65536,146735104,65536,146800642,65536,146866178,65536,146931714,65536,146997250,65536,146407424,2147549184,148701519,146472960,
+65536,146538496,65536,146604032,65536,146669568,65536,146735104,65536,146800642,65536,146866178,65536,146931714,65536,146997250,65536,146407424,2147549184,148767055,146472960,65536,146538496,65536,146604032,65536,146669568,65536,146735104,65536,146800642,65536,146866178,65536,146931714,65536,146997250,65536,146407424,2147549184,
+148832591,146472960,65536,146538496,65536,146604032,65536,146669568,65536,146735104,65536,146800642,65536,146866178,65536,146931714,65536,146997250,65536,146407424,2147549184,148898127,146472960,65536,146538496,65536,146604032,65536,146669568,65536,146735104,65536,146800642,65536,146866178,65536,146931714,65536,146997250,65536,
+146407424,2147549184,148963663,146472960,65536,146538496,65536,146604032,65536,146669568,65536,146735104,65536,146800642,65536,146866178,65536,146931714,65536,146997250,65536,146407424,2147549184,149029199,146472960,65536,146538496,65536,146604032,65536,146669568,65536,146735104,65536,146800642,65536,146866178,65536,146931714,65536,
+146997250,65536,147062784,2147549184,149094736,147128320,65536,147193856,65536,147259392,65536,147324928,65536,147390464,65536,125501447,65536,4587527,65536,147456000,2147549184,149160273,147521536,65536,147587074,65536,147652610,65536,4587524,65536,149225472,2147483648,149291015,0,149356546,0,24444930,0,149422080,0,
+149487623,0,149553152,0,149618688,0,149684224,0,196,147521536,0,149749760,0,146669568,0,149815296,0,147456000,0,149880832,0,149946368,0,150011904,0,150077440,0,150142976,0,150208512,0,150274048,0,150339584,0,150405120,0,150470656,0,150536192,
+0,150601728,0,150667264,0,150732800,0,150798336,0,147456000,2147549184,150864209,147521536,65536,147587074,65536,147652610,65536,4587524,65536,147718144,2147549184,150929746,147783680,65536,147849220,65536,5701636,65536,150994944,2147483648,151060480,0,151126016,0,151191552,0,151257088,0,151322624,
+0,151388160,0,151453696,0,151519232,0,151584768,0,151650304,0,151715840,0,151781376,0,151846912,0,151912448,0,151977984,0,152043520,0,152109056,0,152174592,0,152240128,0,152305664,0,152371200,0,152436736,0,152502272,0,152567808,0,152633344,
+0,152698880,0,152764416,0,152829952,0,152895488,0,152961024,0,153026560,0,153092096,0,153157632,0,153223168,0,153288704,0,153354240,0,153419776,0,153485312,0,153550848,0,153616384,0,153681920,0,153747456,0,153812992,0,153878528,0,153944064,
+0,154009600,0,154075136,0,154140672,0,154206208,0,154271744,0,154337280,0,154402816,0,154468352,0,154533888,0,154599424,0,154664960,0,154730496,0,154796032,0,154861568,0,154927104,0,154992640,0,155058176,0,155123712,0,155189248,0,155254784,
+0,155320320,0,155385856,0,155451392,0,155516928,0,155582464,0,155648000,0,155713536,0,155779072,0,155844608,0,155910144,0,155975680,0,156041216,0,156106752,0,156172288,0,156237824,0,156303360,0,156368896,0,156434432,0,156499968,0,156565504,
+0,156631040,0,156696576,0,156762112,0,156827648,0,156893184,0,156958720,0,157024256,0,157089792,0,157155328,0,157220864,0,157286400,0,157351936,0,157417472,0,157483008,0,157548544,0,157614080,0,157679616,0,157745152,0,157810688,0,157876224,
+0,157941760,0,158007296,0,158072832,0,158138368,0,158203904,0,158269447,0,158334976,0,158400512,0,158466048,0,158531584,0,158597120,0,158662656,0,158728192,0,158793728,0,158859264,0,158924800,0,158990336,0,159055872,0,159121408,0,159186944,
+0,159252480,0,159318016,0,159383552,0,159449088,0,159514624,0,159580160,0,159645696,0,159711232,0,159776768,0,159842304,0,159907840,0,159973376,0,160038912,0,160104448,0,160169984,0,160235520,0,160301056,0,160366592,0,160432128,0,160497664,
+0,160563200,0,160628736,0,160694272,0,160759808,0,160825344,0,160890880,0,160956416,0,161021952,0,161087488,0,161153024,0,161218560,0,161284096,0,161349632,0,161415168,0,161480704,0,161546240,0,161611776,0,161677312,0,161742848,0,161808384,
+0,161873920,0,5,161939456,0,151453696,0,151781376,0,1179650,0,4587522,0,3639,342,0,65878,0,107937792,0,146407424,2147614720,162005331,147915087,146472960,131072,146538496,131072,146604032,131072,146669568,131072,146735104,131072,146800642,131072,146866178,131072,146931714,
+131072,146997250,131072,146407424,2147614720,162005331,147980623,146472960,131072,146538496,131072,146604032,131072,146669568,131072,146735104,131072,146800642,131072,146866178,131072,146931714,131072,146997250,131072,146407424,2147614720,162005331,148046159,146472960,131072,146538496,131072,146604032,131072,146669568,131072,146735104,131072,146800642,
+131072,146866178,131072,146931714,131072,146997250,131072,146407424,2147614720,162005331,148111695,146472960,131072,146538496,131072,146604032,131072,146669568,131072,146735104,131072,146800642,131072,146866178,131072,146931714,131072,146997250,131072,146407424,2147614720,162005331,148177231,146472960,131072,146538496,131072,146604032,131072,146669568,
+131072,146735104,131072,146800642,131072,146866178,131072,146931714,131072,146997250,131072,146407424,2147614720,162005331,148242767,146472960,131072,146538496,131072,146604032,131072,146669568,131072,146735104,131072,146800642,131072,146866178,131072,146931714,131072,146997250,131072,146407424,2147614720,162005331,148308303,146472960,131072,146538496,
+131072,146604032,131072,146669568,131072,146735104,131072,146800642,131072,146866178,131072,146931714,131072,146997250,131072,146407424,2147614720,162005331,148373839,146472960,131072,146538496,131072,146604032,131072,146669568,131072,146735104,131072,146800642,131072,146866178,131072,146931714,131072,146997250,131072,146407424,2147614720,162005331,
+148439375,146472960,131072,146538496,131072,146604032,131072,146669568,131072,146735104,131072,146800642,131072,146866178,131072,146931714,131072,146997250,131072,146407424,2147614720,162005331,148504911,146472960,131072,146538496,131072,146604032,131072,146669568,131072,146735104,131072,146800642,131072,146866178,131072,146931714,131072,146997250,
+131072,146407424,2147614720,162005331,148570447,146472960,131072,146538496,131072,146604032,131072,146669568,131072,146735104,131072,146800642,131072,146866178,131072,146931714,131072,146997250,131072,146407424,2147614720,162005331,148635983,146472960,131072,146538496,131072,146604032,131072,146669568,131072,146735104,131072,146800642,131072,146866178,
+131072,146931714,131072,146997250,131072,146407424,2147614720,162005331,148701519,146472960,131072,146538496,131072,146604032,131072,146669568,131072,146735104,131072,146800642,131072,146866178,131072,146931714,131072,146997250,131072,146407424,2147614720,162005331,148767055,146472960,131072,146538496,131072,146604032,131072,146669568,131072,146735104,
+131072,146800642,131072,146866178,131072,146931714,131072,146997250,131072,146407424,2147614720,162005331,148832591,146472960,131072,146538496,131072,146604032,131072,146669568,131072,146735104,131072,146800642,131072,146866178,131072,146931714,131072,146997250,131072,146407424,2147614720,162005331,148898127,146472960,131072,146538496,131072,146604032,
+131072,146669568,131072,146735104,131072,146800642,131072,146866178,131072,146931714,131072,146997250,131072,146407424,2147614720,162005331,148963663,146472960,131072,146538496,131072,146604032,131072,146669568,131072,146735104,131072,146800642,131072,146866178,131072,146931714,131072,146997250,131072,146407424,2147614720,162005331,149029199,146472960,
+131072,146538496,131072,146604032,131072,146669568,131072,146735104,131072,146800642,131072,146866178,131072,146931714,131072,146997250,131072,147062784,2147614720,162005331,149094736,147128320,131072,147193856,131072,147259392,131072,147324928,131072,147390464,131072,125501447,131072,4587527,131072,147456000,2147614720,162005331,149160273,147521536,
+131072,147587074,131072,147652610,131072,4587524,131072,149225472,2147549184,162005331,149291015,65536,149356546,65536,24444930,65536,149422080,65536,149487623,65536,149553152,65536,149618688,65536,149684224,65536,147521536,2147549184,162070868,149749760,65536,146669568,65536,149815296,65536,147456000,65536,149880832,65536,149946368,
+65536,150011904,65536,150077440,65536,150142976,65536,150208512,65536,150274048,65536,150339584,65536,150405120,65536,150470656,65536,150536192,65536,150601728,65536,150667264,65536,150732800,65536,150798336,65536,147456000,2147614720,162070868,150864209,147521536,131072,147587074,131072,147652610,131072,4587524,131072,147718144,
+2147614720,162070868,150929746,147783680,131072,147849220,131072,5701636,131072,150994944,2147549184,162070868,151060480,65536,151126016,65536,151191552,65536,151257088,65536,151322624,65536,151388160,65536,151453696,65536,151519232,65536,151584768,65536,151650304,65536,151715840,65536,151781376,65536,151846912,65536,151912448,65536,
+151977984,65536,152043520,65536,152109056,65536,152174592,65536,152240128,65536,152305664,65536,152371200,65536,152436736,65536,152502272,65536,152567808,65536,152633344,65536,152698880,65536,152764416,65536,152829952,65536,152895488,65536,152961024,65536,153026560,65536,153092096,65536,153157632,65536,153223168,65536,
+153288704,65536,153354240,65536,153419776,65536,153485312,65536,153550848,65536,153616384,65536,153681920,65536,153747456,65536,153812992,65536,153878528,65536,153944064,65536,154009600,65536,154075136,65536,154140672,65536,154206208,65536,154271744,65536,154337280,65536,154402816,65536,154468352,65536,154533888,65536,
+154599424,65536,154664960,65536,154730496,65536,154796032,65536,154861568,65536,154927104,65536,154992640,65536,155058176,65536,155123712,65536,155189248,65536,155254784,65536,155320320,65536,155385856,65536,155451392,65536,155516928,65536,155582464,65536,155648000,65536,155713536,65536,155779072,65536,155844608,65536,
+155910144,65536,155975680,65536,156041216,65536,156106752,65536,156172288,65536,156237824,65536,156303360,65536,156368896,65536,156434432,65536,156499968,65536,156565504,65536,156631040,65536,156696576,65536,156762112,65536,156827648,65536,156893184,65536,156958720,65536,157024256,65536,157089792,65536,157155328,65536,
+157220864,65536,157286400,65536,157351936,65536,157417472,65536,157483008,65536,157548544,65536,157614080,65536,157679616,65536,157745152,65536,157810688,65536,157876224,65536,157941760,65536,158007296,65536,158072832,65536,158138368,65536,158203904,65536,158269447,65536,158334976,65536,158400512,65536,158466048,65536,
+158531584,65536,158597120,65536,158662656,65536,158728192,65536,158793728,65536,158859264,65536,158924800,65536,158990336,65536,159055872,65536,159121408,65536,159186944,65536,159252480,65536,159318016,65536,159383552,65536,159449088,65536,159514624,65536,159580160,65536,159645696,65536,159711232,65536,159776768,65536,
+159842304,65536,159907840,65536,159973376,65536,160038912,65536,160104448,65536,160169984,65536,160235520,65536,160301056,65536,160366592,65536,160432128,65536,160497664,65536,160563200,65536,160628736,65536,160694272,65536,160759808,65536,160825344,65536,160890880,65536,160956416,65536,161021952,65536,161087488,65536,
+161153024,65536,161218560,65536,161284096,65536,161349632,65536,161415168,65536,161480704,65536,161546240,65536,161611776,65536,161677312,65536,161742848,65536,161808384,65536,161873920,65536,147521536,2147549184,162136404,149749760,65536,146669568,65536,149815296,65536,147456000,65536,149880832,65536,149946368,65536,150011904,
+65536,150077440,65536,150142976,65536,150208512,65536,150274048,65536,150339584,65536,150405120,65536,150470656,65536,150536192,65536,150601728,65536,150667264,65536,150732800,65536,150798336,65536,147456000,2147614720,162136404,150864209,147521536,131072,147587074,131072,147652610,131072,4587524,131072,147718144,2147614720,162136404,
+150929746,147783680,131072,147849220,131072,5701636,131072,150994944,2147549184,162136404,151060480,65536,151126016,65536,151191552,65536,151257088,65536,151322624,65536,151388160,65536,151453696,65536,151519232,65536,151584768,65536,151650304,65536,151715840,65536,151781376,65536,151846912,65536,151912448,65536,151977984,65536,
+152043520,65536,152109056,65536,152174592,65536,152240128,65536,152305664,65536,152371200,65536,152436736,65536,152502272,65536,152567808,65536,152633344,65536,152698880,65536,152764416,65536,152829952,65536,152895488,65536,152961024,65536,153026560,65536,153092096,65536,153157632,65536,153223168,65536,153288704,65536,
+153354240,65536,153419776,65536,153485312,65536,153550848,65536,153616384,65536,153681920,65536,153747456,65536,153812992,65536,153878528,65536,153944064,65536,154009600,65536,154075136,65536,154140672,65536,154206208,65536,154271744,65536,154337280,65536,154402816,65536,154468352,65536,154533888,65536,154599424,65536,
+154664960,65536,154730496,65536,154796032,65536,154861568,65536,154927104,65536,154992640,65536,155058176,65536,155123712,65536,155189248,65536,155254784,65536,155320320,65536,155385856,65536,155451392,65536,155516928,65536,155582464,65536,155648000,65536,155713536,65536,155779072,65536,155844608,65536,155910144,65536,
+155975680,65536,156041216,65536,156106752,65536,156172288,65536,156237824,65536,156303360,65536,156368896,65536,156434432,65536,156499968,65536,156565504,65536,156631040,65536,156696576,65536,156762112,65536,156827648,65536,156893184,65536,156958720,65536,157024256,65536,157089792,65536,157155328,65536,157220864,65536,
+157286400,65536,157351936,65536,157417472,65536,157483008,65536,157548544,65536,157614080,65536,157679616,65536,157745152,65536,157810688,65536,157876224,65536,157941760,65536,158007296,65536,158072832,65536,158138368,65536,158203904,65536,158269447,65536,158334976,65536,158400512,65536,158466048,65536,158531584,65536,
+158597120,65536,158662656,65536,158728192,65536,158793728,65536,158859264,65536,158924800,65536,158990336,65536,159055872,65536,159121408,65536,159186944,65536,159252480,65536,159318016,65536,159383552,65536,159449088,65536,159514624,65536,159580160,65536,159645696,65536,159711232,65536,159776768,65536,159842304,65536,
+159907840,65536,159973376,65536,160038912,65536,160104448,65536,160169984,65536,160235520,65536,160301056,65536,160366592,65536,160432128,65536,160497664,65536,160563200,65536,160628736,65536,160694272,65536,160759808,65536,160825344,65536,160890880,65536,160956416,65536,161021952,65536,161087488,65536,161153024,65536,
+161218560,65536,161284096,65536,161349632,65536,161415168,65536,161480704,65536,161546240,65536,161611776,65536,161677312,65536,161742848,65536,161808384,65536,161873920,65536,147521536,2147549184,162201940,149749760,65536,146669568,65536,149815296,65536,147456000,65536,149880832,65536,149946368,65536,150011904,65536,150077440,
+65536,150142976,65536,150208512,65536,150274048,65536,150339584,65536,150405120,65536,150470656,65536,150536192,65536,150601728,65536,150667264,65536,150732800,65536,150798336,65536,147456000,2147614720,162201940,150864209,147521536,131072,147587074,131072,147652610,131072,4587524,131072,147718144,2147614720,162201940,150929746,147783680,
+131072,147849220,131072,5701636,131072,150994944,2147549184,162201940,151060480,65536,151126016,65536,151191552,65536,151257088,65536,151322624,65536,151388160,65536,151453696,65536,151519232,65536,151584768,65536,151650304,65536,151715840,65536,151781376,65536,151846912,65536,151912448,65536,151977984,65536,152043520,65536,
+152109056,65536,152174592,65536,152240128,65536,152305664,65536,152371200,65536,152436736,65536,152502272,65536,152567808,65536,152633344,65536,152698880,65536,152764416,65536,152829952,65536,152895488,65536,152961024,65536,153026560,65536,153092096,65536,153157632,65536,153223168,65536,153288704,65536,153354240,65536,
+153419776,65536,153485312,65536,153550848,65536,153616384,65536,153681920,65536,153747456,65536,153812992,65536,153878528,65536,153944064,65536,154009600,65536,154075136,65536,154140672,65536,154206208,65536,154271744,65536,154337280,65536,154402816,65536,154468352,65536,154533888,65536,154599424,65536,154664960,65536,
+154730496,65536,154796032,65536,154861568,65536,154927104,65536,154992640,65536,155058176,65536,155123712,65536,155189248,65536,155254784,65536,155320320,65536,155385856,65536,155451392,65536,155516928,65536,155582464,65536,155648000,65536,155713536,65536,155779072,65536,155844608,65536,155910144,65536,155975680,65536,
+156041216,65536,156106752,65536,156172288,65536,156237824,65536,156303360,65536,156368896,65536,156434432,65536,156499968,65536,156565504,65536,156631040,65536,156696576,65536,156762112,65536,156827648,65536,156893184,65536,156958720,65536,157024256,65536,157089792,65536,157155328,65536,157220864,65536,157286400,65536,
+157351936,65536,157417472,65536,157483008,65536,157548544,65536,157614080,65536,157679616,65536,157745152,65536,157810688,65536,157876224,65536,157941760,65536,158007296,65536,158072832,65536,158138368,65536,158203904,65536,158269447,65536,158334976,65536,158400512,65536,158466048,65536,158531584,65536,158597120,65536,
+158662656,65536,158728192,65536,158793728,65536,158859264,65536,158924800,65536,158990336,65536,159055872,65536,159121408,65536,159186944,65536,159252480,65536,159318016,65536,159383552,65536,159449088,65536,159514624,65536,159580160,65536,159645696,65536,159711232,65536,159776768,65536,159842304,65536,159907840,65536,
+159973376,65536,160038912,65536,160104448,65536,160169984,65536,160235520,65536,160301056,65536,160366592,65536,160432128,65536,160497664,65536,160563200,65536,160628736,65536,160694272,65536,160759808,65536,160825344,65536,160890880,65536,160956416,65536,161021952,65536,161087488,65536,161153024,65536,161218560,65536,
+161284096,65536,161349632,65536,161415168,65536,161480704,65536,161546240,65536,161611776,65536,161677312,65536,161742848,65536,161808384,65536,161873920,65536,147521536,2147549184,162267476,149749760,65536,146669568,65536,149815296,65536,147456000,65536,149880832,65536,149946368,65536,150011904,65536,150077440,65536,150142976,
+65536,150208512,65536,150274048,65536,150339584,65536,150405120,65536,150470656,65536,150536192,65536,150601728,65536,150667264,65536,150732800,65536,150798336,65536,147456000,2147614720,162267476,150864209,147521536,131072,147587074,131072,147652610,131072,4587524,131072,147718144,2147614720,162267476,150929746,147783680,131072,147849220,
+131072,5701636,131072,150994944,2147549184,162267476,151060480,65536,151126016,65536,151191552,65536,151257088,65536,151322624,65536,151388160,65536,151453696,65536,151519232,65536,151584768,65536,151650304,65536,151715840,65536,151781376,65536,151846912,65536,151912448,65536,151977984,65536,152043520,65536,152109056,65536,
+152174592,65536,152240128,65536,152305664,65536,152371200,65536,152436736,65536,152502272,65536,152567808,65536,152633344,65536,152698880,65536,152764416,65536,152829952,65536,152895488,65536,152961024,65536,153026560,65536,153092096,65536,153157632,65536,153223168,65536,153288704,65536,153354240,65536,153419776,65536,
+153485312,65536,153550848,65536,153616384,65536,153681920,65536,153747456,65536,153812992,65536,153878528,65536,153944064,65536,154009600,65536,154075136,65536,154140672,65536,154206208,65536,154271744,65536,154337280,65536,154402816,65536,154468352,65536,154533888,65536,154599424,65536,154664960,65536,154730496,65536,
+154796032,65536,154861568,65536,154927104,65536,154992640,65536,155058176,65536,155123712,65536,155189248,65536,155254784,65536,155320320,65536,155385856,65536,155451392,65536,155516928,65536,155582464,65536,155648000,65536,155713536,65536,155779072,65536,155844608,65536,155910144,65536,155975680,65536,156041216,65536,
+156106752,65536,156172288,65536,156237824,65536,156303360,65536,156368896,65536,156434432,65536,156499968,65536,156565504,65536,156631040,65536,156696576,65536,156762112,65536,156827648,65536,156893184,65536,156958720,65536,157024256,65536,157089792,65536,157155328,65536,157220864,65536,157286400,65536,157351936,65536,
+157417472,65536,157483008,65536,157548544,65536,157614080,65536,157679616,65536,157745152,65536,157810688,65536,157876224,65536,157941760,65536,158007296,65536,158072832,65536,158138368,65536,158203904,65536,158269447,65536,158334976,65536,158400512,65536,158466048,65536,158531584,65536,158597120,65536,158662656,65536,
+158728192,65536,158793728,65536,158859264,65536,158924800,65536,158990336,65536,159055872,65536,159121408,65536,159186944,65536,159252480,65536,159318016,65536,159383552,65536,159449088,65536,159514624,65536,159580160,65536,159645696,65536,159711232,65536,159776768,65536,159842304,65536,159907840,65536,159973376,65536,
+160038912,65536,160104448,65536,160169984,65536,160235520,65536,160301056,65536,160366592,65536,160432128,65536,160497664,65536,160563200,65536,160628736,65536,160694272,65536,160759808,65536,160825344,65536,160890880,65536,160956416,65536,161021952,65536,161087488,65536,161153024,65536,161218560,65536,161284096,65536,
+161349632,65536,161415168,65536,161480704,65536,161546240,65536,161611776,65536,161677312,65536,161742848,65536,161808384,65536,161873920,65536,147521536,2147549184,162333012,149749760,65536,146669568,65536,149815296,65536,147456000,65536,149880832,65536,149946368,65536,150011904,65536,150077440,65536,150142976,65536,150208512,
+65536,150274048,65536,150339584,65536,150405120,65536,150470656,65536,150536192,65536,150601728,65536,150667264,65536,150732800,65536,150798336,65536,147456000,2147614720,162333012,150864209,147521536,131072,147587074,131072,147652610,131072,4587524,131072,147718144,2147614720,162333012,150929746,147783680,131072,147849220,131072,5701636,
+131072,150994944,2147549184,162333012,151060480,65536,151126016,65536,151191552,65536,151257088,65536,151322624,65536,151388160,65536,151453696,65536,151519232,65536,151584768,65536,151650304,65536,151715840,65536,151781376,65536,151846912,65536,151912448,65536,151977984,65536,152043520,65536,152109056,65536,152174592,65536,
+152240128,65536,152305664,65536,152371200,65536,152436736,65536,152502272,65536,152567808,65536,152633344,65536,152698880,65536,152764416,65536,152829952,65536,152895488,65536,152961024,65536,153026560,65536,153092096,65536,153157632,65536,153223168,65536,153288704,65536,153354240,65536,153419776,65536,153485312,65536,
+153550848,65536,153616384,65536,153681920,65536,153747456,65536,153812992,65536,153878528,65536,153944064,65536,154009600,65536,154075136,65536,154140672,65536,154206208,65536,154271744,65536,154337280,65536,154402816,65536,154468352,65536,154533888,65536,154599424,65536,154664960,65536,154730496,65536,154796032,65536,
+154861568,65536,154927104,65536,154992640,65536,155058176,65536,155123712,65536,155189248,65536,155254784,65536,155320320,65536,155385856,65536,155451392,65536,155516928,65536,155582464,65536,155648000,65536,155713536,65536,155779072,65536,155844608,65536,155910144,65536,155975680,65536,156041216,65536,156106752,65536,
+156172288,65536,156237824,65536,156303360,65536,156368896,65536,156434432,65536,156499968,65536,156565504,65536,156631040,65536,156696576,65536,156762112,65536,156827648,65536,156893184,65536,156958720,65536,157024256,65536,157089792,65536,157155328,65536,157220864,65536,157286400,65536,157351936,65536,157417472,65536,
+157483008,65536,157548544,65536,157614080,65536,157679616,65536,157745152,65536,157810688,65536,157876224,65536,157941760,65536,158007296,65536,158072832,65536,158138368,65536,158203904,65536,158269447,65536,158334976,65536,158400512,65536,158466048,65536,158531584,65536,158597120,65536,158662656,65536,158728192,65536,
+158793728,65536,158859264,65536,158924800,65536,158990336,65536,159055872,65536,159121408,65536,159186944,65536,159252480,65536,159318016,65536,159383552,65536,159449088,65536,159514624,65536,159580160,65536,159645696,65536,159711232,65536,159776768,65536,159842304,65536,159907840,65536,159973376,65536,160038912,65536,
+160104448,65536,160169984,65536,160235520,65536,160301056,65536,160366592,65536,160432128,65536,160497664,65536,160563200,65536,160628736,65536,160694272,65536,160759808,65536,160825344,65536,160890880,65536,160956416,65536,161021952,65536,161087488,65536,161153024,65536,161218560,65536,161284096,65536,161349632,65536,
+161415168,65536,161480704,65536,161546240,65536,161611776,65536,161677312,65536,161742848,65536,161808384,65536,161873920,65536,147521536,2147549184,162398548,149749760,65536,146669568,65536,149815296,65536,147456000,65536,149880832,65536,149946368,65536,150011904,65536,150077440,65536,150142976,65536,150208512,65536,150274048,
+65536,150339584,65536,150405120,65536,150470656,65536,150536192,65536,150601728,65536,150667264,65536,150732800,65536,150798336,65536,147456000,2147614720,162398548,150864209,147521536,131072,147587074,131072,147652610,131072,4587524,131072,147718144,2147614720,162398548,150929746,147783680,131072,147849220,131072,5701636,131072,150994944,
+2147549184,162398548,151060480,65536,151126016,65536,151191552,65536,151257088,65536,151322624,65536,151388160,65536,151453696,65536,151519232,65536,151584768,65536,151650304,65536,151715840,65536,151781376,65536,151846912,65536,151912448,65536,151977984,65536,152043520,65536,152109056,65536,152174592,65536,152240128,65536,
+152305664,65536,152371200,65536,152436736,65536,152502272,65536,152567808,65536,152633344,65536,152698880,65536,152764416,65536,152829952,65536,152895488,65536,152961024,65536,153026560,65536,153092096,65536,153157632,65536,153223168,65536,153288704,65536,153354240,65536,153419776,65536,153485312,65536,153550848,65536,
+153616384,65536,153681920,65536,153747456,65536,153812992,65536,153878528,65536,153944064,65536,154009600,65536,154075136,65536,154140672,65536,154206208,65536,154271744,65536,154337280,65536,154402816,65536,154468352,65536,154533888,65536,154599424,65536,154664960,65536,154730496,65536,154796032,65536,154861568,65536,
+154927104,65536,154992640,65536,155058176,65536,155123712,65536,155189248,65536,155254784,65536,155320320,65536,155385856,65536,155451392,65536,155516928,65536,155582464,65536,155648000,65536,155713536,65536,155779072,65536,155844608,65536,155910144,65536,155975680,65536,156041216,65536,156106752,65536,156172288,65536,
+156237824,65536,156303360,65536,156368896,65536,156434432,65536,156499968,65536,156565504,65536,156631040,65536,156696576,65536,156762112,65536,156827648,65536,156893184,65536,156958720,65536,157024256,65536,157089792,65536,157155328,65536,157220864,65536,157286400,65536,157351936,65536,157417472,65536,157483008,65536,
+157548544,65536,157614080,65536,157679616,65536,157745152,65536,157810688,65536,157876224,65536,157941760,65536,158007296,65536,158072832,65536,158138368,65536,158203904,65536,158269447,65536,158334976,65536,158400512,65536,158466048,65536,158531584,65536,158597120,65536,158662656,65536,158728192,65536,158793728,65536,
+158859264,65536,158924800,65536,158990336,65536,159055872,65536,159121408,65536,159186944,65536,159252480,65536,159318016,65536,159383552,65536,159449088,65536,159514624,65536,159580160,65536,159645696,65536,159711232,65536,159776768,65536,159842304,65536,159907840,65536,159973376,65536,160038912,65536,160104448,65536,
+160169984,65536,160235520,65536,160301056,65536,160366592,65536,160432128,65536,160497664,65536,160563200,65536,160628736,65536,160694272,65536,160759808,65536,160825344,65536,160890880,65536,160956416,65536,161021952,65536,161087488,65536,161153024,65536,161218560,65536,161284096,65536,161349632,65536,161415168,65536,
+161480704,65536,161546240,65536,161611776,65536,161677312,65536,161742848,65536,161808384,65536,161873920,65536,147521536,2147549184,162464084,149749760,65536,146669568,65536,149815296,65536,147456000,65536,149880832,65536,149946368,65536,150011904,65536,150077440,65536,150142976,65536,150208512,65536,150274048,65536,150339584,
+65536,150405120,65536,150470656,65536,150536192,65536,150601728,65536,150667264,65536,150732800,65536,150798336,65536,147456000,2147614720,162464084,150864209,147521536,131072,147587074,131072,147652610,131072,4587524,131072,147718144,2147614720,162464084,150929746,147783680,131072,147849220,131072,5701636,131072,150994944,2147549184,162464084,
+151060480,65536,151126016,65536,151191552,65536,151257088,65536,151322624,65536,151388160,65536,151453696,65536,151519232,65536,151584768,65536,151650304,65536,151715840,65536,151781376,65536,151846912,65536,151912448,65536,151977984,65536,152043520,65536,152109056,65536,152174592,65536,152240128,65536,152305664,65536,
+152371200,65536,152436736,65536,152502272,65536,152567808,65536,152633344,65536,152698880,65536,152764416,65536,152829952,65536,152895488,65536,152961024,65536,153026560,65536,153092096,65536,153157632,65536,153223168,65536,153288704,65536,153354240,65536,153419776,65536,153485312,65536,153550848,65536,153616384,65536,
+153681920,65536,153747456,65536,153812992,65536,153878528,65536,153944064,65536,154009600,65536,154075136,65536,154140672,65536,154206208,65536,154271744,65536,154337280,65536,154402816,65536,154468352,65536,154533888,65536,154599424,65536,154664960,65536,154730496,65536,154796032,65536,154861568,65536,154927104,65536,
+154992640,65536,155058176,65536,155123712,65536,155189248,65536,155254784,65536,155320320,65536,155385856,65536,155451392,65536,155516928,65536,155582464,65536,155648000,65536,155713536,65536,155779072,65536,155844608,65536,155910144,65536,155975680,65536,156041216,65536,156106752,65536,156172288,65536,156237824,65536,
+156303360,65536,156368896,65536,156434432,65536,156499968,65536,156565504,65536,156631040,65536,156696576,65536,156762112,65536,156827648,65536,156893184,65536,156958720,65536,157024256,65536,157089792,65536,157155328,65536,157220864,65536,157286400,65536,157351936,65536,157417472,65536,157483008,65536,157548544,65536,
+157614080,65536,157679616,65536,157745152,65536,157810688,65536,157876224,65536,157941760,65536,158007296,65536,158072832,65536,158138368,65536,158203904,65536,158269447,65536,158334976,65536,158400512,65536,158466048,65536,158531584,65536,158597120,65536,158662656,65536,158728192,65536,158793728,65536,158859264,65536,
+158924800,65536,158990336,65536,159055872,65536,159121408,65536,159186944,65536,159252480,65536,159318016,65536,159383552,65536,159449088,65536,159514624,65536,159580160,65536,159645696,65536,159711232,65536,159776768,65536,159842304,65536,159907840,65536,159973376,65536,160038912,65536,160104448,65536,160169984,65536,
+160235520,65536,160301056,65536,160366592,65536,160432128,65536,160497664,65536,160563200,65536,160628736,65536,160694272,65536,160759808,65536,160825344,65536,160890880,65536,160956416,65536,161021952,65536,161087488,65536,161153024,65536,161218560,65536,161284096,65536,161349632,65536,161415168,65536,161480704,65536,
+161546240,65536,161611776,65536,161677312,65536,161742848,65536,161808384,65536,161873920,65536,147521536,2147549184,162529620,149749760,65536,146669568,65536,149815296,65536,147456000,65536,149880832,65536,149946368,65536,150011904,65536,150077440,65536,150142976,65536,150208512,65536,150274048,65536,150339584,65536,150405120,
+65536,150470656,65536,150536192,65536,150601728,65536,150667264,65536,150732800,65536,150798336,65536,147456000,2147614720,162529620,150864209,147521536,131072,147587074,131072,147652610,131072,4587524,131072,147718144,2147614720,162529620,150929746,147783680,131072,147849220,131072,5701636,131072,150994944,2147549184,162529620,151060480,65536,
+151126016,65536,151191552,65536,151257088,65536,151322624,65536,151388160,65536,151453696,65536,151519232,65536,151584768,65536,151650304,65536,151715840,65536,151781376,65536,151846912,65536,151912448,65536,151977984,65536,152043520,65536,152109056,65536,152174592,65536,152240128,65536,152305664,65536,152371200,65536,
+152436736,65536,152502272,65536,152567808,65536,152633344,65536,152698880,65536,152764416,65536,152829952,65536,152895488,65536,152961024,65536,153026560,65536,153092096,65536,153157632,65536,153223168,65536,153288704,65536,153354240,65536,153419776,65536,153485312,65536,153550848,65536,153616384,65536,153681920,65536,
+153747456,65536,153812992,65536,153878528,65536,153944064,65536,154009600,65536,154075136,65536,154140672,65536,154206208,65536,154271744,65536,154337280,65536,154402816,65536,154468352,65536,154533888,65536,154599424,65536,154664960,65536,154730496,65536,154796032,65536,154861568,65536,154927104,65536,154992640,65536,
+155058176,65536,155123712,65536,155189248,65536,155254784,65536,155320320,65536,155385856,65536,155451392,65536,155516928,65536,155582464,65536,155648000,65536,155713536,65536,155779072,65536,155844608,65536,155910144,65536,155975680,65536,156041216,65536,156106752,65536,156172288,65536,156237824,65536,156303360,65536,
+156368896,65536,156434432,65536,156499968,65536,156565504,65536,156631040,65536,156696576,65536,156762112,65536,156827648,65536,156893184,65536,156958720,65536,157024256,65536,157089792,65536,157155328,65536,157220864,65536,157286400,65536,157351936,65536,157417472,65536,157483008,65536,157548544,65536,157614080,65536,
+157679616,65536,157745152,65536,157810688,65536,157876224,65536,157941760,65536,158007296,65536,158072832,65536,158138368,65536,158203904,65536,158269447,65536,158334976,65536,158400512,65536,158466048,65536,158531584,65536,158597120,65536,158662656,65536,158728192,65536,158793728,65536,158859264,65536,158924800,65536,
+158990336,65536,159055872,65536,159121408,65536,159186944,65536,159252480,65536,159318016,65536,159383552,65536,159449088,65536,159514624,65536,159580160,65536,159645696,65536,159711232,65536,159776768,65536,159842304,65536,159907840,65536,159973376,65536,160038912,65536,160104448,65536,160169984,65536,160235520,65536,
+160301056,65536,160366592,65536,160432128,65536,160497664,65536,160563200,65536,160628736,65536,160694272,65536,160759808,65536,160825344,65536,160890880,65536,160956416,65536,161021952,65536,161087488,65536,161153024,65536,161218560,65536,161284096,65536,161349632,65536,161415168,65536,161480704,65536,161546240,65536,
+161611776,65536,161677312,65536,161742848,65536,161808384,65536,161873920,65536,147521536,2147549184,162595156,149749760,65536,146669568,65536,149815296,65536,147456000,65536,149880832,65536,149946368,65536,150011904,65536,150077440,65536,150142976,65536,150208512,65536,150274048,65536,150339584,65536,150405120,65536,150470656,
+65536,150536192,65536,150601728,65536,150667264,65536,150732800,65536,150798336,65536,147456000,2147614720,162595156,150864209,147521536,131072,147587074,131072,147652610,131072,4587524,131072,147718144,2147614720,162595156,150929746,147783680,131072,147849220,131072,5701636,131072,150994944,2147549184,162595156,151060480,65536,151126016,65536,
+151191552,65536,151257088,65536,151322624,65536,151388160,65536,151453696,65536,151519232,65536,151584768,65536,151650304,65536,151715840,65536,151781376,65536,151846912,65536,151912448,65536,151977984,65536,152043520,65536,152109056,65536,152174592,65536,152240128,65536,152305664,65536,152371200,65536,152436736,65536,
+152502272,65536,152567808,65536,152633344,65536,152698880,65536,152764416,65536,152829952,65536,152895488,65536,152961024,65536,153026560,65536,153092096,65536,153157632,65536,153223168,65536,153288704,65536,153354240,65536,153419776,65536,153485312,65536,153550848,65536,153616384,65536,153681920,65536,153747456,65536,
+153812992,65536,153878528,65536,153944064,65536,154009600,65536,154075136,65536,154140672,65536,154206208,65536,154271744,65536,154337280,65536,154402816,65536,154468352,65536,154533888,65536,154599424,65536,154664960,65536,154730496,65536,154796032,65536,154861568,65536,154927104,65536,154992640,65536,155058176,65536,
+155123712,65536,155189248,65536,155254784,65536,155320320,65536,155385856,65536,155451392,65536,155516928,65536,155582464,65536,155648000,65536,155713536,65536,155779072,65536,155844608,65536,155910144,65536,155975680,65536,156041216,65536,156106752,65536,156172288,65536,156237824,65536,156303360,65536,156368896,65536,
+156434432,65536,156499968,65536,156565504,65536,156631040,65536,156696576,65536,156762112,65536,156827648,65536,156893184,65536,156958720,65536,157024256,65536,157089792,65536,157155328,65536,157220864,65536,157286400,65536,157351936,65536,157417472,65536,157483008,65536,157548544,65536,157614080,65536,157679616,65536,
+157745152,65536,157810688,65536,157876224,65536,157941760,65536,158007296,65536,158072832,65536,158138368,65536,158203904,65536,158269447,65536,158334976,65536,158400512,65536,158466048,65536,158531584,65536,158597120,65536,158662656,65536,158728192,65536,158793728,65536,158859264,65536,158924800,65536,158990336,65536,
+159055872,65536,159121408,65536,159186944,65536,159252480,65536,159318016,65536,159383552,65536,159449088,65536,159514624,65536,159580160,65536,159645696,65536,159711232,65536,159776768,65536,159842304,65536,159907840,65536,159973376,65536,160038912,65536,160104448,65536,160169984,65536,160235520,65536,160301056,65536,
+160366592,65536,160432128,65536,160497664,65536,160563200,65536,160628736,65536,160694272,65536,160759808,65536,160825344,65536,160890880,65536,160956416,65536,161021952,65536,161087488,65536,161153024,65536,161218560,65536,161284096,65536,161349632,65536,161415168,65536,161480704,65536,161546240,65536,161611776,65536,
+161677312,65536,161742848,65536,161808384,65536,161873920,65536,147521536,2147549184,162660692,149749760,65536,146669568,65536,149815296,65536,147456000,65536,149880832,65536,149946368,65536,150011904,65536,150077440,65536,150142976,65536,150208512,65536,150274048,65536,150339584,65536,150405120,65536,150470656,65536,150536192,
+65536,150601728,65536,150667264,65536,150732800,65536,150798336,65536,147456000,2147614720,162660692,150864209,147521536,131072,147587074,131072,147652610,131072,4587524,131072,147718144,2147614720,162660692,150929746,147783680,131072,147849220,131072,5701636,131072,150994944,2147549184,162660692,151060480,65536,151126016,65536,151191552,65536,
+151257088,65536,151322624,65536,151388160,65536,151453696,65536,151519232,65536,151584768,65536,151650304,65536,151715840,65536,151781376,65536,151846912,65536,151912448,65536,151977984,65536,152043520,65536,152109056,65536,152174592,65536,152240128,65536,152305664,65536,152371200,65536,152436736,65536,152502272,65536,
+152567808,65536,152633344,65536,152698880,65536,152764416,65536,152829952,65536,152895488,65536,152961024,65536,153026560,65536,153092096,65536,153157632,65536,153223168,65536,153288704,65536,153354240,65536,153419776,65536,153485312,65536,153550848,65536,153616384,65536,153681920,65536,153747456,65536,153812992,65536,
+153878528,65536,153944064,65536,154009600,65536,154075136,65536,154140672,65536,154206208,65536,154271744,65536,154337280,65536,154402816,65536,154468352,65536,154533888,65536,154599424,65536,154664960,65536,154730496,65536,154796032,65536,154861568,65536,154927104,65536,154992640,65536,155058176,65536,155123712,65536,
+155189248,65536,155254784,65536,155320320,65536,155385856,65536,155451392,65536,155516928,65536,155582464,65536,155648000,65536,155713536,65536,155779072,65536,155844608,65536,155910144,65536,155975680,65536,156041216,65536,156106752,65536,156172288,65536,156237824,65536,156303360,65536,156368896,65536,156434432,65536,
+156499968,65536,156565504,65536,156631040,65536,156696576,65536,156762112,65536,156827648,65536,156893184,65536,156958720,65536,157024256,65536,157089792,65536,157155328,65536,157220864,65536,157286400,65536,157351936,65536,157417472,65536,157483008,65536,157548544,65536,157614080,65536,157679616,65536,157745152,65536,
+157810688,65536,157876224,65536,157941760,65536,158007296,65536,158072832,65536,158138368,65536,158203904,65536,158269447,65536,158334976,65536,158400512,65536,158466048,65536,158531584,65536,158597120,65536,158662656,65536,158728192,65536,158793728,65536,158859264,65536,158924800,65536,158990336,65536,159055872,65536,
+159121408,65536,159186944,65536,159252480,65536,159318016,65536,159383552,65536,159449088,65536,159514624,65536,159580160,65536,159645696,65536,159711232,65536,159776768,65536,159842304,65536,159907840,65536,159973376,65536,160038912,65536,160104448,65536,160169984,65536,160235520,65536,160301056,65536,160366592,65536,
+160432128,65536,160497664,65536,160563200,65536,160628736,65536,160694272,65536,160759808,65536,160825344,65536,160890880,65536,160956416,65536,161021952,65536,161087488,65536,161153024,65536,161218560,65536,161284096,65536,161349632,65536,161415168,65536,161480704,65536,161546240,65536,161611776,65536,161677312,65536,
+161742848,65536,161808384,65536,161873920,65536,147521536,2147549184,162726228,149749760,65536,146669568,65536,149815296,65536,147456000,65536,149880832,65536,149946368,65536,150011904,65536,150077440,65536,150142976,65536,150208512,65536,150274048,65536,150339584,65536,150405120,65536,150470656,65536,150536192,65536,150601728,
+65536,150667264,65536,150732800,65536,150798336,65536,147456000,2147614720,162726228,150864209,147521536,131072,147587074,131072,147652610,131072,4587524,131072,147718144,2147614720,162726228,150929746,147783680,131072,147849220,131072,5701636,131072,150994944,2147549184,162726228,151060480,65536,151126016,65536,151191552,65536,151257088,65536,
+151322624,65536,151388160,65536,151453696,65536,151519232,65536,151584768,65536,151650304,65536,151715840,65536,151781376,65536,151846912,65536,151912448,65536,151977984,65536,152043520,65536,152109056,65536,152174592,65536,152240128,65536,152305664,65536,152371200,65536,152436736,65536,152502272,65536,152567808,65536,
+152633344,65536,152698880,65536,152764416,65536,152829952,65536,152895488,65536,152961024,65536,153026560,65536,153092096,65536,153157632,65536,153223168,65536,153288704,65536,153354240,65536,153419776,65536,153485312,65536,153550848,65536,153616384,65536,153681920,65536,153747456,65536,153812992,65536,153878528,65536,
+153944064,65536,154009600,65536,154075136,65536,154140672,65536,154206208,65536,154271744,65536,154337280,65536,154402816,65536,154468352,65536,154533888,65536,154599424,65536,154664960,65536,154730496,65536,154796032,65536,154861568,65536,154927104,65536,154992640,65536,155058176,65536,155123712,65536,155189248,65536,
+155254784,65536,155320320,65536,155385856,65536,155451392,65536,155516928,65536,155582464,65536,155648000,65536,155713536,65536,155779072,65536,155844608,65536,155910144,65536,155975680,65536,156041216,65536,156106752,65536,156172288,65536,156237824,65536,156303360,65536,156368896,65536,156434432,65536,156499968,65536,
+156565504,65536,156631040,65536,156696576,65536,156762112,65536,156827648,65536,156893184,65536,156958720,65536,157024256,65536,157089792,65536,157155328,65536,157220864,65536,157286400,65536,157351936,65536,157417472,65536,157483008,65536,157548544,65536,157614080,65536,157679616,65536,157745152,65536,157810688,65536,
+157876224,65536,157941760,65536,158007296,65536,158072832,65536,158138368,65536,158203904,65536,158269447,65536,158334976,65536,158400512,65536,158466048,65536,158531584,65536,158597120,65536,158662656,65536,158728192,65536,158793728,65536,158859264,65536,158924800,65536,158990336,65536,159055872,65536,159121408,65536,
+159186944,65536,159252480,65536,159318016,65536,159383552,65536,159449088,65536,159514624,65536,159580160,65536,159645696,65536,159711232,65536,159776768,65536,159842304,65536,159907840,65536,159973376,65536,160038912,65536,160104448,65536,160169984,65536,160235520,65536,160301056,65536,160366592,65536,160432128,65536,
+160497664,65536,160563200,65536,160628736,65536,160694272,65536,160759808,65536,160825344,65536,160890880,65536,160956416,65536,161021952,65536,161087488,65536,161153024,65536,161218560,65536,161284096,65536,161349632,65536,161415168,65536,161480704,65536,161546240,65536,161611776,65536,161677312,65536,161742848,65536,
+161808384,65536,161873920,65536,147521536,2147549184,162791764,149749760,65536,146669568,65536,149815296,65536,147456000,65536,149880832,65536,149946368,65536,150011904,65536,150077440,65536,150142976,65536,150208512,65536,150274048,65536,150339584,65536,150405120,65536,150470656,65536,150536192,65536,150601728,65536,150667264,
+65536,150732800,65536,150798336,65536,147456000,2147614720,162791764,150864209,147521536,131072,147587074,131072,147652610,131072,4587524,131072,147718144,2147614720,162791764,150929746,147783680,131072,147849220,131072,5701636,131072,150994944,2147549184,162791764,151060480,65536,151126016,65536,151191552,65536,151257088,65536,151322624,65536,
+151388160,65536,151453696,65536,151519232,65536,151584768,65536,151650304,65536,151715840,65536,151781376,65536,151846912,65536,151912448,65536,151977984,65536,152043520,65536,152109056,65536,152174592,65536,152240128,65536,152305664,65536,152371200,65536,152436736,65536,152502272,65536,152567808,65536,152633344,65536,
+152698880,65536,152764416,65536,152829952,65536,152895488,65536,152961024,65536,153026560,65536,153092096,65536,153157632,65536,153223168,65536,153288704,65536,153354240,65536,153419776,65536,153485312,65536,153550848,65536,153616384,65536,153681920,65536,153747456,65536,153812992,65536,153878528,65536,153944064,65536,
+154009600,65536,154075136,65536,154140672,65536,154206208,65536,154271744,65536,154337280,65536,154402816,65536,154468352,65536,154533888,65536,154599424,65536,154664960,65536,154730496,65536,154796032,65536,154861568,65536,154927104,65536,154992640,65536,155058176,65536,155123712,65536,155189248,65536,155254784,65536,
+155320320,65536,155385856,65536,155451392,65536,155516928,65536,155582464,65536,155648000,65536,155713536,65536,155779072,65536,155844608,65536,155910144,65536,155975680,65536,156041216,65536,156106752,65536,156172288,65536,156237824,65536,156303360,65536,156368896,65536,156434432,65536,156499968,65536,156565504,65536,
+156631040,65536,156696576,65536,156762112,65536,156827648,65536,156893184,65536,156958720,65536,157024256,65536,157089792,65536,157155328,65536,157220864,65536,157286400,65536,157351936,65536,157417472,65536,157483008,65536,157548544,65536,157614080,65536,157679616,65536,157745152,65536,157810688,65536,157876224,65536,
+157941760,65536,158007296,65536,158072832,65536,158138368,65536,158203904,65536,158269447,65536,158334976,65536,158400512,65536,158466048,65536,158531584,65536,158597120,65536,158662656,65536,158728192,65536,158793728,65536,158859264,65536,158924800,65536,158990336,65536,159055872,65536,159121408,65536,159186944,65536,
+159252480,65536,159318016,65536,159383552,65536,159449088,65536,159514624,65536,159580160,65536,159645696,65536,159711232,65536,159776768,65536,159842304,65536,159907840,65536,159973376,65536,160038912,65536,160104448,65536,160169984,65536,160235520,65536,160301056,65536,160366592,65536,160432128,65536,160497664,65536,
+160563200,65536,160628736,65536,160694272,65536,160759808,65536,160825344,65536,160890880,65536,160956416,65536,161021952,65536,161087488,65536,161153024,65536,161218560,65536,161284096,65536,161349632,65536,161415168,65536,161480704,65536,161546240,65536,161611776,65536,161677312,65536,161742848,65536,161808384,65536,
+161873920,65536,147521536,2147549184,162857300,149749760,65536,146669568,65536,149815296,65536,147456000,65536,149880832,65536,149946368,65536,150011904,65536,150077440,65536,150142976,65536,150208512,65536,150274048,65536,150339584,65536,150405120,65536,150470656,65536,150536192,65536,150601728,65536,150667264,65536,150732800,
+65536,150798336,65536,147456000,2147614720,162857300,150864209,147521536,131072,147587074,131072,147652610,131072,4587524,131072,147718144,2147614720,162857300,150929746,147783680,131072,147849220,131072,5701636,131072,150994944,2147549184,162857300,151060480,65536,151126016,65536,151191552,65536,151257088,65536,151322624,65536,151388160,65536,
+151453696,65536,151519232,65536,151584768,65536,151650304,65536,151715840,65536,151781376,65536,151846912,65536,151912448,65536,151977984,65536,152043520,65536,152109056,65536,152174592,65536,152240128,65536,152305664,65536,152371200,65536,152436736,65536,152502272,65536,152567808,65536,152633344,65536,152698880,65536,
+152764416,65536,152829952,65536,152895488,65536,152961024,65536,153026560,65536,153092096,65536,153157632,65536,153223168,65536,153288704,65536,153354240,65536,153419776,65536,153485312,65536,153550848,65536,153616384,65536,153681920,65536,153747456,65536,153812992,65536,153878528,65536,153944064,65536,154009600,65536,
+154075136,65536,154140672,65536,154206208,65536,154271744,65536,154337280,65536,154402816,65536,154468352,65536,154533888,65536,154599424,65536,154664960,65536,154730496,65536,154796032,65536,154861568,65536,154927104,65536,154992640,65536,155058176,65536,155123712,65536,155189248,65536,155254784,65536,155320320,65536,
+155385856,65536,155451392,65536,155516928,65536,155582464,65536,155648000,65536,155713536,65536,155779072,65536,155844608,65536,155910144,65536,155975680,65536,156041216,65536,156106752,65536,156172288,65536,156237824,65536,156303360,65536,156368896,65536,156434432,65536,156499968,65536,156565504,65536,156631040,65536,
+156696576,65536,156762112,65536,156827648,65536,156893184,65536,156958720,65536,157024256,65536,157089792,65536,157155328,65536,157220864,65536,157286400,65536,157351936,65536,157417472,65536,157483008,65536,157548544,65536,157614080,65536,157679616,65536,157745152,65536,157810688,65536,157876224,65536,157941760,65536,
+158007296,65536,158072832,65536,158138368,65536,158203904,65536,158269447,65536,158334976,65536,158400512,65536,158466048,65536,158531584,65536,158597120,65536,158662656,65536,158728192,65536,158793728,65536,158859264,65536,158924800,65536,158990336,65536,159055872,65536,159121408,65536,159186944,65536,159252480,65536,
+159318016,65536,159383552,65536,159449088,65536,159514624,65536,159580160,65536,159645696,65536,159711232,65536,159776768,65536,159842304,65536,159907840,65536,159973376,65536,160038912,65536,160104448,65536,160169984,65536,160235520,65536,160301056,65536,160366592,65536,160432128,65536,160497664,65536,160563200,65536,
+160628736,65536,160694272,65536,160759808,65536,160825344,65536,160890880,65536,160956416,65536,161021952,65536,161087488,65536,161153024,65536,161218560,65536,161284096,65536,161349632,65536,161415168,65536,161480704,65536,161546240,65536,161611776,65536,161677312,65536,161742848,65536,161808384,65536,161873920,65536,
+147521536,2147549184,162922836,149749760,65536,146669568,65536,149815296,65536,147456000,65536,149880832,65536,149946368,65536,150011904,65536,150077440,65536,150142976,65536,150208512,65536,150274048,65536,150339584,65536,150405120,65536,150470656,65536,150536192,65536,150601728,65536,150667264,65536,150732800,65536,150798336,
+65536,147456000,2147614720,162922836,150864209,147521536,131072,147587074,131072,147652610,131072,4587524,131072,147718144,2147614720,162922836,150929746,147783680,131072,147849220,131072,5701636,131072,150994944,2147549184,162922836,151060480,65536,151126016,65536,151191552,65536,151257088,65536,151322624,65536,151388160,65536,151453696,65536,
+151519232,65536,151584768,65536,151650304,65536,151715840,65536,151781376,65536,151846912,65536,151912448,65536,151977984,65536,152043520,65536,152109056,65536,152174592,65536,152240128,65536,152305664,65536,152371200,65536,152436736,65536,152502272,65536,152567808,65536,152633344,65536,152698880,65536,152764416,65536,
+152829952,65536,152895488,65536,152961024,65536,153026560,65536,153092096,65536,153157632,65536,153223168,65536,153288704,65536,153354240,65536,153419776,65536,153485312,65536,153550848,65536,153616384,65536,153681920,65536,153747456,65536,153812992,65536,153878528,65536,153944064,65536,154009600,65536,154075136,65536,
+154140672,65536,154206208,65536,154271744,65536,154337280,65536,154402816,65536,154468352,65536,154533888,65536,154599424,65536,154664960,65536,154730496,65536,154796032,65536,154861568,65536,154927104,65536,154992640,65536,155058176,65536,155123712,65536,155189248,65536,155254784,65536,155320320,65536,155385856,65536,
+155451392,65536,155516928,65536,155582464,65536,155648000,65536,155713536,65536,155779072,65536,155844608,65536,155910144,65536,155975680,65536,156041216,65536,156106752,65536,156172288,65536,156237824,65536,156303360,65536,156368896,65536,156434432,65536,156499968,65536,156565504,65536,156631040,65536,156696576,65536,
+156762112,65536,156827648,65536,156893184,65536,156958720,65536,157024256,65536,157089792,65536,157155328,65536,157220864,65536,157286400,65536,157351936,65536,157417472,65536,157483008,65536,157548544,65536,157614080,65536,157679616,65536,157745152,65536,157810688,65536,157876224,65536,157941760,65536,158007296,65536,
+158072832,65536,158138368,65536,158203904,65536,158269447,65536,158334976,65536,158400512,65536,158466048,65536,158531584,65536,158597120,65536,158662656,65536,158728192,65536,158793728,65536,158859264,65536,158924800,65536,158990336,65536,159055872,65536,159121408,65536,159186944,65536,159252480,65536,159318016,65536,
+159383552,65536,159449088,65536,159514624,65536,159580160,65536,159645696,65536,159711232,65536,159776768,65536,159842304,65536,159907840,65536,159973376,65536,160038912,65536,160104448,65536,160169984,65536,160235520,65536,160301056,65536,160366592,65536,160432128,65536,160497664,65536,160563200,65536,160628736,65536,
+160694272,65536,160759808,65536,160825344,65536,160890880,65536,160956416,65536,161021952,65536,161087488,65536,161153024,65536,161218560,65536,161284096,65536,161349632,65536,161415168,65536,161480704,65536,161546240,65536,161611776,65536,161677312,65536,161742848,65536,161808384,65536,161873920,65536,147521536,2147549184,
+162988372,149749760,65536,146669568,65536,149815296,65536,147456000,65536,149880832,65536,149946368,65536,150011904,65536,150077440,65536,150142976,65536,150208512,65536,150274048,65536,150339584,65536,150405120,65536,150470656,65536,150536192,65536,150601728,65536,150667264,65536,150732800,65536,150798336,65536,147456000,
+2147614720,162988372,150864209,147521536,131072,147587074,131072,147652610,131072,4587524,131072,147718144,2147614720,162988372,150929746,147783680,131072,147849220,131072,5701636,131072,150994944,2147549184,162988372,151060480,65536,151126016,65536,151191552,65536,151257088,65536,151322624,65536,151388160,65536,151453696,65536,151519232,65536,
+151584768,65536,151650304,65536,151715840,65536,151781376,65536,151846912,65536,151912448,65536,151977984,65536,152043520,65536,152109056,65536,152174592,65536,152240128,65536,152305664,65536,152371200,65536,152436736,65536,152502272,65536,152567808,65536,152633344,65536,152698880,65536,152764416,65536,152829952,65536,
+152895488,65536,152961024,65536,153026560,65536,153092096,65536,153157632,65536,153223168,65536,153288704,65536,153354240,65536,153419776,65536,153485312,65536,153550848,65536,153616384,65536,153681920,65536,153747456,65536,153812992,65536,153878528,65536,153944064,65536,154009600,65536,154075136,65536,154140672,65536,
+154206208,65536,154271744,65536,154337280,65536,154402816,65536,154468352,65536,154533888,65536,154599424,65536,154664960,65536,154730496,65536,154796032,65536,154861568,65536,154927104,65536,154992640,65536,155058176,65536,155123712,65536,155189248,65536,155254784,65536,155320320,65536,155385856,65536,155451392,65536,
+155516928,65536,155582464,65536,155648000,65536,155713536,65536,155779072,65536,155844608,65536,155910144,65536,155975680,65536,156041216,65536,156106752,65536,156172288,65536,156237824,65536,156303360,65536,156368896,65536,156434432,65536,156499968,65536,156565504,65536,156631040,65536,156696576,65536,156762112,65536,
+156827648,65536,156893184,65536,156958720,65536,157024256,65536,157089792,65536,157155328,65536,157220864,65536,157286400,65536,157351936,65536,157417472,65536,157483008,65536,157548544,65536,157614080,65536,157679616,65536,157745152,65536,157810688,65536,157876224,65536,157941760,65536,158007296,65536,158072832,65536,
+158138368,65536,158203904,65536,158269447,65536,158334976,65536,158400512,65536,158466048,65536,158531584,65536,158597120,65536,158662656,65536,158728192,65536,158793728,65536,158859264,65536,158924800,65536,158990336,65536,159055872,65536,159121408,65536,159186944,65536,159252480,65536,159318016,65536,159383552,65536,
+159449088,65536,159514624,65536,159580160,65536,159645696,65536,159711232,65536,159776768,65536,159842304,65536,159907840,65536,159973376,65536,160038912,65536,160104448,65536,160169984,65536,160235520,65536,160301056,65536,160366592,65536,160432128,65536,160497664,65536,160563200,65536,160628736,65536,160694272,65536,
+160759808,65536,160825344,65536,160890880,65536,160956416,65536,161021952,65536,161087488,65536,161153024,65536,161218560,65536,161284096,65536,161349632,65536,161415168,65536,161480704,65536,161546240,65536,161611776,65536,161677312,65536,161742848,65536,161808384,65536,161873920,65536,147521536,2147549184,163053908,149749760,
+65536,146669568,65536,149815296,65536,147456000,65536,149880832,65536,149946368,65536,150011904,65536,150077440,65536,150142976,65536,150208512,65536,150274048,65536,150339584,65536,150405120,65536,150470656,65536,150536192,65536,150601728,65536,150667264,65536,150732800,65536,150798336,65536,147456000,2147614720,163053908,
+150864209,147521536,131072,147587074,131072,147652610,131072,4587524,131072,147718144,2147614720,163053908,150929746,147783680,131072,147849220,131072,5701636,131072,150994944,2147549184,163053908,151060480,65536,151126016,65536,151191552,65536,151257088,65536,151322624,65536,151388160,65536,151453696,65536,151519232,65536,151584768,65536,
+151650304,65536,151715840,65536,151781376,65536,151846912,65536,151912448,65536,151977984,65536,152043520,65536,152109056,65536,152174592,65536,152240128,65536,152305664,65536,152371200,65536,152436736,65536,152502272,65536,152567808,65536,152633344,65536,152698880,65536,152764416,65536,152829952,65536,152895488,65536,
+152961024,65536,153026560,65536,153092096,65536,153157632,65536,153223168,65536,153288704,65536,153354240,65536,153419776,65536,153485312,65536,153550848,65536,153616384,65536,153681920,65536,153747456,65536,153812992,65536,153878528,65536,153944064,65536,154009600,65536,154075136,65536,154140672,65536,154206208,65536,
+154271744,65536,154337280,65536,154402816,65536,154468352,65536,154533888,65536,154599424,65536,154664960,65536,154730496,65536,154796032,65536,154861568,65536,154927104,65536,154992640,65536,155058176,65536,155123712,65536,155189248,65536,155254784,65536,155320320,65536,155385856,65536,155451392,65536,155516928,65536,
+155582464,65536,155648000,65536,155713536,65536,155779072,65536,155844608,65536,155910144,65536,155975680,65536,156041216,65536,156106752,65536,156172288,65536,156237824,65536,156303360,65536,156368896,65536,156434432,65536,156499968,65536,156565504,65536,156631040,65536,156696576,65536,156762112,65536,156827648,65536,
+156893184,65536,156958720,65536,157024256,65536,157089792,65536,157155328,65536,157220864,65536,157286400,65536,157351936,65536,157417472,65536,157483008,65536,157548544,65536,157614080,65536,157679616,65536,157745152,65536,157810688,65536,157876224,65536,157941760,65536,158007296,65536,158072832,65536,158138368,65536,
+158203904,65536,158269447,65536,158334976,65536,158400512,65536,158466048,65536,158531584,65536,158597120,65536,158662656,65536,158728192,65536,158793728,65536,158859264,65536,158924800,65536,158990336,65536,159055872,65536,159121408,65536,159186944,65536,159252480,65536,159318016,65536,159383552,65536,159449088,65536,
+159514624,65536,159580160,65536,159645696,65536,159711232,65536,159776768,65536,159842304,65536,159907840,65536,159973376,65536,160038912,65536,160104448,65536,160169984,65536,160235520,65536,160301056,65536,160366592,65536,160432128,65536,160497664,65536,160563200,65536,160628736,65536,160694272,65536,160759808,65536,
+160825344,65536,160890880,65536,160956416,65536,161021952,65536,161087488,65536,161153024,65536,161218560,65536,161284096,65536,161349632,65536,161415168,65536,161480704,65536,161546240,65536,161611776,65536,161677312,65536,161742848,65536,161808384,65536,161873920,65536,147521536,2147549184,163119444,149749760,65536,146669568,
+65536,149815296,65536,147456000,65536,149880832,65536,149946368,65536,150011904,65536,150077440,65536,150142976,65536,150208512,65536,150274048,65536,150339584,65536,150405120,65536,150470656,65536,150536192,65536,150601728,65536,150667264,65536,150732800,65536,150798336,65536,147456000,2147614720,163119444,150864209,147521536,
+131072,147587074,131072,147652610,131072,4587524,131072,147718144,2147614720,163119444,150929746,147783680,131072,147849220,131072,5701636,131072,150994944,2147549184,163119444,151060480,65536,151126016,65536,151191552,65536,151257088,65536,151322624,65536,151388160,65536,151453696,65536,151519232,65536,151584768,65536,151650304,65536,
+151715840,65536,151781376,65536,151846912,65536,151912448,65536,151977984,65536,152043520,65536,152109056,65536,152174592,65536,152240128,65536,152305664,65536,152371200,65536,152436736,65536,152502272,65536,152567808,65536,152633344,65536,152698880,65536,152764416,65536,152829952,65536,152895488,65536,152961024,65536,
+153026560,65536,153092096,65536,153157632,65536,153223168,65536,153288704,65536,153354240,65536,153419776,65536,153485312,65536,153550848,65536,153616384,65536,153681920,65536,153747456,65536,153812992,65536,153878528,65536,153944064,65536,154009600,65536,154075136,65536,154140672,65536,154206208,65536,154271744,65536,
+154337280,65536,154402816,65536,154468352,65536,154533888,65536,154599424,65536,154664960,65536,154730496,65536,154796032,65536,154861568,65536,154927104,65536,154992640,65536,155058176,65536,155123712,65536,155189248,65536,155254784,65536,155320320,65536,155385856,65536,155451392,65536,155516928,65536,155582464,65536,
+155648000,65536,155713536,65536,155779072,65536,155844608,65536,155910144,65536,155975680,65536,156041216,65536,156106752,65536,156172288,65536,156237824,65536,156303360,65536,156368896,65536,156434432,65536,156499968,65536,156565504,65536,156631040,65536,156696576,65536,156762112,65536,156827648,65536,156893184,65536,
+156958720,65536,157024256,65536,157089792,65536,157155328,65536,157220864,65536,157286400,65536,157351936,65536,157417472,65536,157483008,65536,157548544,65536,157614080,65536,157679616,65536,157745152,65536,157810688,65536,157876224,65536,157941760,65536,158007296,65536,158072832,65536,158138368,65536,158203904,65536,
+158269447,65536,158334976,65536,158400512,65536,158466048,65536,158531584,65536,158597120,65536,158662656,65536,158728192,65536,158793728,65536,158859264,65536,158924800,65536,158990336,65536,159055872,65536,159121408,65536,159186944,65536,159252480,65536,159318016,65536,159383552,65536,159449088,65536,159514624,65536,
+159580160,65536,159645696,65536,159711232,65536,159776768,65536,159842304,65536,159907840,65536,159973376,65536,160038912,65536,160104448,65536,160169984,65536,160235520,65536,160301056,65536,160366592,65536,160432128,65536,160497664,65536,160563200,65536,160628736,65536,160694272,65536,160759808,65536,160825344,65536,
+160890880,65536,160956416,65536,161021952,65536,161087488,65536,161153024,65536,161218560,65536,161284096,65536,161349632,65536,161415168,65536,161480704,65536,161546240,65536,161611776,65536,161677312,65536,161742848,65536,161808384,65536,161873920,65536,161939456,2147549184,163184981,151453696,65536,151781376,65536,1179650,
+65536,4587522,65536,161939456,65537,151453696,65537,151781376,65537,1179650,65537,4587522,65537,161939456,65538,151453696,65538,151781376,65538,1179650,65538,4587522,65538,161939456,65539,151453696,65539,151781376,65539,1179650,65539,4587522,65539,161939456,65540,151453696,65540,151781376,65540,1179650,
+65540,4587522,65540,161939456,65541,151453696,65541,151781376,65541,1179650,65541,4587522,65541,161939456,65542,151453696,65542,151781376,65542,1179650,65542,4587522,65542,161939456,65543,151453696,65543,151781376,65543,1179650,65543,4587522,65543,161939456,65544,151453696,65544,151781376,65544,1179650,
+65544,4587522,65544,161939456,65545,151453696,65545,151781376,65545,1179650,65545,4587522,65545,161939456,65546,151453696,65546,151781376,65546,1179650,65546,4587522,65546,161939456,65547,151453696,65547,151781376,65547,1179650,65547,4587522,65547,161939456,65548,151453696,65548,151781376,65548,1179650,
+65548,4587522,65548,161939456,65549,151453696,65549,151781376,65549,1179650,65549,4587522,65549,161939456,65550,151453696,65550,151781376,65550,1179650,65550,4587522,65550,161939456,65551,151453696,65551,151781376,65551,1179650,65551,4587522,65551,161939456,65552,151453696,65552,151781376,65552,1179650,
+65552,4587522,65552,161939456,65553,151453696,65553,151781376,65553,1179650,65553,4587522,65553,161939456,65554,151453696,65554,151781376,65554,1179650,65554,4587522,65554,161939456,65555,151453696,65555,151781376,65555,1179650,65555,4587522,65555,163250180,2147483648,4587524,0,4,343,0,
+65879,0,163315712,0,98893845,0,5,344,0,65880,0,163381248,0,1179648,0,7995392,0,5,1179652,0,4587524,0,47316999,0,163446791,0,40304647,0,8,163512327,0,163577863,0,163643399,0,163708935,0,163774471,0,163840007,
+0,1179650,0,24444930,0,352,2555908,0,2621444,0,1179652,0,163905540,0,163971076,0,164036608,0,164102144,0,164167680,0,164233216,0,164298752,0,164364288,0,164429824,0,164495360,0,164560896,0,164626432,0,164691972,0,164757506,0,
+164823042,0,164888578,0,164954114,0,165019650,0,165085186,0,165150724,0,165216260,0,165281796,0,165347330,0,165412866,0,165478404,0,165543940,0,165609476,0,165675012,0,165740548,0,143458308,0,165806084,0,165871623,0,165937156,0,166002688,0,
+5701632,0,166068226,0,166133762,0,166199298,0,166264832,0,196619,2147549184,166330382,262155,65536,196619,2147549184,166395918,262155,65536,196619,2147549184,166461454,262155,65536,196619,2147549184,166526990,262155,65536,196619,2147549184,166592526,262155,65536,196619,2147549184,166658062,262155,65536,
+196619,2147549184,166723598,262155,65536,166789120,2147483648,166854658,0,166920194,0,166985730,0,167051266,0,167116802,0,167182338,0,167247874,0,167313410,0,1179652,2147549184,167379289,4587524,65536,47316999,65536,163446791,65536,40304647,65536,1179652,65537,4587524,65537,47316999,65537,
+163446791,65537,40304647,65537,1179652,65538,4587524,65538,47316999,65538,163446791,65538,40304647,65538,167444482,2147483648,167510018,0,167575554,0,167641090,0,167706626,0,167772162,0,167837698,0,167903234,0,167968772,0,168034308,0,168099847,0,168165378,0,168230914,0,
+168296450,0,168361986,0,168427522,0,168493058,0,168558594,0,168624130,0,168689666,0,168755200,0,168820736,0,168886272,0,168951808,0,103284736,0,169017344,0,169082884,0,169148423,0,169213954,0,169279490,0,169345026,0,169410562,0,169476098,0,
+169541634,0,169607175,0,169672711,0,169738247,0,169803780,0,169869314,0,169934850,0,170000391,0,118292482,0,118358018,0,170065922,0,106299394,0,17301506,2147549184,170131515,4390914,65536,17367040,65536,17432576,65536,17498112,65536,17563648,65536,14417927,2147614720,170131515,
+17629242,14483463,131072,14548999,131072,17235975,131072,4653063,131072,4390916,131072,14417927,131073,14483463,131073,14548999,131073,17235975,131073,4653063,131073,4390916,131073,14417927,131074,14483463,131074,14548999,131074,17235975,131074,4653063,131074,4390916,131074,14417927,131075,14483463,131075,14548999,
+131075,17235975,131075,4653063,131075,4390916,131075,14417927,131076,14483463,131076,14548999,131076,17235975,131076,4653063,131076,4390916,131076,14417927,131077,14483463,131077,14548999,131077,17235975,131077,4653063,131077,4390916,131077,14417927,131078,14483463,131078,14548999,131078,17235975,131078,4653063,
+131078,4390916,131078,14417927,131079,14483463,131079,14548999,131079,17235975,131079,4653063,131079,4390916,131079,14417927,131080,14483463,131080,14548999,131080,17235975,131080,4653063,131080,4390916,131080,14417927,131081,14483463,131081,14548999,131081,17235975,131081,4653063,131081,4390916,131081,14417927,
+131082,14483463,131082,14548999,131082,17235975,131082,4653063,131082,4390916,131082,14417927,131083,14483463,131083,14548999,131083,17235975,131083,4653063,131083,4390916,131083,14417927,131084,14483463,131084,14548999,131084,17235975,131084,4653063,131084,4390916,131084,14417927,131085,14483463,131085,14548999,
+131085,17235975,131085,4653063,131085,4390916,131085,14417927,131086,14483463,131086,14548999,131086,17235975,131086,4653063,131086,4390916,131086,14417927,131087,14483463,131087,14548999,131087,17235975,131087,4653063,131087,4390916,131087,14417927,131088,14483463,131088,14548999,131088,17235975,131088,4653063,
+131088,4390916,131088,14417927,131089,14483463,131089,14548999,131089,17235975,131089,4653063,131089,4390916,131089,14417927,131090,14483463,131090,14548999,131090,17235975,131090,4653063,131090,4390916,131090,14417927,131091,14483463,131091,14548999,131091,17235975,131091,4653063,131091,4390916,131091,14417927,
+131092,14483463,131092,14548999,131092,17235975,131092,4653063,131092,4390916,131092,14417927,131093,14483463,131093,14548999,131093,17235975,131093,4653063,131093,4390916,131093,14417927,131094,14483463,131094,14548999,131094,17235975,131094,4653063,131094,4390916,131094,14417927,131095,14483463,131095,14548999,
+131095,17235975,131095,4653063,131095,4390916,131095,14417927,131096,14483463,131096,14548999,131096,17235975,131096,4653063,131096,4390916,131096,14417927,131097,14483463,131097,14548999,131097,17235975,131097,4653063,131097,4390916,131097,14417927,131098,14483463,131098,14548999,131098,17235975,131098,4653063,
+131098,4390916,131098,14417927,131099,14483463,131099,14548999,131099,17235975,131099,4653063,131099,4390916,131099,14417927,131100,14483463,131100,14548999,131100,17235975,131100,4653063,131100,4390916,131100,14417927,131101,14483463,131101,14548999,131101,17235975,131101,4653063,131101,4390916,131101,14417927,
+131102,14483463,131102,14548999,131102,17235975,131102,4653063,131102,4390916,131102,14417927,131103,14483463,131103,14548999,131103,17235975,131103,4653063,131103,4390916,131103,170196999,2147483648,170262535,0,170328066,0,170393600,0,4587520,0,170459136,0,170524672,0,170590208,0,170655748,
+0,170721284,0,170786823,0,170852359,0,170917892,0,170983426,0,171048962,0,171114498,0,171180034,0,171245570,0,171311106,0,163512327,2147549184,171376986,163577863,65536,163643399,65536,163708935,65536,163774471,65536,163840007,65536,1179650,65536,24444930,65536,171442178,2147483648,
+171507712,0,38,11,2147549184,2097174,65547,65536,1572886,65536,1638423,65536,1703936,65536,1179650,65536,1769474,65536,1835010,65536,1900548,65536,1966084,65536,2031637,65536,196619,2147549184,171573262,262155,65536,196619,2147549184,171638798,262155,65536,196619,2147549184,171704334,262155,
+65536,196619,2147549184,128122894,262155,65536,9502765,2147483648,171769901,0,171835394,0,171900930,0,171966464,0,77398016,0,172032000,0,172097536,0,172163072,0,172228608,0,172294144,0,172359680,0,172425216,0,172490752,0,51314688,0,172556290,0,172621826,0,
+172687644,0,172752907,0,7,349,0,65885,0,172818781,0,327682,2147549184,172883983,393218,65536,1179650,2147483648,47054850,0,7,350,0,65886,0,172949853,0,173015389,0,103677954,0,1179650,0,4587524,0,20,351,0,65887,0,
+173080928,0,136773985,0,173146112,0,173211648,0,173277184,0,173342724,0,173408260,0,173473796,0,173539332,0,173604866,0,4587522,0,1179650,0,173670402,0,173735938,0,173801474,0,173867012,0,173932895,0,173998091,0,3,354,0,65890,
+0,174063616,0,15,355,0,65891,0,173080932,0,174129152,0,174194692,0,1179652,0,174260228,0,174325764,0,174391300,0,174456836,0,174522368,0,174587908,0,174653444,0,2031637,0,174719333,0,5,358,0,65894,0,174784512,
+0,54984706,0,19529730,0,30,359,0,65895,0,172949853,0,173015389,0,174850397,0,174915933,0,174981468,0,524292,2147549184,3604498,589828,65536,655364,65536,720900,65536,128188416,2147483648,175046656,0,131792898,0,131858434,0,175112194,0,172097538,
+0,1179650,0,175177730,0,171966464,0,4587520,0,173080936,0,196619,2147549184,175243278,262155,65536,196619,2147549184,128122894,262155,65536,196619,2147549184,175308814,262155,65536,196619,2147549184,175374350,262155,65536,84,361,0,65897,0,524295,2147614720,132317472,17301523,
+589831,131072,655367,131072,720903,131072,524295,2147614720,132317472,4390931,589831,131072,655367,131072,720903,131072,524292,2147614720,132317472,130940946,589828,131072,655364,131072,720900,131072,524292,2147614720,132317472,131006482,589828,131072,655364,131072,720900,131072,524292,2147614720,132317472,131072018,
+589828,131072,655364,131072,720900,131072,131137543,2147549184,132317472,131203079,65536,131268615,65536,131334151,65536,131399682,65536,131465218,65536,131530754,65536,131596290,65536,131661826,65536,1179650,65536,131727362,65536,131792898,65536,131858434,65536,131923970,65536,131989506,65536,129171458,65536,132055047,
+65536,132120580,65536,132186116,65536,126615841,65536,126681372,65536,524292,2147549184,175439890,589828,65536,655364,65536,720900,65536,524292,2147549184,175505426,589828,65536,655364,65536,720900,65536,131792898,2147483648,131858434,0,175570946,0,175636482,0,175702018,0,1179650,0,43253767,
+0,173473794,0,173539330,0,172032002,0,175767554,0,172359682,0,175833090,0,175898626,0,4587522,0,173080938,0,196619,2147549184,175964174,262155,65536,196619,2147549184,176029710,262155,65536,196619,2147549184,176095246,262155,65536,196619,2147549184,176160782,262155,65536,196619,
+2147549184,176226318,262155,65536,196619,2147549184,175308814,262155,65536,196619,2147549184,176291854,262155,65536,176357660,2147483648,176422912,0,176488459,0,12,176553984,0,176619522,0,176685058,0,176750594,0,51314688,0,176816476,0,176881709,0,176947204,0,177012740,0,177078282,
+0,177143808,0,144506880,0,3,364,0,65900,0,10354735,0,3,137101312,0,177209348,0,177274884,0,4,140181508,0,177340420,0,140574724,0,177405956,0,2,177471492,0,177537028,0,5,177602567,0,177668103,0,177733639,0,
+1179652,0,4587524,0,10,177799168,0,135200768,0,10354735,0,177864706,0,99483650,0,177930242,0,177995778,0,178061314,0,178126848,0,12517376,0,13,370,0,65906,0,1900548,0,178192388,0,178257924,0,178323460,0,178389357,0,
+177799168,0,71172465,0,178454894,0,178520431,0,178585968,0,1245184,2147549184,12386358,58,371,0,65907,0,178651147,0,1638411,0,1245184,0,1179652,0,1048580,0,1441796,0,51380228,0,178716676,0,178782212,0,178257924,0,178323460,0,
+178847748,0,18219012,0,178913284,0,178978820,0,179044359,0,179109895,0,179175431,0,179240962,0,179306498,0,179372036,0,179437572,0,179503474,0,5505057,0,9502765,0,179568669,0,125174036,0,134742319,0,196619,2147549184,10485774,262155,65536,179634183,
+2147483648,179699719,0,179765619,0,179831155,0,179896691,0,196619,2147549184,179961870,262155,65536,180027764,2147483648,180092939,0,82771975,0,180158471,0,180224007,0,180289543,0,180355083,0,180420612,0,180486148,0,180551684,0,180617223,0,9764868,0,12451840,0,
+3080192,0,12648448,0,12779575,0,98893845,0,196619,2147549184,71958542,262155,65536,5,373,0,65909,0,180682766,0,180748659,0,180813828,0,17,180879374,0,196619,2147549184,179961870,262155,65536,196619,2147549184,180944910,262155,65536,181010803,2147483648,181075968,
+0,181141504,0,181207040,0,181272580,0,181338116,0,181403652,0,181469188,0,524295,2147549184,181534739,589831,65536,655367,65536,720903,65536,4,181600263,0,54460423,0,181665794,0,181731330,0,6,181796871,0,181862407,0,181927943,0,181993479,0,
+182059012,0,182124548,0,8,182190087,0,182255623,0,182321159,0,182386695,0,182452231,0,54198276,0,182517764,0,182583300,0,2,108462087,0,4587527,0,5,182648839,0,182714375,0,6160388,0,51445764,0,182779908,0,2,182845447,0,
+182910983,0,10,182976512,0,183042052,0,183107591,0,183173127,0,144244743,0,183238663,0,1179648,0,131727360,0,42991616,0,12517376,0,9,381,0,65917,0,1048580,0,1179652,0,1245184,0,183304196,0,183369732,0,183435635,0,
+183501103,0,15,381,2147549184,50463101,65917,65536,1048580,65536,1179652,65536,1245184,65536,183304196,65536,183369732,65536,183435635,65536,183501103,65536,177602567,2147549184,183566704,177668103,65536,177733639,65536,1179652,65536,4587524,65536,183631879,2147483648,73,381,2147549184,50463101,65917,
+65536,1048580,65536,1179652,65536,1245184,65536,183304196,65536,183369732,65536,183435635,65536,183501103,65536,1179652,2147549184,183697471,4390916,65536,222101508,65536,222167044,65536,524295,2147614720,183697471,222232595,589831,131072,655367,131072,720903,131072,524295,2147614720,183697471,222298131,589831,131072,
+655367,131072,720903,131072,81395714,2147614720,183697471,222364205,1179650,131072,91422727,131072,221511687,131072,221577223,131072,221642759,131072,221708295,131072,221774380,131072,221839916,131072,221905452,131072,221970439,131072,222035975,131072,81395714,131073,1179650,131073,91422727,131073,221511687,131073,221577223,131073,
+221642759,131073,221708295,131073,221774380,131073,221839916,131073,221905452,131073,221970439,131073,222035975,131073,81395714,131074,1179650,131074,91422727,131074,221511687,131074,221577223,131074,221642759,131074,221708295,131074,221774380,131074,221839916,131074,221905452,131074,221970439,131074,222035975,131074,81395714,131075,
+1179650,131075,91422727,131075,221511687,131075,221577223,131075,221642759,131075,221708295,131075,221774380,131075,221839916,131075,221905452,131075,221970439,131075,222035975,131075,222429191,2147549184,183697471,222494727,65536,222560263,65536,222625799,65536,73,381,2147549184,50463101,65917,65536,1048580,65536,1179652,
+65536,1245184,65536,183304196,65536,183369732,65536,183435635,65536,183501103,65536,1179652,2147549184,183697471,4390916,65536,222101508,65536,222167044,65536,524295,2147614720,183697471,222232595,589831,131072,655367,131072,720903,131072,524295,2147614720,183697471,222298131,589831,131072,655367,131072,720903,131072,
+81395714,2147614720,183697471,222364205,1179650,131072,91422727,131072,221511687,131072,221577223,131072,221642759,131072,221708295,131072,221774380,131072,221839916,131072,221905452,131072,221970439,131072,222035975,131072,81395714,131073,1179650,131073,91422727,131073,221511687,131073,221577223,131073,221642759,131073,221708295,131073,
+221774380,131073,221839916,131073,221905452,131073,221970439,131073,222035975,131073,81395714,131074,1179650,131074,91422727,131074,221511687,131074,221577223,131074,221642759,131074,221708295,131074,221774380,131074,221839916,131074,221905452,131074,221970439,131074,222035975,131074,81395714,131075,1179650,131075,91422727,131075,
+221511687,131075,221577223,131075,221642759,131075,221708295,131075,221774380,131075,221839916,131075,221905452,131075,221970439,131075,222035975,131075,222429191,2147549184,183697471,222494727,65536,222560263,65536,222625799,65536,11,381,2147549184,50463101,65917,65536,1048580,65536,1179652,65536,1245184,65536,183304196,
+65536,183369732,65536,183435635,65536,183501103,65536,21037063,2147483648,21102599,0,9,381,2147549184,50463101,65917,65536,1048580,65536,1179652,65536,1245184,65536,183304196,65536,183369732,65536,183435635,65536,183501103,65536,11,381,2147549184,50463101,65917,65536,1048580,65536,1179652,
+65536,1245184,65536,183304196,65536,183369732,65536,183435635,65536,183501103,65536,183762951,2147483648,4587527,0,17,381,2147549184,50463101,65917,65536,1048580,65536,1179652,65536,1245184,65536,183304196,65536,183369732,65536,183435635,65536,183501103,65536,183828487,2147483648,9699335,0,183894023,
+0,183959559,0,21102599,0,184025095,0,184090631,0,1048580,0,6,184156221,0,184221757,0,184287293,0,184352829,0,184418365,0,184483901,0,6,389,0,65925,0,1048578,0,1179650,0,184549378,0,3932162,0,8,390,0,
+65926,0,1048578,0,1179650,0,184549378,0,3932162,0,1441799,0,9764871,0,45,391,0,65927,0,1048578,0,1179650,0,184549378,0,17956866,0,85524482,0,184614914,0,184680455,0,184745991,0,55377927,0,184811524,0,5636100,
+0,51576836,0,184877063,0,184942599,0,185008135,0,185073671,0,185139207,0,185204743,0,55181319,0,23330823,0,185270279,0,185335815,0,4587527,0,185401351,0,185466887,0,185532423,0,185597954,0,185663490,0,185729026,0,185794562,0,185860098,
+0,185925634,0,185991170,0,186056706,0,38993922,0,186122242,0,38797314,0,186187778,0,186253312,0,186318848,0,17825799,0,186384776,0,35848266,0,16,393,0,65929,0,1048578,0,1179650,0,184549378,0,17956866,0,54853639,0,
+54919175,0,54984711,0,42467335,0,55050247,0,55115783,0,186449927,0,55181319,0,55312391,0,55377927,0,5,1048578,0,186515458,0,1179650,0,186580994,0,142606358,0,3,4849668,0,186646532,0,131366,0,7,395,0,65931,
+0,1245184,0,1048578,0,1179650,0,1376260,0,138477579,0,5,1245184,0,24969223,0,186712071,0,186777604,0,4587524,0,6,1048578,0,1179650,0,4718594,0,24510466,0,186843136,0,186908672,0,4,1245184,0,186974281,0,
+24969223,0,4587527,0,6,183828482,0,187039746,0,1048578,0,187105282,0,187170816,0,187236352,0,5,1048580,0,4587524,0,1245184,0,187301888,0,187367424,0,3,1048580,0,4587524,0,1245184,0,4,187432962,0,187498498,0,
+1179650,0,4587522,0,6,1245184,0,187564032,0,187629570,0,55181314,0,24510466,0,5701634,0,5,1245184,0,54460423,0,91422727,0,1179650,0,52363266,0,3,1245184,0,51576836,0,187432964,0,7,1245184,0,91422727,0,
+186843136,0,186908672,0,24510466,0,4718594,0,187695108,0,4,187760640,0,187826176,0,1048580,0,52690951,0,3,187891741,0,187957248,0,188022784,0,18,409,0,65945,0,1048578,0,188088322,0,1179650,0,188153858,0,188219394,
+0,188284930,0,4718594,0,5701634,0,1245184,0,131083,0,188350874,0,3145757,0,111935490,0,48955394,0,188416002,0,4587522,0,11,1245184,0,1048576,0,188481536,0,1179650,0,52363266,0,188547074,0,188612612,0,188678148,0,
+188743684,0,188809220,0,188874756,0,1,188940288,0,4,140116006,0,163315712,0,24510468,0,1179652,0,18,410,0,65946,0,189006234,0,1048578,0,1179650,0,189071362,0,188284930,0,188088322,0,189136898,0,5701634,0,35651586,
+0,1245184,0,131083,0,188350878,0,189202841,0,917506,0,189267970,0,189333508,0,3,53477380,0,4587524,0,3145757,0,15,189399246,0,1048578,0,1179650,0,184680455,0,184745991,0,1245184,0,189464576,0,189530114,0,189595650,
+0,10289154,0,189661186,0,189726722,0,180551682,0,189792263,0,189857799,0,8,189923335,0,189988871,0,190054407,0,190119943,0,190185479,0,190251015,0,190316551,0,190382087,0,20,1179650,0,190447618,0,4718596,0,5701636,0,190513154,
+0,82771975,0,180158471,0,180027764,0,189923335,2147549184,190579105,189988871,65536,190054407,65536,190119943,65536,190185479,65536,190251015,65536,190316551,65536,190382087,65536,1048578,2147483648,103284738,0,25952258,0,190644226,0,14,53477380,0,1048578,0,1179650,0,3145757,
+0,190709847,0,1245184,0,190775303,0,190840839,0,74055687,0,190906370,0,190971906,0,73400322,0,73334786,0,4587524,0,5,1048578,0,4718594,0,4587524,0,9502765,0,110755869,0,5,4587524,0,1048580,0,1245184,0,187301888,
+0,3145757,0,13,1179650,0,1048578,0,188088322,0,74121218,0,191037447,0,191102983,0,24444935,0,19529735,0,72220679,0,72482823,0,191168519,0,191234055,0,191299613,0,10,1179650,0,1048578,0,184680455,0,184745991,0,1245184,
+0,189464576,0,4718594,0,5701634,0,35651586,0,103284738,0,8,3145757,0,54984711,0,191365127,0,191430663,0,74121223,0,4718594,0,52363266,0,5701639,0,12,1048578,0,24510466,0,1179650,0,55181314,0,53477378,0,191496194,
+0,4587524,0,191561735,0,191627271,0,191692807,0,191758343,0,191823872,0,9,1179650,0,1048578,0,184680452,0,184745988,0,1245184,0,24444930,0,4390914,0,191889410,0,191954946,0,7,51576836,0,192020484,0,192086020,0,192151556,
+0,192217095,0,192282631,0,186843136,0,7,192348160,0,192413725,0,187957248,0,192479234,0,4718594,0,5701636,0,188022784,0,6,1179650,0,1048578,0,184680452,0,184745988,0,192544768,0,192610304,0,1,1179652,0,6,40239104,
+0,1048578,0,1179650,0,192675844,0,192741383,0,140116006,0,4,3080192,0,1179650,0,1048580,0,3145757,0,2,1048580,0,131072004,0,8,187760640,0,187826176,0,1048580,0,39518215,0,69074951,0,4587527,0,60227613,0,
+192806941,0,11,12517376,0,1179648,0,192872450,0,1048580,0,24969223,0,192937991,0,193003527,0,193069063,0,193134596,0,60227613,0,193200157,0,7,1048578,0,1179650,0,193265668,0,193331207,0,193396743,0,193462279,0,193527815,0,
+10,414,0,65950,0,189006238,0,1048578,0,1179650,0,188088322,0,193593346,0,1245184,0,131083,0,3145757,0,28,11,2147549184,2097174,65547,65536,1572886,65536,1638423,65536,1703936,65536,1179650,65536,1769474,65536,1835010,65536,1900548,
+65536,1966084,65536,2031637,65536,2228224,2147483648,2424857,0,193658891,0,193724441,0,5505057,0,82771975,0,7667719,0,180158471,0,189923335,0,189988871,0,70582279,0,6160388,0,4587524,0,10420235,0,193789963,0,124321803,0,193855499,0,6,
+437,0,65973,0,3145757,0,193921035,0,18284546,0,51314688,0,16,11,2147549184,2097174,65547,65536,1572886,65536,1638423,65536,1703936,65536,1179650,65536,1769474,65536,1835010,65536,1900548,65536,1966084,65536,2031637,65536,196619,2147549184,193986574,262155,
+65536,11599898,2147483648,10289156,0,194052103,0,37,438,0,65974,0,98893845,0,2359734,0,196619,2147549184,194117646,262155,65536,1245184,2147483648,194183175,0,194248711,0,194314247,0,194379783,0,1179652,0,194445319,0,194510855,0,194576391,0,194641927,
+0,24969223,0,39518215,0,194707463,0,51445767,0,194772999,0,194838535,0,194904071,0,194969607,0,195035143,0,195100679,0,195166215,0,195231751,0,195297287,0,195362823,0,195428359,0,195493895,0,195559431,0,13828103,0,10289156,0,195624962,
+0,4718594,0,39,11,2147549184,2097174,65547,65536,1572886,65536,1638423,65536,1703936,65536,1179650,65536,1769474,65536,1835010,65536,1900548,65536,1966084,65536,2031637,65536,5177380,2147483648,196619,2147549184,195690510,262155,65536,196619,2147549184,195756046,262155,65536,195821582,
+2147483648,195887542,0,195953080,0,196018187,0,1179652,0,128974852,0,196083716,0,4587524,0,55443458,0,132907010,0,196149252,0,10289156,0,196214788,0,196280322,0,196345858,0,196411394,0,196476930,0,196542468,0,196608004,0,196673540,0,196739076,
+0,196804612,0,196870148,0,2,48234503,0,1179652,0,7,196936121,0,51445764,0,197001220,0,197066756,0,7536647,0,197132292,0,1179652,0,16,197197828,0,197263364,0,197328900,0,197394436,0,197459970,0,197525506,0,197591042,0,
+18284546,0,197656578,0,197722114,0,197787650,0,197853186,0,197918724,0,197984260,0,198049796,0,198115332,0,57,442,0,65978,0,98893845,0,196619,2147549184,76480526,262155,65536,1245184,2147483648,1179650,0,198180866,0,73269250,0,198246402,0,
+198311936,0,198377472,0,42074112,0,198443008,0,198508544,0,198574518,0,2359738,0,198640058,0,196619,2147549184,198705166,262155,65536,196619,2147549184,198770702,262155,65536,71696594,2147483648,198836253,0,198902202,0,198967303,0,11403264,0,23855111,0,13828103,0,
+199032839,0,38141959,0,72613895,0,72744967,0,75235330,0,4587522,0,199098375,0,199163911,0,72941575,0,199229447,0,199294983,0,199360519,0,199426055,0,199491591,0,199557127,0,199622663,0,199688199,0,195100679,0,195166215,0,195231751,0,
+195297287,0,195362823,0,195428359,0,195493895,0,195559431,0,199754170,0,199819706,0,199884811,0,33,196619,2147549184,199950350,262155,65536,200015956,2147483648,1179650,0,4587522,0,200081412,0,4718596,0,5767175,0,200146951,0,200212487,0,196619,2147549184,
+200278030,262155,65536,200343556,2147483648,200409092,0,200474635,0,200540171,0,197197828,2147549184,71631057,197263364,65536,197328900,65536,197394436,65536,197459970,65536,197525506,65536,197591042,65536,18284546,65536,197656578,65536,197722114,65536,197787650,65536,197853186,65536,197918724,65536,197984260,65536,
+198049796,65536,198115332,65536,200605696,2147483648,1,200409092,0,12,200409092,0,188874759,0,200671234,0,200736770,0,200802311,0,200867847,0,57933826,0,1179650,0,200933383,0,200998919,0,201064455,0,201129991,0,12,445,0,65981,0,196619,
+2147549184,201195534,262155,65536,1179652,2147483648,201261060,0,1245184,0,161939456,2147549184,201326933,151453696,65536,151781376,65536,1179650,65536,4587522,65536,23,11,2147549184,2097174,65547,65536,1572886,65536,1638423,65536,1703936,65536,1179650,65536,1769474,65536,1835010,65536,1900548,
+65536,1966084,65536,2031637,65536,196619,2147549184,201392142,262155,65536,196619,2147549184,199950350,262155,65536,196619,2147549184,201457678,262155,65536,196619,2147549184,124125198,262155,65536,1179652,2147483648,201523204,0,201588740,0,4587524,0,9,70516758,0,196619,2147549184,199950350,262155,
+65536,201654346,2147483648,201719808,0,201785348,0,1179652,0,201850884,0,4587524,0,62,287,0,65823,0,196619,2147549184,128122894,262155,65536,128188420,2147483648,128253959,0,128319490,0,524295,2147614720,132317472,17301523,589831,131072,655367,131072,720903,131072,524295,
+2147614720,132317472,4390931,589831,131072,655367,131072,720903,131072,524292,2147614720,132317472,130940946,589828,131072,655364,131072,720900,131072,524292,2147614720,132317472,131006482,589828,131072,655364,131072,720900,131072,524292,2147614720,132317472,131072018,589828,131072,655364,131072,720900,131072,131137543,
+2147549184,132317472,131203079,65536,131268615,65536,131334151,65536,131399682,65536,131465218,65536,131530754,65536,131596290,65536,131661826,65536,1179650,65536,131727362,65536,131792898,65536,131858434,65536,131923970,65536,131989506,65536,129171458,65536,132055047,65536,132120580,65536,132186116,65536,126615841,65536,
+126681372,65536,71368910,2147483648,70516758,2147549184,201916712,196619,2147614720,201916712,199950350,262155,131072,201654346,2147549184,201916712,201719808,65536,201785348,65536,1179652,65536,201850884,65536,4587524,65536,24510464,2147483648,133824512,0,1179650,0,201981959,0,9,447,0,65983,0,202047933,
+0,5505057,0,196619,2147549184,71761934,262155,65536,1179652,2147483648,1245184,0,171966468,0,5,448,0,65984,0,5505057,0,1179650,0,202113024,0,14,449,0,65985,0,131083,0,1048578,0,1179650,0,202178560,0,202244096,0,
+1245184,0,4587522,0,202309639,0,202375175,0,5505057,0,202440711,0,202506247,0,9,450,0,65986,0,202571805,0,55640064,0,202637319,0,53673986,0,1179650,0,1048578,0,202702850,0,8,140116006,0,98893845,0,1179652,0,
+202768388,0,196619,2147549184,202833934,262155,65536,202571805,2147483648,55640064,0,15,202571805,0,202899458,0,1179650,0,202964994,0,203030530,0,55640064,0,203096093,0,203161600,0,203227143,0,39518215,0,203292679,0,203358215,0,1048578,0,24510466,0,
+24969223,0,10,202571805,0,196935687,0,203423746,0,203489282,0,1179650,0,203554818,0,203620359,0,203685895,0,203751431,0,203816967,0,6,202571805,0,203882500,0,203948036,0,6160388,0,4587524,0,55640064,0,4,202571805,0,1179652,
+0,203882500,0,55640064,0,4,202571805,0,1179652,0,203882500,0,55640064,0,4,202571805,0,1179652,0,203882500,0,55640064,0,2,1179652,0,82771975,0,2,202571805,0,55640064,0,10,202571805,0,204013572,0,9699335,0,
+1179652,0,139853826,0,204079106,0,4718594,0,5701634,0,204144647,0,55640064,0,10,202571805,0,1048578,0,86048770,0,51380228,0,184745988,0,191365127,0,191430663,0,1179652,0,189399246,0,55640064,0,4,202571805,0,73334788,0,
+204210180,0,55640064,0,4,202571805,0,73334788,0,4587524,0,55640064,0,6,202571805,0,9699335,0,60948487,0,204275716,0,73334786,0,73400322,0,10,202571805,0,1179652,0,204341252,0,204406788,0,204472327,0,203620359,0,203685895,
+0,203751431,0,203816967,0,55640064,0,16,202571805,0,198639645,0,1048580,0,204537863,0,204603399,0,204668935,0,204734471,0,204800007,0,204865543,0,204931079,0,204996615,0,205062151,0,1179650,0,4587522,0,4718594,0,5701634,0,
+3,202571805,0,1179652,0,38993924,0,5,202571805,0,1179652,0,4587524,0,205127687,0,55640064,0,18,202571805,0,55640064,0,205193218,0,205258754,0,205324288,0,205389824,0,205455367,0,205520903,0,205586439,0,205651975,0,205717511,
+0,205783047,0,205848583,0,205914119,0,205979655,0,206045191,0,206110727,0,206176263,0,5,202571805,0,55640064,0,51970055,0,206241794,0,1179650,0,8,524295,0,589831,0,655367,0,720903,0,206307335,0,206372871,0,1179650,
+0,38993922,0,8,524295,0,589831,0,655367,0,720903,0,206307335,0,206372871,0,1179650,0,38993922,0,8,524295,0,589831,0,655367,0,720903,0,206307335,0,206372871,0,1179650,0,38993922,0,7,202571805,0,
+55640064,0,24969223,0,25755655,0,1179650,0,24510466,0,4587524,0,7,60227613,0,24969223,0,60489730,0,60686336,0,206438400,0,60620807,0,40239104,0,7,125174036,0,206503936,0,1179652,0,206569476,0,206635008,0,110755869,0,
+206700573,0,3,125174036,0,1179652,0,4587524,0,6,125174036,0,1179652,0,4587524,0,206635008,0,205127687,0,110755869,0,3,68616388,0,68681925,0,68747264,0,10,480,0,66016,0,1048578,0,1179650,0,206766080,0,
+20905991,0,20971527,0,201195522,0,206831618,0,3145757,0,23,481,0,66017,0,1179650,0,24510466,0,206897154,0,206962690,0,5505057,0,189399246,0,13172765,0,51380231,0,184745991,0,207028231,0,207093767,0,207159303,0,207224839,
+0,54722567,0,65142791,0,189530119,0,207290375,0,207355904,0,207421440,0,196619,2147549184,71958542,262155,65536,11,40304647,0,191365127,0,191430663,0,131083,0,207486978,0,207552514,0,207618050,0,207683586,0,207749122,0,207814658,0,3080194,
+0,35,483,0,66019,0,207880675,0,98893845,0,207945728,0,1245184,0,208011275,0,1048578,0,1179650,0,208076802,0,208142338,0,208208356,0,174063616,0,208273415,0,208338951,0,208404491,0,208470018,0,208535554,0,4587524,0,
+10420235,0,208601092,0,208666628,0,208732643,0,208798181,0,40304647,2147549184,208863714,191365127,65536,191430663,65536,131083,65536,207486978,65536,207552514,65536,207618050,65536,207683586,65536,207749122,65536,207814658,65536,3080194,65536,61,486,0,66022,0,208929254,0,
+98893845,0,208208359,0,174063616,0,1245184,0,1179652,0,1048578,0,4587522,0,178192386,0,48955394,0,208994306,0,140312578,0,208470018,0,186515458,0,7536647,0,196619,2147549184,189071374,262155,65536,196619,2147549184,209059854,262155,65536,2359782,2147483648,
+142606358,0,208011275,0,209125862,0,196619,2147549184,209190926,262155,65536,208273415,2147483648,208338951,0,42467335,0,54984711,0,209256455,0,209321991,0,209387527,0,209453063,0,209518599,0,209584132,0,209649664,0,209715202,0,209780738,0,209846279,0,209911815,
+0,209977346,0,210042882,0,210108427,0,524295,2147549184,210173971,589831,65536,655367,65536,720903,65536,524295,2147549184,210239507,589831,65536,655367,65536,720903,65536,524295,2147549184,210305043,589831,65536,655367,65536,720903,65536,210370562,2147483648,210436098,0,5701636,0,
+210502120,0,1,52690948,0,3,52690948,2147549184,183828803,1769474,2147483648,4587522,0,7,52690948,2147614720,210567657,183828803,1769474,2147549184,210567657,4587522,65536,210632704,2147483648,210698242,0,210763778,0,4587524,0,8,485,0,66021,0,210829798,0,210895334,0,
+210960867,0,211026403,0,1179652,0,4587524,0,54,11,2147549184,2097174,65547,65536,1572886,65536,1638423,65536,1703936,65536,1179650,65536,1769474,65536,1835010,65536,1900548,65536,1966084,65536,2031637,65536,5177380,2147483648,208208363,0,174063616,0,211091948,0,
+71565520,0,142475271,0,196619,2147549184,211157006,262155,65536,196619,2147549184,211222542,262155,65536,1048580,2147483648,211288068,0,211353604,0,1179652,0,209584132,0,211419138,0,178192386,0,5701636,0,211484676,0,211550210,0,211615746,0,211681284,0,524295,2147549184,
+211746835,589831,65536,655367,65536,720903,65536,196619,2147549184,189071374,262155,65536,196619,2147549184,209059854,262155,65536,211812845,2147483648,52690948,2147549184,211878211,4587524,2147483648,211943918,0,212008971,0,212074507,0,212140036,0,212205579,0,212271115,0,212336651,0,212402187,0,
+212467723,0,212533259,0,4,1114116,0,52690948,0,191365124,0,191430660,0,4,1114116,0,52690951,0,191365127,0,191430663,0,2,52690944,0,24444928,0,4,1114116,0,212598791,0,191365127,0,191430663,0,1,212664327,0,3,
+1114116,0,4587524,0,212729856,0,2,1179650,0,212795394,0,6,9633796,0,9764868,0,186515460,0,212860928,0,212926464,0,4587522,0,6,21168135,0,21102599,0,183894023,0,212992007,0,213057543,0,4587524,0,26,21168135,2147549184,
+213123575,21102599,65536,183894023,65536,212992007,65536,213057543,65536,4587524,65536,21168135,2147549184,213189111,21102599,65536,183894023,65536,212992007,65536,213057543,65536,4587524,65536,21168135,2147549184,213254647,21102599,65536,183894023,65536,212992007,65536,213057543,65536,4587524,65536,21168135,2147549184,213320183,
+21102599,65536,183894023,65536,212992007,65536,213057543,65536,4587524,65536,213385223,2147483648,213450759,0,5,54460423,0,213516292,0,213581831,0,213647367,0,213712903,0,6,327687,0,393223,0,125566983,0,54984711,0,42467335,0,4587524,0,6,327687,
+0,393223,0,125566983,0,54984711,0,42467335,0,4587524,0,2,213778436,0,213843968,0,16,173473794,0,173539330,0,7733250,0,213909506,0,213975042,0,4784130,0,142671874,0,214040578,0,54657031,0,214106119,0,214171655,0,26214402,
+0,214237184,0,183894016,0,214302724,0,214368260,0,9,214433799,0,214499335,0,70582279,0,54460423,0,214564871,0,134414343,0,54263810,0,214630400,0,4587520,0,4,214695943,0,214761479,0,54263810,0,4587522,0,3,214827015,0,
+179044359,0,917511,0,33,2228224,0,99352576,2147549184,100335855,18219008,65536,99418112,65536,1179648,65536,99483648,65536,99549184,65536,99614720,65536,99680256,65536,99745794,65536,99811330,65536,99876871,65536,99942400,65536,100007936,65536,100073472,65536,40239104,65536,12648448,65536,
+1179650,2147614720,100335855,100139063,99155968,131072,99221504,131072,99287040,131072,24444928,131072,1179652,2147614720,100335855,100204784,4587524,131072,224198656,131072,224264192,131072,91291655,131072,183894023,131072,224329791,131072,224395275,131072,224460800,2147614720,100335855,100270321,9764868,2147483648,85917700,0,35,214892544,
+0,99352576,2147549184,214958319,18219008,65536,99418112,65536,1179648,65536,99483648,65536,99549184,65536,99614720,65536,99680256,65536,99745794,65536,99811330,65536,99876871,65536,99942400,65536,100007936,65536,100073472,65536,40239104,65536,12648448,65536,1179650,2147614720,214958319,100139063,99155968,131072,
+99221504,131072,99287040,131072,24444928,131072,1179652,2147614720,214958319,100204784,4587524,131072,224198656,131072,224264192,131072,91291655,131072,183894023,131072,224329791,131072,224395275,131072,224460800,2147614720,214958319,100270321,9764868,2147483648,85917700,0,215023620,0,4587524,0,36,215089154,0,215154690,
+0,4718596,0,82313216,0,99352576,2147549184,214958319,18219008,65536,99418112,65536,1179648,65536,99483648,65536,99549184,65536,99614720,65536,99680256,65536,99745794,65536,99811330,65536,99876871,65536,99942400,65536,100007936,65536,100073472,65536,40239104,65536,12648448,65536,1179650,2147614720,
+214958319,100139063,99155968,131072,99221504,131072,99287040,131072,24444928,131072,1179652,2147614720,214958319,100204784,4587524,131072,224198656,131072,224264192,131072,91291655,131072,183894023,131072,224329791,131072,224395275,131072,224460800,2147614720,214958319,100270321,215220224,2147483648,44957696,0,9,215285767,0,215351303,
+0,215416839,0,43253767,0,215482375,0,215547911,0,215613447,0,215678978,0,215744514,0,8,215810050,0,215875586,0,215941122,0,216006658,0,216072199,0,216137735,0,216203271,0,216268807,0,2,327687,0,393223,0,2,13303808,0,
+216334336,0,1,1245184,0,12,216399872,0,216465408,0,132644864,0,216530944,0,7733250,0,216596482,0,7143431,0,216662023,0,216727559,0,65142791,0,125566983,0,68550663,0,2,216793099,0,216858635,0,14,99483648,0,1048576,0,
+54263808,0,54460416,0,216465408,0,6946816,0,216924160,0,216989696,0,217055239,0,217120775,0,65077255,0,217186311,0,217251847,0,68550663,0,8,183828487,0,9699335,0,183894023,0,48627719,0,217317383,0,17235975,0,217382919,0,1048580,
+0,4,217448450,0,217513986,0,217579522,0,4587522,0,8,217645063,0,51970055,0,217710599,0,217776135,0,217841664,0,177602567,0,177668103,0,177733639,0,6,217907202,0,217972738,0,218038279,0,218103815,0,218169351,0,218234887,0,
+2,55246848,0,7995392,0,2,182845444,0,182910980,0,219,23855111,2147549184,218300483,23920647,65536,13828103,65536,1179652,65536,13369344,65536,13434880,65536,13500416,65536,13565952,65536,1048580,65536,23986183,65536,24051719,65536,24117255,65536,3145757,65536,17301506,2147614720,
+218366020,24182843,4390914,131072,17367040,131072,17432576,131072,17498112,131072,17563648,131072,14417927,2147680256,218366020,24182843,17629242,14483463,196608,14548999,196608,17235975,196608,4653063,196608,4390916,196608,14417927,196609,14483463,196609,14548999,196609,17235975,196609,4653063,196609,4390916,196609,14417927,
+196610,14483463,196610,14548999,196610,17235975,196610,4653063,196610,4390916,196610,14417927,196611,14483463,196611,14548999,196611,17235975,196611,4653063,196611,4390916,196611,14417927,196612,14483463,196612,14548999,196612,17235975,196612,4653063,196612,4390916,196612,14417927,196613,14483463,196613,14548999,
+196613,17235975,196613,4653063,196613,4390916,196613,14417927,196614,14483463,196614,14548999,196614,17235975,196614,4653063,196614,4390916,196614,14417927,196615,14483463,196615,14548999,196615,17235975,196615,4653063,196615,4390916,196615,14417927,196616,14483463,196616,14548999,196616,17235975,196616,4653063,
+196616,4390916,196616,14417927,196617,14483463,196617,14548999,196617,17235975,196617,4653063,196617,4390916,196617,14417927,196618,14483463,196618,14548999,196618,17235975,196618,4653063,196618,4390916,196618,14417927,196619,14483463,196619,14548999,196619,17235975,196619,4653063,196619,4390916,196619,14417927,
+196620,14483463,196620,14548999,196620,17235975,196620,4653063,196620,4390916,196620,14417927,196621,14483463,196621,14548999,196621,17235975,196621,4653063,196621,4390916,196621,14417927,196622,14483463,196622,14548999,196622,17235975,196622,4653063,196622,4390916,196622,14417927,196623,14483463,196623,14548999,
+196623,17235975,196623,4653063,196623,4390916,196623,14417927,196624,14483463,196624,14548999,196624,17235975,196624,4653063,196624,4390916,196624,14417927,196625,14483463,196625,14548999,196625,17235975,196625,4653063,196625,4390916,196625,14417927,196626,14483463,196626,14548999,196626,17235975,196626,4653063,
+196626,4390916,196626,14417927,196627,14483463,196627,14548999,196627,17235975,196627,4653063,196627,4390916,196627,14417927,196628,14483463,196628,14548999,196628,17235975,196628,4653063,196628,4390916,196628,14417927,196629,14483463,196629,14548999,196629,17235975,196629,4653063,196629,4390916,196629,14417927,
+196630,14483463,196630,14548999,196630,17235975,196630,4653063,196630,4390916,196630,14417927,196631,14483463,196631,14548999,196631,17235975,196631,4653063,196631,4390916,196631,14417927,196632,14483463,196632,14548999,196632,17235975,196632,4653063,196632,4390916,196632,14417927,196633,14483463,196633,14548999,
+196633,17235975,196633,4653063,196633,4390916,196633,14417927,196634,14483463,196634,14548999,196634,17235975,196634,4653063,196634,4390916,196634,14417927,196635,14483463,196635,14548999,196635,17235975,196635,4653063,196635,4390916,196635,14417927,196636,14483463,196636,14548999,196636,17235975,196636,4653063,
+196636,4390916,196636,14417927,196637,14483463,196637,14548999,196637,17235975,196637,4653063,196637,4390916,196637,14417927,196638,14483463,196638,14548999,196638,17235975,196638,4653063,196638,4390916,196638,14417927,196639,14483463,196639,14548999,196639,17235975,196639,4653063,196639,4390916,196639,21037063,
+2147549184,218366020,21102599,65536,21168135,65536,1179652,65536,24248327,65536,24313863,65536,24379396,65536,24444932,65536,223,23855111,2147614720,123208210,218300483,23920647,131072,13828103,131072,1179652,131072,13369344,131072,13434880,131072,13500416,131072,13565952,131072,1048580,131072,23986183,131072,24051719,
+131072,24117255,131072,3145757,131072,17301506,2147680256,123208210,218366020,24182843,4390914,196608,17367040,196608,17432576,196608,17498112,196608,17563648,196608,14417927,2147745792,123208210,218366020,24182843,17629242,14483463,262144,14548999,262144,17235975,262144,4653063,262144,4390916,262144,14417927,262145,14483463,262145,
+14548999,262145,17235975,262145,4653063,262145,4390916,262145,14417927,262146,14483463,262146,14548999,262146,17235975,262146,4653063,262146,4390916,262146,14417927,262147,14483463,262147,14548999,262147,17235975,262147,4653063,262147,4390916,262147,14417927,262148,14483463,262148,14548999,262148,17235975,262148,
+4653063,262148,4390916,262148,14417927,262149,14483463,262149,14548999,262149,17235975,262149,4653063,262149,4390916,262149,14417927,262150,14483463,262150,14548999,262150,17235975,262150,4653063,262150,4390916,262150,14417927,262151,14483463,262151,14548999,262151,17235975,262151,4653063,262151,4390916,262151,
+14417927,262152,14483463,262152,14548999,262152,17235975,262152,4653063,262152,4390916,262152,14417927,262153,14483463,262153,14548999,262153,17235975,262153,4653063,262153,4390916,262153,14417927,262154,14483463,262154,14548999,262154,17235975,262154,4653063,262154,4390916,262154,14417927,262155,14483463,262155,
+14548999,262155,17235975,262155,4653063,262155,4390916,262155,14417927,262156,14483463,262156,14548999,262156,17235975,262156,4653063,262156,4390916,262156,14417927,262157,14483463,262157,14548999,262157,17235975,262157,4653063,262157,4390916,262157,14417927,262158,14483463,262158,14548999,262158,17235975,262158,
+4653063,262158,4390916,262158,14417927,262159,14483463,262159,14548999,262159,17235975,262159,4653063,262159,4390916,262159,14417927,262160,14483463,262160,14548999,262160,17235975,262160,4653063,262160,4390916,262160,14417927,262161,14483463,262161,14548999,262161,17235975,262161,4653063,262161,4390916,262161,
+14417927,262162,14483463,262162,14548999,262162,17235975,262162,4653063,262162,4390916,262162,14417927,262163,14483463,262163,14548999,262163,17235975,262163,4653063,262163,4390916,262163,14417927,262164,14483463,262164,14548999,262164,17235975,262164,4653063,262164,4390916,262164,14417927,262165,14483463,262165,
+14548999,262165,17235975,262165,4653063,262165,4390916,262165,14417927,262166,14483463,262166,14548999,262166,17235975,262166,4653063,262166,4390916,262166,14417927,262167,14483463,262167,14548999,262167,17235975,262167,4653063,262167,4390916,262167,14417927,262168,14483463,262168,14548999,262168,17235975,262168,
+4653063,262168,4390916,262168,14417927,262169,14483463,262169,14548999,262169,17235975,262169,4653063,262169,4390916,262169,14417927,262170,14483463,262170,14548999,262170,17235975,262170,4653063,262170,4390916,262170,14417927,262171,14483463,262171,14548999,262171,17235975,262171,4653063,262171,4390916,262171,
+14417927,262172,14483463,262172,14548999,262172,17235975,262172,4653063,262172,4390916,262172,14417927,262173,14483463,262173,14548999,262173,17235975,262173,4653063,262173,4390916,262173,14417927,262174,14483463,262174,14548999,262174,17235975,262174,4653063,262174,4390916,262174,14417927,262175,14483463,262175,
+14548999,262175,17235975,262175,4653063,262175,4390916,262175,21037063,2147614720,123208210,218366020,21102599,131072,21168135,131072,1179652,131072,24248327,131072,24313863,131072,24379396,131072,24444932,131072,218431492,2147483648,218497031,0,218562567,0,218628103,0,240,23855111,2147614720,123208210,218300483,23920647,
+131072,13828103,131072,1179652,131072,13369344,131072,13434880,131072,13500416,131072,13565952,131072,1048580,131072,23986183,131072,24051719,131072,24117255,131072,3145757,131072,17301506,2147680256,123208210,218366020,24182843,4390914,196608,17367040,196608,17432576,196608,17498112,196608,17563648,196608,14417927,2147745792,
+123208210,218366020,24182843,17629242,14483463,262144,14548999,262144,17235975,262144,4653063,262144,4390916,262144,14417927,262145,14483463,262145,14548999,262145,17235975,262145,4653063,262145,4390916,262145,14417927,262146,14483463,262146,14548999,262146,17235975,262146,4653063,262146,4390916,262146,14417927,262147,
+14483463,262147,14548999,262147,17235975,262147,4653063,262147,4390916,262147,14417927,262148,14483463,262148,14548999,262148,17235975,262148,4653063,262148,4390916,262148,14417927,262149,14483463,262149,14548999,262149,17235975,262149,4653063,262149,4390916,262149,14417927,262150,14483463,262150,14548999,262150,
+17235975,262150,4653063,262150,4390916,262150,14417927,262151,14483463,262151,14548999,262151,17235975,262151,4653063,262151,4390916,262151,14417927,262152,14483463,262152,14548999,262152,17235975,262152,4653063,262152,4390916,262152,14417927,262153,14483463,262153,14548999,262153,17235975,262153,4653063,262153,
+4390916,262153,14417927,262154,14483463,262154,14548999,262154,17235975,262154,4653063,262154,4390916,262154,14417927,262155,14483463,262155,14548999,262155,17235975,262155,4653063,262155,4390916,262155,14417927,262156,14483463,262156,14548999,262156,17235975,262156,4653063,262156,4390916,262156,14417927,262157,
+14483463,262157,14548999,262157,17235975,262157,4653063,262157,4390916,262157,14417927,262158,14483463,262158,14548999,262158,17235975,262158,4653063,262158,4390916,262158,14417927,262159,14483463,262159,14548999,262159,17235975,262159,4653063,262159,4390916,262159,14417927,262160,14483463,262160,14548999,262160,
+17235975,262160,4653063,262160,4390916,262160,14417927,262161,14483463,262161,14548999,262161,17235975,262161,4653063,262161,4390916,262161,14417927,262162,14483463,262162,14548999,262162,17235975,262162,4653063,262162,4390916,262162,14417927,262163,14483463,262163,14548999,262163,17235975,262163,4653063,262163,
+4390916,262163,14417927,262164,14483463,262164,14548999,262164,17235975,262164,4653063,262164,4390916,262164,14417927,262165,14483463,262165,14548999,262165,17235975,262165,4653063,262165,4390916,262165,14417927,262166,14483463,262166,14548999,262166,17235975,262166,4653063,262166,4390916,262166,14417927,262167,
+14483463,262167,14548999,262167,17235975,262167,4653063,262167,4390916,262167,14417927,262168,14483463,262168,14548999,262168,17235975,262168,4653063,262168,4390916,262168,14417927,262169,14483463,262169,14548999,262169,17235975,262169,4653063,262169,4390916,262169,14417927,262170,14483463,262170,14548999,262170,
+17235975,262170,4653063,262170,4390916,262170,14417927,262171,14483463,262171,14548999,262171,17235975,262171,4653063,262171,4390916,262171,14417927,262172,14483463,262172,14548999,262172,17235975,262172,4653063,262172,4390916,262172,14417927,262173,14483463,262173,14548999,262173,17235975,262173,4653063,262173,
+4390916,262173,14417927,262174,14483463,262174,14548999,262174,17235975,262174,4653063,262174,4390916,262174,14417927,262175,14483463,262175,14548999,262175,17235975,262175,4653063,262175,4390916,262175,21037063,2147614720,123208210,218366020,21102599,131072,21168135,131072,1179652,131072,24248327,131072,24313863,131072,
+24379396,131072,24444932,131072,9502765,2147549184,23396396,9568260,65536,9633796,65536,9699332,65536,9764868,65536,9830400,65536,9895936,65536,9961472,65536,10027008,65536,10092546,65536,4587522,65536,10158082,65536,10223618,65536,10289154,65536,1179650,65536,218693636,2147483648,218759172,0,218824711,
+0,182517764,0,218890244,0,4587524,0,219,23855111,2147614720,123208210,218300483,23920647,131072,13828103,131072,1179652,131072,13369344,131072,13434880,131072,13500416,131072,13565952,131072,1048580,131072,23986183,131072,24051719,131072,24117255,131072,3145757,131072,17301506,2147680256,123208210,218366020,
+24182843,4390914,196608,17367040,196608,17432576,196608,17498112,196608,17563648,196608,14417927,2147745792,123208210,218366020,24182843,17629242,14483463,262144,14548999,262144,17235975,262144,4653063,262144,4390916,262144,14417927,262145,14483463,262145,14548999,262145,17235975,262145,4653063,262145,4390916,262145,14417927,
+262146,14483463,262146,14548999,262146,17235975,262146,4653063,262146,4390916,262146,14417927,262147,14483463,262147,14548999,262147,17235975,262147,4653063,262147,4390916,262147,14417927,262148,14483463,262148,14548999,262148,17235975,262148,4653063,262148,4390916,262148,14417927,262149,14483463,262149,14548999,
+262149,17235975,262149,4653063,262149,4390916,262149,14417927,262150,14483463,262150,14548999,262150,17235975,262150,4653063,262150,4390916,262150,14417927,262151,14483463,262151,14548999,262151,17235975,262151,4653063,262151,4390916,262151,14417927,262152,14483463,262152,14548999,262152,17235975,262152,4653063,
+262152,4390916,262152,14417927,262153,14483463,262153,14548999,262153,17235975,262153,4653063,262153,4390916,262153,14417927,262154,14483463,262154,14548999,262154,17235975,262154,4653063,262154,4390916,262154,14417927,262155,14483463,262155,14548999,262155,17235975,262155,4653063,262155,4390916,262155,14417927,
+262156,14483463,262156,14548999,262156,17235975,262156,4653063,262156,4390916,262156,14417927,262157,14483463,262157,14548999,262157,17235975,262157,4653063,262157,4390916,262157,14417927,262158,14483463,262158,14548999,262158,17235975,262158,4653063,262158,4390916,262158,14417927,262159,14483463,262159,14548999,
+262159,17235975,262159,4653063,262159,4390916,262159,14417927,262160,14483463,262160,14548999,262160,17235975,262160,4653063,262160,4390916,262160,14417927,262161,14483463,262161,14548999,262161,17235975,262161,4653063,262161,4390916,262161,14417927,262162,14483463,262162,14548999,262162,17235975,262162,4653063,
+262162,4390916,262162,14417927,262163,14483463,262163,14548999,262163,17235975,262163,4653063,262163,4390916,262163,14417927,262164,14483463,262164,14548999,262164,17235975,262164,4653063,262164,4390916,262164,14417927,262165,14483463,262165,14548999,262165,17235975,262165,4653063,262165,4390916,262165,14417927,
+262166,14483463,262166,14548999,262166,17235975,262166,4653063,262166,4390916,262166,14417927,262167,14483463,262167,14548999,262167,17235975,262167,4653063,262167,4390916,262167,14417927,262168,14483463,262168,14548999,262168,17235975,262168,4653063,262168,4390916,262168,14417927,262169,14483463,262169,14548999,
+262169,17235975,262169,4653063,262169,4390916,262169,14417927,262170,14483463,262170,14548999,262170,17235975,262170,4653063,262170,4390916,262170,14417927,262171,14483463,262171,14548999,262171,17235975,262171,4653063,262171,4390916,262171,14417927,262172,14483463,262172,14548999,262172,17235975,262172,4653063,
+262172,4390916,262172,14417927,262173,14483463,262173,14548999,262173,17235975,262173,4653063,262173,4390916,262173,14417927,262174,14483463,262174,14548999,262174,17235975,262174,4653063,262174,4390916,262174,14417927,262175,14483463,262175,14548999,262175,17235975,262175,4653063,262175,4390916,262175,21037063,
+2147614720,123208210,218366020,21102599,131072,21168135,131072,1179652,131072,24248327,131072,24313863,131072,24379396,131072,24444932,131072,223,23855111,2147614720,123208210,218300483,23920647,131072,13828103,131072,1179652,131072,13369344,131072,13434880,131072,13500416,131072,13565952,131072,1048580,131072,23986183,131072,
+24051719,131072,24117255,131072,3145757,131072,17301506,2147680256,123208210,218366020,24182843,4390914,196608,17367040,196608,17432576,196608,17498112,196608,17563648,196608,14417927,2147745792,123208210,218366020,24182843,17629242,14483463,262144,14548999,262144,17235975,262144,4653063,262144,4390916,262144,14417927,262145,14483463,
+262145,14548999,262145,17235975,262145,4653063,262145,4390916,262145,14417927,262146,14483463,262146,14548999,262146,17235975,262146,4653063,262146,4390916,262146,14417927,262147,14483463,262147,14548999,262147,17235975,262147,4653063,262147,4390916,262147,14417927,262148,14483463,262148,14548999,262148,17235975,
+262148,4653063,262148,4390916,262148,14417927,262149,14483463,262149,14548999,262149,17235975,262149,4653063,262149,4390916,262149,14417927,262150,14483463,262150,14548999,262150,17235975,262150,4653063,262150,4390916,262150,14417927,262151,14483463,262151,14548999,262151,17235975,262151,4653063,262151,4390916,
+262151,14417927,262152,14483463,262152,14548999,262152,17235975,262152,4653063,262152,4390916,262152,14417927,262153,14483463,262153,14548999,262153,17235975,262153,4653063,262153,4390916,262153,14417927,262154,14483463,262154,14548999,262154,17235975,262154,4653063,262154,4390916,262154,14417927,262155,14483463,
+262155,14548999,262155,17235975,262155,4653063,262155,4390916,262155,14417927,262156,14483463,262156,14548999,262156,17235975,262156,4653063,262156,4390916,262156,14417927,262157,14483463,262157,14548999,262157,17235975,262157,4653063,262157,4390916,262157,14417927,262158,14483463,262158,14548999,262158,17235975,
+262158,4653063,262158,4390916,262158,14417927,262159,14483463,262159,14548999,262159,17235975,262159,4653063,262159,4390916,262159,14417927,262160,14483463,262160,14548999,262160,17235975,262160,4653063,262160,4390916,262160,14417927,262161,14483463,262161,14548999,262161,17235975,262161,4653063,262161,4390916,
+262161,14417927,262162,14483463,262162,14548999,262162,17235975,262162,4653063,262162,4390916,262162,14417927,262163,14483463,262163,14548999,262163,17235975,262163,4653063,262163,4390916,262163,14417927,262164,14483463,262164,14548999,262164,17235975,262164,4653063,262164,4390916,262164,14417927,262165,14483463,
+262165,14548999,262165,17235975,262165,4653063,262165,4390916,262165,14417927,262166,14483463,262166,14548999,262166,17235975,262166,4653063,262166,4390916,262166,14417927,262167,14483463,262167,14548999,262167,17235975,262167,4653063,262167,4390916,262167,14417927,262168,14483463,262168,14548999,262168,17235975,
+262168,4653063,262168,4390916,262168,14417927,262169,14483463,262169,14548999,262169,17235975,262169,4653063,262169,4390916,262169,14417927,262170,14483463,262170,14548999,262170,17235975,262170,4653063,262170,4390916,262170,14417927,262171,14483463,262171,14548999,262171,17235975,262171,4653063,262171,4390916,
+262171,14417927,262172,14483463,262172,14548999,262172,17235975,262172,4653063,262172,4390916,262172,14417927,262173,14483463,262173,14548999,262173,17235975,262173,4653063,262173,4390916,262173,14417927,262174,14483463,262174,14548999,262174,17235975,262174,4653063,262174,4390916,262174,14417927,262175,14483463,
+262175,14548999,262175,17235975,262175,4653063,262175,4390916,262175,21037063,2147614720,123208210,218366020,21102599,131072,21168135,131072,1179652,131072,24248327,131072,24313863,131072,24379396,131072,24444932,131072,218955780,2147483648,219021316,0,9699335,0,219086855,0,238,23855111,2147614720,123208210,218300483,
+23920647,131072,13828103,131072,1179652,131072,13369344,131072,13434880,131072,13500416,131072,13565952,131072,1048580,131072,23986183,131072,24051719,131072,24117255,131072,3145757,131072,17301506,2147680256,123208210,218366020,24182843,4390914,196608,17367040,196608,17432576,196608,17498112,196608,17563648,196608,14417927,
+2147745792,123208210,218366020,24182843,17629242,14483463,262144,14548999,262144,17235975,262144,4653063,262144,4390916,262144,14417927,262145,14483463,262145,14548999,262145,17235975,262145,4653063,262145,4390916,262145,14417927,262146,14483463,262146,14548999,262146,17235975,262146,4653063,262146,4390916,262146,14417927,
+262147,14483463,262147,14548999,262147,17235975,262147,4653063,262147,4390916,262147,14417927,262148,14483463,262148,14548999,262148,17235975,262148,4653063,262148,4390916,262148,14417927,262149,14483463,262149,14548999,262149,17235975,262149,4653063,262149,4390916,262149,14417927,262150,14483463,262150,14548999,
+262150,17235975,262150,4653063,262150,4390916,262150,14417927,262151,14483463,262151,14548999,262151,17235975,262151,4653063,262151,4390916,262151,14417927,262152,14483463,262152,14548999,262152,17235975,262152,4653063,262152,4390916,262152,14417927,262153,14483463,262153,14548999,262153,17235975,262153,4653063,
+262153,4390916,262153,14417927,262154,14483463,262154,14548999,262154,17235975,262154,4653063,262154,4390916,262154,14417927,262155,14483463,262155,14548999,262155,17235975,262155,4653063,262155,4390916,262155,14417927,262156,14483463,262156,14548999,262156,17235975,262156,4653063,262156,4390916,262156,14417927,
+262157,14483463,262157,14548999,262157,17235975,262157,4653063,262157,4390916,262157,14417927,262158,14483463,262158,14548999,262158,17235975,262158,4653063,262158,4390916,262158,14417927,262159,14483463,262159,14548999,262159,17235975,262159,4653063,262159,4390916,262159,14417927,262160,14483463,262160,14548999,
+262160,17235975,262160,4653063,262160,4390916,262160,14417927,262161,14483463,262161,14548999,262161,17235975,262161,4653063,262161,4390916,262161,14417927,262162,14483463,262162,14548999,262162,17235975,262162,4653063,262162,4390916,262162,14417927,262163,14483463,262163,14548999,262163,17235975,262163,4653063,
+262163,4390916,262163,14417927,262164,14483463,262164,14548999,262164,17235975,262164,4653063,262164,4390916,262164,14417927,262165,14483463,262165,14548999,262165,17235975,262165,4653063,262165,4390916,262165,14417927,262166,14483463,262166,14548999,262166,17235975,262166,4653063,262166,4390916,262166,14417927,
+262167,14483463,262167,14548999,262167,17235975,262167,4653063,262167,4390916,262167,14417927,262168,14483463,262168,14548999,262168,17235975,262168,4653063,262168,4390916,262168,14417927,262169,14483463,262169,14548999,262169,17235975,262169,4653063,262169,4390916,262169,14417927,262170,14483463,262170,14548999,
+262170,17235975,262170,4653063,262170,4390916,262170,14417927,262171,14483463,262171,14548999,262171,17235975,262171,4653063,262171,4390916,262171,14417927,262172,14483463,262172,14548999,262172,17235975,262172,4653063,262172,4390916,262172,14417927,262173,14483463,262173,14548999,262173,17235975,262173,4653063,
+262173,4390916,262173,14417927,262174,14483463,262174,14548999,262174,17235975,262174,4653063,262174,4390916,262174,14417927,262175,14483463,262175,14548999,262175,17235975,262175,4653063,262175,4390916,262175,21037063,2147614720,123208210,218366020,21102599,131072,21168135,131072,1179652,131072,24248327,131072,24313863,
+131072,24379396,131072,24444932,131072,9502765,2147549184,23396396,9568260,65536,9633796,65536,9699332,65536,9764868,65536,9830400,65536,9895936,65536,9961472,65536,10027008,65536,10092546,65536,4587522,65536,10158082,65536,10223618,65536,10289154,65536,1179650,65536,218693636,2147483648,218759172,0,
+182517764,0,4587524,0,221,23855111,2147614720,123208210,218300483,23920647,131072,13828103,131072,1179652,131072,13369344,131072,13434880,131072,13500416,131072,13565952,131072,1048580,131072,23986183,131072,24051719,131072,24117255,131072,3145757,131072,17301506,2147680256,123208210,218366020,24182843,4390914,196608,
+17367040,196608,17432576,196608,17498112,196608,17563648,196608,14417927,2147745792,123208210,218366020,24182843,17629242,14483463,262144,14548999,262144,17235975,262144,4653063,262144,4390916,262144,14417927,262145,14483463,262145,14548999,262145,17235975,262145,4653063,262145,4390916,262145,14417927,262146,14483463,262146,
+14548999,262146,17235975,262146,4653063,262146,4390916,262146,14417927,262147,14483463,262147,14548999,262147,17235975,262147,4653063,262147,4390916,262147,14417927,262148,14483463,262148,14548999,262148,17235975,262148,4653063,262148,4390916,262148,14417927,262149,14483463,262149,14548999,262149,17235975,262149,
+4653063,262149,4390916,262149,14417927,262150,14483463,262150,14548999,262150,17235975,262150,4653063,262150,4390916,262150,14417927,262151,14483463,262151,14548999,262151,17235975,262151,4653063,262151,4390916,262151,14417927,262152,14483463,262152,14548999,262152,17235975,262152,4653063,262152,4390916,262152,
+14417927,262153,14483463,262153,14548999,262153,17235975,262153,4653063,262153,4390916,262153,14417927,262154,14483463,262154,14548999,262154,17235975,262154,4653063,262154,4390916,262154,14417927,262155,14483463,262155,14548999,262155,17235975,262155,4653063,262155,4390916,262155,14417927,262156,14483463,262156,
+14548999,262156,17235975,262156,4653063,262156,4390916,262156,14417927,262157,14483463,262157,14548999,262157,17235975,262157,4653063,262157,4390916,262157,14417927,262158,14483463,262158,14548999,262158,17235975,262158,4653063,262158,4390916,262158,14417927,262159,14483463,262159,14548999,262159,17235975,262159,
+4653063,262159,4390916,262159,14417927,262160,14483463,262160,14548999,262160,17235975,262160,4653063,262160,4390916,262160,14417927,262161,14483463,262161,14548999,262161,17235975,262161,4653063,262161,4390916,262161,14417927,262162,14483463,262162,14548999,262162,17235975,262162,4653063,262162,4390916,262162,
+14417927,262163,14483463,262163,14548999,262163,17235975,262163,4653063,262163,4390916,262163,14417927,262164,14483463,262164,14548999,262164,17235975,262164,4653063,262164,4390916,262164,14417927,262165,14483463,262165,14548999,262165,17235975,262165,4653063,262165,4390916,262165,14417927,262166,14483463,262166,
+14548999,262166,17235975,262166,4653063,262166,4390916,262166,14417927,262167,14483463,262167,14548999,262167,17235975,262167,4653063,262167,4390916,262167,14417927,262168,14483463,262168,14548999,262168,17235975,262168,4653063,262168,4390916,262168,14417927,262169,14483463,262169,14548999,262169,17235975,262169,
+4653063,262169,4390916,262169,14417927,262170,14483463,262170,14548999,262170,17235975,262170,4653063,262170,4390916,262170,14417927,262171,14483463,262171,14548999,262171,17235975,262171,4653063,262171,4390916,262171,14417927,262172,14483463,262172,14548999,262172,17235975,262172,4653063,262172,4390916,262172,
+14417927,262173,14483463,262173,14548999,262173,17235975,262173,4653063,262173,4390916,262173,14417927,262174,14483463,262174,14548999,262174,17235975,262174,4653063,262174,4390916,262174,14417927,262175,14483463,262175,14548999,262175,17235975,262175,4653063,262175,4390916,262175,21037063,2147614720,123208210,218366020,
+21102599,131072,21168135,131072,1179652,131072,24248327,131072,24313863,131072,24379396,131072,24444932,131072,219152388,2147483648,4587524,0,219,23855111,2147614720,123208210,218300483,23920647,131072,13828103,131072,1179652,131072,13369344,131072,13434880,131072,13500416,131072,13565952,131072,1048580,131072,23986183,
+131072,24051719,131072,24117255,131072,3145757,131072,17301506,2147680256,123208210,218366020,24182843,4390914,196608,17367040,196608,17432576,196608,17498112,196608,17563648,196608,14417927,2147745792,123208210,218366020,24182843,17629242,14483463,262144,14548999,262144,17235975,262144,4653063,262144,4390916,262144,14417927,262145,
+14483463,262145,14548999,262145,17235975,262145,4653063,262145,4390916,262145,14417927,262146,14483463,262146,14548999,262146,17235975,262146,4653063,262146,4390916,262146,14417927,262147,14483463,262147,14548999,262147,17235975,262147,4653063,262147,4390916,262147,14417927,262148,14483463,262148,14548999,262148,
+17235975,262148,4653063,262148,4390916,262148,14417927,262149,14483463,262149,14548999,262149,17235975,262149,4653063,262149,4390916,262149,14417927,262150,14483463,262150,14548999,262150,17235975,262150,4653063,262150,4390916,262150,14417927,262151,14483463,262151,14548999,262151,17235975,262151,4653063,262151,
+4390916,262151,14417927,262152,14483463,262152,14548999,262152,17235975,262152,4653063,262152,4390916,262152,14417927,262153,14483463,262153,14548999,262153,17235975,262153,4653063,262153,4390916,262153,14417927,262154,14483463,262154,14548999,262154,17235975,262154,4653063,262154,4390916,262154,14417927,262155,
+14483463,262155,14548999,262155,17235975,262155,4653063,262155,4390916,262155,14417927,262156,14483463,262156,14548999,262156,17235975,262156,4653063,262156,4390916,262156,14417927,262157,14483463,262157,14548999,262157,17235975,262157,4653063,262157,4390916,262157,14417927,262158,14483463,262158,14548999,262158,
+17235975,262158,4653063,262158,4390916,262158,14417927,262159,14483463,262159,14548999,262159,17235975,262159,4653063,262159,4390916,262159,14417927,262160,14483463,262160,14548999,262160,17235975,262160,4653063,262160,4390916,262160,14417927,262161,14483463,262161,14548999,262161,17235975,262161,4653063,262161,
+4390916,262161,14417927,262162,14483463,262162,14548999,262162,17235975,262162,4653063,262162,4390916,262162,14417927,262163,14483463,262163,14548999,262163,17235975,262163,4653063,262163,4390916,262163,14417927,262164,14483463,262164,14548999,262164,17235975,262164,4653063,262164,4390916,262164,14417927,262165,
+14483463,262165,14548999,262165,17235975,262165,4653063,262165,4390916,262165,14417927,262166,14483463,262166,14548999,262166,17235975,262166,4653063,262166,4390916,262166,14417927,262167,14483463,262167,14548999,262167,17235975,262167,4653063,262167,4390916,262167,14417927,262168,14483463,262168,14548999,262168,
+17235975,262168,4653063,262168,4390916,262168,14417927,262169,14483463,262169,14548999,262169,17235975,262169,4653063,262169,4390916,262169,14417927,262170,14483463,262170,14548999,262170,17235975,262170,4653063,262170,4390916,262170,14417927,262171,14483463,262171,14548999,262171,17235975,262171,4653063,262171,
+4390916,262171,14417927,262172,14483463,262172,14548999,262172,17235975,262172,4653063,262172,4390916,262172,14417927,262173,14483463,262173,14548999,262173,17235975,262173,4653063,262173,4390916,262173,14417927,262174,14483463,262174,14548999,262174,17235975,262174,4653063,262174,4390916,262174,14417927,262175,
+14483463,262175,14548999,262175,17235975,262175,4653063,262175,4390916,262175,21037063,2147614720,123208210,218366020,21102599,131072,21168135,131072,1179652,131072,24248327,131072,24313863,131072,24379396,131072,24444932,131072,221,23855111,2147614720,123208210,218300483,23920647,131072,13828103,131072,1179652,131072,13369344,
+131072,13434880,131072,13500416,131072,13565952,131072,1048580,131072,23986183,131072,24051719,131072,24117255,131072,3145757,131072,17301506,2147680256,123208210,218366020,24182843,4390914,196608,17367040,196608,17432576,196608,17498112,196608,17563648,196608,14417927,2147745792,123208210,218366020,24182843,17629242,14483463,262144,
+14548999,262144,17235975,262144,4653063,262144,4390916,262144,14417927,262145,14483463,262145,14548999,262145,17235975,262145,4653063,262145,4390916,262145,14417927,262146,14483463,262146,14548999,262146,17235975,262146,4653063,262146,4390916,262146,14417927,262147,14483463,262147,14548999,262147,17235975,262147,
+4653063,262147,4390916,262147,14417927,262148,14483463,262148,14548999,262148,17235975,262148,4653063,262148,4390916,262148,14417927,262149,14483463,262149,14548999,262149,17235975,262149,4653063,262149,4390916,262149,14417927,262150,14483463,262150,14548999,262150,17235975,262150,4653063,262150,4390916,262150,
+14417927,262151,14483463,262151,14548999,262151,17235975,262151,4653063,262151,4390916,262151,14417927,262152,14483463,262152,14548999,262152,17235975,262152,4653063,262152,4390916,262152,14417927,262153,14483463,262153,14548999,262153,17235975,262153,4653063,262153,4390916,262153,14417927,262154,14483463,262154,
+14548999,262154,17235975,262154,4653063,262154,4390916,262154,14417927,262155,14483463,262155,14548999,262155,17235975,262155,4653063,262155,4390916,262155,14417927,262156,14483463,262156,14548999,262156,17235975,262156,4653063,262156,4390916,262156,14417927,262157,14483463,262157,14548999,262157,17235975,262157,
+4653063,262157,4390916,262157,14417927,262158,14483463,262158,14548999,262158,17235975,262158,4653063,262158,4390916,262158,14417927,262159,14483463,262159,14548999,262159,17235975,262159,4653063,262159,4390916,262159,14417927,262160,14483463,262160,14548999,262160,17235975,262160,4653063,262160,4390916,262160,
+14417927,262161,14483463,262161,14548999,262161,17235975,262161,4653063,262161,4390916,262161,14417927,262162,14483463,262162,14548999,262162,17235975,262162,4653063,262162,4390916,262162,14417927,262163,14483463,262163,14548999,262163,17235975,262163,4653063,262163,4390916,262163,14417927,262164,14483463,262164,
+14548999,262164,17235975,262164,4653063,262164,4390916,262164,14417927,262165,14483463,262165,14548999,262165,17235975,262165,4653063,262165,4390916,262165,14417927,262166,14483463,262166,14548999,262166,17235975,262166,4653063,262166,4390916,262166,14417927,262167,14483463,262167,14548999,262167,17235975,262167,
+4653063,262167,4390916,262167,14417927,262168,14483463,262168,14548999,262168,17235975,262168,4653063,262168,4390916,262168,14417927,262169,14483463,262169,14548999,262169,17235975,262169,4653063,262169,4390916,262169,14417927,262170,14483463,262170,14548999,262170,17235975,262170,4653063,262170,4390916,262170,
+14417927,262171,14483463,262171,14548999,262171,17235975,262171,4653063,262171,4390916,262171,14417927,262172,14483463,262172,14548999,262172,17235975,262172,4653063,262172,4390916,262172,14417927,262173,14483463,262173,14548999,262173,17235975,262173,4653063,262173,4390916,262173,14417927,262174,14483463,262174,
+14548999,262174,17235975,262174,4653063,262174,4390916,262174,14417927,262175,14483463,262175,14548999,262175,17235975,262175,4653063,262175,4390916,262175,21037063,2147614720,123208210,218366020,21102599,131072,21168135,131072,1179652,131072,24248327,131072,24313863,131072,24379396,131072,24444932,131072,219217924,2147483648,
+4587524,0,221,23855111,2147614720,123208210,218300483,23920647,131072,13828103,131072,1179652,131072,13369344,131072,13434880,131072,13500416,131072,13565952,131072,1048580,131072,23986183,131072,24051719,131072,24117255,131072,3145757,131072,17301506,2147680256,123208210,218366020,24182843,4390914,196608,17367040,196608,
+17432576,196608,17498112,196608,17563648,196608,14417927,2147745792,123208210,218366020,24182843,17629242,14483463,262144,14548999,262144,17235975,262144,4653063,262144,4390916,262144,14417927,262145,14483463,262145,14548999,262145,17235975,262145,4653063,262145,4390916,262145,14417927,262146,14483463,262146,14548999,262146,
+17235975,262146,4653063,262146,4390916,262146,14417927,262147,14483463,262147,14548999,262147,17235975,262147,4653063,262147,4390916,262147,14417927,262148,14483463,262148,14548999,262148,17235975,262148,4653063,262148,4390916,262148,14417927,262149,14483463,262149,14548999,262149,17235975,262149,4653063,262149,
+4390916,262149,14417927,262150,14483463,262150,14548999,262150,17235975,262150,4653063,262150,4390916,262150,14417927,262151,14483463,262151,14548999,262151,17235975,262151,4653063,262151,4390916,262151,14417927,262152,14483463,262152,14548999,262152,17235975,262152,4653063,262152,4390916,262152,14417927,262153,
+14483463,262153,14548999,262153,17235975,262153,4653063,262153,4390916,262153,14417927,262154,14483463,262154,14548999,262154,17235975,262154,4653063,262154,4390916,262154,14417927,262155,14483463,262155,14548999,262155,17235975,262155,4653063,262155,4390916,262155,14417927,262156,14483463,262156,14548999,262156,
+17235975,262156,4653063,262156,4390916,262156,14417927,262157,14483463,262157,14548999,262157,17235975,262157,4653063,262157,4390916,262157,14417927,262158,14483463,262158,14548999,262158,17235975,262158,4653063,262158,4390916,262158,14417927,262159,14483463,262159,14548999,262159,17235975,262159,4653063,262159,
+4390916,262159,14417927,262160,14483463,262160,14548999,262160,17235975,262160,4653063,262160,4390916,262160,14417927,262161,14483463,262161,14548999,262161,17235975,262161,4653063,262161,4390916,262161,14417927,262162,14483463,262162,14548999,262162,17235975,262162,4653063,262162,4390916,262162,14417927,262163,
+14483463,262163,14548999,262163,17235975,262163,4653063,262163,4390916,262163,14417927,262164,14483463,262164,14548999,262164,17235975,262164,4653063,262164,4390916,262164,14417927,262165,14483463,262165,14548999,262165,17235975,262165,4653063,262165,4390916,262165,14417927,262166,14483463,262166,14548999,262166,
+17235975,262166,4653063,262166,4390916,262166,14417927,262167,14483463,262167,14548999,262167,17235975,262167,4653063,262167,4390916,262167,14417927,262168,14483463,262168,14548999,262168,17235975,262168,4653063,262168,4390916,262168,14417927,262169,14483463,262169,14548999,262169,17235975,262169,4653063,262169,
+4390916,262169,14417927,262170,14483463,262170,14548999,262170,17235975,262170,4653063,262170,4390916,262170,14417927,262171,14483463,262171,14548999,262171,17235975,262171,4653063,262171,4390916,262171,14417927,262172,14483463,262172,14548999,262172,17235975,262172,4653063,262172,4390916,262172,14417927,262173,
+14483463,262173,14548999,262173,17235975,262173,4653063,262173,4390916,262173,14417927,262174,14483463,262174,14548999,262174,17235975,262174,4653063,262174,4390916,262174,14417927,262175,14483463,262175,14548999,262175,17235975,262175,4653063,262175,4390916,262175,21037063,2147614720,123208210,218366020,21102599,131072,
+21168135,131072,1179652,131072,24248327,131072,24313863,131072,24379396,131072,24444932,131072,219283460,2147483648,4587524,0,221,23855111,2147614720,123208210,218300483,23920647,131072,13828103,131072,1179652,131072,13369344,131072,13434880,131072,13500416,131072,13565952,131072,1048580,131072,23986183,131072,24051719,
+131072,24117255,131072,3145757,131072,17301506,2147680256,123208210,218366020,24182843,4390914,196608,17367040,196608,17432576,196608,17498112,196608,17563648,196608,14417927,2147745792,123208210,218366020,24182843,17629242,14483463,262144,14548999,262144,17235975,262144,4653063,262144,4390916,262144,14417927,262145,14483463,262145,
+14548999,262145,17235975,262145,4653063,262145,4390916,262145,14417927,262146,14483463,262146,14548999,262146,17235975,262146,4653063,262146,4390916,262146,14417927,262147,14483463,262147,14548999,262147,17235975,262147,4653063,262147,4390916,262147,14417927,262148,14483463,262148,14548999,262148,17235975,262148,
+4653063,262148,4390916,262148,14417927,262149,14483463,262149,14548999,262149,17235975,262149,4653063,262149,4390916,262149,14417927,262150,14483463,262150,14548999,262150,17235975,262150,4653063,262150,4390916,262150,14417927,262151,14483463,262151,14548999,262151,17235975,262151,4653063,262151,4390916,262151,
+14417927,262152,14483463,262152,14548999,262152,17235975,262152,4653063,262152,4390916,262152,14417927,262153,14483463,262153,14548999,262153,17235975,262153,4653063,262153,4390916,262153,14417927,262154,14483463,262154,14548999,262154,17235975,262154,4653063,262154,4390916,262154,14417927,262155,14483463,262155,
+14548999,262155,17235975,262155,4653063,262155,4390916,262155,14417927,262156,14483463,262156,14548999,262156,17235975,262156,4653063,262156,4390916,262156,14417927,262157,14483463,262157,14548999,262157,17235975,262157,4653063,262157,4390916,262157,14417927,262158,14483463,262158,14548999,262158,17235975,262158,
+4653063,262158,4390916,262158,14417927,262159,14483463,262159,14548999,262159,17235975,262159,4653063,262159,4390916,262159,14417927,262160,14483463,262160,14548999,262160,17235975,262160,4653063,262160,4390916,262160,14417927,262161,14483463,262161,14548999,262161,17235975,262161,4653063,262161,4390916,262161,
+14417927,262162,14483463,262162,14548999,262162,17235975,262162,4653063,262162,4390916,262162,14417927,262163,14483463,262163,14548999,262163,17235975,262163,4653063,262163,4390916,262163,14417927,262164,14483463,262164,14548999,262164,17235975,262164,4653063,262164,4390916,262164,14417927,262165,14483463,262165,
+14548999,262165,17235975,262165,4653063,262165,4390916,262165,14417927,262166,14483463,262166,14548999,262166,17235975,262166,4653063,262166,4390916,262166,14417927,262167,14483463,262167,14548999,262167,17235975,262167,4653063,262167,4390916,262167,14417927,262168,14483463,262168,14548999,262168,17235975,262168,
+4653063,262168,4390916,262168,14417927,262169,14483463,262169,14548999,262169,17235975,262169,4653063,262169,4390916,262169,14417927,262170,14483463,262170,14548999,262170,17235975,262170,4653063,262170,4390916,262170,14417927,262171,14483463,262171,14548999,262171,17235975,262171,4653063,262171,4390916,262171,
+14417927,262172,14483463,262172,14548999,262172,17235975,262172,4653063,262172,4390916,262172,14417927,262173,14483463,262173,14548999,262173,17235975,262173,4653063,262173,4390916,262173,14417927,262174,14483463,262174,14548999,262174,17235975,262174,4653063,262174,4390916,262174,14417927,262175,14483463,262175,
+14548999,262175,17235975,262175,4653063,262175,4390916,262175,21037063,2147614720,123208210,218366020,21102599,131072,21168135,131072,1179652,131072,24248327,131072,24313863,131072,24379396,131072,24444932,131072,219348996,2147483648,219414532,0,221,23855111,2147614720,123208210,218300483,23920647,131072,13828103,131072,1179652,
+131072,13369344,131072,13434880,131072,13500416,131072,13565952,131072,1048580,131072,23986183,131072,24051719,131072,24117255,131072,3145757,131072,17301506,2147680256,123208210,218366020,24182843,4390914,196608,17367040,196608,17432576,196608,17498112,196608,17563648,196608,14417927,2147745792,123208210,218366020,24182843,17629242,
+14483463,262144,14548999,262144,17235975,262144,4653063,262144,4390916,262144,14417927,262145,14483463,262145,14548999,262145,17235975,262145,4653063,262145,4390916,262145,14417927,262146,14483463,262146,14548999,262146,17235975,262146,4653063,262146,4390916,262146,14417927,262147,14483463,262147,14548999,262147,
+17235975,262147,4653063,262147,4390916,262147,14417927,262148,14483463,262148,14548999,262148,17235975,262148,4653063,262148,4390916,262148,14417927,262149,14483463,262149,14548999,262149,17235975,262149,4653063,262149,4390916,262149,14417927,262150,14483463,262150,14548999,262150,17235975,262150,4653063,262150,
+4390916,262150,14417927,262151,14483463,262151,14548999,262151,17235975,262151,4653063,262151,4390916,262151,14417927,262152,14483463,262152,14548999,262152,17235975,262152,4653063,262152,4390916,262152,14417927,262153,14483463,262153,14548999,262153,17235975,262153,4653063,262153,4390916,262153,14417927,262154,
+14483463,262154,14548999,262154,17235975,262154,4653063,262154,4390916,262154,14417927,262155,14483463,262155,14548999,262155,17235975,262155,4653063,262155,4390916,262155,14417927,262156,14483463,262156,14548999,262156,17235975,262156,4653063,262156,4390916,262156,14417927,262157,14483463,262157,14548999,262157,
+17235975,262157,4653063,262157,4390916,262157,14417927,262158,14483463,262158,14548999,262158,17235975,262158,4653063,262158,4390916,262158,14417927,262159,14483463,262159,14548999,262159,17235975,262159,4653063,262159,4390916,262159,14417927,262160,14483463,262160,14548999,262160,17235975,262160,4653063,262160,
+4390916,262160,14417927,262161,14483463,262161,14548999,262161,17235975,262161,4653063,262161,4390916,262161,14417927,262162,14483463,262162,14548999,262162,17235975,262162,4653063,262162,4390916,262162,14417927,262163,14483463,262163,14548999,262163,17235975,262163,4653063,262163,4390916,262163,14417927,262164,
+14483463,262164,14548999,262164,17235975,262164,4653063,262164,4390916,262164,14417927,262165,14483463,262165,14548999,262165,17235975,262165,4653063,262165,4390916,262165,14417927,262166,14483463,262166,14548999,262166,17235975,262166,4653063,262166,4390916,262166,14417927,262167,14483463,262167,14548999,262167,
+17235975,262167,4653063,262167,4390916,262167,14417927,262168,14483463,262168,14548999,262168,17235975,262168,4653063,262168,4390916,262168,14417927,262169,14483463,262169,14548999,262169,17235975,262169,4653063,262169,4390916,262169,14417927,262170,14483463,262170,14548999,262170,17235975,262170,4653063,262170,
+4390916,262170,14417927,262171,14483463,262171,14548999,262171,17235975,262171,4653063,262171,4390916,262171,14417927,262172,14483463,262172,14548999,262172,17235975,262172,4653063,262172,4390916,262172,14417927,262173,14483463,262173,14548999,262173,17235975,262173,4653063,262173,4390916,262173,14417927,262174,
+14483463,262174,14548999,262174,17235975,262174,4653063,262174,4390916,262174,14417927,262175,14483463,262175,14548999,262175,17235975,262175,4653063,262175,4390916,262175,21037063,2147614720,123208210,218366020,21102599,131072,21168135,131072,1179652,131072,24248327,131072,24313863,131072,24379396,131072,24444932,131072,
+18219012,2147483648,4587524,0,1,1245184,0,4,1048580,0,219480068,0,219545604,0,4587524,0,258,23855111,2147614720,123208210,218300483,23920647,131072,13828103,131072,1179652,131072,13369344,131072,13434880,131072,13500416,131072,13565952,131072,1048580,131072,23986183,131072,24051719,
+131072,24117255,131072,3145757,131072,17301506,2147680256,123208210,218366020,24182843,4390914,196608,17367040,196608,17432576,196608,17498112,196608,17563648,196608,14417927,2147745792,123208210,218366020,24182843,17629242,14483463,262144,14548999,262144,17235975,262144,4653063,262144,4390916,262144,14417927,262145,14483463,262145,
+14548999,262145,17235975,262145,4653063,262145,4390916,262145,14417927,262146,14483463,262146,14548999,262146,17235975,262146,4653063,262146,4390916,262146,14417927,262147,14483463,262147,14548999,262147,17235975,262147,4653063,262147,4390916,262147,14417927,262148,14483463,262148,14548999,262148,17235975,262148,
+4653063,262148,4390916,262148,14417927,262149,14483463,262149,14548999,262149,17235975,262149,4653063,262149,4390916,262149,14417927,262150,14483463,262150,14548999,262150,17235975,262150,4653063,262150,4390916,262150,14417927,262151,14483463,262151,14548999,262151,17235975,262151,4653063,262151,4390916,262151,
+14417927,262152,14483463,262152,14548999,262152,17235975,262152,4653063,262152,4390916,262152,14417927,262153,14483463,262153,14548999,262153,17235975,262153,4653063,262153,4390916,262153,14417927,262154,14483463,262154,14548999,262154,17235975,262154,4653063,262154,4390916,262154,14417927,262155,14483463,262155,
+14548999,262155,17235975,262155,4653063,262155,4390916,262155,14417927,262156,14483463,262156,14548999,262156,17235975,262156,4653063,262156,4390916,262156,14417927,262157,14483463,262157,14548999,262157,17235975,262157,4653063,262157,4390916,262157,14417927,262158,14483463,262158,14548999,262158,17235975,262158,
+4653063,262158,4390916,262158,14417927,262159,14483463,262159,14548999,262159,17235975,262159,4653063,262159,4390916,262159,14417927,262160,14483463,262160,14548999,262160,17235975,262160,4653063,262160,4390916,262160,14417927,262161,14483463,262161,14548999,262161,17235975,262161,4653063,262161,4390916,262161,
+14417927,262162,14483463,262162,14548999,262162,17235975,262162,4653063,262162,4390916,262162,14417927,262163,14483463,262163,14548999,262163,17235975,262163,4653063,262163,4390916,262163,14417927,262164,14483463,262164,14548999,262164,17235975,262164,4653063,262164,4390916,262164,14417927,262165,14483463,262165,
+14548999,262165,17235975,262165,4653063,262165,4390916,262165,14417927,262166,14483463,262166,14548999,262166,17235975,262166,4653063,262166,4390916,262166,14417927,262167,14483463,262167,14548999,262167,17235975,262167,4653063,262167,4390916,262167,14417927,262168,14483463,262168,14548999,262168,17235975,262168,
+4653063,262168,4390916,262168,14417927,262169,14483463,262169,14548999,262169,17235975,262169,4653063,262169,4390916,262169,14417927,262170,14483463,262170,14548999,262170,17235975,262170,4653063,262170,4390916,262170,14417927,262171,14483463,262171,14548999,262171,17235975,262171,4653063,262171,4390916,262171,
+14417927,262172,14483463,262172,14548999,262172,17235975,262172,4653063,262172,4390916,262172,14417927,262173,14483463,262173,14548999,262173,17235975,262173,4653063,262173,4390916,262173,14417927,262174,14483463,262174,14548999,262174,17235975,262174,4653063,262174,4390916,262174,14417927,262175,14483463,262175,
+14548999,262175,17235975,262175,4653063,262175,4390916,262175,21037063,2147614720,123208210,218366020,21102599,131072,21168135,131072,1179652,131072,24248327,131072,24313863,131072,24379396,131072,24444932,131072,219611138,2147483648,4587522,0,219676676,0,18546695,0,61865988,0,53673986,0,182517762,0,
+18677762,0,18743298,0,19070976,0,1179650,2147549184,219742270,18415618,65536,18481159,65536,18546695,65536,10813442,65536,18612226,65536,18677762,65536,18743298,65536,18808836,65536,13172765,65536,18874372,65536,18939906,65536,19005442,65536,19070976,65536,19136523,65536,19202055,65536,19267591,
+65536,19333122,65536,19398658,65536,19464194,65536,19529730,65536,19595271,65536,19660807,65536,19726343,65536,5701639,65536,19791931,65536,19857471,65536,219807748,2147483648,5701636,0,1,1245184,0,1,219873280,0,12,219938823,0,220004359,0,220069895,0,220135428,0,
+220200967,0,220266503,0,220332039,0,220397572,0,220463108,0,220528644,0,220594180,0,220659716,0,2,219873280,0,220725248,0,3,220790784,0,4784128,0,51314688,0,6,219873280,0,220856320,0,1179648,0,220921856,0,3080192,0,220987399,
+0,5,24510468,0,1179652,0,2293760,0,221052928,0,221118464,0,3,221184004,0,52363268,0,221249536,0,2,53673988,0,221249536,0,1,221249536,0,2,221315079,0,221380615,0,4,327687,0,393223,0,1179650,0,221446146,
+0,12,81395714,0,1179650,0,91422727,0,221511687,0,221577223,0,221642759,0,221708295,0,221774380,0,221839916,0,221905452,0,221970439,0,222035975,0,64,1179652,0,4390916,0,222101508,0,222167044,0,524295,2147549184,222232595,589831,65536,
+655367,65536,720903,65536,524295,2147549184,222298131,589831,65536,655367,65536,720903,65536,81395714,2147549184,222364205,1179650,65536,91422727,65536,221511687,65536,221577223,65536,221642759,65536,221708295,65536,221774380,65536,221839916,65536,221905452,65536,221970439,65536,222035975,65536,81395714,65537,
+1179650,65537,91422727,65537,221511687,65537,221577223,65537,221642759,65537,221708295,65537,221774380,65537,221839916,65537,221905452,65537,221970439,65537,222035975,65537,81395714,65538,1179650,65538,91422727,65538,221511687,65538,221577223,65538,221642759,65538,221708295,65538,221774380,65538,221839916,65538,
+221905452,65538,221970439,65538,222035975,65538,81395714,65539,1179650,65539,91422727,65539,221511687,65539,221577223,65539,221642759,65539,221708295,65539,221774380,65539,221839916,65539,221905452,65539,221970439,65539,222035975,65539,222429191,2147483648,222494727,0,222560263,0,222625799,0,13,201195524,
+0,222691332,0,222756871,0,222822407,0,222887943,0,222953479,0,223019015,0,589831,0,720903,0,24510466,0,1179650,0,54984708,0,223084551,0,30,9961476,0,223150084,0,223215620,0,223281159,0,223346692,0,223412231,0,223477767,0,
+223543300,0,223608839,0,223674372,0,223739911,0,201195524,2147549184,223805758,222691332,65536,222756871,65536,222822407,65536,222887943,65536,222953479,65536,223019015,65536,589831,65536,720903,65536,24510466,65536,1179650,65536,54984708,65536,223084551,65536,223870983,2147483648,223936519,0,224002055,
+0,224067591,0,224133124,0,4587524,0,8,1179652,0,4587524,0,224198656,0,224264192,0,91291655,0,183894023,0,224329791,0,224395275,0,1,224460800,0,1,1245184,0,4,53805107,0,224526343,0,30998535,0,4587527,0,206,
+11,2147549184,2097174,65547,65536,1572886,65536,1638423,65536,1703936,65536,1179650,65536,1769474,65536,1835010,65536,1900548,65536,1966084,65536,2031637,65536,53805107,2147549184,224592430,224526343,65536,30998535,65536,4587527,65536,221773887,2147483648,12910594,2147549184,224657464,12976130,65536,13041666,
+65536,13107202,65536,13172765,65536,13238329,65536,13303808,65536,13369344,65536,13434880,65536,13500416,65536,13565952,65536,13631488,65536,13697024,65536,3080192,65536,13762567,65536,13828103,65536,13893639,65536,13959175,65536,14024706,65536,14090242,65536,14155778,65536,14221314,65536,14286850,
+65536,14352386,65536,14417927,65536,14483463,65536,14548999,65536,14614535,65536,14680071,65536,3932167,65536,14745607,65536,14811143,65536,14876679,65536,14942215,65536,15007751,65536,15073287,65536,15138823,65536,15204359,65536,15269895,65536,15335431,65536,15400967,65536,15466503,65536,15532039,
+65536,15597575,65536,15663111,65536,15728647,65536,15794183,65536,15859719,65536,15925255,65536,15990791,65536,16056327,65536,16121863,65536,16187399,65536,16252935,65536,16318471,65536,16384007,65536,16449543,65536,16515079,65536,16580615,65536,16646151,65536,16711687,65536,16777223,65536,16842759,
+65536,16908295,65536,5701636,65536,16973831,65536,17039367,65536,17104903,65536,17170439,65536,12910594,2147549184,224723000,12976130,65536,13041666,65536,13107202,65536,13172765,65536,13238329,65536,13303808,65536,13369344,65536,13434880,65536,13500416,65536,13565952,65536,13631488,65536,13697024,65536,
+3080192,65536,13762567,65536,13828103,65536,13893639,65536,13959175,65536,14024706,65536,14090242,65536,14155778,65536,14221314,65536,14286850,65536,14352386,65536,14417927,65536,14483463,65536,14548999,65536,14614535,65536,14680071,65536,3932167,65536,14745607,65536,14811143,65536,14876679,65536,
+14942215,65536,15007751,65536,15073287,65536,15138823,65536,15204359,65536,15269895,65536,15335431,65536,15400967,65536,15466503,65536,15532039,65536,15597575,65536,15663111,65536,15728647,65536,15794183,65536,15859719,65536,15925255,65536,15990791,65536,16056327,65536,16121863,65536,16187399,65536,
+16252935,65536,16318471,65536,16384007,65536,16449543,65536,16515079,65536,16580615,65536,16646151,65536,16711687,65536,16777223,65536,16842759,65536,16908295,65536,5701636,65536,16973831,65536,17039367,65536,17104903,65536,17170439,65536,224788731,2147483648,224854077,0,11599898,0,224919611,0,
+224985647,0,225050624,0,225116167,0,225181703,0,125501442,0,225247234,0,39518215,0,6946820,0,1179652,0,225312772,0,225378311,0,225443844,0,225509380,0,43057156,0,225574916,0,225640455,0,225705991,0,113573895,0,30998535,0,113639431,0,
+225771524,0,225837063,0,225902596,0,225968132,0,226033668,0,226099200,0,226164736,0,226230272,0,226295808,0,226361351,0,226426887,0,226492423,0,54984711,0,226557959,0,226623492,0,226689028,0,226754564,0,113508359,0,226820103,0,226885636,0,
+226951172,0,227016711,0,227082247,0,227147783,0,227213319,0,227278855,0,227344391,0,227409927,0,4,560,0,66096,0,113573895,0,52690951,0,15,11,2147549184,2097174,65547,65536,1572886,65536,1638423,65536,1703936,65536,1179650,65536,1769474,
+65536,1835010,65536,1900548,65536,1966084,65536,2031637,65536,196619,2147549184,227475470,262155,65536,227540996,2147483648,4587524,0,17,39387143,2147549184,227606560,39452679,65536,39518215,65536,18546695,65536,3801088,65536,39583744,65536,39649280,65536,39714816,65536,39780352,65536,39845888,65536,
+39911424,65536,39976960,65536,40042503,65536,40108039,65536,40173575,65536,40239104,65536,227672071,2147483648,14,11,2147549184,2097174,65547,65536,1572886,65536,1638423,65536,1703936,65536,1179650,65536,1769474,65536,1835010,65536,1900548,65536,1966084,65536,2031637,65536,196936241,2147483648,
+227737604,0,227803140,0,10,1048580,0,9699332,0,1179652,0,78184452,0,227868676,0,227934212,0,227999748,0,4915204,0,1245184,0,131083,0,1,144506880,0,8,228065842,0,228130820,0,64094212,0,228196356,0,228261892,0,228327428,
+0,228393253,0,228459059,0,6,48234503,0,53477383,0,39518215,0,47054850,0,4587522,0,228524039,0,5,48234503,0,87752711,0,228589575,0,228655111,0,53477383,0,8,228720669,0,254148615,2147549184,1376823,234356743,65536,254214146,65536,24510466,
+65536,122683399,2147483648,228786183,0,3932167,0,3,228851719,0,228917252,0,228982788,0,7,229048324,0,229113860,0,229179396,0,229244935,0,229310471,0,229376007,0,3932167,0,8,570,0,66106,0,3145757,0,18874372,0,1179650,0,
+24510466,0,53477383,0,187498503,0,7,571,0,66107,0,3145757,0,52297730,0,1179650,0,29949954,0,3932162,0,27,48234503,2147549184,77398581,87752711,65536,228589575,65536,228655111,65536,53477383,65536,48234503,2147549184,229442101,87752711,65536,228589575,65536,
+228655111,65536,53477383,65536,229507636,2147483648,186384949,0,229573174,0,5636100,0,53477383,0,55377927,0,229638151,0,229048324,0,229703684,0,229310471,0,229376007,0,6946823,0,229769223,0,4587524,0,229834756,0,1179650,0,229900290,0,17,18546695,
+0,229965831,0,228851719,0,230031367,0,230096903,0,230162439,0,230227975,0,230293511,0,230359047,0,230424583,0,230490119,0,230555655,0,230621191,0,1179652,0,230686724,0,57933826,0,24444930,0,154,11,2147549184,2097174,65547,65536,1572886,
+65536,1638423,65536,1703936,65536,1179650,65536,1769474,65536,1835010,65536,1900548,65536,1966084,65536,2031637,65536,5177380,2147483648,230752831,0,230818365,0,87425244,0,87359562,0,1179652,0,3932164,0,1048578,0,205193218,0,230883330,0,27131906,0,230948866,
+0,75235330,0,231014402,0,231079938,0,231145476,0,4718596,0,231211010,0,231276546,0,231342082,0,5701634,0,231407618,0,231473154,0,231538690,0,112459778,0,231604226,0,231669762,0,231735298,0,231800834,0,231866370,0,38797314,0,185925634,
+0,182517762,0,231931906,0,231997442,0,78905346,0,78970882,0,232062978,0,232128514,0,232194050,0,232259586,0,232325127,0,232390663,0,232456199,0,232521735,0,232587271,0,232652807,0,232718343,0,106037250,0,232783874,0,232849415,0,232914951,
+0,232980487,0,184680455,0,184745991,0,55377927,0,185139207,0,233046023,0,233111559,0,233177095,0,233242631,0,233308167,0,233373703,0,184811524,0,184614916,0,233439236,0,233504772,0,233570306,0,233635842,0,184877063,0,184942599,0,185008135,
+0,233701383,0,233766919,0,233832455,0,233897991,0,233963527,0,234029063,0,234094599,0,234160135,0,234225671,0,74055687,0,6946823,0,234291207,0,234356743,0,234422279,0,234487815,0,16318471,0,234553351,0,234618884,0,35651588,0,234684420,
+0,234749956,0,234815495,0,234881031,0,234946567,0,235012103,0,235077639,0,16252935,0,235143175,0,80674823,0,80543751,0,80609287,0,235208711,0,235274247,0,235339780,0,103284740,0,235405319,0,235470855,0,235536391,0,235601927,0,235667463,
+0,235732999,0,235798535,0,235864071,0,235929607,0,235995143,0,236060679,0,236126215,0,236191751,0,236257287,0,236322823,0,236388359,0,236453895,0,236519431,0,236584964,0,236650500,0,236716095,0,236781631,0,236847111,0,236912647,0,28377144,
+0,76808266,0,196619,2147549184,236978190,262155,65536,237043786,2147483648,237109277,0,237174813,0,5505057,0,23593172,0,237240532,0,237305858,0,237371394,0,55,163,0,65699,0,237437502,0,237503036,0,198640185,0,82510047,0,82575371,0,237568576,
+0,237634112,0,196619,2147549184,237699086,262155,65536,196619,2147549184,237764622,262155,65536,237830289,2147483648,237895836,0,237961372,0,238026781,0,238092865,0,2359325,0,196619,2147549184,202833934,262155,65536,1245184,2147483648,17825799,0,57737223,0,238157831,0,238223367,0,
+51576836,0,238288900,0,1179652,0,184811524,0,238354436,0,238419972,0,238485508,0,238551044,0,18284546,0,238616578,0,238682114,0,238747650,0,238813184,0,238878722,0,238944258,0,239009794,0,239075906,0,87294101,0,196619,2147549184,56295438,262155,
+65536,239140878,2147483648,239206968,0,239271940,0,239337476,0,239403587,0,57540762,0,239469124,0,239534087,0,239599623,0,48,10420805,0,85327879,0,239665159,0,239730695,0,122683399,0,75431943,0,74055687,0,239796231,0,43188231,0,239861767,0,
+239927303,0,239992839,0,240058375,0,240123911,0,240189447,0,240254983,0,240320519,0,85393415,0,240386055,0,240451591,0,240517127,0,85458951,0,85196807,0,85262343,0,240582663,0,240648199,0,240713735,0,240779271,0,240844807,0,240910343,0,
+240975879,0,241041415,0,241106951,0,4587524,0,241172484,0,6160388,0,241238020,0,241303556,0,241369090,0,241434626,0,241500162,0,241565698,0,241631234,0,241696770,0,241762306,0,241827842,0,198508544,0,87425244,0,15,241893957,0,241958919,
+0,242024455,0,35913735,0,74121223,0,242089991,0,242155527,0,242221063,0,6160388,0,242286594,0,242352130,0,4587524,0,35848266,0,242417666,0,75038722,0,7,327687,0,393223,0,458759,0,227672071,0,51183623,0,53477383,0,
+1179652,0,3,47579140,0,47644676,0,47710212,0,18,584,0,66120,0,82247680,0,242483202,0,1179650,0,242548743,0,242614274,0,242679810,0,242745351,0,242810887,0,242876423,0,242941959,0,243007495,0,243073031,0,243138567,0,
+243204159,0,243269695,0,243335231,0,7,585,0,66121,0,82247680,0,183107591,0,243400711,0,1179650,0,51314688,0,7,586,0,66122,0,196619,2147549184,227475470,262155,65536,82247680,2147483648,1179650,0,51314688,0,13,587,0,
+66123,0,196936262,0,243466823,0,18808836,0,243531780,0,242483202,0,1179650,0,3080194,0,243597320,0,243662848,0,243728969,0,243793920,0,7,588,0,66124,0,196619,2147549184,243859470,262155,65536,243924996,2147483648,1179650,0,243990530,0,
+21,589,0,66125,0,196619,2147549184,9633806,262155,65536,244056652,2147483648,1179650,0,242483202,0,244121602,0,244187138,0,244252679,0,244318215,0,183107591,0,243400711,0,244383744,0,2359325,0,244449287,0,71041024,0,70778882,0,4587522,0,
+244514823,0,244580359,0,23,11,2147549184,2097174,65547,65536,1572886,65536,1638423,65536,1703936,65536,1179650,65536,1769474,65536,1835010,65536,1900548,65536,1966084,65536,2031637,65536,5177380,2147483648,196619,2147549184,103809038,262155,65536,1179652,2147483648,244645890,0,244711426,
+0,244776971,0,244842503,0,51314688,0,244908034,0,196619,2147549184,244973582,262155,65536,7,196619,2147549184,245039118,262155,65536,245104644,2147483648,245170180,0,1179652,0,4587524,0,245235996,0,45,11,2147549184,2097174,65547,65536,1572886,65536,1638423,65536,
+1703936,65536,1179650,65536,1769474,65536,1835010,65536,1900548,65536,1966084,65536,2031637,65536,245301840,2147483648,245367376,0,196619,2147549184,245432334,262155,65536,245497860,2147483648,245563394,0,245628930,0,196619,2147549184,245694478,262155,65536,196619,2147549184,245760014,262155,65536,196619,
+2147614720,245826126,245039118,262155,131072,245104644,2147549184,245826126,245170180,65536,1179652,65536,4587524,65536,245235996,65536,196619,2147549184,245891086,262155,65536,196619,2147549184,245956622,262155,65536,196619,2147549184,246022158,262155,65536,196619,2147549184,246087694,262155,65536,246153809,2147483648,246219345,0,
+246284881,0,196619,2147549184,246349838,262155,65536,246415644,2147483648,246480896,0,246546432,0,42,592,0,66128,0,246611979,0,246677852,0,246743388,0,246808576,0,246874114,0,246939650,0,173473794,0,173539330,0,247005186,0,247070722,0,78184450,0,
+143392770,0,247136258,0,247201794,0,247267330,0,247332866,0,247398402,0,24444930,0,171835396,0,247463938,0,247529474,0,247595602,0,247661139,0,247726676,0,247792213,0,247857156,0,247922692,0,196619,2147549184,247988238,262155,65536,196619,2147549184,245760014,
+262155,65536,196619,2147549184,175308814,262155,65536,196619,2147549184,248053774,262155,65536,196619,2147549184,248119310,262155,65536,196619,2147549184,248184846,262155,65536,12779575,2147483648,18,598,0,66134,0,174063616,0,2031637,0,248250368,0,248315906,0,1048578,0,917506,
+0,248381442,0,248446978,0,248512514,0,248578050,0,248643586,0,1179650,0,248709122,0,2097154,0,4587522,0,248775255,0,4,600,0,66136,0,248840790,0,248906326,0,13,601,0,66137,0,196619,2147549184,248971278,262155,65536,
+196619,2147549184,249036814,262155,65536,174063616,2147483648,249102338,0,249167874,0,1179650,0,249233410,0,249298948,0,249364491,0,8,593,0,66129,0,174063616,0,249430016,0,196619,2147549184,166526990,262155,65536,249495556,2147483648,1179652,0,15,307,0,
+65843,0,174063616,0,2031637,0,173081178,0,249561099,0,249626635,0,248775255,0,249692750,0,196619,2147549184,249757710,262155,65536,249823539,2147483648,136773985,0,1179650,0,24444930,0,11,603,0,66139,0,131083,0,1245184,0,1048578,0,
+1179650,0,69074951,0,9764871,0,85917703,0,189530119,0,207290375,0,5,249888775,0,249954308,0,250019844,0,24510468,0,1179652,0,6,40108039,0,250085383,0,250150919,0,250216455,0,1048580,0,1179652,0,5,191365127,0,191430663,
+0,53477383,0,39714818,0,39780354,0,5,131678,0,3735556,0,250281991,0,191365127,0,191430663,0,4,250347522,0,250413058,0,250478594,0,250544130,0,2,142278694,0,98893845,0,6,524295,2147549184,250609683,589831,65536,655367,65536,
+720903,65536,1179652,2147483648,4587524,0,6,6946823,0,51183623,0,250675207,0,9699335,0,18219010,0,250740738,0,5,250806279,0,9699335,0,197001223,0,197066759,0,1179652,0,6,142606358,0,250871808,0,250937344,0,251002882,0,1179650,
+0,251068420,0,55,614,0,66150,0,1245184,0,142606358,2147549184,251134565,250871808,65536,250937344,65536,251002882,65536,1179650,65536,251068420,65536,142606358,65537,250871808,65537,250937344,65537,251002882,65537,1179650,65537,251068420,65537,142606358,65538,250871808,65538,250937344,
+65538,251002882,65538,1179650,65538,251068420,65538,142606358,65539,250871808,65539,250937344,65539,251002882,65539,1179650,65539,251068420,65539,142606358,65540,250871808,65540,250937344,65540,251002882,65540,1179650,65540,251068420,65540,142606358,65541,250871808,65541,250937344,65541,251002882,65541,1179650,
+65541,251068420,65541,142606358,65542,250871808,65542,250937344,65542,251002882,65542,1179650,65542,251068420,65542,142606358,65543,250871808,65543,250937344,65543,251002882,65543,1179650,65543,251068420,65543,251199488,2147483648,1048576,0,1179650,0,4194311,0,8,196619,2147549184,251265038,262155,
+65536,251330560,2147483648,251396107,0,4194311,0,69074951,0,1048580,0,1179652,0,3,251461639,0,1179652,0,4587524,0,18,617,0,66153,0,202047933,0,4260455,0,196619,2147549184,71958542,262155,65536,3473440,2147483648,251527784,0,3735556,0,
+4194311,0,1179650,0,20119554,0,251592708,0,250871808,0,17498116,0,7536647,0,251658247,0,251723783,0,2,251789312,0,251854848,0,5,619,0,66155,0,60227790,0,196619,2147549184,251920398,262155,65536,28,620,0,66156,0,
+196619,2147549184,251985934,262155,65536,189399246,2147483648,252052075,0,196619,2147549184,252117006,262155,65536,196619,2147549184,71958542,262155,65536,1245184,2147483648,69074951,0,252182535,0,51380231,0,184745991,0,207028231,0,207093767,0,54722567,0,65142791,0,189530119,0,207290375,
+0,252248066,0,252313602,0,4718594,0,1048578,0,252379147,0,1179652,0,5701636,0,7,621,0,66157,0,196619,2147549184,251985934,262155,65536,1179652,2147483648,29949956,0,1245184,0,11,622,0,66158,0,142606358,0,252444672,0,
+251068420,0,252510210,0,1179650,0,250871808,0,251592708,0,252575746,0,252641282,0,13,623,0,66159,0,196619,2147549184,252706830,262155,65536,174063616,2147483648,1245184,0,252772352,0,252837888,0,252903428,0,1179650,0,252575746,0,252641282,0,
+51314688,0,5,624,0,66160,0,250871808,0,251592708,0,52690951,0,16,71368910,0,252969166,0,252052075,0,196619,2147549184,253034510,262155,65536,253100653,2147483648,253166188,0,196619,2147549184,253231118,262155,65536,196619,2147549184,253296654,262155,65536,1179652,
+2147483648,18284548,0,253362178,0,253427714,0,253493255,0,12,11,2147549184,2097174,65547,65536,1572886,65536,1638423,65536,1703936,65536,1179650,65536,1769474,65536,1835010,65536,1900548,65536,1966084,65536,2031637,65536,5177380,2147483648,5,626,0,66162,0,
+1048580,0,1179652,0,107937792,0,10,626,2147549184,253559410,66162,65536,1048580,65536,1179652,65536,107937792,65536,3145757,2147483648,253624324,0,253689863,0,253755396,0,201195524,0,7,626,2147549184,253559410,66162,65536,1048580,65536,1179652,65536,107937792,65536,
+253624324,2147483648,253820935,0,12,626,2147549184,253559410,66162,65536,1048580,65536,1179652,65536,107937792,65536,3145757,2147483648,23855111,0,253886471,0,57737223,0,70582279,0,253624324,0,253952004,0,9,626,2147549184,253559410,66162,65536,1048580,65536,1179652,65536,
+107937792,65536,254017543,2147483648,48955399,0,55115783,0,3932167,0,7,626,2147549184,253559410,66162,65536,1048580,65536,1179652,65536,107937792,65536,70582279,2147483648,254083079,0,4,254148615,0,234356743,0,254214146,0,24510466,0,17,632,0,66168,0,
+196619,2147549184,254279694,262155,65536,196619,2147549184,254345230,262155,65536,196619,2147549184,254410766,262155,65536,107937792,2147483648,2097156,0,1179652,0,254476292,0,254541831,0,253755396,0,201195524,0,82771975,0,55246855,0,24,253624324,0,254607364,0,254672903,0,
+54984711,0,254738439,0,180158471,0,254148615,0,254803975,0,51183623,0,223281159,0,91422727,0,254869511,0,254935047,0,255000583,0,255066119,0,255131655,0,255197191,0,255262727,0,255328263,0,255393799,0,255459335,0,255524871,0,196619,2147549184,
+255590414,262155,65536,84,255656068,0,230818425,0,255721483,0,255787082,0,237043786,0,255852618,0,255918714,0,13238299,0,255983643,0,256049179,0,256114715,0,256180231,0,256245767,0,256311303,0,256376839,0,256442375,0,256507911,0,256573447,0,
+256638980,0,256704519,0,256770055,0,17825799,0,72876039,0,256835591,0,256901127,0,256966660,0,257032196,0,257097732,0,257163268,0,257228804,0,257294343,0,65142791,0,257359876,0,257425412,0,257490951,0,30998535,0,257556487,0,257622020,0,
+257687556,0,6160388,0,257753092,0,257818626,0,257884162,0,257949700,0,51183623,0,258015236,0,258080775,0,258146308,0,258211844,0,258277380,0,258342912,0,258408448,0,3080192,0,258474133,0,196619,2147549184,258539534,262155,65536,196619,65537,262155,
+65537,87425244,2147483648,258605060,0,240320519,0,258670599,0,258736132,0,258801671,0,258867204,0,258932743,0,258998279,0,259063815,0,259129351,0,259194887,0,259260423,0,259325952,0,259391488,0,259457024,0,259522560,0,259588103,0,259653639,0,259719175,
+0,19791931,0,259784711,0,259850240,0,259915776,0,259981312,0,5701632,0,26,255656068,0,57671836,0,59179171,0,260046905,0,260112391,0,57802756,0,260177927,0,260243463,0,260308999,0,28573703,0,7536647,0,260374535,0,171966471,0,
+260440071,0,260505607,0,260571143,0,231473156,0,260636679,0,260702215,0,4587524,0,50659328,0,260767746,0,1048578,0,10813442,0,260833282,0,6160388,0,6,255656068,0,57671836,0,260112391,0,57802756,0,1048578,0,4587522,0,25,
+11,2147549184,2097174,65547,65536,1572886,65536,1638423,65536,1703936,65536,1179650,65536,1769474,65536,1835010,65536,1900548,65536,1966084,65536,2031637,65536,5177380,2147483648,180027764,0,260898823,0,260964359,0,7602183,0,261029895,0,7667719,0,261095431,0,261160967,
+0,261226503,0,82771975,0,180158471,0,1179650,0,19529730,0,3,9568260,0,134217730,0,261292034,0,5,177799168,0,177864706,0,99483650,0,261357570,0,261423106,0,111,11,2147549184,2097174,65547,65536,1572886,65536,1638423,65536,1703936,
+65536,1179650,65536,1769474,65536,1835010,65536,1900548,65536,1966084,65536,2031637,65536,5177380,2147483648,2228224,0,10813444,0,10878980,0,261488644,0,12255239,0,12320775,0,10354735,0,10420861,0,71565520,0,1179652,2147614720,261554814,267846277,264896514,131072,264962050,
+131072,265027591,131072,265093122,131072,265158658,131072,265224194,131072,265289730,131072,265355266,131072,265420802,131072,63373319,131072,265486338,131072,55115778,131072,265551876,131072,265617412,131072,265682948,131072,265748482,131072,5701634,131072,24969223,131072,265814020,131072,265879556,131072,265945095,131072,266010631,
+131072,35651588,131072,262668299,2147614720,261554814,267911810,262733826,131072,4587522,131072,262799367,131072,262864903,131072,262930439,131072,262995970,131072,4718594,131072,263061511,131072,263127047,131072,263192583,131072,263258119,131072,263323655,131072,263389191,131072,196619,2147614720,261554814,267059214,262155,131072,196619,
+2147614720,261554814,267124750,262155,131072,1179652,2147614720,261554814,267190919,262602759,131072,266862596,131072,266928132,131072,266994305,131072,1179652,2147614720,261554814,267977350,266076164,131072,266141700,131072,266207236,131072,266272772,131072,266338311,131072,266404480,131072,266469380,131072,266534919,131072,266600455,131072,65142791,
+131072,266665991,131072,266731527,131072,266797063,131072,31784964,131072,9961476,131072,253100672,2147549184,261554814,268042884,65536,196619,2147614720,261554814,268107790,262155,131072,268173316,2147549184,261554814,268238852,65536,123929225,65536,9961476,2147614720,261554814,268305036,267649026,131072,1179650,131072,196619,2147680256,261554814,
+268305036,267714574,262155,196608,196619,2147680256,261554814,268305036,201195534,262155,196608,267780100,2147614720,261554814,268305036,4587524,131072,261619723,2147483648,177799168,2147549184,261685884,177864706,65536,99483650,65536,261357570,65536,261423106,65536,1179652,2147483648,1441796,0,197001220,0,261750788,0,1245184,2147549184,
+12386358,20,9961474,0,261816322,0,261881860,0,261947396,0,262012932,0,263454727,2147549184,262079103,263520263,65536,263585799,65536,263651335,65536,9568260,65536,1179652,65536,262144061,2147483648,262209597,0,262275079,0,262340610,0,262406146,0,9568260,0,71107200,0,262472319,
+0,262537223,0,3,9568260,0,262602759,0,23986183,0,14,262668299,0,262733826,0,4587522,0,262799367,0,262864903,0,262930439,0,262995970,0,4718594,0,263061511,0,263127047,0,263192583,0,263258119,0,263323655,0,263389191,0,6,
+263454727,0,263520263,0,263585799,0,263651335,0,9568260,0,1179652,0,26,640,0,66176,0,1245184,0,263716871,0,263782407,0,263585799,0,263651335,0,224526343,0,263847940,0,263913476,0,263979647,0,264044551,0,262602759,0,1179652,
+0,264110084,0,264175620,0,7536647,0,264241154,0,74383362,0,264306690,0,264372226,0,264437764,0,264503303,0,71565520,0,39518215,0,264568839,0,3,264634375,0,9568260,0,1179652,0,12,644,0,66180,0,1245184,0,264700544,
+0,264765444,0,4587524,0,263979651,0,263847940,0,1179652,0,53805107,0,264830983,0,263913476,0,24,1179652,0,264896514,0,264962050,0,265027591,0,265093122,0,265158658,0,265224194,0,265289730,0,265355266,0,265420802,0,63373319,0,
+265486338,0,55115778,0,265551876,0,265617412,0,265682948,0,265748482,0,5701634,0,24969223,0,265814020,0,265879556,0,265945095,0,266010631,0,35651588,0,16,1179652,0,266076164,0,266141700,0,266207236,0,266272772,0,266338311,0,266404480,
+0,266469380,0,266534919,0,266600455,0,65142791,0,266665991,0,266731527,0,266797063,0,31784964,0,9961476,0,5,1179652,0,262602759,0,266862596,0,266928132,0,266994305,0,16,648,0,66184,0,1245184,0,1179652,0,65142791,
+0,196619,2147549184,267059214,262155,65536,196619,2147549184,267124750,262155,65536,1179652,2147549184,267190919,262602759,65536,266862596,65536,266928132,65536,266994305,65536,265551876,2147483648,265617412,0,1,267255808,0,9,650,0,66186,0,71107200,0,4587524,0,1245184,0,
+267321348,0,267386884,0,267452420,0,267517956,0,6,651,0,66187,0,267583492,0,197001220,0,197066756,0,4587524,0,9,9961476,0,267649026,0,1179650,0,196619,2147549184,267714574,262155,65536,196619,2147549184,201195534,262155,65536,267780100,2147483648,
+4587524,0,79,1179652,2147549184,267846277,264896514,65536,264962050,65536,265027591,65536,265093122,65536,265158658,65536,265224194,65536,265289730,65536,265355266,65536,265420802,65536,63373319,65536,265486338,65536,55115778,65536,265551876,65536,265617412,65536,265682948,65536,265748482,65536,5701634,65536,
+24969223,65536,265814020,65536,265879556,65536,265945095,65536,266010631,65536,35651588,65536,262668299,2147549184,267911810,262733826,65536,4587522,65536,262799367,65536,262864903,65536,262930439,65536,262995970,65536,4718594,65536,263061511,65536,263127047,65536,263192583,65536,263258119,65536,263323655,65536,263389191,
+65536,196619,2147549184,267059214,262155,65536,196619,2147549184,267124750,262155,65536,1179652,2147549184,267190919,262602759,65536,266862596,65536,266928132,65536,266994305,65536,1179652,2147549184,267977350,266076164,65536,266141700,65536,266207236,65536,266272772,65536,266338311,65536,266404480,65536,266469380,65536,266534919,
+65536,266600455,65536,65142791,65536,266665991,65536,266731527,65536,266797063,65536,31784964,65536,9961476,65536,253100672,2147483648,268042884,0,196619,2147549184,268107790,262155,65536,268173316,2147483648,268238852,0,123929225,0,9961476,2147549184,268305036,267649026,65536,1179650,65536,196619,2147614720,268305036,
+267714574,262155,131072,196619,2147614720,268305036,201195534,262155,131072,267780100,2147549184,268305036,4587524,65536,51,653,0,66189,0,64946358,0,131726,0,268369994,0,87425244,0,87294101,0,196619,2147549184,56295438,262155,65536,268435460,2147483648,1245184,0,214958082,0,
+1048578,0,268500994,0,268566530,0,268632066,0,268697602,0,268763138,0,268828674,0,6160388,0,71827460,0,268894212,0,268959748,0,197001220,0,197066756,0,4587524,0,269025287,0,269090873,0,269156352,0,269221892,0,257949700,0,269287431,0,
+269352967,0,269418503,0,269484039,0,269549575,0,269615111,0,269680647,0,269746183,0,269811719,0,269877255,0,269942791,0,270008327,0,270073863,0,270139399,0,270204935,0,5701636,0,50659328,0,270270464,0,270336000,0,270401536,0,8,270467253,
+0,57671836,0,196619,2147549184,270532622,262155,65536,270598146,2147483648,6160386,0,4587524,0,270663680,0,24,270467253,0,57671836,0,59179171,0,38600777,0,6160388,0,270729220,0,14417927,0,14483463,0,14548999,0,30998535,0,270794759,0,270860295,
+0,270925831,0,270991367,0,271056955,0,271122491,0,271187970,0,219348994,0,271253506,0,4587522,0,271319047,0,271384583,0,271450119,0,271515655,0,20,11,2147549184,2097174,65547,65536,1572886,65536,1638423,65536,1703936,65536,1179650,65536,1769474,
+65536,1835010,65536,1900548,65536,1966084,65536,2031637,65536,5177380,2147483648,196619,2147549184,271581198,262155,65536,271646724,2147483648,271712260,0,9764868,0,85917700,0,1179652,0,4587524,0,7,271777796,0,1048580,0,142606358,0,271843328,0,271908864,0,271974407,
+0,272039943,0,3,272105479,0,41353223,0,1179652,0,26,39387143,2147549184,272171040,39452679,65536,39518215,65536,18546695,65536,3801088,65536,39583744,65536,39649280,65536,39714816,65536,39780352,65536,39845888,65536,39911424,65536,39976960,65536,40042503,65536,40108039,65536,
+40173575,65536,40239104,65536,4587524,2147483648,272236548,0,272302736,0,271777796,2147549184,229114511,1048580,65536,142606358,65536,271843328,65536,271908864,65536,271974407,65536,272039943,65536,15,658,0,66194,0,1179650,0,272367616,0,272433152,0,272498692,0,196936337,0,
+271777796,2147549184,229114511,1048580,65536,142606358,65536,271843328,65536,271908864,65536,271974407,65536,272039943,65536,272564881,2147483648,7,659,0,66195,0,131079,0,272629764,0,81330180,0,1179648,0,7995392,0,16,660,0,66196,0,1245184,0,196619,
+2147549184,272695310,262155,65536,196619,2147549184,272760846,262155,65536,272827026,2147483648,272892561,0,30998535,0,125501440,0,272957440,0,55246848,0,7995392,0,1179648,0,76283904,0,15,87425244,0,35848266,0,273023005,0,273088586,0,4587524,0,273154055,0,
+87294101,0,196619,2147549184,56295438,262155,65536,273219588,2147483648,273285122,0,273350658,0,1179652,0,240320519,0,273416203,0,19,273481739,0,273547275,0,1048578,0,78774274,0,1179652,0,273612804,0,273678338,0,4587522,0,74055687,0,35913735,0,
+273743879,0,74383367,0,273809415,0,273874951,0,273940487,0,274006023,0,274071559,0,274137095,0,4718599,0,36,274202653,0,274268189,0,1048578,0,273350658,0,1179652,0,274333703,0,4587527,0,274399239,0,274464775,0,274530311,0,274595847,
+0,274661383,0,274726919,0,274792455,0,274857991,0,274923527,0,274989063,0,275054599,0,275120135,0,275185671,0,275251207,0,275316743,0,275382279,0,275447815,0,275513351,0,275578887,0,275644423,0,275709959,0,275775495,0,275841031,0,275906567,
+0,275972103,0,276037639,0,276103175,0,276168711,0,276234251,0,14,661,0,66197,0,1245184,0,6160388,0,276299780,0,276365314,0,4718594,0,276430852,0,276496388,0,276561924,0,276627460,0,5701636,0,35848266,0,276693654,0,
+5,663,0,66199,0,142278694,0,276758530,0,24444930,0,10,196619,2147549184,276824078,262155,65536,24510468,2147483648,276889604,0,6160388,0,276955143,0,277020679,0,277086215,0,196619,2147549184,277151758,262155,65536,7,664,0,66200,0,1245184,
+0,1048580,0,69074951,0,6160388,0,125501444,0,8,664,2147549184,50463384,66200,65536,1245184,65536,1048580,65536,69074951,65536,6160388,65536,125501444,65536,277217339,2147483648,10,664,2147549184,50463384,66200,65536,1245184,65536,1048580,65536,69074951,65536,6160388,
+65536,125501444,65536,221773887,2147483648,6160388,0,4587524,0,12,664,2147549184,50463384,66200,65536,1245184,65536,1048580,65536,69074951,65536,6160388,65536,125501444,65536,221773887,2147483648,6160388,0,277282823,0,277348359,0,4587524,0,10,664,2147549184,50463384,66200,
+65536,1245184,65536,1048580,65536,69074951,65536,6160388,65536,125501444,65536,277217339,2147483648,277413895,0,277479431,0,12,664,2147549184,50463384,66200,65536,1245184,65536,1048580,65536,69074951,65536,6160388,65536,125501444,65536,221773887,2147483648,6160388,0,277413895,0,277479431,
+0,4587524,0,14,664,2147549184,50463384,66200,65536,1245184,65536,1048580,65536,69074951,65536,6160388,65536,125501444,65536,221773887,2147483648,6160388,0,277413895,0,277479431,0,277282823,0,277348359,0,4587524,0,11,664,2147549184,50463384,66200,65536,1245184,
+65536,1048580,65536,69074951,65536,6160388,65536,125501444,65536,60227613,2147483648,277217339,0,277413895,0,277479431,0,13,664,2147549184,50463384,66200,65536,1245184,65536,1048580,65536,69074951,65536,6160388,65536,125501444,65536,60227613,2147483648,221773887,0,6160388,0,277413895,
+0,277479431,0,4587524,0,15,664,2147549184,50463384,66200,65536,1245184,65536,1048580,65536,69074951,65536,6160388,65536,125501444,65536,60227613,2147483648,221773887,0,6160388,0,277413895,0,277479431,0,277282823,0,277348359,0,4587524,0,12,664,2147549184,
+50463384,66200,65536,1245184,65536,1048580,65536,69074951,65536,6160388,65536,125501444,65536,277544967,2147483648,277610503,0,277217339,0,277413895,0,277479431,0,12,664,2147549184,50463384,66200,65536,1245184,65536,1048580,65536,69074951,65536,6160388,65536,125501444,65536,221773887,
+2147483648,6160388,0,277544967,0,277610503,0,4587524,0,14,664,2147549184,50463384,66200,65536,1245184,65536,1048580,65536,69074951,65536,6160388,65536,125501444,65536,221773887,2147483648,6160388,0,4587524,0,277544967,0,277610503,0,277676039,0,277741575,0,12,
+664,2147549184,50463384,66200,65536,1245184,65536,1048580,65536,69074951,65536,6160388,65536,125501444,65536,277217339,2147483648,40173575,0,40108039,0,51576836,0,4587524,0,12,664,2147549184,50463384,66200,65536,1245184,65536,1048580,65536,69074951,65536,6160388,65536,125501444,
+65536,221773887,2147483648,6160388,0,40173575,0,40108039,0,51576836,0,11,664,2147549184,50463384,66200,65536,1245184,65536,1048580,65536,69074951,65536,6160388,65536,125501444,65536,40173575,2147483648,40108039,0,6160388,0,51576836,0,10,664,2147549184,50463384,66200,
+65536,1245184,65536,1048580,65536,69074951,65536,6160388,65536,125501444,65536,277217339,2147483648,277807111,0,277872647,0,12,664,2147549184,50463384,66200,65536,1245184,65536,1048580,65536,69074951,65536,6160388,65536,125501444,65536,221773887,2147483648,6160388,0,277807111,0,277872647,
+0,4587524,0,14,664,2147549184,50463384,66200,65536,1245184,65536,1048580,65536,69074951,65536,6160388,65536,125501444,65536,221773887,2147483648,6160388,0,4587524,0,277807111,0,277872647,0,277676039,0,277741575,0,8,664,2147549184,50463384,66200,65536,1245184,
+65536,1048580,65536,69074951,65536,6160388,65536,125501444,65536,277217339,2147483648,10,664,2147549184,50463384,66200,65536,1245184,65536,1048580,65536,69074951,65536,6160388,65536,125501444,65536,221773887,2147483648,6160388,0,4587524,0,12,664,2147549184,50463384,66200,65536,1245184,
+65536,1048580,65536,69074951,65536,6160388,65536,125501444,65536,221773887,2147483648,6160388,0,277676039,0,277741575,0,4587524,0,10,664,2147549184,50463384,66200,65536,1245184,65536,1048580,65536,69074951,65536,6160388,65536,125501444,65536,277217339,2147483648,6160388,0,277938180,
+0,10,664,2147549184,50463384,66200,65536,1245184,65536,1048580,65536,69074951,65536,6160388,65536,125501444,65536,221773887,2147483648,6160388,0,277938180,0,12,664,2147549184,50463384,66200,65536,1245184,65536,1048580,65536,69074951,65536,6160388,65536,125501444,65536,221773887,
+2147483648,6160388,0,277282823,0,277348359,0,277938180,0,9,664,2147549184,50463384,66200,65536,1245184,65536,1048580,65536,69074951,65536,6160388,65536,125501444,65536,278003719,2147483648,4587524,0,9,664,2147549184,50463384,66200,65536,1245184,65536,1048580,65536,69074951,
+65536,6160388,65536,125501444,65536,262602759,2147483648,4587524,0,11,664,2147549184,50463384,66200,65536,1245184,65536,1048580,65536,69074951,65536,6160388,65536,125501444,65536,278069255,2147483648,40108039,0,250675207,0,4587524,0,11,664,2147549184,50463384,66200,65536,1245184,
+65536,1048580,65536,69074951,65536,6160388,65536,125501444,65536,40108039,2147483648,65142791,0,278134788,0,6160388,0,13,664,2147549184,50463384,66200,65536,1245184,65536,1048580,65536,69074951,65536,6160388,65536,125501444,65536,278200327,2147483648,40108039,0,54460423,0,278134788,
+0,51576836,0,4718596,0,13,664,2147549184,50463384,66200,65536,1245184,65536,1048580,65536,69074951,65536,6160388,65536,125501444,65536,278200327,2147483648,40108039,0,54460423,0,278134788,0,51576836,0,4718596,0,9,664,2147549184,50463384,66200,65536,1245184,
+65536,1048580,65536,69074951,65536,6160388,65536,125501444,65536,278265863,2147483648,4587524,0,9,664,2147549184,50463384,66200,65536,1245184,65536,1048580,65536,69074951,65536,6160388,65536,125501444,65536,278331399,2147483648,4587524,0,9,664,2147549184,50463384,66200,65536,1245184,
+65536,1048580,65536,69074951,65536,6160388,65536,125501444,65536,262602759,2147483648,4587524,0,9,664,2147549184,50463384,66200,65536,1245184,65536,1048580,65536,69074951,65536,6160388,65536,125501444,65536,9699335,2147483648,4587524,0,13,664,2147549184,50463384,66200,65536,1245184,
+65536,1048580,65536,69074951,65536,6160388,65536,125501444,65536,6160388,2147483648,278396932,0,278265863,0,278462468,0,278528004,0,278593540,0,11,664,2147549184,50463384,66200,65536,1245184,65536,1048580,65536,69074951,65536,6160388,65536,125501444,65536,51380231,2147483648,184745991,
+0,327687,0,393223,0,15,664,2147549184,50463384,66200,65536,1245184,65536,1048580,65536,69074951,65536,6160388,65536,125501444,65536,8257540,2147483648,278659079,0,278724615,0,54460423,0,278790151,0,278855687,0,278921223,0,4587524,0,9,664,2147549184,
+50463384,66200,65536,1245184,65536,1048580,65536,69074951,65536,6160388,65536,125501444,65536,52428807,2147483648,4587524,0,11,664,2147549184,50463384,66200,65536,1245184,65536,1048580,65536,69074951,65536,6160388,65536,125501444,65536,277676039,2147483648,277741575,0,278986759,0,4587524,
+0,59,11,2147549184,2097174,65547,65536,1572886,65536,1638423,65536,1703936,65536,1179650,65536,1769474,65536,1835010,65536,1900548,65536,1966084,65536,2031637,65536,5177380,2147483648,14417927,0,14483463,0,14548999,0,30998535,0,242483207,0,279052292,0,279117831,
+0,1179652,0,279183364,0,279248900,0,278396932,0,279314439,0,277807111,0,277872647,0,279379975,0,279445511,0,279511044,0,279576578,0,279642114,0,279707650,0,279773186,0,279838722,0,279904258,0,279969796,0,280035332,0,280100871,0,27131906,
+0,28442626,0,23789570,0,24444930,0,280166402,0,280231938,0,280297474,0,280363010,0,280428546,0,280494082,0,149159940,0,28377144,0,23461954,0,196619,2147549184,280559630,262155,65536,196619,2147549184,280625166,262155,65536,196619,2147549184,280690702,262155,65536,
+196619,2147549184,280756238,262155,65536,3,704,0,66240,0,280821760,0,25,11,2147549184,2097174,65547,65536,1572886,65536,1638423,65536,1703936,65536,1179650,65536,1769474,65536,1835010,65536,1900548,65536,1966084,65536,2031637,65536,5177380,2147483648,193659585,0,
+280887307,0,196619,2147549184,280952846,262155,65536,2293760,2147483648,281018368,0,66715648,0,66781184,0,281083904,0,65142791,0,81330183,0,1179650,0,134545410,0};
+
+int bfBlenderTablesLen=sizeof(bfBlenderTables)/sizeof(bfBlenderTables[0]);
 //===============================================================================================
 
 #endif //bftBlend_imp_
@@ -384,6 +384,8 @@ static void WriteMemPointer(const unsigned char* p,const uint64_t& value,unsigne
 
 } // namespace
 
+#define FBT_COMPILED_MAX_DEPTH 64   // embedded struct depth limit of fbtBlend.h bfBlenderTables
+
 struct BlendDNA1StructField {
     uint16_t  typeIdx;
     uint16_t  nameIdx;
@@ -642,6 +644,65 @@ struct BlendDNA1Block {
         bstr.bDeclared = true;
     }
 
+    // [fbtBlend.h] Writer of bfBlenderTables (see fprintCompiledTables(...))
+    struct CompiledTablesWriter {
+        FILE* f;uint32_t col;
+        uint32_t keys[FBT_COMPILED_MAX_DEPTH];
+        uint32_t lastKeys[FBT_COMPILED_MAX_DEPTH];uint16_t lastDepth;
+        CompiledTablesWriter(FILE* _f) : f(_f),col(0),lastDepth(0) {}
+        void word(uint32_t value) {
+            if (col>0) fprintf(f,",");
+            if (col%40==0) fprintf(f,"\n");
+            fprintf(f,"%u",value);
+            ++col;
+        }
+        // type | name << 16, nr | depth << 16 (| 1 << 31 when the depth keys follow: they differ from the last member ones)
+        void member(uint32_t key,uint16_t nr,uint16_t depth) {
+            bool sameKeys = (depth==lastDepth);
+            for (uint16_t d=0;sameKeys && d<depth;d++) sameKeys = (keys[d]==lastKeys[d]);
+            word(key);
+            word((uint32_t)nr | ((uint32_t)depth<<16) | (sameKeys ? 0 : 0x80000000));
+            if (!sameKeys) for (uint16_t d=0;d<depth;d++) word(lastKeys[d]=keys[d]);
+            lastDepth = depth;
+        }
+    };
+    // [fbtBlend.h] The members fbtBinTables::compile() flattens bstr into: non-pointer fields of a struct type are expanded
+    // (nr: their array index, keys: the type | name << 16 chain of the fields they are embedded in).
+    // Writes them (when w.f is not NULL) and returns their number.
+    uint32_t _fprintCompiledMembers(CompiledTablesWriter& w,const BlendDNA1Struct& bstr,uint16_t nr,uint16_t depth) const {
+        uint32_t rv = 0;
+        const uint16_t firstStructType = pStructs[0].typeIdx;
+        for (uint16_t a=0;a<nr;a++) {
+            for (uint32_t fd=0;fd<bstr.numFields;fd++) {
+                const BlendDNA1StructField& field = pFieldsAllTogether[bstr.fieldOffset+fd];
+                const uint32_t key = (uint32_t)field.typeIdx | ((uint32_t)field.nameIdx<<16);
+                if (field.typeIdx>=firstStructType && !strchr(names[field.nameIdx],'*')) {
+                    const BlendDNA1Struct* pFieldStruct = pTypeStructs[field.typeIdx];
+                    if (pFieldStruct && depth<FBT_COMPILED_MAX_DEPTH) {
+                        w.keys[depth] = key;
+                        rv+=_fprintCompiledMembers(w,*pFieldStruct,GetNumArrayElementsFromName(names[field.nameIdx]),depth+1);
+                    }
+                    continue;
+                }
+                if (w.f) w.member(key,a,depth);
+                ++rv;
+            }
+        }
+        return rv;
+    }
+    // [fbtBlend.h] bfBlenderTables: dnaLen, numStructs, then for each struct the number of its members and its members
+    void fprintCompiledTables(FILE* f,uint32_t dnaLen) const {
+        CompiledTablesWriter w(f),counter(NULL);
+        w.word(dnaLen);
+        w.word(numStructs);
+        for (uint32_t i=0;i<numStructs;i++) {
+            const BlendDNA1Struct& bstr = pStructs[i];
+            w.word(_fprintCompiledMembers(counter,bstr,1,0));
+            w.lastDepth = 0;
+            _fprintCompiledMembers(w,bstr,1,0);
+        }
+    }
+
 };
 
 struct BlendBlock {
@@ -1184,7 +1245,7 @@ bool BlendFile::generateBlenderSDNACpp(const char *saveFileName, const char *pre
 }
 
 bool BlendFile::updatefbtBlendHeader(const char* oldfbtBlendPath,const char* newfbtBlendPath)	{
-	if (!_blockDnaPtr || !oldfbtBlendPath  || strlen(oldfbtBlendPath)==0 || !newfbtBlendPath || strlen(newfbtBlendPath)==0) return false;
+	if (!_blockDnaPtr || !dna1Block || !oldfbtBlendPath  || strlen(oldfbtBlendPath)==0 || !newfbtBlendPath || strlen(newfbtBlendPath)==0) return false;
 	unsigned long contentSize = 0;
 	char* content = (char*) GetFileContent(oldfbtBlendPath,&contentSize,"rt");
 	if (!content) return false;
@@ -1217,7 +1278,12 @@ bool BlendFile::updatefbtBlendHeader(const char* oldfbtBlendPath,const char* new
             if (i!=_blockDnaSize-1) fprintf(f,",");
         }
         fprintf(f,"};\n\n");
-        fprintf(f,"int bfBlenderLen=sizeof(bfBlenderFBT);\n");
+        fprintf(f,"int bfBlenderLen=sizeof(bfBlenderFBT);\n\n");
+        fprintf(f,"// bfBlenderFBT already compiled (see fbtBinTables::load())\n");
+        fprintf(f,"const FBTuint32 bfBlenderTables[] = {");
+        dna1Block->fprintCompiledTables(f,(uint32_t)_blockDnaSize);
+        fprintf(f,"};\n\n");
+        fprintf(f,"int bfBlenderTablesLen=sizeof(bfBlenderTables)/sizeof(bfBlenderTables[0]);\n");
 		fwrite(endReplacement,contentSize-(endReplacement-content),1,f);        
         fclose(f);
     }	
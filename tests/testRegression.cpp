@@ -0,0 +1,619 @@
+// Regression tests of the parse modes and of the fbtFile features (test.blend must be in the current folder).
+// Every test parses test.blend some way and compares what it gets with a plain parse(path) of it.
+// Linux / MacOS:
+// g++ -O2 -no-pie testRegression.cpp -I"./" -I"../" -o testRegression -D"FBT_USE_GZ_FILE=1" -D"FBT_USE_ZSTD_FILE=1" -lz -lzstd
+// Windows:
+// cl ./testRegression.cpp /I"./" /I"../" /D"FBT_USE_GZ_FILE=1" /D"FBT_USE_ZSTD_FILE=1" /link /out:testRegression.exe zlib.lib zstd.lib Shell32.lib
+
+// Build and run it a second time with the worker pool (parallel link, read-ahead stream, multi-frame zstd decompression),
+// 4 workers whatever the number of cores:
+// g++ -O2 -no-pie testRegression.cpp -I"./" -I"../" -o testRegression_mt -D"FBT_USE_THREADS=1" -D"FBT_MAX_THREADS=4" -D"FBT_USE_GZ_FILE=1" -D"FBT_USE_ZSTD_FILE=1" -pthread -lz -lzstd
+// cl ./testRegression.cpp /I"./" /I"../" /D"FBT_USE_THREADS=1" /D"FBT_MAX_THREADS=4" /D"FBT_USE_GZ_FILE=1" /D"FBT_USE_ZSTD_FILE=1" /link /out:testRegression_mt.exe zlib.lib zstd.lib Shell32.lib
+
+// Without FBT_USE_GZ_FILE (FBT_USE_ZSTD_FILE) the gzip (zstd) tests are skipped.
+// Build it again with -D"FBT_RESOLVE_INNER_POINTERS=1" (/D on Windows) to test the pointers into the middle of a block resolved.
+
+// Returns 0 if all the tests pass, 1 otherwise.
+
+#define FBTBLEND_IMPLEMENTATION
+#include "../fbtBlend.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static int numFailed = 0;
+
+static void check(bool ok, const char* test, const char* what) {
+    printf("%s %s: %s\n", ok ? "ok    " : "FAILED", test, what);
+    if (!ok) ++numFailed;
+}
+
+// FNV-1a of what testConsole prints (names, matrices, vertices and materials of the objects).
+// The pointers are followed with fp.get<T>() and fp.resolve(): the same walk works with setLazyLink(true).
+static unsigned long digestObjects(fbtBlend& fp) {
+    unsigned long h = 2166136261UL;
+    for (Blender::Object* ob = (Blender::Object*)fp.m_object.first; ob; ob = fp.get<Blender::Object>(ob->id.next)) {
+        const unsigned char* p = (const unsigned char*)ob->id.name;
+        for (size_t i = 0; p[i]; ++i) h = ((h ^ p[i]) * 16777619UL) & 0xFFFFFFFFUL;
+        p = (const unsigned char*)ob->obmat;
+        for (size_t i = 0; i < sizeof(ob->obmat); ++i) h = ((h ^ p[i]) * 16777619UL) & 0xFFFFFFFFUL;
+        const Blender::Mesh* me = ob->type == 1 ? fp.get<Blender::Mesh>(ob->data) : 0;
+        if (me) {
+            h = ((h ^ (unsigned long)me->totvert) * 16777619UL) & 0xFFFFFFFFUL;
+            const Blender::MVert* mvert = fp.get<Blender::MVert>(me->mvert);
+            for (int v = 0; mvert && v < me->totvert; ++v) {
+                p = (const unsigned char*)mvert[v].co;
+                for (size_t i = 0; i < sizeof(mvert[v].co); ++i) h = ((h ^ p[i]) * 16777619UL) & 0xFFFFFFFFUL;
+            }
+            for (int m = 0; me->mat && m < me->totcol; ++m) {
+                const Blender::Material* ma = (const Blender::Material*)fp.resolve(me->mat, m);
+                if (!ma) continue;
+                p = (const unsigned char*)ma->id.name;
+                for (size_t i = 0; p[i]; ++i) h = ((h ^ p[i]) * 16777619UL) & 0xFFFFFFFFUL;
+            }
+        }
+    }
+    return h;
+}
+
+static int countLinks(const fbtList& list) {
+    int n = 0;
+    for (fbtList::Link* l = list.first; l; l = l->next) ++n;
+    return n;
+}
+
+// What a plain parse(path) of test.blend gets
+static const char* blendPath = "test.blend";
+static unsigned long refDigest = 0;
+static int refObjects = 0;
+
+static void checkParse(fbtBlend& fp, int status, const char* test) {
+    check(status == fbtFile::FS_OK, test, "parse() status");
+    check(countLinks(fp.m_object) == refObjects, test, "object count");
+    check(status == fbtFile::FS_OK && digestObjects(fp) == refDigest, test, "object digest");
+}
+
+
+// PM_MMAP: the payloads are used in place from the mapped file
+static void testMmap() {
+    fbtBlend fp;
+    checkParse(fp, fp.parse(blendPath, fbtFile::PM_MMAP), "PM_MMAP");
+}
+
+// parse(memory): uncompressed memory is borrowed until parse() returns, nothing references it afterwards
+static void testBorrowedMemory() {
+    unsigned long size = 0;
+    unsigned char* content = fbtFile::FBT_GetFileContent(blendPath, &size);
+    check(content != 0, "parse(memory)", "file read");
+    if (!content) return;
+    fbtBlend fp;
+    const int status = fp.parse(content, size);
+    memset(content, 0xCD, size);
+    delete[] content;
+    checkParse(fp, status, "parse(memory)");
+}
+
+// Compressed copies of test.blend: parse(path) sniffs the compression, parse(memory, PM_COMPRESSED) too
+static const char* tmpPath = "testRegression.tmp.blend";
+
+static bool writeFile(const char* path, const void* data, size_t size) {
+    FILE* f = fbtFile::UTF8_fopen(path, "wb");
+    if (!f) return false;
+    const bool ok = fwrite(data, 1, size, f) == size;
+    fclose(f);
+    return ok;
+}
+
+#if FBT_USE_GZ_FILE == 1 || FBT_USE_ZSTD_FILE == 1
+static void checkCompressedParse(const char* test) {
+    {
+        fbtBlend fp;
+        checkParse(fp, fp.parse(tmpPath), test);
+    }
+    unsigned long size = 0;
+    unsigned char* content = fbtFile::FBT_GetFileContent(tmpPath, &size);
+    if (content) {
+        fbtBlend fp;
+        checkParse(fp, fp.parse(content, size, fbtFile::PM_COMPRESSED), test);
+        delete[] content;
+    }
+    remove(tmpPath);
+}
+#endif
+
+#if FBT_USE_GZ_FILE == 1
+static bool writeGzip(const char* path) {
+    unsigned long size = 0;
+    unsigned char* content = fbtFile::FBT_GetFileContent(blendPath, &size);
+    gzFile gz = content ? gzopen(path, "wb") : 0;
+    const bool written = gz && gzwrite(gz, content, (unsigned)size) == (int)size;
+    if (gz) gzclose(gz);
+    delete[] content;
+    return written;
+}
+
+static void testGzip() {
+    const bool written = writeGzip(tmpPath);
+    check(written, "gzip", "file written");
+    if (written) checkCompressedParse("gzip");
+}
+#endif
+
+#if FBT_USE_ZSTD_FILE == 1
+// The seek table (zstd seekable format, as Blender writes it) after the frames: a broken one must fall back to streaming
+enum SeekTable {NO_SEEK_TABLE, SEEK_TABLE, SEEK_TABLE_CHECKSUMS, BAD_SEEK_FOOTER, BAD_SEEK_ENTRY};
+
+static void putLE32(unsigned char* p, size_t v) {
+    for (int i = 0; i < 4; ++i) p[i] = (unsigned char)(v >> (8 * i));
+}
+
+static void checkSeekableParse(const char* test) {
+    fbtBlend plain, fp;
+    fbtFile::ChunkDirectory dir, plainDir;
+    check(fp.scanChunks(tmpPath, dir) == fbtFile::FS_OK && plain.scanChunks(blendPath, plainDir) == fbtFile::FS_OK &&
+          dir.size() == plainDir.size() && memcmp(dir.ptr(), plainDir.ptr(), dir.size() * sizeof(fbtFile::ChunkInfo)) == 0,
+          test, "scanChunks()");
+    fp.setLazyLink(true);
+    checkParse(fp, fp.parse(tmpPath), test);
+}
+
+// frameSize: bytes of test.blend per zstd frame (0: a single frame). Multi-frame files are decompressed on the worker pool.
+static void testZstd(size_t frameSize, SeekTable seekTable, const char* test) {
+    unsigned long size = 0;
+    unsigned char* content = fbtFile::FBT_GetFileContent(blendPath, &size);
+    if (frameSize == 0) frameSize = size;
+    const size_t numFrames = (size + frameSize - 1) / frameSize;
+    const size_t bound = ZSTD_compressBound(frameSize) * numFrames + numFrames * 12 + 17;
+    unsigned char* packed = content ? new unsigned char[bound] : 0;
+    unsigned char* table = packed ? new unsigned char[numFrames * 12 + 17] : 0;
+    size_t packedSize = 0, tableSize = 8;
+    ZSTD_CCtx* cctx = ZSTD_createCCtx();
+    ZSTD_CCtx_setParameter(cctx, ZSTD_c_checksumFlag, seekTable == SEEK_TABLE_CHECKSUMS);
+    bool written = packed != 0 && cctx != 0;
+    for (size_t pos = 0; written && pos < size; pos += frameSize) {
+        const size_t len = size - pos < frameSize ? size - pos : frameSize;
+        const size_t n = ZSTD_compress2(cctx, packed + packedSize, bound - packedSize, content + pos, len);
+        written = !ZSTD_isError(n);
+        if (!written) break;
+        putLE32(table + tableSize, n);
+        putLE32(table + tableSize + 4, len);
+        tableSize += 8;
+        if (seekTable == SEEK_TABLE_CHECKSUMS) {
+            // (the frame ends with the low 32 bits of the XXH64 of its content)
+            memcpy(table + tableSize, packed + packedSize + n - 4, 4);
+            tableSize += 4;
+        }
+        packedSize += n;
+    }
+    ZSTD_freeCCtx(cctx);
+    if (written && seekTable != NO_SEEK_TABLE) {
+        putLE32(table + tableSize, numFrames);
+        table[tableSize + 4] = seekTable == SEEK_TABLE_CHECKSUMS ? 0x80 : 0;
+        putLE32(table + tableSize + 5, 0x8F92EAB1);
+        tableSize += 9;
+        putLE32(table, 0x184D2A5E);
+        putLE32(table + 4, tableSize - 8);
+        if (seekTable == BAD_SEEK_FOOTER) table[tableSize - 1] ^= 0xFF;
+        if (seekTable == BAD_SEEK_ENTRY) putLE32(table + 8, packedSize + 1);
+        memcpy(packed + packedSize, table, tableSize);
+        packedSize += tableSize;
+    }
+    written = written && writeFile(tmpPath, packed, packedSize);
+    delete[] table;
+    delete[] packed;
+    delete[] content;
+    check(written, test, "file written");
+    if (written && seekTable != NO_SEEK_TABLE) checkSeekableParse(test);
+    if (written) checkCompressedParse(test);
+}
+#endif
+
+// scanChunks(): the chunk headers only, the same from the file and from memory
+static void testScanChunks() {
+    unsigned long size = 0;
+    unsigned char* content = fbtFile::FBT_GetFileContent(blendPath, &size);
+    fbtBlend fp;
+    fbtFile::ChunkDirectory dir, dirMem;
+    FBTsizeType dna = FBT_NPOS, dnaMem = FBT_NPOS;
+    check(fp.scanChunks(blendPath, dir, &dna) == fbtFile::FS_OK, "scanChunks", "status (path)");
+    check(content && fp.scanChunks(content, size, dirMem, &dnaMem) == fbtFile::FS_OK, "scanChunks", "status (memory)");
+    check(dir.size() > 0 && dir.size() == dirMem.size() && dna == dnaMem &&
+          memcmp(dir.ptr(), dirMem.ptr(), dir.size() * sizeof(fbtFile::ChunkInfo)) == 0, "scanChunks", "same directory");
+    check(dna < dir.size() && dir[dna].m_code == (FBTuint32)FBT_ID('D','N','A','1') &&
+          dir[dna].m_offset + 4 <= size && memcmp(content + dir[dna].m_offset, "SDNA", 4) == 0, "scanChunks", "DNA1 offset");
+    int numObjects = 0;
+    for (FBTsizeType i = 0; i < dir.size(); ++i)
+        if (dir[i].m_code == (FBTuint32)FBT_ID2('O','B')) ++numObjects;
+    check(numObjects == refObjects, "scanChunks", "object chunks");
+    delete[] content;
+}
+
+// setLoadFilter(): only the listed ID types and the blocks they reach are loaded. Files that can seek read only those
+// payloads, the others (gzip) read everything and drop the rest.
+static void testLoadFilter(const char* path, const char* test) {
+    static const FBTuint32 idCodes[] = {FBT_ID2('O','B'), FBT_ID2('M','E'), FBT_ID2('M','A'), 0};
+    int numChunks = 0;
+    {
+        fbtBlend fp;
+        if (fp.parse(blendPath) == fbtFile::FS_OK) numChunks = countLinks(fp.getChunks());
+    }
+    fbtBlend fp;
+    fp.setLoadFilter(idCodes);
+    checkParse(fp, fp.parse(path), test);
+    check(countLinks(fp.getChunks()) < numChunks, test, "fewer chunks loaded");
+    check(countLinks(fp.m_screen) == 0 && countLinks(fp.m_wm) == 0, test, "other ID types not loaded");
+}
+
+// readThumbnail(): the preview image, the same from the file and from memory
+static void testThumbnail() {
+    fbtBlend fp;
+    unsigned char* pixels = 0, *pixelsMem = 0;
+    int width = 0, height = 0, widthMem = 0, heightMem = 0;
+    check(fp.readThumbnail(blendPath, pixels, width, height) == fbtFile::FS_OK && pixels && width > 0 && height > 0,
+          "readThumbnail", "preview read (path)");
+    unsigned long size = 0;
+    unsigned char* content = fbtFile::FBT_GetFileContent(blendPath, &size);
+    check(content && fp.readThumbnail(content, size, pixelsMem, widthMem, heightMem) == fbtFile::FS_OK && pixelsMem,
+          "readThumbnail", "preview read (memory)");
+    check(pixels && pixelsMem && width == widthMem && height == heightMem &&
+          memcmp(pixels, pixelsMem, (size_t)width * height * 4) == 0, "readThumbnail", "same preview");
+    delete[] pixels;
+    delete[] pixelsMem;
+    delete[] content;
+}
+
+// Big endian twin of test.blend (little endian): the chunk headers, the DNA and the members of the structs are swapped,
+// and so are the pointer arrays (the DATA blocks reached through ** members) and the size of the preview (TEST).
+struct BigEndianCopy {
+    unsigned char* data;
+    size_t size, ptrSize;
+    fbtArray<const char*> names;
+    fbtArray<int> tlen, strcOfType, strcFirst, members;     // members: per struct its type, count and (type, name) pairs
+    fbtArray<FBTuint64> ptrArrays;                          // (old pointers)
+};
+
+static int readLE(const unsigned char* p, size_t size) {
+    unsigned int v = 0;
+    for (size_t i = size; i-- > 0;) v = (v << 8) | p[i];
+    return size == 2 ? (int)(short)v : (int)v;
+}
+
+static FBTuint64 readPtrLE(const unsigned char* p, size_t size) {
+    FBTuint64 v = 0;
+    for (size_t i = size; i-- > 0;) v = (v << 8) | p[i];
+    return v;
+}
+
+static void swapBytes(unsigned char* p, size_t size, size_t count) {
+    for (; count > 0; --count, p += size)
+        for (size_t i = 0; i < size / 2; ++i) { unsigned char t = p[i]; p[i] = p[size - 1 - i]; p[size - 1 - i] = t; }
+}
+
+// Reads the DNA tables into 'be' (swap false), or swaps them (swap true)
+static void walkDna(BigEndianCopy& be, unsigned char* dna, bool swap) {
+    size_t p = 8;
+    for (int section = 0; section < 4; ++section) {
+        if (section > 0) p = ((p + 3) & ~(size_t)3) + 4;    // (TYPE, TLEN, STRC)
+        const int n = section == 2 ? (int)be.tlen.size() : readLE(dna + p, 4);
+        if (section != 2) {
+            if (swap) swapBytes(dna + p, 4, 1);
+            p += 4;
+        }
+        for (int i = 0; i < n; ++i) {
+            if (section < 2) {
+                if (!swap && section == 0) be.names.push_back((const char*)dna + p);
+                if (!swap && section == 1) { be.tlen.push_back(0); be.strcOfType.push_back(-1); }
+                p += strlen((const char*)dna + p) + 1;
+            } else if (section == 2) {
+                if (!swap) be.tlen[i] = readLE(dna + p, 2);
+                else swapBytes(dna + p, 2, 1);
+                p += 2;
+            } else {
+                const int count = swap ? 0 : readLE(dna + p + 2, 2);
+                if (!swap) {
+                    be.strcOfType[readLE(dna + p, 2)] = i;
+                    be.strcFirst.push_back((int)be.members.size());
+                    for (int j = 0; j < 2 + 2 * count; ++j) be.members.push_back(readLE(dna + p + 2 * j, 2));
+                } else {
+                    const int num = be.members[be.strcFirst[i] + 1];
+                    swapBytes(dna + p, 2, 2 + 2 * num);
+                    p += 4 * num;
+                }
+                p += 4 + 4 * count;
+            }
+        }
+    }
+}
+
+static void swapStruct(BigEndianCopy& be, unsigned char* b, int strc) {
+    const int* m = be.members.ptr() + be.strcFirst[strc];
+    for (int j = 0; j < m[1]; ++j) {
+        const int type = m[2 + 2 * j];
+        const char* name = be.names[m[3 + 2 * j]];
+        size_t n = 1;
+        for (const char* c = strchr(name, '['); c; c = strchr(c + 1, '[')) n *= (size_t)atoi(c + 1);
+        if (name[0] == '*' || (name[0] == '(' && name[1] == '*')) {
+            if (name[0] == '*' && name[1] == '*') be.ptrArrays.push_back(readPtrLE(b, be.ptrSize));
+            swapBytes(b, be.ptrSize, n);
+            b += be.ptrSize * n;
+            continue;
+        }
+        if (be.strcOfType[type] >= 0)
+            for (size_t k = 0; k < n; ++k) swapStruct(be, b + k * be.tlen[type], be.strcOfType[type]);
+        else if (be.tlen[type] > 1)
+            swapBytes(b, (size_t)be.tlen[type], n);
+        b += be.tlen[type] * n;
+    }
+}
+
+static bool makeBigEndian(BigEndianCopy& be) {
+    unsigned char* data = be.data;
+    if (be.size < 12 || memcmp(data, "BLENDER", 7) != 0 || data[8] != 'v') return false;
+    be.ptrSize = data[7] == '-' ? 8 : 4;
+    const size_t header = 16 + be.ptrSize;
+    size_t pos;
+    for (pos = 12; pos + header <= be.size; pos += header + readLE(data + pos + 4, 4)) {
+        if (memcmp(data + pos, "DNA1", 4) == 0) { walkDna(be, data + pos + header, false); break; }
+    }
+    if (be.strcFirst.size() == 0) return false;
+
+    fbtArray<size_t> rawData;   // (DATA blocks of no struct)
+    for (pos = 12; pos + header <= be.size;) {
+        unsigned char* chunk = data + pos;
+        const int len = readLE(chunk + 4, 4), sdna = readLE(chunk + 8 + be.ptrSize, 4), nr = readLE(chunk + 12 + be.ptrSize, 4);
+        unsigned char* body = chunk + header;
+        if (memcmp(chunk, "DNA1", 4) == 0)
+            walkDna(be, body, true);
+        else if (memcmp(chunk, "TEST", 4) == 0)
+            swapBytes(body, 4, 2);
+        else if (sdna != 0) {
+            const size_t len1 = (size_t)be.tlen[be.members[be.strcFirst[sdna]]];
+            if (len1 * nr <= (size_t)len)
+                for (int k = 0; k < nr; ++k) swapStruct(be, body + k * len1, sdna);
+        } else if (memcmp(chunk, "DATA", 4) == 0)
+            rawData.push_back(pos);
+        swapBytes(chunk + 4, 4, 1);
+        swapBytes(chunk + 8, be.ptrSize, 1);
+        swapBytes(chunk + 8 + be.ptrSize, 4, 2);
+        pos += header + len;
+        if (memcmp(chunk, "ENDB", 4) == 0) break;
+    }
+    for (FBTsizeType i = 0; i < rawData.size(); ++i) {
+        unsigned char* chunk = data + rawData[i];
+        unsigned char old[8];
+        memcpy(old, chunk + 8, be.ptrSize);
+        swapBytes(old, be.ptrSize, 1);
+        if (be.ptrArrays.find(readPtrLE(old, be.ptrSize)) != FBT_NPOS) {
+            unsigned char len[4];
+            memcpy(len, chunk + 4, 4);
+            swapBytes(len, 4, 1);
+            swapBytes(chunk + header, be.ptrSize, (size_t)readLE(len, 4) / be.ptrSize);
+        }
+    }
+    data[8] = 'V';
+    return true;
+}
+
+// Files of the other endianness: every number and pointer is swapped while linking
+static void testBigEndian() {
+    unsigned long size = 0;
+    BigEndianCopy be;
+    be.data = fbtFile::FBT_GetFileContent(blendPath, &size);
+    be.size = size;
+    const bool made = be.data && makeBigEndian(be);
+    check(made, "big endian", "big endian copy made");
+    if (made) {
+        {
+            fbtBlend fp;
+            checkParse(fp, fp.parse(be.data, be.size), "big endian");
+        }
+        if (writeFile(tmpPath, be.data, be.size)) {
+            fbtBlend fp;
+            checkParse(fp, fp.parse(tmpPath), "big endian (path)");
+            remove(tmpPath);
+        }
+    }
+    delete[] be.data;
+}
+
+// A tiny fbtFile with DNA of its own, the memory one being
+//     struct Test {int a; short b; short pad;};            struct Holder {Test* first, *elem, *member, *past;};
+// and the file one (64 bit pointers)
+//     struct Test {short a; short pad; int b;};            struct Holder {Test* first, *elem, *member, *past;};
+struct DnaBuffer {
+    fbtArray<unsigned char> bytes;
+    bool swap;      // (big endian)
+    DnaBuffer(bool bigEndian) : swap(bigEndian) {}
+    void put(const void* p, size_t size) {
+        for (size_t i = 0; i < size; ++i) bytes.push_back(((const unsigned char*)p)[swap ? size - 1 - i : i]);
+    }
+    void put32(int v) {put(&v, 4);}
+    void put16(int v) {short s = (short)v; put(&s, 2);}
+    void putText(const char* text) {for (; *text; ++text) bytes.push_back((unsigned char)*text);}
+    void align4() {while (bytes.size() & 3) bytes.push_back(0);}
+    void putChunk(const char* code, int len, FBTuint64 old, int sdna, int nr) {
+        for (int i = 0; i < 4; ++i) bytes.push_back((unsigned char)(*code ? *code++ : 0));
+        put32(len); put(&old, 8); put32(sdna); put32(nr);
+    }
+};
+
+static void putTestDna(DnaBuffer& dna, bool file) {
+    static const char* names[] = {"a", "b", "pad", "*first", "*elem", "*member", "*past"};
+    static const char* types[] = {"int", "short", "Test", "Holder"};
+    dna.putText("SDNANAME");
+    dna.put32(7);
+    for (int i = 0; i < 7; ++i) {dna.putText(names[i]); dna.bytes.push_back(0);}
+    dna.align4();
+    dna.putText("TYPE");
+    dna.put32(4);
+    for (int i = 0; i < 4; ++i) {dna.putText(types[i]); dna.bytes.push_back(0);}
+    dna.align4();
+    dna.putText("TLEN");
+    dna.put16(4); dna.put16(2); dna.put16(8); dna.put16(4 * (file ? 8 : (int)sizeof(void*)));
+    dna.align4();
+    dna.putText("STRC");
+    dna.put32(2);
+    dna.put16(2); dna.put16(3);                 // (type Test, 3 members: type, name)
+    if (file) {dna.put16(1); dna.put16(0); dna.put16(1); dna.put16(2); dna.put16(0); dna.put16(1);}
+    else      {dna.put16(0); dna.put16(0); dna.put16(1); dna.put16(1); dna.put16(1); dna.put16(2);}
+    dna.put16(3); dna.put16(4);
+    for (int i = 3; i < 7; ++i) {dna.put16(2); dna.put16(i);}
+}
+
+// The file: a Test block (TE), an array of 4 Test (DATA at 0x2000) and a Holder (HO) pointing into the array
+static void putTestFile(DnaBuffer& blend, bool bigEndian) {
+    DnaBuffer dna(bigEndian);
+    putTestDna(dna, true);
+    blend.putText(bigEndian ? "BLENDER-V279" : "BLENDER-v279");
+    blend.putChunk("TE", 8, 0x1000, 0, 1);
+    blend.put16(-2); blend.put16(0); blend.put32(-3);
+    blend.putChunk("DATA", 32, 0x2000, 0, 4);
+    for (int i = 0; i < 4; ++i) {blend.put16(i); blend.put16(0); blend.put32(10 + i);}
+    const FBTuint64 ptrs[] = {0x2000, 0x2010, 0x2000 + 8 + 2, 0x2020};     // (file Test is 8 bytes, pad at 2)
+    blend.putChunk("HO", 32, 0x3000, 1, 1);
+    for (int i = 0; i < 4; ++i) blend.put(&ptrs[i], 8);
+    blend.putChunk("DNA1", (int)dna.bytes.size(), 0x4000, 0, 1);
+    for (FBTsizeType i = 0; i < dna.bytes.size(); ++i) blend.bytes.push_back(dna.bytes[i]);
+    blend.putChunk("ENDB", 0, 0, 0, 0);
+}
+
+class TestFile : public fbtFile {
+public:
+    struct Test {int a; short b; short pad;};
+    struct Holder {Test* first, *elem, *member, *past;};
+    Test* m_test;
+    Holder* m_holder;
+    TestFile() : fbtFile("BLENDER"), m_test(0), m_holder(0) {}
+protected:
+    static DnaBuffer& memoryDna() {
+        static DnaBuffer dna(false);
+        if (dna.bytes.size() == 0) putTestDna(dna, false);
+        return dna;
+    }
+    virtual int initializeTables(fbtBinTables* tables) {
+        return tables->read(getFBT(), getFBTlength(), false) ? FS_OK : FS_FAILED;
+    }
+    virtual int notifyData(void* p, const Chunk& id) {
+        if (id.m_code == (FBTuint32)FBT_ID2('T', 'E')) m_test = (Test*)p;
+        if (id.m_code == (FBTuint32)FBT_ID2('H', 'O')) m_holder = (Holder*)p;
+        return FS_OK;
+    }
+    virtual void*   getFBT(void) {return memoryDna().bytes.ptr();}
+    virtual FBTsize getFBTlength(void) {return (FBTsize)memoryDna().bytes.size();}
+};
+
+// Number casts between the file and the memory DNA (Test: short -> int and int -> short)
+static void testCast(bool bigEndian, const char* test) {
+    DnaBuffer blend(bigEndian);
+    putTestFile(blend, bigEndian);
+    TestFile fp;
+    check(fp.parse(blend.bytes.ptr(), (FBTsize)blend.bytes.size()) == fbtFile::FS_OK && fp.m_test, test, "parse() status");
+    const TestFile::Test* t = fp.m_test;
+    check(t && t->a == -2, test, "short -> int sign extended");
+    check(t && t->b == -3, test, "int -> short");
+}
+
+// Old pointers into the middle of a block: with FBT_RESOLVE_INNER_POINTERS 1 they resolve to the same element (and
+// member) of the converted block, otherwise to 0. Past the end of the block they are 0 either way.
+static void testInnerPointers() {
+    const char* test = FBT_RESOLVE_INNER_POINTERS == 1 ? "inner pointers (resolved)" : "inner pointers (0)";
+    DnaBuffer blend(false);
+    putTestFile(blend, false);
+    TestFile fp;
+    check(fp.parse(blend.bytes.ptr(), (FBTsize)blend.bytes.size()) == fbtFile::FS_OK && fp.m_holder, test, "parse() status");
+    const TestFile::Holder* h = fp.m_holder;
+    if (!h) return;
+    check(h->first && h->first[2].a == 2 && h->first[3].b == 13, test, "array converted");
+#   if FBT_RESOLVE_INNER_POINTERS == 1
+    check(h->elem == h->first + 2, test, "pointer to an element");
+    check((const void*)h->member == (const void*)&h->first[1].pad, test, "pointer to a member");
+#   else
+    check(h->elem == 0 && h->member == 0, test, "pointers into the block are 0");
+#   endif
+    check(h->past == 0, test, "pointer past the block end is 0");
+}
+
+// setLazyLink(true): the ID lists are walked with get<T>(id.next), the rest is converted as it is resolved
+static void testLazyLink() {
+    {
+        fbtBlend fp;
+        fp.setLazyLink(true);
+        checkParse(fp, fp.parse(blendPath), "setLazyLink");
+        int numObjects = 0, numBack = 0;
+        Blender::Object* last = 0;
+        for (Blender::Object* ob = (Blender::Object*)fp.m_object.first; ob; ob = fp.get<Blender::Object>(ob->id.next), ++numObjects)
+            last = ob;
+        for (Blender::Object* ob = last; ob; ob = fp.get<Blender::Object>(ob->id.prev)) ++numBack;
+        check(numObjects == refObjects && numBack == refObjects && (void*)last == (void*)fp.m_object.last, "setLazyLink", "object list walked both ways");
+    }
+    fbtBlend fp;
+    fp.setLazyLink(true);
+    checkParse(fp, fp.parse(blendPath, fbtFile::PM_MMAP), "setLazyLink (PM_MMAP)");
+}
+
+// The file DNA tables are shared (fbtDNACache) by the files of the same DNA1 block
+static void testDnaCache() {
+    fbtBlend fp1, fp2, fp3;
+    check(fp1.parse(blendPath) == fbtFile::FS_OK && fp2.parse(blendPath, fbtFile::PM_MMAP) == fbtFile::FS_OK &&
+          fp1.getFileTable() && fp1.getFileTable() == fp2.getFileTable(), "DNA cache", "same DNA, same tables");
+    checkParse(fp2, fbtFile::FS_OK, "DNA cache");
+    unsigned long size = 0;
+    BigEndianCopy be;
+    be.data = fbtFile::FBT_GetFileContent(blendPath, &size);
+    be.size = size;
+    if (be.data && makeBigEndian(be))
+        check(fp3.parse(be.data, be.size) == fbtFile::FS_OK && fp3.getFileTable() != fp1.getFileTable(), "DNA cache",
+              "other DNA, other tables");
+    delete[] be.data;
+}
+
+
+int main(int argc, const char* argv[]) {
+    if (argc > 1) blendPath = argv[1];
+    {
+        fbtBlend fp;
+        if (fp.parse(blendPath) != fbtFile::FS_OK) {
+            printf("Error: could not parse \"%s\".\n", blendPath);
+            return 1;
+        }
+        refDigest = digestObjects(fp);
+        refObjects = countLinks(fp.m_object);
+        check(refObjects > 0, "parse(path)", "objects found");
+    }
+
+    testMmap();
+    testBorrowedMemory();
+#   if FBT_USE_GZ_FILE == 1
+    testGzip();
+#   endif
+#   if FBT_USE_ZSTD_FILE == 1
+    testZstd(0, NO_SEEK_TABLE, "zstd");
+    testZstd(64 << 10, NO_SEEK_TABLE, "zstd (multi-frame)");
+    testZstd(64 << 10, SEEK_TABLE, "zstd (seekable)");
+    testZstd(64 << 10, SEEK_TABLE_CHECKSUMS, "zstd (seekable, checksums)");
+    testZstd(64 << 10, BAD_SEEK_FOOTER, "zstd (bad seek table footer)");
+    testZstd(64 << 10, BAD_SEEK_ENTRY, "zstd (bad seek table entry)");
+#   endif
+    testScanChunks();
+    testLoadFilter(blendPath, "setLoadFilter");
+#   if FBT_USE_GZ_FILE == 1
+    if (writeGzip(tmpPath)) {
+        testLoadFilter(tmpPath, "setLoadFilter (gzip)");
+        remove(tmpPath);
+    }
+#   endif
+    testThumbnail();
+    testBigEndian();
+    testCast(false, "cast");
+    testCast(true, "cast (big endian)");
+    testInnerPointers();
+    testLazyLink();
+    testDnaCache();
+
+#   if FBT_USE_THREADS == 1
+    printf("(%d worker threads)\n", fbtGetNumThreads());
+#   endif
+    printf("%d test(s) failed\n", numFailed);
+    return numFailed ? 1 : 0;
+}